@@ -1,7007 +1,592 @@
 #ifndef SEQUENCES
 #define SEQUENCES
 
-const int canonicalPieceSequences[] = {
-	0, 4, 5, 1, 5, 4, 5, 0, 1, 1, 5, 0, 4, 5, 5, 6, 0, 6, 5, 4,
-	1, 3, 2, 5, 1, 2, 4, 3, 1, 2, 1, 2, 2, 5, 0, 4, 5, 4, 5, 4,
-	2, 6, 2, 0, 1, 4, 4, 3, 0, 2, 1, 4, 2, 3, 5, 2, 3, 2, 5, 3,
-	3, 1, 4, 5, 1, 6, 0, 2, 6, 4, 1, 5, 0, 4, 3, 1, 3, 0, 6, 5,
-	4, 5, 6, 1, 3, 0, 3, 2, 4, 6, 0, 3, 0, 5, 0, 4, 6, 0, 4, 1,
-	5, 0, 6, 3, 4, 5, 0, 2, 6, 3, 5, 2, 0, 3, 2, 3, 2, 0, 5, 0,
-	6, 1, 6, 3, 1, 1, 2, 0, 1, 0, 3, 6, 2, 1, 0, 3, 2, 4, 5, 3,
-	0, 3, 2, 6, 5, 3, 0, 1, 2, 3, 4, 2, 4, 3, 5, 1, 0, 4, 6, 0,
-	1, 5, 6, 1, 5, 2, 0, 1, 4, 6, 5, 2, 4, 1, 3, 2, 1, 5, 1, 0,
-	2, 4, 1, 5, 6, 2, 1, 5, 3, 6, 2, 6, 4, 5, 6, 2, 1, 4, 0, 1,
-	3, 0, 1, 6, 0, 3, 0, 6, 3, 4, 6, 4, 0, 6, 3, 1, 6, 4, 6, 5,
-	4, 3, 0, 6, 4, 3, 6, 2, 6, 4, 0, 4, 3, 5, 2, 5, 0, 6, 0, 3,
-	5, 4, 6, 3, 0, 1, 5, 3, 3, 2, 0, 6, 5, 4, 5, 6, 3, 1, 6, 6,
-	6, 0, 5, 4, 4, 2, 0, 6, 0, 6, 5, 0, 6, 2, 5, 6, 5, 0, 3, 1,
-	0, 1, 4, 6, 1, 0, 4, 6, 3, 1, 5, 4, 1, 5, 6, 0, 1, 2, 0, 6,
-	1, 4, 1, 2, 1, 6, 2, 3, 1, 5, 2, 0, 4, 2, 3, 5, 2, 3, 1, 1,
-	2, 5, 4, 6, 4, 2, 2, 4, 3, 5, 2, 0, 5, 1, 2, 6, 4, 5, 6, 2,
-	3, 5, 3, 1, 6, 3, 1, 4, 0, 4, 2, 5, 4, 0, 6, 2, 6, 2, 4, 0,
-	4, 1, 2, 6, 1, 1, 6, 5, 1, 0, 5, 3, 4, 0, 2, 0, 3, 2, 6, 3,
-	5, 4, 2, 0, 6, 2, 3, 4, 0, 3, 1, 2, 1, 5, 4, 3, 5, 2, 0, 5,
-	6, 0, 1, 4, 5, 2, 4, 1, 4, 2, 4, 1, 5, 3, 3, 2, 1, 6, 1, 6,
-	0, 5, 1, 6, 4, 5, 0, 3, 4, 6, 0, 3, 0, 4, 2, 1, 0, 6, 0, 5,
-	1, 2, 5, 1, 1, 2, 4, 5, 3, 2, 1, 2, 3, 2, 0, 4, 0, 6, 2, 5,
-	2, 1, 6, 4, 1, 6, 3, 4, 4, 0, 5, 0, 5, 4, 0, 1, 4, 1, 3, 6,
-	3, 6, 3, 1, 3, 4, 3, 2, 3, 2, 2, 3, 6, 4, 0, 2, 1, 3, 6, 1,
-	4, 2, 4, 1, 4, 0, 6, 3, 5, 3, 1, 5, 2, 3, 1, 1, 6, 1, 2, 0,
-	5, 1, 2, 6, 2, 5, 3, 4, 5, 2, 4, 0, 4, 5, 2, 1, 4, 1, 6, 4,
-	6, 5, 6, 1, 6, 1, 0, 2, 3, 2, 3, 4, 0, 6, 3, 1, 4, 1, 3, 6,
-	0, 3, 4, 3, 1, 6, 3, 1, 3, 1, 4, 1, 6, 3, 6, 2, 0, 6, 3, 0,
-	1, 6, 1, 4, 6, 5, 4, 3, 4, 3, 5, 2, 0, 6, 2, 2, 5, 3, 6, 3,
-	2, 2, 3, 6, 0, 5, 6, 0, 6, 0, 6, 0, 6, 2, 3, 0, 6, 0, 5, 2,
-	3, 1, 0, 6, 1, 3, 0, 4, 5, 6, 3, 5, 4, 5, 6, 4, 0, 2, 1, 5,
-	4, 2, 4, 6, 3, 5, 1, 5, 3, 5, 1, 5, 4, 2, 0, 4, 0, 4, 1, 0,
-	5, 6, 3, 4, 0, 3, 3, 2, 5, 1, 5, 2, 3, 5, 4, 0, 3, 5, 1, 5,
-	6, 0, 0, 3, 6, 4, 6, 2, 5, 3, 2, 4, 5, 3, 0, 4, 5, 2, 3, 5,
-	0, 4, 1, 5, 3, 6, 4, 2, 0, 1, 5, 1, 4, 2, 4, 1, 6, 3, 5, 4,
-	1, 2, 3, 2, 4, 3, 4, 0, 5, 1, 4, 1, 0, 4, 1, 6, 3, 2, 3, 2,
-	2, 4, 0, 5, 3, 0, 5, 2, 3, 5, 2, 6, 1, 5, 4, 3, 4, 5, 6, 2,
-	3, 6, 0, 6, 4, 4, 6, 5, 3, 5, 2, 6, 1, 2, 4, 2, 0, 2, 4, 0,
-	4, 6, 2, 6, 2, 0, 6, 3, 2, 0, 2, 3, 6, 3, 6, 2, 1, 1, 0, 1,
-	5, 3, 2, 6, 1, 6, 4, 5, 6, 3, 6, 3, 5, 0, 2, 3, 5, 6, 5, 3,
-	6, 3, 2, 5, 4, 6, 2, 5, 1, 6, 0, 3, 6, 0, 5, 3, 3, 0, 0, 4,
-	0, 3, 1, 5, 0, 1, 5, 1, 3, 2, 4, 0, 1, 2, 5, 1, 3, 4, 2, 6,
-	1, 6, 2, 6, 0, 1, 5, 2, 5, 6, 5, 0, 6, 4, 6, 0, 5, 4, 1, 5,
-	2, 0, 6, 6, 0, 3, 2, 0, 3, 0, 4, 4, 4, 0, 5, 2, 6, 0, 4, 0,
-	3, 5, 0, 3, 2, 3, 2, 4, 3, 4, 1, 3, 1, 1, 6, 4, 1, 0, 1, 0,
-	4, 5, 1, 2, 1, 3, 1, 6, 4, 2, 5, 3, 2, 4, 5, 4, 3, 5, 4, 6,
-	5, 2, 3, 1, 5, 6, 4, 5, 0, 1, 2, 0, 6, 4, 1, 5, 4, 4, 6, 2,
-	6, 1, 2, 6, 3, 0, 3, 2, 6, 0, 1, 5, 4, 3, 1, 2, 3, 4, 6, 2,
-	0, 1, 0, 1, 0, 1, 0, 1, 4, 0, 2, 1, 4, 1, 1, 6, 4, 3, 5, 4,
-	1, 4, 3, 6, 1, 1, 5, 1, 3, 6, 0, 2, 5, 1, 6, 2, 0, 6, 5, 1,
-	2, 0, 0, 4, 6, 2, 1, 0, 1, 6, 4, 3, 0, 6, 6, 1, 4, 1, 3, 2,
-	3, 0, 3, 0, 2, 1, 0, 6, 2, 0, 6, 3, 0, 4, 5, 1, 4, 0, 3, 0,
-	4, 5, 5, 0, 1, 3, 5, 3, 5, 1, 4, 2, 3, 3, 3, 4, 5, 2, 5, 2,
-	5, 3, 5, 4, 2, 1, 5, 0, 5, 2, 5, 2, 5, 1, 6, 1, 3, 2, 3, 4,
-	6, 1, 3, 5, 6, 5, 1, 2, 4, 0, 4, 2, 5, 1, 5, 6, 2, 4, 5, 6,
-	0, 3, 0, 2, 5, 6, 6, 5, 0, 1, 2, 3, 4, 4, 2, 0, 2, 4, 6, 5,
-	1, 6, 4, 3, 4, 5, 6, 2, 6, 4, 1, 3, 4, 3, 5, 3, 0, 5, 0, 1,
-	2, 6, 5, 0, 1, 5, 1, 5, 0, 2, 4, 2, 5, 0, 6, 4, 5, 6, 2, 1,
-	3, 6, 2, 2, 0, 3, 5, 6, 4, 0, 5, 4, 3, 0, 2, 5, 2, 3, 6, 5,
-	4, 5, 6, 1, 0, 1, 4, 1, 1, 4, 1, 4, 6, 3, 6, 3, 2, 0, 4, 3,
-	5, 4, 3, 6, 3, 5, 6, 4, 1, 6, 1, 0, 4, 2, 5, 4, 2, 0, 5, 3,
-	6, 2, 6, 0, 6, 2, 4, 2, 4, 2, 4, 2, 4, 0, 1, 6, 0, 1, 2, 4,
-	0, 1, 4, 2, 0, 3, 4, 5, 5, 3, 1, 6, 1, 5, 3, 1, 3, 0, 5, 6,
-	1, 5, 0, 2, 1, 0, 2, 1, 2, 3, 5, 6, 1, 6, 5, 3, 6, 4, 3, 4,
-	2, 4, 3, 6, 2, 4, 3, 6, 1, 2, 0, 3, 3, 2, 4, 1, 6, 1, 4, 4,
-	3, 6, 1, 6, 0, 2, 6, 4, 2, 6, 0, 4, 6, 1, 3, 0, 0, 6, 3, 5,
-	4, 1, 3, 3, 4, 1, 3, 3, 4, 0, 1, 4, 6, 3, 5, 6, 1, 5, 0, 6,
-	5, 0, 1, 6, 4, 1, 0, 5, 0, 1, 0, 2, 6, 1, 4, 0, 5, 2, 0, 2,
-	6, 1, 5, 4, 2, 0, 2, 5, 6, 1, 2, 5, 3, 4, 3, 1, 0, 2, 6, 1,
-	0, 1, 0, 6, 3, 5, 1, 2, 1, 2, 5, 3, 2, 3, 0, 5, 0, 1, 3, 2,
-	1, 5, 6, 5, 1, 5, 6, 0, 6, 4, 5, 1, 2, 3, 4, 0, 6, 2, 5, 4,
-	2, 3, 4, 3, 3, 0, 6, 0, 5, 2, 0, 4, 2, 5, 0, 5, 2, 4, 5, 3,
-	3, 3, 4, 3, 6, 5, 3, 5, 2, 6, 3, 1, 2, 5, 0, 5, 6, 5, 1, 4,
-	4, 3, 0, 5, 0, 6, 5, 3, 1, 5, 0, 4, 3, 2, 3, 6, 0, 4, 3, 0,
-	5, 1, 0, 3, 5, 6, 3, 2, 3, 5, 4, 3, 6, 2, 5, 4, 5, 1, 4, 2,
-	6, 0, 2, 6, 4, 0, 2, 0, 0, 5, 1, 0, 5, 0, 3, 2, 3, 3, 1, 0,
-	0, 6, 4, 6, 4, 2, 4, 5, 2, 4, 2, 5, 6, 2, 0, 2, 0, 5, 1, 0,
-	1, 0, 1, 6, 1, 2, 4, 3, 2, 3, 0, 5, 2, 0, 5, 1, 0, 2, 0, 5,
-	2, 4, 5, 4, 1, 4, 2, 6, 0, 3, 6, 3, 1, 0, 4, 3, 2, 3, 5, 3,
-	3, 0, 6, 0, 3, 2, 0, 6, 3, 4, 4, 3, 4, 2, 5, 2, 4, 1, 3, 2,
-	4, 1, 1, 4, 0, 3, 6, 0, 2, 4, 2, 6, 1, 5, 2, 1, 6, 6, 3, 6,
-	5, 1, 6, 3, 2, 0, 6, 1, 2, 1, 0, 5, 0, 2, 3, 0, 5, 0, 2, 6,
-	6, 4, 2, 3, 0, 1, 0, 3, 4, 1, 1, 3, 2, 6, 6, 5, 2, 5, 4, 3,
-	0, 2, 5, 1, 6, 2, 0, 2, 6, 3, 4, 6, 0, 1, 4, 1, 2, 6, 5, 5,
-	1, 2, 5, 0, 1, 1, 6, 3, 3, 5, 1, 3, 6, 0, 5, 5, 0, 3, 4, 1,
-	2, 1, 6, 5, 6, 3, 1, 0, 5, 3, 3, 6, 5, 2, 0, 2, 2, 5, 6, 4,
-	3, 2, 5, 1, 0, 1, 0, 4, 1, 3, 6, 3, 1, 0, 4, 2, 6, 5, 1, 4,
-	4, 1, 6, 0, 6, 0, 4, 3, 5, 0, 2, 1, 3, 3, 6, 0, 5, 1, 2, 0,
-	5, 2, 5, 6, 0, 2, 0, 3, 6, 1, 4, 3, 1, 2, 1, 3, 1, 3, 6, 1,
-	6, 6, 1, 1, 6, 6, 5, 1, 3, 5, 2, 6, 3, 6, 5, 2, 4, 3, 0, 1,
-	0, 1, 6, 5, 6, 2, 5, 6, 2, 4, 1, 6, 3, 5, 3, 0, 1, 3, 6, 5,
-	1, 0, 1, 5, 3, 4, 1, 3, 1, 3, 4, 1, 6, 4, 6, 5, 2, 5, 4, 0,
-	2, 6, 0, 1, 2, 5, 2, 5, 0, 5, 4, 0, 5, 3, 6, 0, 3, 4, 3, 0,
-	3, 2, 0, 1, 4, 1, 1, 5, 1, 0, 5, 0, 3, 4, 2, 4, 6, 3, 5, 3,
-	4, 1, 0, 3, 0, 5, 6, 4, 1, 1, 6, 4, 4, 0, 6, 0, 0, 0, 6, 4,
-	5, 2, 0, 6, 4, 5, 1, 4, 3, 0, 5, 6, 3, 1, 5, 4, 6, 0, 3, 4,
-	6, 5, 3, 4, 2, 5, 2, 3, 6, 2, 1, 2, 1, 0, 5, 4, 5, 3, 0, 2,
-	0, 3, 1, 3, 1, 6, 4, 5, 1, 2, 5, 2, 0, 3, 3, 0, 4, 5, 4, 4,
-	1, 1, 6, 6, 1, 3, 5, 6, 2, 5, 4, 6, 3, 1, 6, 4, 3, 4, 0, 6,
-	2, 1, 4, 0, 3, 5, 2, 0, 4, 3, 1, 3, 2, 3, 4, 0, 6, 3, 1, 0,
-	3, 4, 6, 4, 0, 5, 5, 1, 2, 5, 3, 2, 5, 3, 1, 4, 2, 3, 4, 6,
-	4, 3, 3, 1, 3, 5, 6, 1, 6, 2, 5, 1, 3, 1, 1, 5, 4, 1, 5, 3,
-	5, 0, 4, 3, 0, 2, 1, 2, 4, 6, 4, 5, 1, 4, 2, 4, 0, 3, 5, 0,
-	6, 1, 1, 2, 0, 4, 0, 6, 0, 6, 2, 1, 5, 4, 6, 1, 4, 1, 5, 0,
-	0, 2, 2, 5, 2, 4, 6, 4, 5, 3, 5, 4, 3, 4, 3, 1, 0, 2, 5, 0,
-	1, 6, 5, 1, 3, 0, 3, 5, 4, 6, 3, 1, 6, 0, 5, 0, 4, 0, 6, 1,
-	2, 0, 6, 5, 2, 1, 4, 3, 2, 3, 5, 0, 3, 2, 4, 2, 0, 5, 4, 1,
-	3, 6, 6, 1, 4, 5, 2, 6, 1, 3, 4, 5, 6, 5, 4, 0, 5, 4, 5, 2,
-	4, 2, 1, 5, 3, 0, 3, 0, 4, 5, 1, 4, 6, 2, 1, 3, 5, 1, 2, 4,
-	5, 0, 4, 6, 5, 0, 4, 1, 6, 5, 0, 6, 5, 6, 3, 3, 0, 6, 1, 2,
-	6, 3, 1, 2, 3, 2, 6, 2, 4, 5, 4, 6, 2, 6, 3, 5, 1, 6, 1, 2,
-	0, 1, 6, 5, 1, 5, 4, 6, 3, 6, 5, 2, 5, 3, 2, 5, 6, 5, 3, 5,
-	1, 0, 6, 0, 5, 6, 5, 1, 6, 4, 4, 6, 5, 3, 0, 5, 6, 1, 6, 4,
-	2, 0, 3, 4, 5, 4, 6, 3, 1, 4, 3, 4, 2, 0, 1, 0, 1, 2, 6, 3,
-	3, 2, 4, 6, 5, 6, 6, 5, 4, 3, 6, 4, 3, 2, 0, 5, 6, 2, 4, 5,
-	4, 0, 6, 4, 0, 4, 2, 5, 0, 2, 1, 0, 3, 0, 4, 1, 5, 4, 2, 4,
-	5, 1, 2, 3, 0, 6, 4, 2, 3, 4, 6, 0, 5, 2, 4, 4, 5, 4, 2, 6,
-	6, 1, 6, 2, 6, 2, 0, 2, 0, 2, 3, 2, 0, 4, 3, 0, 1, 0, 3, 4,
-	0, 4, 6, 0, 6, 3, 1, 3, 4, 3, 5, 5, 6, 5, 4, 1, 6, 3, 3, 1,
-	1, 0, 4, 5, 4, 1, 1, 1, 5, 0, 4, 0, 3, 4, 2, 6, 1, 3, 5, 1,
-	2, 0, 6, 2, 5, 1, 2, 1, 0, 5, 0, 2, 5, 1, 5, 2, 5, 3, 4, 2,
-	3, 2, 0, 6, 0, 6, 2, 6, 6, 4, 1, 5, 2, 5, 0, 6, 4, 3, 1, 6,
-	4, 4, 3, 2, 4, 3, 5, 2, 3, 0, 5, 0, 2, 0, 4, 6, 0, 5, 4, 3,
-	5, 3, 1, 4, 1, 0, 3, 0, 1, 1, 2, 6, 4, 0, 6, 4, 3, 3, 6, 0,
-	6, 0, 3, 5, 0, 5, 0, 5, 6, 2, 2, 0, 1, 4, 0, 1, 4, 4, 3, 5,
-	0, 4, 6, 3, 0, 5, 6, 2, 0, 1, 2, 1, 5, 2, 4, 1, 3, 0, 2, 3,
-	1, 0, 3, 6, 5, 1, 6, 1, 6, 0, 4, 2, 1, 2, 6, 4, 0, 6, 3, 0,
-	2, 1, 1, 2, 0, 1, 5, 0, 6, 3, 4, 2, 1, 2, 1, 3, 1, 2, 0, 4,
-	3, 5, 4, 0, 5, 0, 6, 3, 1, 3, 5, 2, 4, 3, 0, 4, 1, 2, 3, 0,
-	4, 3, 1, 5, 4, 5, 4, 5, 0, 3, 0, 3, 2, 2, 4, 1, 6, 4, 1, 3,
-	5, 3, 6, 4, 2, 5, 6, 0, 1, 2, 4, 6, 2, 4, 3, 6, 6, 1, 1, 1,
-	6, 2, 0, 1, 3, 5, 3, 1, 0, 1, 1, 6, 0, 0, 2, 3, 4, 5, 0, 5,
-	0, 1, 5, 3, 3, 2, 3, 1, 0, 4, 5, 6, 1, 0, 1, 5, 4, 6, 3, 4,
-	1, 6, 4, 6, 5, 0, 1, 4, 1, 5, 4, 5, 1, 3, 3, 6, 4, 3, 2, 6,
-	2, 4, 2, 5, 1, 2, 3, 5, 6, 1, 6, 2, 0, 2, 2, 1, 5, 6, 4, 6,
-	3, 5, 4, 2, 2, 1, 0, 6, 2, 0, 6, 2, 3, 2, 5, 2, 3, 5, 3, 0,
-	4, 2, 4, 2, 4, 1, 1, 0, 5, 6, 3, 5, 1, 2, 0, 3, 1, 5, 2, 3,
-	5, 4, 2, 4, 2, 0, 3, 2, 4, 5, 3, 5, 6, 2, 5, 6, 5, 4, 6, 2,
-	6, 6, 4, 3, 5, 6, 2, 4, 0, 2, 4, 3, 3, 0, 3, 4, 2, 3, 2, 3,
-	0, 2, 3, 1, 0, 2, 4, 2, 1, 5, 3, 5, 0, 1, 2, 0, 5, 2, 3, 6,
-	1, 3, 3, 3, 6, 1, 6, 3, 3, 6, 3, 4, 1, 3, 2, 5, 1, 0, 5, 6,
-	2, 1, 0, 1, 5, 1, 4, 1, 4, 6, 5, 0, 5, 0, 5, 4, 3, 5, 1, 2,
-	3, 0, 6, 1, 4, 6, 1, 0, 2, 4, 2, 3, 4, 5, 1, 3, 4, 1, 5, 3,
-	4, 2, 5, 2, 0, 5, 2, 3, 2, 4, 5, 1, 2, 5, 2, 4, 0, 6, 3, 2,
-	5, 6, 1, 2, 6, 0, 1, 0, 5, 3, 2, 0, 6, 1, 3, 1, 4, 3, 1, 4,
-	6, 1, 2, 0, 2, 0, 5, 1, 4, 2, 0, 3, 1, 4, 3, 4, 6, 0, 2, 5,
-	0, 2, 5, 1, 3, 2, 5, 0, 3, 2, 1, 5, 2, 4, 1, 6, 3, 6, 0, 4,
-	1, 2, 6, 3, 1, 1, 6, 5, 0, 5, 1, 4, 4, 6, 4, 5, 6, 5, 3, 2,
-	2, 0, 3, 5, 1, 6, 1, 2, 1, 0, 5, 1, 0, 1, 2, 5, 6, 5, 0, 6,
-	3, 2, 0, 4, 6, 4, 3, 1, 0, 3, 2, 0, 5, 3, 3, 6, 3, 3, 6, 0,
-	4, 6, 5, 1, 3, 3, 1, 4, 6, 5, 2, 6, 4, 3, 0, 4, 1, 3, 4, 5,
-	5, 2, 3, 6, 3, 6, 4, 4, 0, 1, 2, 6, 4, 6, 3, 0, 4, 3, 5, 3,
-	6, 3, 1, 2, 6, 0, 1, 3, 0, 2, 4, 4, 6, 2, 1, 2, 0, 2, 4, 3,
-	0, 2, 1, 0, 3, 0, 2, 4, 1, 4, 5, 3, 5, 1, 6, 4, 0, 6, 4, 6,
-	1, 0, 5, 6, 4, 6, 5, 3, 2, 6, 2, 5, 1, 3, 0, 6, 5, 3, 2, 4,
-	2, 6, 0, 3, 6, 0, 4, 1, 1, 4, 6, 2, 0, 5, 4, 2, 1, 2, 6, 2,
-	3, 0, 5, 1, 3, 1, 5, 2, 4, 2, 4, 6, 4, 2, 0, 5, 2, 4, 6, 4,
-	4, 3, 1, 4, 0, 3, 0, 5, 2, 0, 4, 3, 3, 2, 6, 4, 5, 6, 4, 3,
-	5, 0, 4, 1, 6, 0, 1, 3, 2, 6, 3, 6, 3, 1, 1, 1, 6, 1, 0, 5,
-	6, 1, 0, 1, 3, 3, 2, 1, 2, 4, 0, 6, 5, 3, 0, 3, 1, 6, 4, 2,
-	0, 1, 6, 5, 3, 6, 1, 4, 3, 6, 3, 3, 3, 4, 2, 1, 3, 6, 4, 0,
-	1, 4, 1, 0, 4, 2, 5, 6, 4, 6, 5, 1, 6, 5, 3, 4, 2, 6, 3, 4,
-	2, 4, 6, 2, 0, 5, 5, 5, 3, 4, 1, 5, 2, 4, 2, 3, 5, 0, 1, 5,
-	3, 0, 2, 1, 0, 1, 5, 4, 3, 1, 3, 2, 0, 4, 2, 3, 6, 5, 2, 4,
-	4, 2, 5, 3, 0, 4, 1, 3, 4, 6, 2, 5, 6, 4, 2, 5, 0, 5, 4, 5,
-	5, 6, 1, 6, 0, 2, 0, 5, 3, 1, 3, 2, 3, 6, 1, 4, 1, 3, 0, 5,
-	6, 2, 6, 4, 1, 4, 2, 6, 0, 3, 6, 0, 3, 6, 3, 2, 5, 6, 4, 2,
-	0, 3, 4, 1, 2, 0, 6, 2, 1, 6, 0, 2, 0, 3, 4, 2, 5, 1, 0, 2,
-	1, 3, 1, 4, 3, 0, 2, 6, 2, 3, 5, 6, 4, 5, 4, 3, 3, 2, 6, 3,
-	2, 5, 4, 1, 6, 4, 5, 6, 2, 6, 4, 1, 5, 6, 1, 6, 5, 4, 3, 1,
-	3, 2, 1, 6, 3, 5, 1, 5, 0, 2, 1, 2, 1, 6, 6, 0, 6, 2, 3, 6,
-	4, 2, 3, 2, 2, 1, 5, 6, 3, 4, 3, 5, 3, 2, 0, 3, 1, 2, 5, 6,
-	5, 3, 2, 4, 3, 6, 2, 3, 1, 2, 1, 5, 0, 2, 4, 6, 1, 5, 0, 3,
-	6, 3, 5, 3, 4, 0, 5, 2, 1, 4, 1, 2, 6, 4, 2, 5, 1, 0, 3, 5,
-	0, 3, 0, 3, 1, 3, 6, 1, 4, 3, 6, 2, 3, 6, 2, 3, 2, 5, 1, 2,
-	1, 5, 1, 2, 3, 1, 3, 0, 2, 5, 3, 0, 6, 4, 1, 1, 4, 3, 5, 1,
-	2, 0, 3, 4, 6, 4, 3, 6, 0, 1, 2, 6, 4, 6, 5, 0, 5, 1, 5, 0,
-	3, 4, 3, 4, 1, 5, 6, 3, 6, 5, 1, 4, 2, 1, 0, 5, 0, 3, 0, 5,
-	4, 1, 6, 1, 0, 5, 0, 3, 4, 4, 2, 3, 3, 6, 2, 5, 1, 3, 5, 6,
-	5, 6, 3, 0, 3, 6, 5, 6, 2, 6, 2, 4, 1, 4, 6, 5, 4, 1, 0, 5,
-	6, 1, 0, 2, 5, 4, 1, 6, 2, 0, 1, 4, 2, 4, 6, 3, 4, 0, 2, 5,
-	0, 5, 2, 5, 3, 1, 3, 6, 1, 6, 2, 3, 4, 3, 1, 4, 3, 5, 4, 2,
-	1, 1, 5, 6, 3, 5, 1, 2, 3, 5, 6, 0, 0, 6, 2, 0, 6, 5, 3, 5,
-	2, 0, 1, 6, 2, 1, 4, 1, 3, 2, 2, 3, 4, 6, 0, 3, 2, 6, 2, 0,
-	3, 5, 0, 2, 4, 1, 2, 1, 6, 1, 0, 6, 5, 2, 5, 4, 2, 6, 3, 0,
-	4, 3, 5, 1, 6, 1, 0, 4, 2, 1, 2, 3, 3, 1, 4, 5, 6, 4, 6, 3,
-	5, 6, 3, 0, 1, 5, 1, 1, 6, 3, 2, 5, 6, 0, 2, 0, 3, 4, 0, 2,
-	6, 3, 2, 6, 2, 4, 5, 1, 2, 2, 6, 1, 4, 3, 2, 2, 3, 1, 1, 5,
-	0, 3, 3, 2, 1, 0, 4, 1, 1, 4, 2, 0, 1, 6, 3, 5, 0, 6, 5, 2,
-	1, 4, 4, 5, 6, 1, 5, 1, 2, 1, 4, 2, 3, 6, 3, 2, 6, 2, 5, 4,
-	2, 5, 0, 1, 2, 4, 2, 4, 1, 3, 6, 0, 3, 5, 0, 3, 6, 3, 2, 3,
-	3, 2, 0, 3, 0, 3, 4, 4, 2, 0, 5, 6, 2, 5, 3, 3, 6, 1, 5, 0,
-	4, 5, 4, 2, 4, 5, 4, 5, 6, 0, 1, 3, 4, 4, 0, 3, 5, 3, 5, 0,
-	5, 4, 1, 1, 5, 2, 6, 2, 3, 4, 5, 6, 2, 5, 4, 5, 2, 0, 4, 0,
-	6, 4, 5, 6, 1, 0, 1, 3, 6, 4, 1, 0, 5, 6, 0, 1, 3, 2, 2, 0,
-	0, 2, 1, 3, 4, 1, 0, 4, 2, 2, 3, 6, 6, 2, 4, 3, 2, 3, 3, 5,
-	1, 4, 0, 3, 4, 3, 5, 6, 2, 1, 5, 3, 0, 6, 4, 2, 1, 3, 0, 2,
-	2, 5, 3, 6, 0, 5, 0, 5, 4, 5, 4, 2, 0, 6, 3, 2, 6, 2, 4, 5,
-	3, 2, 2, 5, 2, 5, 2, 0, 5, 3, 5, 3, 1, 3, 0, 5, 0, 2, 5, 3,
-	4, 3, 5, 6, 2, 5, 2, 1, 5, 1, 6, 5, 6, 1, 2, 1, 5, 6, 0, 3,
-	5, 1, 3, 6, 3, 1, 4, 3, 1, 5, 2, 3, 5, 3, 5, 2, 0, 1, 1, 0,
-	6, 0, 4, 6, 1, 3, 1, 6, 4, 0, 4, 1, 2, 1, 6, 6, 0, 2, 1, 1,
-	0, 6, 3, 1, 0, 2, 4, 0, 5, 2, 1, 0, 5, 1, 0, 5, 1, 6, 4, 1,
-	1, 2, 1, 0, 6, 2, 5, 2, 3, 6, 3, 0, 5, 6, 4, 1, 6, 0, 4, 2,
-	2, 6, 5, 1, 2, 3, 5, 1, 3, 6, 2, 0, 4, 6, 6, 0, 1, 2, 1, 0,
-	3, 2, 5, 6, 6, 4, 3, 4, 3, 2, 0, 5, 2, 3, 1, 2, 1, 2, 5, 1,
-	4, 3, 6, 4, 0, 5, 6, 4, 3, 4, 5, 0, 3, 3, 5, 4, 6, 3, 0, 1,
-	5, 1, 0, 2, 0, 6, 1, 4, 1, 2, 2, 3, 2, 0, 2, 1, 6, 4, 3, 2,
-	6, 2, 6, 5, 3, 4, 2, 5, 3, 5, 0, 3, 1, 3, 2, 1, 1, 5, 2, 0,
-	0, 3, 0, 3, 6, 1, 6, 0, 4, 3, 4, 1, 2, 6, 5, 3, 5, 1, 6, 3,
-	1, 0, 2, 1, 5, 4, 3, 6, 0, 5, 6, 0, 5, 0, 6, 4, 3, 2, 1, 1,
-	2, 4, 6, 2, 4, 6, 4, 3, 0, 3, 1, 1, 5, 2, 6, 3, 1, 1, 1, 4,
-	3, 6, 4, 6, 4, 3, 6, 2, 0, 4, 2, 5, 5, 0, 2, 4, 2, 5, 2, 4,
-	4, 2, 0, 1, 5, 0, 3, 0, 6, 3, 0, 5, 0, 6, 0, 5, 1, 4, 1, 6,
-	5, 2, 1, 4, 4, 0, 5, 3, 6, 2, 6, 1, 3, 1, 3, 6, 1, 6, 0, 5,
-	6, 0, 4, 2, 1, 5, 3, 1, 0, 4, 2, 4, 2, 4, 0, 2, 5, 0, 5, 5,
-	0, 2, 6, 2, 1, 2, 0, 3, 6, 0, 4, 5, 4, 3, 2, 1, 5, 1, 0, 5,
-	1, 3, 1, 6, 3, 3, 4, 6, 5, 4, 4, 5, 1, 2, 5, 2, 6, 3, 6, 2,
-	2, 1, 6, 5, 5, 0, 3, 5, 4, 6, 1, 3, 2, 3, 6, 5, 1, 5, 3, 2,
-	3, 1, 0, 5, 1, 1, 1, 4, 2, 1, 5, 1, 6, 2, 1, 4, 2, 2, 4, 5,
-	4, 6, 0, 5, 2, 5, 2, 0, 6, 3, 5, 6, 3, 0, 5, 4, 2, 3, 6, 0,
-	5, 1, 2, 4, 5, 1, 6, 2, 1, 4, 0, 6, 5, 2, 4, 1, 6, 5, 0, 5,
-	6, 0, 4, 5, 6, 2, 1, 5, 1, 2, 6, 3, 0, 1, 3, 1, 5, 6, 0, 5,
-	0, 1, 0, 5, 2, 6, 5, 2, 2, 3, 0, 1, 3, 1, 3, 1, 3, 2, 5, 0,
-	1, 4, 2, 1, 3, 5, 0, 3, 2, 6, 2, 1, 0, 5, 3, 5, 6, 2, 3, 3,
-	2, 3, 6, 6, 1, 0, 1, 2, 4, 6, 5, 2, 4, 1, 6, 4, 0, 2, 3, 2,
-	3, 1, 6, 5, 4, 0, 4, 0, 6, 2, 0, 4, 5, 1, 6, 2, 5, 0, 3, 5,
-	4, 0, 6, 2, 1, 3, 5, 4, 0, 4, 6, 2, 5, 0, 0, 5, 0, 5, 1, 4,
-	5, 3, 6, 4, 5, 6, 3, 1, 3, 1, 0, 6, 1, 6, 5, 3, 4, 0, 6, 3,
-	6, 4, 1, 0, 3, 5, 2, 5, 2, 4, 6, 6, 5, 6, 5, 4, 1, 0, 1, 2,
-	0, 4, 1, 5, 1, 2, 5, 1, 0, 6, 3, 5, 4, 6, 4, 2, 1, 5, 4, 0,
-	1, 0, 2, 0, 1, 6, 2, 1, 0, 3, 5, 1, 0, 1, 1, 6, 2, 1, 0, 1,
-	2, 0, 2, 5, 5, 0, 3, 6, 2, 3, 0, 6, 3, 2, 3, 0, 6, 5, 1, 0,
-	3, 4, 2, 6, 3, 4, 5, 3, 1, 4, 5, 6, 5, 5, 2, 1, 2, 1, 2, 0,
-	4, 2, 0, 3, 4, 2, 1, 0, 3, 0, 5, 6, 5, 6, 1, 2, 1, 0, 1, 4,
-	5, 3, 6, 3, 6, 2, 6, 1, 6, 4, 0, 4, 1, 6, 0, 6, 2, 1, 2, 5,
-	6, 5, 2, 5, 0, 1, 2, 5, 4, 5, 2, 1, 5, 0, 1, 0, 6, 3, 5, 1,
-	0, 3, 6, 4, 2, 3, 3, 5, 4, 1, 3, 5, 4, 6, 5, 2, 1, 6, 5, 0,
-	1, 0, 2, 1, 2, 1, 6, 4, 6, 2, 3, 0, 3, 6, 1, 2, 5, 1, 6, 2,
-	2, 0, 6, 0, 4, 4, 1, 3, 6, 3, 2, 6, 2, 0, 1, 0, 2, 0, 4, 6,
-	3, 3, 0, 2, 5, 2, 2, 0, 2, 0, 5, 4, 6, 3, 4, 3, 3, 4, 0, 1,
-	4, 2, 0, 6, 0, 3, 1, 4, 5, 0, 2, 4, 1, 3, 2, 5, 3, 0, 5, 6,
-	5, 0, 5, 1, 2, 0, 6, 5, 3, 6, 2, 6, 5, 4, 1, 6, 2, 1, 5, 0,
-	6, 0, 3, 0, 3, 6, 1, 6, 4, 0, 2, 3, 1, 2, 6, 3, 4, 1, 3, 0,
-	0, 2, 0, 3, 2, 4, 5, 3, 1, 5, 6, 6, 1, 4, 1, 1, 3, 5, 2, 5,
-	1, 5, 0, 2, 1, 0, 5, 1, 5, 1, 6, 4, 0, 1, 3, 1, 6, 0, 4, 2,
-	2, 0, 4, 1, 5, 2, 6, 4, 3, 4, 2, 4, 2, 6, 2, 6, 4, 3, 4, 1,
-	3, 0, 4, 1, 5, 2, 5, 5, 4, 3, 4, 6, 5, 6, 6, 4, 1, 6, 1, 4,
-	4, 3, 5, 5, 0, 5, 1, 5, 6, 5, 1, 2, 5, 0, 2, 0, 2, 1, 6, 2,
-	5, 2, 6, 5, 6, 2, 3, 6, 1, 4, 5, 2, 4, 2, 1, 0, 4, 6, 3, 6,
-	6, 4, 6, 5, 0, 5, 0, 1, 5, 3, 2, 3, 0, 6, 3, 5, 4, 2, 3, 4,
-	0, 5, 4, 6, 2, 0, 3, 6, 3, 2, 5, 6, 5, 0, 6, 3, 1, 4, 1, 2,
-	1, 4, 1, 3, 2, 1, 2, 5, 0, 0, 6, 2, 6, 3, 6, 4, 5, 4, 2, 1,
-	2, 2, 3, 2, 3, 1, 6, 1, 0, 6, 5, 6, 4, 2, 1, 1, 3, 5, 3, 2,
-	3, 0, 4, 0, 2, 3, 4, 2, 5, 3, 1, 4, 2, 4, 3, 3, 0, 4, 6, 1,
-	4, 6, 4, 0, 1, 2, 3, 6, 1, 1, 4, 1, 6, 4, 6, 5, 2, 3, 4, 1,
-	5, 6, 0, 0, 3, 6, 5, 0, 2, 0, 2, 4, 2, 1, 5, 3, 5, 5, 3, 4,
-	6, 6, 1, 2, 4, 2, 1, 4, 1, 3, 6, 3, 4, 5, 3, 6, 4, 2, 1, 2,
-	0, 4, 0, 0, 6, 5, 1, 6, 3, 6, 5, 2, 0, 6, 0, 3, 5, 4, 2, 6,
-	1, 3, 1, 0, 6, 4, 5, 1, 4, 2, 1, 0, 1, 0, 4, 2, 5, 3, 6, 1,
-	2, 0, 2, 0, 5, 3, 4, 4, 3, 6, 1, 3, 5, 1, 5, 2, 0, 2, 1, 0,
-	3, 0, 4, 5, 0, 6, 5, 3, 4, 6, 2, 6, 2, 3, 4, 5, 6, 3, 2, 3,
-	4, 1, 2, 0, 4, 6, 5, 1, 3, 2, 6, 4, 5, 4, 1, 5, 0, 4, 3, 0,
-	5, 4, 0, 0, 2, 1, 5, 2, 2, 0, 6, 1, 4, 3, 3, 4, 5, 0, 3, 6,
-	6, 0, 1, 4, 0, 4, 3, 1, 6, 5, 4, 2, 6, 1, 4, 2, 1, 3, 0, 2,
-	0, 6, 2, 4, 5, 6, 2, 5, 4, 6, 4, 2, 1, 1, 5, 0, 3, 6, 4, 6,
-	1, 0, 2, 3, 2, 1, 6, 2, 3, 4, 2, 5, 4, 2, 6, 0, 6, 2, 6, 1,
-	2, 1, 2, 2, 5, 4, 3, 4, 0, 3, 2, 0, 3, 5, 6, 2, 1, 6, 0, 3,
-	3, 0, 5, 1, 5, 3, 3, 1, 0, 3, 5, 1, 6, 4, 1, 6, 3, 6, 2, 0,
-	4, 5, 4, 4, 1, 6, 1, 2, 0, 4, 1, 5, 0, 3, 4, 5, 1, 4, 5, 3,
-	5, 6, 2, 3, 6, 2, 5, 1, 5, 4, 1, 4, 5, 1, 6, 0, 1, 3, 4, 1,
-	6, 1, 0, 1, 3, 2, 1, 0, 3, 0, 1, 3, 0, 3, 5, 4, 1, 6, 3, 4,
-	0, 2, 2, 3, 5, 3, 1, 2, 6, 2, 5, 1, 5, 1, 2, 4, 0, 2, 3, 5,
-	1, 2, 5, 1, 2, 6, 2, 5, 1, 5, 1, 3, 0, 5, 1, 5, 6, 6, 5, 2,
-	2, 1, 6, 3, 6, 2, 0, 2, 5, 1, 6, 2, 3, 2, 0, 1, 4, 2, 5, 3,
-	3, 3, 2, 6, 0, 3, 1, 4, 3, 5, 6, 5, 4, 2, 6, 2, 3, 6, 1, 2,
-	4, 1, 0, 5, 3, 1, 2, 1, 2, 4, 0, 5, 0, 4, 5, 2, 1, 1, 4, 0,
-	5, 3, 1, 4, 2, 4, 1, 1, 5, 3, 1, 4, 5, 0, 4, 5, 4, 1, 0, 0,
-	6, 4, 0, 6, 4, 3, 2, 3, 5, 1, 0, 5, 1, 3, 1, 3, 1, 2, 0, 4,
-	0, 5, 1, 6, 1, 0, 6, 1, 4, 2, 6, 5, 0, 6, 1, 0, 4, 2, 4, 0,
-	1, 6, 4, 3, 4, 0, 1, 4, 6, 4, 3, 5, 6, 0, 2, 4, 0, 3, 6, 5,
-	2, 0, 4, 6, 0, 2, 3, 5, 5, 6, 4, 1, 5, 4, 5, 5, 6, 0, 2, 6,
-	3, 6, 1, 4, 3, 3, 1, 4, 5, 2, 3, 2, 5, 3, 4, 5, 1, 0, 6, 5,
-	4, 2, 4, 6, 2, 0, 6, 4, 5, 1, 5, 3, 6, 3, 1, 4, 2, 0, 3, 0,
-	5, 6, 5, 3, 5, 0, 2, 5, 4, 1, 0, 1, 6, 2, 1, 3, 4, 0, 2, 5,
-	6, 4, 5, 0, 5, 3, 4, 5, 0, 2, 0, 4, 1, 6, 3, 5, 3, 0, 5, 0,
-	0, 3, 6, 1, 5, 4, 3, 0, 6, 2, 5, 6, 5, 3, 5, 1, 1, 5, 0, 6,
-	1, 4, 5, 3, 5, 6, 4, 6, 0, 5, 3, 3, 4, 4, 6, 5, 1, 1, 4, 5,
-	2, 1, 3, 4, 2, 4, 6, 2, 0, 4, 6, 4, 2, 5, 0, 5, 1, 3, 3, 0,
-	3, 6, 5, 3, 6, 4, 2, 5, 6, 5, 4, 3, 6, 5, 3, 5, 4, 6, 2, 4,
-	4, 5, 2, 4, 5, 3, 0, 5, 1, 0, 6, 3, 1, 3, 4, 5, 4, 3, 6, 1,
-	5, 2, 0, 2, 4, 2, 5, 6, 5, 1, 6, 5, 2, 5, 1, 5, 3, 0, 6, 4,
-	6, 1, 3, 1, 5, 1, 3, 4, 3, 0, 2, 6, 5, 3, 0, 4, 0, 5, 2, 4,
-	0, 6, 3, 2, 3, 0, 6, 4, 1, 2, 4, 3, 4, 2, 5, 6, 6, 0, 6, 1,
-	1, 0, 3, 5, 0, 2, 6, 0, 1, 4, 2, 0, 3, 5, 1, 5, 4, 5, 1, 2,
-	2, 0, 2, 4, 3, 4, 6, 3, 4, 0, 1, 0, 6, 5, 0, 1, 6, 1, 5, 2,
-	3, 6, 5, 3, 1, 2, 4, 5, 3, 0, 4, 0, 2, 0, 4, 0, 2, 6, 0, 3,
-	4, 6, 1, 2, 4, 0, 3, 6, 1, 4, 0, 4, 6, 2, 4, 1, 2, 3, 3, 0,
-	5, 2, 4, 6, 4, 2, 5, 1, 6, 2, 4, 6, 1, 6, 3, 2, 0, 6, 2, 3,
-	6, 2, 1, 5, 1, 0, 5, 3, 4, 6, 3, 0, 4, 2, 2, 3, 2, 0, 6, 3,
-	0, 5, 4, 4, 2, 1, 1, 0, 3, 5, 0, 2, 4, 0, 6, 3, 2, 0, 1, 2,
-	1, 4, 6, 5, 6, 5, 0, 3, 0, 5, 4, 0, 2, 4, 6, 5, 4, 0, 6, 0,
-	2, 0, 6, 4, 5, 3, 0, 1, 2, 0, 3, 5, 2, 0, 4, 0, 5, 1, 5, 5,
-	3, 6, 3, 3, 3, 4, 5, 2, 1, 2, 0, 2, 0, 3, 4, 6, 5, 3, 4, 6,
-	4, 2, 3, 2, 3, 2, 0, 5, 4, 6, 0, 1, 3, 5, 4, 0, 3, 0, 1, 6,
-	5, 6, 3, 0, 6, 2, 2, 5, 6, 3, 6, 6, 3, 2, 3, 1, 0, 1, 0, 6,
-	6, 5, 3, 6, 1, 3, 4, 6, 6, 6, 4, 5, 3, 5, 0, 1, 6, 1, 4, 0,
-	0, 4, 0, 4, 4, 4, 6, 1, 2, 4, 0, 2, 3, 3, 6, 4, 6, 5, 1, 0,
-	1, 0, 6, 4, 6, 1, 6, 2, 5, 6, 4, 3, 1, 3, 3, 4, 3, 3, 4, 1,
-	2, 0, 5, 6, 0, 0, 1, 3, 3, 4, 0, 3, 6, 0, 2, 5, 2, 5, 0, 2,
-	3, 2, 1, 4, 6, 4, 5, 2, 0, 2, 6, 6, 2, 5, 1, 5, 3, 6, 6, 3,
-	4, 1, 6, 5, 0, 4, 5, 2, 5, 3, 6, 1, 3, 4, 4, 6, 3, 1, 6, 3,
-	5, 6, 4, 1, 4, 3, 2, 3, 5, 2, 4, 5, 2, 6, 3, 2, 4, 5, 0, 4,
-	6, 2, 1, 0, 5, 4, 6, 6, 3, 1, 5, 1, 0, 2, 4, 3, 5, 1, 0, 6,
-	0, 2, 5, 1, 4, 6, 1, 2, 0, 2, 6, 3, 5, 2, 6, 6, 3, 5, 0, 5,
-	1, 2, 5, 2, 1, 2, 1, 5, 6, 3, 1, 0, 4, 1, 1, 3, 2, 1, 3, 2,
-	2, 0, 1, 6, 4, 0, 3, 0, 5, 0, 4, 6, 5, 0, 3, 4, 0, 3, 1, 3,
-	3, 6, 4, 3, 6, 4, 2, 3, 1, 3, 6, 5, 6, 6, 0, 4, 0, 5, 6, 3,
-	4, 1, 2, 5, 6, 1, 0, 3, 1, 2, 1, 4, 5, 4, 2, 1, 4, 6, 4, 6,
-	5, 5, 3, 0, 6, 1, 2, 3, 2, 4, 3, 6, 4, 5, 1, 6, 3, 3, 6, 3,
-	6, 0, 6, 0, 4, 5, 6, 4, 3, 4, 2, 4, 6, 5, 0, 6, 5, 5, 2, 6,
-	0, 4, 2, 0, 2, 5, 2, 5, 0, 2, 0, 1, 5, 0, 5, 4, 2, 4, 0, 5,
-	1, 2, 5, 6, 2, 3, 0, 5, 1, 0, 3, 5, 2, 6, 0, 4, 6, 2, 6, 2,
-	2, 4, 5, 4, 3, 5, 6, 4, 0, 5, 2, 4, 0, 2, 4, 6, 2, 6, 0, 3,
-	3, 5, 2, 4, 5, 0, 5, 2, 6, 5, 4, 0, 4, 0, 4, 1, 6, 4, 0, 4,
-	4, 0, 2, 4, 0, 1, 6, 3, 4, 6, 1, 4, 3, 6, 5, 0, 4, 6, 3, 4,
-	5, 1, 2, 4, 5, 3, 4, 2, 6, 4, 3, 1, 3, 5, 0, 3, 0, 2, 1, 5,
-	6, 4, 2, 3, 1, 6, 0, 4, 5, 3, 4, 1, 4, 2, 5, 1, 6, 3, 1, 3,
-	0, 2, 0, 2, 3, 2, 4, 2, 5, 3, 6, 1, 0, 4, 1, 6, 2, 0, 2, 2,
-	1, 4, 2, 5, 2, 3, 6, 2, 4, 5, 2, 5, 2, 1, 3, 2, 5, 0, 1, 5,
-	2, 3, 0, 1, 2, 6, 1, 2, 6, 3, 6, 3, 0, 5, 6, 1, 3, 4, 5, 2,
-	3, 2, 5, 2, 4, 3, 3, 2, 6, 4, 2, 6, 3, 3, 0, 5, 0, 1, 2, 2,
-	4, 0, 2, 1, 2, 6, 1, 4, 2, 1, 5, 3, 5, 6, 1, 3, 0, 5, 3, 6,
-	5, 6, 3, 5, 5, 2, 1, 0, 6, 4, 2, 4, 3, 0, 3, 5, 4, 5, 2, 6,
-	6, 3, 0, 1, 6, 4, 0, 5, 6, 4, 6, 1, 1, 0, 2, 0, 5, 4, 6, 4,
-	0, 6, 0, 4, 5, 1, 3, 5, 2, 1, 2, 0, 2, 2, 4, 3, 2, 6, 2, 3,
-	1, 6, 2, 3, 0, 6, 4, 0, 6, 1, 0, 5, 4, 0, 1, 3, 6, 5, 3, 0,
-	2, 0, 5, 4, 0, 1, 2, 4, 2, 0, 5, 0, 3, 1, 4, 0, 1, 4, 1, 6,
-	3, 2, 5, 3, 2, 4, 3, 5, 6, 4, 5, 6, 0, 4, 1, 0, 5, 4, 2, 6,
-	4, 6, 4, 0, 5, 6, 3, 5, 6, 5, 6, 2, 3, 0, 2, 1, 2, 5, 6, 1,
-	5, 2, 1, 6, 1, 1, 6, 1, 3, 0, 3, 4, 0, 4, 2, 0, 4, 2, 5, 2,
-	6, 4, 0, 6, 2, 0, 4, 0, 3, 0, 4, 1, 2, 0, 2, 1, 4, 3, 4, 4,
-	0, 5, 0, 1, 4, 3, 5, 4, 5, 1, 4, 0, 2, 1, 4, 1, 0, 1, 6, 5,
-	1, 4, 2, 3, 5, 0, 5, 4, 3, 6, 2, 0, 5, 3, 4, 5, 0, 3, 5, 3,
-	2, 5, 0, 4, 0, 2, 3, 1, 4, 3, 0, 1, 2, 0, 0, 1, 3, 4, 6, 2,
-	3, 5, 6, 6, 5, 0, 3, 2, 3, 1, 4, 1, 6, 4, 3, 6, 5, 3, 5, 6,
-	4, 5, 1, 6, 2, 4, 3, 1, 1, 1, 1, 5, 3, 2, 1, 0, 4, 3, 6, 4,
-	5, 1, 3, 2, 5, 4, 0, 2, 5, 1, 6, 3, 0, 2, 5, 3, 0, 5, 4, 3,
-	6, 1, 0, 3, 2, 4, 2, 3, 4, 3, 1, 2, 4, 5, 4, 1, 6, 4, 0, 5,
-	0, 5, 6, 4, 5, 3, 1, 2, 2, 0, 5, 3, 0, 4, 2, 1, 6, 2, 3, 0,
-	1, 0, 5, 4, 1, 3, 6, 5, 2, 5, 3, 6, 0, 1, 4, 4, 0, 3, 1, 4,
-	2, 6, 1, 5, 0, 6, 1, 4, 0, 4, 2, 1, 4, 2, 5, 4, 1, 6, 2, 5,
-	3, 2, 5, 3, 0, 1, 5, 4, 3, 0, 3, 1, 6, 5, 4, 6, 0, 5, 0, 4,
-	4, 0, 0, 1, 4, 3, 2, 6, 1, 2, 6, 2, 6, 3, 5, 1, 6, 2, 1, 0,
-	5, 1, 5, 6, 3, 1, 3, 3, 1, 0, 4, 6, 1, 5, 3, 4, 2, 5, 1, 5,
-	6, 1, 2, 5, 3, 6, 2, 0, 5, 4, 0, 5, 6, 2, 2, 3, 2, 0, 6, 1,
-	0, 5, 1, 0, 5, 3, 1, 2, 3, 4, 3, 1, 1, 2, 3, 4, 1, 4, 2, 5,
-	1, 2, 3, 4, 6, 5, 0, 5, 1, 6, 3, 1, 5, 2, 1, 4, 6, 1, 5, 0,
-	2, 6, 2, 5, 1, 4, 1, 4, 6, 0, 5, 1, 4, 1, 2, 2, 5, 0, 6, 2,
-	3, 3, 6, 5, 3, 4, 5, 1, 4, 2, 1, 0, 2, 4, 2, 1, 4, 6, 4, 4,
-	4, 3, 0, 3, 2, 3, 6, 4, 3, 1, 1, 5, 2, 6, 2, 1, 1, 0, 2, 3,
-	5, 2, 6, 0, 3, 5, 3, 4, 6, 2, 3, 5, 3, 4, 2, 4, 2, 1, 0, 4,
-	6, 5, 4, 6, 4, 5, 3, 5, 1, 1, 5, 1, 0, 4, 3, 4, 3, 6, 3, 1,
-	0, 5, 0, 6, 6, 2, 5, 5, 6, 2, 6, 1, 2, 5, 4, 0, 3, 0, 4, 1,
-	1, 2, 4, 3, 5, 1, 3, 3, 6, 5, 1, 3, 1, 0, 5, 3, 0, 2, 4, 2,
-	2, 6, 2, 4, 2, 3, 4, 3, 4, 2, 5, 6, 1, 2, 0, 4, 1, 5, 4, 6,
-	3, 6, 2, 1, 2, 4, 6, 4, 4, 6, 0, 2, 5, 3, 6, 1, 3, 3, 5, 2,
-	4, 2, 6, 4, 6, 2, 3, 4, 1, 4, 1, 4, 0, 4, 6, 5, 4, 6, 2, 5,
-	5, 4, 1, 0, 5, 4, 2, 4, 0, 5, 2, 1, 3, 5, 6, 3, 2, 3, 3, 1,
-	6, 3, 4, 6, 4, 2, 3, 3, 6, 1, 6, 2, 4, 1, 0, 2, 3, 6, 1, 5,
-	0, 2, 3, 5, 1, 6, 4, 6, 0, 5, 3, 0, 6, 5, 4, 2, 1, 4, 0, 4,
-	1, 4, 3, 4, 1, 2, 0, 2, 0, 3, 6, 2, 3, 1, 3, 1, 6, 3, 0, 3,
-	2, 3, 4, 6, 2, 5, 6, 1, 5, 1, 1, 0, 4, 5, 3, 1, 3, 0, 6, 1,
-	3, 3, 5, 2, 4, 6, 1, 4, 0, 1, 6, 1, 6, 2, 5, 6, 2, 6, 4, 2,
-	4, 6, 4, 2, 4, 1, 2, 4, 5, 1, 0, 1, 4, 4, 2, 0, 0, 4, 0, 2,
-	5, 6, 3, 2, 3, 1, 2, 1, 0, 4, 5, 4, 3, 2, 0, 4, 6, 0, 4, 5,
-	6, 2, 5, 2, 5, 0, 1, 2, 0, 1, 5, 2, 3, 0, 5, 1, 0, 3, 2, 6,
-	0, 2, 2, 0, 4, 0, 6, 2, 6, 0, 5, 0, 6, 1, 0, 5, 3, 0, 2, 5,
-	1, 6, 5, 3, 4, 3, 5, 2, 4, 0, 2, 0, 4, 0, 6, 1, 5, 3, 0, 4,
-	2, 1, 3, 0, 1, 4, 6, 0, 1, 2, 5, 0, 4, 1, 2, 0, 1, 5, 1, 0,
-	3, 3, 0, 6, 2, 4, 3, 3, 5, 1, 0, 6, 5, 6, 3, 1, 0, 6, 2, 0,
-	4, 0, 1, 6, 3, 4, 0, 3, 1, 4, 2, 5, 2, 3, 0, 1, 3, 0, 2, 3,
-	5, 1, 6, 0, 5, 2, 6, 5, 6, 5, 0, 4, 0, 5, 4, 3, 4, 5, 1, 0,
-	6, 2, 5, 3, 3, 1, 6, 2, 6, 2, 4, 2, 6, 5, 2, 4, 3, 5, 4, 6,
-	0, 6, 2, 3, 5, 2, 1, 5, 2, 6, 5, 4, 0, 0, 1, 3, 4, 3, 2, 0,
-	1, 3, 2, 0, 2, 5, 3, 2, 6, 1, 0, 5, 3, 5, 1, 4, 0, 3, 2, 1,
-	2, 4, 6, 3, 4, 5, 3, 2, 6, 0, 2, 3, 2, 4, 5, 4, 3, 1, 0, 2,
-	3, 2, 4, 3, 2, 5, 1, 2, 1, 5, 2, 0, 1, 0, 3, 6, 4, 3, 4, 5,
-	4, 1, 4, 3, 1, 6, 4, 5, 6, 0, 4, 0, 0, 5, 6, 3, 5, 1, 4, 2,
-	5, 3, 4, 0, 3, 1, 4, 5, 0, 0, 0, 1, 1, 6, 4, 1, 4, 5, 0, 5,
-	6, 2, 0, 5, 4, 2, 0, 4, 1, 2, 6, 0, 3, 6, 3, 4, 1, 2, 5, 2,
-	0, 1, 3, 6, 5, 1, 2, 6, 5, 2, 2, 4, 3, 6, 3, 3, 1, 0, 3, 6,
-	1, 6, 5, 2, 5, 3, 3, 3, 4, 5, 1, 4, 2, 1, 1, 4, 2, 0, 2, 5,
-	2, 0, 1, 4, 2, 4, 0, 5, 0, 6, 2, 0, 1, 3, 2, 4, 3, 6, 3, 1,
-	3, 1, 4, 5, 6, 1, 5, 4, 0, 4, 0, 5, 2, 0, 3, 5, 3, 6, 0, 5,
-	4, 1, 0, 6, 1, 0, 6, 4, 0, 6, 1, 6, 0, 2, 0, 6, 2, 4, 6, 1,
-	5, 1, 5, 6, 4, 0, 2, 0, 4, 2, 0, 5, 1, 0, 2, 3, 1, 6, 1, 4,
-	6, 3, 1, 3, 0, 4, 1, 0, 6, 1, 2, 5, 0, 3, 5, 1, 6, 4, 2, 6,
-	0, 2, 4, 5, 4, 3, 2, 4, 2, 4, 3, 4, 1, 0, 0, 2, 1, 5, 0, 6,
-	1, 4, 0, 5, 2, 4, 4, 2, 4, 5, 2, 3, 4, 1, 1, 2, 0, 1, 3, 0,
-	2, 5, 2, 4, 3, 5, 1, 4, 0, 6, 0, 5, 6, 1, 1, 1, 6, 2, 1, 4,
-	3, 2, 4, 3, 4, 1, 4, 0, 2, 5, 2, 3, 6, 3, 3, 0, 1, 1, 0, 5,
-	4, 5, 1, 2, 4, 0, 1, 2, 6, 1, 2, 1, 0, 4, 2, 3, 3, 0, 5, 2,
-	5, 3, 6, 5, 0, 1, 6, 0, 6, 2, 4, 5, 2, 0, 4, 6, 4, 5, 6, 5,
-	6, 1, 2, 0, 5, 6, 4, 0, 3, 2, 6, 2, 0, 2, 4, 2, 0, 0, 3, 2,
-	0, 1, 0, 1, 6, 2, 5, 4, 3, 0, 5, 6, 2, 0, 3, 3, 5, 2, 1, 5,
-	1, 4, 1, 3, 3, 2, 3, 5, 0, 0, 6, 2, 5, 3, 1, 4, 3, 2, 3, 2,
-	2, 0, 5, 2, 0, 1, 0, 4, 1, 4, 6, 3, 0, 3, 5, 2, 0, 4, 1, 2,
-	3, 5, 1, 4, 0, 1, 3, 5, 6, 0, 4, 2, 3, 0, 5, 3, 3, 5, 6, 1,
-	4, 5, 1, 2, 1, 5, 2, 5, 4, 5, 5, 3, 5, 1, 1, 6, 1, 2, 4, 5,
-	5, 4, 2, 4, 4, 2, 0, 6, 4, 6, 1, 3, 1, 0, 3, 2, 4, 2, 4, 1,
-	6, 1, 0, 2, 4, 2, 4, 1, 4, 3, 0, 3, 0, 3, 1, 3, 4, 2, 0, 4,
-	0, 6, 0, 6, 4, 1, 3, 6, 5, 2, 5, 2, 5, 6, 5, 4, 2, 4, 5, 1,
-	1, 6, 2, 3, 2, 0, 2, 3, 1, 1, 4, 6, 4, 6, 4, 6, 0, 6, 6, 1,
-	2, 1, 2, 3, 4, 2, 4, 3, 1, 4, 4, 0, 3, 2, 6, 2, 3, 2, 5, 1,
-	3, 5, 5, 3, 3, 1, 5, 2, 6, 5, 4, 6, 1, 3, 0, 3, 1, 4, 3, 1,
-	4, 5, 6, 4, 4, 0, 6, 4, 6, 1, 4, 5, 2, 4, 5, 1, 1, 3, 1, 4,
-	5, 3, 5, 1, 4, 5, 3, 2, 3, 5, 2, 0, 4, 0, 2, 3, 5, 0, 3, 6,
-	6, 1, 4, 5, 2, 3, 6, 0, 6, 1, 4, 2, 0, 1, 6, 3, 1, 5, 6, 1,
-	0, 3, 2, 1, 5, 3, 1, 3, 1, 4, 2, 0, 3, 0, 2, 3, 2, 5, 0, 3,
-	1, 6, 1, 2, 5, 6, 6, 5, 0, 3, 4, 6, 4, 2, 3, 6, 5, 3, 6, 4,
-	2, 6, 2, 5, 4, 6, 4, 5, 3, 6, 1, 3, 5, 6, 4, 0, 4, 1, 6, 1,
-	3, 1, 3, 0, 2, 4, 3, 2, 6, 5, 6, 2, 5, 3, 2, 1, 2, 3, 3, 1,
-	4, 3, 5, 1, 5, 2, 1, 0, 3, 5, 3, 6, 1, 6, 4, 3, 4, 1, 6, 0,
-	5, 2, 5, 4, 6, 5, 6, 3, 6, 6, 0, 6, 4, 3, 2, 0, 5, 3, 5, 2,
-	6, 5, 3, 0, 3, 6, 5, 6, 2, 6, 4, 1, 2, 4, 3, 2, 0, 5, 4, 5,
-	0, 6, 0, 3, 5, 4, 3, 0, 1, 0, 2, 3, 6, 3, 0, 1, 4, 0, 4, 0,
-	1, 4, 6, 4, 1, 6, 5, 0, 6, 0, 6, 4, 1, 4, 2, 5, 6, 2, 3, 4,
-	2, 6, 4, 3, 1, 2, 3, 6, 5, 4, 6, 5, 0, 4, 6, 5, 2, 3, 4, 1,
-	3, 1, 5, 4, 3, 0, 6, 5, 1, 6, 2, 0, 3, 5, 0, 2, 1, 4, 2, 5,
-	4, 0, 4, 6, 6, 1, 4, 6, 4, 3, 4, 2, 3, 2, 5, 4, 1, 1, 0, 5,
-	5, 1, 3, 1, 2, 0, 5, 1, 0, 2, 0, 1, 4, 4, 6, 0, 4, 1, 3, 2,
-	6, 0, 4, 5, 4, 5, 4, 3, 1, 5, 1, 2, 0, 5, 4, 0, 1, 6, 2, 5,
-	0, 5, 4, 5, 3, 5, 1, 4, 6, 2, 1, 5, 1, 4, 0, 3, 5, 1, 6, 3,
-	1, 0, 6, 4, 3, 4, 3, 3, 6, 2, 6, 5, 2, 0, 5, 5, 3, 5, 1, 5,
-	2, 5, 2, 0, 1, 5, 4, 3, 4, 0, 2, 6, 1, 5, 3, 0, 6, 2, 5, 6,
-	3, 0, 2, 5, 6, 5, 1, 3, 2, 5, 3, 5, 6, 0, 2, 1, 3, 1, 3, 0,
-	4, 5, 6, 6, 1, 1, 6, 3, 1, 6, 3, 4, 2, 6, 4, 2, 3, 1, 1, 4,
-	5, 2, 0, 5, 2, 5, 6, 1, 5, 3, 6, 1, 4, 2, 6, 5, 3, 5, 1, 0,
-	6, 2, 3, 2, 0, 6, 1, 3, 6, 3, 4, 6, 1, 0, 1, 2, 4, 0, 3, 6,
-	0, 4, 3, 4, 3, 4, 0, 3, 1, 2, 1, 0, 5, 3, 5, 6, 0, 6, 3, 0,
-	1, 6, 3, 5, 1, 6, 4, 0, 2, 5, 3, 4, 6, 1, 1, 6, 0, 2, 5, 3,
-	2, 6, 1, 2, 5, 0, 3, 3, 6, 3, 5, 1, 2, 0, 4, 0, 6, 0, 2, 3,
-	3, 5, 1, 6, 5, 2, 3, 1, 4, 3, 0, 5, 3, 1, 5, 0, 2, 4, 3, 0,
-	4, 5, 3, 2, 4, 6, 5, 1, 3, 5, 1, 5, 3, 5, 2, 6, 3, 2, 4, 4,
-	5, 1, 0, 1, 6, 0, 3, 6, 2, 0, 4, 5, 2, 1, 2, 1, 3, 3, 4, 3,
-	6, 4, 0, 4, 2, 4, 5, 6, 5, 6, 1, 4, 5, 1, 1, 0, 3, 4, 3, 5,
-	0, 2, 0, 2, 0, 2, 0, 3, 2, 6, 4, 6, 5, 4, 1, 0, 2, 0, 6, 3,
-	1, 3, 5, 4, 1, 4, 1, 3, 6, 1, 0, 2, 0, 4, 4, 2, 5, 4, 5, 1,
-	2, 0, 6, 3, 4, 2, 3, 3, 2, 6, 3, 3, 2, 6, 5, 2, 1, 0, 4, 2,
-	3, 4, 3, 2, 1, 4, 2, 1, 0, 2, 5, 0, 4, 0, 0, 1, 0, 3, 1, 3,
-	4, 1, 6, 0, 2, 4, 0, 4, 2, 5, 3, 1, 1, 5, 6, 2, 5, 2, 6, 3,
-	5, 5, 1, 2, 3, 1, 3, 3, 5, 3, 2, 0, 4, 0, 3, 2, 3, 1, 5, 6,
-	6, 3, 4, 2, 5, 6, 5, 2, 4, 2, 4, 4, 5, 4, 2, 5, 6, 3, 0, 1,
-	0, 4, 6, 4, 6, 0, 3, 0, 6, 2, 5, 2, 1, 6, 1, 1, 0, 6, 2, 6,
-	1, 1, 5, 6, 0, 2, 1, 0, 4, 1, 5, 2, 3, 1, 6, 1, 6, 0, 6, 2,
-	2, 0, 6, 4, 0, 3, 6, 3, 5, 0, 6, 5, 4, 4, 6, 0, 6, 3, 0, 4,
-	3, 2, 1, 0, 4, 5, 0, 1, 4, 5, 3, 2, 5, 1, 4, 1, 6, 1, 6, 0,
-	4, 2, 0, 5, 6, 1, 5, 4, 0, 4, 2, 5, 6, 5, 1, 4, 1, 3, 1, 5,
-	5, 1, 0, 3, 2, 1, 3, 4, 3, 5, 3, 2, 5, 1, 3, 4, 5, 0, 5, 4,
-	6, 5, 4, 5, 2, 3, 5, 5, 1, 0, 4, 2, 3, 4, 1, 5, 3, 1, 4, 0,
-	0, 5, 6, 5, 4, 5, 5, 1, 6, 1, 6, 5, 0, 6, 0, 3, 5, 0, 6, 1,
-	1, 1, 6, 1, 4, 1, 0, 2, 0, 4, 6, 0, 6, 2, 0, 2, 5, 6, 2, 6,
-	2, 4, 6, 1, 3, 4, 2, 0, 3, 5, 3, 4, 3, 0, 4, 2, 6, 3, 6, 2,
-	3, 1, 0, 5, 3, 1, 0, 2, 0, 5, 1, 2, 0, 6, 1, 0, 6, 2, 4, 3,
-	4, 1, 6, 4, 4, 2, 1, 1, 3, 2, 5, 4, 3, 2, 4, 5, 4, 0, 3, 5,
-	5, 0, 3, 0, 6, 4, 1, 2, 1, 4, 6, 3, 6, 0, 3, 1, 5, 3, 0, 0,
-	6, 3, 1, 2, 0, 6, 5, 2, 3, 6, 1, 2, 4, 0, 5, 2, 2, 1, 0, 5,
-	0, 4, 5, 4, 5, 1, 6, 5, 1, 3, 6, 0, 1, 6, 1, 2, 6, 3, 0, 3,
-	1, 5, 3, 1, 4, 3, 4, 0, 1, 3, 0, 5, 5, 4, 1, 3, 1, 4, 0, 6,
-	2, 4, 1, 2, 0, 0, 6, 1, 3, 2, 0, 0, 3, 6, 5, 1, 0, 4, 1, 6,
-	3, 3, 4, 2, 0, 3, 2, 0, 5, 1, 5, 6, 2, 0, 3, 5, 2, 1, 6, 5,
-	4, 1, 6, 5, 1, 2, 3, 5, 0, 2, 4, 5, 3, 1, 4, 5, 2, 2, 0, 1,
-	5, 6, 2, 1, 5, 6, 1, 4, 2, 1, 3, 0, 2, 4, 3, 6, 1, 4, 3, 4,
-	6, 3, 4, 6, 0, 0, 4, 3, 1, 3, 6, 6, 4, 1, 2, 3, 5, 4, 3, 0,
-	0, 1, 5, 0, 1, 3, 2, 2, 2, 4, 5, 3, 1, 2, 2, 6, 5, 0, 6, 4,
-	1, 6, 2, 3, 0, 4, 2, 3, 0, 4, 3, 1, 4, 5, 0, 6, 1, 5, 4, 6,
-	2, 3, 2, 0, 2, 4, 0, 0, 3, 5, 3, 1, 1, 6, 3, 4, 1, 1, 1, 3,
-	3, 0, 4, 3, 0, 4, 2, 4, 5, 4, 3, 2, 6, 0, 6, 5, 6, 6, 0, 4,
-	4, 3, 5, 3, 5, 3, 1, 4, 6, 3, 6, 2, 3, 3, 4, 0, 1, 2, 5, 6,
-	5, 3, 5, 1, 4, 0, 5, 4, 2, 6, 0, 4, 0, 6, 0, 6, 0, 2, 3, 6,
-	6, 0, 5, 6, 0, 2, 6, 5, 2, 4, 1, 6, 0, 2, 4, 2, 6, 5, 1, 3,
-	0, 6, 2, 6, 1, 3, 6, 0, 5, 4, 5, 1, 3, 1, 6, 2, 4, 5, 3, 3,
-	1, 2, 4, 0, 6, 1, 4, 3, 0, 6, 5, 6, 4, 2, 6, 5, 0, 3, 5, 4,
-	2, 1, 0, 1, 5, 0, 3, 3, 4, 3, 5, 3, 6, 2, 4, 4, 4, 1, 3, 4,
-	3, 1, 4, 2, 0, 5, 6, 3, 6, 2, 5, 1, 4, 3, 0, 2, 1, 5, 0, 5,
-	4, 0, 5, 3, 2, 3, 5, 6, 1, 5, 3, 3, 5, 4, 2, 0, 1, 4, 6, 1,
-	5, 2, 6, 2, 3, 1, 5, 2, 4, 2, 5, 3, 6, 5, 4, 5, 4, 1, 0, 1,
-	6, 5, 3, 2, 5, 4, 2, 6, 1, 2, 4, 0, 5, 4, 6, 2, 3, 1, 4, 1,
-	0, 2, 6, 6, 5, 2, 6, 5, 3, 5, 2, 1, 4, 0, 5, 6, 5, 6, 3, 6,
-	1, 3, 2, 4, 2, 6, 3, 3, 0, 2, 1, 3, 3, 2, 3, 4, 6, 2, 3, 5,
-	2, 0, 3, 6, 0, 5, 6, 6, 3, 6, 1, 0, 6, 3, 5, 0, 1, 3, 5, 0,
-	3, 6, 4, 0, 1, 4, 1, 6, 0, 5, 3, 5, 4, 0, 1, 5, 6, 2, 5, 6,
-	4, 5, 0, 3, 4, 6, 0, 2, 1, 0, 0, 2, 5, 6, 2, 4, 1, 4, 6, 4,
-	5, 0, 3, 0, 2, 0, 4, 5, 2, 0, 2, 1, 6, 1, 3, 2, 3, 1, 6, 3,
-	6, 1, 1, 2, 3, 1, 6, 6, 3, 1, 5, 1, 2, 6, 5, 1, 6, 3, 1, 1,
-	0, 5, 0, 5, 2, 4, 5, 6, 1, 2, 6, 2, 1, 0, 5, 2, 5, 6, 2, 0,
-	1, 4, 0, 5, 0, 6, 5, 3, 5, 3, 5, 3, 0, 1, 3, 6, 4, 2, 5, 4,
-	2, 5, 1, 4, 2, 4, 1, 5, 0, 5, 2, 6, 3, 4, 3, 2, 6, 2, 0, 6,
-	3, 4, 6, 3, 3, 3, 4, 5, 0, 1, 6, 1, 3, 0, 1, 6, 3, 0, 5, 3,
-	4, 6, 4, 1, 5, 3, 5, 0, 2, 3, 3, 0, 6, 3, 3, 0, 2, 4, 3, 4,
-	5, 3, 6, 1, 0, 2, 3, 0, 4, 3, 6, 5, 5, 4, 1, 4, 1, 0, 6, 5,
-	6, 0, 3, 0, 5, 1, 4, 0, 1, 3, 0, 5, 4, 2, 3, 0, 3, 1, 2, 0,
-	0, 3, 6, 2, 6, 4, 3, 2, 3, 2, 6, 4, 6, 3, 2, 0, 5, 3, 6, 5,
-	1, 4, 3, 4, 2, 6, 1, 1, 5, 0, 3, 0, 5, 6, 4, 2, 5, 1, 0, 4,
-	2, 4, 2, 0, 2, 0, 3, 1, 4, 5, 4, 5, 1, 4, 4, 3, 6, 1, 0, 6,
-	3, 3, 6, 1, 6, 2, 4, 0, 6, 2, 5, 0, 3, 1, 6, 4, 6, 5, 2, 5,
-	4, 5, 4, 6, 5, 4, 0, 3, 4, 5, 3, 5, 0, 5, 5, 4, 0, 2, 3, 2,
-	5, 3, 5, 2, 5, 3, 1, 6, 2, 0, 6, 1, 6, 0, 2, 4, 4, 6, 5, 3,
-	6, 2, 4, 1, 3, 5, 3, 6, 2, 0, 4, 3, 0, 2, 5, 4, 5, 2, 1, 0,
-	0, 0, 6, 0, 3, 1, 6, 2, 4, 1, 5, 1, 3, 4, 6, 2, 5, 6, 1, 3,
-	1, 2, 6, 1, 3, 5, 4, 1, 5, 6, 5, 1, 4, 1, 0, 1, 2, 6, 3, 0,
-	2, 5, 2, 6, 1, 4, 3, 2, 3, 1, 3, 6, 1, 5, 2, 5, 4, 1, 1, 5,
-	3, 5, 0, 2, 5, 0, 4, 2, 0, 5, 1, 6, 3, 4, 5, 3, 1, 6, 0, 6,
-	4, 0, 0, 4, 3, 1, 6, 5, 4, 1, 6, 2, 0, 1, 2, 1, 2, 0, 6, 6,
-	5, 4, 5, 0, 3, 5, 4, 1, 3, 4, 0, 2, 4, 6, 4, 6, 2, 5, 6, 2,
-	6, 0, 4, 3, 6, 3, 0, 6, 5, 5, 3, 5, 4, 2, 1, 5, 3, 4, 0, 6,
-	0, 2, 4, 5, 2, 4, 2, 1, 2, 1, 3, 1, 4, 6, 0, 4, 1, 4, 5, 0,
-	1, 4, 6, 6, 3, 4, 0, 3, 1, 6, 2, 5, 4, 1, 5, 2, 5, 3, 1, 0,
-	2, 6, 5, 4, 3, 4, 5, 1, 4, 0, 6, 4, 0, 4, 0, 4, 6, 0, 3, 4,
-	3, 5, 0, 2, 2, 6, 3, 5, 2, 6, 1, 5, 0, 6, 2, 3, 5, 4, 2, 5,
-	4, 6, 1, 2, 0, 3, 5, 2, 5, 1, 5, 3, 4, 4, 6, 2, 1, 3, 1, 5,
-	5, 0, 5, 1, 3, 5, 0, 1, 5, 5, 1, 6, 2, 6, 2, 4, 0, 5, 4, 6,
-	6, 1, 3, 0, 3, 0, 6, 2, 4, 3, 3, 1, 1, 2, 3, 5, 1, 4, 0, 1,
-	0, 3, 0, 4, 3, 4, 3, 5, 1, 3, 4, 5, 6, 1, 1, 0, 5, 3, 2, 6,
-	1, 4, 6, 5, 3, 2, 6, 4, 0, 4, 3, 5, 2, 4, 2, 6, 5, 1, 2, 1,
-	2, 2, 4, 0, 5, 1, 2, 3, 6, 2, 0, 6, 3, 6, 3, 3, 0, 4, 1, 0,
-	3, 5, 0, 6, 4, 2, 1, 3, 6, 3, 4, 1, 1, 5, 6, 5, 0, 4, 0, 4,
-	4, 6, 2, 3, 5, 6, 5, 3, 5, 1, 1, 4, 1, 3, 4, 3, 4, 5, 1, 2,
-	5, 4, 0, 2, 2, 3, 1, 3, 5, 4, 2, 4, 0, 1, 6, 1, 4, 4, 5, 5,
-	6, 1, 6, 2, 1, 4, 5, 2, 4, 0, 5, 1, 5, 4, 1, 2, 5, 2, 6, 1,
-	0, 6, 4, 2, 0, 4, 1, 0, 6, 4, 2, 1, 3, 3, 1, 2, 1, 2, 4, 1,
-	1, 4, 5, 3, 4, 2, 1, 4, 2, 0, 2, 6, 5, 2, 4, 6, 0, 1, 0, 5,
-	2, 6, 0, 3, 0, 2, 5, 3, 2, 3, 5, 5, 1, 0, 5, 1, 2, 5, 0, 5,
-	3, 1, 4, 6, 5, 6, 4, 1, 0, 4, 0, 6, 1, 5, 3, 5, 0, 1, 0, 1,
-	4, 6, 0, 5, 0, 1, 4, 0, 1, 5, 0, 5, 4, 5, 2, 4, 6, 4, 5, 1,
-	5, 5, 3, 0, 4, 0, 3, 0, 3, 6, 3, 0, 5, 6, 2, 6, 5, 1, 5, 2,
-	6, 5, 3, 4, 3, 0, 2, 5, 1, 4, 5, 4, 6, 2, 3, 4, 0, 6, 1, 2,
-	0, 1, 0, 6, 1, 0, 2, 3, 4, 1, 2, 0, 1, 5, 6, 2, 4, 5, 4, 3,
-	1, 4, 0, 1, 0, 3, 2, 0, 1, 3, 6, 4, 6, 0, 3, 6, 3, 2, 4, 0,
-	2, 0, 4, 2, 6, 1, 5, 0, 5, 3, 2, 6, 1, 5, 0, 4, 6, 0, 3, 5,
-	3, 0, 6, 2, 0, 4, 2, 1, 1, 1, 6, 1, 2, 5, 2, 3, 4, 3, 5, 2,
-	4, 2, 3, 5, 1, 0, 0, 5, 1, 6, 4, 5, 3, 0, 6, 4, 5, 4, 0, 2,
-	5, 5, 1, 2, 3, 5, 6, 4, 1, 1, 5, 4, 5, 0, 5, 1, 3, 4, 1, 3,
-	6, 5, 5, 6, 5, 2, 3, 2, 4, 2, 1, 5, 6, 1, 3, 3, 2, 5, 6, 2,
-	0, 0, 1, 6, 5, 5, 4, 4, 1, 5, 2, 4, 6, 6, 3, 6, 2, 0, 6, 0,
-	1, 4, 6, 3, 4, 1, 5, 6, 5, 1, 5, 1, 5, 1, 6, 2, 1, 4, 2, 1,
-	2, 6, 4, 0, 4, 2, 6, 0, 6, 5, 6, 0, 0, 3, 1, 6, 6, 4, 0, 1,
-	3, 2, 3, 4, 3, 2, 3, 6, 5, 0, 4, 2, 0, 5, 6, 3, 0, 5, 3, 5,
-	4, 6, 5, 1, 4, 6, 1, 6, 5, 4, 6, 0, 5, 6, 0, 4, 5, 4, 1, 0,
-	5, 2, 4, 1, 4, 0, 4, 5, 3, 4, 3, 0, 6, 2, 1, 0, 0, 0, 5, 2,
-	6, 5, 5, 5, 0, 6, 5, 0, 1, 0, 6, 5, 2, 0, 4, 2, 4, 0, 6, 3,
-	0, 5, 5, 3, 4, 6, 4, 2, 1, 0, 3, 1, 4, 1, 4, 3, 0, 2, 4, 1,
-	1, 6, 1, 3, 6, 2, 5, 0, 6, 4, 1, 6, 2, 0, 2, 3, 0, 6, 5, 2,
-	2, 6, 0, 3, 6, 6, 0, 1, 0, 3, 5, 3, 1, 3, 1, 6, 3, 0, 4, 5,
-	3, 5, 4, 2, 3, 5, 3, 6, 2, 6, 1, 3, 0, 6, 2, 3, 3, 6, 0, 4,
-	4, 6, 2, 1, 5, 4, 6, 5, 1, 3, 5, 3, 5, 4, 1, 5, 5, 6, 5, 2,
-	5, 2, 5, 1, 2, 3, 3, 4, 2, 4, 3, 4, 1, 0, 1, 0, 2, 5, 4, 5,
-	6, 1, 2, 0, 1, 6, 0, 4, 3, 1, 0, 3, 6, 5, 4, 5, 0, 2, 0, 6,
-	0, 6, 2, 1, 6, 0, 2, 0, 6, 4, 2, 1, 5, 2, 3, 5, 1, 4, 2, 5,
-	1, 3, 6, 2, 0, 4, 2, 6, 0, 0, 1, 4, 6, 5, 4, 0, 6, 1, 3, 0,
-	2, 1, 2, 3, 1, 0, 6, 1, 6, 2, 2, 3, 0, 5, 3, 6, 6, 2, 4, 1,
-	3, 2, 6, 2, 0, 2, 5, 4, 5, 1, 3, 4, 1, 3, 4, 2, 0, 4, 5, 0,
-	4, 0, 4, 2, 3, 4, 5, 0, 6, 2, 3, 4, 2, 6, 5, 1, 2, 6, 1, 4,
-	5, 0, 5, 4, 3, 5, 1, 0, 6, 5, 3, 2, 5, 1, 6, 0, 3, 3, 2, 4,
-	6, 3, 2, 6, 1, 3, 5, 0, 1, 2, 0, 4, 5, 4, 3, 2, 1, 2, 0, 4,
-	0, 6, 2, 0, 4, 6, 0, 4, 0, 3, 0, 6, 1, 3, 6, 5, 1, 3, 6, 1,
-	1, 4, 2, 4, 2, 5, 4, 1, 5, 1, 4, 5, 0, 3, 2, 0, 4, 3, 0, 2,
-	2, 0, 0, 1, 4, 5, 4, 6, 3, 2, 5, 1, 2, 6, 4, 6, 2, 3, 3, 6,
-	3, 4, 2, 0, 2, 1, 3, 4, 6, 3, 6, 0, 5, 1, 3, 4, 6, 4, 0, 6,
-	4, 2, 0, 3, 1, 0, 1, 6, 2, 4, 1, 3, 6, 0, 5, 3, 1, 6, 3, 2,
-	5, 4, 4, 6, 4, 1, 3, 5, 6, 0, 2, 6, 0, 2, 2, 6, 0, 5, 3, 4,
-	6, 4, 2, 4, 4, 2, 6, 6, 1, 0, 5, 1, 0, 2, 6, 1, 4, 6, 1, 1,
-	0, 6, 2, 3, 2, 5, 4, 2, 1, 2, 0, 1, 1, 6, 5, 6, 0, 6, 5, 1,
-	1, 4, 2, 6, 5, 1, 4, 0, 1, 2, 5, 3, 1, 0, 3, 3, 4, 6, 2, 5,
-	2, 4, 5, 0, 2, 5, 4, 3, 5, 3, 2, 4, 0, 5, 1, 0, 3, 4, 6, 3,
-	3, 1, 2, 4, 4, 5, 5, 3, 5, 1, 2, 0, 6, 0, 2, 1, 4, 3, 5, 6,
-	4, 3, 0, 2, 4, 0, 3, 0, 4, 2, 1, 5, 0, 6, 6, 3, 6, 3, 1, 6,
-	5, 6, 4, 5, 3, 1, 5, 3, 4, 0, 2, 6, 2, 4, 3, 0, 6, 4, 3, 4,
-	6, 2, 1, 3, 5, 4, 0, 1, 2, 1, 4, 3, 2, 5, 1, 4, 2, 1, 4, 1,
-	0, 2, 0, 6, 2, 0, 3, 4, 5, 1, 6, 1, 6, 5, 0, 2, 4, 6, 4, 1,
-	1, 6, 1, 2, 3, 5, 0, 4, 6, 2, 0, 1, 2, 1, 0, 5, 0, 6, 1, 0,
-	2, 2, 4, 2, 6, 2, 4, 0, 6, 0, 6, 0, 1, 3, 6, 6, 1, 6, 3, 4,
-	3, 5, 2, 1, 6, 6, 2, 5, 2, 1, 0, 6, 2, 3, 3, 2, 3, 2, 5, 2,
-	4, 1, 4, 6, 1, 2, 2, 2, 2, 3, 6, 0, 4, 2, 6, 2, 1, 4, 5, 1,
-	5, 3, 6, 1, 3, 0, 3, 4, 5, 6, 2, 3, 0, 3, 0, 6, 0, 6, 2, 5,
-	6, 5, 1, 6, 0, 6, 4, 3, 2, 3, 6, 2, 4, 0, 6, 4, 6, 0, 3, 1,
-	0, 2, 3, 0, 6, 2, 1, 4, 3, 3, 0, 6, 6, 5, 1, 0, 6, 2, 2, 3,
-	1, 5, 0, 4, 6, 0, 2, 4, 6, 0, 2, 6, 6, 1, 0, 1, 6, 4, 1, 0,
-	2, 3, 5, 1, 3, 0, 5, 0, 1, 2, 3, 6, 5, 1, 4, 0, 5, 1, 0, 4,
-	3, 1, 4, 6, 1, 5, 4, 1, 0, 2, 3, 6, 0, 5, 2, 4, 6, 2, 6, 4,
-	4, 1, 6, 3, 6, 2, 0, 6, 2, 0, 1, 0, 5, 2, 5, 6, 3, 0, 1, 1,
-	5, 2, 6, 3, 5, 1, 1, 5, 6, 5, 6, 3, 3, 1, 4, 1, 0, 4, 0, 1,
-	6, 4, 5, 4, 3, 5, 2, 1, 2, 5, 3, 2, 1, 4, 4, 2, 4, 3, 6, 1,
-	0, 1, 1, 5, 0, 5, 6, 0, 4, 3, 0, 3, 5, 1, 2, 5, 0, 4, 0, 3,
-	1, 1, 0, 5, 2, 5, 5, 1, 3, 4, 0, 1, 1, 1, 4, 5, 0, 5, 6, 1,
-	2, 0, 5, 1, 3, 4, 1, 2, 0, 4, 0, 6, 1, 5, 1, 5, 1, 4, 3, 5,
-	3, 2, 4, 3, 1, 6, 2, 0, 1, 6, 2, 4, 0, 2, 1, 1, 3, 6, 3, 4,
-	4, 1, 3, 2, 4, 1, 3, 0, 5, 0, 4, 5, 4, 6, 2, 5, 6, 5, 0, 4,
-	5, 6, 0, 1, 5, 1, 4, 6, 0, 6, 3, 5, 1, 3, 5, 1, 0, 6, 2, 6,
-	6, 2, 0, 3, 6, 1, 3, 4, 6, 3, 4, 4, 1, 0, 6, 2, 5, 3, 1, 2,
-	0, 5, 4, 2, 1, 2, 1, 2, 6, 4, 3, 5, 3, 1, 4, 0, 3, 4, 3, 2,
-	1, 5, 0, 6, 3, 2, 5, 0, 5, 3, 1, 0, 6, 0, 3, 0, 5, 0, 2, 0,
-	2, 3, 6, 3, 2, 5, 3, 4, 2, 5, 6, 2, 6, 1, 2, 6, 0, 4, 3, 1,
-	3, 1, 6, 4, 5, 1, 2, 1, 2, 4, 2, 0, 2, 6, 0, 5, 3, 6, 2, 5,
-	4, 6, 1, 3, 2, 5, 0, 3, 2, 3, 0, 5, 1, 5, 3, 2, 1, 6, 5, 1,
-	5, 1, 4, 6, 2, 0, 5, 6, 5, 2, 3, 1, 4, 3, 2, 1, 0, 4, 1, 6,
-	6, 5, 5, 6, 5, 3, 1, 0, 5, 2, 0, 4, 5, 3, 6, 1, 3, 0, 1, 2,
-	0, 6, 6, 3, 6, 2, 4, 6, 1, 4, 5, 2, 4, 2, 3, 5, 1, 4, 2, 0,
-	1, 4, 1, 3, 2, 2, 4, 5, 3, 0, 5, 4, 1, 2, 4, 5, 3, 6, 5, 1,
-	2, 4, 5, 1, 3, 0, 5, 0, 6, 5, 1, 4, 5, 0, 5, 1, 0, 5, 4, 1,
-	3, 2, 0, 3, 5, 5, 6, 4, 1, 1, 6, 2, 0, 3, 4, 3, 5, 2, 1, 1,
-	4, 0, 1, 5, 0, 4, 2, 3, 2, 5, 6, 3, 5, 2, 3, 1, 6, 4, 1, 6,
-	5, 0, 4, 5, 0, 5, 0, 5, 0, 0, 4, 5, 4, 2, 1, 6, 2, 3, 0, 1,
-	6, 2, 4, 5, 1, 5, 4, 5, 4, 6, 5, 0, 6, 3, 5, 0, 2, 4, 4, 0,
-	0, 1, 5, 0, 5, 0, 5, 2, 5, 1, 4, 3, 5, 4, 5, 0, 6, 0, 1, 3,
-	1, 2, 3, 0, 4, 2, 6, 3, 0, 1, 6, 0, 4, 6, 4, 2, 1, 2, 4, 3,
-	2, 4, 2, 6, 3, 4, 6, 1, 5, 5, 2, 6, 2, 4, 0, 6, 5, 6, 2, 3,
-	3, 4, 0, 3, 2, 1, 3, 1, 4, 2, 6, 0, 4, 2, 0, 1, 3, 6, 5, 6,
-	4, 2, 1, 1, 6, 4, 6, 0, 2, 2, 6, 0, 1, 6, 0, 2, 1, 4, 2, 2,
-	5, 2, 6, 5, 1, 0, 2, 1, 5, 1, 4, 2, 6, 4, 5, 2, 6, 0, 4, 1,
-	6, 1, 3, 1, 2, 1, 6, 1, 4, 0, 1, 5, 2, 6, 4, 5, 1, 5, 0, 5,
-	0, 3, 4, 3, 6, 3, 6, 1, 6, 5, 1, 2, 4, 6, 2, 0, 2, 1, 5, 1,
-	1, 5, 4, 5, 1, 4, 1, 6, 0, 2, 5, 6, 0, 3, 5, 6, 2, 5, 3, 5,
-	2, 4, 1, 2, 4, 0, 3, 1, 0, 4, 1, 4, 2, 6, 5, 2, 0, 4, 1, 0,
-	3, 2, 4, 2, 6, 1, 5, 6, 1, 4, 5, 4, 0, 3, 3, 1, 0, 1, 0, 4,
-	4, 1, 0, 5, 2, 3, 4, 1, 6, 1, 5, 3, 3, 0, 4, 6, 0, 6, 2, 5,
-	5, 0, 6, 1, 6, 2, 1, 2, 0, 1, 5, 5, 1, 6, 4, 5, 4, 5, 4, 1,
-	6, 4, 5, 4, 1, 2, 5, 6, 0, 2, 4, 5, 0, 6, 2, 1, 2, 3, 2, 1,
-	0, 2, 6, 4, 2, 3, 0, 2, 6, 4, 2, 0, 3, 3, 3, 2, 3, 3, 1, 6,
-	1, 0, 3, 5, 1, 6, 4, 3, 4, 0, 1, 0, 6, 5, 1, 5, 3, 0, 1, 2,
-	2, 3, 1, 5, 4, 6, 5, 1, 2, 0, 3, 1, 4, 1, 1, 5, 0, 3, 0, 6,
-	3, 4, 3, 3, 0, 5, 0, 4, 2, 1, 0, 1, 0, 5, 3, 6, 5, 2, 3, 5,
-	4, 5, 2, 4, 3, 5, 4, 5, 4, 1, 4, 5, 6, 5, 4, 2, 0, 6, 3, 0,
-	5, 1, 5, 2, 5, 2, 6, 0, 6, 1, 5, 2, 0, 2, 6, 0, 5, 6, 4, 0,
-	6, 3, 0, 2, 6, 3, 1, 0, 6, 5, 3, 2, 3, 1, 3, 1, 3, 4, 0, 2,
-	0, 5, 6, 3, 6, 2, 6, 2, 3, 0, 1, 6, 4, 2, 1, 4, 6, 5, 5, 1,
-	1, 3, 1, 0, 4, 6, 2, 3, 0, 2, 1, 2, 0, 6, 3, 5, 6, 2, 6, 4,
-	2, 4, 5, 3, 4, 6, 3, 6, 1, 5, 1, 2, 3, 1, 6, 0, 6, 4, 5, 6,
-	3, 2, 3, 5, 5, 5, 3, 2, 6, 4, 2, 3, 4, 6, 5, 4, 5, 1, 6, 3,
-	4, 1, 0, 1, 2, 0, 5, 2, 1, 6, 1, 5, 3, 4, 5, 4, 3, 4, 0, 6,
-	5, 6, 5, 3, 6, 0, 3, 2, 0, 6, 4, 0, 6, 0, 4, 0, 6, 4, 5, 0,
-	6, 5, 1, 5, 5, 1, 2, 4, 2, 4, 6, 5, 1, 4, 1, 3, 3, 5, 0, 6,
-	0, 4, 1, 6, 2, 5, 2, 6, 5, 6, 3, 0, 1, 2, 1, 4, 5, 4, 6, 5,
-	1, 5, 1, 3, 4, 2, 1, 5, 6, 0, 1, 3, 5, 4, 1, 0, 1, 3, 0, 4,
-	2, 3, 5, 2, 5, 6, 1, 3, 2, 3, 2, 0, 2, 4, 1, 4, 3, 6, 1, 3,
-	3, 5, 6, 5, 0, 5, 1, 5, 1, 4, 1, 3, 6, 4, 3, 0, 1, 4, 1, 6,
-	4, 4, 5, 5, 1, 2, 0, 5, 2, 1, 5, 0, 1, 5, 2, 4, 3, 0, 2, 4,
-	5, 3, 1, 3, 2, 4, 3, 5, 0, 3, 6, 2, 3, 0, 6, 2, 0, 4, 2, 5,
-	6, 5, 0, 3, 1, 5, 6, 5, 4, 6, 2, 0, 6, 3, 3, 2, 6, 5, 1, 6,
-	0, 6, 1, 0, 6, 3, 5, 6, 0, 6, 4, 1, 2, 0, 2, 6, 2, 5, 6, 2,
-	1, 4, 2, 3, 5, 1, 5, 3, 2, 4, 5, 2, 3, 5, 1, 3, 5, 6, 4, 3,
-	2, 5, 0, 3, 1, 6, 4, 2, 6, 5, 0, 4, 2, 1, 3, 4, 6, 4, 6, 2,
-	3, 2, 6, 0, 4, 3, 1, 0, 4, 1, 5, 2, 2, 4, 3, 2, 6, 1, 4, 5,
-	4, 1, 3, 5, 6, 3, 1, 5, 4, 6, 4, 1, 6, 5, 3, 0, 6, 0, 6, 2,
-	5, 0, 6, 3, 4, 1, 4, 0, 2, 6, 3, 0, 0, 1, 0, 5, 1, 2, 6, 5,
-	6, 4, 0, 0, 1, 2, 3, 5, 1, 4, 5, 4, 5, 2, 6, 0, 6, 4, 6, 3,
-	0, 5, 1, 2, 1, 2, 6, 6, 1, 2, 0, 3, 0, 2, 0, 5, 1, 6, 5, 3,
-	1, 0, 5, 3, 2, 4, 2, 0, 4, 6, 1, 3, 5, 4, 0, 6, 5, 4, 6, 2,
-	2, 4, 6, 4, 3, 4, 2, 3, 6, 1, 5, 3, 1, 5, 3, 5, 2, 3, 1, 4,
-	3, 2, 2, 6, 3, 2, 5, 4, 3, 1, 4, 0, 6, 1, 1, 0, 4, 5, 3, 4,
-	4, 4, 5, 1, 5, 6, 3, 4, 0, 2, 6, 2, 1, 4, 5, 6, 2, 6, 2, 5,
-	5, 3, 0, 2, 4, 6, 5, 1, 6, 5, 1, 6, 3, 6, 2, 5, 6, 1, 3, 0,
-	6, 1, 3, 6, 0, 6, 1, 4, 2, 0, 1, 2, 6, 0, 5, 1, 6, 6, 0, 3,
-	0, 2, 4, 2, 4, 2, 3, 1, 3, 0, 3, 6, 5, 4, 6, 2, 4, 6, 2, 0,
-	1, 2, 1, 3, 5, 6, 3, 6, 0, 6, 4, 2, 0, 1, 4, 1, 2, 5, 1, 3,
-	2, 0, 6, 4, 2, 4, 2, 4, 3, 2, 4, 5, 0, 4, 0, 2, 3, 6, 2, 1,
-	3, 6, 6, 2, 3, 5, 0, 2, 0, 4, 3, 4, 5, 6, 3, 5, 2, 0, 3, 0,
-	4, 5, 1, 5, 0, 2, 5, 4, 1, 2, 2, 6, 6, 6, 2, 6, 4, 6, 3, 0,
-	5, 4, 0, 1, 5, 3, 1, 0, 6, 2, 0, 3, 3, 1, 3, 6, 5, 6, 4, 6,
-	6, 0, 2, 3, 4, 6, 0, 5, 1, 2, 5, 0, 6, 5, 6, 4, 5, 4, 1, 2,
-	0, 5, 1, 5, 0, 2, 6, 5, 1, 5, 3, 2, 0, 3, 0, 0, 5, 0, 1, 2,
-	1, 6, 4, 3, 2, 0, 6, 5, 2, 1, 6, 2, 1, 4, 3, 4, 1, 0, 2, 4,
-	2, 4, 3, 2, 4, 4, 4, 4, 2, 1, 6, 3, 6, 1, 2, 6, 4, 6, 0, 5,
-	3, 0, 3, 2, 5, 2, 2, 6, 4, 0, 1, 5, 2, 2, 5, 5, 0, 6, 2, 0,
-	4, 6, 4, 2, 3, 6, 4, 1, 5, 6, 2, 1, 6, 2, 1, 4, 5, 2, 4, 5,
-	5, 2, 4, 6, 2, 4, 1, 5, 3, 5, 2, 5, 6, 2, 4, 0, 4, 3, 2, 0,
-	6, 1, 3, 6, 5, 6, 1, 6, 1, 1, 3, 6, 0, 0, 4, 1, 5, 6, 5, 6,
-	0, 6, 2, 1, 0, 6, 1, 2, 3, 0, 4, 5, 3, 2, 1, 0, 6, 4, 3, 4,
-	1, 0, 2, 5, 2, 4, 5, 2, 5, 4, 0, 3, 0, 6, 2, 5, 2, 4, 3, 4,
-	2, 4, 3, 2, 4, 3, 2, 4, 4, 2, 5, 4, 5, 2, 4, 2, 4, 3, 6, 2,
-	3, 2, 3, 3, 3, 3, 4, 0, 5, 6, 5, 1, 1, 2, 3, 4, 4, 0, 4, 6,
-	4, 1, 4, 6, 2, 3, 3, 2, 2, 1, 0, 6, 0, 4, 2, 2, 5, 2, 0, 4,
-	5, 0, 3, 1, 0, 1, 0, 6, 5, 4, 6, 1, 3, 6, 2, 1, 0, 4, 5, 2,
-	6, 5, 3, 4, 5, 2, 1, 4, 5, 3, 2, 4, 2, 6, 2, 4, 0, 2, 3, 4,
-	0, 4, 2, 6, 4, 0, 2, 0, 2, 0, 1, 6, 1, 4, 0, 2, 5, 1, 3, 4,
-	1, 5, 1, 6, 4, 6, 1, 4, 1, 5, 4, 3, 1, 4, 6, 4, 0, 2, 6, 1,
-	2, 4, 2, 1, 5, 4, 2, 3, 6, 1, 4, 0, 4, 2, 1, 6, 2, 1, 4, 3,
-	3, 6, 3, 6, 0, 3, 4, 1, 0, 1, 2, 3, 2, 0, 3, 5, 4, 3, 4, 3,
-	4, 3, 1, 3, 5, 4, 5, 0, 5, 2, 3, 5, 0, 6, 3, 0, 1, 6, 0, 2,
-	5, 4, 1, 2, 1, 6, 5, 6, 2, 6, 1, 3, 1, 6, 2, 6, 0, 5, 0, 3,
-	6, 1, 0, 5, 4, 4, 3, 6, 1, 2, 4, 2, 1, 5, 4, 0, 4, 0, 4, 1,
-	0, 6, 6, 2, 5, 3, 4, 6, 5, 3, 3, 5, 6, 1, 6, 2, 4, 2, 6, 4,
-	1, 3, 0, 1, 3, 2, 5, 4, 4, 5, 3, 6, 1, 0, 3, 6, 3, 0, 5, 0,
-	2, 4, 6, 2, 5, 1, 5, 0, 3, 1, 0, 6, 1, 5, 3, 6, 0, 5, 6, 3,
-	3, 3, 6, 4, 2, 4, 2, 5, 0, 4, 1, 5, 4, 0, 5, 4, 1, 5, 6, 6,
-	4, 5, 3, 5, 4, 6, 5, 6, 2, 3, 6, 2, 4, 2, 5, 0, 5, 2, 6, 0,
-	5, 1, 3, 6, 0, 5, 4, 2, 2, 5, 0, 3, 2, 4, 6, 0, 1, 2, 1, 6,
-	6, 0, 6, 3, 4, 2, 5, 3, 0, 6, 0, 4, 6, 2, 3, 1, 1, 5, 2, 3,
-	0, 5, 3, 4, 6, 2, 4, 6, 5, 4, 2, 6, 1, 3, 6, 0, 5, 6, 3, 5,
-	1, 3, 2, 6, 1, 2, 3, 1, 4, 1, 1, 6, 2, 1, 1, 6, 1, 6, 2, 6,
-	2, 6, 0, 6, 2, 3, 5, 0, 0, 1, 4, 6, 4, 5, 1, 1, 0, 2, 3, 1,
-	3, 1, 1, 4, 5, 1, 3, 6, 1, 2, 0, 4, 1, 1, 1, 4, 1, 4, 2, 0,
-	4, 0, 6, 1, 6, 3, 5, 3, 0, 6, 4, 3, 6, 4, 1, 0, 6, 1, 4, 6,
-	5, 2, 3, 5, 3, 4, 2, 5, 6, 1, 1, 5, 6, 0, 6, 0, 1, 1, 3, 2,
-	6, 1, 0, 1, 1, 3, 4, 2, 0, 6, 3, 2, 2, 5, 1, 3, 6, 4, 6, 4,
-	0, 1, 0, 5, 0, 0, 2, 5, 4, 0, 4, 5, 4, 6, 4, 3, 2, 0, 6, 3,
-	1, 3, 5, 5, 0, 5, 6, 0, 6, 4, 6, 5, 0, 6, 5, 4, 1, 6, 0, 3,
-	2, 6, 6, 0, 3, 0, 1, 6, 3, 4, 1, 6, 4, 3, 4, 2, 1, 5, 6, 4,
-	3, 2, 1, 6, 4, 6, 0, 3, 2, 2, 1, 3, 4, 1, 4, 1, 6, 2, 5, 2,
-	4, 4, 3, 6, 1, 5, 2, 5, 3, 4, 2, 4, 1, 0, 3, 6, 2, 4, 0, 5,
-	5, 0, 4, 6, 3, 1, 2, 0, 1, 2, 0, 1, 4, 5, 4, 5, 1, 0, 6, 1,
-	6, 2, 4, 3, 6, 4, 1, 4, 6, 1, 2, 4, 4, 3, 5, 2, 5, 3, 6, 2,
-	0, 4, 2, 4, 2, 0, 6, 5, 6, 1, 5, 2, 3, 2, 5, 0, 6, 1, 6, 1,
-	1, 4, 5, 6, 0, 5, 4, 1, 2, 4, 4, 6, 1, 1, 0, 2, 3, 0, 3, 6,
-	2, 0, 0, 5, 0, 6, 3, 4, 5, 2, 3, 2, 3, 2, 6, 0, 5, 2, 5, 3,
-	3, 5, 2, 6, 2, 1, 4, 6, 1, 5, 1, 0, 6, 4, 6, 4, 2, 1, 5, 0,
-	4, 0, 3, 4, 1, 6, 5, 4, 5, 2, 5, 2, 4, 2, 1, 1, 0, 2, 6, 3,
-	5, 4, 1, 0, 4, 3, 5, 0, 6, 5, 3, 6, 4, 1, 4, 0, 3, 2, 1, 2,
-	6, 3, 2, 1, 4, 2, 2, 1, 0, 3, 3, 1, 2, 4, 0, 5, 2, 5, 6, 5,
-	0, 6, 3, 4, 0, 3, 1, 2, 5, 2, 0, 4, 0, 6, 2, 0, 0, 2, 5, 0,
-	1, 2, 6, 3, 5, 0, 2, 3, 0, 1, 2, 3, 4, 5, 4, 5, 1, 2, 6, 2,
-	2, 3, 4, 5, 6, 4, 5, 3, 5, 0, 3, 2, 0, 1, 3, 2, 6, 4, 6, 1,
-	3, 1, 0, 2, 5, 4, 1, 2, 3, 2, 3, 3, 3, 1, 4, 6, 6, 1, 6, 2,
-	4, 1, 6, 3, 6, 3, 2, 4, 1, 4, 5, 3, 1, 6, 0, 3, 3, 4, 3, 2,
-	5, 2, 1, 0, 4, 6, 4, 2, 4, 6, 2, 3, 4, 6, 2, 4, 1, 3, 0, 1,
-	6, 6, 0, 4, 5, 3, 6, 5, 6, 5, 0, 6, 1, 4, 5, 5, 3, 0, 5, 3,
-	0, 6, 1, 0, 2, 4, 6, 2, 6, 1, 0, 2, 3, 5, 0, 2, 1, 5, 1, 2,
-	1, 5, 2, 5, 2, 6, 3, 5, 6, 0, 6, 3, 2, 5, 2, 5, 2, 6, 1, 1,
-	2, 5, 1, 6, 4, 0, 2, 1, 4, 6, 3, 1, 5, 6, 4, 1, 4, 1, 2, 5,
-	3, 1, 4, 3, 6, 4, 3, 6, 3, 4, 5, 2, 5, 4, 2, 6, 4, 0, 2, 6,
-	4, 0, 4, 3, 6, 5, 1, 4, 2, 4, 0, 4, 5, 5, 1, 4, 6, 2, 3, 4,
-	5, 1, 2, 4, 1, 5, 2, 1, 2, 3, 0, 3, 6, 4, 2, 4, 6, 2, 4, 5,
-	6, 1, 5, 1, 3, 1, 3, 1, 5, 2, 6, 3, 0, 1, 6, 0, 0, 6, 5, 1,
-	0, 6, 0, 1, 2, 0, 6, 1, 2, 1, 6, 0, 1, 4, 5, 6, 3, 1, 2, 5,
-	1, 6, 0, 2, 6, 0, 4, 3, 2, 5, 3, 1, 6, 4, 1, 2, 6, 0, 3, 1,
-	2, 0, 1, 5, 4, 5, 0, 2, 5, 1, 0, 2, 3, 4, 3, 0, 2, 6, 0, 3,
-	3, 3, 6, 5, 2, 0, 1, 0, 4, 6, 3, 0, 3, 1, 3, 2, 1, 6, 1, 6,
-	4, 0, 2, 3, 1, 4, 1, 0, 3, 1, 5, 4, 6, 4, 0, 4, 2, 4, 2, 5,
-	5, 4, 2, 6, 4, 1, 5, 4, 4, 0, 2, 4, 3, 4, 5, 4, 2, 4, 4, 0,
-	6, 4, 1, 4, 3, 0, 5, 0, 3, 4, 2, 3, 0, 6, 1, 2, 5, 4, 4, 5,
-	0, 1, 3, 1, 0, 6, 3, 5, 0, 5, 1, 1, 1, 1, 2, 0, 0, 1, 4, 5,
-	1, 6, 6, 1, 3, 1, 1, 0, 5, 4, 0, 6, 4, 1, 3, 2, 0, 5, 2, 3,
-	2, 6, 2, 1, 6, 0, 3, 0, 5, 2, 5, 3, 1, 2, 6, 5, 4, 5, 0, 3,
-	3, 6, 0, 6, 2, 1, 3, 2, 1, 4, 6, 5, 2, 2, 0, 5, 2, 1, 4, 2,
-	4, 2, 0, 4, 3, 3, 6, 3, 1, 4, 1, 0, 4, 1, 6, 0, 6, 5, 6, 0,
-	5, 3, 1, 0, 6, 2, 3, 0, 2, 5, 4, 2, 5, 1, 6, 1, 0, 1, 3, 1,
-	6, 0, 5, 0, 3, 0, 2, 5, 3, 3, 6, 0, 6, 5, 6, 3, 5, 1, 0, 6,
-	0, 2, 5, 1, 4, 2, 6, 1, 5, 1, 2, 1, 2, 4, 2, 3, 6, 1, 5, 1,
-	1, 5, 0, 6, 6, 4, 1, 0, 2, 6, 0, 5, 3, 1, 4, 2, 3, 3, 0, 5,
-	2, 3, 4, 2, 6, 3, 2, 0, 5, 6, 1, 5, 3, 1, 5, 1, 3, 2, 4, 3,
-	3, 5, 4, 5, 1, 1, 5, 2, 3, 0, 2, 4, 1, 4, 1, 0, 4, 0, 4, 0,
-	4, 2, 1, 1, 4, 6, 4, 3, 1, 6, 4, 4, 1, 2, 3, 1, 6, 5, 1, 5,
-	5, 6, 2, 6, 5, 6, 2, 5, 1, 2, 4, 2, 3, 5, 3, 5, 6, 1, 3, 6,
-	6, 5, 6, 1, 3, 2, 5, 0, 2, 0, 2, 3, 1, 5, 6, 5, 3, 0, 6, 3,
-	0, 4, 5, 2, 5, 3, 2, 0, 5, 2, 3, 0, 6, 5, 3, 0, 5, 6, 5, 2,
-	1, 4, 0, 6, 1, 3, 4, 0, 5, 6, 1, 3, 1, 0, 1, 5, 1, 4, 6, 2,
-	2, 4, 3, 5, 6, 2, 0, 6, 1, 2, 0, 1, 3, 3, 4, 3, 5, 4, 3, 5,
-	3, 0, 6, 4, 4, 0, 6, 1, 6, 1, 0, 2, 0, 3, 6, 4, 0, 6, 4, 5,
-	4, 6, 0, 2, 3, 6, 5, 4, 0, 4, 6, 3, 0, 3, 0, 4, 0, 4, 1, 5,
-	5, 1, 6, 2, 3, 4, 0, 6, 2, 1, 5, 4, 5, 6, 0, 4, 3, 0, 2, 1,
-	6, 3, 4, 3, 4, 5, 0, 3, 1, 2, 5, 2, 1, 0, 6, 3, 5, 2, 5, 2,
-	0, 1, 4, 5, 6, 3, 2, 4, 1, 4, 3, 1, 5, 3, 1, 5, 3, 5, 1, 0,
-	1, 2, 5, 0, 4, 6, 6, 4, 6, 5, 3, 5, 0, 0, 3, 5, 1, 3, 4, 4,
-	2, 1, 0, 5, 1, 0, 1, 5, 3, 4, 1, 2, 0, 5, 2, 0, 1, 1, 6, 2,
-	3, 2, 6, 3, 0, 6, 1, 6, 2, 3, 6, 4, 3, 5, 2, 6, 2, 5, 2, 3,
-	4, 0, 2, 0, 5, 6, 0, 6, 3, 6, 2, 1, 4, 2, 5, 4, 1, 2, 5, 2,
-	5, 0, 1, 2, 4, 6, 3, 3, 4, 5, 0, 1, 4, 5, 0, 1, 3, 6, 0, 1,
-	6, 3, 0, 3, 6, 4, 5, 3, 6, 0, 4, 2, 1, 4, 1, 2, 1, 0, 4, 3,
-	0, 2, 3, 0, 3, 4, 5, 3, 4, 0, 3, 5, 6, 4, 2, 1, 4, 0, 5, 0,
-	1, 6, 3, 6, 2, 1, 4, 1, 3, 3, 4, 5, 4, 6, 1, 5, 1, 0, 5, 6,
-	2, 1, 6, 3, 4, 2, 3, 5, 4, 5, 6, 2, 6, 0, 1, 2, 0, 5, 6, 3,
-	3, 4, 5, 4, 1, 2, 4, 3, 2, 6, 0, 4, 0, 2, 5, 1, 6, 4, 2, 1,
-	4, 1, 2, 1, 6, 1, 4, 3, 5, 1, 6, 5, 0, 2, 0, 5, 3, 3, 4, 1,
-	5, 0, 0, 5, 6, 1, 0, 4, 3, 5, 2, 1, 4, 3, 1, 3, 5, 2, 0, 5,
-	6, 0, 2, 3, 5, 1, 0, 3, 1, 4, 5, 4, 5, 2, 5, 1, 6, 2, 2, 6,
-	0, 2, 3, 0, 3, 6, 1, 2, 1, 2, 1, 3, 5, 0, 3, 2, 3, 6, 4, 4,
-	1, 4, 5, 2, 3, 4, 3, 1, 3, 4, 0, 2, 3, 2, 0, 6, 4, 3, 3, 2,
-	2, 1, 4, 2, 0, 3, 3, 5, 3, 0, 2, 1, 3, 5, 1, 4, 0, 2, 6, 2,
-	3, 6, 4, 6, 5, 1, 3, 6, 4, 1, 6, 1, 2, 6, 2, 2, 3, 0, 6, 2,
-	4, 6, 3, 4, 6, 5, 1, 3, 2, 1, 6, 2, 1, 2, 3, 2, 6, 6, 0, 2,
-	5, 6, 3, 2, 4, 3, 6, 0, 3, 6, 5, 1, 4, 2, 0, 3, 6, 2, 0, 3,
-	6, 5, 4, 5, 6, 6, 1, 4, 1, 3, 0, 6, 4, 1, 0, 4, 6, 2, 4, 6,
-	0, 5, 6, 2, 6, 3, 6, 2, 5, 6, 2, 6, 5, 4, 2, 3, 4, 6, 1, 4,
-	1, 3, 2, 0, 2, 4, 3, 0, 2, 1, 5, 6, 4, 0, 4, 5, 2, 0, 1, 4,
-	2, 0, 3, 5, 6, 3, 1, 3, 2, 5, 5, 6, 5, 3, 0, 6, 0, 1, 2, 0,
-	3, 6, 4, 0, 6, 0, 6, 3, 5, 3, 1, 6, 0, 2, 5, 2, 4, 0, 1, 6,
-	4, 2, 4, 3, 6, 3, 0, 5, 3, 3, 1, 3, 5, 6, 4, 5, 3, 2, 6, 4,
-	5, 2, 3, 4, 0, 5, 3, 6, 1, 0, 2, 4, 0, 4, 6, 1, 5, 4, 0, 2,
-	6, 2, 0, 3, 1, 0, 3, 1, 0, 1, 4, 1, 0, 2, 1, 0, 1, 3, 6, 0,
-	0, 1, 0, 6, 2, 3, 3, 5, 6, 4, 5, 2, 5, 4, 0, 2, 5, 1, 0, 6,
-	1, 0, 2, 0, 1, 3, 3, 2, 1, 2, 5, 4, 1, 0, 6, 5, 6, 1, 2, 0,
-	2, 6, 4, 6, 5, 3, 4, 5, 0, 6, 1, 5, 3, 0, 4, 0, 6, 1, 5, 3,
-	3, 3, 1, 0, 1, 0, 5, 0, 3, 2, 1, 4, 0, 3, 0, 2, 4, 3, 3, 2,
-	4, 2, 6, 2, 6, 6, 1, 2, 2, 3, 5, 6, 1, 5, 1, 3, 2, 6, 4, 3,
-	5, 3, 2, 0, 6, 2, 1, 6, 1, 0, 4, 6, 5, 3, 4, 1, 6, 5, 6, 0,
-	6, 4, 5, 4, 2, 3, 0, 5, 6, 4, 6, 3, 1, 2, 0, 2, 5, 3, 6, 4,
-	0, 4, 2, 3, 1, 6, 0, 1, 3, 2, 4, 3, 6, 4, 3, 1, 4, 0, 5, 3,
-	1, 0, 3, 0, 5, 0, 2, 5, 0, 5, 2, 6, 0, 4, 1, 4, 3, 5, 3, 4,
-	2, 0, 1, 6, 3, 2, 3, 5, 2, 0, 2, 5, 3, 3, 2, 6, 1, 5, 3, 0,
-	3, 4, 1, 3, 4, 5, 6, 2, 5, 4, 0, 3, 2, 2, 6, 5, 0, 2, 1, 4,
-	4, 2, 5, 1, 3, 2, 3, 4, 5, 3, 6, 0, 1, 1, 4, 2, 1, 4, 3, 4,
-	5, 1, 4, 1, 0, 2, 6, 0, 6, 3, 5, 4, 2, 0, 1, 2, 3, 2, 4, 0,
-	6, 5, 2, 2, 0, 6, 3, 0, 6, 5, 4, 6, 4, 6, 0, 2, 1, 3, 0, 2,
-	0, 4, 5, 0, 5, 0, 6, 3, 2, 5, 3, 4, 1, 1, 3, 0, 2, 2, 5, 4,
-	1, 0, 6, 0, 5, 5, 6, 5, 3, 1, 4, 3, 1, 2, 1, 3, 2, 4, 5, 3,
-	2, 5, 4, 3, 6, 2, 5, 1, 4, 3, 0, 2, 1, 4, 3, 6, 1, 0, 3, 1,
-	3, 1, 1, 2, 6, 2, 6, 5, 2, 4, 5, 4, 6, 3, 6, 3, 3, 6, 0, 6,
-	4, 6, 6, 4, 0, 4, 1, 5, 3, 0, 3, 5, 0, 6, 3, 6, 5, 2, 0, 2,
-	5, 6, 2, 4, 2, 5, 1, 6, 1, 5, 4, 6, 4, 6, 0, 6, 3, 0, 4, 2,
-	6, 0, 5, 6, 1, 2, 3, 6, 1, 3, 4, 6, 3, 5, 2, 3, 2, 3, 1, 0,
-	0, 0, 4, 0, 2, 3, 2, 1, 5, 3, 4, 2, 0, 6, 2, 5, 1, 5, 6, 2,
-	1, 2, 1, 3, 2, 3, 2, 6, 1, 2, 5, 2, 6, 1, 5, 2, 6, 3, 0, 6,
-	2, 3, 0, 3, 1, 6, 1, 0, 4, 5, 1, 0, 4, 3, 6, 3, 2, 6, 2, 5,
-	3, 2, 0, 5, 0, 5, 6, 4, 2, 5, 2, 3, 3, 0, 4, 6, 1, 4, 1, 6,
-	4, 6, 5, 3, 6, 0, 1, 5, 6, 0, 1, 4, 6, 1, 4, 0, 4, 5, 3, 5,
-	5, 3, 6, 5, 2, 4, 3, 5, 2, 0, 3, 1, 2, 6, 5, 4, 3, 2, 0, 4,
-	6, 0, 5, 0, 4, 1, 0, 5, 3, 0, 5, 6, 4, 2, 2, 6, 5, 4, 5, 2,
-	0, 4, 6, 2, 1, 5, 4, 2, 4, 5, 3, 0, 2, 3, 0, 4, 0, 4, 2, 3,
-	1, 0, 3, 2, 0, 6, 0, 1, 5, 0, 5, 0, 2, 5, 1, 4, 6, 5, 1, 1,
-	2, 6, 2, 0, 0, 5, 3, 2, 6, 0, 6, 1, 5, 0, 2, 0, 4, 6, 3, 1,
-	3, 0, 4, 0, 4, 5, 4, 0, 0, 6, 1, 4, 5, 0, 1, 1, 2, 4, 1, 0,
-	4, 1, 3, 6, 0, 6, 5, 2, 1, 6, 5, 6, 3, 4, 3, 2, 0, 3, 5, 1,
-	5, 4, 2, 6, 0, 3, 1, 2, 0, 4, 3, 4, 2, 1, 0, 6, 2, 0, 1, 0,
-	6, 0, 5, 3, 6, 0, 4, 2, 5, 4, 6, 3, 2, 0, 2, 0, 4, 1, 6, 5,
-	0, 5, 3, 1, 0, 5, 2, 1, 0, 6, 0, 6, 4, 6, 5, 2, 0, 2, 0, 5,
-	1, 3, 4, 1, 0, 5, 6, 3, 6, 2, 3, 0, 1, 5, 4, 3, 3, 1, 6, 1,
-	2, 1, 6, 4, 6, 2, 6, 3, 2, 1, 0, 1, 6, 6, 3, 4, 2, 4, 3, 4,
-	3, 5, 3, 0, 5, 3, 4, 5, 1, 3, 2, 2, 5, 0, 4, 0, 5, 1, 2, 5,
-	4, 1, 4, 0, 5, 0, 1, 2, 3, 5, 3, 4, 6, 6, 1, 0, 6, 1, 0, 6,
-	5, 1, 0, 4, 4, 0, 1, 3, 0, 5, 3, 2, 5, 3, 6, 3, 4, 3, 3, 5,
-	6, 0, 0, 2, 6, 4, 1, 4, 5, 6, 2, 0, 5, 6, 1, 0, 6, 2, 0, 5,
-	0, 5, 0, 2, 5, 0, 4, 3, 4, 4, 1, 6, 2, 5, 6, 1, 4, 0, 4, 1,
-	1, 6, 0, 0, 3, 1, 0, 6, 1, 3, 0, 3, 1, 0, 4, 2, 0, 5, 2, 0,
-	2, 5, 0, 4, 2, 0, 2, 6, 3, 1, 3, 4, 0, 6, 1, 6, 5, 3, 5, 5,
-	3, 6, 2, 4, 6, 3, 5, 5, 4, 6, 3, 3, 2, 1, 0, 6, 1, 4, 1, 5,
-	4, 5, 3, 5, 2, 6, 3, 0, 6, 0, 1, 5, 3, 0, 3, 1, 0, 4, 2, 6,
-	5, 4, 6, 1, 1, 6, 4, 1, 5, 2, 4, 1, 0, 4, 2, 1, 1, 5, 6, 3,
-	6, 0, 4, 1, 0, 6, 4, 1, 5, 0, 4, 2, 5, 2, 1, 2, 1, 4, 0, 6,
-	0, 1, 4, 6, 6, 5, 5, 6, 3, 5, 2, 3, 0, 2, 4, 3, 5, 4, 3, 3,
-	1, 3, 1, 6, 1, 2, 6, 3, 2, 4, 0, 6, 6, 3, 4, 6, 2, 0, 3, 4,
-	2, 0, 5, 6, 3, 2, 5, 4, 2, 1, 3, 6, 5, 1, 3, 6, 2, 4, 2, 3,
-	3, 3, 2, 2, 1, 3, 6, 6, 3, 4, 2, 0, 2, 0, 2, 0, 6, 1, 5, 2,
-	4, 2, 6, 4, 0, 5, 1, 2, 4, 3, 5, 3, 2, 0, 2, 6, 0, 5, 6, 2,
-	5, 1, 5, 1, 2, 0, 4, 3, 1, 6, 2, 3, 0, 1, 2, 6, 2, 4, 6, 3,
-	6, 1, 1, 2, 5, 4, 1, 4, 6, 5, 2, 4, 6, 2, 1, 2, 3, 0, 1, 2,
-	0, 5, 0, 5, 5, 2, 0, 1, 0, 3, 6, 5, 1, 3, 0, 5, 1, 0, 1, 4,
-	1, 6, 1, 5, 4, 3, 5, 6, 4, 1, 0, 3, 4, 4, 3, 6, 0, 3, 0, 1,
-	2, 6, 1, 5, 1, 3, 0, 2, 5, 2, 3, 5, 3, 5, 2, 6, 2, 6, 4, 6,
-	3, 3, 6, 3, 5, 3, 5, 1, 0, 3, 2, 3, 6, 0, 0, 6, 4, 2, 1, 3,
-	4, 1, 6, 2, 3, 6, 3, 4, 6, 4, 1, 6, 5, 2, 0, 4, 3, 0, 0, 1,
-	5, 2, 5, 2, 5, 4, 1, 5, 2, 2, 4, 3, 6, 3, 1, 4, 4, 0, 4, 0,
-	6, 5, 2, 0, 6, 5, 1, 0, 6, 4, 6, 3, 0, 1, 6, 2, 5, 3, 4, 5,
-	0, 3, 6, 1, 5, 1, 2, 3, 0, 6, 4, 2, 6, 2, 0, 4, 1, 5, 0, 6,
-	1, 6, 0, 6, 0, 5, 1, 1, 6, 2, 0, 4, 0, 6, 0, 1, 6, 0, 3, 2,
-	2, 1, 4, 1, 1, 3, 0, 2, 3, 2, 6, 2, 4, 2, 6, 2, 0, 5, 4, 0,
-	3, 5, 4, 0, 3, 6, 5, 2, 4, 1, 2, 6, 2, 4, 0, 6, 0, 5, 2, 4,
-	4, 0, 6, 3, 6, 3, 6, 4, 6, 2, 1, 0, 2, 4, 1, 0, 1, 2, 3, 5,
-	5, 2, 1, 3, 6, 2, 5, 0, 6, 0, 6, 1, 1, 5, 1, 5, 0, 5, 4, 2,
-	6, 3, 4, 3, 5, 1, 0, 3, 2, 0, 1, 3, 5, 2, 3, 6, 0, 1, 1, 0,
-	0, 0, 3, 1, 5, 2, 6, 2, 5, 6, 3, 2, 3, 2, 3, 0, 1, 0, 1, 2,
-	1, 3, 0, 2, 1, 3, 2, 4, 3, 4, 0, 5, 2, 1, 2, 6, 0, 5, 1, 4,
-	2, 5, 3, 1, 4, 3, 4, 6, 0, 2, 4, 2, 1, 0, 2, 6, 3, 5, 2, 3,
-	3, 3, 6, 0, 1, 5, 6, 0, 0, 4, 1, 1, 3, 2, 3, 0, 2, 0, 2, 2,
-	4, 2, 2, 2, 6, 1, 0, 6, 3, 0, 4, 2, 4, 6, 3, 5, 1, 5, 1, 6,
-	5, 4, 5, 3, 0, 5, 4, 5, 4, 1, 4, 1, 3, 3, 1, 6, 4, 6, 2, 6,
-	6, 0, 6, 2, 3, 6, 1, 2, 3, 3, 2, 3, 3, 1, 3, 3, 2, 3, 2, 0,
-	0, 5, 6, 0, 4, 5, 6, 4, 6, 2, 6, 2, 0, 6, 3, 0, 1, 1, 2, 6,
-	1, 6, 3, 5, 6, 1, 5, 1, 3, 6, 4, 6, 5, 4, 0, 3, 2, 5, 3, 5,
-	2, 6, 0, 2, 4, 4, 4, 6, 0, 3, 4, 3, 6, 3, 2, 6, 0, 1, 6, 0,
-	3, 3, 4, 0, 4, 4, 6, 3, 3, 6, 1, 1, 0, 6, 1, 1, 3, 5, 1, 2,
-	4, 2, 1, 0, 6, 2, 6, 3, 4, 0, 5, 1, 5, 0, 4, 6, 3, 4, 5, 3,
-	5, 1, 0, 6, 1, 6, 3, 4, 5, 0, 3, 0, 4, 5, 3, 4, 5, 2, 4, 5,
-	6, 3, 6, 3, 4, 2, 3, 4, 6, 4, 1, 1, 3, 0, 6, 5, 3, 2, 1, 6,
-	0, 6, 1, 4, 6, 4, 1, 6, 2, 4, 2, 6, 2, 5, 6, 4, 1, 3, 0, 4,
-	1, 3, 4, 3, 5, 1, 5, 6, 0, 3, 6, 2, 3, 6, 2, 5, 2, 4, 6, 5,
-	2, 3, 3, 2, 5, 0, 5, 3, 4, 6, 5, 3, 0, 6, 3, 2, 6, 3, 5, 6,
-	3, 5, 6, 1, 2, 0, 4, 4, 3, 0, 3, 1, 3, 0, 2, 2, 0, 2, 6, 2,
-	4, 2, 3, 3, 0, 2, 5, 1, 3, 0, 2, 1, 0, 1, 2, 4, 2, 6, 5, 4,
-	5, 5, 4, 5, 1, 6, 3, 5, 3, 4, 2, 1, 6, 2, 6, 2, 3, 6, 3, 2,
-	6, 6, 5, 1, 5, 4, 2, 0, 6, 2, 1, 2, 5, 1, 3, 4, 3, 2, 6, 4,
-	0, 2, 4, 6, 3, 1, 0, 3, 1, 4, 5, 4, 6, 2, 4, 1, 0, 2, 0, 1,
-	1, 5, 2, 0, 4, 3, 4, 6, 4, 0, 1, 4, 0, 6, 2, 4, 5, 4, 5, 2,
-	2, 2, 1, 4, 6, 1, 0, 1, 2, 1, 4, 1, 5, 0, 4, 2, 3, 2, 0, 3,
-	3, 0, 4, 4, 0, 1, 0, 6, 0, 2, 4, 2, 6, 4, 3, 5, 3, 0, 3, 3,
-	4, 1, 6, 1, 0, 2, 6, 3, 1, 4, 3, 5, 3, 5, 4, 1, 1, 3, 5, 0,
-	5, 5, 0, 6, 2, 4, 5, 5, 1, 2, 3, 1, 4, 2, 4, 0, 5, 3, 2, 3,
-	6, 5, 4, 5, 1, 2, 4, 1, 5, 0, 4, 3, 0, 2, 0, 1, 5, 3, 5, 0,
-	0, 4, 5, 2, 5, 2, 6, 0, 3, 1, 0, 5, 3, 4, 6, 4, 2, 4, 2, 2,
-	1, 4, 0, 6, 3, 1, 2, 1, 3, 0, 1, 2, 5, 4, 3, 5, 1, 0, 6, 4,
-	2, 0, 6, 4, 3, 6, 1, 3, 6, 4, 2, 6, 0, 4, 0, 4, 6, 5, 2, 6,
-	3, 1, 3, 3, 2, 5, 0, 6, 2, 4, 3, 4, 2, 5, 4, 2, 6, 4, 0, 1,
-	4, 2, 3, 6, 4, 2, 6, 4, 3, 1, 1, 6, 1, 5, 3, 4, 3, 1, 4, 0,
-	5, 1, 1, 6, 1, 6, 2, 0, 4, 2, 5, 6, 2, 6, 2, 4, 6, 2, 0, 5,
-	6, 2, 4, 3, 2, 6, 4, 1, 3, 5, 6, 0, 2, 3, 6, 5, 4, 3, 6, 2,
-	0, 6, 3, 2, 6, 0, 4, 2, 1, 3, 2, 1, 1, 4, 3, 0, 5, 0, 1, 1,
-	1, 6, 5, 0, 4, 2, 6, 0, 3, 3, 0, 5, 6, 3, 6, 5, 2, 3, 4, 6,
-	2, 0, 4, 3, 5, 3, 5, 3, 3, 2, 6, 3, 5, 3, 0, 5, 6, 0, 1, 5,
-	3, 1, 2, 6, 5, 3, 6, 3, 2, 3, 5, 4, 6, 4, 2, 3, 5, 0, 2, 3,
-	4, 6, 2, 1, 4, 3, 3, 5, 0, 4, 3, 0, 6, 5, 6, 3, 0, 4, 6, 1,
-	5, 6, 3, 5, 3, 1, 0, 2, 0, 4, 1, 6, 0, 1, 6, 5, 4, 1, 0, 5,
-	6, 3, 3, 5, 2, 3, 5, 1, 0, 6, 4, 6, 0, 3, 5, 1, 4, 3, 2, 6,
-	0, 2, 5, 4, 5, 2, 1, 0, 3, 5, 3, 1, 2, 3, 0, 1, 2, 0, 1, 4,
-	1, 4, 2, 5, 6, 4, 1, 4, 2, 4, 3, 5, 3, 6, 3, 2, 5, 4, 1, 6,
-	2, 1, 0, 6, 2, 3, 5, 2, 4, 6, 3, 4, 1, 6, 1, 2, 6, 2, 1, 4,
-	3, 2, 3, 5, 4, 6, 2, 5, 0, 5, 6, 2, 1, 0, 3, 4, 6, 3, 4, 4,
-	4, 3, 4, 2, 4, 5, 2, 0, 1, 4, 3, 4, 0, 5, 3, 2, 3, 5, 1, 2,
-	5, 2, 1, 5, 2, 5, 0, 1, 4, 2, 0, 4, 1, 5, 2, 6, 4, 2, 0, 3,
-	6, 0, 2, 3, 3, 6, 1, 5, 2, 6, 2, 0, 5, 0, 1, 3, 3, 3, 2, 6,
-	0, 5, 6, 1, 3, 0, 4, 3, 4, 0, 3, 3, 4, 6, 1, 6, 4, 1, 6, 1,
-	1, 3, 1, 6, 5, 0, 6, 0, 4, 0, 1, 2, 6, 5, 6, 5, 4, 2, 5, 6,
-	2, 3, 4, 3, 1, 0, 5, 1, 3, 4, 3, 0, 5, 3, 5, 1, 6, 4, 6, 3,
-	3, 1, 4, 5, 1, 6, 5, 6, 4, 2, 3, 6, 2, 5, 3, 4, 3, 5, 3, 0,
-	4, 1, 6, 3, 2, 0, 3, 2, 6, 2, 6, 4, 6, 1, 3, 5, 6, 3, 0, 4,
-	5, 2, 2, 0, 3, 4, 3, 4, 3, 2, 5, 6, 2, 5, 4, 1, 3, 2, 2, 1,
-	6, 4, 5, 0, 1, 3, 6, 4, 5, 4, 1, 6, 3, 6, 1, 0, 5, 3, 0, 0,
-	0, 1, 2, 4, 3, 6, 2, 1, 0, 3, 4, 6, 5, 4, 1, 3, 6, 2, 3, 6,
-	1, 5, 2, 1, 6, 1, 6, 5, 4, 0, 2, 3, 4, 3, 2, 3, 0, 6, 1, 1,
-	2, 6, 4, 4, 5, 4, 0, 1, 6, 0, 6, 5, 5, 6, 2, 4, 2, 4, 2, 0,
-	3, 3, 6, 4, 5, 5, 5, 6, 2, 1, 3, 1, 2, 4, 6, 2, 0, 4, 3, 6,
-	4, 1, 6, 5, 2, 5, 4, 2, 3, 6, 5, 3, 6, 3, 4, 0, 5, 2, 1, 2,
-	5, 6, 3, 1, 5, 2, 1, 0, 4, 0, 3, 4, 3, 4, 2, 1, 2, 0, 2, 5,
-	6, 3, 1, 0, 1, 3, 0, 6, 1, 3, 2, 0, 5, 4, 6, 5, 2, 3, 4, 3,
-	0, 1, 2, 5, 4, 5, 6, 1, 6, 1, 0, 2, 6, 4, 6, 2, 4, 6, 2, 5,
-	1, 6, 5, 4, 0, 4, 6, 4, 1, 2, 4, 2, 6, 3, 4, 6, 0, 3, 4, 3,
-	2, 1, 3, 0, 6, 2, 0, 3, 5, 4, 1, 2, 0, 5, 0, 6, 3, 1, 2, 1,
-	3, 6, 1, 4, 6, 5, 4, 3, 3, 0, 4, 0, 6, 4, 2, 3, 3, 0, 5, 3,
-	4, 2, 6, 1, 3, 0, 2, 6, 0, 6, 2, 6, 5, 6, 3, 1, 1, 4, 2, 1,
-	5, 4, 1, 5, 1, 4, 4, 3, 2, 0, 5, 0, 3, 3, 1, 4, 0, 1, 3, 4,
-	6, 2, 0, 2, 0, 6, 5, 2, 1, 2, 1, 0, 6, 3, 1, 6, 5, 0, 5, 6,
-	0, 5, 1, 3, 6, 3, 2, 3, 5, 3, 4, 5, 0, 3, 0, 1, 4, 3, 2, 4,
-	1, 4, 6, 5, 1, 3, 6, 1, 2, 5, 6, 0, 3, 0, 5, 1, 5, 2, 5, 4,
-	2, 5, 4, 2, 0, 6, 5, 1, 0, 6, 1, 5, 0, 5, 4, 2, 0, 5, 1, 4,
-	3, 6, 5, 2, 5, 4, 6, 3, 4, 5, 3, 1, 0, 3, 4, 6, 2, 0, 2, 5,
-	4, 5, 6, 4, 1, 2, 0, 4, 2, 0, 6, 5, 1, 1, 5, 6, 0, 2, 6, 4,
-	5, 0, 6, 4, 0, 2, 5, 1, 3, 5, 4, 0, 1, 1, 4, 0, 5, 6, 2, 4,
-	6, 1, 0, 0, 4, 2, 1, 6, 1, 0, 2, 5, 3, 4, 3, 3, 6, 6, 5, 6,
-	0, 3, 1, 5, 2, 1, 2, 1, 5, 4, 5, 4, 1, 2, 5, 3, 1, 1, 5, 3,
-	1, 1, 0, 3, 5, 0, 5, 1, 4, 1, 3, 5, 2, 4, 5, 0, 5, 2, 4, 2,
-	2, 5, 3, 1, 3, 1, 1, 4, 3, 2, 3, 2, 0, 3, 4, 5, 4, 4, 0, 4,
-	3, 6, 3, 0, 5, 4, 1, 2, 5, 2, 0, 3, 0, 3, 4, 5, 3, 5, 5, 1,
-	4, 5, 4, 6, 1, 5, 0, 4, 5, 2, 4, 3, 2, 6, 0, 5, 4, 2, 3, 6,
-	5, 2, 6, 3, 5, 3, 5, 1, 3, 5, 3, 2, 4, 1, 2, 3, 4, 5, 5, 3,
-	6, 1, 3, 1, 5, 6, 5, 3, 2, 1, 2, 6, 4, 3, 1, 1, 0, 2, 0, 2,
-	0, 2, 4, 6, 3, 1, 6, 5, 3, 6, 4, 2, 1, 4, 3, 0, 3, 5, 6, 0,
-	1, 4, 6, 1, 2, 3, 0, 3, 3, 4, 5, 6, 0, 6, 0, 5, 1, 3, 5, 6,
-	2, 0, 4, 1, 6, 1, 2, 1, 3, 2, 6, 5, 4, 4, 6, 3, 0, 5, 6, 1,
-	3, 1, 5, 2, 3, 6, 1, 0, 3, 5, 1, 0, 4, 4, 5, 2, 6, 4, 6, 0,
-	4, 0, 4, 4, 0, 2, 0, 1, 2, 6, 2, 3, 6, 3, 6, 5, 1, 0, 6, 4,
-	5, 4, 2, 5, 1, 5, 6, 4, 5, 0, 2, 5, 6, 4, 3, 6, 3, 6, 5, 3,
-	6, 2, 5, 3, 4, 5, 2, 1, 5, 3, 5, 2, 0, 3, 1, 4, 5, 4, 2, 6,
-	0, 1, 6, 5, 1, 5, 2, 3, 4, 4, 3, 2, 5, 4, 1, 6, 3, 4, 2, 5,
-	1, 5, 2, 4, 6, 0, 4, 3, 4, 5, 3, 5, 1, 4, 5, 1, 6, 0, 6, 0,
-	2, 1, 3, 5, 0, 2, 5, 1, 2, 4, 6, 0, 3, 4, 1, 5, 1, 0, 3, 4,
-	3, 4, 2, 5, 2, 0, 1, 5, 1, 3, 4, 1, 4, 1, 6, 2, 4, 3, 0, 4,
-	4, 2, 0, 2, 0, 2, 3, 6, 0, 6, 1, 4, 5, 4, 5, 6, 1, 3, 5, 1,
-	5, 1, 4, 1, 2, 1, 1, 6, 4, 0, 3, 5, 3, 1, 4, 0, 4, 3, 2, 5,
-	6, 1, 6, 4, 2, 3, 1, 5, 0, 0, 1, 2, 0, 5, 4, 1, 1, 3, 6, 2,
-	0, 4, 3, 2, 4, 5, 6, 5, 0, 2, 6, 3, 4, 2, 0, 4, 2, 0, 2, 0,
-	1, 3, 2, 4, 1, 4, 0, 1, 5, 4, 2, 6, 1, 2, 3, 2, 3, 2, 4, 5,
-	2, 1, 6, 1, 5, 6, 2, 4, 2, 5, 0, 4, 1, 2, 3, 0, 2, 6, 1, 4,
-	3, 6, 4, 2, 4, 5, 0, 5, 2, 5, 1, 6, 5, 0, 6, 1, 3, 0, 3, 0,
-	4, 2, 3, 1, 5, 2, 1, 5, 3, 1, 0, 2, 3, 5, 4, 3, 1, 5, 3, 1,
-	5, 1, 0, 3, 1, 4, 6, 0, 3, 4, 3, 6, 4, 5, 4, 6, 5, 4, 4, 5,
-	6, 0, 5, 1, 4, 1, 3, 2, 6, 0, 3, 1, 4, 2, 4, 5, 4, 0, 4, 4,
-	0, 5, 6, 2, 1, 3, 4, 5, 2, 4, 4, 3, 5, 3, 6, 2, 6, 5, 3, 5,
-	1, 3, 2, 3, 6, 2, 1, 5, 6, 3, 5, 1, 0, 4, 5, 0, 6, 2, 4, 1,
-	2, 6, 2, 0, 6, 3, 1, 3, 1, 5, 3, 6, 5, 3, 1, 3, 4, 6, 1, 0,
-	3, 4, 1, 5, 2, 3, 6, 0, 1, 4, 3, 6, 0, 3, 6, 4, 2, 5, 4, 5,
-	4, 1, 5, 6, 2, 1, 0, 5, 6, 1, 0, 2, 5, 1, 0, 1, 3, 0, 3, 1,
-	5, 1, 4, 1, 6, 3, 0, 5, 6, 1, 0, 1, 6, 2, 4, 3, 2, 1, 1, 5,
-	6, 3, 0, 5, 3, 0, 1, 3, 2, 6, 2, 1, 6, 2, 1, 6, 3, 6, 1, 6,
-	0, 6, 4, 4, 3, 1, 4, 2, 6, 0, 6, 2, 0, 6, 4, 3, 6, 4, 5, 1,
-	1, 5, 2, 4, 1, 2, 6, 5, 5, 5, 1, 1, 2, 3, 6, 2, 5, 2, 4, 2,
-	2, 6, 3, 5, 1, 3, 5, 2, 3, 5, 4, 3, 0, 1, 2, 2, 3, 2, 0, 1,
-	3, 1, 5, 2, 1, 5, 6, 1, 6, 2, 1, 3, 4, 6, 2, 0, 3, 6, 2, 0,
-	4, 1, 4, 2, 3, 1, 6, 5, 6, 2, 6, 3, 0, 2, 4, 6, 5, 1, 3, 6,
-	5, 2, 1, 3, 2, 0, 0, 4, 0, 3, 5, 4, 1, 5, 6, 2, 1, 4, 2, 5,
-	6, 1, 3, 0, 1, 0, 2, 3, 2, 4, 3, 6, 4, 3, 6, 0, 1, 4, 0, 4,
-	0, 5, 6, 1, 3, 6, 3, 6, 2, 4, 3, 5, 1, 2, 3, 2, 1, 1, 6, 4,
-	1, 0, 3, 6, 5, 3, 4, 3, 0, 6, 0, 6, 3, 4, 5, 3, 6, 5, 1, 1,
-	2, 6, 2, 6, 3, 1, 0, 6, 4, 5, 3, 0, 3, 0, 4, 6, 6, 1, 0, 2,
-	3, 1, 0, 6, 0, 5, 2, 6, 5, 4, 2, 1, 0, 6, 2, 4, 5, 6, 5, 4,
-	4, 3, 3, 5, 1, 2, 3, 6, 5, 2, 1, 0, 5, 2, 4, 1, 2, 0, 3, 1,
-	5, 1, 4, 6, 0, 4, 6, 3, 4, 1, 6, 1, 6, 5, 6, 1, 3, 3, 6, 0,
-	6, 1, 3, 1, 2, 0, 4, 5, 6, 2, 4, 5, 0, 2, 5, 0, 6, 0, 3, 2,
-	0, 3, 2, 5, 3, 2, 1, 4, 0, 3, 3, 2, 5, 1, 0, 6, 0, 0, 6, 5,
-	1, 2, 3, 2, 6, 4, 2, 4, 2, 1, 5, 6, 3, 0, 6, 0, 5, 3, 1, 2,
-	2, 3, 2, 2, 3, 1, 3, 1, 3, 0, 0, 6, 4, 6, 3, 4, 1, 2, 6, 1,
-	3, 6, 3, 5, 6, 4, 0, 4, 5, 1, 4, 3, 4, 2, 4, 5, 6, 0, 3, 3,
-	4, 0, 3, 4, 3, 6, 2, 6, 2, 5, 1, 6, 3, 1, 5, 4, 6, 3, 2, 6,
-	5, 6, 3, 1, 3, 4, 5, 0, 3, 4, 6, 0, 2, 3, 2, 4, 3, 1, 2, 3,
-	6, 3, 6, 1, 0, 4, 3, 5, 0, 1, 2, 4, 5, 1, 2, 0, 2, 3, 1, 4,
-	0, 6, 2, 3, 3, 0, 1, 4, 1, 5, 1, 5, 4, 1, 6, 5, 1, 5, 1, 4,
-	1, 6, 4, 5, 2, 0, 6, 4, 5, 0, 1, 0, 1, 0, 6, 6, 2, 6, 5, 1,
-	2, 4, 5, 5, 1, 6, 3, 2, 6, 1, 4, 2, 4, 0, 1, 3, 4, 2, 0, 1,
-	3, 2, 0, 4, 2, 1, 6, 3, 6, 0, 3, 0, 2, 0, 6, 2, 5, 3, 0, 6,
-	4, 3, 0, 2, 1, 3, 2, 5, 1, 5, 1, 5, 6, 1, 2, 4, 0, 5, 0, 6,
-	5, 4, 0, 1, 0, 3, 6, 2, 3, 1, 2, 4, 0, 2, 3, 0, 3, 5, 0, 4,
-	6, 3, 1, 3, 5, 1, 5, 0, 1, 0, 3, 1, 1, 2, 5, 4, 6, 2, 6, 5,
-	0, 1, 6, 0, 3, 2, 1, 4, 2, 3, 4, 6, 1, 0, 2, 0, 5, 1, 2, 5,
-	1, 4, 2, 4, 2, 5, 6, 1, 2, 0, 6, 5, 1, 5, 1, 6, 0, 2, 1, 3,
-	2, 4, 0, 1, 0, 4, 5, 0, 6, 6, 6, 5, 3, 4, 3, 2, 3, 6, 2, 2,
-	3, 4, 1, 3, 0, 2, 1, 1, 2, 5, 4, 0, 6, 4, 5, 1, 2, 2, 0, 1,
-	4, 2, 1, 3, 6, 1, 2, 3, 4, 3, 1, 5, 6, 2, 0, 3, 6, 3, 4, 6,
-	5, 3, 5, 6, 1, 0, 4, 6, 2, 0, 2, 3, 4, 2, 3, 1, 4, 0, 4, 6,
-	6, 1, 3, 3, 5, 6, 5, 0, 5, 1, 1, 1, 4, 6, 0, 1, 6, 3, 6, 5,
-	0, 1, 3, 0, 6, 2, 3, 0, 2, 0, 3, 2, 1, 6, 5, 4, 3, 6, 2, 0,
-	1, 0, 2, 6, 0, 4, 6, 3, 5, 2, 0, 2, 5, 4, 0, 2, 6, 4, 4, 4,
-	2, 1, 4, 5, 3, 6, 3, 0, 5, 6, 1, 1, 0, 1, 2, 2, 3, 3, 2, 4,
-	3, 5, 6, 1, 6, 4, 4, 1, 0, 3, 5, 0, 3, 0, 6, 2, 4, 1, 5, 6,
-	4, 1, 3, 0, 4, 3, 3, 2, 4, 6, 3, 4, 3, 4, 2, 3, 0, 3, 0, 4,
-	5, 3, 1, 4, 2, 2, 6, 0, 1, 2, 1, 4, 6, 0, 2, 4, 5, 0, 6, 5,
-	6, 0, 4, 0, 6, 1, 2, 1, 4, 3, 4, 2, 4, 2, 3, 1, 3, 5, 1, 4,
-	0, 6, 2, 0, 4, 1, 0, 1, 4, 2, 2, 0, 4, 1, 5, 4, 6, 0, 0, 2,
-	1, 4, 5, 3, 1, 6, 0, 4, 0, 3, 4, 5, 1, 0, 2, 0, 1, 6, 1, 4,
-	2, 5, 2, 5, 4, 2, 6, 4, 6, 5, 2, 3, 5, 4, 5, 1, 0, 1, 5, 1,
-	3, 2, 3, 2, 0, 3, 4, 2, 0, 4, 3, 1, 3, 5, 1, 6, 3, 5, 5, 4,
-	4, 6, 5, 6, 2, 4, 1, 5, 6, 6, 4, 5, 1, 2, 1, 6, 5, 4, 6, 6,
-	5, 1, 0, 2, 6, 1, 3, 5, 1, 1, 5, 4, 6, 5, 4, 6, 2, 5, 1, 5,
-	6, 0, 1, 4, 6, 4, 6, 1, 4, 1, 0, 2, 2, 1, 2, 1, 5, 0, 0, 5,
-	0, 0, 4, 5, 6, 0, 6, 2, 0, 3, 2, 6, 6, 0, 1, 2, 4, 1, 0, 6,
-	1, 6, 0, 3, 4, 3, 0, 4, 4, 6, 3, 2, 0, 2, 6, 2, 3, 0, 4, 6,
-	2, 0, 2, 6, 1, 2, 5, 6, 5, 6, 0, 6, 2, 1, 6, 1, 4, 2, 5, 0,
-	3, 2, 6, 4, 0, 2, 5, 4, 0, 4, 5, 4, 1, 3, 2, 4, 5, 3, 0, 1,
-	4, 1, 1, 3, 0, 1, 3, 6, 0, 3, 0, 1, 6, 5, 3, 0, 4, 5, 1, 3,
-	5, 3, 1, 4, 2, 3, 1, 5, 0, 0, 3, 4, 2, 4, 3, 6, 5, 0, 5, 3,
-	6, 5, 1, 3, 0, 3, 1, 0, 3, 5, 6, 1, 4, 6, 1, 5, 2, 0, 5, 0,
-	0, 2, 4, 6, 2, 1, 3, 4, 3, 5, 5, 3, 4, 2, 5, 0, 6, 2, 4, 6,
-	1, 2, 4, 2, 0, 2, 3, 0, 3, 4, 0, 5, 4, 5, 6, 1, 6, 4, 5, 4,
-	2, 4, 2, 1, 3, 6, 4, 2, 1, 5, 1, 2, 5, 2, 0, 1, 3, 4, 0, 2,
-	3, 5, 6, 3, 4, 1, 4, 5, 4, 3, 4, 2, 5, 0, 4, 1, 2, 4, 0, 2,
-	4, 4, 6, 1, 2, 0, 4, 4, 0, 5, 6, 2, 1, 4, 5, 2, 3, 3, 4, 0,
-	5, 1, 4, 6, 1, 1, 0, 5, 3, 1, 2, 5, 3, 2, 6, 1, 6, 0, 1, 0,
-	6, 2, 4, 1, 5, 3, 1, 4, 5, 2, 3, 1, 4, 6, 0, 6, 1, 3, 1, 5,
-	0, 4, 2, 6, 5, 3, 1, 5, 5, 2, 0, 1, 4, 0, 4, 6, 3, 5, 5, 6,
-	1, 4, 1, 3, 1, 5, 2, 4, 4, 2, 6, 2, 6, 1, 5, 6, 5, 4, 1, 5,
-	2, 0, 2, 5, 3, 0, 6, 4, 1, 4, 0, 3, 4, 1, 4, 2, 0, 5, 1, 3,
-	3, 5, 1, 1, 6, 3, 6, 3, 0, 4, 6, 0, 1, 6, 2, 0, 6, 3, 6, 3,
-	4, 1, 0, 2, 1, 6, 1, 3, 1, 5, 6, 2, 1, 3, 0, 6, 2, 0, 5, 6,
-	5, 1, 5, 3, 5, 3, 1, 4, 0, 4, 2, 5, 1, 6, 4, 3, 4, 5, 2, 5,
-	6, 1, 2, 4, 0, 6, 4, 0, 2, 5, 4, 5, 2, 4, 5, 4, 5, 1, 5, 4,
-	0, 1, 0, 5, 1, 6, 4, 2, 2, 0, 3, 5, 3, 5, 3, 2, 5, 0, 3, 5,
-	1, 1, 2, 6, 0, 4, 0, 3, 6, 4, 1, 0, 3, 1, 3, 2, 5, 1, 2, 3,
-	2, 3, 4, 6, 0, 2, 5, 5, 4, 1, 4, 4, 4, 0, 1, 1, 3, 0, 3, 6,
-	3, 1, 0, 5, 1, 5, 6, 1, 3, 6, 2, 1, 5, 2, 1, 3, 0, 4, 5, 6,
-	4, 6, 5, 0, 2, 1, 4, 2, 4, 6, 2, 2, 0, 4, 2, 0, 2, 4, 5, 2,
-	5, 0, 6, 0, 5, 1, 5, 4, 5, 0, 4, 3, 2, 3, 6, 2, 3, 1, 3, 3,
-	6, 6, 3, 5, 6, 1, 6, 5, 4, 1, 5, 0, 5, 6, 1, 3, 6, 3, 5, 0,
-	0, 6, 4, 5, 0, 2, 1, 2, 1, 0, 2, 6, 2, 6, 5, 4, 6, 1, 3, 4,
-	1, 0, 2, 4, 2, 1, 3, 0, 0, 1, 6, 0, 0, 3, 6, 1, 4, 3, 4, 5,
-	2, 2, 5, 6, 1, 2, 5, 1, 1, 6, 1, 5, 2, 5, 4, 5, 2, 4, 3, 4,
-	3, 6, 0, 1, 2, 0, 6, 3, 1, 3, 6, 1, 2, 1, 1, 5, 2, 4, 3, 6,
-	4, 3, 4, 1, 5, 6, 4, 0, 2, 3, 5, 1, 3, 2, 3, 3, 0, 1, 5, 1,
-	5, 1, 2, 0, 4, 5, 0, 2, 3, 4, 3, 2, 6, 1, 5, 3, 1, 2, 5, 0,
-	6, 3, 6, 0, 1, 0, 6, 4, 4, 6, 5, 6, 2, 5, 1, 1, 5, 2, 6, 0,
-	0, 1, 5, 3, 0, 3, 1, 2, 6, 2, 0, 6, 2, 5, 4, 3, 2, 3, 1, 2,
-	1, 4, 3, 5, 4, 0, 1, 2, 0, 3, 4, 0, 4, 6, 0, 6, 2, 1, 3, 1,
-	2, 4, 3, 5, 4, 6, 0, 6, 2, 6, 4, 3, 4, 2, 4, 3, 6, 0, 3, 6,
-	3, 5, 1, 6, 5, 2, 1, 2, 3, 0, 6, 2, 4, 1, 0, 3, 0, 4, 3, 3,
-	4, 0, 6, 3, 4, 0, 0, 3, 5, 2, 4, 3, 1, 3, 5, 4, 6, 0, 1, 5,
-	5, 2, 0, 5, 6, 5, 6, 2, 0, 5, 4, 1, 6, 3, 5, 1, 4, 0, 4, 1,
-	6, 3, 2, 1, 5, 1, 5, 3, 5, 4, 6, 5, 6, 3, 3, 4, 0, 6, 3, 4,
-	0, 3, 0, 4, 3, 2, 3, 2, 1, 2, 0, 1, 3, 2, 4, 3, 6, 3, 3, 5,
-	1, 3, 5, 2, 1, 2, 6, 1, 5, 0, 2, 5, 1, 0, 6, 5, 1, 3, 6, 4,
-	2, 0, 1, 3, 5, 3, 6, 1, 0, 0, 4, 0, 2, 3, 4, 6, 3, 4, 2, 5,
-	3, 2, 5, 0, 4, 0, 1, 3, 0, 1, 5, 4, 0, 2, 6, 4, 2, 1, 0, 1,
-	4, 2, 0, 0, 6, 0, 6, 4, 6, 6, 3, 4, 3, 0, 5, 2, 6, 1, 4, 2,
-	5, 4, 3, 2, 3, 1, 1, 6, 3, 5, 4, 1, 2, 4, 2, 1, 5, 6, 5, 4,
-	6, 2, 4, 6, 2, 6, 5, 0, 1, 0, 6, 5, 2, 4, 5, 0, 3, 1, 6, 3,
-	0, 6, 2, 3, 0, 4, 5, 5, 6, 4, 3, 2, 0, 1, 6, 2, 4, 1, 3, 5,
-	1, 0, 4, 6, 3, 6, 4, 5, 0, 4, 5, 1, 2, 5, 3, 4, 2, 0, 5, 3,
-	2, 1, 6, 3, 5, 6, 3, 2, 3, 6, 5, 0, 6, 2, 6, 2, 5, 2, 6, 1,
-	3, 5, 0, 4, 1, 3, 2, 6, 2, 3, 5, 6, 1, 6, 4, 4, 5, 0, 1, 3,
-	4, 0, 2, 0, 3, 0, 3, 3, 5, 2, 0, 1, 2, 6, 0, 4, 6, 1, 2, 0,
-	5, 0, 1, 4, 6, 3, 2, 6, 0, 5, 3, 5, 6, 1, 3, 3, 1, 3, 3, 2,
-	6, 2, 4, 5, 4, 0, 5, 3, 0, 3, 5, 1, 5, 0, 1, 3, 6, 0, 5, 6,
-	0, 5, 0, 4, 2, 0, 4, 6, 2, 0, 4, 5, 1, 4, 6, 0, 5, 3, 5, 1,
-	1, 2, 1, 5, 1, 5, 4, 0, 3, 1, 3, 6, 1, 6, 3, 4, 4, 0, 0, 1,
-	2, 4, 5, 6, 1, 3, 1, 4, 4, 3, 6, 1, 5, 1, 2, 0, 0, 6, 5, 6,
-	3, 4, 3, 5, 1, 3, 1, 6, 6, 0, 4, 0, 2, 3, 6, 0, 3, 4, 1, 5,
-	4, 3, 2, 0, 4, 1, 6, 0, 1, 3, 6, 3, 3, 6, 3, 2, 1, 4, 5, 5,
-	5, 2, 5, 3, 2, 0, 2, 0, 6, 4, 6, 4, 1, 2, 1, 6, 3, 0, 4, 3,
-	6, 3, 6, 0, 6, 2, 4, 1, 2, 0, 1, 0, 3, 2, 6, 1, 3, 3, 1, 1,
-	0, 1, 2, 5, 0, 1, 4, 1, 6, 0, 6, 3, 0, 1, 2, 1, 5, 0, 5, 6,
-	1, 0, 6, 0, 3, 4, 0, 3, 1, 0, 4, 5, 6, 3, 1, 5, 0, 4, 1, 0,
-	2, 4, 4, 5, 3, 0, 2, 3, 2, 3, 2, 3, 4, 3, 6, 2, 0, 2, 6, 1,
-	3, 5, 3, 0, 6, 5, 3, 0, 5, 4, 6, 5, 1, 6, 3, 0, 4, 0, 6, 1,
-	4, 0, 1, 5, 4, 6, 1, 5, 2, 1, 5, 4, 0, 3, 5, 4, 2, 5, 6, 1,
-	5, 4, 3, 5, 1, 1, 2, 6, 4, 2, 1, 4, 4, 3, 0, 6, 1, 0, 5, 3,
-	6, 0, 3, 0, 6, 4, 0, 1, 6, 5, 1, 4, 0, 5, 2, 2, 6, 3, 1, 5,
-	0, 5, 4, 6, 3, 6, 4, 5, 3, 5, 2, 1, 4, 0, 4, 2, 1, 0, 3, 0,
-	1, 3, 6, 2, 6, 2, 5, 3, 1, 3, 4, 5, 0, 2, 1, 6, 1, 0, 1, 3,
-	2, 0, 2, 6, 2, 5, 0, 5, 3, 6, 3, 3, 5, 1, 2, 3, 0, 6, 5, 1,
-	3, 5, 0, 2, 0, 6, 2, 6, 2, 0, 5, 3, 6, 4, 5, 2, 4, 1, 6, 5,
-	4, 0, 4, 5, 0, 5, 3, 5, 0, 3, 0, 1, 0, 1, 4, 1, 0, 5, 6, 0,
-	5, 6, 4, 5, 3, 0, 4, 6, 0, 6, 3, 2, 6, 1, 2, 3, 0, 6, 2, 6,
-	6, 3, 2, 4, 2, 6, 0, 1, 1, 4, 4, 5, 0, 1, 0, 1, 5, 3, 5, 0,
-	0, 4, 0, 1, 0, 3, 1, 4, 2, 3, 5, 3, 6, 1, 2, 5, 1, 5, 2, 4,
-	1, 6, 1, 5, 5, 3, 0, 6, 1, 6, 0, 1, 0, 4, 0, 1, 4, 6, 2, 4,
-	2, 0, 5, 2, 6, 4, 1, 3, 5, 3, 2, 5, 6, 3, 5, 3, 4, 1, 3, 4,
-	3, 3, 5, 6, 4, 2, 1, 3, 5, 1, 5, 4, 2, 5, 2, 4, 1, 6, 1, 1,
-	4, 1, 2, 1, 2, 0, 6, 2, 1, 2, 4, 0, 6, 5, 1, 2, 6, 5, 6, 5,
-	5, 1, 0, 3, 1, 4, 3, 4, 4, 6, 4, 3, 4, 2, 3, 2, 0, 6, 2, 0,
-	6, 3, 1, 6, 2, 3, 6, 3, 0, 3, 6, 5, 6, 1, 2, 4, 2, 6, 3, 3,
-	0, 5, 0, 3, 6, 2, 0, 6, 4, 6, 4, 1, 5, 6, 2, 3, 5, 0, 6, 0,
-	1, 5, 3, 0, 4, 5, 6, 3, 6, 2, 1, 5, 5, 6, 5, 6, 2, 4, 6, 4,
-	2, 1, 0, 1, 2, 0, 1, 5, 3, 4, 6, 2, 5, 4, 0, 1, 5, 6, 4, 2,
-	3, 1, 5, 6, 1, 0, 2, 5, 0, 6, 2, 6, 4, 1, 2, 4, 3, 2, 0, 2,
-	4, 2, 5, 3, 5, 6, 1, 6, 5, 2, 0, 2, 6, 3, 0, 5, 4, 6, 3, 1,
-	5, 4, 6, 1, 5, 4, 6, 4, 1, 2, 5, 3, 6, 2, 4, 6, 3, 2, 4, 6,
-	6, 5, 2, 4, 0, 2, 3, 6, 3, 0, 5, 2, 3, 6, 1, 4, 5, 2, 4, 3,
-	0, 6, 2, 3, 3, 0, 5, 1, 0, 2, 5, 4, 5, 4, 0, 6, 4, 2, 2, 6,
-	1, 5, 5, 0, 1, 5, 4, 2, 1, 0, 1, 0, 4, 2, 1, 2, 3, 0, 5, 0,
-	2, 0, 4, 2, 1, 0, 0, 4, 3, 5, 6, 2, 6, 5, 0, 4, 1, 3, 6, 0,
-	3, 2, 3, 0, 4, 3, 2, 4, 5, 3, 1, 0, 6, 0, 2, 3, 1, 3, 2, 4,
-	4, 2, 5, 3, 1, 5, 3, 0, 1, 6, 1, 4, 1, 4, 5, 2, 1, 3, 1, 4,
-	5, 6, 6, 2, 3, 4, 5, 0, 2, 1, 2, 6, 5, 0, 6, 5, 6, 0, 1, 6,
-	6, 5, 5, 1, 0, 1, 3, 3, 0, 5, 2, 6, 1, 5, 3, 0, 4, 5, 0, 1,
-	0, 5, 3, 5, 4, 1, 3, 0, 4, 5, 3, 0, 1, 0, 4, 0, 1, 2, 4, 2,
-	1, 2, 3, 5, 4, 5, 0, 1, 2, 4, 3, 6, 5, 0, 6, 4, 3, 2, 6, 4,
-	2, 0, 2, 1, 5, 1, 2, 4, 3, 5, 3, 6, 4, 6, 5, 6, 1, 0, 3, 5,
-	3, 5, 1, 1, 3, 6, 2, 4, 3, 6, 3, 2, 5, 6, 3, 2, 1, 5, 4, 3,
-	4, 3, 5, 0, 4, 0, 6, 0, 2, 3, 0, 1, 1, 0, 6, 2, 5, 0, 5, 4,
-	5, 6, 0, 6, 4, 4, 3, 5, 4, 3, 2, 5, 0, 2, 4, 1, 4, 5, 4, 5,
-	6, 4, 0, 1, 3, 0, 1, 3, 5, 4, 6, 1, 2, 4, 3, 5, 3, 3, 6, 1,
-	0, 3, 0, 5, 2, 6, 0, 2, 2, 6, 4, 2, 1, 4, 1, 4, 5, 6, 2, 6,
-	1, 0, 4, 1, 1, 4, 2, 4, 5, 1, 6, 1, 2, 5, 3, 4, 5, 4, 3, 5,
-	2, 6, 0, 3, 1, 5, 4, 3, 4, 6, 3, 0, 4, 2, 1, 2, 1, 1, 3, 6,
-	3, 0, 6, 1, 3, 5, 0, 6, 4, 2, 0, 4, 5, 3, 0, 2, 4, 2, 5, 1,
-	4, 2, 2, 4, 2, 5, 3, 6, 2, 0, 4, 5, 2, 6, 5, 1, 0, 4, 0, 6,
-	5, 1, 4, 0, 6, 2, 0, 6, 2, 5, 4, 1, 5, 6, 0, 6, 2, 4, 2, 4,
-	6, 3, 4, 2, 0, 4, 0, 4, 5, 1, 1, 6, 1, 6, 2, 6, 5, 4, 0, 4,
-	0, 3, 4, 5, 2, 6, 5, 2, 6, 5, 4, 2, 3, 6, 5, 4, 1, 0, 2, 0,
-	1, 4, 5, 0, 1, 0, 4, 1, 2, 6, 4, 6, 5, 1, 3, 5, 3, 6, 2, 1,
-	2, 5, 1, 0, 4, 4, 3, 3, 1, 6, 3, 2, 1, 5, 1, 6, 5, 4, 0, 1,
-	3, 4, 0, 4, 3, 3, 1, 4, 6, 0, 3, 1, 2, 0, 1, 0, 5, 4, 6, 0,
-	4, 1, 5, 3, 1, 5, 0, 6, 5, 6, 5, 2, 0, 4, 5, 1, 5, 6, 2, 3,
-	5, 6, 4, 5, 0, 4, 6, 2, 6, 2, 6, 4, 3, 1, 5, 6, 3, 3, 6, 4,
-	6, 1, 1, 4, 1, 1, 6, 0, 4, 2, 0, 5, 3, 6, 1, 5, 1, 5, 0, 6,
-	0, 6, 4, 2, 6, 4, 2, 1, 5, 3, 3, 1, 2, 1, 3, 6, 4, 0, 0, 6,
-	1, 1, 3, 2, 1, 2, 1, 5, 4, 3, 4, 0, 3, 6, 2, 0, 4, 1, 2, 3,
-	2, 1, 0, 3, 2, 0, 5, 1, 4, 3, 6, 5, 0, 5, 4, 5, 6, 4, 2, 0,
-	3, 2, 4, 2, 4, 5, 6, 3, 3, 3, 0, 2, 4, 3, 1, 3, 2, 5, 1, 3,
-	4, 6, 3, 3, 5, 0, 6, 4, 2, 6, 1, 3, 0, 1, 4, 1, 3, 2, 1, 0,
-	5, 3, 0, 5, 2, 5, 1, 2, 3, 4, 5, 0, 0, 2, 0, 1, 5, 1, 6, 4,
-	6, 0, 6, 5, 1, 5, 1, 4, 3, 1, 5, 2, 0, 5, 3, 6, 0, 1, 2, 3,
-	0, 5, 3, 3, 5, 4, 6, 5, 4, 5, 2, 4, 3, 6, 4, 2, 3, 0, 6, 5,
-	1, 2, 5, 3, 0, 3, 2, 0, 2, 4, 3, 0, 2, 1, 2, 4, 1, 6, 4, 6,
-	2, 4, 5, 2, 1, 2, 1, 4, 5, 6, 2, 1, 1, 5, 2, 0, 5, 3, 5, 0,
-	3, 0, 3, 0, 1, 4, 2, 1, 6, 6, 3, 5, 0, 1, 0, 6, 1, 1, 0, 1,
-	4, 3, 4, 2, 3, 6, 1, 0, 4, 6, 3, 3, 5, 6, 5, 1, 6, 0, 5, 6,
-	5, 1, 2, 3, 2, 3, 0, 5, 2, 5, 1, 5, 0, 1, 3, 2, 1, 3, 2, 5,
-	6, 5, 6, 3, 4, 2, 1, 3, 4, 5, 3, 1, 3, 5, 0, 6, 0, 6, 4, 1,
-	0, 6, 0, 4, 5, 3, 2, 4, 6, 2, 1, 3, 2, 3, 3, 6, 4, 3, 6, 0,
-	1, 3, 1, 6, 1, 3, 4, 1, 4, 0, 4, 1, 2, 0, 5, 4, 3, 0, 4, 0,
-	2, 4, 2, 0, 6, 4, 1, 0, 2, 5, 1, 4, 0, 6, 2, 1, 0, 4, 1, 0,
-	3, 2, 1, 3, 5, 2, 3, 0, 1, 3, 1, 5, 5, 0, 4, 1, 0, 1, 5, 1,
-	4, 1, 4, 1, 6, 3, 3, 6, 3, 2, 0, 2, 1, 6, 0, 5, 1, 4, 6, 4,
-	5, 0, 1, 4, 5, 6, 0, 6, 5, 1, 3, 6, 5, 4, 0, 3, 5, 5, 3, 5,
-	6, 2, 6, 1, 1, 6, 0, 6, 6, 3, 6, 4, 6, 3, 4, 2, 6, 4, 0, 6,
-	0, 6, 0, 5, 6, 3, 1, 2, 5, 4, 5, 1, 4, 6, 0, 1, 5, 1, 3, 6,
-	1, 5, 1, 2, 3, 5, 0, 4, 2, 3, 1, 3, 5, 1, 1, 1, 6, 0, 2, 3,
-	2, 4, 2, 4, 5, 5, 1, 4, 2, 0, 2, 0, 3, 1, 6, 4, 0, 6, 1, 4,
-	3, 5, 0, 1, 0, 3, 0, 3, 0, 2, 0, 2, 4, 2, 5, 6, 0, 6, 4, 6,
-	4, 6, 0, 2, 6, 5, 2, 3, 2, 5, 6, 2, 6, 3, 5, 6, 3, 1, 4, 0,
-	5, 6, 4, 0, 4, 6, 4, 3, 6, 3, 4, 3, 4, 5, 1, 6, 0, 3, 1, 0,
-	6, 2, 1, 0, 3, 0, 3, 1, 3, 1, 2, 6, 6, 1, 1, 3, 4, 3, 0, 6,
-	0, 3, 4, 5, 4, 2, 5, 5, 2, 0, 1, 6, 2, 0, 5, 1, 5, 4, 1, 6,
-	1, 6, 1, 4, 0, 1, 0, 4, 1, 2, 4, 3, 3, 5, 4, 1, 2, 3, 2, 0,
-	2, 0, 3, 5, 3, 6, 1, 2, 6, 0, 1, 5, 6, 2, 1, 2, 0, 5, 2, 5,
-	3, 5, 4, 5, 1, 5, 2, 1, 4, 2, 2, 5, 0, 3, 6, 0, 2, 6, 4, 5,
-	4, 3, 0, 4, 2, 6, 3, 0, 4, 3, 2, 6, 5, 4, 6, 4, 0, 3, 0, 1,
-	5, 2, 4, 5, 5, 2, 3, 6, 5, 2, 3, 6, 4, 6, 1, 5, 0, 1, 3, 2,
-	6, 3, 0, 6, 0, 6, 4, 6, 4, 0, 4, 0, 5, 6, 4, 6, 3, 4, 0, 6,
-	0, 1, 5, 3, 2, 5, 2, 4, 5, 4, 6, 5, 5, 4, 4, 6, 1, 1, 6, 2,
-	1, 2, 1, 4, 2, 5, 6, 5, 0, 3, 5, 3, 2, 1, 1, 4, 1, 0, 4, 1,
-	2, 1, 6, 5, 3, 4, 6, 0, 3, 5, 4, 3, 4, 5, 0, 3, 1, 2, 4, 0,
-	3, 5, 1, 2, 1, 0, 5, 4, 5, 2, 6, 5, 4, 0, 5, 6, 3, 4, 0, 1,
-	4, 3, 6, 3, 6, 1, 6, 1, 5, 2, 3, 5, 4, 4, 3, 6, 2, 0, 3, 1,
-	5, 4, 2, 5, 4, 3, 6, 0, 2, 4, 0, 4, 0, 1, 6, 0, 4, 5, 5, 2,
-	6, 2, 3, 6, 5, 2, 2, 1, 2, 0, 3, 0, 2, 4, 4, 0, 1, 3, 2, 6,
-	0, 4, 4, 2, 0, 6, 1, 1, 6, 0, 5, 1, 0, 3, 1, 3, 6, 4, 0, 1,
-	1, 3, 1, 6, 2, 0, 5, 1, 5, 6, 0, 2, 3, 6, 4, 6, 4, 6, 4, 2,
-	2, 6, 5, 1, 6, 5, 2, 4, 1, 4, 6, 5, 6, 0, 5, 1, 3, 5, 2, 6,
-	3, 4, 0, 6, 4, 1, 6, 6, 4, 5, 3, 0, 2, 0, 3, 4, 6, 4, 6, 4,
-	4, 6, 0, 1, 3, 5, 2, 4, 6, 2, 0, 5, 2, 5, 4, 3, 3, 0, 6, 5,
-	5, 0, 4, 6, 1, 5, 4, 0, 6, 0, 3, 4, 0, 5, 0, 6, 5, 6, 2, 6,
-	6, 0, 1, 0, 1, 0, 4, 1, 2, 4, 1, 0, 4, 0, 2, 5, 2, 0, 2, 6,
-	0, 2, 5, 3, 2, 6, 5, 3, 4, 1, 6, 2, 6, 3, 1, 6, 4, 4, 0, 2,
-	1, 3, 0, 1, 2, 0, 2, 4, 5, 2, 4, 2, 5, 3, 0, 2, 3, 0, 5, 4,
-	2, 3, 4, 2, 0, 1, 3, 1, 3, 6, 4, 0, 4, 6, 3, 4, 3, 2, 0, 2,
-	3, 4, 3, 1, 3, 0, 5, 2, 4, 0, 3, 3, 1, 3, 5, 2, 5, 4, 5, 2,
-	4, 2, 2, 6, 2, 3, 0, 2, 5, 6, 6, 2, 3, 6, 4, 1, 0, 4, 0, 1,
-	5, 4, 6, 4, 5, 4, 2, 6, 0, 1, 5, 2, 3, 3, 0, 6, 5, 4, 0, 2,
-	6, 3, 0, 6, 1, 3, 2, 6, 2, 5, 3, 0, 4, 5, 6, 4, 0, 6, 3, 0,
-	0, 6, 4, 0, 5, 6, 2, 1, 6, 5, 6, 6, 3, 6, 0, 3, 5, 2, 1, 0,
-	1, 6, 2, 4, 3, 5, 2, 5, 4, 6, 0, 4, 3, 4, 6, 0, 1, 1, 4, 3,
-	2, 0, 6, 0, 1, 3, 0, 5, 3, 0, 6, 5, 5, 6, 1, 2, 4, 2, 5, 4,
-	3, 2, 6, 1, 5, 3, 2, 6, 2, 0, 5, 5, 6, 4, 1, 3, 1, 0, 2, 4,
-	4, 0, 1, 6, 2, 0, 1, 6, 2, 6, 3, 1, 6, 2, 6, 1, 2, 1, 3, 1,
-	5, 3, 6, 1, 6, 3, 0, 6, 5, 2, 3, 0, 2, 4, 6, 4, 2, 0, 6, 0,
-	6, 2, 2, 4, 5, 1, 5, 3, 1, 4, 0, 1, 5, 4, 3, 0, 6, 2, 1, 4,
-	0, 3, 5, 4, 6, 0, 4, 2, 4, 1, 5, 1, 0, 4, 5, 3, 6, 2, 3, 1,
-	1, 4, 1, 0, 5, 4, 5, 1, 1, 6, 0, 5, 3, 5, 2, 3, 0, 5, 1, 1,
-	2, 4, 3, 2, 6, 5, 6, 5, 2, 5, 4, 6, 0, 5, 3, 2, 0, 4, 5, 1,
-	3, 6, 1, 5, 4, 5, 4, 6, 4, 6, 3, 0, 1, 3, 0, 5, 2, 0, 3, 6,
-	4, 1, 6, 0, 1, 6, 4, 3, 0, 6, 1, 0, 5, 4, 2, 4, 0, 6, 2, 3,
-	5, 1, 4, 2, 3, 2, 6, 1, 5, 2, 4, 6, 5, 4, 2, 0, 1, 0, 2, 0,
-	6, 4, 5, 3, 5, 6, 0, 2, 0, 1, 6, 2, 0, 2, 5, 2, 0, 5, 3, 1,
-	0, 6, 2, 4, 2, 3, 1, 4, 0, 6, 0, 2, 4, 5, 0, 4, 2, 3, 4, 5,
-	1, 6, 5, 3, 0, 5, 0, 3, 1, 0, 2, 5, 2, 4, 0, 1, 6, 1, 5, 6,
-	2, 0, 4, 2, 0, 4, 0, 1, 4, 6, 5, 6, 1, 0, 5, 2, 1, 3, 1, 5,
-	3, 2, 6, 1, 1, 4, 1, 4, 1, 1, 4, 6, 3, 1, 6, 5, 0, 5, 4, 1,
-	4, 6, 4, 2, 5, 1, 6, 1, 2, 4, 5, 6, 3, 0, 6, 4, 2, 5, 6, 6,
-	5, 1, 6, 4, 3, 6, 2, 4, 3, 2, 1, 6, 0, 5, 5, 0, 5, 6, 5, 0,
-	6, 2, 3, 5, 4, 3, 5, 1, 3, 4, 2, 0, 6, 4, 1, 0, 3, 1, 6, 5,
-	0, 6, 4, 5, 5, 6, 4, 1, 0, 6, 0, 2, 1, 0, 5, 0, 6, 5, 1, 3,
-	1, 5, 1, 6, 0, 6, 0, 4, 2, 6, 3, 2, 0, 6, 2, 5, 2, 5, 3, 2,
-	2, 5, 2, 6, 2, 6, 2, 0, 6, 1, 4, 2, 1, 6, 4, 0, 4, 1, 5, 4,
-	3, 0, 3, 1, 2, 4, 4, 0, 4, 6, 3, 3, 0, 3, 6, 4, 2, 4, 3, 1,
-	4, 0, 1, 2, 1, 3, 6, 4, 2, 1, 5, 2, 3, 1, 4, 6, 2, 3, 3, 6,
-	5, 4, 3, 2, 1, 0, 1, 0, 1, 5, 4, 3, 6, 2, 0, 6, 1, 1, 3, 4,
-	6, 2, 3, 2, 6, 3, 0, 1, 3, 2, 3, 6, 4, 5, 0, 5, 0, 1, 2, 4,
-	0, 2, 3, 1, 2, 3, 6, 0, 1, 6, 3, 2, 1, 2, 6, 5, 3, 0, 6, 3,
-	1, 4, 5, 4, 0, 6, 0, 4, 2, 5, 6, 5, 2, 3, 4, 4, 3, 1, 6, 2,
-	2, 0, 2, 6, 3, 0, 6, 3, 6, 2, 2, 5, 1, 0, 6, 0, 6, 1, 1, 3,
-	3, 5, 2, 0, 5, 4, 0, 2, 0, 6, 4, 3, 0, 2, 0, 2, 5, 1, 3, 1,
-	4, 2, 5, 1, 3, 6, 2, 4, 1, 4, 3, 2, 5, 6, 3, 2, 0, 6, 0, 6,
-	5, 1, 2, 3, 0, 5, 2, 1, 1, 6, 0, 5, 6, 4, 2, 2, 6, 5, 2, 0,
-	6, 5, 6, 3, 0, 2, 0, 3, 4, 4, 0, 5, 4, 6, 4, 2, 3, 6, 4, 5,
-	0, 4, 1, 4, 5, 0, 6, 6, 0, 1, 0, 0, 5, 4, 1, 6, 4, 4, 1, 6,
-	1, 0, 4, 2, 6, 2, 3, 1, 0, 0, 0, 6, 1, 6, 0, 5, 3, 5, 1, 2,
-	2, 1, 1, 6, 2, 3, 0, 5, 6, 4, 3, 0, 1, 5, 3, 0, 6, 3, 0, 6,
-	3, 5, 6, 5, 4, 2, 3, 4, 0, 6, 3, 6, 2, 4, 2, 3, 5, 3, 4, 3,
-	4, 0, 6, 4, 5, 3, 0, 6, 2, 0, 4, 2, 0, 3, 6, 2, 5, 3, 4, 2,
-	5, 4, 2, 1, 4, 6, 2, 5, 2, 5, 2, 0, 4, 6, 4, 4, 5, 5, 4, 6,
-	6, 3, 5, 0, 3, 6, 4, 2, 1, 6, 3, 0, 4, 2, 4, 1, 5, 1, 4, 1,
-	0, 1, 0, 4, 1, 4, 4, 0, 5, 6, 3, 5, 3, 5, 3, 0, 4, 0, 1, 6,
-	1, 1, 4, 2, 5, 6, 4, 0, 1, 2, 6, 2, 5, 6, 2, 3, 0, 3, 4, 2,
-	2, 1, 3, 1, 3, 4, 2, 6, 1, 0, 6, 3, 6, 4, 1, 2, 0, 2, 3, 3,
-	3, 1, 2, 5, 1, 1, 5, 2, 0, 3, 4, 6, 4, 2, 0, 1, 6, 2, 2, 2,
-	4, 3, 1, 6, 6, 4, 5, 6, 3, 4, 0, 4, 5, 3, 6, 3, 6, 5, 3, 0,
-	5, 3, 3, 4, 6, 5, 2, 5, 1, 5, 2, 4, 6, 2, 4, 0, 6, 3, 4, 5,
-	6, 0, 5, 6, 3, 4, 6, 2, 5, 2, 5, 6, 3, 4, 5, 3, 4, 6, 3, 1,
-	0, 4, 0, 4, 1, 6, 3, 6, 1, 6, 3, 1, 3, 6, 0, 1, 1, 6, 0, 5,
-	1, 0, 1, 0, 1, 2, 5, 3, 6, 2, 6, 3, 4, 1, 6, 4, 0, 6, 2, 6,
-	2, 0, 3, 6, 5, 1, 3, 1, 6, 4, 3, 6, 2, 1, 5, 6, 1, 4, 2, 3,
-	3, 6, 2, 6, 3, 6, 0, 3, 2, 1, 4, 5, 4, 3, 3, 4, 1, 3, 6, 2,
-	4, 0, 2, 0, 6, 2, 5, 1, 6, 5, 4, 0, 1, 6, 5, 0, 1, 6, 3, 0,
-	5, 1, 5, 2, 6, 2, 4, 3, 1, 4, 2, 6, 5, 6, 3, 5, 0, 2, 1, 4,
-	6, 5, 0, 6, 4, 0, 6, 4, 0, 6, 4, 0, 6, 5, 6, 5, 4, 1, 5, 3,
-	0, 1, 4, 3, 0, 4, 2, 5, 2, 6, 1, 6, 2, 5, 4, 2, 5, 0, 4, 0,
-	1, 5, 1, 6, 3, 1, 0, 4, 2, 3, 2, 0, 2, 4, 1, 2, 1, 0, 4, 0,
-	2, 3, 1, 5, 6, 4, 3, 6, 5, 6, 1, 3, 5, 3, 2, 3, 1, 2, 2, 0,
-	3, 6, 5, 6, 4, 5, 2, 4, 2, 4, 5, 0, 2, 6, 1, 2, 6, 5, 0, 2,
-	4, 6, 6, 4, 2, 6, 3, 1, 1, 6, 5, 6, 0, 4, 2, 5, 3, 1, 6, 0,
-	5, 6, 0, 3, 4, 6, 2, 6, 4, 0, 3, 1, 4, 2, 5, 3, 2, 3, 5, 6,
-	6, 2, 6, 1, 3, 4, 6, 0, 5, 0, 4, 1, 2, 4, 0, 6, 2, 0, 4, 2,
-	0, 0, 5, 4, 2, 3, 5, 2, 3, 6, 2, 6, 6, 5, 3, 4, 6, 1, 0, 2,
-	1, 2, 6, 2, 3, 0, 1, 6, 4, 0, 6, 1, 4, 2, 4, 3, 6, 1, 3, 5,
-	2, 6, 2, 0, 6, 0, 1, 3, 4, 5, 4, 3, 4, 0, 2, 1, 0, 6, 5, 3,
-	3, 2, 1, 0, 5, 0, 5, 6, 5, 2, 6, 1, 3, 1, 6, 2, 1, 2, 1, 1,
-	4, 1, 2, 0, 5, 1, 3, 4, 3, 0, 2, 6, 3, 6, 0, 2, 6, 2, 3, 2,
-	5, 5, 2, 1, 3, 5, 0, 3, 2, 5, 2, 4, 0, 3, 6, 5, 1, 0, 2, 6,
-	6, 5, 1, 0, 2, 0, 2, 3, 6, 1, 6, 1, 4, 6, 0, 2, 5, 2, 1, 4,
-	0, 2, 6, 5, 2, 5, 2, 3, 0, 5, 0, 6, 4, 5, 2, 6, 0, 1, 6, 2,
-	1, 5, 3, 4, 5, 4, 6, 1, 6, 2, 6, 2, 1, 6, 3, 4, 3, 0, 3, 5,
-	2, 1, 6, 5, 6, 2, 2, 0, 3, 2, 5, 1, 3, 2, 4, 6, 5, 1, 3, 1,
-	3, 5, 0, 1, 3, 1, 4, 3, 1, 5, 0, 2, 1, 4, 0, 6, 5, 1, 6, 1,
-	4, 2, 3, 6, 1, 1, 0, 5, 4, 6, 3, 4, 3, 3, 5, 2, 1, 4, 3, 6,
-	5, 4, 0, 5, 2, 5, 6, 1, 0, 4, 5, 1, 2, 6, 4, 1, 6, 0, 1, 2,
-	6, 2, 1, 6, 3, 1, 5, 3, 1, 6, 0, 4, 0, 2, 0, 6, 3, 1, 2, 5,
-	0, 1, 0, 3, 4, 0, 1, 5, 4, 3, 1, 3, 1, 2, 1, 0, 2, 5, 1, 6,
-	1, 5, 3, 0, 0, 1, 3, 3, 1, 3, 1, 2, 3, 3, 6, 5, 0, 3, 5, 1,
-	2, 4, 2, 3, 0, 6, 4, 3, 2, 6, 1, 6, 5, 2, 0, 0, 5, 3, 4, 3,
-	3, 1, 6, 4, 3, 3, 4, 5, 1, 4, 1, 0, 3, 0, 5, 4, 3, 3, 0, 6,
-	4, 0, 4, 1, 3, 3, 2, 0, 4, 5, 2, 4, 2, 4, 1, 5, 4, 2, 6, 2,
-	5, 0, 6, 3, 1, 3, 2, 0, 1, 0, 3, 5, 1, 0, 5, 4, 0, 6, 1, 5,
-	6, 0, 1, 6, 2, 0, 4, 5, 6, 4, 3, 0, 5, 2, 2, 3, 2, 4, 2, 3,
-	0, 1, 3, 0, 6, 4, 3, 4, 5, 2, 5, 4, 0, 1, 0, 1, 0, 3, 1, 0,
-	1, 2, 5, 1, 6, 1, 6, 5, 2, 5, 0, 4, 1, 3, 6, 1, 3, 2, 3, 6,
-	2, 3, 0, 2, 4, 2, 6, 4, 1, 0, 4, 0, 4, 5, 3, 0, 5, 1, 2, 0,
-	3, 6, 5, 1, 0, 5, 2, 0, 3, 4, 3, 4, 0, 4, 0, 6, 1, 5, 2, 6,
-	4, 1, 3, 5, 3, 5, 5, 6, 2, 1, 1, 5, 2, 6, 1, 5, 4, 4, 0, 3,
-	5, 0, 3, 3, 4, 5, 1, 3, 6, 0, 3, 3, 1, 6, 5, 6, 3, 6, 3, 0,
-	6, 1, 3, 2, 3, 1, 4, 3, 2, 3, 0, 2, 4, 6, 2, 4, 1, 5, 3, 1,
-	0, 2, 5, 4, 0, 1, 6, 3, 5, 1, 3, 5, 3, 0, 3, 2, 1, 4, 2, 0,
-	1, 0, 5, 3, 2, 1, 3, 5, 0, 4, 2, 4, 2, 6, 5, 0, 4, 3, 1, 5,
-	2, 4, 3, 4, 3, 0, 0, 4, 2, 0, 0, 3, 0, 6, 2, 3, 1, 4, 0, 6,
-	3, 6, 1, 3, 4, 3, 0, 3, 4, 4, 2, 0, 3, 6, 2, 6, 3, 4, 6, 2,
-	4, 5, 1, 6, 2, 0, 5, 6, 4, 3, 2, 1, 4, 3, 3, 1, 3, 6, 3, 0,
-	5, 2, 6, 4, 0, 5, 1, 3, 0, 3, 6, 2, 3, 4, 6, 0, 1, 5, 4, 3,
-	6, 2, 1, 5, 4, 0, 2, 3, 2, 0, 0, 4, 1, 3, 1, 2, 6, 0, 6, 3,
-	0, 4, 1, 6, 3, 6, 3, 2, 3, 1, 6, 1, 0, 3, 1, 5, 6, 2, 5, 6,
-	1, 6, 3, 0, 4, 3, 2, 3, 4, 2, 5, 6, 5, 1, 2, 4, 2, 5, 1, 6,
-	2, 0, 2, 5, 3, 6, 0, 0, 1, 4, 3, 5, 4, 3, 1, 4, 3, 1, 3, 1,
-	3, 5, 3, 6, 2, 5, 2, 5, 1, 4, 1, 0, 1, 4, 3, 5, 3, 1, 6, 5,
-	4, 5, 6, 2, 0, 6, 2, 0, 5, 4, 6, 2, 0, 2, 4, 5, 6, 1, 5, 0,
-	5, 0, 1, 0, 6, 1, 5, 3, 6, 1, 1, 2, 0, 6, 3, 3, 0, 2, 4, 1,
-	6, 1, 6, 3, 2, 6, 0, 4, 5, 3, 6, 2, 5, 2, 6, 4, 2, 5, 3, 1,
-	0, 0, 3, 4, 3, 6, 0, 4, 2, 4, 1, 5, 1, 4, 3, 5, 6, 2, 0, 2,
-	1, 6, 4, 0, 6, 5, 2, 5, 4, 2, 3, 2, 4, 6, 3, 6, 0, 1, 2, 6,
-	2, 4, 3, 1, 3, 5, 2, 5, 6, 3, 4, 1, 3, 2, 1, 4, 0, 5, 4, 6,
-	3, 5, 2, 5, 0, 4, 0, 1, 0, 5, 4, 2, 1, 1, 5, 2, 4, 1, 5, 3,
-	4, 3, 3, 2, 3, 6, 3, 0, 4, 3, 0, 4, 6, 2, 0, 1, 6, 2, 1, 2,
-	5, 2, 6, 4, 6, 0, 3, 0, 5, 6, 2, 4, 1, 3, 1, 4, 3, 1, 6, 4,
-	6, 1, 2, 5, 0, 3, 2, 3, 0, 4, 5, 0, 4, 1, 2, 5, 6, 4, 1, 3,
-	0, 6, 2, 0, 4, 3, 3, 4, 5, 3, 4, 3, 5, 0, 4, 5, 2, 1, 4, 2,
-	1, 0, 6, 0, 6, 2, 0, 1, 4, 2, 6, 2, 3, 4, 6, 0, 2, 6, 1, 5,
-	2, 0, 4, 1, 2, 1, 4, 5, 1, 3, 1, 3, 3, 0, 5, 4, 2, 1, 1, 3,
-	3, 2, 4, 0, 2, 6, 5, 0, 1, 6, 3, 4, 2, 1, 3, 4, 0, 1, 6, 1,
-	4, 6, 0, 3, 4, 5, 2, 6, 3, 5, 1, 6, 0, 4, 5, 0, 6, 1, 0, 2,
-	5, 3, 6, 5, 2, 1, 6, 5, 0, 3, 6, 5, 6, 2, 3, 2, 5, 4, 3, 2,
-	6, 1, 3, 5, 0, 6, 0, 6, 5, 4, 5, 2, 6, 1, 3, 2, 4, 2, 4, 5,
-	0, 5, 1, 5, 4, 0, 1, 2, 1, 0, 6, 2, 1, 0, 4, 1, 6, 6, 0, 3,
-	1, 6, 5, 3, 1, 2, 0, 0, 4, 3, 3, 4, 5, 1, 3, 5, 4, 0, 2, 3,
-	2, 3, 0, 6, 5, 1, 3, 2, 4, 3, 1, 5, 6, 4, 6, 4, 1, 3, 1, 2,
-	3, 2, 1, 0, 4, 5, 3, 2, 0, 1, 4, 5, 1, 2, 4, 0, 2, 6, 3, 6,
-	4, 3, 1, 1, 4, 5, 2, 3, 0, 2, 6, 5, 4, 5, 3, 3, 0, 6, 4, 2,
-	5, 0, 3, 0, 2, 1, 0, 4, 3, 3, 2, 4, 5, 5, 6, 5, 2, 6, 2, 1,
-	6, 6, 1, 6, 3, 2, 1, 3, 4, 0, 6, 5, 2, 5, 2, 1, 5, 3, 1, 4,
-	0, 3, 5, 3, 6, 2, 3, 0, 5, 2, 4, 1, 4, 1, 0, 2, 6, 3, 1, 0,
-	1, 3, 0, 6, 4, 6, 2, 6, 3, 0, 4, 6, 0, 5, 1, 3, 4, 1, 1, 2,
-	2, 4, 1, 2, 6, 4, 5, 2, 3, 4, 3, 6, 5, 4, 5, 2, 2, 3, 0, 3,
-	3, 2, 4, 4, 0, 1, 0, 2, 2, 1, 2, 0, 1, 3, 5, 0, 6, 1, 5, 3,
-	4, 5, 6, 1, 5, 2, 5, 0, 4, 3, 1, 4, 2, 3, 1, 5, 1, 3, 4, 1,
-	5, 1, 3, 1, 0, 2, 6, 2, 4, 5, 3, 0, 2, 1, 4, 1, 2, 3, 0, 6,
-	6, 5, 1, 5, 4, 0, 1, 0, 5, 6, 3, 0, 2, 1, 2, 4, 2, 1, 1, 3,
-	0, 5, 2, 0, 5, 4, 6, 0, 4, 3, 0, 5, 1, 3, 6, 4, 6, 2, 5, 3,
-	1, 4, 2, 1, 5, 0, 1, 4, 2, 4, 6, 5, 1, 6, 0, 3, 3, 1, 3, 6,
-	2, 1, 6, 0, 6, 2, 5, 6, 2, 0, 5, 0, 4, 2, 0, 6, 2, 4, 3, 1,
-	3, 2, 6, 4, 5, 1, 2, 3, 2, 1, 6, 2, 1, 3, 6, 1, 0, 6, 5, 1,
-	4, 1, 2, 5, 3, 0, 0, 6, 5, 2, 2, 5, 2, 0, 1, 5, 1, 5, 1, 1,
-	5, 6, 0, 2, 4, 5, 4, 5, 5, 6, 5, 6, 1, 2, 1, 4, 6, 0, 1, 0,
-	6, 0, 6, 4, 3, 1, 3, 4, 3, 6, 5, 3, 1, 5, 1, 2, 1, 1, 5, 2,
-	0, 4, 0, 1, 2, 2, 0, 5, 4, 3, 4, 1, 4, 5, 3, 6, 4, 0, 3, 5,
-	1, 4, 6, 2, 0, 1, 4, 5, 6, 0, 2, 4, 0, 1, 0, 2, 6, 0, 2, 1,
-	2, 0, 5, 3, 6, 3, 2, 6, 2, 1, 6, 0, 5, 0, 4, 2, 5, 3, 6, 2,
-	3, 4, 2, 0, 6, 0, 5, 1, 6, 2, 3, 3, 5, 2, 3, 0, 4, 0, 5, 3,
-	4, 5, 6, 4, 2, 4, 6, 5, 5, 0, 4, 5, 6, 2, 6, 6, 4, 5, 6, 1,
-	5, 3, 5, 5, 5, 3, 6, 2, 1, 6, 6, 4, 3, 2, 5, 2, 5, 6, 2, 0,
-	6, 0, 3, 1, 2, 5, 2, 0, 2, 5, 0, 1, 1, 3, 4, 3, 1, 1, 6, 3,
-	0, 4, 1, 5, 2, 5, 3, 0, 3, 1, 3, 1, 6, 1, 4, 6, 2, 1, 0, 5,
-	1, 3, 1, 0, 4, 0, 2, 6, 1, 5, 6, 5, 1, 0, 1, 3, 2, 0, 4, 0,
-	2, 6, 5, 4, 1, 4, 5, 3, 0, 4, 2, 0, 3, 0, 1, 5, 5, 5, 2, 1,
-	3, 0, 6, 4, 2, 0, 4, 0, 2, 1, 0, 2, 4, 1, 1, 4, 3, 4, 4, 3,
-	4, 2, 0, 5, 0, 5, 0, 5, 1, 1, 3, 4, 1, 2, 0, 5, 6, 0, 1, 3,
-	5, 1, 6, 0, 6, 0, 6, 4, 6, 2, 6, 0, 3, 5, 4, 6, 0, 4, 5, 4,
-	6, 4, 3, 2, 0, 6, 1, 2, 1, 3, 0, 2, 1, 3, 0, 5, 0, 3, 0, 1,
-	0, 1, 5, 6, 5, 3, 2, 1, 2, 5, 3, 0, 1, 6, 2, 6, 5, 0, 6, 3,
-	1, 2, 4, 6, 2, 1, 3, 2, 3, 6, 0, 6, 4, 1, 3, 1, 3, 2, 1, 0,
-	2, 5, 2, 6, 2, 1, 1, 0, 3, 0, 1, 5, 2, 5, 3, 1, 6, 5, 0, 1,
-	3, 4, 5, 1, 3, 2, 4, 5, 4, 3, 0, 4, 2, 3, 1, 4, 1, 1, 2, 2,
-	4, 5, 2, 1, 3, 4, 1, 5, 1, 3, 4, 2, 1, 0, 2, 6, 5, 6, 3, 6,
-	5, 2, 1, 5, 1, 0, 6, 2, 0, 2, 0, 2, 4, 3, 0, 6, 2, 4, 3, 1,
-	6, 0, 6, 3, 0, 5, 2, 6, 2, 1, 4, 2, 6, 5, 3, 3, 0, 3, 3, 4,
-	0, 4, 1, 0, 2, 4, 1, 5, 3, 2, 5, 0, 5, 0, 4, 1, 1, 1, 6, 1,
-	1, 4, 0, 4, 0, 6, 3, 6, 3, 0, 4, 1, 2, 4, 0, 5, 4, 2, 0, 6,
-	2, 5, 0, 1, 0, 6, 3, 4, 6, 1, 5, 2, 1, 2, 1, 6, 5, 6, 1, 0,
-	3, 5, 1, 1, 4, 2, 1, 5, 1, 3, 6, 1, 4, 2, 1, 6, 0, 2, 4, 0,
-	4, 5, 1, 6, 4, 5, 5, 4, 4, 2, 4, 6, 1, 6, 1, 5, 3, 5, 3, 4,
-	5, 6, 5, 1, 6, 3, 4, 1, 5, 1, 5, 3, 4, 2, 0, 5, 2, 1, 0, 5,
-	6, 4, 5, 4, 3, 6, 0, 1, 6, 2, 5, 1, 4, 6, 5, 6, 4, 6, 0, 6,
-	0, 1, 2, 3, 4, 1, 5, 0, 5, 4, 2, 4, 0, 3, 3, 4, 3, 4, 6, 1,
-	1, 0, 5, 2, 6, 2, 4, 5, 6, 3, 4, 1, 2, 0, 6, 5, 4, 0, 5, 4,
-	2, 6, 5, 3, 4, 2, 0, 2, 0, 5, 1, 3, 4, 5, 1, 1, 2, 3, 5, 4,
-	3, 6, 1, 2, 1, 6, 0, 3, 6, 4, 3, 0, 1, 4, 1, 2, 0, 5, 4, 0,
-	4, 5, 6, 1, 5, 2, 6, 4, 6, 4, 1, 3, 0, 1, 3, 6, 1, 2, 4, 1,
-	5, 1, 2, 5, 1, 6, 2, 1, 3, 4, 0, 1, 6, 1, 6, 2, 0, 3, 3, 6,
-	6, 2, 0, 2, 5, 2, 0, 3, 1, 3, 3, 3, 1, 2, 3, 4, 1, 5, 1, 4,
-	0, 6, 4, 5, 1, 5, 4, 6, 2, 0, 6, 5, 3, 4, 6, 2, 6, 5, 1, 6,
-	1, 4, 5, 1, 3, 6, 2, 3, 5, 0, 4, 5, 2, 0, 3, 6, 5, 6, 3, 1,
-	2, 6, 4, 0, 6, 0, 3, 2, 5, 1, 4, 0, 5, 6, 4, 0, 5, 1, 4, 5,
-	3, 3, 0, 2, 4, 6, 0, 6, 0, 6, 0, 5, 1, 5, 2, 0, 2, 5, 0, 3,
-	4, 2, 1, 1, 4, 3, 2, 3, 1, 6, 6, 4, 0, 1, 6, 0, 3, 3, 2, 1,
-	5, 3, 0, 4, 2, 5, 2, 6, 4, 6, 1, 3, 0, 0, 1, 2, 2, 5, 2, 1,
-	6, 1, 4, 2, 1, 0, 6, 6, 2, 3, 5, 2, 0, 4, 1, 6, 3, 2, 4, 3,
-	0, 2, 4, 1, 6, 2, 1, 0, 1, 6, 5, 1, 5, 4, 6, 6, 0, 4, 0, 6,
-	1, 1, 5, 6, 5, 0, 4, 6, 2, 4, 2, 3, 5, 1, 5, 1, 6, 3, 2, 1,
-	2, 6, 4, 3, 6, 3, 3, 4, 3, 4, 6, 2, 1, 4, 3, 4, 5, 0, 5, 4,
-	3, 2, 0, 0, 2, 3, 0, 1, 5, 1, 5, 1, 5, 2, 4, 6, 4, 3, 4, 5,
-	4, 3, 3, 2, 3, 0, 1, 0, 6, 1, 5, 4, 0, 2, 6, 2, 1, 2, 6, 3,
-	5, 0, 3, 2, 0, 5, 2, 1, 2, 0, 4, 3, 4, 3, 6, 2, 5, 0, 6, 0,
-	6, 6, 0, 1, 0, 5, 6, 0, 4, 5, 2, 5, 1, 4, 6, 1, 3, 0, 5, 1,
-	0, 1, 4, 2, 4, 6, 4, 5, 2, 2, 6, 5, 4, 5, 4, 6, 3, 1, 6, 1,
-	1, 0, 2, 5, 0, 4, 2, 1, 0, 2, 6, 5, 4, 1, 5, 0, 2, 1, 2, 1,
-	2, 3, 3, 5, 4, 4, 5, 1, 6, 2, 6, 0, 6, 1, 4, 2, 5, 0, 0, 6,
-	3, 0, 6, 3, 6, 3, 6, 1, 5, 0, 6, 2, 5, 1, 2, 4, 2, 6, 3, 5,
-	4, 5, 2, 0, 4, 5, 6, 3, 6, 2, 3, 4, 5, 0, 3, 4, 6, 0, 6, 2,
-	5, 2, 1, 0, 4, 2, 3, 4, 2, 6, 0, 3, 5, 1, 6, 0, 5, 4, 2, 5,
-	6, 4, 6, 0, 3, 6, 5, 3, 5, 6, 2, 5, 1, 5, 4, 6, 1, 5, 4, 2,
-	0, 1, 1, 1, 1, 3, 2, 4, 3, 1, 3, 1, 2, 6, 5, 3, 6, 4, 5, 5,
-	1, 5, 5, 3, 1, 5, 4, 6, 0, 2, 1, 6, 0, 1, 0, 5, 4, 1, 4, 1,
-	2, 6, 2, 1, 2, 1, 5, 0, 5, 4, 0, 3, 6, 3, 0, 5, 2, 6, 0, 5,
-	3, 2, 5, 4, 0, 3, 4, 3, 6, 2, 4, 1, 1, 5, 4, 3, 5, 4, 3, 6,
-	4, 0, 0, 6, 0, 6, 2, 3, 4, 3, 0, 2, 0, 4, 5, 6, 5, 1, 2, 1,
-	5, 1, 5, 3, 2, 4, 6, 2, 1, 3, 5, 1, 3, 1, 5, 0, 4, 2, 0, 5,
-	6, 0, 2, 3, 1, 6, 5, 4, 1, 4, 5, 1, 6, 0, 3, 5, 0, 4, 5, 5,
-	0, 6, 2, 1, 4, 5, 6, 5, 0, 5, 0, 4, 5, 6, 0, 2, 4, 0, 2, 0,
-	1, 4, 1, 4, 0, 1, 3, 6, 5, 3, 4, 5, 6, 5, 6, 2, 5, 0, 3, 2,
-	2, 1, 0, 2, 0, 3, 3, 2, 4, 6, 2, 4, 2, 1, 2, 3, 0, 1, 2, 6,
-	3, 2, 3, 4, 0, 5, 0, 3, 2, 4, 2, 0, 5, 1, 3, 5, 6, 0, 1, 1,
-	4, 2, 5, 3, 0, 6, 3, 0, 6, 4, 0, 1, 5, 2, 6, 3, 6, 0, 5, 2,
-	5, 1, 0, 3, 1, 0, 1, 3, 1, 1, 6, 2, 6, 6, 2, 4, 3, 0, 5, 3,
-	6, 4, 5, 0, 4, 2, 0, 4, 5, 1, 6, 2, 4, 0, 4, 2, 5, 2, 0, 5,
-	0, 1, 3, 4, 6, 5, 6, 1, 3, 0, 1, 5, 6, 3, 5, 2, 6, 3, 4, 6,
-	1, 4, 1, 2, 3, 0, 2, 0, 3, 5, 2, 5, 6, 4, 2, 4, 5, 1, 0, 1,
-	2, 5, 6, 5, 4, 2, 0, 6, 5, 5, 2, 2, 5, 1, 1, 2, 2, 4, 3, 1,
-	3, 4, 6, 4, 1, 6, 2, 0, 5, 6, 0, 6, 4, 2, 1, 0, 2, 6, 3, 5,
-	4, 2, 3, 5, 0, 2, 6, 5, 4, 3, 5, 4, 2, 5, 3, 5, 2, 1, 0, 4,
-	5, 3, 0, 3, 4, 5, 2, 1, 0, 3, 2, 0, 6, 3, 1, 3, 4, 5, 6, 0,
-	6, 1, 1, 6, 5, 0, 2, 5, 4, 3, 0, 4, 6, 4, 6, 1, 0, 4, 1, 3,
-	0, 1, 0, 2, 5, 2, 6, 1, 2, 6, 4, 3, 0, 1, 5, 1, 2, 4, 3, 2,
-	1, 3, 1, 4, 6, 5, 3, 1, 4, 0, 5, 0, 1, 6, 2, 4, 0, 6, 2, 4,
-	2, 1, 1, 2, 1, 0, 4, 1, 3, 6, 0, 2, 6, 0, 6, 0, 2, 3, 3, 4,
-	3, 5, 6, 2, 6, 3, 1, 4, 3, 5, 6, 2, 3, 3, 2, 4, 6, 4, 6, 5,
-	4, 6, 3, 5, 4, 0, 3, 1, 0, 6, 5, 1, 1, 5, 6, 2, 4, 0, 6, 5,
-	5, 3, 1, 5, 1, 4, 4, 3, 0, 3, 2, 5, 0, 4, 6, 2, 4, 2, 6, 0,
-	6, 4, 2, 6, 5, 4, 2, 5, 6, 0, 5, 3, 5, 3, 1, 0, 1, 6, 0, 5,
-	0, 5, 6, 2, 3, 4, 2, 5, 4, 4, 0, 5, 4, 6, 0, 0, 3, 5, 6, 3,
-	1, 5, 0, 5, 4, 6, 2, 1, 6, 3, 6, 1, 5, 6, 3, 1, 6, 0, 6, 4,
-	2, 4, 2, 6, 3, 1, 3, 4, 2, 5, 1, 2, 0, 1, 6, 5, 3, 0, 3, 2,
-	3, 0, 0, 2, 1, 4, 5, 1, 0, 3, 4, 2, 1, 0, 4, 3, 4, 1, 6, 1,
-	4, 3, 6, 0, 2, 3, 5, 2, 3, 3, 1, 5, 6, 5, 6, 6, 1, 2, 0, 4,
-	5, 6, 4, 2, 0, 6, 3, 6, 6, 1, 5, 0, 6, 2, 4, 3, 2, 6, 4, 2,
-	6, 2, 0, 2, 2, 6, 0, 2, 1, 2, 0, 5, 5, 3, 6, 4, 3, 1, 1, 2,
-	0, 1, 3, 6, 3, 6, 2, 1, 2, 2, 6, 0, 3, 6, 5, 1, 6, 3, 4, 2,
-	1, 3, 5, 2, 4, 0, 6, 4, 5, 1, 4, 2, 4, 2, 6, 0, 1, 4, 5, 2,
-	2, 6, 2, 5, 6, 0, 1, 1, 5, 2, 4, 3, 2, 0, 4, 5, 1, 4, 2, 0,
-	3, 1, 3, 2, 2, 5, 0, 4, 6, 4, 5, 0, 6, 5, 4, 2, 0, 4, 0, 6,
-	4, 5, 2, 1, 3, 2, 4, 1, 6, 3, 0, 1, 6, 0, 5, 1, 5, 5, 2, 4,
-	5, 1, 2, 4, 0, 6, 3, 0, 2, 4, 3, 1, 4, 3, 4, 3, 2, 2, 6, 3,
-	6, 3, 6, 1, 4, 2, 3, 6, 1, 0, 6, 0, 5, 6, 1, 4, 3, 4, 6, 3,
-	0, 1, 2, 1, 2, 5, 3, 1, 2, 4, 4, 6, 4, 2, 5, 0, 4, 5, 6, 2,
-	1, 5, 0, 1, 1, 6, 1, 5, 4, 2, 4, 5, 4, 5, 2, 4, 2, 1, 6, 4,
-	2, 0, 1, 3, 5, 4, 0, 5, 4, 5, 1, 2, 4, 1, 1, 3, 1, 6, 3, 4,
-	3, 6, 5, 4, 5, 4, 1, 2, 0, 6, 0, 1, 3, 2, 6, 6, 3, 6, 6, 1,
-	4, 5, 1, 2, 6, 2, 1, 2, 2, 0, 3, 1, 6, 0, 4, 0, 5, 4, 2, 1,
-	5, 6, 2, 1, 2, 0, 3, 6, 5, 3, 4, 0, 5, 1, 2, 0, 6, 6, 1, 6,
-	6, 4, 1, 2, 5, 3, 6, 6, 0, 0, 6, 5, 3, 2, 1, 0, 6, 2, 0, 4,
-	0, 3, 4, 5, 2, 0, 6, 1, 0, 5, 0, 0, 2, 6, 1, 6, 5, 2, 0, 2,
-	1, 6, 4, 2, 4, 1, 1, 3, 2, 6, 1, 2, 4, 4, 2, 5, 0, 4, 0, 4,
-	2, 5, 0, 3, 3, 6, 5, 0, 5, 6, 2, 0, 5, 2, 4, 2, 1, 1, 6, 1,
-	3, 6, 4, 2, 1, 2, 4, 0, 3, 1, 5, 4, 5, 6, 2, 3, 4, 6, 2, 6,
-	4, 1, 0, 2, 3, 3, 2, 4, 6, 1, 4, 6, 0, 5, 6, 2, 6, 0, 5, 2,
-	5, 0, 4, 2, 5, 2, 3, 6, 3, 4, 0, 5, 1, 4, 3, 4, 3, 0, 3, 2,
-	6, 2, 0, 1, 2, 6, 5, 2, 1, 0, 1, 4, 3, 6, 6, 4, 6, 1, 2, 4,
-	0, 6, 5, 2, 1, 6, 3, 6, 0, 2, 6, 4, 5, 6, 2, 3, 4, 0, 4, 6,
-	1, 5, 3, 1, 4, 6, 0, 1, 3, 4, 1, 4, 2, 1, 0, 1, 6, 6, 4, 3,
-	2, 1, 4, 6, 1, 2, 0, 6, 5, 4, 2, 1, 3, 6, 3, 2, 2, 4, 6, 2,
-	3, 4, 5, 1, 2, 3, 4, 1, 6, 6, 0, 5, 3, 6, 5, 1, 3, 5, 6, 2,
-	4, 0, 3, 0, 5, 4, 2, 1, 6, 5, 0, 6, 1, 4, 3, 1, 3, 4, 1, 0,
-	5, 2, 1, 5, 2, 6, 3, 0, 2, 4, 2, 3, 1, 3, 0, 4, 3, 0, 1, 3,
-	6, 0, 2, 1, 6, 0, 3, 3, 6, 2, 0, 6, 1, 2, 1, 6, 1, 0, 4, 3,
-	0, 5, 4, 2, 5, 3, 6, 3, 6, 0, 4, 6, 0, 6, 0, 1, 3, 0, 6, 0,
-	1, 2, 1, 4, 0, 4, 1, 6, 0, 2, 5, 2, 5, 6, 1, 2, 6, 2, 6, 5,
-	2, 4, 6, 1, 3, 1, 3, 5, 1, 4, 1, 4, 4, 5, 6, 2, 1, 1, 4, 3,
-	3, 2, 3, 2, 6, 4, 2, 5, 6, 4, 1, 4, 3, 2, 3, 2, 3, 2, 4, 0,
-	4, 2, 1, 3, 0, 0, 4, 6, 1, 4, 2, 5, 3, 3, 5, 0, 1, 0, 1, 4,
-	5, 2, 0, 5, 4, 1, 0, 2, 1, 0, 2, 4, 0, 4, 1, 6, 1, 1, 6, 2,
-	6, 5, 6, 4, 2, 6, 1, 3, 1, 3, 6, 6, 1, 5, 5, 4, 3, 5, 1, 0,
-	0, 5, 0, 6, 5, 6, 1, 5, 6, 4, 3, 1, 3, 6, 4, 1, 5, 2, 1, 4,
-	1, 4, 5, 0, 6, 5, 2, 2, 0, 3, 5, 3, 4, 3, 0, 3, 2, 4, 2, 3,
-	2, 0, 3, 6, 4, 3, 5, 3, 1, 6, 2, 6, 3, 1, 6, 1, 2, 2, 4, 0,
-	3, 6, 1, 6, 1, 4, 2, 3, 1, 3, 0, 5, 3, 1, 2, 1, 0, 6, 4, 5,
-	4, 3, 5, 0, 3, 4, 4, 5, 6, 1, 5, 2, 6, 3, 1, 5, 1, 5, 4, 5,
-	5, 2, 0, 1, 1, 3, 1, 4, 3, 0, 6, 0, 4, 1, 5, 6, 3, 4, 0, 1,
-	6, 5, 2, 6, 4, 3, 5, 3, 4, 1, 6, 3, 4, 2, 6, 3, 1, 0, 3, 5,
-	0, 3, 5, 1, 0, 6, 5, 4, 0, 1, 0, 3, 4, 2, 6, 2, 1, 2, 3, 6,
-	1, 5, 2, 5, 0, 3, 0, 4, 2, 6, 4, 5, 1, 6, 4, 1, 5, 6, 2, 4,
-	2, 1, 5, 1, 6, 2, 0, 6, 1, 3, 4, 2, 5, 4, 6, 4, 3, 4, 3, 6,
-	3, 6, 2, 0, 6, 0, 2, 4, 0, 6, 1, 6, 3, 0, 1, 2, 2, 1, 3, 5,
-	4, 0, 1, 6, 1, 6, 5, 6, 4, 2, 4, 1, 0, 1, 2, 0, 4, 0, 3, 0,
-	5, 0, 3, 2, 6, 0, 3, 6, 0, 3, 5, 1, 1, 1, 0, 3, 6, 5, 0, 5,
-	6, 3, 1, 5, 1, 0, 6, 6, 0, 2, 3, 0, 4, 5, 6, 4, 5, 6, 2, 3,
-	0, 4, 2, 0, 5, 6, 4, 6, 2, 3, 5, 0, 5, 3, 0, 3, 1, 0, 5, 4,
-	1, 3, 2, 6, 4, 5, 2, 5, 6, 3, 5, 4, 6, 6, 3, 2, 6, 2, 0, 6,
-	2, 0, 5, 6, 2, 3, 0, 1, 1, 6, 0, 6, 2, 0, 2, 3, 2, 0, 4, 5,
-	3, 2, 4, 3, 4, 0, 6, 3, 5, 4, 5, 6, 2, 1, 5, 3, 2, 4, 2, 5,
-	4, 2, 1, 3, 1, 1, 6, 4, 0, 5, 6, 1, 4, 0, 3, 1, 5, 3, 4, 6,
-	5, 1, 6, 3, 4, 6, 2, 6, 0, 5, 2, 3, 3, 1, 5, 2, 6, 2, 4, 0,
-	6, 3, 5, 4, 2, 6, 4, 5, 0, 2, 0, 4, 6, 3, 6, 5, 4, 3, 2, 5,
-	0, 2, 6, 0, 2, 3, 1, 4, 0, 4, 3, 5, 0, 4, 3, 1, 3, 2, 4, 4,
-	1, 2, 1, 6, 0, 5, 3, 4, 1, 1, 0, 5, 0, 4, 0, 6, 0, 0, 1, 6,
-	2, 3, 3, 1, 2, 1, 2, 4, 2, 2, 4, 2, 0, 6, 3, 0, 1, 6, 4, 3,
-	3, 3, 2, 5, 2, 3, 1, 2, 5, 3, 5, 2, 5, 6, 3, 1, 4, 3, 3, 4,
-	4, 2, 1, 6, 4, 1, 4, 2, 1, 3, 6, 0, 4, 0, 1, 2, 4, 2, 5, 3,
-	5, 4, 6, 1, 2, 0, 3, 5, 6, 5, 6, 0, 5, 0, 5, 3, 0, 5, 6, 2,
-	6, 0, 5, 4, 0, 4, 6, 5, 6, 1, 3, 4, 1, 0, 6, 5, 1, 6, 1, 1,
-	0, 1, 2, 3, 0, 3, 6, 0, 6, 4, 1, 1, 5, 1, 2, 1, 4, 6, 1, 4,
-	1, 2, 5, 6, 3, 0, 1, 1, 4, 2, 1, 2, 0, 1, 6, 2, 5, 2, 0, 5,
-	2, 2, 0, 2, 6, 0, 5, 2, 6, 0, 3, 6, 5, 2, 6, 6, 5, 6, 4, 0,
-	3, 4, 4, 0, 3, 2, 5, 4, 0, 3, 2, 5, 2, 6, 4, 0, 6, 2, 3, 5,
-	4, 1, 6, 5, 6, 1, 4, 1, 5, 3, 4, 4, 3, 4, 6, 6, 1, 4, 2, 0,
-	5, 0, 4, 4, 2, 3, 4, 4, 3, 4, 6, 0, 1, 1, 2, 0, 3, 4, 5, 4,
-	6, 0, 3, 2, 6, 0, 3, 4, 6, 6, 5, 0, 2, 5, 4, 5, 0, 3, 4, 3,
-	0, 6, 4, 2, 6, 5, 6, 2, 0, 1, 0, 2, 0, 4, 3, 3, 5, 1, 0, 6,
-	1, 1, 5, 0, 3, 3, 6, 0, 2, 0, 3, 4, 5, 2, 6, 1, 0, 4, 0, 2,
-	2, 3, 6, 2, 3, 2, 6, 1, 6, 5, 3, 6, 4, 1, 3, 4, 2, 0, 1, 3,
-	3, 0, 3, 6, 0, 4, 0, 3, 4, 3, 5, 2, 0, 6, 3, 3, 5, 0, 5, 6,
-	4, 6, 2, 4, 2, 0, 2, 3, 5, 6, 1, 6, 3, 5, 3, 6, 4, 6, 5, 1,
-	5, 1, 4, 3, 2, 3, 3, 1, 4, 0, 2, 4, 5, 1, 6, 3, 6, 0, 2, 5,
-	6, 5, 1, 5, 0, 0, 6, 2, 6, 1, 4, 6, 2, 4, 2, 1, 0, 6, 0, 5,
-	0, 4, 3, 4, 2, 3, 2, 6, 5, 6, 2, 6, 6, 5, 1, 2, 0, 2, 3, 4,
-	1, 2, 5, 1, 4, 0, 4, 2, 0, 6, 0, 6, 0, 3, 6, 3, 1, 4, 3, 1,
-	2, 1, 3, 1, 2, 0, 2, 4, 0, 5, 0, 5, 1, 3, 1, 0, 1, 6, 0, 5,
-	3, 6, 2, 1, 6, 2, 3, 2, 1, 4, 6, 5, 3, 2, 0, 1, 3, 5, 1, 0,
-	4, 1, 0, 6, 3, 3, 3, 3, 4, 0, 5, 2, 6, 5, 0, 2, 1, 0, 1, 5,
-	5, 4, 6, 4, 6, 4, 1, 6, 2, 5, 3, 4, 0, 5, 2, 0, 3, 1, 3, 1,
-	6, 2, 6, 1, 4, 5, 6, 3, 5, 6, 0, 1, 4, 2, 0, 1, 4, 2, 0, 3,
-	0, 5, 3, 4, 5, 6, 2, 0, 2, 5, 0, 5, 4, 0, 4, 5, 3, 0, 1, 2,
-	1, 6, 3, 0, 2, 1, 0, 4, 1, 2, 1, 3, 4, 0, 3, 2, 0, 6, 5, 1,
-	2, 5, 4, 6, 0, 1, 0, 1, 3, 6, 1, 6, 1, 4, 0, 6, 2, 5, 2, 4,
-	3, 0, 1, 3, 2, 0, 3, 1, 1, 1, 2, 6, 2, 3, 5, 1, 5, 0, 5, 0,
-	4, 5, 3, 2, 3, 3, 6, 4, 0, 1, 6, 2, 5, 4, 0, 4, 3, 6, 2, 4,
-	5, 3, 0, 2, 5, 1, 6, 1, 3, 2, 3, 4, 6, 5, 1, 3, 4, 6, 4, 6,
-	6, 5, 4, 5, 4, 3, 4, 2, 4, 6, 2, 5, 0, 1, 5, 6, 1, 2, 5, 3,
-	0, 3, 0, 6, 3, 3, 0, 2, 1, 6, 4, 3, 0, 6, 2, 6, 3, 6, 5, 3,
-	1, 6, 1, 6, 2, 5, 1, 5, 2, 6, 5, 6, 0, 0, 5, 1, 5, 6, 1, 0,
-	2, 4, 6, 3, 1, 1, 2, 3, 4, 1, 0, 6, 5, 6, 3, 0, 6, 2, 1, 4,
-	3, 5, 2, 0, 3, 0, 5, 5, 1, 0, 3, 2, 1, 2, 6, 1, 1, 0, 5, 3,
-	4, 2, 3, 0, 4, 0, 5, 4, 0, 4, 3, 5, 6, 5, 3, 6, 3, 6, 2, 4,
-	5, 1, 3, 4, 6, 5, 3, 0, 0, 5, 3, 5, 4, 2, 5, 3, 6, 1, 3, 6,
-	6, 2, 6, 2, 5, 6, 0, 5, 4, 0, 1, 4, 2, 6, 1, 2, 6, 3, 1, 4,
-	0, 1, 2, 6, 0, 1, 2, 5, 4, 5, 1, 2, 0, 6, 4, 6, 4, 2, 4, 0,
-	1, 6, 5, 3, 0, 2, 5, 4, 3, 2, 1, 3, 2, 4, 3, 0, 3, 1, 1, 0,
-	2, 3, 6, 3, 6, 4, 6, 3, 2, 6, 2, 5, 2, 4, 0, 4, 2, 6, 0, 3,
-	3, 5, 3, 4, 5, 3, 6, 2, 5, 6, 0, 4, 3, 2, 4, 5, 0, 4, 3, 2,
-	4, 3, 1, 0, 3, 6, 2, 3, 5, 2, 1, 0, 1, 5, 0, 5, 4, 0, 6, 4,
-	5, 6, 2, 4, 5, 6, 0, 4, 6, 5, 3, 1, 4, 5, 2, 4, 0, 2, 3, 2,
-	6, 2, 0, 3, 5, 2, 1, 5, 6, 0, 6, 3, 2, 4, 2, 3, 1, 5, 2, 4,
-	0, 3, 3, 5, 2, 3, 6, 0, 4, 1, 0, 5, 1, 3, 4, 0, 5, 3, 5, 3,
-	1, 4, 3, 5, 6, 2, 5, 4, 4, 2, 1, 0, 3, 0, 6, 1, 6, 3, 5, 6,
-	2, 1, 1, 5, 0, 6, 0, 1, 2, 0, 6, 1, 5, 4, 3, 5, 6, 5, 3, 0,
-	3, 1, 5, 2, 6, 5, 2, 3, 4, 2, 3, 1, 1, 3, 1, 4, 2, 5, 0, 6,
-	4, 0, 5, 4, 6, 3, 4, 1, 4, 1, 0, 1, 6, 3, 0, 2, 2, 4, 5, 1,
-	5, 4, 0, 1, 6, 2, 6, 3, 0, 5, 1, 0, 1, 5, 1, 5, 3, 1, 5, 6,
-	6, 0, 2, 1, 4, 3, 4, 2, 4, 5, 3, 1, 5, 0, 4, 0, 2, 1, 0, 3,
-	0, 3, 6, 3, 0, 2, 0, 2, 4, 6, 2, 6, 6, 2, 3, 2, 4, 5, 2, 5,
-	1, 2, 4, 3, 5, 0, 6, 2, 5, 2, 5, 1, 3, 2, 6, 4, 1, 5, 2, 3,
-	2, 4, 6, 3, 4, 5, 1, 1, 0, 3, 6, 5, 1, 3, 6, 3, 1, 6, 2, 3,
-	3, 0, 5, 4, 1, 2, 4, 5, 3, 1, 4, 1, 1, 4, 2, 5, 1, 6, 5, 1,
-	4, 5, 1, 4, 2, 6, 0, 1, 2, 5, 4, 2, 5, 4, 6, 3, 2, 3, 1, 3,
-	5, 0, 1, 1, 3, 0, 3, 1, 0, 0, 3, 3, 5, 0, 2, 5, 4, 3, 6, 5,
-	6, 3, 5, 5, 3, 1, 2, 4, 6, 0, 1, 2, 4, 2, 3, 6, 2, 5, 2, 0,
-	0, 4, 5, 2, 6, 0, 4, 5, 3, 4, 0, 2, 4, 3, 5, 1, 4, 0, 3, 4,
-	1, 2, 3, 6, 2, 6, 5, 4, 0, 5, 2, 3, 4, 5, 2, 1, 3, 5, 1, 4,
-	2, 3, 0, 1, 2, 5, 6, 1, 3, 4, 6, 4, 5, 1, 1, 6, 1, 5, 6, 4,
-	3, 6, 1, 6, 5, 2, 1, 1, 4, 2, 5, 2, 4, 1, 4, 1, 4, 5, 0, 4,
-	4, 0, 2, 5, 2, 3, 1, 6, 3, 6, 5, 4, 6, 3, 4, 3, 4, 6, 3, 4,
-	5, 0, 2, 5, 6, 3, 3, 6, 2, 1, 4, 2, 0, 5, 6, 1, 1, 0, 4, 1,
-	6, 4, 0, 3, 6, 0, 0, 2, 6, 3, 3, 2, 6, 2, 0, 3, 5, 4, 0, 5,
-	0, 5, 1, 0, 3, 4, 2, 3, 2, 3, 0, 1, 4, 3, 6, 0, 6, 3, 4, 4,
-	1, 5, 2, 3, 5, 4, 6, 3, 2, 4, 1, 0, 1, 5, 2, 0, 4, 6, 3, 2,
-	2, 6, 2, 0, 5, 4, 5, 2, 4, 3, 5, 2, 5, 6, 0, 5, 0, 3, 2, 1,
-	3, 5, 4, 5, 4, 0, 2, 5, 0, 5, 3, 1, 5, 2, 3, 1, 2, 3, 2, 4,
-	4, 0, 4, 1, 4, 3, 0, 2, 5, 2, 6, 3, 2, 2, 0, 2, 0, 5, 6, 2,
-	5, 0, 5, 0, 6, 1, 3, 5, 0, 2, 6, 4, 1, 2, 3, 1, 5, 2, 3, 2,
-	6, 4, 3, 6, 5, 2, 4, 6, 2, 3, 6, 0, 6, 4, 3, 3, 2, 4, 6, 1,
-	0, 3, 3, 4, 5, 1, 0, 3, 1, 3, 1, 4, 5, 0, 2, 4, 0, 2, 1, 0,
-	1, 2, 6, 1, 6, 3, 4, 0, 5, 3, 4, 1, 2, 5, 3, 6, 4, 5, 4, 0,
-	2, 0, 4, 3, 5, 1, 2, 4, 0, 4, 1, 5, 3, 6, 2, 3, 6, 3, 6, 0,
-	3, 1, 0, 2, 1, 4, 2, 6, 3, 1, 0, 3, 4, 6, 4, 0, 1, 5, 1, 1,
-	4, 0, 5, 0, 5, 6, 3, 0, 3, 3, 0, 6, 5, 4, 1, 5, 3, 6, 4, 3,
-	5, 2, 5, 6, 2, 5, 2, 6, 6, 4, 1, 6, 5, 5, 3, 0, 3, 5, 2, 0,
-	6, 5, 1, 6, 4, 2, 4, 3, 3, 4, 2, 4, 1, 2, 2, 5, 4, 5, 6, 2,
-	0, 2, 3, 3, 5, 6, 2, 0, 4, 5, 1, 4, 6, 1, 0, 4, 3, 3, 4, 1,
-	1, 6, 1, 5, 0, 4, 0, 2, 5, 2, 1, 0, 3, 6, 3, 1, 1, 4, 5, 4,
-	2, 6, 1, 3, 0, 3, 5, 0, 6, 2, 5, 6, 0, 3, 1, 2, 3, 6, 1, 1,
-	3, 1, 2, 1, 1, 5, 0, 1, 0, 0, 4, 2, 5, 2, 6, 2, 5, 6, 2, 3,
-	4, 2, 3, 2, 1, 2, 0, 6, 1, 5, 6, 4, 3, 0, 6, 4, 0, 2, 1, 4,
-	5, 2, 2, 0, 5, 3, 5, 0, 0, 2, 1, 5, 2, 6, 1, 2, 1, 6, 5, 0,
-	6, 3, 4, 2, 4, 1, 2, 0, 3, 5, 3, 5, 0, 4, 6, 1, 5, 0, 4, 0,
-	0, 5, 3, 5, 2, 0, 2, 0, 6, 0, 6, 1, 6, 4, 6, 0, 5, 0, 6, 5,
-	1, 6, 4, 5, 6, 2, 6, 6, 0, 3, 1, 5, 4, 6, 2, 0, 5, 0, 1, 0,
-	2, 0, 6, 4, 1, 0, 5, 0, 2, 0, 3, 0, 5, 3, 1, 0, 5, 0, 4, 1,
-	3, 4, 5, 3, 4, 2, 0, 5, 4, 6, 4, 6, 3, 5, 3, 6, 0, 4, 2, 3,
-	4, 6, 4, 2, 6, 4, 1, 6, 2, 3, 4, 6, 3, 0, 6, 2, 0, 5, 1, 4,
-	5, 2, 0, 3, 4, 6, 4, 2, 6, 2, 0, 5, 0, 6, 2, 4, 2, 3, 0, 1,
-	6, 5, 1, 4, 6, 4, 3, 1, 6, 5, 0, 2, 5, 4, 1, 2, 1, 5, 3, 4,
-	0, 5, 1, 4, 1, 5, 1, 0, 6, 5, 6, 6, 5, 1, 2, 1, 0, 6, 1, 0,
-	1, 6, 1, 4, 2, 1, 6, 6, 3, 6, 0, 1, 1, 6, 2, 1, 2, 5, 6, 4,
-	2, 1, 0, 1, 6, 2, 6, 1, 6, 2, 5, 6, 4, 1, 5, 6, 6, 0, 3, 5,
-	3, 2, 5, 1, 0, 3, 4, 0, 4, 0, 4, 6, 2, 3, 0, 1, 3, 1, 1, 3,
-	4, 3, 1, 3, 1, 2, 3, 4, 3, 0, 1, 0, 5, 3, 0, 1, 5, 6, 2, 1,
-	5, 3, 4, 5, 1, 5, 1, 3, 6, 4, 2, 2, 0, 1, 2, 5, 1, 3, 5, 0,
-	6, 3, 6, 0, 0, 6, 2, 3, 2, 1, 5, 0, 1, 4, 3, 3, 4, 5, 3, 2,
-	0, 1, 4, 3, 4, 2, 6, 5, 6, 2, 0, 6, 1, 6, 0, 1, 6, 2, 5, 2,
-	1, 0, 6, 4, 1, 1, 6, 3, 0, 3, 0, 2, 5, 4, 2, 5, 4, 1, 3, 1,
-	2, 4, 1, 5, 4, 5, 0, 2, 3, 4, 6, 0, 6, 5, 0, 5, 1, 3, 2, 3,
-	3, 4, 6, 2, 6, 2, 1, 4, 5, 3, 1, 2, 3, 5, 6, 1, 4, 2, 5, 3,
-	4, 0, 1, 4, 6, 4, 2, 5, 1, 5, 2, 0, 1, 0, 3, 0, 1, 2, 1, 4,
-	5, 1, 6, 2, 5, 2, 3, 4, 5, 4, 6, 2, 5, 6, 5, 4, 1, 6, 5, 0,
-	6, 1, 6, 0, 4, 2, 2, 6, 3, 0, 1, 6, 5, 2, 5, 6, 2, 4, 3, 4,
-	0, 3, 0, 5, 3, 4, 1, 0, 2, 5, 3, 0, 6, 3, 1, 3, 3, 2, 0, 1,
-	1, 6, 5, 3, 0, 3, 0, 1, 1, 4, 0, 3, 4, 3, 4, 3, 1, 4, 6, 4,
-	2, 0, 5, 1, 4, 0, 5, 3, 5, 6, 4, 0, 6, 5, 1, 2, 3, 2, 0, 5,
-	3, 1, 2, 6, 4, 2, 3, 6, 2, 1, 5, 1, 3, 6, 4, 1, 4, 2, 3, 0,
-	4, 3, 6, 2, 5, 1, 3, 5, 6, 1, 2, 6, 1, 3, 4, 1, 3, 5, 0, 6,
-	5, 0, 5, 0, 5, 0, 5, 1, 4, 1, 6, 1, 4, 5, 1, 5, 0, 4, 3, 2,
-	6, 3, 2, 3, 5, 1, 4, 2, 1, 5, 3, 2, 5, 0, 5, 1, 4, 5, 6, 2,
-	0, 4, 0, 1, 0, 4, 3, 6, 4, 6, 3, 4, 0, 5, 6, 0, 6, 4, 3, 5,
-	1, 0, 3, 0, 5, 2, 4, 1, 5, 2, 0, 2, 1, 5, 6, 0, 3, 5, 3, 2,
-	2, 6, 1, 0, 3, 4, 3, 1, 5, 4, 0, 6, 2, 4, 2, 1, 0, 2, 3, 1,
-	3, 4, 5, 2, 3, 1, 2, 1, 3, 5, 0, 3, 6, 1, 6, 2, 1, 4, 3, 2,
-	4, 1, 3, 5, 3, 1, 5, 6, 4, 6, 5, 3, 2, 4, 3, 5, 2, 6, 5, 0,
-	5, 2, 0, 3, 5, 6, 6, 5, 5, 6, 3, 0, 0, 5, 2, 5, 3, 0, 1, 0,
-	6, 3, 2, 1, 1, 2, 0, 6, 0, 4, 2, 0, 2, 5, 1, 3, 6, 4, 2, 5,
-	0, 6, 3, 6, 3, 1, 0, 0, 4, 1, 4, 0, 3, 5, 0, 5, 6, 2, 5, 2,
-	1, 6, 2, 6, 1, 4, 5, 4, 3, 4, 3, 6, 4, 2, 4, 6, 2, 0, 6, 4,
-	2, 1, 5, 6, 3, 0, 4, 0, 6, 2, 5, 5, 4, 1, 2, 0, 6, 4, 2, 1,
-	3, 1, 3, 4, 4, 4, 2, 6, 3, 2, 3, 0, 3, 4, 1, 5, 4, 1, 4, 5,
-	4, 5, 1, 0, 6, 5, 4, 5, 2, 0, 4, 3, 1, 0, 6, 2, 5, 4, 3, 5,
-	5, 2, 6, 3, 2, 4, 6, 3, 0, 4, 2, 1, 3, 1, 6, 1, 5, 2, 1, 0,
-	6, 2, 3, 0, 3, 0, 3, 0, 1, 0, 5, 2, 0, 4, 2, 4, 5, 6, 5, 3,
-	0, 3, 6, 5, 1, 6, 2, 4, 5, 2, 6, 0, 2, 0, 3, 1, 1, 4, 5, 0,
-	1, 6, 0, 6, 6, 3, 1, 0, 3, 4, 1, 0, 5, 2, 3, 2, 4, 2, 6, 0,
-	2, 1, 6, 5, 2, 6, 3, 0, 3, 1, 6, 0, 6, 4, 1, 4, 1, 6, 1, 0,
-	3, 4, 0, 3, 0, 2, 0, 1, 4, 6, 1, 2, 4, 2, 0, 5, 0, 2, 0, 5,
-	4, 2, 6, 5, 1, 6, 2, 6, 1, 2, 1, 5, 2, 4, 6, 3, 5, 2, 6, 2,
-	5, 1, 5, 2, 2, 3, 6, 1, 2, 4, 2, 1, 5, 6, 1, 5, 0, 6, 3, 4,
-	6, 2, 5, 3, 6, 1, 5, 4, 1, 6, 2, 0, 1, 5, 5, 2, 5, 2, 6, 2,
-	0, 4, 4, 5, 0, 6, 2, 1, 3, 6, 4, 2, 5, 0, 2, 6, 0, 1, 5, 3,
-	1, 3, 2, 3, 6, 1, 4, 6, 0, 6, 5, 0, 1, 4, 6, 1, 4, 5, 1, 5,
-	2, 1, 2, 1, 6, 4, 0, 4, 2, 6, 5, 5, 1, 3, 1, 4, 3, 1, 3, 2,
-	3, 4, 1, 1, 0, 5, 6, 3, 1, 5, 4, 6, 3, 2, 6, 1, 3, 4, 2, 1,
-	4, 6, 1, 3, 3, 2, 0, 4, 2, 4, 2, 1, 2, 0, 4, 4, 2, 2, 6, 3,
-	5, 1, 0, 1, 3, 4, 6, 2, 2, 0, 2, 5, 4, 1, 3, 5, 6, 1, 1, 0,
-	6, 5, 2, 5, 6, 0, 2, 3, 2, 2, 0, 4, 2, 1, 5, 6, 0, 3, 6, 1,
-	0, 6, 4, 0, 1, 3, 6, 2, 2, 1, 0, 5, 0, 2, 5, 6, 3, 6, 1, 3,
-	1, 2, 1, 3, 5, 4, 1, 5, 2, 1, 3, 0, 1, 4, 5, 3, 4, 6, 1, 5,
-	2, 0, 3, 1, 4, 2, 6, 0, 4, 3, 6, 4, 2, 4, 6, 0, 6, 1, 5, 2,
-	3, 1, 6, 3, 2, 6, 0, 3, 2, 3, 0, 2, 1, 2, 6, 4, 3, 2, 0, 4,
-	4, 3, 6, 2, 6, 5, 1, 3, 3, 1, 4, 2, 4, 5, 1, 5, 3, 0, 5, 1,
-	5, 6, 3, 1, 2, 4, 0, 5, 0, 3, 6, 4, 6, 3, 3, 6, 3, 2, 2, 5,
-	6, 3, 3, 0, 6, 1, 2, 4, 0, 5, 6, 3, 4, 1, 5, 1, 3, 0, 2, 3,
-	0, 4, 5, 2, 0, 1, 5, 3, 0, 5, 2, 5, 3, 4, 5, 2, 3, 5, 5, 2,
-	1, 0, 4, 0, 5, 3, 1, 5, 0, 4, 4, 1, 6, 1, 5, 4, 6, 2, 6, 4,
-	2, 1, 3, 2, 1, 5, 2, 5, 2, 1, 4, 6, 3, 1, 3, 3, 6, 1, 4, 2,
-	3, 5, 0, 1, 3, 4, 1, 2, 3, 6, 2, 1, 1, 3, 6, 2, 3, 0, 1, 2,
-	4, 6, 4, 6, 0, 6, 3, 1, 5, 4, 3, 2, 1, 6, 2, 2, 1, 5, 3, 0,
-	5, 3, 5, 3, 1, 6, 3, 5, 0, 0, 4, 1, 6, 4, 1, 0, 0, 0, 6, 2,
-	6, 3, 1, 6, 4, 2, 6, 3, 1, 4, 3, 6, 1, 2, 0, 6, 2, 3, 1, 0,
-	0, 6, 3, 0, 5, 6, 5, 6, 6, 4, 1, 6, 5, 1, 6, 5, 2, 6, 1, 3,
-	1, 2, 4, 5, 4, 4, 3, 0, 2, 1, 4, 6, 4, 6, 1, 4, 0, 3, 0, 4,
-	2, 4, 0, 6, 0, 2, 6, 2, 5, 6, 2, 1, 1, 3, 1, 2, 6, 4, 1, 0,
-	3, 4, 6, 0, 6, 3, 2, 6, 4, 2, 3, 4, 3, 6, 5, 6, 6, 4, 0, 4,
-	4, 5, 6, 2, 3, 5, 6, 5, 6, 2, 0, 6, 3, 3, 4, 2, 5, 0, 3, 0,
-	5, 1, 2, 1, 5, 2, 0, 3, 1, 3, 4, 0, 1, 3, 0, 1, 3, 6, 4, 0,
-	6, 0, 4, 5, 4, 3, 0, 4, 0, 0, 5, 0, 1, 6, 4, 3, 2, 4, 3, 6,
-	0, 6, 5, 0, 6, 0, 4, 2, 6, 0, 5, 0, 3, 6, 6, 2, 6, 1, 4, 6,
-	1, 5, 6, 1, 6, 5, 6, 0, 3, 0, 4, 6, 0, 2, 5, 6, 0, 6, 5, 2,
-	2, 4, 2, 0, 0, 6, 0, 0, 2, 5, 6, 2, 6, 4, 5, 1, 6, 1, 0, 1,
-	3, 1, 5, 3, 6, 2, 0, 3, 3, 3, 4, 3, 0, 2, 3, 6, 1, 5, 0, 1,
-	4, 0, 1, 1, 5, 2, 0, 2, 0, 5, 3, 3, 0, 4, 1, 2, 6, 5, 4, 6,
-	5, 2, 5, 2, 5, 3, 0, 2, 3, 4, 6, 2, 4, 3, 4, 2, 1, 0, 1, 0,
-	6, 1, 4, 5, 2, 5, 2, 5, 4, 1, 5, 2, 4, 3, 2, 0, 2, 3, 2, 3,
-	0, 5, 2, 3, 6, 1, 3, 0, 6, 1, 5, 0, 5, 2, 3, 2, 1, 3, 1, 6,
-	1, 4, 2, 6, 5, 2, 0, 5, 1, 4, 2, 1, 4, 6, 0, 1, 3, 5, 6, 6,
-	2, 1, 0, 6, 3, 4, 3, 1, 0, 5, 0, 4, 6, 4, 5, 2, 4, 3, 4, 1,
-	3, 0, 0, 4, 6, 4, 3, 0, 6, 5, 0, 6, 4, 2, 1, 4, 5, 4, 2, 4,
-	4, 0, 4, 0, 6, 2, 0, 2, 5, 0, 1, 2, 6, 3, 2, 0, 3, 6, 2, 1,
-	5, 3, 6, 1, 0, 4, 2, 1, 4, 3, 6, 0, 4, 0, 1, 6, 2, 2, 4, 3,
-	6, 4, 1, 3, 2, 6, 5, 4, 1, 2, 1, 3, 0, 4, 5, 1, 0, 4, 6, 1,
-	0, 4, 0, 6, 0, 5, 6, 0, 1, 3, 1, 2, 0, 3, 5, 1, 0, 3, 2, 5,
-	1, 3, 2, 0, 5, 6, 0, 6, 6, 2, 0, 6, 1, 2, 6, 0, 1, 0, 5, 6,
-	2, 5, 1, 5, 4, 1, 3, 4, 1, 4, 5, 3, 3, 2, 3, 1, 3, 6, 3, 1,
-	3, 2, 5, 4, 2, 4, 5, 6, 3, 0, 6, 3, 4, 6, 0, 4, 3, 4, 3, 4,
-	4, 5, 2, 1, 3, 0, 6, 4, 6, 0, 6, 2, 3, 6, 0, 6, 0, 1, 2, 6,
-	5, 3, 3, 4, 1, 3, 3, 0, 2, 3, 0, 5, 2, 6, 0, 6, 5, 6, 5, 1,
-	6, 4, 2, 3, 5, 1, 3, 6, 5, 1, 3, 5, 6, 4, 5, 3, 3, 6, 1, 5,
-	0, 3, 0, 1, 0, 5, 2, 5, 1, 6, 3, 6, 5, 4, 2, 6, 3, 0, 0, 4,
-	1, 6, 0, 3, 2, 6, 2, 1, 5, 3, 0, 1, 4, 5, 0, 3, 0, 1, 0, 1,
-	2, 3, 5, 6, 2, 0, 5, 4, 0, 4, 6, 3, 2, 5, 3, 5, 2, 4, 5, 0,
-	3, 0, 2, 4, 0, 3, 2, 3, 2, 2, 1, 6, 3, 4, 3, 2, 4, 1, 3, 5,
-	4, 6, 0, 5, 0, 0, 6, 5, 2, 1, 0, 2, 6, 2, 0, 6, 4, 3, 4, 5,
-	5, 3, 6, 3, 1, 4, 3, 6, 2, 0, 2, 6, 0, 6, 4, 1, 4, 2, 5, 5,
-	6, 5, 4, 2, 0, 3, 5, 6, 2, 2, 0, 4, 2, 4, 3, 6, 4, 0, 6, 5,
-	0, 1, 6, 0, 4, 1, 0, 0, 5, 2, 6, 3, 1, 2, 1, 4, 2, 5, 0, 2,
-	1, 0, 1, 3, 6, 5, 3, 2, 4, 0, 3, 6, 0, 6, 1, 4, 0, 6, 1, 5,
-	2, 3, 3, 0, 6, 5, 4, 6, 5, 0, 5, 2, 1, 0, 2, 4, 3, 1, 4, 2,
-	3, 1, 0, 1, 0, 2, 6, 4, 3, 6, 0, 2, 1, 2, 3, 2, 1, 4, 5, 6,
-	4, 6, 5, 2, 3, 4, 5, 3, 0, 3, 4, 5, 3, 3, 6, 2, 6, 0, 4, 3,
-	5, 1, 4, 5, 6, 2, 6, 3, 4, 2, 3, 5, 3, 1, 5, 1, 0, 4, 6, 5,
-	6, 0, 2, 4, 3, 3, 5, 0, 6, 0, 3, 5, 2, 1, 2, 4, 6, 3, 6, 4,
-	0, 6, 4, 6, 3, 6, 1, 3, 6, 4, 5, 6, 3, 2, 2, 3, 2, 5, 3, 0,
-	1, 5, 2, 0, 0, 3, 5, 3, 1, 3, 2, 0, 4, 5, 1, 2, 0, 2, 3, 0,
-	2, 3, 4, 2, 4, 3, 1, 6, 2, 1, 6, 5, 4, 0, 6, 4, 0, 6, 0, 6,
-	3, 1, 0, 2, 5, 1, 4, 2, 0, 1, 1, 3, 2, 5, 4, 1, 4, 2, 4, 1,
-	4, 0, 4, 5, 0, 3, 4, 2, 0, 6, 6, 2, 6, 4, 6, 0, 6, 4, 1, 6,
-	5, 1, 3, 4, 6, 2, 0, 2, 1, 0, 3, 2, 3, 2, 4, 2, 4, 5, 2, 0,
-	6, 4, 6, 0, 2, 3, 1, 6, 1, 0, 2, 4, 1, 1, 6, 0, 1, 2, 0, 4,
-	0, 6, 1, 5, 6, 5, 2, 0, 6, 4, 3, 5, 6, 0, 2, 4, 3, 1, 4, 6,
-	1, 5, 0, 0, 4, 1, 0, 1, 0, 1, 2, 4, 0, 3, 2, 5, 0, 1, 3, 6,
-	2, 4, 3, 0, 5, 3, 0, 2, 2, 5, 6, 4, 2, 1, 4, 0, 2, 5, 3, 4,
-	3, 0, 2, 0, 1, 5, 5, 1, 6, 3, 5, 4, 5, 5, 3, 6, 1, 2, 5, 3,
-	4, 1, 3, 6, 3, 0, 2, 1, 3, 6, 3, 1, 0, 1, 0, 6, 2, 3, 5, 3,
-	5, 0, 4, 2, 0, 6, 3, 4, 6, 5, 6, 3, 4, 0, 0, 1, 2, 4, 1, 2,
-	6, 0, 2, 3, 0, 6, 3, 0, 4, 0, 0, 5, 3, 4, 3, 6, 4, 6, 2, 6,
-	0, 1, 0, 1, 5, 1, 6, 2, 3, 6, 0, 2, 3, 5, 4, 1, 4, 2, 0, 4,
-	1, 2, 4, 0, 2, 0, 6, 5, 2, 0, 2, 6, 4, 6, 2, 6, 1, 6, 2, 1,
-	2, 1, 5, 2, 3, 6, 3, 1, 6, 6, 1, 1, 4, 4, 5, 1, 2, 0, 2, 5,
-	3, 4, 3, 2, 3, 2, 0, 2, 1, 3, 1, 0, 3, 1, 3, 1, 4, 1, 2, 5,
-	4, 1, 3, 0, 1, 5, 3, 2, 4, 2, 1, 3, 3, 4, 5, 3, 3, 4, 2, 1,
-	5, 2, 1, 5, 1, 1, 2, 5, 4, 0, 4, 1, 0, 5, 3, 1, 6, 3, 5, 3,
-	6, 3, 0, 1, 3, 6, 6, 0, 6, 2, 5, 0, 1, 5, 6, 2, 6, 3, 4, 3,
-	0, 0, 5, 6, 5, 1, 4, 1, 6, 4, 6, 2, 4, 6, 5, 2, 4, 6, 5, 3,
-	1, 4, 5, 2, 3, 6, 2, 1, 4, 2, 4, 3, 2, 4, 5, 4, 2, 3, 5, 2,
-	2, 5, 5, 2, 6, 2, 5, 1, 2, 4, 5, 3, 2, 3, 5, 6, 0, 4, 6, 0,
-	3, 4, 1, 6, 3, 6, 1, 3, 2, 4, 2, 4, 3, 1, 3, 4, 2, 6, 2, 4,
-	4, 1, 6, 2, 1, 0, 0, 5, 2, 5, 3, 3, 4, 2, 6, 0, 5, 4, 0, 4,
-	5, 6, 4, 6, 3, 0, 1, 5, 0, 6, 4, 0, 4, 6, 3, 5, 5, 2, 4, 3,
-	6, 4, 2, 6, 4, 5, 5, 0, 6, 0, 4, 5, 0, 1, 6, 3, 5, 1, 0, 3,
-	0, 0, 4, 3, 1, 3, 2, 1, 2, 0, 3, 1, 2, 6, 5, 6, 0, 5, 6, 4,
-	1, 3, 3, 0, 5, 6, 6, 4, 0, 5, 0, 1, 5, 3, 0, 5, 0, 5, 0, 1,
-	2, 0, 1, 3, 0, 5, 4, 1, 4, 5, 6, 3, 3, 6, 5, 0, 6, 1, 3, 0,
-	3, 4, 3, 6, 3, 6, 3, 0, 6, 4, 5, 1, 2, 4, 1, 6, 3, 4, 4, 3,
-	4, 6, 4, 2, 0, 4, 5, 6, 2, 1, 3, 4, 5, 3, 4, 0, 1, 5, 4, 3,
-	5, 1, 5, 2, 5, 0, 3, 2, 4, 6, 1, 3, 6, 0, 2, 5, 0, 4, 0, 3,
-	6, 2, 0, 5, 0, 6, 3, 4, 0, 1, 3, 5, 3, 2, 5, 0, 1, 3, 0, 6,
-	0, 1, 0, 6, 1, 0, 1, 3, 2, 5, 2, 0, 5, 4, 5, 6, 4, 1, 0, 1,
-	1, 5, 6, 2, 1, 0, 1, 6, 5, 2, 5, 0, 2, 0, 5, 1, 5, 6, 5, 1,
-	2, 4, 3, 0, 1, 5, 0, 3, 6, 1, 4, 2, 5, 6, 4, 1, 3, 3, 6, 0,
-	3, 2, 5, 4, 1, 6, 4, 0, 1, 6, 1, 3, 6, 6, 4, 1, 3, 2, 0, 3,
-	4, 2, 1, 4, 1, 2, 0, 1, 3, 6, 0, 5, 4, 3, 4, 1, 6, 5, 2, 1,
-	5, 0, 2, 4, 6, 1, 0, 3, 4, 1, 4, 3, 5, 3, 4, 5, 2, 6, 0, 1,
-	6, 2, 0, 5, 4, 6, 2, 6, 0, 5, 6, 4, 3, 1, 6, 5, 6, 1, 1, 5,
-	0, 3, 5, 6, 0, 2, 5, 3, 2, 3, 6, 4, 3, 5, 0, 1, 2, 2, 1, 2,
-	1, 5, 4, 6, 2, 4, 6, 0, 5, 6, 2, 6, 1, 5, 2, 6, 5, 4, 5, 1,
-	2, 4, 5, 0, 5, 1, 6, 5, 1, 0, 5, 2, 4, 3, 5, 6, 4, 3, 0, 3,
-	3, 5, 2, 5, 4, 2, 4, 6, 4, 3, 6, 1, 4, 1, 0, 5, 5, 1, 4, 1,
-	4, 1, 3, 5, 6, 3, 3, 0, 4, 0, 5, 1, 3, 4, 6, 2, 1, 0, 6, 2,
-	5, 2, 3, 0, 2, 3, 2, 4, 6, 0, 4, 1, 5, 2, 3, 0, 4, 5, 0, 4,
-	6, 0, 5, 2, 0, 5, 2, 0, 5, 6, 2, 1, 0, 3, 4, 6, 0, 6, 4, 1,
-	0, 5, 4, 6, 1, 3, 1, 0, 6, 5, 3, 2, 2, 0, 3, 5, 1, 1, 0, 3,
-	1, 4, 0, 1, 0, 2, 6, 5, 3, 1, 3, 0, 6, 6, 2, 4, 0, 4, 0, 3,
-	2, 6, 3, 3, 1, 6, 4, 0, 4, 3, 0, 6, 2, 6, 3, 4, 1, 5, 2, 5,
-	3, 6, 4, 0, 2, 2, 1, 3, 1, 4, 0, 4, 2, 1, 5, 6, 3, 5, 2, 2,
-	4, 3, 4, 2, 4, 5, 1, 0, 4, 2, 0, 1, 6, 1, 1, 6, 5, 2, 4, 6,
-	5, 5, 4, 6, 0, 1, 6, 6, 2, 0, 3, 0, 6, 0, 6, 3, 0, 2, 3, 5,
-	6, 3, 5, 2, 5, 2, 4, 5, 2, 6, 1, 2, 3, 6, 2, 1, 4, 6, 2, 1,
-	0, 6, 1, 0, 3, 0, 2, 3, 1, 2, 0, 5, 1, 0, 0, 0, 1, 5, 1, 5,
-	1, 5, 1, 3, 4, 6, 3, 6, 1, 0, 6, 5, 4, 5, 4, 2, 3, 2, 0, 6,
-	2, 6, 2, 0, 0, 6, 4, 1, 5, 6, 0, 1, 5, 4, 2, 6, 0, 5, 0, 4,
-	3, 3, 4, 5, 2, 1, 2, 5, 0, 5, 6, 1, 5, 1, 3, 6, 0, 3, 1, 1,
-	4, 1, 6, 5, 3, 1, 4, 2, 2, 6, 3, 0, 6, 3, 5, 0, 1, 6, 3, 4,
-	5, 3, 1, 5, 1, 0, 5, 1, 0, 3, 6, 6, 5, 3, 1, 6, 5, 2, 6, 2,
-	6, 1, 0, 5, 1, 4, 1, 0, 6, 4, 6, 4, 2, 0, 6, 1, 2, 1, 5, 1,
-	0, 1, 2, 6, 3, 2, 4, 1, 3, 4, 2, 1, 0, 1, 4, 1, 3, 0, 6, 2,
-	1, 4, 0, 1, 3, 6, 6, 1, 4, 1, 2, 1, 6, 2, 5, 0, 4, 2, 0, 3,
-	2, 4, 3, 2, 0, 3, 4, 2, 5, 1, 1, 1, 6, 2, 1, 5, 4, 3, 5, 0,
-	3, 5, 3, 4, 1, 0, 1, 0, 6, 0, 3, 4, 1, 2, 1, 6, 1, 6, 1, 6,
-	4, 3, 6, 3, 6, 4, 1, 3, 2, 5, 4, 0, 4, 6, 3, 3, 1, 0, 4, 0,
-	5, 0, 5, 2, 2, 5, 0, 3, 6, 5, 0, 1, 6, 4, 4, 3, 4, 3, 6, 4,
-	6, 6, 5, 2, 3, 4, 3, 1, 5, 2, 1, 0, 2, 0, 4, 5, 6, 0, 2, 0,
-	0, 1, 4, 6, 4, 1, 3, 6, 6, 3, 3, 5, 3, 6, 2, 0, 1, 0, 3, 1,
-	1, 3, 5, 4, 1, 4, 0, 4, 3, 2, 1, 1, 4, 6, 1, 5, 2, 3, 4, 0,
-	2, 6, 1, 2, 4, 0, 5, 1, 3, 4, 1, 0, 3, 2, 1, 5, 3, 0, 2, 3,
-	3, 2, 4, 3, 6, 4, 0, 2, 1, 3, 4, 6, 4, 3, 2, 1, 2, 5, 1, 3,
-	4, 0, 4, 6, 3, 1, 0, 6, 2, 4, 6, 0, 3, 3, 4, 3, 0, 2, 0, 4,
-	5, 2, 6, 0, 5, 3, 2, 4, 2, 0, 2, 5, 2, 4, 0, 2, 5, 6, 4, 6,
-	6, 3, 3, 2, 6, 3, 2, 5, 2, 4, 0, 3, 6, 5, 0, 1, 2, 1, 6, 3,
-	0, 5, 4, 6, 2, 5, 3, 1, 5, 4, 2, 3, 5, 2, 5, 6, 0, 6, 3, 1,
-	1, 1, 2, 4, 1, 1, 3, 6, 1, 3, 4, 2, 2, 2, 4, 3, 0, 3, 4, 0,
-	2, 6, 0, 3, 1, 6, 3, 6, 1, 1, 2, 6, 1, 3, 6, 2, 4, 0, 1, 0,
-	3, 1, 2, 2, 4, 2, 0, 4, 6, 1, 5, 3, 3, 0, 6, 3, 3, 5, 4, 2,
-	4, 1, 1, 6, 0, 6, 4, 6, 5, 0, 1, 3, 0, 5, 2, 0, 5, 0, 6, 1,
-	5, 4, 5, 4, 0, 6, 3, 2, 1, 4, 3, 6, 3, 4, 6, 5, 6, 5, 6, 2,
-	6, 4, 5, 1, 0, 5, 0, 1, 2, 4, 3, 2, 5, 4, 1, 0, 4, 3, 5, 5,
-	0, 2, 5, 2, 3, 0, 5, 6, 1, 2, 4, 3, 1, 0, 1, 2, 5, 6, 2, 3,
-	1, 4, 3, 4, 3, 4, 2, 4, 0, 4, 3, 5, 0, 2, 0, 4, 5, 1, 6, 0,
-	2, 3, 6, 5, 2, 1, 5, 4, 6, 1, 2, 1, 2, 5, 1, 4, 0, 3, 6, 0,
-	3, 2, 4, 5, 3, 6, 4, 0, 4, 3, 4, 3, 0, 4, 3, 4, 2, 1, 5, 5,
-	4, 3, 0, 5, 3, 4, 0, 4, 1, 3, 5, 4, 2, 0, 6, 0, 1, 4, 0, 1,
-	5, 1, 2, 5, 4, 4, 1, 3, 1, 3, 5, 1, 4, 3, 1, 5, 0, 1, 5, 5,
-	6, 1, 3, 2, 3, 0, 4, 6, 0, 3, 6, 5, 0, 1, 0, 3, 2, 5, 1, 5,
-	0, 1, 3, 1, 0, 4, 4, 5, 1, 5, 1, 4, 2, 2, 1, 4, 3, 0, 2, 0,
-	1, 6, 6, 2, 4, 6, 2, 2, 0, 1, 5, 6, 1, 3, 2, 0, 1, 3, 2, 5,
-	2, 0, 1, 6, 0, 6, 4, 5, 3, 4, 0, 6, 3, 2, 0, 6, 3, 5, 1, 4,
-	3, 3, 1, 3, 1, 6, 1, 5, 2, 6, 4, 0, 3, 0, 1, 0, 2, 1, 3, 0,
-	4, 0, 4, 1, 3, 6, 3, 1, 6, 2, 5, 1, 2, 0, 4, 2, 0, 0, 1, 5,
-	5, 2, 1, 6, 1, 4, 5, 2, 5, 0, 4, 3, 0, 4, 6, 5, 4, 2, 5, 6,
-	6, 2, 0, 3, 6, 6, 1, 5, 6, 1, 2, 5, 2, 5, 6, 0, 6, 1, 2, 3,
-	0, 6, 1, 5, 4, 6, 3, 5, 0, 5, 5, 2, 5, 6, 5, 6, 2, 6, 0, 3,
-	1, 6, 4, 6, 0, 2, 1, 0, 3, 0, 5, 2, 1, 5, 2, 3, 2, 1, 4, 3,
-	2, 5, 1, 4, 0, 4, 5, 2, 0, 3, 4, 6, 6, 1, 3, 0, 2, 6, 0, 5,
-	3, 0, 6, 3, 4, 1, 5, 1, 5, 3, 0, 6, 4, 3, 4, 6, 2, 3, 0, 2,
-	4, 6, 3, 6, 5, 1, 0, 3, 4, 3, 1, 5, 4, 0, 3, 0, 3, 6, 0, 6,
-	5, 0, 2, 4, 2, 1, 5, 6, 0, 6, 5, 6, 3, 5, 3, 5, 6, 2, 1, 4,
-	6, 3, 1, 3, 2, 4, 1, 6, 4, 0, 3, 4, 0, 6, 0, 5, 3, 1, 1, 2,
-	0, 6, 0, 5, 6, 0, 6, 4, 2, 4, 6, 2, 0, 3, 6, 3, 2, 0, 4, 3,
-	1, 0, 6, 3, 4, 1, 6, 5, 2, 0, 6, 3, 3, 2, 4, 5, 0, 2, 3, 4,
-	2, 5, 2, 4, 1, 4, 5, 1, 5, 0, 3, 3, 0, 6, 1, 4, 2, 0, 1, 3,
-	3, 5, 1, 6, 2, 0, 5, 1, 6, 5, 0, 3, 5, 3, 5, 0, 6, 3, 2, 3,
-	4, 3, 1, 5, 4, 0, 5, 3, 1, 5, 2, 0, 1, 1, 4, 5, 3, 4, 2, 3,
-	5, 4, 1, 0, 4, 0, 1, 4, 1, 5, 0, 4, 6, 4, 1, 5, 4, 3, 4, 2,
-	6, 1, 6, 4, 3, 6, 2, 5, 4, 3, 6, 0, 6, 4, 1, 5, 3, 1, 0, 1,
-	0, 3, 3, 4, 5, 0, 1, 0, 6, 6, 5, 6, 3, 4, 5, 6, 1, 6, 3, 4,
-	1, 4, 2, 1, 2, 6, 4, 0, 3, 5, 1, 5, 6, 0, 6, 2, 4, 1, 0, 3,
-	2, 4, 0, 4, 5, 4, 5, 1, 0, 5, 6, 2, 0, 6, 1, 5, 1, 3, 2, 3,
-	3, 4, 1, 5, 3, 6, 4, 3, 4, 1, 6, 1, 4, 6, 1, 3, 2, 5, 6, 1,
-	4, 3, 6, 3, 0, 1, 6, 5, 4, 2, 4, 0, 6, 1, 5, 3, 0, 3, 0, 2,
-	5, 1, 3, 2, 2, 2, 4, 3, 1, 4, 1, 5, 3, 5, 2, 5, 4, 5, 1, 2,
-	6, 2, 1, 0, 2, 2, 1, 4, 5, 1, 3, 1, 2, 5, 6, 3, 0, 6, 1, 5,
-	0, 1, 0, 2, 6, 3, 0, 3, 4, 1, 2, 1, 5, 6, 0, 1, 0, 3, 2, 1,
-	1, 3, 2, 4, 0, 5, 2, 0, 6, 0, 6, 5, 1, 3, 1, 4, 5, 3, 1, 4,
-	2, 0, 6, 2, 5, 2, 5, 0, 4, 6, 3, 2, 0, 5, 0, 0, 1, 1, 0, 6,
-	3, 0, 1, 5, 0, 2, 6, 3, 4, 2, 1, 5, 3, 0, 6, 3, 4, 6, 1, 2,
-	4, 2, 0, 4, 1, 2, 1, 0, 6, 5, 3, 6, 3, 6, 2, 0, 1, 2, 1, 2,
-	5, 3, 4, 1, 3, 6, 0, 4, 0, 1, 3, 1, 2, 5, 4, 5, 1, 5, 4, 0,
-	6, 0, 2, 6, 0, 5, 0, 5, 3, 5, 4, 5, 4, 2, 6, 4, 6, 6, 5, 5,
-	0, 3, 1, 5, 1, 3, 4, 1, 1, 5, 2, 3, 5, 1, 3, 0, 1, 3, 5, 1,
-	1, 5, 2, 0, 6, 0, 4, 0, 3, 6, 1, 0, 5, 3, 1, 6, 2, 3, 2, 5,
-	2, 2, 2, 4, 2, 6, 3, 1, 4, 1, 5, 3, 2, 4, 1, 6, 4, 6, 2, 4,
-	3, 4, 3, 0, 4, 1, 5, 2, 5, 4, 1, 2, 0, 4, 6, 5, 3, 0, 5, 4,
-	4, 1, 4, 6, 0, 6, 2, 6, 4, 2, 6, 4, 3, 2, 5, 3, 0, 2, 5, 4,
-	5, 5, 6, 3, 2, 0, 6, 5, 4, 0, 2, 2, 5, 3, 4, 1, 0, 0, 3, 5,
-	6, 2, 3, 1, 4, 6, 1, 1, 0, 5, 6, 3, 0, 6, 2, 5, 1, 2, 6, 1,
-	0, 5, 6, 2, 5, 1, 2, 4, 2, 0, 1, 6, 4, 3, 6, 2, 1, 3, 6, 6,
-	1, 1, 6, 4, 3, 4, 1, 6, 4, 0, 6, 4, 3, 4, 2, 1, 4, 3, 2, 5,
-	2, 3, 5, 2, 1, 3, 5, 1, 1, 3, 4, 4, 0, 4, 3, 5, 2, 2, 4, 2,
-	3, 5, 1, 4, 2, 3, 5, 4, 1, 3, 1, 5, 4, 1, 6, 2, 0, 1, 4, 1,
-	4, 5, 0, 3, 4, 2, 5, 1, 4, 2, 4, 1, 5, 4, 1, 0, 5, 2, 0, 1,
-	5, 3, 5, 3, 6, 5, 6, 4, 1, 0, 1, 6, 2, 0, 5, 6, 1, 6, 1, 4,
-	6, 2, 1, 2, 6, 1, 0, 1, 3, 4, 5, 2, 3, 6, 5, 2, 0, 4, 4, 6,
-	0, 6, 3, 1, 2, 4, 5, 1, 3, 5, 0, 1, 4, 2, 4, 1, 4, 2, 1, 2,
-	1, 4, 3, 6, 0, 6, 1, 4, 3, 5, 4, 0, 2, 6, 5, 0, 2, 3, 0, 3,
-	2, 0, 2, 3, 0, 5, 4, 0, 5, 0, 3, 0, 2, 6, 2, 5, 1, 0, 3, 2,
-	3, 2, 6, 6, 2, 5, 6, 1, 1, 5, 0, 4, 3, 5, 4, 0, 2, 1, 6, 6,
-	4, 5, 3, 0, 4, 0, 5, 6, 2, 5, 3, 3, 4, 2, 1, 3, 6, 2, 0, 1,
-	5, 3, 5, 4, 2, 4, 2, 4, 3, 6, 3, 6, 2, 5, 0, 3, 2, 4, 3, 4,
-	6, 5, 4, 5, 6, 1, 6, 0, 3, 3, 0, 1, 6, 3, 4, 3, 1, 1, 4, 2,
-	0, 6, 4, 6, 2, 3, 0, 3, 1, 2, 4, 0, 5, 3, 2, 6, 4, 0, 4, 2,
-	1, 4, 3, 6, 1, 1, 4, 3, 4, 6, 1, 3, 1, 3, 2, 6, 1, 2, 5, 3,
-	2, 5, 6, 1, 4, 3, 4, 0, 2, 6, 1, 0, 1, 2, 1, 5, 6, 0, 1, 0,
-	3, 6, 5, 1, 4, 1, 1, 0, 6, 5, 2, 0, 5, 6, 1, 4, 6, 1, 5, 0,
-	4, 0, 5, 3, 6, 2, 5, 0, 5, 2, 4, 6, 0, 5, 0, 2, 0, 2, 0, 2,
-	5, 4, 0, 4, 0, 0, 6, 1, 5, 3, 2, 0, 6, 5, 0, 5, 0, 4, 4, 1,
-	6, 0, 2, 3, 0, 5, 4, 2, 0, 6, 3, 6, 3, 4, 1, 5, 1, 6, 1, 6,
-	0, 2, 3, 1, 6, 2, 5, 4, 1, 3, 0, 4, 2, 4, 1, 5, 4, 5, 1, 0,
-	1, 4, 3, 4, 0, 3, 4, 3, 0, 5, 5, 1, 3, 6, 4, 2, 5, 2, 0, 3,
-	2, 0, 6, 5, 4, 6, 4, 0, 4, 3, 4, 0, 1, 5, 1, 0, 6, 5, 1, 2,
-	3, 0, 2, 0, 3, 2, 6, 5, 0, 4, 5, 0, 3, 6, 3, 6, 1, 4, 3, 5,
-	4, 4, 1, 6, 3, 2, 6, 5, 6, 2, 6, 2, 0, 2, 5, 4, 3, 4, 2, 2,
-	5, 4, 1, 3, 0, 4, 3, 6, 5, 2, 3, 3, 4, 1, 1, 3, 2, 3, 1, 6,
-	6, 4, 0, 1, 6, 0, 4, 0, 6, 5, 1, 5, 2, 6, 0, 1, 3, 2, 4, 6,
-	0, 5, 2, 6, 4, 6, 4, 5, 0, 4, 3, 0, 3, 1, 5, 3, 2, 3, 6, 0,
-	1, 2, 5, 6, 3, 0, 4, 6, 1, 6, 0, 6, 1, 6, 3, 2, 0, 2, 3, 4,
-	2, 3, 6, 3, 5, 4, 0, 5, 2, 6, 5, 1, 2, 5, 6, 1, 6, 4, 1, 2,
-	3, 6, 4, 6, 6, 4, 5, 3, 0, 5, 1, 5, 4, 5, 1, 5, 3, 2, 4, 5,
-	4, 0, 3, 2, 0, 6, 3, 2, 6, 3, 3, 0, 3, 0, 3, 4, 2, 5, 1, 0,
-	5, 2, 0, 6, 4, 4, 1, 2, 5, 6, 1, 4, 5, 3, 1, 0, 6, 0, 3, 5,
-	6, 5, 2, 3, 4, 6, 2, 3, 1, 0, 2, 5, 4, 5, 0, 4, 2, 2, 4, 1,
-	0, 3, 4, 2, 4, 5, 4, 0, 3, 5, 4, 0, 2, 4, 2, 1, 0, 2, 1, 0,
-	1, 5, 1, 0, 5, 5, 1, 4, 2, 6, 2, 6, 4, 3, 6, 5, 5, 4, 3, 4,
-	2, 0, 2, 1, 3, 1, 3, 4, 0, 6, 1, 4, 6, 4, 4, 2, 4, 0, 1, 6,
-	3, 2, 3, 0, 1, 4, 1, 3, 0, 6, 3, 6, 3, 5, 0, 4, 2, 4, 2, 6,
-	4, 5, 6, 4, 6, 4, 0, 3, 0, 4, 0, 4, 6, 4, 0, 5, 4, 5, 2, 0,
-	5, 6, 0, 3, 2, 5, 6, 4, 4, 3, 2, 0, 6, 2, 0, 5, 2, 4, 3, 5,
-	6, 2, 4, 0, 5, 2, 4, 1, 6, 0, 5, 4, 0, 5, 3, 0, 3, 2, 4, 0,
-	0, 1, 2, 0, 2, 5, 4, 5, 2, 3, 0, 1, 0, 5, 1, 4, 0, 4, 5, 2,
-	1, 3, 6, 3, 2, 3, 2, 1, 1, 4, 3, 0, 3, 6, 0, 2, 5, 6, 1, 5,
-	2, 1, 6, 4, 5, 1, 4, 5, 1, 1, 5, 0, 6, 5, 6, 3, 4, 0, 3, 2,
-	3, 2, 4, 1, 3, 4, 3, 4, 5, 6, 3, 6, 4, 1, 5, 4, 3, 0, 5, 3,
-	4, 5, 2, 0, 3, 4, 4, 6, 3, 5, 1, 5, 5, 1, 0, 5, 0, 1, 0, 4,
-	5, 1, 6, 0, 5, 0, 4, 0, 3, 4, 3, 6, 0, 3, 5, 0, 5, 2, 4, 1,
-	6, 6, 5, 1, 2, 3, 5, 1, 0, 5, 0, 3, 1, 6, 2, 4, 2, 3, 6, 3,
-	0, 6, 2, 5, 1, 6, 4, 5, 6, 4, 5, 0, 1, 6, 1, 5, 1, 4, 3, 1,
-	1, 2, 5, 2, 3, 4, 0, 5, 1, 4, 3, 5, 2, 3, 1, 3, 1, 5, 4, 5,
-	2, 6, 5, 4, 5, 3, 5, 0, 6, 1, 2, 1, 0, 6, 4, 3, 6, 0, 6, 6,
-	3, 4, 2, 0, 2, 4, 5, 0, 2, 5, 4, 0, 4, 3, 6, 4, 0, 5, 1, 5,
-	4, 3, 2, 0, 3, 1, 3, 5, 1, 5, 1, 5, 4, 0, 3, 6, 1, 3, 1, 6,
-	5, 1, 0, 6, 1, 4, 1, 4, 5, 3, 2, 3, 5, 2, 5, 4, 1, 4, 2, 3,
-	6, 3, 1, 0, 4, 3, 6, 5, 1, 2, 6, 5, 6, 4, 3, 4, 6, 4, 2, 0,
-	0, 6, 1, 0, 4, 2, 5, 6, 3, 2, 3, 3, 2, 4, 3, 5, 1, 5, 3, 5,
-	1, 0, 6, 4, 1, 3, 0, 4, 3, 0, 3, 0, 3, 1, 6, 0, 1, 2, 3, 2,
-	2, 0, 2, 1, 5, 6, 3, 6, 3, 5, 1, 5, 4, 2, 1, 2, 4, 5, 1, 5,
-	3, 3, 5, 2, 4, 6, 2, 1, 0, 5, 3, 4, 1, 3, 0, 5, 2, 0, 2, 5,
-	4, 1, 5, 3, 4, 1, 2, 4, 3, 5, 3, 3, 1, 4, 6, 5, 2, 5, 1, 0,
-	5, 2, 2, 5, 2, 6, 1, 4, 2, 1, 4, 2, 5, 1, 3, 5, 1, 6, 3, 6,
-	6, 5, 0, 2, 3, 5, 2, 1, 2, 0, 3, 4, 5, 0, 6, 3, 6, 2, 0, 6,
-	0, 5, 6, 3, 4, 2, 6, 3, 5, 6, 1, 4, 0, 6, 1, 2, 0, 1, 2, 5,
-	1, 0, 3, 0, 1, 2, 5, 0, 2, 6, 1, 3, 0, 0, 5, 5, 4, 5, 3, 0,
-	2, 6, 3, 0, 2, 0, 4, 1, 1, 6, 2, 3, 1, 1, 4, 6, 2, 1, 0, 4,
-	3, 5, 4, 2, 6, 0, 5, 3, 2, 6, 1, 4, 1, 5, 3, 0, 5, 0, 3, 5,
-	4, 4, 3, 6, 0, 1, 6, 5, 6, 2, 2, 1, 3, 1, 3, 5, 2, 1, 5, 1,
-	5, 0, 6, 3, 5, 4, 5, 1, 0, 6, 2, 5, 4, 4, 3, 4, 3, 0, 1, 4,
-	6, 3, 6, 0, 2, 3, 5, 1, 0, 6, 3, 4, 2, 4, 1, 2, 3, 0, 3, 2,
-	0, 1, 2, 6, 1, 2, 6, 3, 0, 4, 5, 6, 5, 6, 0, 2, 5, 2, 4, 3,
-	1, 0, 3, 4, 6, 0, 4, 2, 0, 5, 4, 3, 6, 4, 2, 4, 3, 6, 4, 6,
-	2, 1, 6, 5, 4, 5, 3, 1, 0, 1, 5, 1, 0, 0, 5, 6, 5, 0, 2, 5,
-	3, 5, 3, 0, 5, 4, 3, 0, 6, 2, 0, 1, 2, 2, 4, 1, 4, 6, 5, 6,
-	4, 1, 4, 2, 5, 6, 5, 0, 2, 1, 0, 1, 2, 2, 6, 1, 6, 3, 4, 5,
-	5, 1, 6, 2, 5, 4, 0, 1, 2, 4, 5, 3, 5, 6, 4, 0, 2, 5, 6, 4,
-	6, 3, 5, 1, 6, 2, 6, 1, 3, 5, 4, 6, 4, 6, 5, 3, 3, 6, 2, 6,
-	0, 6, 3, 1, 6, 2, 5, 3, 2, 0, 3, 5, 2, 6, 0, 1, 3, 4, 3, 6,
-	1, 4, 6, 2, 3, 4, 5, 4, 0, 2, 2, 1, 6, 5, 3, 2, 4, 3, 1, 4,
-	2, 4, 3, 5, 0, 3, 2, 5, 3, 4, 2, 1, 6, 2, 0, 4, 3, 0, 6, 3,
-	3, 5, 0, 6, 1, 2, 6, 3, 2, 0, 5, 0, 6, 4, 6, 2, 1, 6, 1, 0,
-	4, 6, 1, 1, 5, 6, 4, 3, 3, 5, 6, 4, 6, 2, 6, 5, 0, 1, 2, 3,
-	5, 3, 6, 2, 4, 2, 5, 1, 5, 2, 6, 5, 2, 4, 1, 4, 0, 3, 2, 5,
-	6, 0, 4, 1, 0, 6, 3, 5, 2, 5, 4, 1, 2, 6, 5, 1, 5, 1, 0, 3,
-	0, 4, 3, 2, 0, 4, 5, 4, 3, 2, 1, 0, 1, 5, 1, 5, 6, 1, 2, 1,
-	1, 6, 0, 6, 1, 4, 1, 5, 2, 5, 0, 6, 4, 6, 3, 0, 6, 4, 1, 3,
-	2, 6, 1, 4, 0, 0, 4, 2, 5, 6, 1, 0, 2, 1, 0, 5, 1, 4, 0, 1,
-	3, 1, 3, 1, 5, 3, 5, 0, 3, 5, 1, 2, 3, 2, 1, 3, 0, 3, 3, 2,
-	4, 3, 4, 5, 0, 3, 4, 5, 2, 0, 3, 6, 5, 3, 5, 4, 6, 5, 3, 2,
-	5, 0, 6, 5, 1, 2, 0, 4, 1, 5, 2, 1, 0, 2, 3, 4, 0, 4, 6, 3,
-	6, 0, 2, 0, 2, 4, 5, 2, 5, 1, 6, 4, 2, 5, 3, 0, 3, 6, 5, 6,
-	0, 5, 4, 4, 4, 2, 0, 4, 2, 5, 4, 2, 6, 0, 1, 6, 2, 6, 1, 1,
-	1, 4, 0, 2, 3, 5, 4, 4, 6, 4, 5, 1, 0, 4, 6, 5, 2, 3, 0, 5,
-	2, 6, 3, 3, 4, 2, 6, 4, 6, 1, 0, 3, 1, 6, 1, 0, 5, 6, 3, 0,
-	3, 1, 5, 1, 3, 4, 6, 0, 4, 3, 6, 0, 6, 2, 4, 3, 2, 1, 5, 4,
-	4, 6, 2, 4, 1, 6, 5, 2, 0, 2, 6, 5, 0, 2, 1, 3, 4, 0, 3, 0,
-	5, 2, 3, 5, 3, 4, 6, 2, 6, 1, 5, 3, 6, 5, 0, 2, 0, 4, 1, 2,
-	6, 0, 3, 4, 5, 5, 2, 1, 3, 1, 4, 6, 1, 0, 1, 4, 3, 6, 5, 5,
-	0, 5, 1, 2, 5, 2, 6, 5, 4, 0, 3, 0, 5, 1, 5, 0, 5, 6, 4, 5,
-	1, 2, 6, 2, 3, 5, 6, 1, 0, 6, 2, 3, 6, 2, 3, 1, 2, 3, 2, 4,
-	2, 1, 5, 6, 4, 2, 0, 3, 5, 4, 5, 6, 5, 1, 3, 5, 6, 3, 6, 2,
-	3, 0, 1, 6, 1, 5, 3, 2, 0, 1, 2, 6, 3, 2, 5, 5, 2, 3, 4, 3,
-	4, 0, 4, 1, 5, 0, 6, 1, 5, 1, 5, 2, 6, 5, 1, 5, 4, 6, 2, 6,
-	5, 2, 4, 5, 1, 5, 3, 2, 4, 6, 3, 6, 0, 6, 3, 4, 3, 1, 2, 1,
-	6, 3, 4, 1, 2, 6, 2, 4, 0, 4, 6, 1, 6, 3, 4, 1, 4, 5, 3, 5,
-	0, 1, 0, 3, 5, 0, 5, 2, 4, 2, 0, 4, 3, 4, 0, 3, 6, 3, 2, 4,
-	1, 3, 6, 3, 2, 4, 0, 1, 6, 2, 5, 0, 1, 1, 5, 0, 4, 0, 2, 5,
-	2, 1, 1, 5, 0, 3, 5, 4, 1, 4, 0, 1, 4, 4, 1, 0, 4, 2, 0, 3,
-	3, 0, 4, 6, 2, 3, 5, 0, 5, 5, 2, 6, 0, 4, 3, 6, 4, 1, 3, 2,
-	4, 0, 1, 2, 1, 4, 1, 1, 3, 5, 6, 5, 2, 6, 1, 6, 4, 2, 3, 5,
-	5, 4, 6, 0, 1, 2, 3, 6, 5, 2, 1, 6, 3, 0, 1, 0, 5, 0, 3, 6,
-	6, 0, 5, 1, 4, 5, 4, 2, 5, 1, 2, 1, 3, 5, 4, 1, 3, 2, 3, 4,
-	0, 6, 3, 6, 4, 3, 4, 3, 4, 2, 0, 5, 3, 0, 1, 6, 4, 5, 1, 3,
-	1, 6, 2, 6, 5, 6, 0, 1, 0, 6, 1, 2, 6, 5, 1, 4, 6, 3, 3, 3,
-	2, 3, 4, 5, 1, 2, 1, 3, 1, 2, 3, 2, 4, 2, 2, 4, 0, 3, 2, 0,
-	3, 2, 4, 1, 6, 4, 5, 2, 4, 1, 5, 2, 4, 0, 6, 0, 4, 6, 1, 0,
-	4, 0, 6, 4, 6, 3, 6, 1, 2, 0, 5, 1, 0, 5, 1, 5, 3, 1, 3, 1,
-	5, 2, 1, 0, 3, 1, 6, 5, 3, 1, 0, 5, 3, 2, 1, 6, 5, 1, 6, 1,
-	6, 2, 0, 6, 1, 4, 1, 6, 3, 1, 5, 3, 1, 3, 5, 6, 3, 1, 4, 0,
-	0, 6, 0, 6, 2, 4, 2, 4, 6, 1, 6, 4, 0, 2, 0, 6, 1, 4, 3, 0,
-	1, 3, 0, 2, 5, 1, 5, 4, 3, 1, 3, 4, 6, 1, 0, 6, 1, 4, 6, 3,
-	2, 1, 3, 5, 6, 1, 4, 5, 0, 5, 3, 2, 5, 6, 2, 3, 3, 2, 3, 1,
-	3, 3, 1, 2, 4, 2, 5, 6, 3, 2, 6, 5, 5, 1, 6, 1, 5, 2, 4, 2,
-	4, 6, 3, 0, 4, 0, 6, 4, 2, 4, 0, 3, 0, 3, 3, 6, 5, 6, 4, 2,
-	5, 2, 5, 4, 3, 6, 3, 1, 4, 3, 5, 2, 3, 6, 0, 2, 0, 4, 6, 3,
-	6, 0, 4, 6, 1, 2, 0, 1, 5, 4, 6, 2, 0, 6, 3, 5, 3, 5, 0, 5,
-	0, 3, 2, 4, 0, 4, 3, 1, 3, 4, 6, 0, 2, 5, 2, 1, 2, 6, 2, 3,
-	1, 5, 2, 1, 2, 3, 2, 4, 1, 3, 5, 2, 5, 3, 6, 2, 4, 4, 6, 6,
-	2, 1, 0, 3, 0, 3, 6, 2, 3, 4, 0, 4, 4, 6, 4, 0, 5, 6, 3, 2,
-	3, 4, 0, 1, 5, 6, 1, 3, 6, 3, 2, 1, 0, 3, 5, 6, 5, 2, 5, 6,
-	4, 1, 5, 4, 0, 0, 2, 4, 0, 3, 6, 5, 1, 0, 6, 0, 6, 5, 1, 2,
-	5, 6, 5, 6, 4, 5, 1, 3, 4, 6, 1, 1, 2, 2, 0, 5, 1, 0, 6, 4,
-	6, 5, 0, 5, 0, 4, 5, 1, 5, 1, 6, 0, 5, 4, 3, 5, 2, 6, 0, 6,
-	0, 0, 3, 3, 4, 0, 3, 2, 3, 1, 0, 2, 4, 5, 1, 3, 1, 2, 4, 3,
-	1, 3, 5, 6, 2, 0, 5, 1, 5, 0, 5, 0, 5, 2, 0, 2, 1, 3, 1, 6,
-	2, 0, 6, 0, 3, 6, 5, 2, 3, 2, 4, 5, 1, 6, 2, 0, 3, 4, 3, 5,
-	3, 1, 6, 2, 3, 2, 5, 0, 5, 0, 5, 4, 1, 5, 6, 3, 6, 2, 4, 3,
-	4, 3, 2, 3, 5, 4, 2, 3, 1, 4, 3, 4, 3, 5, 1, 2, 3, 2, 4, 5,
-	5, 6, 3, 0, 2, 0, 4, 5, 1, 2, 2, 1, 0, 3, 1, 2, 1, 3, 1, 4,
-	6, 3, 1, 3, 1, 1, 1, 3, 2, 1, 0, 1, 0, 5, 2, 4, 5, 3, 5, 2,
-	0, 2, 6, 3, 5, 3, 5, 3, 2, 5, 2, 0, 1, 6, 2, 1, 3, 1, 3, 6,
-	1, 2, 5, 4, 3, 1, 6, 1, 5, 1, 5, 6, 5, 4, 1, 0, 1, 5, 1, 2,
-	2, 1, 5, 1, 2, 1, 5, 6, 0, 5, 1, 0, 3, 5, 1, 1, 5, 4, 1, 1,
-	3, 6, 0, 2, 4, 3, 5, 3, 4, 5, 0, 2, 5, 0, 4, 1, 3, 0, 2, 1,
-	4, 6, 2, 6, 1, 5, 6, 2, 1, 4, 5, 0, 2, 6, 0, 5, 2, 5, 6, 5,
-	5, 0, 6, 2, 6, 6, 2, 0, 6, 0, 5, 6, 4, 0, 2, 1, 0, 4, 6, 3,
-	6, 3, 4, 6, 0, 3, 0, 5, 4, 0, 1, 5, 2, 1, 6, 2, 3, 5, 0, 3,
-	0, 6, 5, 2, 4, 5, 3, 2, 1, 4, 3, 2, 3, 6, 0, 1, 1, 0, 5, 1,
-	1, 2, 4, 3, 2, 0, 2, 4, 3, 6, 2, 2, 6, 0, 1, 5, 0, 1, 6, 5,
-	2, 0, 3, 2, 3, 3, 4, 2, 0, 1, 0, 3, 3, 2, 4, 0, 3, 1, 6, 3,
-	3, 0, 6, 1, 3, 4, 6, 4, 1, 2, 3, 3, 4, 5, 3, 6, 3, 4, 0, 5,
-	4, 2, 0, 2, 0, 4, 3, 5, 0, 5, 1, 5, 1, 5, 6, 2, 4, 0, 3, 5,
-	5, 6, 2, 0, 5, 6, 3, 0, 6, 2, 1, 4, 2, 0, 2, 6, 0, 4, 6, 1,
-	6, 2, 0, 4, 5, 6, 1, 1, 2, 6, 4, 5, 4, 5, 1, 2, 1, 3, 0, 6,
-	0, 4, 5, 4, 2, 1, 6, 2, 4, 5, 2, 1, 1, 4, 5, 4, 2, 4, 6, 0,
-	1, 4, 2, 2, 0, 4, 6, 3, 0, 1, 0, 5, 1, 4, 2, 6, 2, 0, 3, 0,
-	2, 1, 6, 3, 2, 6, 2, 0, 3, 5, 0, 3, 5, 0, 2, 0, 2, 5, 1, 3,
-	3, 6, 1, 3, 3, 2, 4, 0, 6, 0, 3, 0, 2, 3, 2, 1, 2, 0, 5, 1,
-	4, 3, 1, 4, 2, 5, 0, 1, 3, 6, 2, 3, 0, 5, 6, 1, 5, 1, 0, 3,
-	5, 2, 5, 2, 5, 4, 2, 5, 0, 3, 4, 3, 6, 3, 2, 3, 5, 4, 5, 3,
-	6, 4, 3, 0, 5, 6, 1, 0, 5, 3, 5, 1, 3, 2, 1, 4, 0, 4, 0, 3,
-	0, 3, 6, 3, 1, 1, 6, 3, 0, 2, 3, 2, 5, 1, 1, 5, 0, 5, 1, 2,
-	1, 3, 1, 0, 4, 1, 6, 3, 6, 6, 0, 2, 6, 3, 5, 6, 5, 5, 1, 0,
-	2, 6, 1, 3, 1, 4, 2, 4, 3, 6, 5, 4, 5, 2, 0, 4, 3, 5, 3, 6,
-	3, 3, 1, 6, 3, 1, 2, 1, 3, 1, 3, 0, 5, 4, 2, 1, 1, 5, 1, 4,
-	4, 3, 1, 3, 4, 6, 1, 2, 1, 1, 0, 5, 4, 1, 0, 6, 2, 1, 2, 6,
-	5, 1, 4, 2, 2, 6, 5, 6, 2, 6, 1, 4, 5, 6, 5, 6, 4, 2, 0, 1,
-	6, 2, 4, 4, 0, 4, 6, 1, 4, 3, 4, 3, 4, 6, 5, 3, 1, 1, 6, 5,
-	0, 5, 0, 4, 1, 4, 4, 0, 4, 5, 2, 3, 6, 4, 1, 0, 3, 0, 4, 2,
-	1, 4, 1, 1, 2, 1, 6, 0, 5, 1, 5, 6, 0, 6, 2, 6, 1, 1, 2, 3,
-	2, 4, 3, 4, 3, 2, 4, 2, 4, 1, 2, 1, 4, 3, 4, 3, 0, 5, 0, 1,
-	3, 2, 5, 6, 1, 4, 0, 5, 1, 6, 0, 1, 4, 6, 4, 0, 6, 1, 5, 3,
-	4, 6, 2, 3, 2, 1, 4, 0, 6, 4, 0, 3, 1, 1, 3, 6, 0, 4, 2, 0,
-	5, 4, 1, 6, 4, 6, 4, 1, 1, 4, 1, 0, 2, 5, 6, 3, 5, 4, 0, 3,
-	6, 5, 3, 4, 3, 0, 4, 0, 6, 4, 0, 6, 3, 4, 4, 0, 2, 1, 2, 0,
-	0, 3, 2, 6, 2, 2, 6, 1, 6, 1, 2, 6, 5, 6, 5, 4, 2, 3, 3, 1,
-	1, 1, 4, 4, 6, 0, 3, 1, 4, 2, 6, 4, 5, 2, 3, 4, 6, 3, 2, 3,
-	2, 4, 1, 4, 6, 0, 5, 1, 6, 0, 1, 6, 2, 6, 4, 3, 0, 6, 3, 1,
-	3, 2, 6, 6, 1, 6, 5, 6, 4, 4, 5, 1, 3, 0, 5, 0, 5, 5, 0, 1,
-	4, 5, 2, 0, 5, 1, 0, 4, 3, 2, 4, 6, 2, 6, 3, 5, 5, 4, 1, 1,
-	5, 6, 3, 6, 3, 1, 6, 0, 2, 0, 1, 5, 6, 4, 4, 2, 0, 4, 6, 2,
-	6, 5, 4, 5, 4, 3, 4, 1, 5, 4, 5, 6, 2, 0, 6, 4, 1, 0, 4, 1,
-	0, 3, 2, 0, 5, 4, 2, 5, 6, 3, 3, 5, 0, 1, 2, 1, 0, 2, 1, 1,
-	1, 5, 4, 2, 5, 0, 6, 3, 0, 3, 1, 0, 6, 2, 6, 2, 5, 3, 1, 5,
-	2, 3, 4, 0, 2, 6, 2, 3, 5, 4, 1, 3, 4, 1, 4, 6, 2, 6, 2, 0,
-	3, 2, 3, 0, 3, 4, 5, 1, 5, 5, 1, 2, 0, 6, 0, 6, 0, 6, 5, 1,
-	4, 6, 2, 5, 0, 2, 6, 4, 6, 2, 3, 6, 5, 6, 4, 3, 0, 6, 1, 4,
-	5, 3, 5, 2, 5, 4, 3, 1, 5, 4, 6, 2, 6, 6, 1, 4, 6, 2, 5, 0,
-	6, 0, 2, 3, 4, 3, 6, 2, 3, 5, 4, 3, 6, 0, 2, 4, 2, 1, 5, 2,
-	0, 6, 3, 4, 0, 6, 0, 5, 0, 6, 0, 2, 4, 2, 5, 6, 0, 6, 4, 6,
-	1, 5, 0, 4, 2, 4, 5, 3, 2, 3, 1, 0, 1, 5, 4, 3, 6, 3, 2, 0,
-	2, 3, 2, 5, 4, 6, 1, 2, 4, 6, 5, 6, 3, 6, 4, 1, 3, 5, 3, 5,
-	3, 1, 0, 4, 5, 4, 0, 2, 3, 2, 0, 4, 5, 0, 3, 5, 0, 1, 0, 6,
-	4, 2, 6, 3, 1, 2, 4, 6, 4, 2, 0, 6, 3, 4, 6, 6, 5, 3, 5, 3,
-	5, 6, 3, 1, 0, 4, 2, 5, 1, 3, 1, 4, 3, 2, 5, 6, 2, 6, 6, 5,
-	6, 0, 5, 1, 2, 0, 1, 6, 3, 0, 4, 2, 0, 5, 3, 4, 3, 2, 5, 3,
-	0, 6, 4, 2, 5, 0, 1, 2, 0, 0, 3, 3, 0, 6, 1, 4, 6, 5, 1, 5,
-	1, 4, 3, 0, 6, 5, 6, 1, 5, 3, 4, 5, 0, 3, 2, 3, 1, 2, 6, 2,
-	2, 4, 3, 5, 1, 6, 2, 1, 2, 4, 5, 3, 0, 1, 6, 2, 4, 3, 1, 5,
-	3, 1, 2, 2, 1, 0, 2, 0, 2, 3, 2, 5, 2, 4, 6, 1, 0, 2, 2, 1,
-	4, 1, 6, 4, 6, 1, 0, 5, 1, 5, 1, 3, 5, 3, 0, 5, 2, 0, 4, 5,
-	5, 2, 6, 3, 6, 2, 5, 6, 3, 1, 0, 1, 5, 3, 6, 1, 1, 5, 1, 6,
-	6, 4, 0, 1, 3, 6, 2, 0, 2, 1, 6, 3, 1, 0, 5, 2, 5, 0, 1, 0,
-	0, 6, 5, 1, 2, 6, 3, 6, 1, 3, 1, 3, 0, 6, 2, 1, 5, 2, 2, 3,
-	1, 2, 0, 5, 3, 0, 6, 2, 4, 1, 5, 2, 3, 0, 6, 2, 3, 5, 6, 0,
-	2, 4, 5, 4, 3, 0, 5, 1, 3, 3, 5, 2, 0, 2, 5, 2, 2, 1, 6, 1,
-	3, 1, 0, 2, 1, 4, 3, 6, 3, 6, 5, 0, 6, 3, 0, 4, 2, 0, 4, 6,
-	4, 5, 4, 0, 4, 5, 1, 6, 4, 0, 4, 2, 1, 3, 4, 1, 4, 3, 2, 5,
-	5, 1, 1, 0, 4, 2, 1, 0, 5, 0, 5, 2, 1, 2, 0, 4, 0, 0, 4, 3,
-	6, 4, 2, 3, 1, 5, 4, 5, 1, 3, 5, 2, 4, 5, 2, 6, 1, 4, 2, 4,
-	0, 4, 1, 2, 3, 1, 0, 6, 3, 4, 1, 6, 2, 3, 3, 2, 1, 3, 2, 6,
-	1, 3, 4, 5, 1, 0, 1, 1, 6, 5, 3, 0, 5, 1, 2, 4, 0, 1, 1, 4,
-	2, 1, 0, 5, 4, 0, 1, 0, 2, 4, 1, 3, 4, 2, 4, 1, 0, 2, 3, 2,
-	3, 2, 4, 2, 1, 0, 6, 5, 0, 3, 2, 1, 0, 2, 0, 3, 5, 3, 6, 5,
-	4, 1, 0, 1, 4, 6, 5, 1, 4, 1, 6, 2, 1, 4, 2, 0, 4, 2, 3, 1,
-	5, 2, 5, 6, 5, 3, 0, 4, 2, 1, 0, 6, 5, 1, 2, 4, 5, 4, 2, 5,
-	6, 0, 3, 1, 2, 4, 3, 4, 6, 2, 4, 5, 3, 6, 0, 4, 0, 6, 3, 3,
-	0, 3, 4, 1, 4, 6, 5, 4, 2, 3, 4, 3, 6, 2, 0, 5, 6, 3, 4, 5,
-	1, 5, 4, 1, 0, 6, 1, 4, 1, 0, 6, 4, 3, 1, 0, 5, 1, 1, 3, 2,
-	2, 1, 4, 1, 0, 2, 1, 2, 5, 0, 6, 5, 2, 6, 1, 1, 6, 5, 1, 6,
-	3, 2, 4, 3, 0, 6, 3, 5, 2, 3, 4, 3, 4, 5, 4, 0, 3, 1, 4, 6,
-	4, 2, 6, 0, 6, 2, 4, 1, 2, 3, 1, 6, 1, 3, 6, 1, 0, 4, 0, 6,
-	5, 0, 6, 3, 1, 4, 5, 3, 1, 4, 5, 4, 2, 3, 2, 5, 3, 6, 6, 4,
-	6, 2, 0, 5, 2, 4, 3, 1, 6, 4, 0, 6, 1, 2, 0, 5, 0, 5, 0, 3,
-	0, 6, 6, 3, 6, 0, 6, 5, 1, 1, 6, 4, 6, 5, 4, 6, 0, 2, 1, 6,
-	1, 5, 1, 5, 0, 5, 2, 4, 5, 6, 0, 6, 3, 6, 3, 4, 3, 3, 6, 0,
-	2, 6, 4, 1, 4, 2, 6, 5, 3, 1, 2, 4, 3, 5, 1, 3, 2, 6, 5, 0,
-	3, 2, 0, 6, 6, 5, 0, 4, 0, 1, 2, 6, 0, 5, 2, 1, 3, 4, 1, 6,
-	4, 5, 3, 2, 5, 6, 0, 1, 5, 0, 5, 2, 6, 0, 1, 6, 1, 6, 2, 1,
-	5, 1, 4, 3, 0, 4, 3, 1, 3, 5, 3, 4, 6, 0, 6, 2, 1, 5, 0, 2,
-	6, 4, 0, 4, 2, 3, 1, 3, 5, 3, 1, 2, 3, 0, 3, 1, 4, 4, 3, 6,
-	0, 6, 0, 2, 4, 3, 0, 5, 5, 1, 2, 4, 3, 5, 4, 2, 5, 3, 1, 5,
-	1, 1, 1, 2, 6, 0, 3, 1, 2, 4, 6, 2, 1, 1, 4, 3, 0, 4, 2, 0,
-	2, 5, 3, 6, 3, 0, 1, 2, 6, 2, 3, 0, 3, 0, 1, 3, 3, 5, 6, 0,
-	3, 5, 2, 4, 0, 1, 4, 2, 6, 2, 0, 2, 1, 5, 3, 6, 0, 4, 0, 1,
-	4, 5, 3, 0, 5, 3, 5, 1, 0, 5, 6, 2, 1, 3, 5, 1, 0, 5, 1, 6,
-	5, 2, 3, 0, 1, 3, 3, 5, 1, 5, 1, 3, 1, 0, 1, 4, 2, 3, 1, 3,
-	6, 5, 0, 6, 2, 3, 0, 3, 6, 6, 6, 3, 5, 2, 3, 1, 6, 1, 2, 0,
-	0, 3, 5, 2, 4, 1, 5, 1, 3, 4, 3, 2, 6, 1, 3, 1, 4, 1, 5, 6,
-	1, 3, 6, 1, 5, 1, 3, 1, 0, 4, 0, 1, 2, 3, 1, 0, 4, 2, 0, 3,
-	2, 4, 3, 0, 6, 5, 1, 0, 2, 3, 1, 0, 2, 0, 6, 3, 1, 0, 1, 6,
-	3, 2, 1, 2, 5, 6, 0, 4, 5, 1, 0, 2, 6, 3, 1, 0, 3, 0, 6, 3,
-	4, 2, 0, 6, 3, 4, 6, 5, 0, 3, 4, 0, 6, 2, 3, 6, 1, 6, 0, 2,
-	5, 3, 0, 4, 5, 4, 2, 5, 0, 2, 0, 4, 1, 1, 2, 4, 3, 2, 5, 1,
-	6, 2, 1, 2, 5, 2, 6, 2, 4, 5, 2, 3, 0, 6, 1, 6, 5, 0, 6, 2,
-	0, 5, 1, 3, 5, 6, 0, 1, 5, 2, 5, 1, 6, 5, 2, 3, 1, 6, 3, 2,
-	1, 3, 2, 1, 5, 0, 1, 1, 0, 1, 1, 2, 5, 4, 4, 3, 0, 5, 2, 6,
-	2, 0, 0, 6, 6, 0, 0, 4, 3, 0, 1, 1, 3, 5, 3, 2, 3, 3, 2, 4,
-	3, 2, 5, 6, 5, 1, 2, 6, 2, 3, 5, 5, 3, 1, 0, 6, 0, 1, 6, 2,
-	4, 3, 6, 0, 6, 1, 1, 0, 4, 5, 2, 1, 5, 3, 0, 1, 4, 6, 2, 4,
-	5, 5, 1, 3, 2, 4, 5, 2, 3, 4, 0, 4, 0, 5, 1, 5, 1, 3, 1, 6,
-	6, 1, 2, 3, 1, 2, 4, 1, 6, 1, 6, 3, 4, 3, 5, 2, 4, 2, 1, 0,
-	0, 1, 3, 0, 4, 3, 2, 0, 4, 6, 1, 3, 4, 0, 1, 2, 0, 3, 4, 3,
-	1, 6, 2, 2, 6, 2, 5, 0, 1, 6, 1, 2, 0, 5, 1, 5, 1, 1, 0, 6,
-	2, 3, 5, 6, 3, 4, 2, 0, 3, 4, 2, 0, 4, 4, 0, 4, 5, 1, 4, 1,
-	3, 1, 2, 1, 6, 3, 1, 0, 3, 5, 3, 0, 0, 5, 0, 1, 5, 3, 4, 4,
-	4, 5, 2, 4, 2, 0, 2, 3, 5, 1, 2, 5, 2, 2, 3, 5, 1, 0, 1, 5,
-	5, 1, 3, 0, 6, 5, 0, 3, 5, 5, 6, 3, 6, 4, 3, 4, 0, 2, 5, 2,
-	6, 2, 6, 3, 4, 3, 1, 1, 2, 1, 2, 4, 5, 4, 5, 0, 5, 4, 1, 0,
-	0, 6, 3, 5, 4, 1, 6, 5, 5, 0, 6, 5, 0, 6, 1, 2, 6, 2, 6, 5,
-	1, 0, 5, 2, 1, 5, 0, 3, 5, 4, 6, 2, 6, 5, 6, 4, 6, 0, 4, 5,
-	2, 5, 3, 1, 0, 5, 0, 1, 6, 0, 1, 2, 0, 3, 1, 0, 5, 0, 1, 2,
-	3, 5, 2, 6, 2, 1, 0, 3, 1, 0, 1, 5, 5, 2, 0, 2, 0, 5, 0, 2,
-	4, 5, 1, 6, 1, 4, 2, 6, 3, 5, 2, 5, 3, 1, 5, 2, 1, 0, 2, 3,
-	5, 3, 1, 6, 1, 0, 5, 3, 4, 1, 5, 1, 4, 6, 1, 2, 1, 4, 6, 2,
-	6, 4, 2, 1, 2, 4, 3, 6, 1, 0, 6, 3, 5, 3, 4, 5, 1, 5, 2, 0,
-	0, 1, 5, 1, 6, 3, 5, 6, 1, 1, 3, 0, 5, 2, 1, 3, 4, 0, 2, 0,
-	1, 4, 1, 2, 0, 2, 1, 5, 6, 5, 3, 5, 0, 6, 2, 1, 2, 5, 4, 1,
-	2, 4, 2, 0, 4, 3, 4, 2, 1, 3, 4, 2, 0, 4, 3, 6, 5, 6, 6, 4,
-	3, 1, 3, 0, 5, 1, 0, 6, 5, 1, 5, 6, 4, 5, 3, 0, 3, 1, 3, 5,
-	4, 0, 5, 3, 1, 2, 6, 4, 0, 3, 5, 6, 1, 2, 0, 1, 4, 5, 1, 3,
-	5, 6, 3, 2, 4, 6, 5, 5, 2, 0, 1, 4, 3, 6, 5, 2, 5, 2, 4, 5,
-	6, 1, 2, 0, 3, 5, 3, 5, 3, 1, 3, 0, 3, 0, 1, 4, 5, 4, 1, 3,
-	0, 6, 2, 5, 1, 5, 2, 5, 0, 1, 5, 0, 2, 5, 2, 5, 6, 0, 2, 1,
-	1, 4, 4, 1, 2, 0, 3, 5, 1, 5, 6, 4, 0, 4, 5, 2, 0, 1, 6, 2,
-	2, 0, 3, 0, 2, 5, 6, 3, 2, 5, 0, 6, 1, 5, 1, 3, 5, 0, 5, 0,
-	3, 2, 3, 2, 5, 0, 2, 5, 1, 4, 6, 0, 2, 4, 3, 2, 6, 2, 1, 1,
-	4, 0, 2, 5, 2, 0, 3, 6, 6, 2, 1, 3, 2, 1, 5, 2, 4, 0, 1, 4,
-	5, 1, 2, 0, 2, 3, 4, 5, 1, 1, 6, 3, 1, 1, 5, 0, 6, 5, 1, 6,
-	6, 0, 4, 2, 6, 2, 3, 5, 0, 2, 4, 1, 2, 2, 0, 1, 5, 4, 5, 2,
-	0, 6, 5, 0, 5, 1, 1, 5, 2, 6, 4, 3, 2, 2, 5, 3, 3, 1, 3, 0,
-	1, 5, 3, 3, 2, 3, 4, 5, 5, 3, 5, 1, 0, 1, 2, 6, 2, 4, 3, 1,
-	2, 1, 0, 6, 1, 0, 0, 2, 1, 0, 5, 0, 1, 4, 6, 2, 0, 1, 5, 3,
-	3, 2, 0, 6, 5, 6, 3, 4, 2, 3, 5, 6, 4, 6, 4, 0, 2, 4, 1, 5,
-	4, 1, 6, 4, 1, 3, 0, 4, 0, 6, 3, 0, 6, 5, 0, 3, 1, 2, 5, 1,
-	5, 2, 0, 6, 1, 4, 2, 3, 0, 2, 2, 0, 2, 3, 0, 3, 5, 1, 2, 0,
-	6, 0, 4, 4, 5, 4, 6, 5, 1, 3, 1, 5, 1, 5, 6, 5, 4, 1, 2, 0,
-	0, 3, 2, 1, 4, 2, 5, 6, 5, 0, 2, 0, 6, 1, 6, 0, 3, 0, 5, 1,
-	1, 2, 3, 6, 1, 0, 4, 2, 5, 6, 1, 5, 3, 5, 0, 2, 6, 1, 4, 3,
-	2, 0, 6, 1, 2, 1, 2, 5, 2, 1, 3, 5, 3, 5, 4, 2, 1, 3, 1, 1,
-	3, 1, 2, 0, 6, 3, 4, 2, 1, 2, 4, 2, 1, 3, 2, 1, 6, 1, 2, 2,
-	4, 5, 6, 0, 2, 3, 4, 0, 2, 4, 0, 2, 4, 0, 4, 2, 6, 2, 4, 2,
-	5, 0, 4, 5, 3, 0, 5, 4, 0, 2, 6, 4, 2, 6, 1, 3, 6, 4, 6, 0,
-	6, 5, 0, 6, 1, 4, 2, 3, 6, 5, 0, 1, 6, 1, 6, 5, 0, 4, 2, 5,
-	0, 4, 1, 5, 4, 2, 2, 6, 2, 1, 6, 1, 4, 0, 5, 2, 0, 2, 0, 2,
-	1, 5, 0, 4, 2, 4, 3, 4, 2, 1, 6, 5, 6, 5, 0, 3, 6, 1, 2, 0,
-	2, 1, 2, 4, 3, 1, 0, 6, 5, 4, 5, 4, 2, 1, 0, 1, 6, 0, 4, 6,
-	3, 1, 2, 3, 2, 0, 1, 4, 2, 0, 1, 0, 5, 4, 2, 5, 4, 0, 3, 1,
-	4, 5, 6, 1, 2, 6, 2, 6, 0, 4, 0, 4, 2, 0, 1, 5, 4, 2, 3, 2,
-	5, 1, 5, 6, 1, 4, 2, 4, 6, 4, 6, 1, 1, 6, 3, 6, 0, 5, 1, 4,
-	6, 5, 0, 5, 4, 6, 1, 6, 3, 5, 0, 6, 5, 6, 0, 6, 1, 1, 5, 0,
-	0, 5, 1, 5, 2, 5, 2, 4, 6, 4, 0, 6, 1, 6, 5, 2, 3, 4, 2, 6,
-	1, 4, 6, 3, 4, 0, 3, 6, 3, 1, 2, 0, 5, 3, 4, 2, 1, 3, 4, 4,
-	2, 4, 5, 0, 1, 4, 0, 1, 3, 0, 3, 0, 4, 6, 3, 6, 6, 1, 3, 2,
-	3, 1, 4, 6, 0, 6, 3, 4, 3, 0, 1, 6, 0, 1, 6, 3, 1, 1, 2, 0,
-	4, 3, 5, 6, 2, 6, 4, 2, 3, 4, 0, 3, 1, 5, 3, 6, 5, 4, 0, 4,
-	5, 0, 2, 4, 5, 2, 0, 4, 5, 4, 3, 0, 4, 0, 2, 6, 0, 3, 1, 0,
-	6, 0, 1, 6, 4, 6, 3, 1, 0, 4, 0, 3, 6, 3, 1, 2, 3, 4, 3, 6,
-	0, 5, 2, 0, 2, 6, 1, 4, 5, 6, 3, 4, 2, 5, 5, 0, 4, 5, 2, 6,
-	1, 3, 6, 5, 3, 3, 0, 1, 2, 4, 1, 2, 4, 2, 3, 6, 3, 6, 3, 6,
-	2, 0, 6, 3, 1, 6, 3, 1, 5, 2, 6, 5, 6, 2, 0, 1, 3, 4, 0, 3,
-	3, 4, 2, 6, 0, 1, 5, 2, 1, 6, 1, 1, 5, 2, 1, 2, 3, 5, 0, 4,
-	4, 2, 5, 0, 3, 2, 0, 6, 0, 6, 5, 4, 5, 4, 1, 2, 0, 6, 2, 6,
-	5, 6, 5, 4, 6, 2, 5, 3, 0, 1, 0, 6, 1, 1, 2, 4, 3, 2, 4, 2,
-	6, 4, 5, 0, 5, 6, 5, 4, 2, 5, 5, 3, 5, 1, 1, 5, 0, 5, 3, 0,
-	0, 6, 0, 4, 3, 4, 2, 1, 5, 4, 2, 4, 1, 0, 5, 0, 5, 6, 2, 3,
-	1, 6, 0, 1, 0, 3, 1, 1, 2, 0, 6, 4, 5, 4, 2, 5, 3, 0, 3, 4,
-	2, 1, 0, 4, 4, 2, 6, 4, 2, 1, 0, 4, 6, 4, 0, 1, 3, 0, 5, 6,
-	3, 0, 3, 0, 1, 0, 1, 2, 0, 2, 6, 4, 2, 5, 2, 5, 0, 4, 1, 4,
-	4, 1, 6, 5, 2, 4, 2, 6, 5, 1, 1, 2, 0, 2, 5, 6, 6, 5, 0, 2,
-	5, 5, 4, 1, 4, 1, 5, 6, 2, 3, 6, 2, 0, 4, 0, 3, 6, 0, 2, 5,
-	6, 6, 2, 3, 0, 1, 4, 5, 1, 6, 1, 2, 1, 6, 5, 0, 2, 6, 3, 0,
-	0, 5, 6, 2, 1, 6, 2, 6, 3, 0, 2, 6, 4, 0, 5, 0, 5, 2, 3, 2,
-	1, 4, 2, 0, 6, 3, 5, 1, 2, 6, 0, 3, 5, 5, 0, 6, 3, 2, 5, 3,
-	2, 1, 4, 6, 3, 5, 1, 0, 3, 6, 0, 6, 5, 1, 4, 0, 3, 5, 2, 5,
-	3, 6, 2, 5, 1, 4, 2, 1, 3, 2, 4, 2, 1, 0, 0, 4, 3, 5, 0, 1,
-	4, 2, 5, 2, 4, 3, 0, 1, 4, 0, 2, 4, 3, 6, 2, 0, 6, 0, 1, 6,
-	5, 2, 6, 1, 6, 4, 0, 5, 4, 0, 5, 3, 1, 2, 1, 1, 5, 4, 4, 6,
-	6, 0, 4, 3, 2, 5, 4, 2, 3, 5, 3, 5, 6, 3, 6, 1, 5, 1, 4, 2,
-	0, 5, 6, 1, 3, 0, 6, 1, 6, 2, 4, 3, 0, 1, 5, 6, 0, 2, 6, 2,
-	1, 3, 5, 4, 0, 4, 2, 0, 2, 4, 0, 6, 1, 0, 4, 5, 6, 0, 6, 0,
-	2, 3, 1, 3, 3, 0, 6, 2, 6, 2, 5, 0, 0, 6, 5, 0, 1, 6, 3, 1,
-	3, 6, 0, 3, 5, 1, 4, 1, 1, 3, 5, 5, 0, 5, 0, 3, 1, 2, 0, 4,
-	4, 2, 3, 4, 6, 0, 1, 0, 3, 5, 1, 0, 3, 1, 5, 4, 1, 5, 2, 4,
-	5, 3, 3, 5, 1, 3, 6, 2, 0, 6, 5, 3, 4, 1, 1, 5, 0, 3, 5, 3,
-	6, 5, 2, 6, 3, 3, 2, 5, 3, 4, 2, 0, 3, 1, 5, 3, 1, 5, 3, 0,
-	0, 2, 6, 2, 3, 6, 3, 0, 1, 6, 1, 0, 3, 2, 3, 4, 2, 4, 5, 3,
-	1, 2, 4, 6, 3, 3, 0, 2, 3, 1, 6, 1, 4, 1, 2, 0, 6, 0, 4, 3,
-	2, 0, 5, 2, 5, 0, 6, 1, 3, 5, 2, 5, 4, 4, 0, 6, 3, 4, 4, 3,
-	3, 1, 5, 1, 6, 4, 1, 3, 2, 3, 6, 5, 4, 5, 6, 1, 0, 2, 4, 5,
-	4, 0, 4, 5, 0, 5, 2, 5, 6, 3, 0, 3, 5, 0, 3, 5, 1, 5, 0, 2,
-	5, 3, 4, 5, 1, 2, 3, 2, 0, 3, 4, 6, 2, 5, 6, 4, 5, 4, 6, 5,
-	6, 5, 0, 6, 6, 2, 4, 5, 3, 4, 0, 2, 3, 0, 6, 1, 3, 0, 2, 0,
-	0, 4, 3, 4, 2, 0, 1, 3, 6, 1, 6, 2, 6, 1, 4, 6, 3, 4, 5, 1,
-	1, 4, 2, 3, 2, 5, 2, 1, 4, 0, 4, 6, 2, 5, 3, 0, 6, 4, 0, 5,
-	2, 4, 1, 2, 4, 5, 6, 1, 0, 6, 0, 5, 0, 1, 6, 2, 4, 1, 4, 6,
-	3, 1, 6, 4, 6, 0, 3, 5, 1, 5, 2, 6, 1, 2, 5, 5, 1, 3, 5, 0,
-	4, 0, 5, 0, 3, 0, 3, 2, 0, 3, 4, 2, 3, 5, 4, 0, 1, 4, 2, 1,
-	5, 1, 4, 6, 5, 6, 4, 5, 3, 2, 4, 0, 6, 3, 6, 0, 1, 4, 0, 6,
-	6, 2, 0, 4, 5, 3, 6, 1, 1, 5, 1, 0, 3, 4, 0, 3, 5, 1, 5, 2,
-	0, 1, 2, 5, 6, 3, 3, 4, 1, 3, 2, 1, 2, 5, 3, 1, 6, 0, 3, 1,
-	1, 2, 1, 4, 3, 2, 0, 5, 1, 6, 4, 3, 1, 6, 3, 4, 0, 6, 3, 3,
-	2, 4, 6, 1, 5, 0, 1, 6, 5, 4, 3, 1, 2, 3, 5, 1, 6, 1, 6, 0,
-	3, 1, 2, 3, 0, 5, 6, 4, 0, 1, 2, 6, 4, 6, 4, 3, 2, 1, 3, 4,
-	4, 2, 3, 4, 0, 6, 3, 2, 5, 1, 3, 3, 5, 1, 2, 0, 1, 0, 4, 3,
-	5, 1, 0, 3, 1, 0, 1, 4, 0, 1, 3, 4, 5, 3, 4, 3, 4, 0, 3, 6,
-	6, 2, 1, 4, 3, 2, 1, 4, 3, 0, 4, 0, 5, 3, 6, 4, 2, 3, 4, 3,
-	0, 5, 4, 3, 5, 5, 4, 2, 5, 2, 0, 0, 3, 5, 3, 0, 3, 6, 4, 1,
-	1, 6, 4, 1, 0, 4, 1, 2, 6, 5, 0, 4, 5, 3, 0, 6, 0, 6, 3, 1,
-	2, 6, 4, 0, 2, 6, 3, 1, 6, 0, 6, 3, 6, 5, 4, 6, 3, 1, 2, 3,
-	3, 0, 5, 3, 2, 2, 0, 6, 2, 3, 5, 1, 6, 0, 2, 5, 1, 4, 3, 5,
-	4, 2, 5, 0, 4, 0, 5, 6, 5, 2, 1, 2, 3, 1, 1, 0, 4, 0, 4, 0,
-	5, 3, 0, 3, 5, 1, 6, 6, 3, 6, 1, 0, 5, 4, 6, 1, 4, 5, 4, 6,
-	6, 2, 3, 2, 3, 5, 4, 1, 2, 3, 1, 4, 1, 3, 2, 4, 1, 3, 4, 3,
-	0, 3, 6, 3, 6, 1, 4, 0, 3, 4, 2, 0, 1, 6, 0, 6, 2, 3, 2, 1,
-	1, 2, 5, 2, 5, 1, 2, 0, 4, 1, 3, 1, 0, 3, 3, 5, 0, 2, 1, 0,
-	2, 5, 4, 0, 6, 3, 0, 1, 5, 2, 6, 0, 2, 6, 2, 4, 3, 0, 3, 2,
-	3, 2, 4, 4, 0, 1, 4, 0, 4, 1, 2, 4, 3, 4, 6, 6, 4, 0, 0, 4,
-	4, 1, 2, 4, 0, 6, 3, 4, 4, 3, 3, 6, 0, 5, 0, 2, 5, 0, 4, 6,
-	5, 4, 6, 3, 3, 0, 6, 5, 6, 2, 1, 4, 2, 3, 4, 3, 1, 3, 1, 4,
-	6, 5, 4, 0, 6, 5, 3, 5, 1, 6, 1, 0, 1, 3, 6, 2, 4, 6, 3, 2,
-	0, 2, 6, 4, 1, 5, 6, 4, 4, 5, 3, 1, 5, 1, 2, 3, 1, 1, 6, 0,
-	1, 2, 4, 1, 3, 0, 5, 1, 3, 4, 1, 5, 0, 3, 2, 3, 2, 6, 1, 1,
-	2, 3, 5, 0, 6, 6, 4, 2, 6, 3, 5, 4, 6, 2, 0, 3, 4, 1, 5, 5,
-	3, 5, 0, 0, 5, 6, 3, 1, 2, 4, 5, 1, 6, 3, 6, 0, 4, 6, 4, 1,
-	4, 1, 5, 2, 1, 3, 2, 6, 3, 2, 1, 4, 2, 0, 5, 2, 6, 5, 2, 6,
-	5, 0, 1, 4, 3, 4, 3, 2, 1, 1, 3, 6, 0, 6, 0, 3, 1, 2, 0, 6,
-	6, 2, 3, 6, 1, 0, 3, 6, 2, 4, 1, 6, 3, 5, 4, 3, 3, 6, 4, 3,
-	0, 4, 3, 0, 3, 5, 4, 0, 1, 3, 5, 4, 5, 4, 6, 1, 1, 5, 3, 0,
-	1, 1, 2, 4, 6, 2, 4, 2, 5, 6, 2, 2, 4, 0, 1, 2, 3, 4, 5, 2,
-	2, 1, 4, 2, 0, 1, 4, 2, 2, 6, 0, 1, 3, 5, 6, 4, 4, 1, 0, 2,
-	3, 5, 3, 6, 2, 5, 4, 3, 6, 1, 5, 1, 4, 1, 6, 5, 0, 6, 1, 6,
-	4, 0, 5, 4, 2, 1, 0, 6, 2, 0, 5, 2, 6, 5, 0, 3, 1, 6, 4, 6,
-	5, 0, 2, 1, 3, 5, 5, 1, 2, 1, 3, 4, 5, 4, 0, 4, 3, 6, 3, 3,
-	6, 3, 2, 6, 4, 1, 3, 4, 2, 6, 2, 1, 5, 4, 2, 0, 4, 2, 3, 2,
-	0, 6, 1, 2, 0, 3, 3, 2, 6, 1, 0, 1, 6, 2, 6, 2, 6, 4, 6, 5,
-	1, 1, 3, 6, 0, 5, 2, 3, 1, 2, 3, 4, 1, 0, 4, 2, 1, 4, 5, 2,
-	2, 6, 5, 4, 6, 2, 3, 0, 3, 6, 3, 0, 0, 4, 2, 3, 6, 4, 1, 2,
-	3, 0, 5, 1, 2, 6, 2, 0, 1, 6, 5, 6, 0, 2, 3, 1, 6, 3, 1, 3,
-	4, 2, 3, 5, 1, 3, 2, 5, 6, 4, 5, 6, 6, 3, 3, 6, 6, 1, 2, 3,
-	5, 1, 0, 5, 6, 2, 3, 2, 5, 2, 4, 3, 4, 3, 1, 4, 3, 6, 0, 5,
-	6, 1, 3, 0, 5, 4, 1, 4, 3, 1, 2, 5, 0, 1, 6, 2, 5, 2, 1, 6,
-	0, 6, 1, 0, 5, 3, 1, 5, 3, 5, 6, 1, 3, 4, 1, 4, 6, 3, 5, 6,
-	1, 4, 3, 3, 1, 0, 4, 1, 2, 2, 0, 2, 2, 0, 6, 3, 4, 5, 3, 0,
-	2, 1, 1, 3, 5, 6, 2, 4, 0, 6, 1, 0, 5, 4, 0, 4, 6, 1, 1, 6,
-	3, 6, 5, 0, 3, 6, 3, 0, 1, 0, 3, 1, 6, 1, 4, 6, 0, 6, 0, 1,
-	4, 0, 5, 0, 1, 4, 4, 2, 1, 5, 4, 3, 2, 1, 4, 0, 5, 1, 5, 0,
-	5, 5, 1, 6, 1, 2, 5, 4, 2, 6, 6, 2, 2, 3, 6, 1, 0, 5, 4, 2,
-	6, 4, 5, 6, 5, 1, 4, 1, 5, 3, 4, 1, 2, 3, 1, 0, 2, 6, 1, 6,
-	0, 5, 2, 4, 1, 6, 0, 5, 4, 3, 2, 1, 1, 4, 5, 1, 2, 1, 2, 3,
-	1, 0, 4, 0, 5, 6, 2, 0, 5, 0, 0, 2, 6, 5, 0, 2, 4, 1, 0, 3,
-	2, 6, 1, 6, 4, 3, 1, 3, 4, 1, 0, 2, 0, 6, 4, 1, 5, 6, 1, 5,
-	3, 5, 6, 5, 6, 2, 3, 4, 0, 1, 5, 5, 1, 0, 1, 6, 1, 1, 4, 4,
-	4, 3, 1, 1, 3, 2, 1, 5, 0, 6, 4, 3, 1, 0, 1, 4, 3, 5, 3, 2,
-	5, 3, 0, 2, 6, 0, 5, 1, 5, 0, 3, 4, 1, 4, 4, 6, 2, 1, 6, 0,
-	6, 2, 0, 5, 1, 4, 5, 6, 0, 1, 6, 4, 6, 2, 1, 4, 5, 3, 5, 0,
-	0, 1, 4, 5, 2, 6, 3, 6, 3, 1, 6, 0, 2, 1, 4, 1, 4, 5, 1, 4,
-	1, 0, 2, 0, 2, 5, 2, 1, 2, 5, 1, 4, 0, 1, 4, 2, 5, 2, 0, 2,
-	2, 5, 2, 3, 3, 5, 0, 1, 6, 2, 3, 0, 6, 3, 2, 3, 5, 2, 0, 4,
-	3, 2, 5, 2, 3, 6, 5, 6, 3, 2, 1, 0, 2, 4, 5, 4, 0, 4, 3, 5,
-	4, 2, 0, 4, 6, 1, 5, 4, 1, 6, 0, 0, 6, 1, 6, 4, 5, 1, 0, 1,
-	5, 0, 4, 6, 1, 2, 0, 5, 4, 5, 3, 1, 1, 4, 6, 4, 4, 0, 6, 1,
-	6, 0, 4, 5, 3, 0, 5, 2, 6, 1, 2, 1, 5, 0, 5, 4, 2, 6, 3, 4,
-	0, 2, 6, 5, 1, 2, 5, 1, 4, 2, 5, 0, 3, 2, 1, 0, 1, 2, 2, 0,
-	1, 1, 4, 0, 2, 4, 2, 0, 3, 1, 0, 1, 3, 2, 4, 2, 6, 0, 5, 2,
-	2, 6, 5, 4, 3, 0, 4, 1, 5, 3, 5, 1, 0, 6, 3, 4, 2, 4, 6, 6,
-	3, 6, 4, 3, 0, 6, 3, 5, 1, 3, 0, 2, 4, 1, 4, 2, 3, 5, 3, 4,
-	4, 5, 2, 1, 3, 5, 5, 6, 5, 2, 3, 6, 5, 1, 0, 4, 5, 1, 3, 4,
-	5, 0, 5, 0, 1, 2, 5, 6, 2, 0, 6, 0, 5, 3, 2, 5, 6, 2, 5, 1,
-	6, 5, 2, 3, 4, 0, 0, 5, 4, 1, 6, 0, 5, 3, 5, 4, 0, 3, 5, 0,
-	0, 3, 1, 6, 4, 1, 1, 3, 0, 5, 2, 1, 4, 5, 0, 4, 6, 4, 3, 2,
-	1, 3, 6, 1, 3, 5, 1, 6, 0, 2, 6, 1, 0, 4, 2, 4, 2, 0, 0, 3,
-	2, 4, 6, 2, 3, 2, 4, 2, 4, 3, 6, 6, 5, 3, 6, 2, 3, 2, 6, 4,
-	3, 6, 1, 5, 1, 0, 4, 2, 5, 2, 4, 2, 1, 2, 0, 3, 6, 0, 2, 3,
-	4, 5, 1, 2, 6, 4, 1, 6, 5, 1, 5, 4, 2, 1, 4, 5, 0, 1, 3, 5,
-	5, 2, 4, 3, 1, 0, 1, 4, 6, 0, 5, 3, 4, 3, 1, 0, 2, 3, 3, 1,
-	6, 4, 0, 1, 5, 3, 4, 1, 0, 5, 4, 2, 6, 0, 6, 3, 4, 2, 3, 2,
-	0, 4, 2, 5, 6, 5, 5, 4, 0, 6, 5, 0, 1, 0, 3, 1, 1, 4, 1, 4,
-	1, 1, 6, 3, 6, 2, 4, 6, 4, 1, 6, 5, 6, 3, 1, 2, 3, 5, 2, 0,
-	2, 4, 3, 6, 3, 4, 5, 0, 6, 3, 4, 0, 3, 1, 1, 4, 6, 1, 2, 4,
-	3, 0, 2, 5, 1, 0, 3, 4, 1, 3, 4, 2, 4, 6, 1, 5, 4, 2, 0, 6,
-	4, 0, 4, 2, 6, 1, 3, 3, 4, 1, 3, 5, 1, 2, 6, 5, 1, 6, 3, 4,
-	5, 3, 6, 1, 4, 5, 1, 4, 6, 2, 1, 3, 6, 4, 2, 0, 3, 0, 5, 0,
-	6, 3, 2, 1, 3, 0, 6, 0, 1, 0, 6, 1, 2, 0, 5, 2, 3, 2, 5, 6,
-	0, 6, 5, 0, 1, 5, 3, 1, 6, 4, 2, 0, 2, 0, 3, 3, 2, 5, 6, 4,
-	1, 6, 5, 2, 4, 2, 3, 0, 4, 1, 5, 2, 0, 5, 1, 3, 0, 5, 1, 6,
-	2, 6, 6, 4, 0, 1, 5, 0, 2, 5, 5, 4, 3, 1, 3, 2, 0, 5, 3, 6,
-	3, 5, 6, 3, 0, 1, 4, 6, 2, 4, 1, 5, 4, 0, 3, 1, 3, 0, 3, 1,
-	4, 3, 3, 0, 5, 5, 2, 3, 5, 3, 5, 4, 2, 1, 0, 2, 1, 6, 3, 4,
-	5, 1, 3, 6, 5, 0, 2, 5, 4, 2, 6, 1, 5, 4, 3, 2, 5, 0, 3, 6,
-	6, 4, 2, 1, 3, 0, 2, 1, 2, 5, 2, 6, 1, 0, 4, 2, 1, 4, 1, 1,
-	0, 2, 4, 0, 6, 2, 0, 1, 0, 6, 5, 3, 0, 1, 2, 0, 3, 2, 3, 4,
-	1, 4, 4, 1, 5, 1, 4, 5, 1, 2, 6, 2, 3, 4, 0, 6, 2, 0, 5, 0,
-	2, 1, 6, 4, 3, 0, 6, 2, 4, 6, 3, 4, 0, 2, 1, 4, 3, 6, 3, 4,
-	3, 6, 0, 3, 4, 3, 0, 1, 4, 0, 3, 6, 2, 5, 1, 0, 2, 0, 3, 0,
-	4, 3, 3, 2, 1, 1, 4, 3, 6, 5, 6, 4, 2, 1, 6, 0, 5, 4, 2, 3,
-	5, 2, 1, 4, 2, 1, 3, 0, 1, 3, 0, 3, 4, 1, 0, 4, 1, 0, 6, 2,
-	6, 3, 5, 3, 1, 6, 5, 1, 4, 1, 2, 0, 3, 4, 2, 1, 0, 0, 0, 4,
-	0, 2, 6, 2, 3, 2, 1, 4, 5, 6, 3, 1, 5, 3, 2, 1, 2, 5, 1, 5,
-	1, 0, 0, 4, 1, 3, 3, 5, 3, 0, 6, 5, 6, 4, 3, 5, 2, 5, 4, 5,
-	2, 4, 2, 3, 1, 6, 0, 3, 4, 0, 6, 1, 3, 1, 5, 3, 3, 4, 5, 4,
-	3, 4, 3, 2, 1, 2, 5, 2, 5, 3, 5, 6, 0, 3, 3, 5, 2, 0, 1, 2,
-	4, 6, 3, 4, 5, 5, 2, 3, 4, 5, 5, 4, 3, 2, 6, 1, 0, 1, 4, 6,
-	5, 0, 3, 2, 1, 0, 3, 5, 4, 6, 5, 0, 5, 6, 2, 6, 0, 5, 1, 0,
-	6, 5, 0, 1, 2, 1, 6, 2, 3, 1, 6, 4, 5, 0, 3, 2, 1, 4, 5, 3,
-	0, 6, 4, 6, 1, 2, 3, 2, 3, 4, 0, 3, 5, 6, 2, 4, 5, 3, 4, 0,
-	1, 3, 5, 0, 6, 2, 3, 6, 1, 0, 6, 5, 3, 1, 3, 6, 4, 3, 2, 6,
-	2, 5, 3, 0, 2, 2, 1, 5, 0, 5, 0, 5, 3, 1, 6, 1, 5, 0, 1, 2,
-	3, 4, 2, 4, 3, 3, 3, 2, 4, 6, 1, 2, 5, 0, 6, 2, 5, 0, 1, 4,
-	4, 3, 1, 6, 3, 1, 2, 0, 3, 6, 5, 6, 5, 1, 0, 2, 1, 5, 4, 1,
-	5, 4, 3, 5, 4, 2, 6, 3, 6, 2, 3, 1, 4, 0, 4, 5, 0, 5, 1, 0,
-	6, 5, 1, 3, 3, 3, 4, 6, 4, 2, 1, 1, 2, 2, 4, 3, 1, 3, 3, 3,
-	0, 1, 6, 2, 0, 1, 0, 3, 5, 2, 0, 2, 0, 6, 1, 1, 3, 2, 1, 5,
-	1, 6, 2, 1, 6, 2, 0, 6, 3, 2, 4, 3, 5, 1, 4, 1, 0, 2, 5, 4,
-	2, 4, 6, 1, 3, 5, 0, 5, 2, 3, 6, 1, 1, 0, 4, 6, 5, 6, 4, 2,
-	3, 0, 3, 6, 2, 1, 3, 4, 2, 1, 6, 0, 2, 0, 3, 6, 6, 1, 2, 0,
-	4, 5, 3, 0, 4, 2, 6, 2, 1, 5, 6, 1, 3, 4, 6, 0, 2, 3, 3, 2,
-	5, 6, 0, 6, 3, 4, 1, 2, 6, 1, 6, 5, 3, 1, 2, 5, 1, 1, 0, 1,
-	6, 4, 1, 6, 5, 1, 3, 0, 2, 4, 2, 6, 2, 5, 2, 6, 4, 2, 1, 3,
-	0, 3, 0, 5, 6, 0, 4, 5, 2, 5, 4, 5, 6, 2, 2, 3, 2, 1, 6, 3,
-	1, 0, 0, 2, 4, 3, 0, 2, 5, 6, 3, 2, 6, 1, 4, 0, 1, 0, 5, 1,
-	2, 5, 6, 5, 6, 6, 1, 6, 1, 3, 1, 3, 0, 3, 6, 3, 4, 2, 1, 0,
-	3, 6, 3, 3, 2, 3, 6, 4, 6, 1, 6, 2, 4, 3, 5, 0, 6, 4, 6, 3,
-	4, 1, 0, 1, 3, 0, 2, 3, 5, 6, 4, 6, 3, 4, 3, 6, 3, 5, 0, 0,
-	5, 6, 2, 4, 1, 3, 0, 2, 4, 3, 4, 4, 1, 0, 6, 4, 3, 4, 0, 2,
-	6, 0, 6, 5, 1, 0, 2, 0, 3, 4, 1, 6, 4, 5, 6, 4, 3, 3, 0, 2,
-	0, 2, 6, 3, 1, 3, 0, 4, 3, 1, 5, 1, 1, 2, 6, 2, 3, 2, 6, 4,
-	1, 2, 1, 4, 1, 3, 5, 3, 1, 2, 3, 2, 2, 3, 5, 1, 1, 2, 0, 4,
-	2, 5, 0, 1, 2, 2, 6, 2, 1, 1, 4, 2, 6, 0, 4, 6, 2, 0, 3, 1,
-	3, 5, 1, 0, 6, 2, 5, 5, 4, 3, 1, 5, 4, 1, 3, 5, 4, 5, 2, 4,
-	4, 2, 4, 1, 0, 1, 6, 3, 0, 4, 3, 2, 3, 5, 3, 4, 4, 1, 4, 3,
-	5, 5, 4, 1, 2, 0, 1, 6, 3, 3, 1, 5, 1, 6, 0, 5, 4, 3, 5, 3,
-	6, 3, 6, 3, 0, 0, 6, 2, 1, 6, 0, 1, 2, 4, 0, 5, 6, 5, 1, 6,
-	0, 3, 6, 0, 3, 1, 2, 4, 2, 4, 0, 6, 0, 3, 2, 3, 5, 0, 1, 2,
-	1, 5, 3, 6, 4, 1, 6, 5, 3, 2, 3, 1, 6, 3, 6, 2, 3, 0, 5, 2,
-	2, 3, 6, 0, 4, 0, 6, 2, 3, 5, 0, 3, 2, 6, 0, 6, 0, 1, 4, 2,
-	3, 6, 1, 2, 1, 3, 2, 0, 1, 5, 6, 1, 4, 2, 6, 1, 6, 5, 4, 2,
-	4, 3, 4, 6, 2, 6, 4, 4, 2, 6, 1, 2, 0, 2, 3, 5, 6, 3, 4, 3,
-	5, 3, 4, 6, 2, 3, 1, 5, 2, 4, 3, 1, 1, 4, 0, 5, 2, 0, 4, 1,
-	6, 2, 3, 6, 0, 6, 2, 5, 4, 6, 4, 1, 0, 1, 0, 3, 5, 1, 5, 0,
-	0, 2, 3, 1, 0, 6, 5, 2, 5, 6, 5, 3, 1, 5, 1, 4, 0, 4, 6, 0,
-	1, 4, 0, 1, 4, 3, 6, 4, 3, 6, 2, 1, 2, 4, 1, 3, 4, 3, 5, 1,
-	2, 6, 2, 6, 5, 6, 2, 1, 0, 3, 3, 6, 5, 4, 5, 2, 1, 0, 2, 1,
-	3, 1, 0, 4, 5, 6, 3, 1, 6, 4, 6, 3, 0, 3, 5, 6, 0, 3, 2, 0,
-	4, 4, 3, 4, 3, 2, 6, 2, 3, 2, 0, 6, 4, 5, 1, 2, 0, 6, 2, 3,
-	5, 6, 3, 6, 0, 6, 4, 2, 4, 5, 4, 3, 2, 5, 0, 3, 1, 5, 3, 6,
-	6, 5, 1, 6, 4, 3, 6, 3, 4, 3, 0, 2, 0, 1, 6, 4, 6, 5, 1, 6,
-	0, 6, 0, 6, 3, 6, 6, 4, 0, 1, 5, 2, 0, 5, 5, 3, 6, 1, 2, 0,
-	1, 6, 3, 2, 3, 2, 6, 5, 4, 1, 3, 2, 5, 2, 4, 4, 3, 5, 1, 1,
-	2, 5, 5, 3, 0, 0, 6, 3, 1, 0, 5, 0, 2, 1, 4, 1, 0, 3, 5, 1,
-	3, 5, 3, 4, 2, 4, 2, 0, 5, 2, 4, 2, 5, 3, 4, 3, 3, 0, 2, 0,
-	4, 5, 0, 2, 6, 4, 3, 6, 1, 1, 6, 3, 5, 0, 5, 4, 5, 4, 6, 2,
-	5, 3, 5, 6, 5, 4, 3, 0, 5, 1, 5, 2, 4, 0, 4, 2, 1, 0, 4, 0,
-	6, 5, 6, 0, 6, 5, 6, 2, 6, 0, 6, 4, 5, 2, 6, 5, 3, 1, 2, 6,
-	0, 6, 1, 4, 2, 3, 1, 2, 5, 6, 5, 3, 6, 1, 6, 5, 6, 0, 5, 0,
-	1, 4, 5, 6, 4, 6, 4, 2, 6, 4, 4, 2, 4, 0, 1, 6, 0, 3, 2, 6,
-	2, 3, 1, 6, 3, 0, 2, 4, 0, 4, 2, 0, 5, 3, 6, 1, 2, 4, 6, 0,
-	3, 6, 1, 4, 4, 0, 2, 0, 4, 5, 1, 5, 2, 5, 3, 0, 6, 0, 4, 2,
-	4, 2, 2, 0, 6, 3, 4, 0, 1, 0, 5, 2, 0, 1, 2, 1, 5, 4, 1, 3,
-	5, 5, 0, 6, 4, 1, 6, 4, 6, 5, 6, 0, 2, 4, 0, 6, 3, 2, 1, 0,
-	6, 0, 6, 2, 0, 1, 6, 2, 5, 3, 5, 2, 6, 0, 4, 3, 5, 3, 1, 6,
-	0, 4, 0, 1, 4, 4, 2, 0, 3, 2, 0, 2, 4, 5, 4, 5, 6, 2, 5, 1,
-	1, 3, 0, 4, 0, 3, 0, 6, 4, 5, 3, 4, 2, 4, 2, 3, 4, 6, 2, 0,
-	2, 6, 2, 3, 0, 1, 1, 6, 2, 5, 2, 5, 3, 2, 1, 0, 2, 6, 5, 3,
-	3, 1, 4, 3, 2, 5, 4, 0, 3, 5, 6, 1, 6, 0, 6, 0, 6, 0, 5, 4,
-	4, 3, 1, 2, 6, 4, 3, 2, 3, 3, 1, 4, 3, 4, 3, 2, 0, 6, 4, 5,
-	5, 4, 5, 2, 0, 1, 1, 3, 6, 0, 4, 0, 3, 3, 2, 5, 6, 5, 2, 4,
-	6, 2, 6, 2, 5, 3, 5, 3, 2, 6, 4, 1, 2, 0, 6, 5, 4, 0, 2, 5,
-	0, 4, 6, 4, 2, 1, 5, 0, 5, 6, 3, 1, 5, 1, 2, 1, 6, 0, 4, 5,
-	1, 2, 4, 0, 5, 3, 6, 1, 4, 3, 6, 2, 1, 6, 1, 1, 6, 2, 3, 6,
-	2, 1, 0, 6, 5, 1, 6, 0, 6, 4, 3, 6, 0, 5, 2, 1, 2, 0, 3, 5,
-	3, 4, 1, 4, 1, 2, 6, 3, 2, 1, 0, 5, 1, 4, 2, 1, 2, 1, 0, 6,
-	4, 6, 0, 3, 5, 1, 5, 1, 2, 1, 4, 0, 5, 5, 6, 4, 1, 5, 6, 0,
-	5, 4, 1, 4, 4, 1, 6, 5, 1, 0, 3, 6, 2, 4, 1, 0, 2, 0, 1, 4,
-	6, 4, 6, 2, 3, 5, 4, 6, 2, 6, 3, 2, 3, 1, 4, 1, 0, 1, 6, 4,
-	0, 3, 2, 4, 2, 6, 2, 6, 0, 5, 0, 6, 2, 1, 0, 6, 5, 3, 0, 1,
-	1, 3, 4, 1, 6, 5, 2, 4, 5, 2, 3, 6, 1, 6, 2, 6, 4, 5, 2, 0,
-	2, 2, 1, 1, 0, 1, 6, 5, 0, 5, 2, 4, 1, 5, 2, 0, 3, 5, 4, 2,
-	3, 1, 2, 6, 1, 3, 6, 0, 1, 1, 2, 5, 4, 6, 2, 5, 0, 1, 2, 1,
-	4, 6, 5, 1, 1, 0, 3, 0, 6, 4, 2, 1, 3, 1, 0, 6, 5, 6, 0, 2,
-	5, 6, 1, 5, 2, 0, 2, 5, 2, 1, 4, 2, 0, 4, 6, 5, 2, 4, 5, 6,
-	6, 2, 6, 3, 1, 3, 0, 4, 2, 3, 3, 3, 1, 5, 0, 5, 4, 6, 2, 4,
-	0, 5, 1, 5, 5, 4, 0, 6, 6, 2, 1, 5, 3, 5, 2, 0, 4, 3, 0, 5,
-	1, 4, 5, 6, 0, 2, 5, 6, 2, 5, 1, 1, 4, 3, 3, 6, 2, 5, 3, 0,
-	2, 5, 0, 4, 4, 3, 5, 1, 3, 2, 3, 4, 5, 6, 2, 1, 0, 3, 4, 0,
-	3, 5, 2, 5, 4, 0, 1, 4, 3, 4, 3, 6, 5, 0, 4, 6, 1, 0, 4, 5,
-	4, 2, 4, 5, 1, 5, 1, 2, 4, 2, 0, 6, 5, 1, 5, 4, 0, 5, 0, 5,
-	5, 0, 3, 4, 2, 0, 3, 1, 4, 5, 3, 4, 3, 2, 5, 4, 5, 2, 5, 0,
-	6, 0, 2, 5, 4, 1, 4, 0, 2, 0, 1, 6, 3, 6, 3, 2, 1, 3, 4, 2,
-	0, 3, 6, 4, 3, 5, 4, 5, 1, 6, 0, 1, 3, 4, 3, 3, 6, 4, 0, 6,
-	1, 0, 3, 4, 1, 5, 2, 2, 5, 0, 4, 3, 0, 4, 1, 5, 2, 5, 6, 4,
-	2, 1, 3, 0, 3, 4, 0, 5, 6, 3, 2, 6, 1, 2, 0, 3, 2, 3, 1, 6,
-	3, 0, 6, 0, 5, 1, 4, 0, 6, 1, 6, 5, 1, 4, 6, 4, 0, 5, 1, 6,
-	4, 2, 5, 2, 1, 6, 0, 2, 0, 2, 3, 2, 3, 2, 3, 1, 1, 2, 4, 3,
-	5, 4, 2, 4, 0, 6, 2, 1, 2, 5, 1, 3, 4, 5, 5, 0, 1, 2, 3, 6,
-	6, 5, 0, 4, 2, 4, 2, 4, 2, 0, 0, 0, 5, 3, 2, 5, 0, 6, 0, 3,
-	0, 4, 3, 0, 6, 3, 6, 3, 2, 6, 2, 1, 3, 3, 0, 3, 1, 5, 2, 6,
-	1, 3, 6, 1, 3, 6, 4, 5, 1, 3, 0, 5, 3, 4, 5, 3, 3, 3, 2, 5,
-	2, 0, 2, 6, 6, 4, 1, 0, 5, 0, 2, 1, 0, 2, 0, 1, 5, 1, 4, 5,
-	3, 5, 1, 6, 1, 3, 0, 5, 6, 4, 5, 1, 0, 4, 1, 0, 6, 2, 6, 4,
-	4, 6, 2, 6, 4, 6, 4, 6, 2, 5, 0, 5, 1, 0, 4, 4, 1, 5, 4, 6,
-	5, 1, 4, 6, 0, 1, 2, 4, 3, 4, 3, 0, 5, 6, 6, 1, 1, 6, 2, 3,
-	6, 0, 2, 3, 1, 4, 0, 5, 1, 5, 4, 6, 4, 4, 1, 6, 0, 5, 1, 2,
-	0, 4, 2, 4, 1, 3, 6, 5, 6, 1, 4, 5, 2, 4, 5, 6, 2, 0, 0, 5,
-	1, 4, 0, 5, 6, 5, 1, 2, 5, 4, 0, 4, 6, 3, 2, 5, 6, 4, 5, 0,
-	2, 4, 0, 3, 6, 6, 3, 2, 5, 0, 2, 1, 5, 3, 4, 0, 4, 5, 4, 1,
-	3, 0, 6, 1, 6, 2, 4, 3, 5, 2, 3, 2, 3, 1, 5, 4, 3, 1, 4, 4,
-	4, 6, 2, 6, 1, 6, 4, 2, 6, 5, 1, 3, 2, 2, 3, 6, 4, 2, 4, 4,
-	5, 4, 3, 0, 0, 1, 4, 3, 2, 3, 0, 2, 5, 3, 5, 4, 1, 0, 5, 1,
-	6, 4, 3, 2, 1, 4, 5, 3, 3, 6, 6, 2, 3, 2, 0, 3, 0, 1, 3, 0,
-	0, 2, 5, 2, 3, 4, 2, 0, 2, 1, 0, 3, 2, 0, 3, 4, 3, 0, 5, 1,
-	1, 4, 5, 0, 3, 5, 0, 4, 2, 4, 2, 3, 4, 0, 4, 4, 3, 6, 2, 1,
-	2, 4, 2, 0, 6, 5, 2, 5, 6, 5, 6, 1, 4, 6, 2, 4, 6, 1, 4, 2,
-	3, 1, 5, 3, 1, 2, 6, 2, 2, 0, 1, 3, 0, 4, 3, 4, 2, 3, 2, 1,
-	4, 3, 1, 4, 5, 2, 4, 2, 0, 3, 0, 6, 2, 0, 4, 6, 2, 5, 4, 3,
-	5, 1, 5, 4, 0, 3, 2, 0, 6, 3, 5, 4, 2, 0, 1, 5, 1, 3, 1, 2,
-	6, 3, 0, 3, 5, 2, 4, 4, 3, 6, 2, 5, 0, 2, 3, 2, 6, 2, 0, 1,
-	0, 5, 4, 2, 0, 4, 3, 5, 6, 0, 3, 2, 6, 4, 6, 2, 3, 2, 2, 6,
-	1, 5, 4, 5, 3, 4, 6, 2, 3, 6, 2, 6, 0, 4, 5, 4, 0, 5, 2, 1,
-	2, 0, 2, 3, 3, 0, 2, 0, 5, 3, 2, 6, 6, 4, 4, 6, 0, 2, 6, 5,
-	3, 6, 2, 0, 1, 2, 4, 3, 1, 4, 5, 1, 0, 6, 0, 4, 2, 6, 0, 0,
-	4, 5, 0, 5, 4, 2, 6, 0, 4, 0, 4, 6, 3, 2, 0, 2, 1, 6, 4, 5,
-	5, 1, 4, 0, 3, 1, 0, 4, 3, 5, 1, 0, 4, 3, 0, 2, 4, 5, 1, 6,
-	6, 5, 4, 3, 4, 6, 2, 4, 4, 3, 5, 4, 1, 2, 4, 3, 2, 4, 2, 3,
-	0, 6, 3, 1, 4, 3, 3, 1, 1, 4, 1, 2, 1, 6, 4, 3, 2, 0, 4, 0,
-	1, 2, 0, 5, 2, 3, 5, 3, 0, 6, 3, 5, 4, 3, 4, 2, 4, 5, 1, 5,
-	2, 1, 1, 5, 6, 3, 5, 4, 2, 6, 2, 1, 4, 6, 2, 4, 0, 4, 6, 1,
-	3, 2, 4, 0, 6, 6, 2, 6, 3, 1, 3, 5, 1, 4, 1, 0, 6, 4, 0, 4,
-	4, 3, 1, 4, 6, 2, 0, 4, 1, 6, 3, 5, 2, 5, 1, 6, 0, 1, 0, 6,
-	5, 6, 2, 4, 5, 6, 1, 0, 3, 6, 1, 4, 1, 3, 3, 3, 0, 6, 4, 4,
-	6, 3, 3, 0, 5, 3, 2, 3, 1, 0, 5, 3, 4, 2, 3, 2, 0, 4, 2, 5,
-	0, 5, 6, 2, 1, 0, 4, 1, 3, 1, 2, 6, 0, 0, 2, 3, 2, 0, 2, 4,
-	1, 2, 0, 6, 5, 6, 3, 6, 0, 3, 2, 3, 6, 2, 3, 6, 3, 1, 5, 3,
-	2, 5, 4, 6, 4, 3, 4, 2, 4, 2, 5, 0, 0, 5, 4, 1, 0, 6, 1, 5,
-	3, 5, 2, 0, 6, 3, 2, 2, 5, 3, 1, 2, 5, 1, 6, 0, 6, 5, 3, 1,
-	4, 0, 1, 1, 2, 1, 4, 3, 4, 2, 1, 3, 0, 3, 5, 6, 2, 6, 1, 0,
-	5, 1, 3, 5, 2, 1, 3, 0, 4, 3, 2, 4, 0, 4, 5, 0, 2, 0, 5, 4,
-	6, 2, 1, 5, 4, 6, 3, 2, 1, 6, 5, 3, 5, 3, 3, 3, 6, 6, 1, 2,
-	0, 5, 2, 6, 2, 1, 3, 2, 5, 2, 0, 5, 1, 4, 5, 1, 0, 2, 5, 3,
-	1, 0, 1, 5, 4, 3, 6, 1, 4, 2, 0, 2, 0, 6, 5, 4, 5, 4, 5, 1,
-	2, 3, 0, 3, 5, 6, 4, 2, 4, 5, 2, 5, 1, 1, 6, 3, 6, 4, 3, 3,
-	3, 0, 6, 1, 3, 6, 4, 5, 6, 4, 2, 4, 4, 1, 0, 1, 0, 4, 5, 1,
-	4, 5, 6, 3, 4, 2, 3, 4, 0, 3, 5, 6, 0, 6, 1, 2, 6, 1, 0, 1,
-	5, 4, 0, 3, 1, 5, 6, 6, 4, 3, 6, 4, 5, 1, 0, 1, 4, 2, 3, 3,
-	6, 1, 5, 1, 3, 5, 1, 4, 2, 0, 4, 2, 0, 2, 1, 6, 5, 3, 1, 6,
-	0, 1, 2, 3, 1, 0, 3, 2, 1, 3, 3, 2, 0, 2, 3, 2, 3, 5, 3, 0,
-	1, 4, 1, 0, 5, 1, 6, 5, 6, 3, 0, 1, 0, 3, 0, 4, 0, 6, 0, 2,
-	2, 4, 6, 3, 4, 1, 0, 2, 0, 6, 0, 3, 6, 2, 0, 3, 2, 3, 1, 2,
-	3, 0, 4, 5, 1, 2, 3, 4, 5, 3, 0, 5, 3, 0, 1, 0, 3, 5, 1, 4,
-	4, 2, 6, 2, 4, 2, 1, 3, 0, 5, 0, 4, 0, 6, 3, 0, 6, 2, 3, 0,
-	5, 4, 6, 5, 4, 1, 1, 1, 6, 1, 2, 1, 2, 0, 2, 2, 0, 5, 6, 5,
-	6, 2, 1, 0, 5, 4, 2, 6, 3, 4, 2, 0, 3, 2, 4, 0, 2, 5, 0, 4,
-	0, 3, 2, 5, 6, 1, 0, 2, 3, 0, 5, 6, 1, 5, 4, 3, 5, 6, 4, 0,
-	1, 1, 2, 6, 5, 3, 1, 3, 6, 0, 2, 5, 0, 3, 4, 1, 6, 4, 5, 1,
-	2, 3, 1, 1, 1, 3, 3, 4, 2, 5, 0, 0, 1, 5, 4, 5, 2, 4, 6, 4,
-	3, 6, 0, 4, 3, 2, 1, 6, 0, 5, 3, 4, 6, 1, 2, 3, 4, 2, 4, 2,
-	4, 2, 6, 5, 0, 5, 1, 5, 2, 5, 1, 0, 2, 3, 5, 4, 1, 5, 2, 3,
-	5, 2, 6, 6, 2, 3, 5, 0, 2, 5, 1, 3, 2, 5, 1, 0, 3, 5, 1, 2,
-	6, 5, 1, 6, 3, 2, 5, 4, 5, 1, 3, 6, 5, 3, 0, 6, 0, 6, 2, 1,
-	0, 4, 3, 1, 3, 6, 0, 4, 1, 0, 1, 4, 0, 5, 6, 0, 5, 6, 5, 2,
-	1, 4, 1, 4, 0, 4, 0, 1, 0, 2, 3, 0, 6, 0, 4, 6, 5, 5, 3, 0,
-	2, 0, 5, 3, 2, 5, 6, 0, 3, 2, 0, 3, 2, 3, 1, 0, 6, 3, 0, 4,
-	3, 2, 3, 5, 4, 1, 4, 0, 3, 5, 2, 5, 2, 0, 6, 0, 5, 6, 0, 6,
-	4, 1, 2, 1, 2, 0, 1, 4, 2, 6, 1, 4, 6, 1, 0, 3, 1, 4, 2, 0,
-	5, 1, 5, 4, 0, 1, 2, 6, 4, 6, 3, 1, 2, 3, 6, 1, 5, 3, 1, 4,
-	6, 2, 0, 4, 3, 0, 3, 6, 2, 4, 5, 1, 5, 1, 4, 1, 2, 0, 5, 6,
-	0, 4, 2, 3, 5, 4, 0, 6, 1, 4, 0, 3, 3, 2, 3, 6, 5, 4, 2, 6,
-	1, 3, 2, 6, 1, 4, 0, 5, 1, 6, 5, 6, 3, 0, 0, 1, 3, 0, 6, 2,
-	2, 3, 2, 0, 5, 6, 3, 6, 0, 3, 5, 4, 6, 5, 1, 6, 1, 0, 0, 4,
-	3, 4, 1, 0, 2, 3, 5, 1, 3, 4, 6, 0, 3, 6, 1, 5, 3, 6, 4, 0,
-	4, 4, 2, 3, 0, 6, 5, 3, 6, 4, 2, 4, 5, 0, 5, 4, 6, 3, 1, 5,
-	5, 3, 0, 5, 1, 3, 4, 5, 3, 3, 0, 5, 6, 0, 4, 0, 2, 6, 3, 0,
-	6, 4, 5, 1, 4, 3, 0, 6, 3, 5, 3, 6, 3, 0, 5, 4, 5, 1, 5, 0,
-	0, 5, 6, 4, 2, 3, 6, 4, 6, 3, 5, 4, 1, 4, 6, 5, 1, 6, 1, 6,
-	1, 6, 4, 6, 3, 6, 4, 3, 4, 3, 5, 4, 3, 5, 6, 0, 5, 2, 1, 3,
-	2, 6, 0, 2, 6, 1, 6, 5, 4, 1, 3, 4, 4, 3, 1, 6, 1, 6, 3, 2,
-	3, 5, 0, 5, 5, 2, 0, 5, 4, 0, 5, 0, 6, 4, 3, 1, 3, 6, 0, 3,
-	4, 0, 3, 4, 3, 2, 3, 1, 4, 1, 0, 1, 2, 0, 1, 5, 6, 0, 3, 6,
-	5, 1, 3, 2, 4, 6, 0, 4, 3, 0, 5, 0, 3, 0, 1, 3, 1, 0, 6, 0,
-	6, 6, 3, 2, 1, 2, 3, 1, 5, 0, 2, 1, 2, 3, 5, 3, 4, 6, 0, 3,
-	0, 6, 5, 3, 0, 5, 6, 0, 2, 4, 0, 2, 1, 5, 1, 1, 0, 2, 0, 6,
-	1, 3, 4, 5, 6, 5, 1, 5, 4, 2, 5, 6, 1, 6, 5, 4, 1, 2, 3, 2,
-	2, 4, 1, 6, 1, 5, 2, 1, 6, 1, 5, 1, 5, 2, 0, 3, 6, 1, 6, 0,
-	3, 5, 1, 3, 6, 4, 3, 0, 2, 4, 3, 5, 1, 4, 2, 3, 1, 0, 5, 2,
-	4, 5, 2, 3, 5, 0, 4, 3, 1, 5, 4, 5, 1, 0, 4, 5, 0, 6, 4, 2,
-	5, 2, 0, 4, 4, 1, 3, 1, 5, 0, 2, 6, 2, 5, 6, 2, 5, 0, 5, 6,
-	6, 2, 3, 0, 3, 6, 3, 1, 3, 2, 0, 6, 5, 1, 4, 0, 2, 1, 6, 0,
-	0, 3, 5, 0, 3, 1, 5, 4, 1, 1, 1, 4, 1, 5, 4, 0, 6, 2, 1, 0,
-	1, 3, 5, 1, 1, 2, 0, 4, 2, 1, 0, 1, 3, 0, 1, 3, 4, 5, 6, 1,
-	2, 5, 4, 2, 4, 0, 1, 0, 0, 5, 3, 6, 1, 3, 2, 3, 5, 1, 3, 0,
-	3, 6, 4, 1, 2, 4, 2, 4, 1, 5, 1, 0, 1, 4, 6, 3, 6, 2, 3, 0,
-	4, 3, 0, 6, 1, 6, 1, 6, 5, 0, 5, 6, 1, 2, 5, 0, 2, 6, 0, 6,
-	5, 4, 5, 0, 1, 4, 5, 3, 5, 4, 1, 0, 6, 1, 0, 3, 2, 1, 5, 5,
-	6, 2, 3, 4, 5, 1, 2, 1, 2, 6, 2, 4, 0, 3, 1, 5, 6, 1, 3, 6,
-	0, 1, 6, 0, 3, 5, 0, 3, 2, 0, 6, 0, 1, 5, 1, 3, 2, 5, 1, 0,
-	1, 5, 1, 0, 3, 4, 2, 5, 0, 1, 5, 4, 3, 5, 4, 2, 0, 3, 4, 1,
-	2, 3, 0, 6, 0, 1, 4, 0, 2, 0, 3, 6, 0, 4, 3, 2, 5, 3, 1, 2,
-	3, 2, 5, 1, 0, 6, 5, 2, 3, 2, 3, 1, 2, 3, 4, 1, 4, 1, 3, 0,
-	4, 6, 1, 0, 3, 1, 0, 4, 6, 5, 2, 6, 4, 1, 4, 5, 5, 0, 4, 2,
-	5, 4, 3, 2, 1, 2, 4, 4, 3, 2, 6, 5, 6, 5, 6, 5, 6, 1, 1, 2,
-	6, 0, 1, 5, 6, 5, 4, 1, 4, 2, 6, 5, 3, 0, 3, 0, 3, 1, 6, 1,
-	0, 3, 1, 3, 2, 1, 5, 6, 3, 6, 1, 6, 1, 5, 5, 6, 0, 6, 3, 6,
-	1, 1, 2, 5, 4, 6, 5, 3, 2, 3, 5, 2, 6, 5, 6, 1, 3, 6, 2, 1,
-	2, 3, 4, 3, 6, 4, 0, 5, 0, 3, 5, 0, 3, 6, 4, 2, 6, 1, 2, 3,
-	3, 6, 4, 5, 6, 2, 0, 6, 2, 4, 6, 3, 4, 2, 5, 1, 2, 4, 6, 2,
-	4, 6, 1, 1, 4, 2, 4, 0, 5, 6, 5, 4, 3, 2, 4, 5, 0, 5, 0, 5,
-	5, 0, 5, 6, 2, 6, 1, 2, 6, 1, 4, 5, 2, 4, 5, 2, 4, 0, 6, 3,
-	6, 2, 6, 3, 1, 3, 3, 0, 1, 0, 3, 4, 5, 4, 2, 5, 3, 3, 2, 4,
-	0, 5, 1, 5, 2, 0, 6, 5, 4, 5, 3, 0, 3, 2, 0, 2, 6, 5, 0, 4,
-	1, 6, 5, 1, 0, 1, 5, 1, 3, 6, 5, 3, 4, 5, 1, 3, 6, 4, 0, 0,
-	2, 0, 2, 4, 0, 2, 0, 3, 3, 5, 4, 0, 4, 2, 0, 1, 2, 3, 0, 2,
-	3, 5, 0, 6, 3, 1, 3, 1, 0, 2, 4, 3, 2, 3, 3, 2, 2, 1, 0, 3,
-	4, 5, 2, 6, 2, 0, 5, 3, 1, 5, 2, 1, 5, 3, 1, 3, 4, 2, 4, 6,
-	5, 6, 1, 2, 6, 5, 2, 3, 6, 6, 1, 5, 4, 1, 5, 6, 1, 3, 2, 4,
-	6, 4, 6, 2, 1, 0, 2, 5, 3, 4, 3, 3, 5, 2, 2, 6, 6, 1, 3, 1,
-	0, 2, 0, 4, 0, 2, 2, 4, 5, 1, 5, 3, 6, 4, 2, 5, 1, 3, 1, 1,
-	1, 6, 4, 0, 4, 6, 0, 4, 2, 5, 2, 6, 0, 4, 3, 0, 1, 4, 3, 5,
-	2, 1, 3, 6, 3, 4, 5, 1, 5, 1, 3, 0, 1, 0, 6, 0, 0, 4, 2, 5,
-	3, 2, 2, 4, 4, 4, 6, 4, 3, 1, 2, 4, 1, 0, 5, 0, 1, 3, 3, 6,
-	4, 6, 5, 0, 5, 6, 5, 3, 1, 6, 4, 2, 1, 3, 6, 3, 6, 4, 4, 6,
-	5, 4, 2, 4, 2, 4, 3, 1, 1, 4, 5, 1, 1, 5, 1, 2, 5, 1, 4, 2,
-	6, 5, 6, 0, 4, 0, 4, 0, 1, 4, 4, 4, 3, 6, 5, 2, 6, 4, 2, 6,
-	0, 4, 0, 2, 6, 5, 3, 3, 2, 3, 3, 4, 2, 3, 5, 3, 3, 1, 6, 4,
-	1, 5, 3, 4, 6, 2, 1, 4, 5, 6, 2, 5, 1, 3, 4, 5, 0, 6, 3, 1,
-	2, 0, 6, 2, 4, 0, 2, 5, 1, 2, 0, 6, 1, 3, 1, 5, 0, 2, 3, 4,
-	3, 1, 5, 2, 1, 1, 6, 1, 5, 4, 2, 1, 4, 2, 0, 4, 2, 5, 3, 1,
-	4, 5, 3, 0, 6, 1, 4, 6, 3, 4, 2, 1, 6, 0, 5, 4, 5, 4, 1, 2,
-	5, 6, 1, 2, 0, 4, 5, 3, 4, 0, 1, 0, 5, 3, 2, 0, 5, 1, 6, 4,
-	6, 4, 2, 6, 3, 2, 6, 0, 1, 2, 3, 2, 6, 0, 3, 2, 4, 5, 0, 4,
-	0, 1, 5, 1, 2, 3, 1, 4, 3, 2, 6, 3, 4, 5, 0, 3, 0, 6, 3, 6,
-	1, 3, 4, 3, 5, 1, 4, 0, 3, 3, 0, 6, 0, 6, 1, 0, 4, 2, 1, 6,
-	2, 5, 6, 3, 1, 2, 0, 3, 0, 1, 6, 3, 0, 1, 2, 2, 1, 0, 6, 2,
-	3, 3, 2, 4, 1, 2, 3, 0, 4, 3, 5, 2, 6, 2, 0, 2, 4, 0, 3, 4,
-	4, 6, 5, 6, 3, 2, 6, 0, 3, 1, 2, 5, 1, 3, 6, 5, 6, 3, 4, 0,
-	5, 2, 4, 3, 6, 2, 0, 6, 0, 4, 1, 2, 0, 1, 2, 1, 5, 1, 5, 1,
-	6, 3, 1, 6, 1, 0, 6, 1, 4, 2, 4, 6, 6, 4, 3, 0, 3, 6, 5, 6,
-	0, 5, 2, 3, 0, 3, 3, 1, 6, 6, 2, 1, 3, 6, 4, 3, 0, 5, 5, 2,
-	1, 3, 4, 2, 0, 1, 2, 3, 1, 4, 6, 2, 1, 0, 6, 4, 6, 3, 3, 0,
-	2, 5, 1, 0, 3, 2, 6, 4, 1, 3, 4, 0, 2, 4, 2, 3, 2, 1, 4, 6,
-	3, 6, 0, 6, 4, 3, 0, 5, 5, 2, 6, 2, 5, 1, 4, 5, 0, 6, 3, 4,
-	4, 3, 6, 6, 3, 2, 6, 5, 0, 1, 2, 5, 3, 2, 3, 2, 3, 2, 5, 0,
-	5, 2, 0, 5, 0, 6, 5, 5, 4, 1, 3, 0, 6, 2, 6, 0, 3, 0, 2, 1,
-	6, 3, 2, 1, 2, 4, 6, 5, 1, 2, 3, 0, 3, 5, 6, 0, 3, 3, 4, 3,
-	0, 5, 0, 1, 3, 0, 3, 4, 2, 5, 5, 2, 2, 5, 2, 5, 6, 2, 3, 0,
-	1, 6, 1, 4, 5, 6, 0, 1, 4, 6, 3, 0, 1, 5, 3, 6, 2, 0, 5, 4,
-	2, 0, 2, 3, 1, 6, 0, 1, 4, 1, 2, 3, 3, 2, 1, 5, 0, 3, 6, 6,
-	3, 4, 6, 5, 1, 1, 4, 6, 4, 4, 3, 5, 2, 5, 6, 1, 3, 4, 6, 2,
-	4, 2, 6, 4, 0, 6, 5, 3, 4, 1, 5, 1, 4, 6, 1, 3, 3, 2, 6, 2,
-	5, 3, 5, 0, 1, 2, 6, 0, 3, 2, 1, 1, 0, 1, 5, 3, 6, 1, 6, 1,
-	6, 5, 4, 0, 1, 3, 4, 1, 5, 2, 5, 4, 3, 2, 5, 0, 4, 2, 5, 3,
-	0, 6, 2, 1, 3, 6, 6, 2, 6, 5, 3, 1, 0, 3, 0, 6, 5, 1, 3, 4,
-	1, 2, 0, 6, 5, 2, 0, 6, 0, 2, 6, 0, 4, 5, 1, 5, 2, 6, 5, 6,
-	2, 4, 2, 0, 1, 3, 0, 3, 6, 0, 6, 4, 3, 6, 5, 1, 5, 2, 6, 5,
-	3, 2, 0, 1, 5, 4, 3, 5, 2, 4, 5, 4, 1, 3, 6, 1, 6, 4, 3, 6,
-	4, 6, 5, 1, 1, 3, 6, 4, 4, 6, 0, 4, 0, 2, 1, 6, 3, 4, 2, 4,
-	5, 2, 2, 4, 5, 1, 0, 4, 3, 2, 5, 6, 2, 6, 1, 6, 1, 3, 5, 2,
-	6, 3, 6, 2, 3, 0, 3, 1, 4, 1, 5, 0, 5, 1, 6, 1, 0, 3, 0, 6,
-	0, 3, 3, 6, 3, 2, 1, 4, 2, 3, 5, 3, 5, 6, 2, 4, 1, 2, 3, 4,
-	1, 6, 5, 1, 4, 3, 6, 2, 5, 4, 3, 2, 1, 0, 4, 5, 2, 3, 0, 5,
-	2, 0, 3, 1, 4, 5, 1, 4, 2, 1, 2, 6, 6, 0, 6, 5, 4, 2, 4, 3,
-	3, 2, 1, 4, 6, 3, 2, 4, 2, 6, 1, 3, 0, 5, 6, 5, 1, 0, 4, 2,
-	4, 5, 2, 5, 1, 5, 0, 2, 3, 5, 0, 5, 4, 5, 4, 0, 5, 2, 5, 1,
-	5, 4, 6, 0, 4, 0, 4, 0, 2, 2, 4, 3, 4, 0, 5, 1, 5, 3, 6, 5,
-	6, 5, 2, 6, 3, 1, 1, 4, 1, 4, 2, 6, 5, 0, 5, 6, 3, 2, 6, 2,
-	0, 1, 5, 4, 2, 4, 2, 1, 3, 0, 2, 6, 3, 5, 3, 4, 6, 0, 6, 4,
-	1, 5, 0, 2, 6, 1, 1, 1, 5, 2, 5, 2, 4, 2, 6, 4, 1, 1, 4, 2,
-	2, 6, 5, 0, 6, 4, 0, 4, 6, 3, 5, 0, 6, 2, 5, 0, 0, 4, 0, 4,
-	3, 6, 2, 3, 1, 4, 5, 6, 3, 4, 1, 5, 1, 6, 2, 3, 3, 1, 2, 0,
-	4, 1, 1, 4, 2, 6, 3, 6, 5, 6, 2, 0, 5, 1, 6, 1, 2, 3, 1, 0,
-	5, 4, 2, 6, 3, 5, 0, 6, 5, 6, 5, 6, 1, 1, 2, 5, 4, 5, 4, 6,
-	6, 0, 4, 0, 4, 3, 2, 1, 4, 0, 1, 3, 3, 1, 0, 1, 5, 2, 3, 4,
-	0, 1, 5, 2, 6, 5, 2, 3, 4, 0, 2, 6, 4, 2, 6, 1, 2, 0, 2, 3,
-	1, 6, 5, 6, 5, 0, 1, 4, 6, 3, 1, 3, 2, 3, 2, 5, 1, 2, 4, 1,
-	2, 3, 5, 1, 4, 1, 6, 6, 3, 4, 3, 1, 3, 3, 2, 4, 5, 2, 4, 0,
-	3, 4, 6, 0, 3, 5, 2, 3, 6, 1, 0, 5, 2, 4, 2, 4, 5, 2, 1, 3,
-	4, 0, 2, 1, 0, 1, 0, 4, 5, 1, 4, 3, 0, 4, 3, 3, 1, 5, 2, 1,
-	5, 1, 5, 3, 4, 2, 0, 3, 3, 4, 0, 4, 6, 0, 6, 4, 5, 3, 5, 3,
-	6, 2, 3, 1, 4, 3, 1, 1, 0, 1, 4, 2, 0, 1, 5, 3, 4, 6, 0, 5,
-	0, 5, 4, 1, 4, 3, 1, 4, 1, 2, 1, 3, 6, 1, 2, 3, 4, 6, 3, 3,
-	1, 6, 1, 6, 2, 6, 3, 0, 2, 4, 6, 1, 0, 5, 0, 6, 0, 3, 6, 2,
-	2, 5, 3, 6, 2, 4, 0, 3, 5, 4, 5, 4, 5, 6, 5, 4, 6, 5, 0, 4,
-	3, 5, 4, 6, 0, 0, 3, 5, 6, 3, 4, 2, 1, 6, 5, 4, 1, 1, 1, 5,
-	4, 0, 1, 4, 0, 5, 3, 4, 4, 3, 1, 5, 0, 3, 3, 2, 1, 3, 6, 3,
-	5, 1, 4, 6, 2, 5, 6, 5, 3, 5, 3, 1, 4, 1, 4, 3, 2, 0, 1, 6,
-	6, 1, 3, 2, 1, 5, 6, 0, 6, 6, 2, 5, 6, 4, 2, 3, 0, 1, 2, 3,
-	0, 4, 1, 3, 1, 1, 5, 6, 1, 5, 3, 0, 5, 1, 0, 6, 0, 3, 6, 3,
-	1, 3, 1, 4, 1, 5, 1, 4, 2, 1, 3, 5, 4, 0, 1, 5, 2, 5, 0, 5,
-	2, 4, 2, 1, 3, 1, 5, 1, 0, 1, 2, 4, 1, 5, 0, 6, 5, 2, 4, 6,
-	3, 6, 1, 2, 4, 6, 0, 1, 1, 2, 5, 3, 3, 5, 2, 1, 5, 6, 2, 6,
-	4, 6, 0, 4, 2, 0, 5, 3, 2, 3, 1, 2, 4, 3, 5, 4, 2, 6, 2, 6,
-	5, 2, 5, 2, 1, 6, 3, 2, 3, 2, 3, 0, 4, 5, 1, 3, 4, 2, 5, 0,
-	6, 3, 4, 6, 2, 0, 5, 4, 1, 6, 5, 3, 1, 4, 6, 0, 1, 5, 4, 0,
-	0, 3, 1, 6, 3, 2, 6, 0, 3, 1, 0, 4, 5, 1, 0, 4, 2, 1, 3, 6,
-	1, 3, 0, 5, 3, 4, 2, 0, 1, 3, 2, 1, 4, 5, 2, 0, 4, 5, 4, 5,
-	2, 1, 6, 5, 4, 1, 2, 4, 2, 0, 1, 4, 3, 2, 0, 6, 2, 1, 6, 4,
-	3, 6, 1, 3, 5, 4, 6, 4, 6, 6, 2, 5, 4, 1, 5, 2, 0, 6, 3, 5,
-	4, 2, 4, 5, 6, 1, 0, 5, 1, 6, 3, 2, 0, 5, 2, 4, 2, 3, 1, 5,
-	5, 1, 1, 0, 5, 6, 4, 5, 6, 4, 5, 4, 0, 1, 3, 2, 4, 0, 3, 2,
-	6, 3, 4, 4, 0, 2, 5, 6, 6, 5, 2, 0, 4, 6, 6, 4, 3, 0, 1, 2,
-	0, 4, 1, 1, 5, 0, 4, 3, 5, 0, 1, 5, 0, 1, 6, 3, 6, 4, 2, 4,
-	1, 3, 5, 0, 4, 1, 4, 5, 1, 6, 2, 6, 3, 4, 1, 2, 3, 2, 0, 4,
-	2, 5, 2, 1, 3, 6, 5, 0, 2, 4, 5, 1, 2, 0, 2, 3, 1, 2, 5, 3,
-	3, 6, 2, 5, 6, 1, 1, 4, 0, 5, 2, 1, 3, 0, 1, 2, 4, 5, 0, 2,
-	4, 0, 6, 4, 3, 1, 2, 6, 6, 1, 6, 3, 5, 4, 0, 6, 4, 0, 4, 1,
-	5, 6, 3, 1, 1, 4, 5, 4, 3, 6, 1, 2, 0, 3, 6, 1, 0, 3, 6, 5,
-	6, 1, 4, 3, 5, 0, 6, 1, 6, 4, 2, 0, 5, 2, 3, 5, 2, 3, 0, 2,
-	0, 2, 5, 2, 0, 2, 4, 3, 0, 3, 4, 3, 3, 0, 5, 0, 6, 1, 5, 1,
-	1, 6, 4, 2, 0, 5, 2, 3, 5, 4, 1, 2, 5, 1, 2, 5, 3, 2, 5, 2,
-	2, 5, 4, 6, 2, 3, 0, 2, 6, 1, 4, 1, 5, 4, 2, 0, 5, 4, 0, 3,
-	3, 5, 1, 2, 0, 0, 2, 0, 2, 5, 3, 1, 4, 5, 3, 3, 2, 4, 3, 5,
-	4, 3, 1, 0, 4, 6, 3, 5, 3, 2, 6, 2, 3, 1, 5, 4, 0, 6, 3, 4,
-	5, 3, 2, 3, 5, 1, 0, 6, 4, 3, 4, 5, 2, 5, 4, 2, 6, 6, 3, 4,
-	6, 3, 4, 0, 4, 1, 0, 5, 3, 6, 3, 5, 6, 2, 0, 3, 1, 0, 6, 4,
-	0, 4, 2, 6, 3, 2, 2, 4, 2, 4, 5, 0, 3, 0, 5, 3, 6, 5, 1, 3,
-	1, 5, 2, 4, 1, 6, 1, 3, 2, 3, 6, 2, 4, 5, 4, 3, 6, 0, 3, 4,
-	2, 6, 5, 6, 0, 3, 5, 0, 2, 5, 4, 2, 0, 4, 6, 3, 4, 2, 3, 5,
-	3, 4, 2, 5, 5, 6, 3, 0, 6, 3, 5, 1, 5, 3, 3, 6, 0, 4, 2, 1,
-	4, 2, 6, 4, 3, 0, 1, 3, 6, 1, 4, 3, 4, 0, 2, 5, 1, 3, 1, 4,
-	5, 1, 4, 3, 3, 4, 3, 4, 5, 1, 0, 6, 2, 5, 2, 2, 4, 2, 5, 3,
-	6, 5, 6, 2, 1, 6, 5, 1, 3, 0, 6, 0, 1, 4, 2, 3, 4, 1, 1, 4,
-	0, 5, 1, 1, 1, 3, 1, 2, 4, 3, 0, 4, 5, 1, 1, 2, 5, 2, 4, 0,
-	1, 6, 5, 1, 6, 2, 2, 1, 4, 1, 0, 6, 4, 6, 1, 4, 5, 0, 6, 1,
-	2, 3, 3, 5, 1, 4, 3, 6, 5, 3, 6, 2, 3, 5, 1, 6, 1, 4, 4, 5,
-	3, 0, 1, 4, 0, 5, 4, 2, 5, 4, 0, 1, 5, 5, 2, 6, 5, 0, 5, 6,
-	4, 3, 0, 6, 0, 4, 3, 4, 5, 1, 0, 6, 2, 0, 2, 3, 6, 1, 4, 0,
-	5, 1, 6, 0, 4, 3, 4, 1, 5, 0, 3, 1, 2, 4, 5, 0, 6, 5, 4, 0,
-	6, 2, 5, 0, 6, 2, 6, 2, 3, 5, 1, 4, 6, 3, 4, 2, 1, 5, 1, 3,
-	0, 4, 2, 6, 0, 3, 4, 3, 2, 4, 2, 4, 1, 3, 1, 0, 4, 0, 5, 6,
-	1, 5, 1, 0, 6, 0, 4, 6, 4, 5, 2, 0, 6, 5, 2, 5, 2, 2, 5, 2,
-	2, 5, 2, 5, 1, 5, 1, 0, 2, 0, 5, 3, 0, 4, 2, 5, 0, 1, 0, 2,
-	3, 0, 2, 4, 0, 6, 0, 4, 5, 4, 0, 5, 3, 0, 0, 2, 0, 6, 3, 1,
-	4, 6, 3, 0, 1, 1, 2, 5, 5, 0, 4, 2, 3, 5, 1, 6, 5, 1, 0, 2,
-	5, 3, 3, 2, 4, 1, 1, 4, 3, 1, 1, 6, 4, 1, 2, 1, 5, 6, 1, 4,
-	6, 2, 5, 0, 2, 5, 2, 0, 2, 6, 2, 6, 4, 5, 5, 2, 4, 5, 3, 0,
-	0, 3, 5, 1, 5, 6, 2, 5, 1, 2, 0, 2, 0, 3, 3, 3, 5, 0, 0, 2,
-	1, 4, 3, 6, 2, 4, 6, 4, 2, 0, 2, 3, 5, 2, 4, 6, 1, 6, 2, 4,
-	2, 6, 0, 3, 2, 5, 5, 2, 5, 0, 5, 6, 1, 3, 4, 0, 4, 6, 4, 0,
-	3, 2, 0, 2, 1, 5, 0, 5, 0, 5, 2, 4, 6, 4, 5, 6, 0, 2, 0, 3,
-	4, 0, 5, 1, 3, 6, 0, 3, 1, 3, 2, 0, 6, 2, 3, 4, 3, 1, 1, 3,
-	5, 2, 0, 4, 2, 3, 6, 4, 6, 5, 0, 4, 0, 4, 0, 4, 5, 1, 0, 6,
-	6, 6, 1, 0, 3, 3, 6, 5, 2, 0, 1, 3, 2, 1, 4, 0, 6, 0, 5, 0,
-	0, 3, 0, 4, 0, 6, 3, 5, 3, 6, 4, 4, 0, 2, 3, 0, 3, 0, 2, 6,
-	1, 5, 1, 3, 1, 5, 6, 1, 2, 6, 2, 4, 3, 5, 4, 3, 0, 2, 0, 6,
-	2, 1, 2, 0, 4, 5, 6, 4, 6, 5, 4, 2, 5, 5, 0, 6, 5, 2, 3, 2,
-	3, 5, 0, 4, 1, 0, 3, 5, 3, 4, 2, 0, 1, 3, 2, 5, 3, 2, 0, 6,
-	4, 3, 1, 5, 6, 0, 1, 6, 0, 4, 1, 0, 4, 3, 1, 6, 3, 5, 3, 5,
-	5, 4, 2, 0, 4, 2, 0, 6, 5, 6, 0, 3, 5, 4, 3, 1, 2, 1, 0, 3,
-	6, 0, 5, 1, 0, 3, 0, 5, 4, 3, 2, 1, 5, 1, 6, 1, 2, 1, 3, 1,
-	0, 5, 3, 0, 1, 5, 6, 0, 0, 6, 2, 5, 0, 1, 3, 3, 2, 0, 2, 0,
-	1, 5, 1, 0, 2, 6, 0, 6, 6, 1, 6, 2, 5, 1, 3, 4, 0, 1, 6, 2,
-	2, 5, 4, 1, 5, 3, 4, 1, 6, 0, 2, 1, 4, 5, 2, 2, 0, 2, 5, 0,
-	3, 4, 0, 3, 2, 5, 2, 1, 4, 2, 4, 6, 1, 5, 0, 0, 4, 3, 1, 5,
-	4, 0, 5, 4, 6, 2, 5, 1, 6, 5, 2, 4, 3, 3, 0, 4, 2, 0, 2, 3,
-	5, 6, 2, 2, 3, 2, 3, 4, 5, 1, 3, 6, 0, 4, 1, 5, 0, 5, 6, 5,
-	6, 4, 1, 5, 2, 6, 2, 0, 5, 3, 4, 1, 0, 2, 5, 0, 2, 3, 0, 3,
-	0, 3, 0, 6, 1, 4, 2, 4, 6, 2, 1, 4, 3, 6, 2, 1, 0, 6, 5, 1,
-	1, 2, 0, 2, 1, 4, 0, 6, 1, 3, 0, 5, 6, 0, 6, 2, 0, 1, 0, 4,
-	2, 0, 4, 0, 5, 4, 6, 0, 1, 6, 5, 0, 5, 1, 3, 0, 6, 4, 2, 6,
-	3, 5, 3, 5, 4, 6, 1, 4, 5, 0, 5, 1, 6, 2, 3, 5, 2, 6, 2, 2,
-	4, 2, 4, 0, 1, 2, 0, 5, 1, 4, 0, 3, 1, 2, 6, 4, 6, 5, 1, 4,
-	5, 4, 5, 3, 4, 3, 6, 3, 6, 0, 1, 5, 1, 5, 1, 0, 2, 5, 4, 5,
-	6, 5, 0, 3, 0, 2, 0, 6, 0, 4, 5, 1, 4, 6, 0, 4, 6, 5, 0, 2,
-	0, 2, 1, 6, 3, 3, 1, 5, 1, 0, 6, 0, 1, 4, 4, 3, 0, 2, 5, 1,
-	1, 4, 6, 0, 1, 4, 1, 5, 6, 3, 1, 3, 4, 0, 2, 1, 4, 0, 1, 0,
-	2, 6, 3, 4, 2, 1, 6, 2, 1, 6, 1, 6, 5, 4, 4, 2, 6, 4, 5, 2,
-	3, 2, 5, 4, 1, 3, 2, 6, 2, 4, 0, 5, 0, 4, 3, 1, 6, 4, 3, 2,
-	4, 6, 5, 2, 5, 2, 0, 2, 2, 3, 6, 0, 6, 6, 4, 5, 3, 4, 6, 4,
-	5, 6, 5, 6, 2, 4, 2, 0, 5, 2, 0, 2, 5, 0, 5, 4, 6, 1, 3, 2,
-	6, 2, 3, 0, 6, 5, 1, 0, 5, 4, 5, 0, 1, 0, 2, 6, 4, 3, 5, 4,
-	0, 3, 4, 5, 2, 0, 2, 0, 1, 4, 5, 3, 3, 6, 2, 0, 3, 6, 1, 4,
-	1, 3, 4, 2, 2, 5, 0, 4, 6, 5, 1, 2, 3, 6, 4, 6, 4, 5, 1, 5,
-	2, 6, 1, 2, 6, 2, 6, 5, 6, 2, 3, 5, 0, 5, 1, 5, 3, 4, 3, 5,
-	3, 1, 1, 6, 3, 5, 6, 3, 0, 3, 4, 1, 4, 3, 5, 4, 2, 0, 5, 2,
-	4, 0, 6, 2, 6, 0, 5, 1, 4, 1, 1, 5, 4, 3, 4, 2, 1, 5, 6, 2,
-	5, 4, 2, 1, 2, 3, 4, 4, 3, 1, 0, 5, 3, 1, 1, 5, 0, 3, 0, 6,
-	6, 4, 6, 5, 6, 3, 5, 2, 0, 0, 3, 3, 4, 0, 5, 1, 5, 1, 6, 1,
-	0, 4, 2, 4, 1, 6, 1, 3, 3, 3, 0, 2, 6, 0, 6, 1, 4, 3, 6, 2,
-	1, 0, 3, 1, 0, 5, 6, 6, 1, 6, 0, 0, 2, 2, 3, 1, 4, 6, 4, 0,
-	2, 6, 1, 4, 2, 1, 2, 0, 3, 6, 4, 6, 2, 3, 1, 3, 1, 6, 0, 2,
-	3, 1, 3, 2, 1, 0, 6, 4, 2, 3, 4, 5, 0, 1, 0, 1, 4, 0, 6, 4,
-	4, 5, 6, 2, 5, 2, 4, 5, 1, 3, 0, 3, 4, 6, 2, 5, 1, 3, 4, 3,
-	5, 0, 4, 2, 1, 5, 4, 3, 6, 0, 6, 3, 5, 0, 2, 0, 3, 0, 2, 3,
-	6, 2, 5, 2, 0, 2, 5, 0, 1, 5, 3, 0, 1, 6, 0, 3, 2, 4, 5, 1,
-	0, 2, 0, 2, 6, 2, 6, 0, 3, 0, 0, 1, 0, 6, 3, 6, 4, 6, 5, 4,
-	1, 2, 2, 1, 6, 5, 2, 6, 3, 2, 1, 3, 0, 2, 6, 2, 5, 4, 0, 4,
-	2, 3, 1, 5, 3, 1, 0, 6, 1, 1, 5, 2, 0, 4, 2, 6, 5, 4, 5, 2,
-	3, 3, 6, 2, 5, 3, 5, 0, 1, 3, 6, 2, 4, 2, 1, 3, 5, 3, 1, 5,
-	4, 5, 6, 0, 6, 2, 0, 0, 6, 3, 4, 1, 1, 2, 3, 4, 4, 5, 0, 4,
-	5, 1, 6, 2, 0, 3, 2, 6, 4, 1, 2, 5, 3, 1, 3, 2, 1, 0, 6, 0,
-	6, 4, 6, 1, 0, 3, 5, 1, 4, 1, 0, 6, 5, 3, 4, 6, 2, 5, 1, 6,
-	0, 3, 5, 4, 0, 4, 6, 1, 1, 6, 3, 0, 6, 2, 6, 2, 6, 3, 6, 5,
-	1, 6, 1, 2, 4, 3, 0, 3, 0, 6, 4, 0, 3, 6, 0, 1, 6, 6, 1, 6,
-	2, 4, 2, 3, 0, 5, 2, 3, 3, 5, 6, 3, 6, 3, 1, 2, 3, 5, 4, 0,
-	3, 1, 5, 0, 6, 1, 1, 3, 1, 3, 3, 1, 3, 4, 2, 5, 0, 5, 6, 0,
-	4, 5, 1, 3, 4, 1, 3, 0, 6, 3, 0, 1, 2, 0, 6, 2, 3, 0, 2, 6,
-	5, 0, 2, 3, 4, 2, 4, 6, 4, 2, 4, 2, 6, 0, 1, 5, 0, 3, 5, 2,
-	6, 5, 4, 1, 2, 1, 3, 2, 0, 0, 1, 4, 6, 4, 2, 3, 3, 6, 5, 3,
-	0, 3, 6, 4, 6, 4, 3, 5, 6, 1, 4, 2, 1, 4, 6, 1, 3, 4, 6, 1,
-	1, 6, 5, 4, 6, 3, 1, 6, 4, 1, 1, 2, 1, 2, 4, 5, 1, 5, 1, 3,
-	2, 1, 6, 3, 2, 4, 5, 4, 3, 0, 4, 0, 3, 1, 0, 4, 2, 4, 2, 1,
-	3, 6, 3, 5, 6, 0, 1, 3, 2, 5, 2, 3, 2, 6, 5, 6, 1, 4, 5, 3,
-	4, 2, 1, 5, 2, 3, 0, 1, 0, 6, 3, 2, 1, 6, 3, 6, 4, 2, 1, 3,
-	5, 6, 5, 2, 0, 1, 4, 0, 6, 5, 1, 2, 6, 4, 5, 3, 5, 0, 2, 5,
-	6, 0, 2, 4, 6, 2, 1, 3, 5, 3, 1, 0, 3, 2, 0, 4, 6, 1, 3, 1,
-	0, 6, 5, 6, 5, 6, 5, 1, 3, 5, 1, 3, 4, 0, 4, 3, 2, 0, 2, 6,
-	1, 5, 6, 3, 1, 3, 4, 4, 2, 1, 1, 3, 6, 2, 1, 5, 1, 4, 1, 6,
-	2, 4, 0, 3, 2, 1, 0, 5, 5, 6, 4, 1, 3, 1, 0, 4, 3, 4, 4, 2,
-	3, 6, 5, 4, 6, 3, 5, 1, 2, 4, 5, 5, 4, 2, 4, 3, 0, 3, 4, 5,
-	4, 2, 4, 2, 3, 2, 4, 3, 1, 1, 0, 4, 2, 4, 0, 6, 3, 5, 1, 2,
-	5, 4, 2, 1, 3, 0, 1, 2, 5, 1, 2, 0, 3, 5, 4, 1, 0, 0, 5, 6,
-	6, 3, 6, 5, 1, 4, 3, 2, 0, 2, 3, 6, 2, 4, 3, 6, 5, 5, 4, 0,
-	0, 3, 2, 5, 4, 0, 6, 5, 4, 5, 0, 4, 3, 5, 1, 2, 6, 1, 3, 1,
-	1, 6, 2, 5, 2, 2, 0, 1, 4, 0, 3, 4, 5, 1, 3, 1, 0, 0, 2, 5,
-	2, 1, 3, 6, 3, 5, 0, 1, 3, 2, 6, 2, 0, 1, 5, 3, 1, 4, 1, 6,
-	3, 3, 0, 6, 1, 6, 6, 4, 3, 1, 6, 3, 1, 6, 1, 5, 3, 0, 3, 0,
-	4, 6, 2, 5, 4, 5, 1, 6, 0, 5, 3, 6, 2, 5, 0, 5, 4, 6, 1, 6,
-	5, 2, 4, 3, 6, 4, 6, 0, 3, 4, 5, 6, 1, 0, 3, 2, 4, 2, 4, 2,
-	6, 1, 0, 4, 1, 5, 3, 2, 5, 6, 2, 3, 5, 2, 1, 6, 0, 1, 4, 5,
-	0, 2, 6, 0, 3, 6, 6, 2, 4, 2, 1, 6, 0, 5, 4, 4, 0, 5, 1, 4,
-	1, 5, 1, 0, 2, 4, 5, 6, 5, 1, 2, 0, 5, 1, 5, 6, 4, 2, 4, 3,
-	2, 4, 6, 2, 6, 0, 6, 4, 3, 2, 0, 3, 2, 1, 5, 3, 4, 3, 5, 2,
-	3, 5, 0, 1, 1, 4, 5, 6, 0, 0, 3, 1, 2, 6, 2, 3, 1, 3, 5, 1,
-	4, 2, 0, 2, 0, 6, 2, 3, 4, 1, 5, 2, 1, 2, 1, 2, 5, 4, 3, 1,
-	5, 4, 6, 5, 1, 5, 1, 3, 5, 1, 3, 1, 0, 4, 4, 1, 6, 5, 6, 1,
-	6, 4, 2, 4, 2, 4, 6, 0, 4, 3, 2, 3, 2, 0, 6, 4, 1, 6, 4, 3,
-	0, 0, 5, 0, 1, 0, 2, 5, 2, 5, 0, 6, 3, 2, 4, 3, 5, 6, 4, 6,
-	1, 3, 4, 5, 0, 6, 5, 3, 1, 3, 1, 3, 6, 0, 4, 3, 4, 5, 6, 2,
-	2, 4, 2, 5, 6, 4, 2, 0, 6, 0, 6, 0, 6, 1, 2, 1, 2, 0, 2, 1,
-	3, 6, 0, 4, 2, 1, 3, 1, 2, 3, 0, 3, 0, 4, 3, 2, 4, 5, 1, 5,
-	4, 0, 4, 6, 5, 1, 5, 6, 3, 1, 6, 1, 5, 6, 2, 4, 2, 6, 4, 5,
-	5, 0, 4, 6, 1, 4, 1, 3, 5, 3, 3, 1, 0, 6, 4, 0, 6, 4, 1, 4,
-	6, 1, 0, 2, 5, 1, 3, 2, 1, 2, 1, 4, 6, 0, 2, 3, 4, 0, 3, 1,
-	0, 3, 6, 1, 4, 0, 2, 6, 4, 1, 5, 1, 6, 4, 2, 3, 4, 6, 1, 4,
-	1, 6, 3, 5, 0, 6, 4, 0, 5, 3, 2, 0, 1, 6, 3, 0, 5, 0, 4, 0,
-	2, 4, 3, 0, 2, 4, 3, 6, 3, 2, 6, 2, 4, 3, 2, 4, 3, 2, 6, 5,
-	3, 2, 0, 6, 4, 0, 6, 2, 6, 2, 5, 6, 2, 6, 0, 3, 6, 5, 4, 1,
-	4, 1, 4, 6, 4, 1, 5, 1, 6, 3, 1, 5, 6, 3, 4, 0, 6, 3, 6, 6,
-	5, 3, 0, 1, 5, 4, 3, 6, 4, 5, 0, 5, 0, 5, 0, 6, 3, 2, 0, 5,
-	6, 0, 3, 5, 2, 5, 4, 3, 6, 4, 6, 0, 5, 1, 2, 1, 0, 6, 5, 6,
-	0, 6, 4, 5, 4, 2, 4, 2, 0, 1, 4, 6, 1, 3, 5, 6, 0, 4, 4, 6,
-	1, 6, 2, 0, 5, 4, 5, 6, 1, 3, 1, 0, 1, 2, 1, 1, 5, 4, 5, 3,
-	2, 6, 4, 1, 5, 6, 5, 1, 2, 4, 2, 5, 0, 3, 5, 4, 0, 5, 6, 5,
-	3, 5, 3, 0, 1, 5, 1, 4, 4, 1, 2, 2, 5, 4, 0, 4, 2, 1, 5, 6,
-	4, 1, 2, 1, 4, 2, 3, 2, 6, 4, 1, 6, 4, 3, 0, 1, 4, 2, 0, 0,
-	5, 0, 6, 0, 1, 0, 5, 1, 6, 2, 1, 2, 0, 3, 2, 4, 0, 2, 1, 5,
-	6, 2, 1, 2, 3, 0, 4, 6, 3, 5, 4, 3, 0, 5, 1, 2, 1, 3, 0, 5,
-	0, 3, 1, 6, 1, 2, 0, 1, 2, 0, 0, 6, 5, 0, 1, 3, 2, 5, 2, 4,
-	1, 4, 0, 1, 5, 1, 3, 3, 0, 6, 2, 6, 5, 2, 4, 3, 0, 3, 4, 1,
-	2, 4, 1, 6, 5, 1, 0, 1, 6, 4, 2, 3, 2, 5, 3, 4, 1, 2, 6, 5,
-	3, 1, 6, 4, 5, 5, 1, 2, 4, 0, 1, 2, 1, 2, 5, 0, 3, 2, 0, 2,
-	4, 4, 3, 6, 2, 2, 4, 0, 3, 3, 0, 2, 0, 5, 6, 2, 5, 5, 2, 1,
-	5, 1, 3, 0, 5, 4, 1, 0, 6, 4, 1, 1, 3, 4, 1, 0, 2, 5, 2, 5,
-	6, 2, 1, 5, 4, 4, 2, 1, 0, 1, 2, 5, 0, 0, 6, 3, 3, 4, 5, 1,
-	0, 6, 4, 1, 3, 3, 0, 4, 3, 2, 5, 0, 4, 6, 2, 1, 4, 0, 3, 1,
-	1, 4, 3, 1, 0, 2, 5, 4, 5, 0, 4, 5, 5, 1, 0, 6, 1, 6, 1, 5,
-	2, 3, 4, 2, 4, 0, 4, 2, 1, 4, 5, 2, 5, 2, 0, 4, 6, 0, 4, 6,
-	3, 5, 1, 6, 4, 1, 6, 3, 0, 5, 3, 2, 3, 4, 2, 4, 5, 1, 2, 0,
-	4, 1, 2, 0, 6, 1, 1, 3, 5, 1, 5, 4, 5, 3, 0, 3, 5, 6, 2, 2,
-	5, 2, 0, 2, 0, 5, 4, 5, 4, 5, 4, 1, 3, 2, 0, 0, 5, 0, 6, 1,
-	6, 2, 6, 5, 3, 4, 6, 5, 4, 3, 5, 0, 4, 2, 6, 2, 3, 6, 5, 0,
-	0, 1, 2, 0, 2, 4, 3, 5, 6, 1, 4, 6, 2, 4, 5, 0, 2, 1, 3, 3,
-	1, 6, 5, 3, 2, 4, 4, 5, 0, 6, 4, 2, 0, 6, 2, 6, 3, 0, 3, 2,
-	2, 0, 4, 0, 0, 5, 5, 6, 4, 2, 0, 2, 3, 4, 6, 5, 6, 3, 2, 5,
-	3, 3, 1, 6, 6, 0, 3, 5, 3, 2, 4, 2, 6, 2, 4, 2, 0, 5, 1, 3,
-	4, 1, 0, 6, 0, 6, 6, 2, 0, 6, 5, 3, 2, 1, 2, 6, 1, 4, 5, 1,
-	5, 6, 4, 1, 0, 5, 2, 5, 4, 4, 2, 0, 5, 1, 2, 3, 5, 6, 2, 1,
-	6, 4, 3, 4, 2, 5, 1, 0, 5, 0, 1, 3, 2, 5, 0, 3, 2, 5, 2, 5,
-	0, 2, 5, 0, 4, 0, 2, 3, 0, 6, 3, 1, 3, 6, 4, 5, 1, 5, 0, 4,
-	1, 3, 4, 2, 5, 6, 0, 1, 6, 4, 2, 0, 2, 1, 4, 0, 6, 6, 4, 5,
-	2, 6, 5, 0, 6, 3, 5, 3, 1, 0, 5, 6, 5, 0, 3, 6, 2, 5, 1, 2,
-	3, 0, 1, 1, 2, 4, 5, 2, 3, 0, 1, 6, 6, 3, 0, 6, 3, 6, 1, 5,
-	4, 6, 5, 4, 0, 2, 6, 3, 5, 0, 2, 5, 6, 3, 6, 2, 6, 0, 1, 5,
-	5, 0, 3, 1, 3, 5, 0, 0, 5, 1, 4, 5, 5, 1, 5, 4, 6, 0, 2, 4,
-	6, 0, 2, 1, 6, 4, 2, 2, 0, 6, 3, 2, 1, 2, 0, 5, 6, 1, 0, 4,
-	0, 6, 2, 6, 3, 1, 0, 1, 0, 6, 5, 4, 4, 0, 4, 1, 6, 4, 0, 3,
-	1, 3, 5, 6, 4, 6, 4, 6, 5, 3, 1, 3, 0, 6, 3, 1, 6, 1, 3, 4,
-	2, 3, 5, 1, 4, 3, 1, 0, 1, 1, 0, 2, 1, 1, 3, 2, 4, 3, 5, 4,
-	3, 3, 1, 6, 1, 3, 4, 5, 1, 4, 2, 3, 2, 3, 1, 1, 5, 6, 5, 0,
-	4, 6, 4, 4, 3, 5, 3, 2, 5, 3, 2, 2, 3, 1, 1, 3, 5, 3, 0, 6,
-	5, 1, 0, 3, 0, 4, 2, 4, 3, 6, 2, 3, 4, 6, 3, 2, 3, 2, 0, 6,
-	6, 2, 6, 2, 4, 6, 1, 0, 4, 1, 2, 1, 5, 6, 5, 3, 5, 0, 1, 2,
-	0, 4, 6, 1, 5, 6, 3, 1, 2, 6, 1, 0, 3, 4, 3, 0, 6, 1, 4, 5,
-	1, 3, 0, 5, 1, 1, 3, 0, 2, 0, 4, 3, 3, 6, 0, 6, 0, 5, 1, 2,
-	2, 4, 1, 4, 2, 3, 0, 6, 0, 3, 5, 4, 2, 0, 1, 2, 1, 2, 3, 0,
-	3, 1, 0, 1, 5, 4, 6, 5, 3, 1, 3, 5, 3, 4, 0, 5, 6, 6, 4, 3,
-	4, 0, 4, 1, 0, 6, 2, 1, 4, 1, 2, 4, 5, 1, 5, 3, 6, 6, 5, 4,
-	5, 0, 4, 2, 5, 4, 3, 1, 2, 1, 0, 6, 2, 1, 0, 6, 0, 1, 6, 2,
-	6, 1, 1, 0, 2, 6, 3, 4, 1, 0, 2, 4, 1, 0, 4, 1, 0, 6, 0, 2,
-	0, 1, 1, 5, 1, 4, 5, 0, 4, 1, 5, 6, 4, 0, 1, 5, 1, 2, 1, 0,
-	1, 4, 2, 3, 6, 3, 4, 4, 2, 1, 6, 2, 5, 1, 0, 6, 3, 6, 1, 3,
-	2, 0, 2, 1, 4, 1, 4, 6, 1, 3, 2, 3, 4, 6, 0, 5, 4, 6, 5, 6,
-	3, 2, 6, 3, 4, 2, 4, 3, 0, 3, 2, 6, 5, 6, 2, 3, 0, 2, 6, 3,
-	4, 1, 0, 4, 5, 2, 4, 2, 3, 0, 3, 4, 0, 5, 2, 4, 4, 5, 4, 6,
-	5, 6, 5, 2, 4, 0, 2, 3, 1, 3, 3, 6, 4, 5, 4, 1, 3, 5, 6, 1,
-	6, 5, 4, 5, 1, 3, 2, 6, 0, 6, 2, 3, 2, 5, 0, 6, 4, 0, 2, 6,
-	0, 3, 4, 5, 3, 6, 2, 4, 3, 1, 6, 5, 6, 5, 1, 2, 2, 3, 6, 3,
-	1, 5, 2, 5, 4, 1, 6, 2, 5, 4, 1, 0, 3, 6, 0, 4, 2, 0, 1, 0,
-	2, 6, 1, 0, 6, 1, 3, 1, 0, 2, 5, 1, 0, 5, 3, 5, 1, 6, 0, 1,
-	3, 1, 5, 3, 5, 6, 4, 6, 2, 0, 3, 6, 2, 3, 0, 3, 5, 1, 0, 3,
-	4, 3, 6, 4, 5, 1, 3, 0, 6, 4, 1, 2, 1, 4, 0, 4, 5, 0, 6, 0,
-	5, 1, 2, 0, 4, 2, 0, 6, 0, 1, 1, 6, 3, 4, 1, 3, 1, 0, 1, 5,
-	6, 4, 1, 0, 5, 0, 5, 0, 5, 6, 3, 4, 6, 1, 4, 6, 0, 3, 1, 4,
-	0, 1, 0, 6, 2, 4, 2, 1, 6, 6, 2, 4, 5, 2, 4, 6, 2, 1, 4, 1,
-	1, 4, 3, 4, 3, 5, 1, 6, 3, 5, 5, 0, 4, 3, 0, 3, 1, 6, 0, 3,
-	2, 1, 3, 4, 1, 4, 6, 3, 3, 3, 0, 3, 5, 0, 1, 4, 6, 5, 2, 0,
-	3, 0, 5, 3, 2, 1, 0, 1, 1, 0, 4, 1, 3, 5, 2, 2, 4, 5, 6, 2,
-	4, 5, 3, 6, 0, 3, 4, 1, 3, 2, 4, 5, 2, 1, 1, 2, 5, 6, 5, 0,
-	5, 4, 1, 2, 0, 2, 6, 4, 1, 4, 2, 0, 4, 2, 4, 0, 6, 5, 5, 6,
-	6, 5, 3, 2, 5, 1, 2, 6, 2, 4, 0, 1, 5, 3, 2, 1, 4, 6, 3, 6,
-	0, 6, 2, 3, 2, 3, 3, 1, 6, 1, 6, 6, 5, 3, 0, 5, 2, 6, 4, 4,
-	1, 2, 6, 1, 2, 3, 4, 3, 1, 3, 1, 5, 3, 3, 2, 4, 3, 1, 5, 2,
-	2, 6, 5, 2, 5, 3, 6, 4, 0, 4, 5, 5, 4, 3, 4, 1, 6, 4, 3, 6,
-	3, 4, 0, 3, 0, 4, 0, 6, 0, 2, 4, 1, 6, 5, 1, 6, 2, 5, 1, 5,
-	4, 1, 5, 2, 1, 1, 4, 2, 1, 6, 3, 4, 1, 3, 1, 6, 2, 3, 2, 1,
-	5, 0, 0, 4, 3, 5, 2, 0, 4, 0, 2, 4, 5, 0, 4, 2, 0, 3, 6, 0,
-	6, 6, 4, 5, 3, 6, 3, 4, 5, 0, 5, 2, 6, 3, 0, 5, 2, 3, 4, 1,
-	0, 5, 6, 0, 6, 2, 5, 0, 3, 2, 6, 5, 3, 2, 4, 3, 2, 3, 0, 5,
-	1, 0, 4, 2, 0, 3, 1, 6, 2, 1, 4, 3, 1, 1, 4, 3, 1, 5, 4, 6,
-	2, 4, 6, 2, 0, 4, 6, 0, 6, 3, 2, 0, 6, 2, 4, 2, 0, 1, 1, 6,
-	3, 4, 1, 4, 0, 4, 3, 1, 3, 6, 2, 6, 2, 4, 6, 5, 2, 1, 5, 2,
-	4, 4, 6, 3, 0, 4, 6, 4, 2, 1, 2, 3, 1, 0, 3, 1, 1, 2, 3, 4,
-	5, 1, 3, 1, 4, 5, 0, 2, 3, 5, 6, 2, 5, 2, 3, 0, 1, 5, 0, 6,
-	6, 1, 1, 0, 1, 6, 4, 0, 2, 1, 3, 5, 6, 5, 1, 6, 1, 2, 3, 2,
-	0, 6, 3, 3, 0, 4, 2, 6, 2, 1, 4, 2, 3, 4, 5, 5, 4, 0, 3, 2,
-	1, 2, 4, 5, 1, 6, 2, 2, 0, 2, 0, 2, 5, 3, 6, 5, 6, 1, 0, 2,
-	2, 6, 6, 5, 6, 0, 5, 1, 2, 4, 0, 2, 6, 1, 6, 0, 1, 6, 5, 4,
-	3, 3, 1, 3, 2, 0, 1, 6, 4, 3, 1, 5, 0, 4, 1, 2, 1, 1, 3, 0,
-	4, 2, 6, 0, 6, 4, 2, 0, 4, 0, 6, 1, 3, 4, 5, 0, 3, 5, 1, 6,
-	5, 6, 0, 6, 2, 1, 4, 0, 1, 3, 5, 2, 0, 5, 0, 6, 3, 6, 0, 4,
-	6, 2, 6, 6, 3, 6, 1, 6, 2, 1, 3, 2, 3, 5, 2, 6, 4, 1, 4, 5,
-	0, 6, 2, 3, 4, 2, 4, 1, 2, 0, 6, 3, 5, 0, 5, 1, 6, 2, 6, 4,
-	1, 6, 0, 6, 0, 4, 3, 5, 1, 5, 3, 2, 0, 4, 3, 6, 1, 6, 1, 4,
-	2, 6, 3, 1, 6, 5, 4, 5, 3, 4, 5, 0, 3, 5, 1, 1, 5, 1, 3, 6,
-	3, 1, 0, 1, 3, 4, 3, 6, 3, 5, 4, 5, 2, 6, 5, 1, 6, 2, 6, 3,
-	4, 5, 6, 3, 5, 1, 5, 1, 2, 0, 5, 6, 5, 1, 0, 3, 2, 0, 3, 2,
-	5, 0, 5, 6, 4, 3, 2, 6, 4, 2, 4, 3, 4, 0, 6, 5, 0, 2, 3, 5,
-	6, 2, 5, 2, 6, 2, 3, 0, 3, 2, 6, 1, 2, 1, 2, 6, 1, 3, 0, 2,
-	0, 6, 2, 5, 4, 6, 1, 0, 5, 1, 1, 5, 3, 6, 5, 6, 4, 2, 1, 3,
-	1, 6, 0, 4, 0, 2, 6, 2, 4, 5, 5, 3, 0, 3, 2, 3, 2, 5, 6, 4,
-	2, 4, 5, 1, 0, 4, 4, 5, 4, 2, 0, 4, 3, 4, 2, 0, 1, 4, 3, 0,
-	3, 5, 3, 4, 6, 0, 3, 6, 1, 4, 6, 1, 4, 0, 2, 4, 0, 2, 5, 1,
-	4, 0, 1, 6, 5, 0, 4, 0, 3, 6, 1, 6, 0, 3, 1, 5, 4, 1, 0, 3,
-	5, 3, 2, 3, 5, 6, 4, 3, 2, 5, 1, 3, 5, 2, 0, 6, 2, 0, 2, 4,
-	6, 0, 6, 4, 6, 2, 6, 0, 1, 5, 2, 0, 2, 6, 3, 0, 5, 3, 6, 1,
-	0, 2, 0, 1, 6, 3, 2, 0, 3, 4, 0, 4, 1, 6, 5, 5, 0, 4, 1, 4,
-	1, 0, 4, 6, 2, 1, 2, 3, 4, 2, 0, 4, 6, 2, 4, 2, 0, 1, 3, 0,
-	2, 3, 6, 3, 1, 2, 5, 6, 6, 4, 2, 2, 0, 3, 0, 2, 0, 6, 2, 2,
-	3, 6, 5, 0, 6, 3, 4, 0, 4, 5, 1, 6, 1, 4, 6, 3, 5, 1, 5, 6,
-	4, 1, 5, 2, 1, 6, 5, 6, 0, 4, 2, 5, 4, 5, 0, 6, 4, 4, 3, 5,
-	5, 2, 5, 0, 4, 2, 5, 1, 5, 3, 6, 0, 4, 5, 2, 1, 1, 5, 3, 2,
-	6, 5, 2, 1, 4, 0, 3, 2, 4, 1, 6, 0, 6, 2, 0, 4, 6, 1, 5, 4,
-	0, 3, 6, 1, 4, 2, 6, 4, 3, 6, 2, 0, 6, 2, 6, 0, 6, 4, 0, 1,
-	1, 1, 5, 3, 3, 5, 0, 5, 2, 5, 2, 3, 5, 1, 6, 4, 2, 0, 1, 4,
-	2, 5, 3, 1, 3, 1, 6, 2, 3, 2, 1, 1, 3, 2, 4, 1, 5, 4, 1, 0,
-	3, 2, 2, 4, 2, 6, 1, 6, 1, 0, 6, 0, 6, 0, 1, 4, 1, 0, 6, 5,
-	4, 5, 6, 1, 6, 4, 3, 4, 0, 5, 3, 5, 2, 3, 6, 2, 4, 6, 5, 2,
-	5, 4, 2, 6, 2, 6, 0, 2, 1, 2, 6, 3, 4, 0, 1, 3, 6, 2, 6, 4,
-	6, 4, 0, 1, 0, 2, 3, 0, 3, 2, 6, 2, 1, 3, 5, 1, 2, 3, 0, 0,
-	0, 3, 2, 6, 5, 4, 2, 3, 4, 5, 2, 6, 0, 3, 1, 2, 0, 5, 3, 1,
-	1, 2, 5, 6, 2, 3, 1, 4, 5, 4, 6, 2, 0, 3, 5, 6, 4, 1, 2, 6,
-	2, 1, 5, 0, 2, 1, 4, 5, 0, 1, 5, 3, 1, 5, 4, 1, 6, 1, 5, 1,
-	3, 1, 1, 0, 4, 0, 4, 3, 6, 0, 6, 3, 5, 6, 5, 6, 2, 0, 6, 2,
-	4, 5, 3, 2, 1, 6, 4, 6, 1, 0, 4, 0, 5, 2, 6, 5, 2, 0, 6, 1,
-	5, 3, 1, 2, 1, 0, 0, 2, 6, 2, 4, 0, 5, 4, 3, 3, 6, 0, 3, 0,
-	6, 5, 2, 5, 1, 6, 2, 1, 2, 0, 4, 1, 5, 2, 5, 6, 5, 0, 4, 5,
-	0, 6, 1, 5, 2, 5, 3, 1, 3, 0, 6, 5, 3, 6, 2, 0, 2, 5, 3, 0,
-	1, 6, 5, 3, 0, 6, 1, 1, 6, 3, 5, 3, 4, 2, 0, 2, 6, 5, 0, 4,
-	2, 0, 5, 2, 6, 0, 2, 3, 1, 2, 6, 5, 6, 2, 0, 1, 0, 2, 5, 6,
-	3, 6, 5, 4, 0, 1, 3, 4, 0, 3, 0, 2, 5, 4, 3, 0, 6, 1, 3, 5,
-	4, 3, 0, 6, 6, 0, 6, 2, 1, 4, 2, 0, 1, 1, 3, 0, 5, 6, 0, 3,
-	5, 2, 6, 5, 1, 0, 5, 2, 3, 1, 5, 1, 3, 5, 4, 2, 5, 3, 2, 6,
-	6, 5, 6, 3, 4, 2, 0, 2, 6, 1, 1, 1, 5, 6, 5, 0, 6, 2, 5, 3,
-	0, 0, 6, 3, 0, 5, 1, 0, 6, 0, 2, 0, 2, 4, 3, 2, 1, 4, 0, 1,
-	1, 6, 5, 3, 5, 6, 4, 6, 2, 3, 5, 1, 0, 2, 6, 3, 6, 5, 4, 3,
-	2, 6, 2, 4, 1, 2, 6, 2, 4, 5, 1, 6, 2, 4, 2, 0, 6, 5, 2, 4,
-	3, 0, 6, 3, 4, 3, 2, 4, 2, 1, 2, 5, 2, 5, 1, 1, 0, 0, 3, 2,
-	4, 2, 1, 6, 4, 6, 2, 1, 3, 2, 5, 0, 5, 6, 4, 2, 5, 6, 3, 1,
-	5, 0, 2, 6, 5, 6, 4, 5, 6, 2, 4, 2, 1, 5, 0, 4, 2, 6, 3, 0,
-	6, 3, 0, 4, 3, 5, 1, 5, 0, 0, 2, 5, 0, 1, 4, 1, 6, 2, 4, 2,
-	0, 3, 3, 1, 3, 0, 1, 4, 4, 5, 1, 0, 0, 2, 3, 1, 5, 0, 3, 2,
-	1, 2, 1, 6, 2, 6, 5, 4, 4, 1, 4, 2, 0, 6, 4, 4, 6, 0, 2, 5,
-	2, 0, 6, 4, 2, 2, 0, 6, 5, 2, 1, 2, 0, 1, 3, 3, 5, 3, 3, 1,
-	3, 4, 5, 2, 0, 1, 5, 6, 2, 0, 5, 6, 5, 2, 5, 0, 4, 4, 2, 4,
-	4, 5, 6, 1, 2, 1, 2, 0, 6, 5, 0, 5, 4, 5, 2, 1, 3, 0, 5, 3,
-	5, 2, 2, 5, 0, 3, 4, 6, 6, 3, 1, 4, 6, 1, 3, 0, 5, 1, 6, 1,
-	6, 2, 6, 2, 5, 1, 2, 1, 3, 1, 2, 6, 0, 5, 2, 6, 1, 3, 1, 6,
-	0, 3, 2, 5, 1, 3, 2, 1, 6, 2, 6, 0, 5, 2, 2, 1, 6, 0, 0, 3,
-	1, 4, 6, 5, 1, 4, 3, 4, 1, 3, 3, 4, 1, 2, 1, 6, 2, 6, 5, 6,
-	2, 1, 6, 3, 5, 1, 2, 0, 2, 2, 1, 6, 1, 0, 5, 0, 4, 1, 2, 4,
-	3, 3, 4, 6, 2, 3, 3, 2, 3, 6, 4, 5, 6, 5, 4, 3, 1, 6, 3, 4,
-	4, 5, 3, 0, 1, 0, 3, 4, 1, 3, 2, 5, 2, 0, 1, 4, 1, 2, 0, 1,
-	5, 3, 1, 6, 6, 5, 1, 4, 2, 0, 6, 3, 5, 4, 5, 4, 5, 1, 2, 1,
-	6, 5, 4, 2, 1, 3, 5, 0, 4, 5, 3, 5, 2, 2, 0, 2, 4, 0, 4, 3,
-	0, 6, 4, 6, 6, 2, 3, 5, 4, 5, 4, 5, 4, 6, 3, 1, 2, 6, 0, 5,
-	1, 6, 4, 1, 0, 3, 6, 2, 3, 6, 1, 4, 0, 5, 3, 4, 3, 4, 3, 4,
-	2, 3, 3, 6, 2, 5, 6, 1, 0, 3, 1, 5, 0, 3, 6, 4, 2, 2, 0, 5,
-	3, 4, 1, 4, 0, 3, 1, 4, 2, 6, 4, 2, 0, 3, 1, 2, 5, 6, 0, 5,
-	4, 2, 4, 4, 3, 1, 2, 0, 4, 6, 2, 2, 3, 2, 3, 0, 6, 0, 4, 1,
-	5, 1, 4, 3, 6, 5, 0, 5, 0, 4, 4, 3, 1, 5, 0, 1, 5, 4, 4, 6,
-	6, 4, 5, 0, 6, 3, 6, 4, 4, 1, 2, 0, 4, 1, 5, 6, 1, 5, 4, 6,
-	0, 4, 2, 0, 3, 4, 0, 6, 1, 2, 0, 5, 3, 4, 1, 4, 5, 5, 0, 1,
-	1, 5, 4, 3, 4, 0, 4, 1, 0, 4, 3, 6, 0, 3, 0, 0, 1, 3, 1, 2,
-	2, 6, 0, 2, 0, 2, 5, 2, 4, 6, 2, 6, 2, 4, 3, 4, 2, 5, 2, 3,
-	3, 4, 3, 2, 1, 5, 6, 0, 6, 4, 2, 1, 5, 4, 0, 5, 6, 4, 0, 5,
-	4, 3, 1, 5, 1, 6, 3, 1, 0, 3, 4, 2, 1, 6, 1, 3, 4, 3, 4, 1,
-	5, 1, 4, 3, 5, 1, 0, 6, 2, 0, 3, 2, 0, 6, 2, 5, 6, 3, 1, 5,
-	6, 5, 1, 3, 6, 4, 2, 6, 4, 3, 0, 4, 0, 1, 6, 0, 2, 0, 5, 1,
-	0, 1, 6, 0, 2, 1, 2, 4, 0, 5, 0, 3, 0, 0, 3, 4, 2, 4, 5, 3,
-	1, 5, 2, 4, 3, 6, 2, 4, 2, 5, 3, 1, 2, 6, 5, 1, 2, 6, 1, 0,
-	2, 3, 3, 5, 2, 6, 4, 5, 6, 4, 2, 6, 5, 4, 6, 2, 3, 4, 6, 2,
-	3, 1, 5, 0, 1, 6, 0, 1, 4, 6, 4, 6, 2, 4, 6, 1, 6, 2, 6, 3,
-	4, 6, 0, 3, 1, 6, 3, 0, 3, 6, 0, 0, 3, 1, 2, 2, 6, 4, 3, 1,
-	5, 4, 3, 4, 3, 1, 3, 4, 5, 2, 1, 0, 5, 0, 3, 4, 0, 2, 3, 0,
-	6, 5, 4, 5, 2, 4, 6, 6, 0, 2, 6, 5, 5, 6, 4, 1, 3, 6, 0, 6,
-	0, 1, 5, 1, 0, 3, 1, 1, 2, 0, 5, 1, 0, 2, 0, 2, 6, 3, 4, 2,
-	1, 2, 3, 0, 5, 3, 2, 6, 5, 4, 2, 3, 3, 6, 0, 5, 6, 5, 2, 3,
-	2, 6, 0, 1, 3, 0, 4, 5, 2, 1, 5, 1, 2, 6, 5, 1, 2, 6, 3, 5,
-	3, 6, 4, 5, 2, 5, 1, 3, 6, 3, 0, 5, 0, 6, 3, 4, 5, 6, 2, 3,
-	4, 3, 3, 2, 6, 3, 3, 5, 1, 6, 4, 1, 6, 3, 3, 1, 5, 6, 4, 6,
-	5, 3, 0, 4, 5, 6, 3, 2, 5, 2, 0, 4, 3, 1, 3, 4, 2, 3, 4, 0,
-	6, 3, 5, 6, 3, 0, 1, 0, 0, 4, 5, 4, 0, 6, 4, 3, 2, 3, 0, 6,
-	0, 3, 4, 0, 5, 5, 1, 5, 2, 0, 6, 1, 3, 2, 0, 2, 5, 6, 2, 6,
-	1, 4, 5, 2, 4, 2, 1, 4, 5, 6, 2, 1, 5, 0, 2, 3, 4, 2, 6, 3,
-	2, 5, 2, 0, 6, 1, 6, 0, 2, 3, 0, 1, 3, 1, 3, 6, 4, 0, 1, 2,
-	3, 0, 6, 1, 4, 1, 0, 2, 5, 3, 2, 1, 2, 3, 2, 5, 1, 6, 2, 6,
-	4, 2, 1, 2, 0, 5, 3, 0, 2, 3, 1, 4, 1, 2, 1, 2, 2, 3, 5, 1,
-	5, 4, 2, 5, 6, 6, 3, 4, 2, 4, 6, 2, 3, 4, 1, 5, 3, 5, 3, 5,
-	6, 4, 5, 2, 4, 1, 0, 2, 1, 5, 5, 2, 6, 4, 2, 3, 4, 5, 4, 5,
-	0, 6, 1, 6, 0, 3, 5, 3, 6, 1, 2, 3, 1, 2, 0, 6, 4, 5, 6, 0,
-	1, 0, 1, 5, 2, 6, 1, 0, 6, 2, 6, 4, 3, 3, 2, 3, 0, 3, 4, 3,
-	2, 1, 0, 6, 5, 3, 0, 1, 0, 1, 2, 5, 4, 3, 0, 3, 6, 1, 0, 3,
-	3, 5, 0, 2, 0, 4, 1, 4, 0, 6, 3, 4, 5, 0, 3, 3, 1, 2, 1, 2,
-	4, 1, 4, 4, 0, 3, 0, 3, 5, 6, 4, 6, 4, 1, 0, 3, 4, 1, 2, 6,
-	5, 3, 2, 0, 3, 6, 2, 5, 6, 1, 0, 2, 1, 6, 2, 1, 2, 6, 5, 1,
-	6, 1, 2, 5, 6, 6, 0, 5, 4, 3, 1, 3, 0, 1, 6, 5, 4, 1, 6, 6,
-	0, 4, 2, 5, 2, 1, 4, 5, 0, 5, 6, 4, 3, 2, 1, 2, 5, 5, 1, 3,
-	1, 6, 5, 4, 2, 4, 1, 1, 6, 4, 2, 1, 4, 0, 3, 3, 5, 3, 6, 6,
-	2, 6, 5, 5, 0, 3, 6, 1, 1, 5, 4, 2, 3, 0, 2, 0, 3, 5, 0, 3,
-	3, 5, 4, 2, 3, 3, 6, 2, 5, 0, 6, 2, 3, 1, 1, 0, 1, 1, 2, 3,
-	4, 4, 1, 2, 5, 4, 0, 6, 1, 5, 0, 4, 2, 6, 4, 2, 5, 0, 6, 5,
-	5, 1, 5, 2, 5, 1, 4, 5, 4, 1, 6, 3, 1, 2, 4, 1, 6, 1, 4, 4,
-	6, 3, 5, 6, 1, 3, 3, 6, 0, 2, 0, 1, 4, 3, 0, 2, 5, 2, 5, 1,
-	0, 5, 2, 4, 3, 1, 1, 0, 6, 0, 4, 6, 3, 4, 6, 5, 2, 6, 3, 4,
-	1, 0, 1, 4, 2, 6, 4, 6, 3, 0, 4, 1, 4, 1, 3, 6, 2, 6, 1, 2,
-	2, 0, 3, 0, 4, 0, 5, 2, 0, 6, 0, 5, 0, 2, 4, 0, 5, 6, 4, 2,
-	3, 4, 1, 0, 5, 6, 0, 3, 5, 3, 5, 3, 1, 0, 3, 4, 6, 0, 6, 3,
-	4, 6, 2, 5, 3, 4, 6, 2, 0, 6, 3, 0, 6, 3, 1, 1, 5, 0, 4, 3,
-	5, 1, 4, 5, 3, 6, 1, 2, 3, 6, 2, 6, 0, 6, 1, 4, 2, 5, 3, 3,
-	6, 1, 4, 4, 2, 3, 5, 1, 6, 2, 1, 3, 4, 1, 2, 5, 0, 4, 6, 2,
-	0, 1, 6, 1, 5, 4, 0, 5, 1, 6, 1, 2, 0, 4, 2, 5, 0, 4, 2, 1,
-	1, 5, 2, 1, 3, 5, 6, 0, 1, 5, 1, 5, 0, 4, 0, 6, 3, 5, 2, 4,
-	2, 0, 5, 0, 2, 4, 3, 5, 0, 6, 1, 4, 1, 0, 2, 0, 3, 0, 5, 2,
-	3, 1, 4, 2, 1, 4, 5, 6, 6, 5, 3, 1, 3, 1, 1, 4, 2, 6, 1, 1,
-	4, 6, 0, 1, 5, 1, 2, 0, 4, 5, 1, 0, 0, 4, 3, 2, 6, 5, 4, 6,
-	5, 6, 3, 5, 4, 6, 4, 6, 1, 6, 5, 0, 0, 6, 3, 2, 3, 6, 2, 0,
-	6, 0, 3, 4, 2, 4, 6, 5, 2, 0, 4, 2, 1, 2, 0, 4, 5, 0, 5, 3,
-	0, 0, 6, 4, 6, 0, 6, 0, 6, 2, 5, 4, 2, 5, 0, 1, 1, 3, 3, 5,
-	1, 2, 0, 4, 1, 6, 3, 4, 3, 5, 2, 0, 4, 2, 4, 5, 1, 2, 6, 5,
-	2, 6, 4, 2, 6, 1, 0, 6, 3, 1, 5, 6, 4, 3, 5, 1, 5, 1, 0, 3,
-	3, 1, 2, 5, 4, 0, 4, 3, 0, 2, 1, 6, 5, 3, 2, 0, 4, 6, 2, 3,
-	4, 0, 1, 2, 1, 6, 4, 1, 5, 2, 0, 6, 3, 1, 2, 6, 3, 1, 3, 6,
-	5, 3, 5, 6, 1, 6, 1, 3, 6, 5, 1, 0, 5, 1, 0, 2, 3, 4, 1, 5,
-	6, 0, 3, 2, 4, 1, 4, 5, 1, 5, 5, 6, 4, 6, 3, 0, 6, 1, 5, 0,
-	0, 4, 3, 0, 3, 0, 3, 1, 0, 6, 3, 1, 0, 6, 5, 2, 0, 2, 0, 2,
-	1, 4, 6, 5, 4, 1, 3, 3, 5, 1, 0, 3, 1, 5, 2, 3, 1, 5, 2, 1,
-	2, 1, 0, 1, 5, 5, 1, 4, 3, 6, 6, 3, 4, 5, 1, 3, 2, 1, 4, 4,
-	3, 0, 6, 5, 6, 3, 6, 3, 0, 5, 1, 6, 2, 4, 6, 3, 4, 2, 6, 2,
-	4, 0, 3, 0, 5, 4, 0, 2, 6, 0, 4, 2, 1, 4, 2, 6, 3, 4, 0, 6,
-	5, 2, 5, 5, 3, 6, 2, 3, 0, 4, 3, 1, 5, 0, 1, 6, 2, 6, 3, 5,
-	6, 2, 1, 1, 4, 3, 3, 0, 6, 1, 1, 6, 3, 1, 1, 4, 2, 1, 4, 5,
-	0, 6, 5, 6, 3, 2, 4, 5, 0, 5, 3, 0, 6, 6, 1, 6, 4, 1, 4, 3,
-	1, 5, 1, 0, 5, 6, 1, 6, 2, 3, 0, 3, 2, 4, 2, 5, 3, 2, 0, 3,
-	2, 3, 2, 0, 5, 4, 5, 0, 1, 6, 2, 0, 2, 0, 4, 3, 0, 2, 5, 0,
-	3, 2, 0, 2, 5, 3, 4, 0, 2, 6, 2, 6, 3, 2, 1, 2, 3, 2, 5, 6,
-	4, 5, 1, 1, 5, 0, 1, 5, 4, 3, 1, 4, 3, 1, 3, 5, 6, 5, 6, 0,
-	5, 3, 2, 5, 3, 3, 2, 4, 2, 1, 2, 4, 6, 1, 6, 0, 5, 2, 4, 6,
-	6, 3, 5, 2, 2, 1, 2, 0, 4, 2, 4, 3, 5, 4, 1, 0, 3, 1, 6, 0,
-	0, 1, 1, 6, 4, 5, 3, 4, 2, 3, 1, 0, 5, 5, 0, 2, 6, 2, 0, 3,
-	1, 5, 1, 0, 1, 6, 4, 3, 4, 0, 2, 6, 2, 3, 6, 3, 1, 5, 1, 6,
-	2, 4, 6, 1, 4, 3, 0, 3, 0, 3, 4, 5, 1, 0, 6, 2, 5, 2, 3, 4,
-	3, 3, 5, 6, 3, 5, 4, 6, 5, 3, 2, 4, 0, 6, 3, 3, 6, 0, 6, 6,
-	4, 6, 0, 3, 0, 4, 0, 4, 2, 1, 2, 3, 6, 1, 0, 1, 6, 3, 5, 6,
-	5, 2, 6, 6, 3, 6, 4, 1, 5, 3, 1, 1, 5, 4, 6, 1, 2, 4, 3, 0,
-	6, 6, 2, 4, 6, 2, 3, 4, 2, 4, 2, 1, 2, 1, 5, 0, 2, 4, 3, 5,
-	0, 3, 2, 0, 4, 1, 0, 2, 5, 2, 6, 0, 4, 6, 4, 6, 4, 6, 3, 0,
-	1, 2, 6, 0, 6, 2, 3, 0, 6, 5, 4, 3, 2, 3, 1, 2, 4, 3, 5, 0,
-	2, 0, 2, 0, 4, 3, 6, 2, 6, 3, 3, 2, 5, 2, 4, 3, 2, 4, 5, 6,
-	3, 5, 2, 1, 4, 0, 1, 4, 5, 0, 2, 6, 5, 1, 2, 6, 6, 2, 1, 0,
-	4, 2, 0, 5, 0, 5, 6, 5, 3, 1, 0, 2, 4, 0, 6, 4, 5, 0, 5, 4,
-	5, 0, 2, 1, 3, 5, 1, 2, 1, 5, 3, 5, 0, 3, 0, 2, 0, 4, 2, 1,
-	6, 3, 4, 5, 2, 1, 6, 2, 1, 4, 0, 6, 2, 4, 6, 4, 0, 5, 3, 5,
-	0, 5, 1, 0, 6, 1, 3, 6, 4, 3, 4, 3, 1, 6, 6, 0, 0, 6, 4, 5,
-	1, 3, 0, 3, 1, 5, 0, 3, 2, 0, 4, 0, 3, 6, 1, 3, 0, 5, 2, 0,
-	2, 4, 2, 1, 0, 5, 0, 3, 5, 5, 2, 5, 6, 0, 5, 3, 4, 2, 6, 3,
-	3, 0, 6, 1, 5, 0, 5, 6, 3, 6, 0, 3, 4, 5, 6, 5, 0, 1, 5, 4,
-	4, 1, 0, 6, 5, 2, 4, 0, 2, 0, 2, 4, 6, 0, 3, 2, 5, 1, 4, 1,
-	5, 6, 3, 3, 0, 5, 4, 6, 4, 0, 5, 3, 3, 3, 0, 4, 3, 3, 2, 4,
-	6, 5, 6, 2, 5, 4, 2, 5, 2, 4, 2, 0, 2, 6, 4, 5, 0, 4, 2, 6,
-	0, 2, 6, 4, 5, 1, 2, 4, 6, 5, 6, 0, 1, 5, 6, 2, 5, 3, 6, 0,
-	1, 6, 1, 5, 2, 3, 6, 2, 6, 1, 1, 1, 5, 6, 1, 5, 3, 0, 1, 0,
-	2, 5, 6, 3, 0, 0, 2, 5, 3, 2, 1, 0, 4, 3, 0, 3, 5, 4, 5, 0,
-	3, 1, 1, 3, 4, 1, 0, 2, 6, 3, 5, 0, 2, 0, 5, 1, 4, 0, 3, 4,
-	4, 6, 1, 3, 2, 6, 4, 6, 4, 2, 6, 4, 2, 0, 1, 2, 3, 4, 0, 3,
-	5, 1, 4, 5, 1, 4, 4, 3, 4, 6, 3, 6, 0, 6, 5, 6, 5, 4, 3, 5,
-	6, 3, 5, 1, 3, 0, 6, 0, 5, 2, 5, 4, 3, 1, 3, 1, 2, 4, 3, 4,
-	0, 3, 0, 4, 3, 2, 6, 1, 5, 3, 0, 1, 4, 6, 1, 3, 1, 6, 1, 2,
-	1, 5, 3, 5, 6, 3, 0, 1, 5, 2, 0, 1, 3, 4, 2, 0, 2, 1, 2, 0,
-	2, 1, 6, 1, 4, 6, 5, 6, 0, 3, 5, 0, 0, 1, 2, 4, 6, 1, 0, 6,
-	3, 0, 1, 4, 3, 1, 4, 1, 4, 5, 0, 5, 1, 4, 5, 3, 0, 6, 1, 5,
-	4, 6, 2, 3, 5, 1, 3, 6, 5, 1, 0, 1, 2, 4, 6, 5, 2, 5, 5, 0,
-	5, 6, 4, 6, 1, 2, 5, 1, 5, 0, 1, 6, 1, 6, 2, 4, 2, 0, 3, 2,
-	6, 4, 6, 5, 3, 2, 5, 3, 6, 3, 1, 3, 6, 3, 2, 6, 5, 1, 1, 0,
-	0, 6, 5, 3, 4, 0, 1, 0, 0, 4, 6, 3, 2, 5, 2, 3, 1, 3, 1, 5,
-	1, 0, 0, 1, 3, 6, 4, 2, 3, 1, 3, 1, 4, 3, 4, 2, 2, 6, 3, 5,
-	2, 5, 0, 3, 2, 5, 2, 1, 5, 0, 2, 1, 2, 6, 6, 5, 0, 5, 4, 2,
-	3, 5, 3, 2, 3, 2, 5, 4, 2, 3, 4, 3, 3, 0, 6, 2, 1, 5, 2, 6,
-	4, 2, 6, 4, 6, 3, 1, 5, 6, 0, 6, 5, 1, 6, 2, 6, 4, 0, 6, 5,
-	5, 3, 5, 1, 2, 3, 4, 1, 0, 4, 5, 3, 5, 6, 2, 1, 2, 4, 1, 2,
-	6, 1, 6, 2, 0, 1, 6, 0, 3, 0, 1, 6, 5, 6, 1, 2, 2, 1, 5, 4,
-	0, 5, 2, 1, 5, 0, 2, 0, 3, 4, 6, 0, 5, 0, 1, 0, 1, 0, 3, 5,
-	1, 3, 4, 3, 5, 4, 5, 0, 6, 2, 4, 2, 5, 4, 3, 1, 4, 0, 6, 3,
-	2, 3, 6, 5, 1, 3, 1, 4, 5, 5, 1, 6, 0, 2, 0, 1, 2, 6, 1, 3,
-	3, 2, 6, 0, 1, 1, 5, 1, 1, 4, 1, 5, 1, 4, 5, 2, 5, 5, 1, 0,
-	4, 2, 0, 2, 6, 5, 0, 6, 0, 6, 3, 1, 3, 2, 6, 4, 2, 3, 5, 1,
-	5, 1, 3, 6, 5, 3, 5, 3, 0, 5, 1, 2, 6, 0, 5, 0, 4, 3, 3, 4,
-	6, 0, 4, 1, 5, 1, 5, 6, 4, 2, 0, 6, 1, 0, 4, 0, 2, 1, 3, 3,
-	0, 5, 1, 4, 1, 0, 4, 1, 5, 4, 2, 4, 5, 1, 2, 0, 4, 4, 3, 0,
-	1, 4, 6, 2, 6, 5, 4, 4, 6, 5, 4, 1, 5, 1, 1, 3, 6, 3, 5, 4,
-	2, 4, 4, 2, 0, 3, 0, 2, 4, 3, 0, 6, 3, 5, 5, 6, 0, 3, 2, 3,
-	3, 5, 3, 2, 5, 6, 3, 4, 3, 1, 4, 0, 6, 3, 3, 6, 4, 2, 0, 0,
-	4, 0, 5, 4, 2, 4, 4, 4, 5, 1, 0, 6, 0, 1, 5, 4, 3, 1, 2, 4,
-	5, 1, 2, 3, 4, 0, 6, 0, 3, 4, 1, 0, 1, 6, 0, 2, 5, 1, 6, 5,
-	6, 0, 6, 0, 4, 5, 2, 4, 4, 3, 5, 0, 1, 0, 4, 1, 3, 0, 4, 0,
-	0, 3, 1, 2, 4, 5, 0, 0, 4, 1, 6, 3, 5, 2, 1, 3, 1, 5, 3, 2,
-	1, 0, 5, 2, 2, 2, 3, 2, 1, 3, 2, 3, 4, 5, 3, 2, 0, 1, 0, 0,
-	2, 5, 0, 1, 3, 3, 2, 1, 0, 5, 2, 6, 5, 1, 2, 1, 6, 3, 0, 2,
-	3, 3, 1, 0, 3, 6, 5, 0, 0, 5, 1, 0, 4, 5, 2, 5, 6, 5, 2, 1,
-	4, 6, 4, 2, 3, 2, 5, 3, 4, 1, 3, 4, 2, 4, 5, 4, 6, 0, 4, 5,
-	5, 6, 0, 6, 0, 6, 4, 0, 5, 6, 2, 1, 2, 0, 4, 1, 5, 0, 2, 0,
-	6, 4, 3, 2, 5, 0, 4, 2, 5, 1, 6, 0, 5, 2, 6, 1, 2, 3, 1, 3,
-	0, 6, 4, 3, 6, 4, 6, 6, 5, 1, 0, 6, 0, 1, 0, 4, 2, 4, 5, 0,
-	1, 5, 1, 0, 1, 6, 0, 1, 5, 4, 2, 6, 3, 0, 5, 1, 4, 5, 4, 3,
-	2, 5, 0, 3, 6, 3, 0, 4, 0, 4, 3, 1, 3, 0, 1, 1, 3, 1, 6, 3,
-	3, 0, 4, 1, 4, 0, 3, 1, 1, 1, 5, 3, 5, 1, 1, 2, 4, 3, 3, 5,
-	4, 0, 2, 1, 0, 4, 0, 4, 1, 4, 6, 4, 6, 1, 5, 1, 4, 3, 6, 5,
-	5, 6, 3, 0, 5, 1, 6, 0, 5, 2, 3, 2, 0, 2, 0, 5, 3, 6, 3, 4,
-	6, 1, 4, 3, 6, 4, 0, 4, 5, 6, 5, 2, 0, 5, 2, 6, 2, 0, 3, 5,
-	0, 3, 3, 5, 0, 3, 4, 3, 0, 3, 5, 4, 4, 6, 2, 5, 6, 1, 6, 1,
-	1, 0, 2, 1, 6, 5, 4, 2, 0, 6, 4, 5, 1, 6, 4, 6, 4, 2, 5, 3,
-	2, 3, 2, 0, 3, 0, 5, 0, 2, 1, 3, 6, 0, 1, 4, 0, 6, 0, 4, 5,
-	3, 4, 2, 1, 0, 6, 0, 1, 0, 3, 2, 3, 2, 0, 2, 3, 5, 4, 6, 2,
-	4, 3, 3, 2, 1, 3, 6, 6, 4, 2, 6, 2, 5, 0, 1, 6, 0, 4, 6, 1,
-	5, 4, 1, 3, 4, 1, 4, 1, 0, 4, 5, 2, 3, 1, 4, 0, 1, 3, 6, 5,
-	6, 0, 3, 1, 3, 6, 1, 4, 2, 5, 0, 6, 2, 1, 6, 0, 3, 0, 6, 2,
-	0, 6, 5, 1, 6, 1, 2, 0, 6, 1, 0, 2, 0, 2, 1, 5, 2, 6, 4, 3,
-	1, 4, 5, 3, 5, 6, 4, 1, 6, 3, 5, 6, 1, 5, 0, 6, 5, 3, 0, 2,
-	2, 0, 3, 5, 1, 6, 4, 2, 6, 4, 2, 5, 3, 2, 0, 6, 1, 4, 5, 6,
-	3, 5, 2, 5, 1, 6, 2, 5, 1, 5, 4, 0, 6, 5, 6, 1, 4, 1, 0, 6,
-	4, 6, 5, 3, 5, 3, 4, 2, 1, 5, 2, 0, 5, 3, 6, 3, 0, 3, 5, 0,
-	5, 6, 1, 5, 0, 3, 2, 5, 1, 0, 4, 5, 1, 5, 3, 2, 1, 5, 0, 4,
-	6, 4, 6, 0, 6, 2, 4, 4, 5, 1, 4, 6, 2, 3, 6, 3, 4, 3, 2, 6,
-	0, 6, 3, 6, 1, 4, 2, 0, 1, 0, 5, 0, 4, 5, 2, 5, 2, 4, 5, 5,
-	1, 0, 4, 1, 1, 3, 2, 3, 5, 4, 0, 5, 5, 1, 3, 6, 5, 4, 6, 5,
-	2, 4, 5, 4, 2, 4, 0, 2, 6, 0, 3, 6, 6, 4, 6, 0, 6, 1, 2, 0,
-	3, 6, 1, 5, 1, 2, 4, 0, 0, 1, 0, 3, 4, 5, 4, 0, 5, 6, 2, 3,
-	4, 6, 4, 3, 2, 6, 5, 6, 2, 0, 6, 2, 5, 3, 1, 2, 0, 6, 3, 5,
-	5, 6, 2, 4, 1, 6, 0, 1, 0, 0, 3, 2, 2, 4, 2, 0, 4, 1, 6, 3,
-	6, 3, 6, 6, 3, 0, 6, 3, 2, 4, 2, 4, 2, 6, 3, 5, 1, 6, 5, 1,
-	0, 6, 2, 5, 6, 1, 5, 3, 1, 5, 4, 4, 5, 0, 5, 3, 4, 2, 0, 1,
-	1, 6, 0, 5, 6, 2, 6, 3, 2, 0, 1, 0, 5, 1, 5, 3, 2, 4, 5, 1,
-	2, 3, 4, 0, 4, 3, 6, 0, 2, 5, 3, 4, 6, 5, 3, 4, 0, 2, 4, 1,
-	3, 4, 2, 1, 3, 0, 3, 6, 0, 1, 0, 6, 5, 1, 5, 4, 2, 0, 3, 2,
-	4, 6, 4, 2, 4, 1, 1, 2, 1, 4, 2, 0, 2, 5, 4, 4, 3, 0, 4, 2,
-	5, 2, 5, 2, 4, 2, 5, 3, 6, 2, 1, 0, 3, 0, 5, 2, 1, 6, 2, 0,
-	6, 2, 5, 2, 0, 5, 0, 2, 6, 1, 0, 4, 6, 4, 0, 1, 6, 1, 6, 3,
-	0, 2, 6, 1, 6, 1, 0, 1, 2, 6, 1, 2, 1, 6, 3, 0, 5, 3, 0, 1,
-	1, 3, 3, 1, 0, 4, 5, 1, 6, 3, 4, 5, 2, 1, 0, 1, 3, 6, 3, 6,
-	2, 6, 2, 0, 1, 5, 1, 2, 6, 2, 5, 0, 2, 5, 2, 6, 6, 4, 6, 1,
-	3, 2, 4, 6, 1, 1, 6, 0, 5, 5, 6, 4, 1, 4, 1, 2, 3, 1, 2, 5,
-	4, 2, 1, 0, 6, 4, 2, 0, 2, 5, 3, 0, 4, 0, 4, 0, 3, 5, 5, 3,
-	5, 2, 0, 3, 6, 3, 0, 3, 4, 3, 6, 2, 4, 0, 4, 2, 4, 3, 5, 4,
-	6, 0, 4, 0, 2, 4, 5, 4, 2, 0, 4, 2, 3, 1, 3, 5, 2, 1, 5, 2,
-	0, 3, 4, 0, 1, 3, 6, 1, 3, 6, 2, 1, 2, 0, 5, 2, 0, 3, 5, 6,
-	1, 3, 6, 0, 5, 6, 2, 6, 3, 4, 1, 6, 3, 1, 0, 0, 1, 5, 1, 0,
-	2, 6, 1, 0, 2, 1, 5, 2, 4, 0, 6, 1, 0, 2, 3, 5, 2, 0, 5, 6,
-	3, 0, 6, 2, 1, 0, 1, 3, 5, 1, 2, 5, 1, 2, 0, 2, 1, 0, 3, 4,
-	4, 0, 4, 2, 3, 1, 5, 5, 4, 6, 0, 5, 1, 3, 0, 6, 3, 0, 3, 6,
-	5, 6, 3, 4, 3, 5, 4, 6, 2, 5, 1, 5, 4, 4, 5, 1, 0, 2, 6, 4,
-	6, 5, 1, 4, 3, 4, 6, 2, 6, 3, 0, 3, 4, 0, 6, 2, 0, 2, 6, 2,
-	0, 6, 0, 1, 2, 6, 2, 5, 4, 0, 3, 2, 3, 2, 5, 1, 3, 1, 5, 6,
-	1, 2, 1, 4, 1, 3, 5, 6, 6, 0, 3, 6, 0, 3, 6, 0, 5, 0, 5, 0,
-	2, 4, 2, 3, 5, 6, 0, 4, 5, 4, 2, 4, 6, 5, 1, 2, 1, 2, 6, 3,
-	3, 5, 4, 5, 6, 2, 6, 1, 1, 3, 2, 5, 6, 4, 2, 5, 3, 1, 2, 0,
-	4, 2, 2, 4, 0, 4, 1, 0, 1, 6, 2, 1, 0, 1, 1, 2, 4, 3, 5, 3,
-	5, 4, 2, 4, 5, 5, 4, 0, 3, 4, 5, 3, 6, 0, 6, 2, 4, 0, 4, 2,
-	6, 5, 3, 4, 4, 4, 1, 0, 3, 5, 6, 1, 4, 2, 6, 5, 0, 6, 5, 3,
-	0, 3, 5, 6, 1, 4, 3, 0, 5, 4, 5, 0, 2, 0, 5, 3, 2, 0, 6, 4,
-	1, 5, 0, 3, 6, 0, 1, 4, 1, 6, 0, 6, 3, 6, 2, 0, 4, 5, 1, 2,
-	2, 4, 0, 6, 4, 6, 2, 6, 4, 1, 4, 0, 1, 3, 5, 3, 0, 1, 4, 1,
-	3, 6, 4, 3, 0, 1, 6, 0, 6, 5, 3, 4, 5, 1, 2, 5, 6, 0, 2, 6,
-	4, 1, 4, 6, 0, 2, 6, 0, 6, 3, 3, 1, 3, 1, 1, 0, 5, 2, 6, 2,
-	5, 1, 5, 2, 4, 6, 0, 6, 0, 6, 1, 5, 0, 1, 0, 5, 5, 1, 4, 0,
-	6, 3, 2, 5, 0, 3, 4, 1, 0, 2, 6, 2, 5, 2, 0, 2, 6, 2, 5, 4,
-	0, 2, 0, 4, 3, 0, 4, 2, 0, 3, 2, 3, 5, 6, 0, 6, 4, 0, 5, 1,
-	1, 3, 2, 2, 3, 1, 0, 5, 2, 0, 5, 1, 6, 0, 2, 0, 4, 6, 5, 4,
-	2, 4, 2, 4, 0, 2, 5, 6, 2, 6, 4, 2, 4, 0, 3, 4, 6, 2, 0, 4,
-	3, 2, 3, 6, 4, 6, 0, 0, 2, 6, 4, 1, 4, 3, 5, 1, 6, 5, 2, 5,
-	4, 5, 6, 1, 1, 3, 5, 2, 5, 6, 5, 2, 6, 3, 6, 3, 4, 6, 0, 2,
-	5, 3, 2, 3, 5, 3, 1, 6, 0, 3, 3, 2, 5, 2, 3, 5, 1, 4, 6, 2,
-	6, 5, 0, 0, 6, 3, 0, 6, 1, 5, 0, 4, 6, 4, 0, 3, 2, 1, 3, 4,
-	0, 2, 0, 2, 1, 4, 2, 5, 6, 3, 1, 5, 0, 0, 1, 4, 3, 2, 6, 5,
-	1, 4, 0, 5, 0, 5, 0, 6, 4, 2, 0, 6, 4, 1, 4, 2, 0, 2, 4, 6,
-	2, 3, 6, 1, 4, 0, 2, 4, 6, 4, 2, 2, 6, 1, 3, 2, 0, 3, 0, 1,
-	3, 0, 5, 6, 4, 1, 1, 5, 0, 6, 0, 3, 3, 4, 2, 6, 1, 6, 3, 6,
-	4, 1, 5, 0, 4, 1, 5, 1, 4, 2, 4, 6, 4, 3, 2, 3, 4, 1, 4, 2,
-	5, 4, 0, 4, 4, 0, 2, 6, 2, 3, 6, 2, 6, 3, 0, 5, 1, 2, 1, 4,
-	6, 5, 1, 3, 3, 0, 5, 4, 1, 2, 0, 3, 3, 6, 5, 6, 2, 0, 2, 1,
-	0, 3, 6, 4, 1, 5, 2, 4, 5, 0, 6, 6, 4, 6, 4, 0, 4, 1, 4, 3,
-	1, 6, 2, 4, 1, 2, 6, 3, 4, 1, 3, 0, 0, 0, 3, 1, 5, 3, 0, 5,
-	2, 5, 6, 5, 0, 1, 0, 2, 1, 2, 5, 1, 3, 4, 5, 1, 1, 5, 3, 2,
-	3, 6, 5, 2, 0, 5, 3, 5, 3, 6, 5, 2, 2, 4, 5, 3, 2, 6, 1, 1,
-	4, 6, 0, 3, 0, 5, 6, 2, 2, 6, 0, 5, 0, 5, 4, 5, 2, 4, 1, 6,
-	5, 2, 0, 1, 3, 1, 0, 3, 4, 5, 1, 0, 4, 3, 6, 2, 1, 5, 4, 1,
-	6, 1, 0, 6, 4, 5, 3, 4, 3, 4, 1, 0, 6, 1, 2, 5, 0, 6, 4, 0,
-	0, 6, 1, 6, 2, 4, 3, 6, 3, 2, 4, 5, 0, 6, 3, 0, 6, 1, 6, 2,
-	1, 6, 3, 5, 4, 6, 2, 0, 5, 3, 1, 3, 1, 5, 0, 5, 0, 6, 3, 1,
-	2, 4, 3, 4, 1, 5, 0, 2, 5, 4, 5, 1, 3, 5, 5, 3, 5, 2, 4, 0,
-	3, 1, 2, 3, 4, 6, 4, 1, 3, 1, 2, 3, 0, 4, 6, 1, 4, 6, 2, 0,
-	4, 0, 2, 0, 2, 6, 5, 4, 0, 6, 4, 1, 0, 4, 3, 1, 0, 1, 6, 1,
-	5, 4, 3, 6, 3, 2, 4, 0, 1, 0, 3, 6, 1, 5, 0, 1, 5, 5, 0, 6,
-	6, 3, 5, 0, 2, 1, 4, 6, 2, 5, 1, 6, 2, 6, 1, 5, 1, 1, 3, 4,
-	0, 3, 6, 4, 2, 4, 5, 2, 3, 1, 0, 6, 0, 6, 1, 2, 4, 0, 0, 3,
-	1, 4, 5, 2, 6, 0, 3, 6, 4, 3, 2, 6, 3, 1, 3, 0, 6, 0, 2, 0,
-	2, 6, 2, 3, 1, 5, 2, 0, 1, 4, 2, 1, 4, 6, 4, 2, 5, 0, 2, 5,
-	3, 6, 3, 5, 4, 6, 6, 1, 0, 5, 3, 1, 0, 1, 2, 6, 2, 0, 5, 2,
-	4, 3, 3, 6, 2, 0, 3, 0, 4, 4, 2, 2, 4, 6, 4, 0, 2, 0, 5, 1,
-	5, 5, 2, 4, 1, 5, 1, 3, 1, 5, 0, 2, 6, 4, 6, 2, 3, 5, 1, 1,
-	6, 0, 5, 1, 1, 6, 5, 3, 4, 2, 1, 0, 3, 6, 3, 1, 4, 1, 4, 2,
-	0, 6, 5, 3, 0, 3, 0, 6, 1, 0, 6, 1, 3, 1, 6, 3, 0, 4, 3, 6,
-	1, 1, 1, 0, 6, 5, 0, 2, 2, 5, 6, 3, 1, 5, 3, 2, 5, 5, 0, 6,
-	2, 1, 3, 4, 1, 0, 1, 6, 1, 6, 3, 5, 1, 1, 4, 2, 4, 6, 2, 0,
-	3, 2, 3, 3, 2, 6, 3, 6, 6, 1, 0, 6, 4, 6, 1, 5, 4, 2, 5, 2,
-	4, 1, 0, 3, 2, 4, 6, 2, 0, 6, 3, 2, 3, 1, 5, 2, 3, 2, 5, 2,
-	5, 2, 3, 5, 2, 2, 3, 6, 5, 3, 0, 5, 0, 1, 4, 5, 1, 5, 6, 0,
-	6, 5, 1, 6, 6, 4, 3, 5, 5, 1, 0, 3, 1, 4, 0, 6, 3, 6, 2, 6,
-	0, 3, 6, 1, 3, 4, 6, 3, 4, 6, 5, 3, 5, 6, 2, 5, 4, 2, 6, 0,
-	1, 5, 5, 0, 6, 1, 3, 6, 1, 5, 4, 3, 2, 4, 1, 2, 2, 4, 3, 3,
-	2, 4, 6, 4, 0, 4, 2, 3, 5, 3, 0, 4, 6, 2, 4, 1, 3, 0, 3, 2,
-	3, 5, 2, 0, 6, 1, 6, 6, 3, 2, 5, 0, 4, 6, 4, 2, 3, 4, 0, 2,
-	4, 6, 2, 0, 4, 6, 3, 0, 3, 6, 4, 6, 1, 3, 0, 5, 6, 1, 1, 0,
-	5, 1, 5, 4, 1, 3, 6, 5, 0, 0, 6, 5, 6, 5, 3, 0, 1, 5, 4, 5,
-	6, 5, 2, 4, 2, 6, 0, 6, 4, 2, 3, 5, 4, 0, 2, 5, 0, 3, 5, 6,
-	0, 3, 6, 2, 6, 3, 4, 6, 0, 5, 6, 3, 5, 4, 2, 0, 2, 2, 0, 1,
-	1, 6, 1, 1, 2, 2, 4, 6, 3, 1, 5, 3, 1, 3, 4, 1, 2, 5, 6, 3,
-	2, 5, 3, 2, 3, 5, 2, 1, 2, 6, 4, 3, 4, 6, 2, 1, 2, 6, 2, 0,
-	3, 6, 2, 0, 3, 4, 0, 3, 0, 5, 2, 1, 4, 2, 1, 5, 4, 1, 2, 4,
-	4, 0, 5, 1, 5, 6, 1, 5, 4, 6, 1, 0, 6, 5, 0, 5, 3, 3, 2, 4,
-	5, 2, 0, 6, 4, 6, 0, 2, 1, 3, 1, 0, 3, 2, 4, 0, 1, 4, 1, 1,
-	6, 4, 0, 5, 3, 1, 4, 1, 5, 0, 5, 1, 3, 3, 2, 3, 0, 4, 0, 6,
-	0, 4, 4, 1, 6, 3, 6, 3, 3, 2, 6, 5, 1, 3, 2, 6, 2, 3, 3, 2,
-	1, 2, 5, 0, 3, 6, 2, 2, 1, 4, 4, 3, 4, 0, 4, 1, 6, 3, 5, 3,
-	2, 5, 2, 6, 5, 1, 3, 5, 3, 1, 4, 3, 2, 1, 4, 5, 6, 1, 4, 3,
-	3, 3, 5, 2, 5, 0, 3, 0, 2, 5, 3, 2, 6, 5, 2, 0, 5, 3, 5, 0,
-	4, 5, 4, 3, 4, 6, 5, 1, 6, 2, 4, 1, 0, 1, 6, 3, 6, 2, 6, 2,
-	5, 4, 2, 0, 1, 5, 4, 2, 0, 5, 0, 3, 0, 6, 4, 1, 4, 6, 2, 1,
-	6, 4, 0, 6, 3, 5, 1, 2, 1, 6, 2, 6, 3, 0, 3, 2, 0, 3, 1, 4,
-	0, 4, 2, 5, 1, 5, 0, 4, 0, 4, 1, 6, 1, 2, 4, 2, 0, 5, 1, 4,
-	1, 3, 0, 1, 4, 6, 0, 5, 3, 0, 5, 1, 0, 5, 3, 1, 4, 3, 0, 5,
-	2, 5, 5, 3, 4, 2, 6, 1, 2, 4, 5, 2, 6, 1, 3, 6, 1, 2, 5, 1,
-	3, 6, 5, 4, 6, 2, 2, 4, 2, 5, 6, 5, 5, 6, 2, 6, 0, 1, 2, 0,
-	4, 1, 2, 5, 1, 6, 2, 1, 4, 2, 0, 4, 6, 2, 4, 2, 4, 5, 0, 4,
-	5, 6, 4, 2, 5, 1, 0, 2, 0, 4, 0, 1, 2, 5, 3, 5, 3, 1, 3, 6,
-	6, 1, 1, 1, 6, 0, 2, 0, 4, 1, 6, 4, 2, 1, 4, 6, 1, 2, 6, 1,
-	0, 4, 2, 0, 6, 0, 1, 2, 6, 5, 1, 3, 5, 0, 3, 3, 6, 4, 6, 2,
-	1, 5, 6, 2, 5, 3, 6, 5, 2, 5, 2, 6, 2, 1, 5, 6, 0, 6, 4, 3,
-	2, 3, 1, 2, 1, 5, 2, 3, 5, 1, 0, 6, 2, 5, 3, 3, 6, 0, 5, 2,
-	3, 2, 4, 1, 4, 3, 1, 4, 1, 2, 0, 4, 0, 4, 2, 5, 0, 6, 3, 2,
-	4, 1, 6, 0, 3, 1, 3, 1, 6, 6, 5, 1, 6, 4, 1, 5, 4, 5, 6, 5,
-	5, 2, 2, 0, 1, 6, 4, 1, 5, 1, 5, 2, 4, 0, 2, 0, 3, 2, 3, 4,
-	6, 0, 3, 0, 1, 2, 5, 3, 5, 3, 5, 6, 0, 3, 4, 1, 4, 3, 4, 0,
-	0, 6, 4, 5, 0, 5, 4, 6, 3, 1, 0, 4, 0, 3, 5, 0, 6, 3, 2, 1,
-	1, 3, 4, 0, 2, 4, 0, 0, 3, 6, 0, 3, 5, 1, 2, 5, 3, 1, 6, 5,
-	2, 6, 0, 1, 5, 1, 6, 2, 5, 6, 0, 2, 4, 3, 6, 0, 3, 6, 5, 3,
-	3, 1, 0, 3, 2, 1, 3, 4, 2, 4, 2, 5, 1, 4, 6, 4, 1, 3, 4, 5,
-	4, 2, 0, 6, 1, 6, 1, 4, 0, 3, 5, 1, 3, 1, 2, 5, 3, 0, 3, 4,
-	5, 6, 2, 2, 5, 0, 3, 2, 5, 2, 0, 4, 6, 2, 1, 2, 6, 5, 0, 1,
-	6, 6, 3, 1, 6, 1, 5, 1, 5, 1, 4, 1, 4, 5, 6, 1, 1, 1, 4, 1,
-	0, 2, 5, 1, 6, 1, 4, 3, 0, 5, 3, 0, 1, 4, 6, 0, 4, 6, 4, 1,
-	1, 0, 2, 0, 3, 4, 2, 4, 6, 4, 2, 3, 4, 1, 4, 2, 3, 6, 4, 4,
-	2, 6, 4, 3, 4, 0, 6, 0, 4, 6, 3, 1, 6, 6, 2, 4, 6, 3, 4, 2,
-	3, 4, 6, 1, 0, 4, 2, 6, 1, 4, 3, 0, 6, 4, 3, 0, 3, 4, 0, 3,
-	4, 1, 3, 1, 4, 3, 2, 0, 5, 4, 6, 1, 2, 6, 2, 3, 1, 0, 6, 2,
-	5, 0, 1, 5, 0, 3, 5, 3, 5, 4, 2, 4, 2, 1, 6, 1, 0, 5, 4, 0,
-	6, 2, 1, 6, 4, 6, 2, 3, 5, 6, 3, 4, 2, 0, 5, 0, 5, 0, 6, 3,
-	0, 5, 6, 3, 5, 6, 3, 5, 1, 4, 3, 4, 5, 6, 1, 4, 0, 6, 2, 6,
-	1, 5, 6, 0, 6, 4, 6, 3, 2, 5, 6, 3, 5, 4, 1, 3, 5, 2, 3, 6,
-	2, 0, 3, 2, 3, 1, 5, 4, 3, 3, 5, 6, 2, 4, 5, 6, 3, 1, 0, 1,
-	3, 4, 5, 0, 3, 5, 6, 0, 5, 0, 5, 0, 2, 1, 2, 0, 5, 0, 2, 1,
-	4, 0, 6, 3, 5, 6, 0, 4, 2, 3, 0, 4, 5, 1, 0, 2, 4, 0, 4, 1,
-	5, 6, 1, 5, 3, 5, 4, 2, 6, 2, 6, 3, 1, 4, 0, 2, 0, 5, 6, 2,
-	6, 5, 4, 2, 1, 4, 3, 2, 4, 5, 0, 6, 0, 1, 4, 2, 1, 0, 4, 2,
-	0, 1, 5, 1, 3, 1, 0, 2, 6, 3, 5, 2, 5, 4, 0, 1, 5, 0, 5, 1,
-	1, 6, 1, 6, 4, 0, 5, 2, 0, 1, 2, 3, 4, 0, 3, 2, 1, 5, 3, 3,
-	2, 1, 0, 3, 6, 1, 0, 2, 4, 1, 5, 4, 1, 2, 0, 5, 1, 1, 6, 4,
-	3, 6, 2, 1, 2, 1, 6, 4, 1, 1, 0, 4, 0, 0, 6, 2, 5, 0, 1, 4,
-	4, 5, 5, 1, 6, 3, 0, 5, 4, 2, 1, 2, 0, 5, 4, 6, 1, 4, 3, 3,
-	5, 3, 2, 3, 2, 1, 6, 4, 6, 4, 1, 3, 0, 4, 0, 6, 0, 1, 5, 1,
-	6, 1, 2, 1, 0, 6, 4, 5, 4, 2, 0, 4, 2, 4, 1, 4, 1, 5, 3, 6,
-	0, 2, 0, 3, 6, 5, 0, 4, 6, 3, 0, 3, 6, 3, 6, 6, 2, 6, 3, 5,
-	1, 1, 0, 2, 1, 6, 3, 4, 5, 1, 2, 1, 0, 3, 4, 3, 3, 6, 1, 1,
-	2, 0, 2, 3, 2, 5, 0, 2, 0, 6, 0, 2, 3, 2, 1, 2, 1, 2, 3, 2,
-	3, 2, 6, 2, 3, 6, 1, 4, 1, 6, 6, 1, 5, 6, 5, 0, 5, 4, 6, 2,
-	4, 0, 1, 0, 2, 6, 3, 6, 1, 2, 4, 1, 2, 5, 3, 6, 4, 1, 0, 0,
-	5, 0, 5, 1, 0, 4, 1, 6, 3, 5, 0, 2, 3, 6, 2, 5, 6, 2, 3, 4,
-	6, 5, 1, 5, 4, 5, 0, 2, 5, 2, 4, 0, 3, 4, 2, 0, 3, 5, 0, 2,
-	0, 5, 2, 3, 0, 5, 4, 1, 0, 4, 2, 3, 4, 1, 4, 3, 0, 6, 0, 2,
-	1, 4, 2, 0, 6, 3, 5, 3, 0, 1, 1, 3, 5, 6, 5, 0, 2, 6, 5, 6,
-	2, 5, 0, 1, 3, 4, 2, 6, 5, 4, 0, 6, 2, 5, 1, 3, 2, 4, 2, 0,
-	3, 1, 1, 0, 1, 3, 0, 6, 4, 1, 2, 6, 0, 5, 6, 3, 5, 3, 5, 2,
-	4, 2, 5, 3, 0, 4, 3, 0, 6, 3, 1, 6, 0, 4, 1, 4, 1, 2, 6, 0,
-	5, 0, 2, 0, 3, 1, 2, 4, 3, 5, 5, 0, 0, 5, 1, 6, 5, 1, 3, 0,
-	6, 2, 0, 6, 1, 4, 6, 2, 4, 3, 0, 5, 3, 2, 1, 0, 5, 0, 1, 5,
-	0, 6, 3, 6, 3, 6, 3, 4, 3, 3, 2, 0, 6, 3, 5, 0, 1, 6, 5, 2,
-	1, 5, 6, 1, 4, 6, 0, 4, 3, 0, 6, 0, 5, 3, 5, 6, 0, 6, 1, 3,
-	2, 6, 3, 4, 0, 4, 5, 4, 1, 6, 2, 5, 1, 4, 1, 6, 2, 5, 2, 5,
-	3, 5, 3, 4, 3, 5, 2, 5, 3, 3, 2, 3, 4, 0, 4, 5, 0, 4, 1, 1,
-	4, 3, 1, 3, 3, 2, 1, 3, 4, 6, 3, 6, 2, 1, 2, 1, 3, 5, 3, 5,
-	5, 0, 6, 1, 0, 6, 3, 5, 5, 6, 2, 1, 2, 2, 1, 2, 1, 0, 1, 2,
-	6, 0, 4, 6, 1, 5, 6, 2, 3, 2, 5, 2, 3, 4, 5, 6, 5, 1, 0, 6,
-	0, 4, 6, 3, 0, 6, 3, 2, 0, 5, 3, 1, 0, 5, 0, 4, 3, 2, 5, 0,
-	1, 3, 4, 0, 4, 0, 5, 3, 2, 5, 1, 0, 5, 1, 2, 4, 5, 6, 3, 0,
-	2, 0, 4, 1, 0, 6, 0, 1, 3, 1, 5, 1, 6, 5, 1, 2, 0, 4, 3, 2,
-	3, 1, 4, 6, 4, 4, 3, 4, 5, 1, 5, 2, 1, 6, 0, 1, 4, 2, 6, 5,
-	4, 3, 5, 2, 5, 4, 0, 1, 3, 2, 4, 2, 3, 4, 1, 5, 2, 1, 4, 2,
-	5, 6, 5, 4, 6, 1, 2, 2, 6, 5, 4, 3, 6, 1, 3, 2, 3, 3, 4, 6,
-	6, 1, 2, 5, 3, 4, 5, 0, 5, 2, 1, 3, 6, 2, 4, 2, 5, 0, 4, 1,
-	0, 5, 0, 5, 1, 2, 3, 0, 1, 6, 2, 6, 2, 3, 6, 3, 5, 3, 4, 5,
-	1, 6, 2, 0, 5, 2, 5, 4, 3, 4, 2, 6, 6, 2, 4, 2, 0, 1, 3, 5,
-	2, 1, 5, 6, 3, 0, 0, 2, 0, 5, 3, 0, 6, 1, 3, 0, 5, 3, 1, 6,
-	3, 5, 6, 5, 3, 4, 6, 0, 6, 3, 6, 4, 1, 6, 4, 6, 6, 2, 5, 6,
-	4, 2, 6, 1, 6, 0, 2, 0, 5, 1, 0, 2, 0, 1, 3, 4, 1, 6, 0, 5,
-	5, 5, 4, 5, 6, 5, 5, 6, 0, 4, 1, 5, 3, 1, 4, 0, 5, 6, 1, 0,
-	6, 0, 1, 4, 1, 3, 0, 1, 2, 0, 4, 0, 3, 0, 1, 4, 4, 2, 5, 0,
-	0, 6, 5, 5, 1, 4, 6, 1, 0, 4, 5, 6, 5, 0, 4, 2, 1, 2, 6, 4,
-	1, 2, 5, 6, 4, 1, 3, 6, 2, 5, 1, 4, 5, 1, 6, 4, 5, 4, 2, 5,
-	2, 5, 4, 0, 2, 6, 4, 6, 5, 2, 6, 4, 1, 3, 5, 4, 6, 4, 5, 6,
-	3, 5, 0, 3, 4, 3, 3, 4, 1, 2, 0, 3, 1, 4, 6, 1, 3, 5, 1, 4,
-	4, 1, 5, 1, 3, 1, 5, 1, 5, 3, 6, 1, 0, 4, 4, 1, 1, 3, 4, 2,
-	5, 2, 2, 6, 5, 1, 6, 1, 3, 1, 6, 1, 5, 3, 2, 4, 1, 4, 6, 2,
-	6, 1, 2, 3, 5, 2, 5, 2, 0, 3, 1, 6, 4, 1, 0, 6, 4, 3, 0, 2,
-	0, 4, 2, 4, 2, 1, 0, 2, 6, 3, 5, 3, 2, 1, 3, 2, 3, 2, 6, 1,
-	1, 6, 5, 6, 5, 1, 2, 5, 1, 3, 1, 6, 6, 2, 6, 1, 5, 2, 1, 0,
-	2, 0, 6, 4, 2, 0, 1, 3, 2, 4, 5, 6, 1, 6, 5, 2, 0, 3, 1, 3,
-	3, 5, 5, 2, 1, 2, 4, 5, 0, 2, 3, 5, 6, 3, 5, 3, 0, 0, 3, 4,
-	4, 2, 5, 1, 0, 1, 4, 6, 3, 4, 3, 5, 3, 0, 3, 5, 1, 3, 0, 4,
-	5, 4, 5, 0, 1, 4, 2, 6, 3, 4, 0, 5, 6, 4, 2, 0, 5, 4, 1, 1,
-	6, 0, 2, 4, 3, 2, 5, 6, 5, 3, 2, 5, 6, 3, 3, 4, 1, 2, 6, 1,
-	0, 2, 1, 6, 0, 4, 1, 3, 4, 2, 0, 5, 0, 3, 3, 2, 0, 1, 3, 2,
-	1, 2, 4, 6, 5, 1, 3, 2, 6, 3, 1, 3, 0, 4, 6, 4, 2, 0, 1, 3,
-	2, 6, 5, 5, 1, 5, 3, 1, 5, 4, 6, 5, 4, 6, 6, 0, 4, 5, 5, 4,
-	3, 2, 0, 2, 0, 1, 0, 3, 1, 5, 6, 2, 4, 5, 1, 5, 0, 2, 5, 2,
-	4, 0, 3, 0, 6, 6, 5, 0, 2, 6, 0, 6, 2, 5, 2, 6, 1, 3, 0, 2,
-	5, 6, 2, 4, 3, 6, 1, 0, 4, 4, 0, 0, 5, 2, 5, 1, 2, 1, 3, 3,
-	6, 2, 3, 4, 3, 5, 0, 4, 5, 6, 4, 1, 5, 2, 1, 6, 4, 5, 6, 4,
-	0, 2, 5, 6, 5, 6, 2, 0, 4, 2, 4, 5, 3, 0, 4, 2, 5, 1, 1, 0,
-	1, 0, 6, 1, 4, 4, 1, 4, 2, 1, 6, 3, 4, 1, 5, 6, 3, 4, 2, 5,
-	2, 0, 1, 6, 3, 1, 5, 0, 1, 6, 2, 1, 4, 1, 2, 4, 6, 5, 6, 3,
-	3, 4, 3, 2, 5, 0, 5, 2, 5, 0, 5, 1, 3, 4, 6, 3, 0, 3, 6, 2,
-	4, 3, 1, 2, 6, 6, 2, 4, 2, 5, 1, 0, 2, 3, 2, 3, 5, 3, 2, 0,
-	5, 3, 2, 5, 1, 5, 6, 1, 4, 3, 1, 2, 1, 2, 4, 5, 3, 0, 4, 5,
-	6, 4, 1, 3, 2, 3, 0, 1, 0, 6, 2, 4, 2, 5, 6, 0, 3, 1, 6, 6,
-	0, 2, 4, 2, 1, 2, 3, 1, 4, 2, 1, 2, 5, 2, 4, 3, 5, 0, 4, 3,
-	1, 1, 6, 2, 0, 1, 4, 2, 2, 4, 0, 3, 1, 5, 4, 2, 0, 3, 0, 4,
-	2, 0, 1, 2, 0, 5, 6, 0, 6, 4, 0, 3, 0, 4, 3, 6, 4, 0, 6, 0,
-	3, 6, 0, 4, 6, 3, 6, 5, 4, 0, 0, 1, 0, 1, 0, 2, 0, 6, 2, 5,
-	4, 1, 1, 3, 1, 3, 4, 3, 5, 1, 6, 1, 0, 6, 2, 6, 2, 6, 5, 0,
-	5, 0, 3, 1, 6, 1, 4, 1, 4, 0, 2, 6, 2, 6, 4, 1, 1, 1, 4, 6,
-	6, 1, 6, 3, 5, 1, 6, 1, 5, 6, 0, 6, 1, 6, 5, 2, 6, 4, 2, 0,
-	0, 1, 6, 5, 6, 1, 0, 6, 2, 4, 3, 2, 3, 4, 6, 2, 0, 6, 4, 4,
-	1, 6, 4, 5, 0, 5, 0, 2, 4, 2, 3, 2, 4, 6, 5, 4, 4, 2, 5, 3,
-	2, 0, 2, 1, 4, 2, 5, 1, 1, 3, 6, 5, 4, 0, 3, 4, 1, 2, 3, 0,
-	3, 1, 5, 4, 1, 3, 5, 4, 1, 2, 4, 6, 4, 0, 4, 5, 1, 5, 5, 0,
-	4, 1, 5, 3, 1, 0, 4, 3, 2, 6, 3, 6, 3, 3, 5, 6, 3, 1, 6, 3,
-	5, 3, 5, 4, 0, 3, 6, 3, 6, 4, 2, 1, 0, 4, 0, 2, 6, 2, 6, 5,
-	6, 3, 5, 0, 4, 6, 0, 6, 4, 0, 6, 0, 2, 0, 2, 4, 0, 4, 1, 6,
-	0, 6, 5, 0, 1, 3, 2, 0, 5, 6, 3, 0, 2, 6, 5, 6, 4, 6, 3, 1,
-	1, 4, 1, 4, 2, 1, 6, 4, 5, 3, 0, 4, 5, 6, 0, 4, 6, 2, 4, 2,
-	2, 3, 0, 2, 4, 6, 3, 5, 1, 1, 1, 5, 1, 5, 0, 5, 2, 0, 4, 0,
-	3, 4, 6, 3, 4, 2, 5, 0, 4, 6, 5, 2, 0, 6, 1, 2, 1, 2, 1, 5,
-	4, 2, 1, 1, 3, 1, 3, 0, 6, 3, 2, 1, 5, 6, 0, 2, 4, 2, 1, 3,
-	5, 3, 1, 5, 1, 5, 2, 3, 4, 3, 0, 3, 6, 2, 3, 1, 4, 2, 5, 6,
-	6, 2, 0, 1, 4, 0, 5, 1, 4, 1, 6, 5, 1, 2, 5, 4, 2, 1, 6, 1,
-	0, 2, 5, 0, 2, 0, 5, 3, 4, 2, 4, 0, 4, 2, 3, 6, 2, 6, 2, 4,
-	1, 2, 5, 6, 4, 6, 0, 3, 5, 2, 1, 6, 0, 3, 0, 5, 6, 2, 5, 1,
-	2, 4, 6, 0, 1, 0, 4, 0, 3, 3, 4, 3, 0, 5, 1, 4, 3, 3, 5, 3,
-	3, 4, 3, 2, 4, 3, 2, 3, 1, 0, 1, 0, 6, 5, 1, 3, 6, 0, 1, 0,
-	4, 3, 0, 2, 0, 1, 4, 2, 0, 6, 0, 5, 4, 0, 5, 5, 3, 3, 4, 2,
-	5, 4, 5, 4, 1, 0, 4, 6, 2, 6, 0, 6, 4, 1, 5, 3, 0, 6, 1, 2,
-	6, 0, 4, 0, 0, 4, 2, 3, 6, 3, 5, 4, 6, 3, 6, 2, 1, 6, 6, 5,
-	0, 5, 3, 2, 0, 0, 2, 3, 4, 2, 6, 1, 6, 0, 2, 2, 0, 1, 3, 6,
-	1, 2, 4, 5, 3, 6, 3, 1, 4, 3, 4, 2, 5, 1, 6, 3, 3, 4, 3, 4,
-	2, 0, 5, 1, 4, 2, 5, 6, 5, 3, 4, 1, 6, 1, 5, 1, 1, 0, 4, 1,
-	3, 6, 5, 1, 4, 0, 4, 6, 2, 1, 5, 0, 2, 4, 5, 1, 0, 4, 0, 6,
-	4, 3, 3, 0, 5, 5, 2, 4, 6, 0, 3, 1, 0, 2, 5, 3, 1, 6, 2, 5,
-	5, 4, 0, 5, 2, 5, 0, 2, 5, 5, 6, 4, 6, 3, 5, 0, 1, 5, 1, 2,
-	6, 1, 2, 3, 6, 0, 6, 0, 4, 0, 2, 3, 1, 6, 3, 5, 4, 5, 0, 5,
-	0, 1, 2, 2, 3, 3, 6, 3, 2, 2, 3, 6, 0, 1, 1, 2, 3, 4, 6, 4,
-	1, 0, 4, 0, 1, 0, 4, 0, 6, 4, 3, 1, 3, 6, 3, 0, 2, 4, 2, 4,
-	2, 6, 5, 5, 0, 1, 6, 5, 2, 6, 4, 6, 2, 0, 6, 5, 1, 4, 6, 5,
-	3, 2, 1, 4, 1, 1, 6, 6, 2, 3, 5, 3, 1, 0, 5, 3, 1, 4, 2, 3,
-	4, 6, 4, 2, 6, 2, 0, 2, 5, 4, 6, 1, 5, 6, 3, 6, 0, 6, 0, 3,
-	5, 6, 0, 2, 6, 4, 3, 5, 4, 3, 6, 1, 6, 0, 4, 1, 0, 6, 0, 5,
-	6, 0, 4, 5, 2, 6, 1, 3, 0, 5, 2, 4, 3, 5, 0, 1, 6, 5, 2, 5,
-	0, 3, 6, 5, 0, 4, 5, 4, 2, 6, 3, 5, 1, 5, 2, 6, 0, 4, 1, 3,
-	1, 3, 4, 2, 4, 0, 3, 0, 6, 1, 0, 2, 5, 1, 0, 3, 6, 2, 0, 2,
-	2, 1, 4, 2, 0, 5, 1, 2, 6, 1, 5, 1, 2, 1, 5, 3, 2, 1, 3, 5,
-	3, 2, 4, 5, 4, 6, 3, 4, 5, 6, 2, 6, 4, 1, 5, 1, 4, 2, 3, 6,
-	4, 6, 4, 6, 0, 4, 0, 6, 2, 3, 1, 0, 5, 1, 0, 4, 0, 3, 2, 5,
-	5, 0, 5, 1, 4, 5, 1, 3, 4, 3, 0, 6, 2, 6, 0, 5, 3, 1, 5, 1,
-	6, 1, 5, 1, 1, 2, 0, 3, 3, 4, 0, 3, 3, 6, 5, 6, 5, 2, 5, 0,
-	0, 5, 4, 6, 3, 2, 3, 1, 4, 0, 4, 5, 0, 1, 5, 0, 5, 4, 0, 1,
-	1, 1, 0, 3, 3, 2, 1, 6, 0, 2, 4, 0, 6, 5, 6, 1, 4, 2, 6, 4,
-	2, 6, 0, 3, 2, 0, 4, 6, 4, 3, 6, 6, 5, 0, 5, 3, 4, 0, 3, 4,
-	3, 3, 0, 3, 4, 5, 3, 0, 1, 6, 1, 5, 1, 2, 4, 2, 4, 3, 4, 0,
-	4, 1, 2, 5, 3, 6, 2, 4, 0, 6, 3, 4, 5, 4, 1, 6, 0, 0, 5, 2,
-	5, 2, 6, 0, 3, 3, 2, 5, 2, 2, 3, 3, 6, 0, 2, 0, 0, 3, 4, 1,
-	6, 3, 2, 4, 5, 1, 6, 5, 3, 0, 5, 5, 1, 2, 0, 3, 6, 4, 2, 1,
-	0, 3, 1, 5, 4, 1, 2, 1, 5, 2, 4, 1, 6, 1, 6, 5, 6, 1, 4, 5,
-	1, 6, 1, 2, 4, 0, 5, 2, 3, 1, 6, 2, 5, 1, 4, 3, 6, 6, 0, 3,
-	2, 0, 5, 5, 1, 4, 5, 1, 5, 1, 0, 1, 5, 1, 4, 0, 3, 3, 4, 3,
-	3, 2, 1, 2, 1, 0, 0, 6, 4, 2, 1, 2, 4, 3, 2, 3, 4, 2, 6, 4,
-	4, 5, 1, 5, 6, 3, 4, 6, 4, 0, 2, 1, 6, 1, 6, 2, 1, 6, 2, 5,
-	5, 3, 5, 0, 6, 4, 3, 0, 3, 2, 4, 3, 0, 3, 6, 4, 0, 4, 5, 6,
-	6, 5, 4, 1, 0, 4, 5, 2, 3, 2, 3, 5, 4, 3, 2, 6, 4, 4, 0, 4,
-	0, 0, 1, 1, 5, 6, 0, 4, 0, 2, 6, 1, 4, 1, 0, 1, 4, 4, 3, 0,
-	1, 0, 3, 1, 3, 5, 0, 4, 0, 2, 1, 0, 4, 1, 4, 4, 5, 3, 0, 4,
-	2, 1, 4, 2, 5, 6, 5, 3, 6, 1, 6, 2, 5, 2, 6, 2, 5, 0, 6, 1,
-	3, 2, 0, 4, 1, 0, 6, 3, 2, 0, 1, 0, 2, 3, 0, 2, 4, 5, 3, 2,
-	4, 2, 3, 4, 6, 0, 1, 0, 6, 2, 5, 0, 5, 6, 0, 2, 5, 3, 5, 2,
-	5, 2, 4, 3, 5, 0, 6, 5, 6, 0, 4, 3, 5, 2, 5, 1, 2, 3, 2, 6,
-	6, 5, 3, 2, 4, 1, 0, 5, 3, 6, 0, 5, 1, 5, 0, 1, 2, 5, 0, 6,
-	0, 2, 6, 2, 0, 1, 0, 4, 2, 6, 0, 2, 1, 0, 4, 2, 5, 3, 1, 3,
-	1, 6, 5, 3, 4, 2, 6, 3, 1, 5, 2, 6, 3, 3, 0, 1, 0, 3, 6, 1,
-	2, 1, 3, 6, 0, 2, 4, 6, 1, 6, 1, 0, 3, 2, 1, 5, 0, 4, 6, 4,
-	3, 6, 0, 5, 4, 5, 2, 0, 2, 2, 5, 3, 0, 1, 4, 3, 1, 2, 4, 6,
-	4, 6, 2, 0, 1, 3, 4, 3, 1, 0, 3, 3, 2, 5, 4, 3, 4, 6, 5, 0,
-	5, 1, 3, 6, 4, 5, 6, 2, 6, 3, 3, 4, 3, 0, 4, 0, 4, 2, 5, 0,
-	6, 5, 1, 6, 1, 2, 2, 0, 6, 3, 3, 1, 6, 4, 1, 5, 1, 6, 2, 0,
-	0, 2, 4, 4, 6, 4, 2, 1, 0, 6, 0, 4, 0, 1, 3, 6, 2, 4, 2, 2,
-	1, 0, 5, 6, 5, 4, 5, 6, 2, 5, 1, 0, 4, 3, 0, 2, 0, 4, 2, 1,
-	2, 0, 4, 3, 1, 3, 0, 1, 6, 2, 0, 2, 3, 2, 3, 0, 2, 3, 6, 2,
-	3, 0, 3, 6, 0, 1, 0, 2, 5, 1, 4, 6, 5, 1, 4, 4, 5, 2, 3, 3,
-	4, 2, 1, 3, 6, 3, 1, 3, 5, 5, 1, 3, 1, 2, 4, 0, 5, 4, 2, 4,
-	5, 2, 3, 5, 6, 4, 1, 5, 1, 4, 2, 1, 1, 2, 6, 3, 1, 2, 1, 6,
-	6, 2, 1, 5, 0, 3, 0, 5, 2, 4, 5, 0, 2, 0, 4, 2, 3, 6, 0, 4,
-	0, 3, 3, 0, 3, 0, 1, 0, 3, 0, 5, 3, 5, 6, 2, 4, 1, 0, 4, 2,
-	1, 5, 1, 6, 0, 2, 1, 1, 5, 2, 6, 2, 4, 0, 4, 2, 0, 2, 3, 5,
-	2, 0, 2, 0, 1, 2, 3, 5, 0, 4, 1, 5, 6, 5, 3, 6, 0, 6, 3, 1,
-	3, 0, 6, 4, 5, 6, 2, 5, 6, 4, 0, 2, 3, 2, 0, 4, 2, 1, 0, 6,
-	4, 5, 0, 3, 5, 5, 1, 4, 6, 1, 1, 5, 2, 5, 0, 3, 4, 2, 4, 5,
-	5, 6, 1, 6, 1, 0, 0, 6, 1, 4, 0, 2, 6, 5, 2, 6, 2, 6, 1, 0,
-	6, 5, 4, 2, 0, 4, 1, 4, 1, 6, 2, 0, 2, 0, 6, 0, 5, 3, 3, 4,
-	0, 5, 6, 1, 0, 3, 4, 3, 5, 1, 4, 2, 1, 4, 2, 4, 1, 5, 0, 2,
-	1, 5, 2, 1, 0, 3, 4, 2, 2, 1, 3, 4, 0, 6, 4, 0, 3, 5, 4, 4,
-	2, 0, 1, 2, 5, 4, 0, 6, 0, 6, 1, 2, 1, 3, 6, 5, 6, 6, 4, 2,
-	3, 4, 6, 0, 6, 1, 5, 1, 5, 3, 0, 6, 2, 0, 4, 5, 1, 4, 5, 6,
-	4, 0, 3, 5, 1, 4, 3, 4, 4, 1, 5, 6, 2, 1, 5, 1, 4, 6, 0, 1,
-	5, 4, 6, 3, 5, 6, 4, 3, 4, 3, 0, 1, 3, 1, 6, 3, 0, 6, 2, 4,
-	6, 0, 2, 3, 3, 5, 4, 5, 2, 0, 2, 1, 4, 6, 3, 5, 0, 3, 6, 2,
-	0, 4, 2, 1, 6, 6, 0, 1, 4, 6, 1, 2, 6, 6, 1, 4, 2, 5, 6, 2,
-	1, 4, 4, 5, 2, 4, 0, 4, 5, 3, 0, 2, 0, 1, 2, 6, 0, 1, 6, 1,
-	2, 1, 3, 6, 1, 6, 4, 0, 2, 3, 4, 1, 3, 1, 1, 5, 2, 4, 3, 6,
-	3, 0, 5, 5, 6, 5, 4, 1, 2, 3, 4, 5, 1, 3, 3, 6, 5, 1, 0, 4,
-	4, 1, 3, 3, 0, 3, 2, 3, 1, 5, 3, 2, 3, 5, 6, 5, 4, 2, 3, 6,
-	5, 4, 1, 4, 0, 1, 1, 3, 4, 0, 1, 6, 1, 4, 5, 3, 6, 2, 0, 5,
-	6, 5, 0, 2, 5, 0, 3, 6, 1, 2, 3, 2, 1, 3, 2, 1, 4, 1, 2, 3,
-	0, 4, 2, 0, 3, 1, 4, 1, 5, 0, 6, 1, 2, 0, 1, 6, 3, 4, 0, 4,
-	1, 4, 3, 1, 2, 5, 6, 1, 2, 3, 0, 3, 1, 3, 3, 6, 2, 3, 1, 6,
-	2, 3, 6, 0, 4, 5, 2, 5, 3, 2, 3, 5, 1, 2, 6, 4, 6, 5, 6, 1,
-	3, 0, 6, 2, 4, 6, 2, 1, 5, 2, 1, 5, 6, 1, 4, 0, 6, 5, 6, 5,
-	4, 2, 1, 5, 2, 4, 3, 0, 4, 6, 5, 4, 1, 5, 0, 6, 4, 1, 4, 5,
-	5, 2, 0, 4, 3, 4, 3, 3, 0, 3, 1, 5, 0, 5, 3, 5, 3, 5, 3, 1,
-	6, 1, 5, 3, 1, 3, 1, 4, 0, 4, 5, 1, 0, 2, 1, 6, 0, 3, 2, 1,
-	0, 1, 6, 0, 3, 5, 3, 6, 0, 4, 1, 1, 3, 4, 3, 4, 5, 6, 2, 0,
-	1, 0, 6, 6, 1, 3, 1, 2, 4, 0, 5, 6, 0, 6, 1, 0, 6, 3, 4, 5,
-	2, 1, 0, 1, 1, 3, 3, 1, 2, 6, 2, 4, 6, 5, 3, 6, 4, 0, 4, 2,
-	3, 4, 5, 2, 5, 5, 2, 4, 0, 6, 0, 3, 4, 4, 3, 2, 5, 5, 3, 2,
-	4, 2, 4, 1, 5, 0, 3, 4, 2, 5, 1, 0, 1, 4, 0, 3, 4, 3, 5, 3,
-	5, 3, 5, 0, 1, 6, 1, 4, 3, 1, 6, 4, 0, 2, 0, 5, 4, 0, 6, 0,
-	6, 3, 1, 4, 2, 3, 2, 0, 5, 3, 4, 5, 6, 2, 1, 5, 0, 2, 5, 3,
-	0, 5, 0, 2, 5, 1, 5, 2, 4, 3, 3, 4, 3, 2, 1, 6, 3, 4, 5, 2,
-	1, 0, 3, 5, 1, 5, 2, 1, 3, 1, 6, 2, 0, 5, 2, 0, 6, 5, 6, 4,
-	2, 0, 3, 6, 4, 2, 1, 0, 4, 3, 6, 0, 3, 2, 3, 4, 0, 4, 0, 4,
-	3, 5, 4, 0, 3, 6, 5, 4, 6, 0, 2, 6, 1, 5, 0, 3, 6, 0, 6, 2,
-	4, 3, 6, 4, 2, 5, 1, 4, 3, 2, 5, 0, 5, 4, 2, 1, 2, 1, 5, 4,
-	5, 1, 2, 6, 1, 4, 3, 0, 2, 6, 1, 5, 3, 1, 3, 5, 0, 1, 0, 3,
-	6, 0, 2, 0, 2, 5, 3, 3, 2, 5, 4, 0, 6, 4, 3, 5, 4, 2, 1, 5,
-	0, 6, 5, 3, 3, 0, 1, 2, 1, 4, 3, 1, 2, 3, 3, 4, 6, 3, 3, 1,
-	1, 6, 5, 1, 3, 0, 1, 3, 6, 2, 5, 6, 4, 5, 6, 0, 5, 2, 1, 1,
-	2, 5, 1, 0, 6, 1, 5, 4, 2, 0, 0, 4, 4, 1, 3, 5, 3, 5, 0, 4,
-	3, 4, 1, 4, 3, 4, 1, 4, 3, 6, 6, 3, 4, 2, 3, 2, 3, 5, 0, 5,
-	4, 1, 6, 1, 0, 5, 4, 3, 2, 4, 0, 2, 0, 5, 0, 5, 1, 1, 6, 0,
-	5, 4, 2, 3, 4, 3, 0, 5, 4, 5, 3, 2, 6, 5, 1, 0, 4, 1, 3, 2,
-	6, 5, 0, 6, 3, 2, 4, 6, 0, 2, 6, 0, 3, 1, 5, 4, 3, 6, 4, 1,
-	0, 1, 2, 3, 4, 1, 5, 1, 5, 2, 3, 6, 4, 2, 1, 3, 0, 6, 2, 3,
-	1, 2, 1, 3, 3, 1, 3, 1, 3, 0, 1, 0, 6, 0, 3, 4, 6, 5, 0, 2,
-	2, 1, 6, 2, 0, 6, 4, 3, 2, 1, 4, 3, 2, 6, 4, 6, 2, 1, 5, 3,
-	3, 1, 3, 5, 6, 1, 0, 5, 6, 0, 1, 4, 0, 6, 4, 6, 2, 1, 0, 5,
-	4, 0, 2, 1, 2, 5, 4, 2, 4, 5, 2, 6, 5, 4, 3, 6, 5, 6, 0, 6,
-	5, 3, 0, 4, 6, 4, 5, 1, 1, 6, 6, 2, 4, 5, 6, 1, 0, 6, 5, 2,
-	6, 3, 6, 0, 6, 1, 4, 4, 4, 2, 2, 1, 4, 3, 2, 3, 2, 3, 4, 0,
-	0, 2, 3, 5, 3, 1, 5, 2, 3, 1, 4, 2, 3, 4, 3, 3, 5, 2, 4, 3,
-	1, 0, 0, 5, 2, 1, 6, 5, 1, 0, 1, 2, 6, 5, 1, 5, 3, 1, 3, 5,
-	2, 4, 3, 3, 5, 1, 3, 6, 0, 1, 2, 0, 3, 6, 6, 5, 1, 4, 0, 5,
-	3, 4, 2, 5, 0, 6, 5, 3, 3, 5, 0, 4, 5, 4, 2, 3, 0, 5, 1, 5,
-	4, 0, 5, 3, 3, 0, 2, 0, 5, 2, 1, 6, 4, 2, 6, 0, 4, 3, 0, 2,
-	5, 2, 6, 3, 1, 2, 2, 5, 2, 0, 5, 6, 5, 0, 3, 5, 0, 1, 5, 2,
-	6, 2, 4, 1, 4, 6, 4, 2, 1, 4, 0, 4, 0, 1, 1, 5, 6, 2, 6, 0,
-	0, 5, 0, 5, 1, 4, 6, 5, 2, 1, 4, 6, 3, 6, 3, 2, 1, 4, 0, 4,
-	1, 6, 0, 5, 0, 1, 5, 4, 6, 4, 1, 5, 6, 2, 5, 1, 3, 5, 0, 6,
-	2, 4, 0, 3, 6, 2, 5, 4, 3, 0, 6, 0, 6, 5, 0, 3, 0, 5, 2, 6,
-	3, 5, 6, 2, 6, 2, 5, 4, 3, 4, 6, 4, 3, 2, 0, 3, 0, 2, 5, 3,
-	4, 5, 6, 1, 4, 2, 5, 0, 1, 1, 4, 1, 4, 2, 0, 5, 6, 2, 0, 2,
-	5, 6, 0, 4, 1, 5, 6, 4, 2, 2, 4, 3, 1, 1, 3, 1, 6, 5, 1, 3,
-	6, 0, 5, 1, 0, 3, 6, 2, 6, 0, 6, 0, 2, 4, 2, 4, 0, 4, 5, 3,
-	0, 6, 2, 5, 1, 5, 1, 6, 0, 4, 2, 6, 2, 4, 2, 0, 5, 3, 0, 1,
-	1, 5, 1, 5, 3, 3, 1, 2, 0, 5, 1, 0, 2, 6, 0, 2, 1, 5, 1, 3,
-	2, 3, 6, 5, 4, 2, 4, 2, 6, 1, 6, 3, 0, 4, 0, 0, 5, 3, 1, 0,
-	3, 0, 4, 5, 1, 2, 5, 0, 6, 5, 1, 1, 2, 0, 3, 3, 5, 1, 6, 3,
-	4, 0, 5, 3, 2, 0, 6, 3, 6, 4, 0, 2, 3, 0, 4, 1, 2, 3, 3, 4,
-	5, 2, 0, 6, 0, 1, 5, 6, 1, 4, 1, 4, 1, 4, 3, 5, 4, 6, 2, 5,
-	6, 3, 0, 3, 2, 4, 1, 3, 5, 2, 5, 6, 1, 2, 0, 6, 0, 4, 2, 0,
-	0, 2, 3, 4, 6, 2, 4, 1, 6, 4, 2, 5, 2, 6, 2, 1, 2, 4, 5, 3,
-	1, 5, 2, 6, 5, 3, 2, 1, 4, 1, 4, 3, 2, 1, 6, 1, 5, 2, 0, 2,
-	2, 1, 6, 2, 1, 3, 1, 0, 6, 0, 6, 3, 1, 3, 2, 0, 5, 4, 0, 5,
-	3, 6, 3, 1, 4, 1, 0, 4, 2, 5, 1, 5, 6, 2, 5, 2, 6, 2, 6, 2,
-	4, 3, 6, 5, 6, 2, 3, 5, 1, 4, 6, 4, 0, 1, 4, 1, 2, 3, 0, 4,
-	5, 4, 6, 0, 5, 2, 4, 1, 5, 1, 5, 6, 5, 2, 6, 5, 1, 4, 1, 2,
-	6, 1, 0, 1, 6, 0, 2, 6, 1, 3, 6, 5, 6, 2, 6, 5, 0, 6, 4, 2,
-	0, 1, 0, 5, 5, 0, 6, 3, 5, 1, 0, 6, 0, 6, 4, 1, 4, 0, 6, 3,
-	1, 2, 4, 4, 2, 4, 5, 0, 3, 5, 3, 3, 2, 1, 5, 3, 1, 3, 0, 3,
-	2, 4, 1, 3, 6, 4, 4, 3, 6, 5, 1, 2, 0, 4, 3, 2, 6, 4, 5, 4,
-	3, 6, 0, 3, 5, 1, 3, 2, 6, 2, 1, 5, 3, 4, 0, 1, 2, 4, 3, 4,
-	4, 2, 0, 5, 6, 1, 6, 0, 4, 5, 0, 3, 6, 2, 6, 4, 1, 5, 3, 5,
-	5, 6, 2, 1, 2, 2, 0, 5, 2, 5, 0, 0, 2, 1, 2, 1, 2, 0, 1, 6,
-	6, 1, 6, 1, 3, 0, 1, 6, 5, 4, 0, 2, 3, 2, 1, 6, 2, 6, 6, 0,
-	0, 4, 2, 2, 4, 1, 5, 1, 4, 0, 5, 0, 5, 0, 5, 6, 3, 1, 5, 1,
-	1, 0, 2, 1, 6, 1, 2, 0, 2, 3, 0, 5, 0, 3, 5, 0, 5, 4, 1, 0,
-	2, 2, 5, 3, 2, 0, 4, 5, 0, 1, 6, 2, 3, 1, 0, 6, 3, 3, 1, 3,
-	3, 5, 2, 3, 1, 0, 3, 2, 6, 0, 5, 2, 5, 0, 3, 5, 4, 6, 4, 2,
-	4, 2, 3, 5, 1, 6, 3, 0, 2, 4, 2, 3, 1, 4, 5, 1, 0, 1, 5, 6,
-	5, 6, 5, 2, 4, 6, 0, 2, 6, 5, 6, 1, 2, 5, 1, 3, 2, 4, 6, 6,
-	6, 2, 0, 2, 4, 0, 5, 2, 5, 6, 6, 4, 3, 2, 6, 1, 2, 4, 0, 3,
-	0, 2, 3, 4, 6, 2, 3, 6, 1, 5, 3, 0, 0, 5, 6, 3, 6, 3, 0, 4,
-	1, 4, 0, 6, 0, 3, 1, 4, 6, 3, 1, 1, 3, 5, 0, 6, 2, 0, 3, 1,
-	2, 6, 3, 6, 3, 2, 0, 3, 1, 3, 5, 0, 4, 0, 5, 1, 3, 6, 5, 1,
-	3, 4, 5, 3, 5, 1, 3, 6, 5, 1, 5, 0, 1, 2, 0, 2, 1, 2, 0, 4,
-	4, 3, 2, 6, 3, 2, 4, 2, 5, 2, 1, 0, 1, 3, 2, 6, 2, 0, 6, 0,
-	5, 2, 6, 4, 5, 1, 4, 2, 5, 5, 1, 3, 2, 2, 0, 2, 6, 1, 1, 0,
-	6, 3, 1, 3, 1, 5, 2, 3, 3, 1, 6, 5, 2, 5, 6, 4, 3, 0, 2, 6,
-	0, 4, 1, 5, 0, 2, 0, 1, 0, 6, 4, 0, 6, 0, 1, 1, 2, 6, 2, 4,
-	1, 5, 1, 1, 4, 1, 6, 0, 3, 5, 4, 0, 4, 2, 4, 3, 0, 1, 2, 5,
-	2, 6, 4, 1, 5, 1, 5, 6, 6, 3, 4, 1, 4, 4, 3, 0, 6, 1, 6, 1,
-	3, 0, 3, 5, 1, 3, 5, 6, 2, 0, 3, 2, 2, 1, 6, 3, 5, 0, 0, 3,
-	4, 1, 6, 4, 6, 3, 6, 6, 0, 4, 5, 2, 4, 3, 1, 5, 6, 1, 6, 3,
-	5, 0, 5, 6, 2, 0, 6, 0, 1, 6, 4, 6, 2, 6, 0, 4, 2, 3, 6, 1,
-	6, 1, 3, 4, 0, 3, 6, 4, 0, 4, 5, 4, 0, 6, 1, 5, 1, 4, 5, 6,
-	0, 6, 1, 3, 3, 0, 1, 5, 2, 6, 4, 1, 4, 5, 6, 5, 0, 6, 3, 4,
-	1, 6, 2, 4, 2, 5, 6, 5, 1, 6, 3, 1, 4, 4, 2, 5, 1, 0, 2, 1,
-	2, 1, 6, 0, 1, 6, 1, 3, 5, 5, 3, 0, 1, 1, 2, 4, 6, 5, 3, 0,
-	3, 1, 4, 6, 5, 4, 6, 2, 5, 2, 5, 0, 5, 0, 5, 4, 6, 1, 4, 6,
-	4, 5, 0, 2, 5, 6, 2, 3, 5, 3, 0, 2, 4, 0, 3, 3, 5, 4, 6, 0,
-	5, 4, 0, 2, 3, 5, 0, 4, 2, 1, 1, 5, 2, 0, 3, 1, 6, 1, 3, 4,
-	6, 2, 0, 5, 1, 5, 4, 5, 3, 0, 3, 2, 6, 3, 5, 3, 5, 1, 5, 0,
-	0, 3, 5, 6, 0, 4, 0, 3, 3, 4, 2, 4, 5, 1, 3, 1, 3, 0, 4, 1,
-	1, 3, 2, 4, 2, 5, 0, 1, 2, 5, 4, 0, 6, 0, 4, 1, 6, 4, 4, 2,
-	2, 1, 1, 3, 5, 6, 2, 5, 3, 6, 3, 3, 6, 0, 1, 2, 3, 1, 3, 6,
-	3, 6, 3, 0, 4, 1, 0, 1, 0, 4, 1, 4, 0, 1, 5, 0, 1, 6, 4, 0,
-	4, 3, 0, 2, 0, 0, 3, 1, 0, 1, 5, 4, 5, 5, 0, 6, 2, 3, 5, 0,
-	5, 1, 4, 2, 4, 2, 6, 3, 1, 3, 1, 0, 4, 5, 5, 3, 5, 3, 4, 3,
-	6, 5, 0, 3, 1, 5, 3, 1, 6, 2, 2, 5, 0, 1, 3, 3, 3, 6, 0, 5,
-	0, 4, 6, 2, 0, 0, 6, 1, 2, 4, 2, 6, 2, 0, 2, 4, 1, 5, 2, 1,
-	1, 0, 3, 5, 5, 2, 3, 4, 4, 6, 5, 3, 5, 5, 6, 2, 4, 2, 6, 1,
-	2, 1, 4, 2, 0, 6, 4, 5, 4, 5, 1, 5, 3, 5, 3, 2, 1, 3, 5, 0,
-	3, 6, 1, 3, 5, 1, 4, 5, 0, 3, 5, 0, 0, 1, 5, 6, 4, 0, 0, 5,
-	4, 2, 1, 0, 5, 1, 2, 0, 4, 6, 2, 3, 1, 4, 2, 4, 2, 0, 2, 4,
-	5, 4, 6, 0, 6, 2, 5, 1, 5, 3, 2, 2, 1, 5, 4, 3, 2, 6, 1, 0,
-	6, 0, 5, 0, 1, 4, 0, 2, 5, 0, 6, 2, 0, 3, 1, 5, 6, 4, 0, 4,
-	0, 1, 6, 5, 0, 0, 4, 2, 3, 0, 5, 1, 5, 6, 2, 4, 2, 3, 4, 6,
-	1, 0, 6, 1, 1, 0, 3, 6, 2, 4, 5, 1, 2, 4, 2, 6, 0, 5, 6, 1,
-	2, 0, 3, 2, 6, 0, 4, 2, 4, 0, 4, 5, 0, 6, 1, 5, 1, 0, 3, 1,
-	3, 5, 6, 1, 6, 1, 3, 2, 3, 4, 3, 1, 4, 2, 1, 3, 2, 1, 1, 4,
-	4, 2, 3, 2, 0, 2, 0, 2, 1, 4, 3, 5, 1, 5, 1, 6, 1, 3, 4, 6,
-	5, 2, 4, 1, 4, 1, 0, 5, 4, 1, 3, 6, 1, 2, 5, 3, 1, 3, 4, 0,
-	6, 3, 1, 4, 5, 2, 5, 3, 6, 5, 1, 3, 6, 0, 4, 6, 3, 6, 5, 0,
-	0, 5, 3, 1, 6, 1, 0, 1, 4, 2, 5, 1, 4, 5, 3, 2, 0, 2, 0, 5,
-	1, 3, 2, 0, 3, 1, 0, 4, 0, 3, 1, 4, 5, 2, 4, 4, 5, 0, 4, 0,
-	2, 6, 4, 3, 1, 3, 3, 4, 2, 4, 4, 3, 1, 3, 6, 2, 5, 3, 1, 4,
-	3, 2, 1, 2, 6, 2, 0, 5, 2, 1, 2, 5, 0, 3, 1, 3, 6, 1, 5, 0,
-	4, 3, 5, 6, 1, 3, 1, 6, 1, 3, 3, 6, 5, 2, 6, 0, 1, 4, 5, 3,
-	5, 3, 5, 4, 0, 2, 4, 1, 0, 0, 2, 4, 6, 1, 5, 4, 6, 0, 5, 4,
-	6, 2, 0, 3, 5, 2, 6, 0, 2, 3, 0, 2, 5, 1, 1, 3, 4, 5, 0, 1,
-	0, 2, 0, 6, 3, 6, 4, 1, 3, 4, 0, 6, 2, 6, 2, 4, 5, 3, 6, 5,
-	1, 0, 5, 0, 4, 0, 0, 5, 3, 5, 2, 6, 2, 3, 1, 6, 1, 2, 6, 0,
-	2, 3, 3, 0, 5, 1, 2, 4, 1, 0, 6, 6, 1, 5, 1, 3, 1, 4, 3, 2,
-	3, 4, 3, 5, 3, 5, 4, 6, 4, 3, 2, 4, 2, 3, 2, 0, 2, 5, 2, 5,
-	4, 1, 6, 6, 4, 0, 2, 4, 5, 1, 3, 1, 2, 4, 3, 4, 1, 6, 4, 5,
-	5, 6, 5, 3, 1, 6, 1, 1, 6, 0, 1, 2, 6, 3, 0, 4, 4, 6, 2, 6,
-	6, 5, 2, 4, 5, 2, 6, 4, 0, 5, 4, 1, 2, 1, 3, 0, 4, 5, 4, 1,
-	0, 1, 6, 3, 2, 6, 2, 1, 3, 1, 2, 4, 0, 3, 2, 0, 5, 6, 1, 1,
-	1, 0, 3, 5, 1, 3, 2, 4, 3, 4, 2, 6, 4, 1, 0, 6, 2, 4, 6, 2,
-	2, 4, 1, 6, 5, 0, 4, 1, 4, 6, 5, 1, 3, 4, 5, 3, 3, 6, 3, 4,
-	3, 6, 2, 0, 6, 5, 3, 2, 6, 5, 1, 3, 2, 1, 1, 0, 0, 5, 2, 0,
-	4, 0, 2, 1, 4, 1, 5, 6, 0, 6, 1, 5, 3, 5, 1, 5, 3, 1, 4, 4,
-	5, 3, 0, 4, 1, 3, 2, 1, 2, 1, 0, 3, 1, 1, 5, 0, 1, 4, 2, 5,
-	6, 4, 1, 3, 1, 5, 2, 6, 0, 2, 5, 3, 5, 4, 0, 6, 3, 4, 4, 4,
-	0, 5, 3, 4, 2, 3, 4, 6, 3, 5, 1, 6, 0, 6, 1, 3, 1, 4, 2, 3,
-	1, 1, 5, 0, 5, 6, 0, 4, 3, 0, 5, 3, 1, 2, 4, 6, 5, 0, 3, 3,
-	2, 5, 0, 6, 2, 3, 5, 1, 3, 6, 3, 1, 5, 0, 5, 1, 5, 4, 6, 1,
-	3, 0, 4, 3, 0, 3, 5, 2, 0, 0, 6, 5, 1, 6, 1, 4, 0, 6, 4, 1,
-	4, 0, 3, 6, 5, 2, 4, 5, 1, 6, 0, 6, 3, 6, 2, 0, 2, 6, 0, 4,
-	5, 4, 5, 6, 4, 3, 5, 0, 6, 1, 5, 3, 3, 1, 3, 2, 6, 0, 6, 4,
-	6, 1, 3, 0, 5, 6, 3, 5, 0, 1, 5, 6, 2, 3, 6, 2, 1, 3, 0, 1,
-	0, 2, 3, 1, 3, 1, 2, 6, 3, 0, 4, 2, 1, 5, 0, 6, 0, 4, 1, 2,
-	1, 5, 6, 2, 0, 1, 2, 4, 0, 5, 3, 1, 1, 5, 2, 6, 2, 1, 6, 5,
-	2, 3, 5, 4, 4, 6, 1, 1, 6, 6, 2, 6, 5, 0, 2, 3, 2, 6, 2, 0,
-	3, 3, 2, 3, 2, 6, 3, 5, 1, 4, 5, 4, 0, 4, 1, 2, 2, 1, 2, 5,
-	4, 0, 3, 5, 1, 4, 6, 6, 1, 5, 2, 4, 2, 4, 2, 5, 2, 5, 1, 0,
-	5, 4, 2, 0, 3, 5, 2, 5, 1, 1, 3, 1, 0, 1, 1, 2, 5, 3, 1, 6,
-	6, 0, 1, 3, 1, 2, 3, 2, 6, 1, 3, 1, 6, 2, 6, 0, 1, 2, 0, 2,
-	0, 0, 3, 3, 4, 1, 0, 6, 5, 2, 4, 0, 1, 0, 6, 4, 1, 6, 1, 2,
-	1, 5, 2, 1, 3, 6, 6, 1, 6, 5, 4, 5, 6, 1, 6, 2, 5, 4, 2, 3,
-	2, 4, 3, 6, 4, 0, 2, 3, 1, 1, 2, 5, 4, 1, 0, 6, 3, 5, 0, 3,
-	3, 0, 1, 1, 5, 0, 1, 2, 1, 0, 5, 4, 6, 0, 4, 3, 0, 2, 3, 0,
-	4, 1, 4, 6, 4, 1, 2, 5, 1, 0, 2, 3, 5, 0, 6, 5, 2, 2, 1, 5,
-	5, 6, 2, 3, 4, 0, 3, 2, 1, 4, 6, 4, 5, 0, 4, 2, 6, 1, 0, 4,
-	6, 3, 0, 2, 1, 3, 0, 4, 1, 3, 2, 3, 4, 1, 2, 6, 2, 4, 2, 6,
-	0, 6, 1, 5, 4, 5, 6, 1, 5, 0, 5, 1, 3, 4, 3, 6, 4, 1, 6, 1,
-	1, 6, 1, 0, 3, 5, 0, 4, 0, 0, 5, 1, 0, 4, 3, 1, 2, 6, 1, 1,
-	2, 3, 0, 6, 1, 6, 3, 0, 6, 5, 4, 3, 2, 0, 4, 1, 0, 6, 4, 3,
-	3, 6, 0, 3, 0, 4, 5, 1, 3, 0, 1, 3, 2, 3, 1, 3, 1, 6, 3, 5,
-	4, 1, 6, 0, 1, 6, 1, 6, 4, 2, 1, 1, 2, 3, 0, 2, 6, 2, 1, 3,
-	5, 1, 3, 3, 6, 5, 1, 2, 3, 2, 5, 2, 5, 6, 1, 3, 2, 5, 1, 0,
-	6, 2, 0, 1, 5, 4, 6, 2, 6, 3, 2, 6, 1, 3, 0, 6, 5, 0, 1, 1,
-	0, 5, 0, 4, 2, 4, 5, 2, 4, 3, 6, 3, 2, 0, 5, 1, 4, 1, 4, 6,
-	1, 3, 3, 0, 1, 2, 4, 0, 2, 1, 3, 5, 1, 4, 2, 4, 3, 6, 5, 4,
-	2, 0, 2, 6, 2, 5, 3, 1, 2, 5, 6, 1, 2, 6, 4, 5, 4, 2, 3, 1,
-	3, 6, 0, 6, 3, 6, 4, 5, 2, 1, 5, 1, 1, 4, 2, 5, 1, 3, 3, 5,
-	4, 2, 4, 6, 0, 6, 5, 2, 4, 0, 2, 1, 6, 2, 6, 3, 5, 6, 6, 2,
-	5, 3, 1, 5, 4, 1, 4, 0, 2, 1, 0, 4, 6, 6, 5, 2, 5, 2, 5, 1,
-	6, 1, 6, 5, 0, 2, 5, 1, 2, 0, 4, 2, 4, 6, 4, 1, 3, 4, 1, 5,
-	0, 2, 5, 0, 4, 2, 6, 3, 6, 1, 3, 5, 3, 0, 2, 4, 2, 1, 3, 1,
-	1, 5, 0, 3, 1, 0, 4, 3, 4, 0, 2, 0, 5, 6, 0, 2, 1, 5, 5, 4,
-	2, 4, 1, 5, 3, 0, 6, 1, 3, 5, 3, 4, 0, 6, 0, 3, 1, 6, 5, 2,
-	3, 2, 2, 5, 3, 1, 5, 2, 5, 2, 6, 4, 1, 2, 1, 0, 4, 3, 4, 1,
-	4, 3, 6, 6, 6, 5, 6, 2, 4, 0, 4, 2, 0, 1, 4, 3, 1, 3, 0, 6,
-	5, 6, 2, 6, 3, 4, 2, 5, 2, 0, 1, 2, 0, 6, 6, 3, 1, 6, 5, 0,
-	6, 0, 2, 3, 4, 1, 5, 1, 0, 5, 2, 5, 2, 5, 3, 1, 5, 2, 3, 0,
-	0, 2, 6, 4, 3, 6, 4, 2, 4, 0, 2, 6, 0, 4, 6, 2, 5, 1, 3, 6,
-	1, 3, 5, 6, 4, 1, 4, 2, 5, 4, 6, 4, 3, 6, 3, 4, 5, 6, 0, 1,
-	2, 5, 0, 1, 5, 6, 4, 2, 6, 5, 4, 2, 0, 4, 6, 3, 0, 1, 3, 6,
-	3, 1, 3, 5, 1, 1, 2, 5, 1, 3, 1, 1, 2, 0, 6, 4, 5, 4, 1, 4,
-	4, 0, 5, 6, 4, 3, 6, 4, 6, 0, 3, 4, 1, 4, 6, 2, 3, 4, 1, 6,
-	5, 0, 6, 1, 2, 0, 1, 2, 6, 5, 2, 1, 4, 6, 4, 3, 6, 5, 5, 6,
-	6, 2, 3, 5, 3, 5, 6, 5, 4, 2, 6, 5, 1, 4, 2, 6, 6, 1, 1, 6,
-	0, 5, 6, 5, 6, 2, 5, 3, 6, 5, 3, 6, 5, 4, 6, 5, 0, 5, 5, 0,
-	1, 4, 5, 6, 2, 5, 3, 0, 6, 5, 6, 0, 0, 4, 0, 6, 4, 1, 3, 0,
-	2, 4, 5, 6, 2, 3, 1, 2, 0, 4, 3, 4, 5, 2, 5, 4, 3, 3, 3, 2,
-	3, 0, 4, 6, 4, 6, 3, 2, 5, 1, 2, 1, 0, 5, 2, 4, 6, 4, 2, 4,
-	4, 6, 0, 3, 0, 0, 5, 2, 5, 4, 0, 2, 5, 0, 1, 1, 3, 0, 1, 0,
-	5, 0, 3, 5, 0, 2, 0, 2, 4, 3, 4, 2, 5, 0, 4, 3, 2, 0, 3, 6,
-	6, 1, 6, 2, 3, 6, 0, 3, 2, 4, 1, 6, 2, 0, 1, 5, 3, 3, 3, 3,
-	0, 5, 1, 0, 2, 3, 0, 4, 5, 0, 2, 0, 2, 5, 3, 1, 4, 6, 2, 5,
-	1, 6, 3, 2, 4, 2, 3, 3, 4, 6, 3, 6, 4, 5, 4, 5, 2, 5, 1, 3,
-	2, 6, 5, 4, 2, 4, 5, 1, 5, 0, 1, 5, 1, 5, 6, 6, 4, 3, 0, 2,
-	3, 4, 5, 0, 3, 2, 3, 6, 3, 6, 5, 5, 1, 2, 6, 4, 3, 2, 0, 2,
-	4, 0, 2, 0, 2, 6, 0, 3, 1, 0, 6, 6, 2, 0, 4, 3, 2, 4, 1, 0,
-	5, 2, 2, 4, 6, 3, 2, 6, 6, 5, 1, 0, 5, 4, 0, 5, 3, 6, 0, 5,
-	6, 5, 4, 5, 2, 3, 5, 1, 5, 0, 4, 5, 2, 6, 2, 1, 2, 3, 3, 6,
-	0, 3, 1, 4, 2, 3, 1, 2, 1, 4, 5, 4, 1, 1, 5, 1, 3, 6, 5, 4,
-	1, 0, 6, 0, 3, 1, 4, 0, 5, 1, 0, 2, 5, 0, 6, 4, 3, 6, 1, 2,
-	2, 4, 4, 4, 6, 6, 6, 3, 1, 6, 3, 5, 1, 2, 1, 5, 1, 0, 5, 3,
-	3, 0, 6, 3, 2, 1, 6, 3, 0, 4, 3, 3, 6, 0, 4, 3, 6, 3, 3, 4,
-	4, 6, 0, 2, 1, 4, 3, 2, 6, 0, 2, 6, 5, 3, 1, 3, 0, 1, 3, 6,
-	5, 1, 4, 2, 6, 5, 1, 4, 6, 1, 3, 0, 6, 4, 5, 2, 1, 3, 1, 0,
-	6, 0, 4, 1, 4, 6, 5, 6, 1, 3, 1, 0, 2, 0, 2, 0, 3, 5, 1, 1,
-	0, 6, 0, 3, 5, 4, 1, 3, 0, 5, 1, 5, 2, 0, 3, 1, 3, 4, 2, 0,
-	1, 0, 3, 2, 3, 4, 0, 5, 6, 3, 2, 4, 1, 5, 2, 1, 6, 2, 1, 2,
-	2, 0, 5, 1, 2, 1, 3, 0, 1, 0, 6, 4, 0, 3, 6, 0, 4, 0, 5, 3,
-	3, 1, 0, 3, 6, 6, 2, 4, 0, 4, 5, 0, 4, 3, 4, 1, 3, 2, 4, 3,
-	4, 5, 4, 5, 6, 3, 4, 1, 6, 4, 3, 6, 3, 1, 1, 1, 0, 1, 3, 5,
-	5, 2, 5, 0, 3, 2, 1, 4, 4, 1, 4, 3, 6, 3, 4, 5, 0, 1, 2, 4,
-	6, 2, 0, 2, 4, 5, 2, 6, 2, 2, 5, 0, 6, 5, 6, 4, 5, 2, 5, 0,
-	0, 4, 6, 2, 6, 2, 3, 4, 0, 1, 6, 6, 0, 1, 0, 3, 5, 1, 1, 6,
-	1, 6, 4, 3, 2, 1, 1, 1, 0, 4, 5, 6, 4, 6, 2, 1, 3, 6, 1, 4,
-	2, 0, 4, 1, 0, 4, 5, 1, 5, 2, 4, 5, 3, 4, 0, 2, 6, 2, 3, 5,
-	3, 4, 6, 1, 2, 0, 1, 4, 2, 0, 4, 0, 6, 3, 1, 2, 0, 4, 6, 2,
-	4, 4, 1, 4, 5, 1, 5, 4, 2, 3, 2, 4, 2, 1, 4, 5, 6, 3, 1, 4,
-	5, 2, 5, 0, 2, 1, 0, 4, 2, 1, 6, 5, 2, 4, 6, 2, 0, 2, 5, 1,
-	6, 1, 4, 2, 0, 6, 5, 6, 3, 5, 6, 0, 1, 4, 5, 4, 5, 3, 0, 2,
-	0, 1, 3, 4, 3, 6, 4, 5, 6, 3, 5, 2, 4, 2, 6, 5, 6, 0, 3, 4,
-	1, 5, 6, 2, 4, 3, 0, 6, 1, 6, 0, 1, 0, 3, 2, 3, 0, 3, 1, 0,
-	2, 4, 5, 4, 3, 4, 3, 4, 2, 1, 0, 2, 0, 5, 4, 0, 6, 3, 0, 4,
-	3, 0, 4, 2, 2, 0, 4, 3, 5, 1, 4, 0, 3, 0, 2, 4, 6, 1, 2, 0,
-	4, 5, 6, 1, 4, 2, 1, 6, 2, 3, 0, 2, 1, 6, 0, 2, 4, 3, 2, 5,
-	5, 3, 3, 1, 3, 5, 6, 0, 4, 4, 0, 5, 1, 5, 0, 4, 3, 0, 3, 5,
-	6, 3, 2, 4, 6, 5, 1, 0, 4, 2, 0, 2, 5, 2, 4, 0, 4, 1, 4, 2,
-	0, 3, 1, 3, 0, 4, 1, 2, 1, 6, 2, 4, 2, 4, 0, 6, 4, 6, 2, 5,
-	1, 2, 1, 6, 2, 3, 3, 1, 0, 6, 5, 6, 3, 1, 6, 0, 5, 6, 0, 1,
-	2, 4, 2, 0, 1, 0, 5, 3, 5, 5, 1, 1, 0, 5, 2, 0, 2, 3, 5, 0,
-	3, 5, 2, 5, 6, 5, 4, 5, 3, 3, 6, 2, 6, 5, 3, 4, 2, 1, 6, 3,
-	4, 0, 6, 0, 4, 6, 0, 1, 2, 4, 3, 5, 2, 5, 3, 0, 2, 1, 6, 1,
-	5, 2, 0, 5, 0, 3, 5, 4, 6, 3, 6, 4, 2, 3, 0, 6, 5, 4, 2, 4,
-	6, 3, 4, 0, 4, 1, 4, 4, 5, 1, 5, 2, 1, 2, 4, 5, 1, 5, 4, 1,
-	0, 4, 0, 2, 4, 2, 2, 1, 4, 1, 3, 0, 1, 0, 1, 2, 6, 3, 2, 5,
-	1, 4, 0, 2, 0, 6, 3, 4, 2, 2, 4, 1, 0, 5, 6, 6, 0, 3, 5, 4,
-	2, 4, 6, 3, 4, 6, 5, 4, 6, 1, 2, 6, 4, 6, 5, 4, 3, 2, 4, 6,
-	3, 0, 3, 0, 0, 0, 1, 3, 0, 3, 2, 1, 0, 3, 0, 6, 5, 4, 3, 2,
-	4, 5, 4, 1, 3, 1, 6, 5, 3, 6, 6, 4, 1, 5, 2, 3, 1, 6, 2, 3,
-	5, 3, 4, 3, 5, 2, 4, 1, 4, 2, 4, 4, 2, 0, 2, 6, 1, 6, 3, 6,
-	6, 0, 3, 1, 3, 1, 2, 6, 1, 1, 4, 1, 2, 3, 1, 4, 5, 3, 2, 3,
-	0, 6, 4, 2, 5, 4, 2, 3, 2, 6, 5, 1, 0, 6, 1, 4, 1, 6, 2, 0,
-	1, 5, 4, 1, 5, 6, 1, 0, 3, 4, 2, 4, 6, 4, 1, 1, 2, 0, 5, 0,
-	2, 6, 0, 3, 4, 5, 0, 6, 4, 1, 2, 6, 0, 6, 5, 0, 6, 2, 5, 3,
-	3, 1, 3, 3, 4, 3, 0, 4, 2, 4, 5, 1, 6, 4, 5, 2, 1, 6, 1, 4,
-	4, 6, 3, 2, 5, 0, 6, 3, 2, 1, 6, 0, 4, 3, 2, 3, 2, 3, 5, 6,
-	5, 3, 6, 0, 1, 1, 0, 5, 0, 5, 6, 1, 3, 5, 6, 0, 5, 1, 2, 5,
-	6, 1, 6, 2, 3, 2, 3, 6, 5, 1, 4, 1, 0, 4, 2, 0, 1, 3, 2, 3,
-	0, 6, 4, 0, 4, 1, 0, 5, 0, 0, 6, 3, 1, 3, 0, 5, 4, 6, 5, 2,
-	1, 3, 5, 2, 4, 0, 0, 1, 2, 1, 6, 2, 5, 1, 0, 4, 2, 0, 1, 6,
-	2, 3, 2, 6, 2, 3, 4, 1, 4, 6, 4, 6, 1, 3, 2, 4, 2, 6, 0, 3,
-	3, 4, 5, 4, 5, 1, 0, 6, 2, 3, 5, 4, 1, 2, 3, 5, 3, 4, 6, 0,
-	4, 0, 1, 5, 0, 3, 2, 5, 1, 3, 6, 5, 6, 0, 4, 3, 2, 3, 4, 0,
-	5, 2, 1, 2, 0, 6, 0, 3, 4, 1, 5, 1, 5, 3, 5, 6, 4, 3, 0, 2,
-	6, 1, 0, 1, 3, 1, 2, 1, 5, 6, 0, 6, 1, 6, 4, 0, 6, 0, 5, 4,
-	0, 5, 4, 1, 5, 2, 4, 6, 3, 0, 3, 5, 2, 5, 1, 1, 0, 4, 0, 6,
-	1, 4, 1, 4, 2, 4, 1, 0, 0, 5, 5, 4, 1, 5, 2, 5, 1, 3, 4, 0,
-	2, 6, 2, 4, 5, 4, 5, 6, 0, 6, 1, 3, 5, 6, 2, 4, 4, 2, 0, 5,
-	3, 5, 4, 0, 3, 0, 1, 4, 3, 6, 4, 0, 5, 6, 5, 1, 3, 4, 5, 1,
-	4, 5, 0, 2, 1, 1, 2, 4, 5, 3, 6, 3, 1, 6, 2, 5, 4, 6, 4, 0,
-	5, 6, 1, 6, 1, 5, 3, 5, 1, 0, 2, 3, 3, 0, 5, 2, 5, 0, 3, 0,
-	6, 0, 3, 2, 3, 6, 2, 1, 4, 2, 3, 4, 0, 5, 6, 5, 4, 5, 6, 0,
-	0, 6, 1, 5, 4, 2, 3, 5, 3, 1, 3, 2, 6, 1, 4, 1, 4, 3, 5, 3,
-	1, 6, 1, 6, 3, 6, 3, 0, 4, 2, 0, 6, 2, 1, 0, 6, 1, 5, 0, 1,
-	2, 1, 4, 0, 6, 5, 6, 0, 5, 1, 6, 3, 3, 5, 1, 5, 1, 6, 4, 1,
-	3, 4, 2, 5, 2, 5, 6, 5, 4, 6, 4, 5, 2, 6, 0, 5, 6, 1, 0, 3,
-	4, 6, 2, 4, 1, 4, 2, 1, 4, 3, 4, 6, 4, 5, 2, 4, 2, 0, 6, 4,
-	5, 3, 6, 4, 3, 4, 3, 1, 5, 3, 4, 1, 4, 5, 2, 4, 4, 2, 3, 1,
-	6, 6, 5, 4, 2, 5, 2, 6, 4, 0, 3, 0, 6, 3, 3, 0, 2, 3, 5, 2,
-	0, 5, 4, 2, 0, 1, 4, 6, 0, 3, 3, 6, 0, 3, 0, 2, 1, 1, 1, 1,
-	1, 0, 2, 0, 2, 4, 2, 3, 0, 5, 3, 0, 4, 0, 4, 5, 2, 4, 0, 2,
-	2, 3, 2, 2, 3, 0, 0, 4, 1, 5, 1, 1, 6, 3, 3, 2, 0, 5, 2, 1,
-	3, 6, 2, 3, 2, 0, 2, 6, 4, 6, 2, 1, 0, 2, 6, 3, 2, 1, 4, 0,
-	4, 2, 6, 4, 3, 0, 1, 4, 4, 2, 5, 6, 3, 1, 5, 6, 3, 2, 4, 1,
-	5, 1, 2, 1, 3, 6, 0, 2, 6, 3, 0, 3, 1, 6, 2, 5, 0, 5, 1, 3,
-	6, 0, 4, 0, 4, 0, 4, 4, 3, 2, 6, 2, 5, 0, 6, 0, 4, 6, 3, 1,
-	0, 3, 4, 1, 6, 1, 2, 0, 6, 4, 3, 0, 6, 3, 5, 0, 3, 5, 2, 3,
-	1, 6, 5, 2, 1, 2, 0, 3, 2, 5, 3, 1, 0, 4, 6, 6, 3, 2, 0, 2,
-	2, 6, 3, 6, 3, 2, 3, 0, 5, 3, 1, 4, 4, 2, 5, 4, 2, 6, 0, 5,
-	3, 0, 2, 2, 3, 5, 1, 1, 4, 2, 0, 1, 1, 0, 2, 0, 5, 1, 0, 5,
-	4, 3, 6, 5, 2, 6, 1, 3, 1, 0, 1, 1, 2, 3, 3, 1, 3, 5, 4, 0,
-	5, 0, 4, 2, 4, 3, 5, 1, 2, 0, 6, 2, 5, 2, 0, 4, 3, 2, 6, 2,
-	6, 4, 3, 1, 5, 3, 0, 2, 5, 3, 2, 0, 3, 0, 6, 4, 0, 6, 0, 3,
-	0, 1, 3, 6, 3, 5, 6, 2, 4, 5, 0, 1, 0, 2, 5, 4, 5, 0, 1, 1,
-	1, 1, 4, 3, 3, 5, 0, 5, 1, 0, 5, 3, 6, 6, 4, 3, 5, 2, 4, 1,
-	2, 5, 2, 5, 2, 3, 0, 0, 3, 0, 4, 5, 6, 0, 4, 0, 2, 2, 1, 4,
-	3, 3, 0, 6, 0, 0, 4, 1, 6, 5, 2, 6, 2, 0, 3, 6, 1, 2, 0, 2,
-	4, 0, 3, 3, 5, 2, 5, 1, 3, 5, 3, 1, 3, 3, 4, 1, 0, 0, 4, 1,
-	5, 1, 6, 4, 0, 3, 6, 3, 5, 4, 2, 5, 3, 2, 0, 6, 1, 3, 0, 6,
-	6, 1, 3, 5, 4, 3, 5, 4, 0, 6, 3, 6, 5, 4, 0, 4, 2, 1, 2, 6,
-	0, 3, 3, 0, 5, 4, 2, 4, 4, 2, 6, 1, 2, 0, 2, 4, 3, 2, 1, 2,
-	1, 4, 5, 1, 5, 2, 6, 1, 4, 3, 4, 5, 1, 5, 1, 5, 6, 2, 6, 4,
-	2, 1, 4, 5, 1, 4, 5, 3, 4, 6, 4, 5, 6, 0, 3, 4, 3, 2, 6, 1,
-	3, 4, 5, 2, 5, 3, 2, 2, 3, 6, 1, 0, 2, 4, 2, 2, 1, 5, 3, 4,
-	4, 2, 0, 4, 3, 6, 3, 4, 2, 0, 5, 3, 5, 3, 6, 0, 4, 1, 0, 2,
-	5, 3, 5, 1, 2, 3, 2, 3, 6, 5, 2, 3, 0, 5, 3, 0, 4, 1, 2, 1,
-	6, 5, 2, 0, 5, 1, 1, 2, 4, 0, 6, 0, 5, 1, 0, 1, 0, 6, 1, 5,
-	0, 4, 1, 5, 3, 6, 2, 0, 1, 0, 6, 2, 4, 2, 6, 4, 1, 2, 5, 4,
-	1, 0, 6, 2, 0, 6, 1, 6, 5, 3, 4, 1, 5, 4, 2, 1, 3, 1, 4, 4,
-	2, 5, 2, 4, 5, 1, 3, 1, 1, 3, 5, 6, 1, 0, 3, 5, 3, 4, 1, 6,
-	3, 0, 2, 5, 2, 1, 2, 6, 3, 4, 3, 4, 3, 6, 2, 0, 4, 0, 6, 2,
-	4, 1, 5, 5, 2, 0, 6, 3, 0, 1, 4, 3, 2, 4, 5, 3, 4, 3, 4, 0,
-	5, 2, 1, 0, 4, 5, 2, 3, 4, 3, 6, 2, 4, 0, 6, 5, 0, 2, 3, 6,
-	6, 2, 5, 2, 3, 4, 2, 3, 6, 2, 0, 4, 5, 3, 0, 2, 4, 3, 5, 4,
-	0, 6, 2, 1, 4, 2, 0, 1, 2, 6, 4, 1, 5, 2, 1, 1, 0, 4, 6, 6,
-	1, 6, 3, 5, 3, 4, 6, 2, 6, 1, 5, 4, 1, 2, 4, 5, 2, 5, 0, 1,
-	2, 3, 4, 1, 3, 3, 2, 6, 1, 4, 2, 3, 4, 2, 4, 1, 3, 4, 2, 1,
-	3, 0, 5, 4, 3, 1, 1, 4, 2, 0, 3, 3, 3, 2, 5, 0, 6, 6, 0, 6,
-	4, 0, 2, 1, 4, 1, 0, 1, 2, 4, 2, 3, 0, 1, 3, 4, 5, 4, 6, 5,
-	5, 0, 3, 5, 1, 3, 0, 2, 5, 3, 4, 2, 0, 1, 3, 4, 3, 4, 5, 4,
-	6, 3, 1, 2, 4, 3, 2, 1, 0, 5, 4, 0, 1, 3, 5, 4, 2, 0, 2, 3,
-	0, 4, 0, 1, 5, 2, 1, 6, 2, 4, 1, 0, 1, 1, 6, 1, 0, 1, 2, 2,
-	1, 2, 2, 6, 2, 0, 4, 1, 6, 2, 4, 2, 1, 3, 5, 4, 2, 0, 1, 5,
-	2, 6, 5, 3, 6, 4, 3, 1, 4, 2, 6, 3, 0, 3, 2, 1, 5, 2, 1, 3,
-	3, 1, 5, 1, 4, 6, 3, 0, 4, 0, 6, 2, 1, 6, 4, 1, 0, 1, 5, 1,
-	4, 2, 3, 4, 0, 0, 2, 0, 6, 1, 1, 1, 3, 4, 1, 2, 0, 5, 0, 6,
-	5, 2, 2, 4, 1, 4, 0, 3, 3, 3, 6, 5, 3, 0, 1, 0, 0, 3, 3, 3,
-	6, 2, 4, 6, 1, 4, 3, 2, 3, 5, 6, 0, 3, 6, 1, 1, 2, 3, 6, 4,
-	0, 4, 5, 2, 5, 6, 3, 1, 2, 6, 0, 3, 0, 1, 1, 3, 0, 6, 1, 0,
-	1, 6, 5, 6, 0, 1, 3, 1, 6, 3, 6, 0, 5, 6, 4, 2, 4, 6, 1, 0,
-	2, 3, 2, 0, 4, 5, 2, 4, 1, 5, 3, 1, 0, 5, 3, 4, 1, 0, 4, 5,
-	3, 1, 0, 2, 0, 1, 0, 5, 1, 5, 2, 3, 4, 1, 6, 3, 2, 6, 4, 1,
-	4, 6, 3, 1, 0, 4, 2, 6, 2, 1, 2, 4, 4, 6, 2, 6, 5, 1, 5, 4,
-	5, 4, 5, 6, 5, 1, 3, 6, 5, 4, 0, 5, 6, 0, 6, 5, 4, 0, 1, 3,
-	6, 2, 5, 3, 3, 4, 0, 5, 3, 3, 0, 2, 1, 6, 4, 1, 5, 2, 6, 0,
-	0, 3, 5, 1, 0, 2, 0, 3, 0, 2, 0, 2, 6, 3, 6, 4, 3, 3, 5, 4,
-	1, 0, 6, 3, 2, 6, 0, 0, 4, 5, 6, 1, 2, 6, 1, 1, 5, 1, 2, 4,
-	2, 5, 4, 3, 2, 6, 5, 6, 5, 3, 4, 5, 0, 6, 4, 4, 0, 4, 3, 5,
-	3, 0, 3, 0, 0, 1, 4, 0, 2, 3, 6, 6, 3, 6, 2, 0, 2, 3, 1, 2,
-	4, 1, 5, 3, 4, 1, 4, 2, 3, 2, 5, 2, 6, 2, 0, 5, 2, 2, 0, 5,
-	5, 0, 1, 5, 6, 5, 2, 6, 1, 2, 1, 5, 3, 4, 2, 0, 3, 0, 4, 1,
-	6, 1, 2, 3, 1, 4, 0, 1, 2, 1, 6, 0, 5, 1, 3, 4, 2, 5, 0, 1,
-	0, 6, 5, 0, 1, 3, 4, 5, 6, 1, 6, 3, 0, 2, 5, 0, 6, 5, 4, 4,
-	1, 5, 2, 5, 1, 2, 4, 2, 4, 6, 5, 0, 5, 1, 4, 5, 3, 1, 1, 0,
-	2, 5, 3, 0, 0, 6, 0, 6, 3, 6, 3, 0, 0, 4, 1, 3, 6, 4, 3, 5,
-	3, 4, 6, 2, 5, 1, 3, 5, 3, 4, 6, 3, 6, 5, 1, 0, 6, 3, 6, 3,
-	4, 1, 1, 6, 2, 4, 2, 0, 0, 1, 0, 1, 0, 4, 6, 3, 1, 0, 5, 3,
-	5, 2, 5, 6, 1, 2, 0, 1, 0, 4, 2, 4, 4, 0, 3, 5, 6, 4, 1, 0,
-	6, 2, 2, 0, 6, 5, 4, 3, 6, 0, 3, 2, 6, 2, 2, 6, 1, 4, 2, 5,
-	0, 3, 4, 6, 1, 3, 5, 3, 4, 4, 6, 5, 3, 6, 3, 6, 2, 5, 4, 6,
-	1, 4, 2, 1, 4, 6, 0, 1, 3, 0, 2, 3, 4, 3, 4, 6, 1, 6, 3, 1,
-	2, 3, 1, 3, 1, 6, 5, 4, 1, 2, 4, 6, 2, 4, 2, 3, 2, 0, 4, 1,
-	3, 2, 5, 1, 2, 0, 6, 3, 1, 5, 2, 6, 1, 6, 1, 4, 0, 5, 2, 1,
-	4, 6, 4, 2, 3, 6, 3, 0, 4, 0, 3, 1, 3, 4, 3, 4, 1, 5, 4, 1,
-	5, 4, 1, 4, 6, 5, 1, 3, 3, 4, 0, 2, 0, 6, 2, 1, 0, 6, 2, 0,
-	6, 1, 3, 1, 0, 3, 0, 4, 2, 0, 3, 1, 6, 0, 3, 6, 5, 1, 6, 1,
-	0, 5, 0, 1, 2, 0, 5, 3, 4, 3, 6, 3, 1, 5, 4, 6, 5, 4, 0, 4,
-	1, 0, 6, 3, 2, 3, 0, 6, 0, 0, 2, 1, 1, 0, 4, 3, 0, 6, 4, 3,
-	2, 0, 1, 4, 0, 4, 0, 3, 1, 4, 0, 4, 1, 3, 2, 1, 5, 3, 6, 2,
-	3, 5, 1, 0, 2, 1, 5, 4, 2, 4, 2, 3, 0, 5, 3, 0, 5, 0, 6, 0,
-	4, 6, 3, 1, 2, 5, 6, 3, 3, 1, 6, 1, 5, 3, 2, 3, 5, 5, 6, 5,
-	5, 1, 6, 4, 5, 0, 1, 4, 2, 1, 2, 1, 0, 6, 3, 2, 0, 6, 1, 6,
-	6, 2, 1, 4, 1, 2, 1, 2, 6, 3, 6, 4, 2, 0, 1, 5, 0, 4, 1, 0,
-	0, 3, 3, 1, 4, 0, 1, 4, 1, 6, 3, 6, 4, 1, 2, 1, 2, 3, 5, 1,
-	1, 4, 5, 0, 1, 0, 6, 3, 2, 4, 0, 5, 2, 0, 2, 6, 2, 0, 3, 5,
-	2, 4, 5, 6, 0, 1, 3, 0, 2, 5, 2, 2, 1, 0, 3, 2, 6, 0, 5, 4,
-	3, 2, 5, 6, 4, 5, 1, 1, 2, 6, 4, 1, 1, 3, 2, 5, 6, 1, 3, 1,
-	4, 6, 2, 6, 1, 3, 6, 5, 0, 1, 2, 1, 2, 1, 6, 2, 1, 6, 3, 2,
-	5, 6, 5, 2, 4, 1, 4, 1, 0, 2, 0, 5, 4, 6, 4, 5, 2, 5, 4, 2,
-	6, 0, 1, 0, 6, 4, 2, 4, 6, 1, 4, 6, 2, 5, 3, 6, 2, 0, 2, 1,
-	0, 3, 4, 3, 0, 6, 0, 3, 2, 6, 3, 2, 3, 2, 0, 5, 3, 1, 1, 5,
-	1, 5, 0, 5, 4, 1, 2, 3, 5, 1, 2, 6, 2, 1, 2, 5, 2, 5, 0, 4,
-	2, 6, 6, 3, 1, 2, 2, 0, 0, 2, 6, 3, 0, 2, 2, 4, 2, 3, 1, 5,
-	3, 4, 0, 5, 0, 3, 0, 2, 6, 0, 4, 1, 0, 6, 5, 2, 1, 6, 5, 6,
-	4, 0, 2, 0, 2, 6, 4, 1, 4, 3, 2, 5, 4, 0, 5, 1, 2, 4, 6, 0,
-	5, 4, 4, 5, 4, 3, 1, 0, 2, 6, 2, 0, 1, 3, 5, 5, 6, 3, 0, 1,
-	6, 1, 6, 0, 2, 3, 4, 3, 5, 3, 5, 1, 6, 2, 0, 3, 2, 1, 2, 4,
-	0, 6, 5, 2, 0, 6, 6, 4, 0, 4, 1, 1, 3, 4, 2, 4, 1, 5, 2, 5,
-	1, 6, 3, 2, 6, 2, 4, 0, 4, 5, 6, 3, 6, 3, 6, 2, 3, 6, 3, 2,
-	2, 2, 0, 3, 6, 5, 3, 5, 1, 4, 3, 3, 5, 3, 6, 2, 5, 4, 6, 5,
-	3, 4, 1, 5, 1, 2, 6, 5, 0, 4, 0, 2, 1, 0, 3, 0, 6, 2, 2, 0,
-	4, 6, 1, 5, 1, 6, 2, 6, 2, 1, 3, 3, 0, 4, 1, 2, 5, 2, 5, 6,
-	5, 0, 2, 6, 3, 4, 5, 4, 3, 3, 2, 1, 2, 3, 5, 1, 5, 6, 0, 1,
-	6, 4, 3, 4, 6, 5, 2, 0, 6, 4, 3, 2, 0, 6, 4, 0, 1, 3, 1, 4,
-	0, 4, 5, 1, 4, 0, 6, 1, 6, 5, 4, 6, 5, 2, 1, 4, 3, 2, 6, 2,
-	1, 6, 5, 6, 3, 4, 5, 1, 6, 4, 6, 1, 5, 6, 1, 5, 6, 2, 3, 2,
-	2, 4, 2, 0, 6, 3, 4, 5, 1, 5, 2, 6, 0, 4, 2, 5, 4, 2, 1, 6,
-	3, 0, 6, 4, 0, 4, 5, 6, 0, 3, 5, 3, 4, 5, 1, 6, 3, 0, 3, 4,
-	4, 0, 2, 1, 6, 1, 6, 3, 0, 6, 3, 0, 4, 4, 3, 0, 4, 1, 2, 0,
-	5, 6, 5, 1, 3, 5, 4, 5, 1, 5, 4, 1, 0, 2, 4, 3, 1, 3, 2, 5,
-	6, 2, 5, 2, 0, 3, 0, 6, 4, 6, 5, 1, 3, 5, 2, 5, 2, 3, 1, 4,
-	0, 3, 2, 5, 4, 2, 6, 0, 6, 0, 5, 1, 6, 3, 1, 2, 3, 4, 1, 6,
-	1, 0, 3, 2, 4, 2, 5, 4, 2, 4, 6, 4, 5, 1, 5, 3, 2, 0, 6, 1,
-	2, 4, 2, 0, 4, 3, 0, 5, 4, 1, 5, 4, 1, 4, 6, 1, 0, 2, 5, 6,
-	3, 5, 5, 0, 0, 6, 1, 2, 4, 2, 4, 0, 6, 4, 5, 0, 6, 2, 0, 2,
-	4, 5, 1, 6, 5, 2, 6, 5, 2, 3, 5, 2, 4, 2, 4, 3, 2, 0, 6, 2,
-	5, 2, 1, 2, 0, 1, 3, 2, 1, 1, 6, 5, 0, 6, 4, 2, 6, 5, 1, 5,
-	6, 0, 4, 3, 2, 0, 5, 3, 2, 6, 0, 6, 3, 1, 4, 4, 5, 6, 5, 3,
-	0, 0, 1, 4, 6, 0, 4, 2, 5, 2, 0, 2, 5, 4, 3, 0, 5, 3, 1, 4,
-	1, 1, 3, 1, 0, 0, 3, 5, 0, 3, 4, 0, 4, 3, 5, 2, 5, 1, 4, 6,
-	2, 4, 2, 5, 0, 1, 5, 5, 0, 1, 2, 4, 3, 2, 4, 6, 6, 4, 2, 6,
-	3, 2, 4, 2, 0, 3, 0, 0, 1, 0, 2, 6, 1, 4, 2, 4, 0, 1, 4, 5,
-	4, 2, 1, 4, 5, 1, 2, 5, 6, 1, 1, 6, 2, 4, 3, 0, 3, 2, 6, 1,
-	5, 0, 4, 5, 4, 2, 0, 3, 4, 2, 0, 2, 1, 4, 2, 3, 5, 0, 4, 3,
-	6, 4, 0, 6, 2, 6, 4, 5, 6, 5, 0, 0, 5, 0, 3, 6, 3, 0, 1, 1,
-	0, 0, 2, 0, 5, 6, 2, 5, 4, 5, 0, 3, 6, 1, 5, 2, 6, 4, 1, 4,
-	1, 5, 3, 0, 5, 1, 3, 0, 3, 4, 0, 6, 1, 3, 5, 2, 5, 5, 0, 6,
-	2, 1, 1, 2, 1, 3, 5, 3, 2, 3, 6, 1, 6, 2, 6, 3, 2, 1, 6, 0,
-	3, 0, 2, 4, 4, 2, 1, 4, 3, 0, 1, 0, 6, 3, 5, 3, 1, 3, 5, 2,
-	4, 2, 2, 1, 3, 2, 1, 4, 2, 0, 2, 6, 2, 0, 2, 3, 1, 2, 0, 5,
-	5, 2, 1, 2, 5, 0, 3, 4, 0, 1, 2, 4, 3, 5, 4, 6, 2, 4, 6, 4,
-	6, 4, 6, 5, 4, 2, 0, 4, 1, 0, 2, 4, 1, 3, 4, 6, 5, 1, 1, 4,
-	0, 2, 4, 3, 5, 2, 6, 4, 3, 1, 6, 2, 4, 1, 1, 2, 0, 5, 1, 2,
-	1, 4, 6, 5, 2, 3, 6, 3, 0, 4, 6, 4, 3, 4, 1, 4, 0, 4, 0, 1,
-	2, 4, 6, 5, 2, 5, 4, 2, 3, 5, 1, 0, 2, 0, 6, 1, 3, 3, 5, 1,
-	3, 2, 5, 0, 1, 4, 3, 1, 3, 1, 6, 4, 2, 1, 2, 3, 0, 6, 0, 1,
-	4, 1, 3, 2, 3, 6, 2, 4, 2, 4, 3, 4, 1, 5, 3, 2, 3, 0, 4, 5,
-	5, 2, 4, 5, 2, 5, 3, 0, 0, 2, 1, 2, 5, 6, 5, 4, 3, 6, 5, 0,
-	6, 5, 6, 1, 5, 1, 0, 3, 4, 2, 3, 4, 6, 2, 6, 0, 5, 6, 2, 4,
-	0, 5, 0, 5, 1, 0, 6, 3, 1, 2, 5, 1, 2, 6, 1, 5, 3, 0, 3, 5,
-	1, 5, 4, 4, 0, 1, 3, 5, 4, 2, 0, 2, 3, 4, 5, 5, 3, 0, 1, 4,
-	2, 1, 6, 3, 4, 5, 2, 3, 6, 4, 3, 5, 2, 0, 2, 4, 3, 4, 3, 5,
-	3, 1, 3, 1, 2, 3, 5, 6, 3, 4, 2, 5, 3, 5, 3, 4, 3, 5, 3, 3,
-	4, 0, 2, 0, 3, 3, 5, 4, 5, 6, 2, 3, 3, 2, 3, 6, 3, 1, 5, 2,
-	5, 1, 0, 1, 0, 6, 0, 3, 5, 3, 0, 6, 2, 1, 1, 6, 2, 5, 6, 5,
-	6, 1, 0, 5, 6, 2, 3, 2, 0, 5, 4, 4, 3, 4, 3, 0, 6, 5, 4, 5,
-	0, 1, 6, 0, 4, 2, 6, 2, 0, 2, 6, 2, 4, 5, 1, 4, 0, 3, 1, 0,
-	1, 5, 4, 3, 4, 1, 6, 5, 4, 0, 2, 0, 2, 3, 4, 6, 1, 4, 6, 5,
-	2, 1, 3, 5, 2, 0, 6, 4, 0, 3, 1, 6, 1, 0, 3, 0, 1, 1, 6, 2,
-	3, 2, 0, 5, 1, 3, 6, 2, 4, 3, 4, 3, 1, 4, 2, 6, 0, 4, 1, 0,
-	4, 6, 1, 2, 0, 3, 0, 3, 1, 5, 4, 0, 6, 5, 6, 3, 0, 5, 1, 6,
-	5, 4, 2, 0, 2, 6, 5, 3, 4, 3, 0, 3, 0, 4, 3, 5, 0, 4, 2, 1,
-	6, 1, 4, 3, 1, 0, 5, 6, 1, 3, 5, 6, 5, 4, 5, 0, 2, 6, 3, 5,
-	0, 5, 2, 6, 6, 0, 4, 5, 2, 3, 3, 1, 2, 5, 3, 6, 5, 3, 1, 6,
-	1, 2, 0, 3, 5, 4, 1, 2, 1, 2, 5, 4, 0, 2, 3, 6, 3, 0, 6, 1,
-	2, 3, 6, 4, 5, 6, 4, 5, 3, 1, 4, 1, 0, 1, 2, 3, 4, 2, 3, 1,
-	3, 6, 0, 1, 5, 6, 3, 5, 6, 0, 5, 1, 5, 4, 5, 6, 5, 2, 0, 5,
-	4, 0, 6, 0, 5, 2, 0, 0, 4, 3, 6, 5, 3, 0, 6, 1, 3, 5, 1, 5,
-	5, 1, 2, 3, 4, 5, 1, 5, 1, 2, 6, 5, 3, 6, 4, 2, 1, 5, 4, 6,
-	6, 0, 2, 3, 5, 0, 6, 2, 5, 2, 4, 5, 0, 4, 5, 1, 6, 0, 1, 4,
-	0, 6, 3, 2, 1, 3, 2, 3, 4, 3, 6, 2, 6, 5, 2, 3, 0, 5, 3, 2,
-	1, 4, 2, 0, 1, 0, 5, 3, 6, 5, 1, 5, 4, 5, 2, 0, 2, 1, 1, 6,
-	2, 4, 4, 0, 4, 4, 1, 4, 3, 6, 3, 4, 5, 4, 1, 5, 5, 4, 5, 1,
-	3, 1, 0, 0, 1, 3, 6, 5, 2, 5, 3, 6, 2, 3, 0, 5, 0, 6, 5, 1,
-	4, 5, 3, 5, 2, 2, 0, 6, 2, 3, 5, 1, 4, 3, 3, 1, 5, 1, 2, 1,
-	5, 4, 2, 1, 5, 5, 6, 1, 2, 5, 6, 4, 3, 2, 4, 6, 5, 3, 4, 6,
-	6, 1, 6, 2, 0, 3, 5, 2, 1, 2, 4, 0, 2, 6, 0, 2, 6, 2, 1, 6,
-	0, 5, 1, 6, 3, 2, 1, 5, 2, 1, 5, 3, 0, 2, 0, 1, 1, 2, 0, 2,
-	1, 3, 2, 6, 5, 2, 5, 6, 5, 2, 4, 1, 6, 0, 3, 4, 0, 6, 5, 4,
-	2, 2, 0, 6, 5, 2, 6, 4, 5, 6, 1, 0, 1, 1, 0, 5, 1, 1, 0, 6,
-	3, 2, 6, 4, 1, 0, 4, 0, 3, 6, 0, 5, 3, 5, 6, 2, 3, 1, 4, 0,
-	4, 5, 5, 1, 1, 2, 3, 2, 1, 4, 3, 1, 6, 2, 3, 4, 3, 3, 1, 1,
-	5, 1, 1, 2, 6, 4, 1, 1, 3, 2, 5, 3, 3, 4, 4, 5, 6, 1, 4, 6,
-	6, 4, 5, 1, 0, 6, 0, 0, 5, 0, 4, 1, 3, 6, 0, 4, 6, 6, 2, 0,
-	0, 5, 2, 0, 5, 2, 1, 6, 1, 3, 4, 2, 5, 0, 6, 1, 3, 1, 0, 4,
-	1, 5, 3, 0, 2, 6, 2, 4, 6, 3, 6, 6, 4, 0, 1, 6, 0, 4, 3, 0,
-	2, 5, 1, 3, 0, 4, 2, 0, 4, 5, 2, 3, 6, 2, 3, 6, 1, 5, 1, 6,
-	3, 5, 1, 6, 3, 1, 2, 6, 0, 5, 4, 2, 4, 6, 2, 4, 6, 4, 2, 4,
-	4, 0, 6, 0, 2, 6, 2, 1, 2, 0, 5, 6, 0, 5, 5, 3, 2, 4, 4, 3,
-	5, 1, 5, 3, 0, 2, 1, 6, 1, 3, 5, 3, 6, 0, 3, 4, 3, 2, 5, 2,
-	6, 1, 6, 2, 1, 6, 5, 0, 4, 6, 0, 6, 2, 1, 2, 6, 5, 2, 6, 1,
-	0, 6, 4, 2, 1, 0, 2, 4, 1, 0, 6, 1, 0, 1, 2, 4, 2, 1, 5, 3,
-	1, 3, 1, 0, 1, 5, 3, 5, 3, 2, 6, 4, 1, 4, 0, 5, 0, 4, 6, 4,
-	2, 6, 4, 3, 5, 0, 5, 4, 2, 6, 5, 3, 1, 2, 0, 3, 5, 6, 1, 0,
-	3, 6, 6, 5, 6, 6, 3, 5, 0, 3, 2, 4, 2, 6, 4, 5, 2, 3, 2, 4,
-	4, 0, 6, 3, 5, 6, 3, 2, 1, 0, 6, 4, 4, 3, 4, 0, 1, 3, 5, 0,
-	5, 0, 1, 4, 1, 6, 4, 0, 5, 1, 4, 2, 1, 2, 1, 3, 6, 1, 5, 2,
-	6, 4, 3, 0, 2, 6, 4, 3, 2, 1, 3, 1, 2, 3, 4, 3, 3, 3, 6, 2,
-	0, 4, 6, 2, 5, 6, 3, 0, 6, 1, 5, 0, 2, 0, 1, 4, 2, 3, 4, 3,
-	1, 6, 2, 3, 1, 3, 0, 5, 2, 1, 3, 0, 6, 5, 0, 3, 2, 5, 5, 3,
-	2, 1, 4, 0, 3, 1, 5, 2, 1, 4, 0, 2, 1, 1, 0, 2, 6, 6, 3, 5,
-	3, 3, 1, 5, 6, 3, 4, 2, 5, 0, 0, 2, 0, 1, 2, 3, 4, 5, 4, 6,
-	4, 3, 6, 3, 5, 1, 0, 1, 0, 3, 4, 2, 5, 3, 2, 5, 4, 3, 6, 4,
-	5, 5, 3, 2, 0, 1, 2, 0, 6, 3, 6, 1, 6, 4, 6, 2, 4, 5, 6, 2,
-	6, 4, 0, 5, 2, 1, 5, 2, 1, 4, 3, 3, 1, 2, 4, 0, 2, 5, 6, 3,
-	0, 2, 2, 1, 1, 5, 1, 5, 3, 4, 0, 6, 5, 2, 0, 5, 1, 2, 6, 4,
-	1, 3, 2, 5, 6, 2, 4, 6, 4, 2, 3, 0, 6, 3, 1, 3, 4, 3, 2, 5,
-	2, 0, 6, 1, 5, 1, 5, 0, 4, 6, 0, 6, 1, 2, 6, 5, 1, 1, 0, 3,
-	3, 4, 3, 5, 3, 4, 6, 0, 5, 6, 3, 0, 6, 4, 5, 4, 5, 0, 5, 1,
-	4, 2, 2, 3, 0, 2, 5, 2, 1, 1, 2, 4, 5, 1, 5, 6, 4, 1, 0, 1,
-	5, 0, 2, 5, 6, 4, 2, 3, 6, 5, 0, 1, 1, 6, 2, 1, 4, 0, 3, 4,
-	6, 2, 5, 2, 4, 0, 5, 6, 5, 2, 4, 5, 4, 4, 2, 3, 6, 3, 1, 6,
-	0, 1, 4, 0, 6, 2, 1, 4, 6, 4, 0, 4, 0, 3, 6, 1, 5, 3, 5, 2,
-	1, 0, 2, 4, 2, 5, 0, 1, 5, 3, 4, 4, 2, 3, 5, 4, 1, 5, 4, 4,
-	2, 3, 5, 2, 0, 6, 2, 0, 0, 6, 3, 1, 4, 5, 1, 5, 4, 2, 6, 4,
-	3, 4, 5, 2, 1, 6, 6, 4, 4, 1, 2, 2, 1, 6, 2, 1, 6, 3, 5, 4,
-	4, 4, 3, 4, 0, 5, 2, 3, 3, 2, 5, 2, 2, 4, 0, 5, 2, 3, 3, 6,
-	5, 2, 3, 6, 5, 1, 4, 6, 2, 0, 5, 0, 1, 3, 6, 5, 1, 1, 4, 4,
-	6, 0, 4, 2, 5, 1, 6, 0, 5, 3, 1, 5, 0, 5, 1, 0, 3, 6, 3, 4,
-	0, 2, 5, 1, 0, 2, 3, 4, 6, 4, 5, 1, 2, 4, 3, 2, 5, 2, 4, 0,
-	1, 5, 5, 3, 5, 0, 4, 2, 0, 2, 4, 1, 2, 0, 3, 0, 5, 1, 2, 0,
-	2, 3, 6, 5, 3, 5, 1, 3, 5, 0, 3, 5, 1, 6, 1, 3, 1, 0, 4, 5,
-	3, 1, 6, 3, 0, 0, 3, 4, 5, 0, 4, 2, 4, 5, 6, 6, 5, 0, 5, 2,
-	4, 1, 4, 1, 2, 3, 4, 1, 3, 2, 5, 6, 1, 0, 2, 4, 2, 5, 3, 5,
-	5, 4, 2, 3, 6, 3, 3, 2, 1, 6, 1, 0, 1, 6, 3, 2, 5, 2, 5, 3,
-	6, 0, 4, 6, 1, 5, 0, 3, 4, 6, 4, 2, 0, 2, 4, 6, 1, 0, 6, 3,
-	0, 6, 2, 5, 3, 5, 1, 2, 6, 0, 4, 6, 1, 2, 1, 2, 0, 6, 4, 6,
-	1, 0, 3, 2, 5, 4, 5, 1, 0, 4, 3, 1, 4, 3, 4, 6, 2, 5, 2, 3,
-	2, 1, 4, 6, 4, 5, 4, 2, 4, 6, 2, 1, 4, 1, 6, 1, 4, 2, 4, 3,
-	3, 1, 6, 4, 3, 1, 3, 2, 3, 5, 0, 4, 1, 2, 0, 5, 6, 0, 1, 0,
-	4, 6, 1, 3, 6, 4, 5, 6, 3, 6, 1, 6, 3, 2, 3, 2, 0, 6, 1, 5,
-	5, 6, 0, 1, 5, 3, 6, 2, 2, 5, 2, 0, 4, 2, 3, 5, 4, 5, 0, 3,
-	6, 2, 4, 2, 6, 5, 1, 5, 2, 4, 5, 3, 5, 4, 1, 3, 0, 6, 5, 1,
-	0, 6, 2, 6, 2, 3, 2, 0, 5, 3, 5, 4, 6, 4, 6, 2, 1, 5, 0, 1,
-	1, 0, 1, 0, 3, 5, 3, 1, 6, 3, 3, 6, 1, 5, 2, 0, 6, 4, 3, 4,
-	2, 6, 4, 6, 2, 0, 5, 2, 0, 3, 4, 5, 3, 4, 3, 5, 3, 2, 6, 6,
-	3, 4, 5, 6, 2, 4, 5, 4, 6, 1, 6, 2, 4, 2, 5, 2, 0, 2, 4, 0,
-	4, 6, 0, 6, 1, 0, 5, 6, 2, 5, 1, 3, 2, 4, 0, 3, 6, 1, 0, 1,
-	5, 1, 4, 6, 5, 5, 5, 0, 4, 1, 0, 4, 0, 6, 6, 4, 3, 5, 0, 1,
-	6, 3, 2, 1, 6, 3, 6, 3, 3, 0, 4, 3, 1, 2, 0, 5, 0, 1, 6, 5,
-	0, 3, 1, 0, 6, 1, 4, 1, 3, 2, 5, 4, 3, 0, 3, 4, 5, 0, 2, 4,
-	1, 4, 4, 4, 5, 3, 2, 0, 6, 0, 5, 1, 4, 5, 1, 3, 0, 2, 5, 0,
-	2, 1, 0, 2, 1, 4, 5, 2, 6, 3, 0, 1, 2, 5, 1, 2, 6, 3, 5, 3,
-	3, 3, 2, 0, 6, 3, 4, 6, 0, 4, 1, 6, 4, 1, 0, 5, 4, 5, 2, 0,
-	4, 2, 0, 1, 4, 6, 0, 4, 3, 2, 4, 3, 1, 2, 6, 5, 0, 1, 2, 4,
-	5, 6, 3, 1, 4, 3, 0, 6, 5, 6, 4, 6, 3, 5, 4, 3, 4, 3, 2, 6,
-	6, 4, 0, 5, 1, 2, 1, 6, 4, 5, 3, 2, 1, 3, 5, 4, 3, 1, 3, 1,
-	0, 4, 6, 4, 0, 6, 4, 0, 1, 5, 0, 5, 1, 5, 0, 6, 5, 0, 6, 1,
-	1, 5, 3, 6, 3, 2, 4, 4, 2, 1, 6, 3, 2, 1, 3, 1, 0, 6, 2, 3,
-	2, 3, 0, 4, 6, 4, 5, 4, 4, 6, 5, 4, 2, 3, 5, 6, 4, 0, 6, 4,
-	3, 2, 0, 3, 1, 3, 5, 2, 1, 0, 1, 3, 2, 3, 3, 6, 4, 1, 2, 0,
-	4, 3, 2, 2, 1, 0, 5, 6, 0, 4, 1, 2, 5, 2, 1, 2, 1, 1, 3, 0,
-	5, 4, 2, 1, 4, 1, 4, 2, 1, 5, 1, 6, 0, 2, 0, 5, 0, 1, 3, 2,
-	6, 2, 3, 6, 5, 4, 3, 2, 1, 4, 5, 6, 3, 5, 4, 0, 6, 2, 1, 3,
-	0, 6, 0, 5, 1, 0, 6, 1, 6, 3, 0, 2, 3, 3, 6, 0, 5, 0, 5, 6,
-	1, 3, 6, 0, 3, 1, 0, 5, 2, 5, 1, 4, 2, 3, 6, 3, 1, 6, 1, 6,
-	2, 5, 1, 5, 2, 6, 4, 3, 5, 2, 3, 0, 1, 6, 2, 4, 2, 2, 6, 3,
-	3, 3, 4, 6, 1, 0, 2, 6, 4, 0, 5, 0, 2, 1, 4, 5, 3, 2, 0, 1,
-	4, 4, 6, 5, 2, 1, 5, 5, 3, 2, 1, 5, 6, 5, 0, 5, 0, 3, 4, 0,
-	5, 1, 5, 1, 3, 6, 2, 5, 4, 0, 1, 5, 4, 0, 5, 6, 2, 1, 6, 3,
-	6, 0, 3, 6, 2, 4, 2, 1, 6, 4, 2, 1, 3, 6, 4, 6, 0, 5, 3, 5,
-	0, 3, 2, 5, 2, 6, 0, 4, 2, 4, 5, 3, 3, 4, 0, 3, 5, 3, 6, 5,
-	1, 0, 5, 6, 2, 3, 5, 1, 3, 5, 6, 3, 0, 5, 0, 1, 6, 0, 5, 6,
-	2, 6, 4, 0, 1, 3, 5, 4, 4, 2, 1, 4, 2, 6, 4, 2, 4, 3, 6, 2,
-	3, 2, 5, 5, 3, 1, 2, 6, 6, 3, 2, 3, 4, 0, 3, 0, 6, 3, 6, 0,
-	4, 1, 4, 6, 4, 0, 2, 1, 5, 1, 6, 2, 5, 3, 3, 2, 5, 0, 1, 2,
-	5, 3, 6, 1, 4, 1, 5, 6, 4, 5, 1, 6, 2, 3, 6, 1, 2, 2, 6, 3,
-	6, 4, 1, 2, 3, 5, 2, 1, 5, 1, 6, 5, 4, 0, 5, 6, 0, 6, 4, 5,
-	0, 5, 1, 0, 3, 3, 0, 6, 3, 6, 3, 5, 4, 0, 5, 1, 2, 5, 0, 5,
-	1, 5, 3, 0, 2, 2, 3, 4, 6, 1, 0, 2, 4, 5, 1, 2, 3, 6, 1, 1,
-	2, 1, 4, 0, 5, 0, 1, 5, 4, 3, 1, 2, 3, 6, 5, 1, 6, 4, 5, 2,
-	3, 4, 1, 3, 2, 4, 1, 0, 2, 4, 3, 1, 3, 4, 1, 6, 2, 0, 6, 3,
-	4, 6, 2, 4, 1, 2, 1, 5, 3, 2, 0, 4, 0, 3, 5, 2, 6, 0, 4, 3,
-	5, 6, 4, 3, 2, 1, 2, 6, 3, 0, 1, 0, 2, 0, 1, 4, 0, 0, 4, 1,
-	6, 0, 6, 4, 5, 1, 0, 6, 5, 3, 1, 2, 6, 4, 1, 0, 2, 3, 5, 2,
-	0, 2, 5, 2, 3, 0, 1, 4, 1, 0, 2, 6, 3, 0, 6, 2, 1, 6, 5, 2,
-	1, 4, 2, 1, 3, 5, 3, 5, 2, 1, 0, 5, 6, 1, 4, 2, 3, 0, 5, 4,
-	2, 1, 3, 5, 1, 6, 4, 3, 4, 3, 2, 0, 1, 6, 1, 4, 1, 4, 0, 1,
-	3, 2, 3, 2, 5, 6, 0, 6, 4, 1, 6, 5, 1, 4, 5, 4, 4, 2, 1, 0,
-	4, 0, 6, 5, 0, 6, 3, 4, 6, 6, 5, 3, 3, 3, 3, 3, 2, 5, 0, 6,
-	5, 1, 0, 3, 5, 4, 3, 1, 4, 0, 3, 6, 5, 0, 4, 4, 5, 2, 4, 3,
-	6, 2, 0, 2, 1, 4, 2, 3, 1, 1, 0, 1, 1, 2, 4, 6, 0, 2, 5, 2,
-	0, 6, 2, 4, 0, 6, 1, 4, 0, 6, 5, 3, 0, 4, 3, 5, 1, 5, 0, 3,
-	1, 3, 4, 0, 6, 3, 3, 6, 0, 4, 0, 6, 5, 1, 2, 3, 5, 3, 1, 1,
-	2, 5, 6, 4, 0, 5, 1, 4, 2, 1, 6, 4, 6, 1, 4, 1, 6, 3, 0, 4,
-	3, 4, 3, 0, 3, 4, 6, 2, 6, 0, 4, 2, 1, 2, 2, 3, 1, 6, 3, 2,
-	4, 2, 0, 1, 0, 6, 2, 4, 4, 5, 6, 2, 0, 5, 6, 5, 6, 0, 2, 0,
-	5, 3, 4, 1, 3, 0, 6, 2, 3, 3, 0, 6, 5, 0, 5, 0, 3, 6, 5, 4,
-	6, 2, 6, 0, 3, 0, 0, 6, 4, 5, 4, 1, 6, 6, 2, 6, 0, 5, 6, 3,
-	0, 1, 5, 0, 3, 5, 1, 5, 0, 5, 5, 5, 2, 6, 0, 6, 0, 5, 6, 3,
-	1, 3, 5, 0, 1, 0, 6, 3, 4, 3, 1, 4, 0, 4, 3, 0, 1, 5, 3, 6,
-	2, 1, 2, 3, 6, 2, 6, 3, 1, 2, 0, 4, 4, 5, 1, 6, 3, 3, 2, 5,
-	3, 1, 4, 5, 4, 5, 2, 3, 4, 3, 6, 5, 4, 3, 2, 1, 0, 5, 6, 1,
-	4, 0, 5, 5, 1, 3, 2, 6, 6, 4, 2, 4, 1, 4, 6, 5, 0, 3, 5, 0,
-	5, 5, 1, 1, 4, 6, 4, 2, 4, 6, 5, 2, 4, 5, 4, 6, 1, 4, 0, 4,
-	6, 5, 4, 2, 4, 0, 1, 2, 0, 1, 1, 3, 2, 4, 5, 6, 0, 1, 0, 5,
-	0, 6, 0, 1, 0, 2, 6, 2, 1, 1, 2, 4, 3, 1, 3, 5, 6, 3, 0, 3,
-	1, 2, 3, 5, 0, 2, 1, 0, 2, 3, 6, 0, 3, 5, 1, 5, 4, 0, 6, 3,
-	2, 0, 2, 6, 3, 1, 4, 0, 4, 6, 6, 3, 6, 5, 1, 2, 2, 0, 6, 1,
-	3, 4, 6, 3, 1, 4, 4, 5, 4, 2, 0, 6, 4, 6, 5, 3, 0, 6, 3, 4,
-	4, 0, 3, 0, 1, 3, 2, 4, 5, 3, 4, 0, 4, 3, 0, 6, 1, 2, 4, 2,
-	5, 0, 3, 4, 0, 6, 4, 0, 3, 0, 5, 1, 5, 4, 4, 2, 4, 5, 5, 5,
-	6, 3, 5, 2, 5, 6, 4, 0, 2, 5, 1, 6, 1, 3, 6, 3, 0, 6, 1, 0,
-	0, 3, 3, 1, 6, 4, 3, 0, 1, 3, 1, 0, 5, 4, 0, 3, 4, 1, 2, 3,
-	1, 4, 3, 5, 4, 3, 6, 0, 6, 1, 5, 4, 2, 1, 2, 0, 6, 0, 6, 0,
-	2, 4, 0, 4, 3, 4, 3, 4, 1, 6, 2, 6, 3, 5, 1, 1, 4, 1, 3, 2,
-	3, 2, 3, 4, 2, 3, 6, 1, 1, 0, 4, 6, 1, 3, 4, 2, 0, 5, 3, 1,
-	4, 5, 4, 6, 0, 2, 1, 0, 3, 5, 1, 3, 6, 3, 0, 2, 5, 3, 0, 1,
-	5, 0, 2, 4, 6, 1, 5, 1, 3, 6, 4, 2, 4, 2, 4, 1, 6, 2, 6, 1,
-	6, 0, 3, 3, 1, 4, 5, 1, 5, 6, 2, 6, 3, 2, 6, 2, 4, 5, 0, 3,
-	0, 5, 2, 4, 3, 6, 2, 4, 6, 4, 0, 2, 0, 1, 5, 3, 1, 3, 4, 6,
-	1, 0, 4, 3, 6, 0, 4, 6, 5, 6, 2, 3, 0, 3, 4, 2, 5, 6, 2, 5,
-	2, 3, 1, 0, 5, 6, 2, 4, 5, 6, 6, 2, 4, 3, 2, 5, 0, 5, 4, 0,
-	3, 5, 2, 0, 5, 1, 2, 0, 1, 5, 0, 6, 1, 5, 2, 3, 4, 6, 2, 0,
-	4, 6, 3, 4, 0, 4, 1, 6, 0, 3, 2, 0, 5, 1, 5, 2, 6, 6, 5, 3,
-	5, 1, 2, 0, 1, 6, 0, 6, 4, 1, 5, 2, 1, 3, 3, 0, 5, 4, 6, 1,
-	6, 1, 3, 1, 2, 5, 4, 2, 0, 1, 0, 6, 4, 4, 0, 4, 6, 0, 5, 6,
-	0, 3, 2, 0, 2, 2, 6, 0, 3, 5, 0, 6, 2, 1, 2, 0, 1, 0, 4, 6,
-	1, 3, 4, 3, 6, 2, 6, 4, 1, 2, 3, 2, 6, 1, 0, 3, 0, 0, 6, 5,
-	2, 1, 3, 5, 2, 5, 1, 2, 2, 1, 4, 4, 0, 3, 1, 6, 5, 1, 0, 4,
-	3, 6, 2, 6, 3, 4, 3, 3, 5, 2, 5, 0, 3, 3, 6, 1, 3, 6, 3, 6,
-	4, 1, 0, 6, 5, 1, 2, 5, 4, 6, 2, 6, 6, 3, 3, 4, 0, 6, 3, 3,
-	5, 2, 3, 6, 2, 6, 3, 1, 1, 5, 1, 4, 6, 1, 3, 3, 6, 2, 1, 4,
-	6, 4, 3, 2, 0, 1, 5, 2, 1, 4, 2, 5, 3, 4, 5, 6, 0, 2, 0, 3,
-	0, 6, 1, 2, 6, 5, 6, 5, 6, 4, 6, 4, 0, 6, 1, 2, 0, 2, 2, 3,
-	1, 0, 5, 6, 4, 4, 6, 0, 4, 0, 5, 0, 5, 2, 2, 3, 4, 5, 6, 2,
-	2, 6, 0, 5, 1, 4, 0, 4, 2, 1, 2, 4, 4, 2, 5, 0, 4, 5, 3, 0,
-	3, 1, 0, 6, 5, 3, 3, 1, 0, 3, 0, 5, 1, 2, 5, 1, 4, 3, 3, 1,
-	4, 1, 0, 4, 6, 1, 2, 4, 1, 3, 2, 3, 4, 6, 4, 2, 2, 4, 0, 5,
-	5, 4, 2, 5, 4, 2, 6, 1, 4, 5, 0, 3, 6, 5, 0, 1, 6, 1, 3, 1,
-	6, 5, 0, 5, 0, 4, 6, 1, 2, 5, 4, 2, 4, 6, 5, 2, 3, 4, 2, 4,
-	0, 5, 0, 2, 6, 1, 2, 0, 5, 6, 1, 4, 2, 4, 6, 3, 0, 6, 2, 5,
-	1, 2, 5, 2, 3, 1, 3, 1, 0, 3, 0, 3, 6, 2, 6, 0, 5, 4, 3, 1,
-	2, 6, 1, 5, 4, 5, 0, 2, 6, 2, 0, 5, 1, 5, 2, 0, 6, 1, 4, 2,
-	3, 4, 5, 0, 2, 1, 5, 0, 5, 2, 6, 0, 3, 0, 4, 0, 1, 2, 5, 3,
-	4, 4, 1, 6, 2, 5, 3, 0, 5, 4, 1, 3, 1, 1, 5, 3, 4, 4, 6, 2,
-	5, 3, 2, 5, 2, 1, 3, 0, 6, 2, 3, 2, 3, 0, 4, 6, 2, 3, 4, 1,
-	6, 1, 0, 5, 0, 6, 6, 1, 0, 6, 2, 5, 4, 3, 5, 6, 3, 6, 5, 4,
-	0, 4, 0, 6, 4, 2, 2, 6, 5, 0, 4, 0, 2, 5, 5, 2, 0, 6, 2, 0,
-	1, 5, 1, 4, 2, 6, 3, 6, 3, 6, 4, 5, 1, 5, 4, 3, 0, 5, 2, 0,
-	2, 3, 2, 3, 0, 5, 2, 3, 3, 2, 0, 2, 1, 5, 6, 2, 4, 5, 3, 5,
-	3, 5, 4, 1, 0, 1, 0, 1, 5, 3, 6, 2, 1, 2, 1, 6, 5, 2, 3, 1,
-	4, 6, 0, 6, 1, 3, 2, 1, 2, 3, 4, 5, 1, 1, 1, 4, 1, 4, 2, 3,
-	5, 3, 3, 5, 4, 2, 3, 6, 2, 5, 4, 4, 0, 0, 5, 3, 5, 0, 2, 0,
-	6, 5, 6, 4, 2, 5, 6, 5, 6, 4, 5, 1, 4, 2, 4, 2, 3, 6, 5, 3,
-	0, 6, 3, 2, 1, 5, 1, 2, 4, 5, 1, 6, 5, 6, 3, 1, 5, 0, 1, 2,
-	1, 0, 6, 2, 4, 3, 0, 6, 5, 6, 3, 4, 2, 5, 0, 3, 5, 0, 5, 3,
-	2, 4, 0, 6, 3, 5, 4, 1, 6, 2, 1, 2, 5, 1, 3, 6, 4, 4, 0, 3,
-	3, 0, 5, 3, 3, 4, 2, 6, 0, 5, 1, 2, 1, 6, 4, 3, 6, 1, 0, 5,
-	4, 1, 0, 4, 3, 5, 3, 1, 3, 2, 1, 5, 6, 2, 6, 3, 0, 2, 5, 4,
-	5, 3, 5, 3, 4, 5, 4, 3, 2, 0, 5, 0, 5, 2, 5, 1, 0, 3, 6, 1,
-	6, 3, 0, 6, 4, 3, 1, 3, 4, 1, 5, 4, 2, 5, 1, 0, 1, 5, 3, 2,
-	0, 5, 3, 3, 5, 5, 2, 2, 0, 6, 1, 6, 5, 1, 5, 3, 1, 2, 4, 0,
-	1, 3, 0, 2, 1, 5, 0, 4, 0, 4, 1, 2, 6, 5, 1, 4, 1, 0, 3, 0,
-	2, 0, 5, 6, 1, 4, 5, 2, 6, 1, 5, 1, 2, 5, 1, 0, 4, 6, 3, 2,
-	3, 4, 6, 5, 4, 1, 5, 2, 0, 3, 6, 3, 2, 5, 4, 1, 0, 4, 6, 3,
-	4, 1, 2, 3, 2, 4, 0, 6, 2, 1, 1, 0, 5, 6, 6, 5, 1, 2, 1, 0,
-	5, 3, 1, 0, 3, 2, 4, 1, 5, 6, 0, 6, 3, 0, 3, 3, 6, 3, 0, 2,
-	6, 0, 2, 1, 3, 6, 3, 3, 2, 0, 1, 6, 0, 2, 0, 3, 0, 3, 5, 6,
-	0, 6, 0, 4, 2, 1, 5, 0, 3, 0, 3, 6, 4, 0, 3, 6, 2, 1, 0, 1,
-	1, 3, 5, 0, 6, 0, 2, 4, 2, 5, 6, 0, 5, 6, 5, 4, 5, 2, 3, 4,
-	2, 5, 4, 2, 0, 5, 1, 0, 0, 3, 1, 0, 2, 1, 1, 5, 4, 3, 1, 2,
-	3, 4, 1, 3, 2, 5, 3, 2, 1, 3, 2, 6, 5, 3, 2, 0, 3, 6, 1, 4,
-	4, 1, 0, 1, 0, 3, 4, 0, 6, 2, 2, 3, 6, 3, 4, 5, 0, 1, 4, 0,
-	5, 0, 0, 6, 2, 4, 2, 5, 3, 1, 1, 3, 5, 1, 4, 5, 2, 0, 4, 3,
-	6, 5, 1, 2, 4, 2, 3, 6, 2, 1, 3, 4, 5, 0, 1, 2, 1, 0, 6, 2,
-	0, 6, 4, 3, 0, 3, 3, 4, 0, 5, 0, 6, 2, 5, 4, 0, 1, 0, 4, 0,
-	1, 3, 0, 6, 2, 0, 1, 6, 4, 2, 2, 3, 4, 5, 1, 2, 0, 1, 5, 6,
-	2, 5, 5, 3, 6, 2, 1, 2, 1, 3, 0, 2, 3, 1, 6, 3, 2, 3, 1, 1,
-	3, 4, 0, 4, 2, 1, 4, 5, 6, 4, 5, 2, 6, 4, 5, 0, 3, 5, 6, 4,
-	4, 5, 3, 0, 4, 3, 4, 6, 3, 6, 0, 3, 5, 1, 5, 0, 1, 2, 5, 3,
-	5, 1, 3, 4, 0, 1, 6, 1, 1, 4, 6, 3, 3, 5, 0, 1, 0, 3, 2, 6,
-	6, 5, 4, 1, 6, 3, 5, 3, 4, 5, 1, 2, 0, 5, 0, 3, 4, 5, 3, 2,
-	0, 2, 3, 3, 2, 0, 1, 0, 0, 2, 0, 6, 3, 4, 0, 5, 6, 1, 2, 6,
-	1, 5, 0, 4, 0, 4, 6, 4, 2, 6, 3, 4, 5, 1, 6, 4, 0, 4, 1, 1,
-	2, 6, 2, 4, 2, 0, 6, 5, 3, 0, 6, 3, 4, 5, 0, 4, 6, 0, 5, 2,
-	3, 0, 1, 3, 5, 1, 4, 5, 6, 2, 5, 1, 6, 0, 2, 3, 0, 4, 3, 6,
-	4, 1, 3, 0, 1, 5, 2, 0, 5, 3, 2, 6, 3, 2, 3, 1, 0, 1, 0, 4,
-	5, 6, 3, 5, 5, 0, 5, 6, 0, 6, 0, 5, 3, 0, 4, 5, 3, 2, 4, 0,
-	6, 3, 2, 1, 0, 5, 0, 2, 0, 6, 5, 3, 0, 5, 3, 0, 5, 2, 3, 6,
-	0, 3, 0, 3, 1, 4, 6, 4, 6, 2, 0, 1, 6, 4, 1, 0, 6, 4, 3, 3,
-	1, 0, 2, 6, 3, 0, 4, 1, 6, 2, 5, 0, 3, 6, 2, 1, 6, 2, 6, 4,
-	2, 4, 2, 0, 6, 0, 5, 2, 0, 5, 4, 2, 5, 3, 0, 5, 0, 5, 0, 1,
-	3, 4, 5, 3, 6, 5, 1, 5, 2, 0, 2, 4, 2, 5, 5, 4, 2, 5, 0, 4,
-	4, 3, 5, 4, 2, 6, 5, 2, 1, 4, 2, 0, 2, 0, 1, 5, 3, 1, 0, 5,
-	5, 4, 0, 2, 6, 0, 5, 1, 6, 1, 5, 6, 4, 6, 1, 5, 0, 3, 5, 1,
-	6, 2, 4, 5, 0, 2, 6, 5, 4, 0, 3, 0, 3, 2, 4, 3, 2, 0, 6, 4,
-	0, 6, 2, 1, 6, 2, 1, 5, 0, 0, 3, 0, 5, 4, 6, 3, 2, 0, 4, 1,
-	1, 5, 3, 4, 3, 6, 2, 1, 5, 1, 0, 1, 3, 1, 2, 0, 3, 5, 4, 6,
-	2, 0, 1, 0, 6, 4, 3, 2, 3, 1, 1, 2, 0, 2, 4, 3, 0, 5, 1, 3,
-	3, 1, 5, 1, 5, 3, 1, 5, 2, 0, 5, 4, 6, 3, 5, 5, 4, 2, 6, 2,
-	4, 1, 0, 4, 1, 2, 6, 0, 4, 3, 1, 5, 6, 0, 1, 1, 5, 2, 1, 6,
-	5, 5, 0, 4, 6, 5, 1, 6, 2, 4, 0, 5, 0, 4, 1, 5, 4, 5, 4, 2,
-	6, 3, 4, 2, 0, 4, 6, 0, 2, 0, 6, 0, 6, 0, 6, 5, 2, 2, 0, 1,
-	0, 3, 0, 1, 6, 3, 3, 6, 1, 3, 4, 3, 0, 2, 3, 6, 4, 1, 5, 1,
-	1, 4, 6, 0, 1, 0, 6, 2, 5, 1, 6, 4, 2, 0, 2, 1, 6, 1, 4, 1,
-	2, 4, 6, 1, 5, 1, 1, 0, 3, 0, 3, 1, 2, 6, 3, 5, 4, 2, 5, 3,
-	3, 1, 6, 0, 5, 3, 1, 5, 2, 0, 0, 4, 3, 1, 5, 1, 2, 6, 5, 6,
-	4, 3, 2, 5, 4, 4, 6, 4, 3, 0, 3, 6, 0, 4, 5, 4, 1, 3, 5, 6,
-	5, 1, 0, 1, 1, 1, 0, 1, 5, 3, 0, 6, 2, 1, 3, 4, 1, 2, 0, 6,
-	6, 6, 3, 4, 2, 3, 6, 1, 2, 5, 4, 5, 4, 1, 4, 2, 2, 6, 4, 2,
-	0, 6, 1, 6, 5, 6, 1, 3, 3, 5, 1, 4, 2, 6, 5, 1, 5, 3, 5, 0,
-	1, 3, 6, 4, 2, 4, 6, 3, 4, 2, 5, 6, 2, 1, 1, 5, 2, 0, 3, 2,
-	2, 5, 6, 0, 6, 4, 3, 3, 4, 0, 3, 5, 1, 5, 0, 5, 5, 3, 0, 4,
-	3, 5, 2, 1, 4, 3, 3, 3, 5, 4, 5, 0, 1, 4, 3, 1, 4, 1, 3, 4,
-	4, 6, 0, 4, 0, 2, 3, 5, 4, 5, 2, 4, 5, 6, 5, 5, 2, 4, 6, 1,
-	5, 5, 0, 3, 1, 6, 5, 1, 6, 0, 1, 6, 2, 6, 1, 3, 4, 0, 1, 5,
-	6, 0, 5, 4, 1, 3, 3, 0, 2, 5, 3, 4, 3, 6, 3, 6, 3, 5, 2, 0,
-	0, 0, 6, 0, 5, 6, 2, 4, 5, 1, 5, 1, 1, 5, 1, 0, 5, 6, 0, 6,
-	1, 5, 0, 3, 2, 4, 0, 6, 1, 3, 5, 1, 6, 2, 6, 3, 4, 6, 4, 1,
-	2, 2, 3, 1, 2, 3, 6, 6, 3, 2, 6, 2, 4, 1, 3, 0, 1, 5, 6, 0,
-	3, 1, 4, 0, 6, 0, 6, 0, 1, 6, 3, 1, 4, 5, 1, 1, 0, 4, 6, 0,
-	4, 1, 4, 0, 4, 1, 3, 2, 0, 6, 3, 3, 1, 0, 4, 3, 6, 0, 1, 1,
-	5, 6, 1, 4, 6, 2, 4, 1, 4, 2, 6, 3, 6, 5, 2, 2, 6, 5, 3, 0,
-	6, 5, 6, 4, 3, 6, 1, 6, 2, 4, 6, 6, 3, 2, 5, 0, 5, 4, 5, 1,
-	0, 1, 4, 1, 2, 6, 3, 3, 4, 3, 6, 2, 1, 6, 5, 0, 3, 2, 5, 4,
-	1, 0, 5, 3, 3, 6, 1, 6, 5, 2, 5, 1, 3, 5, 3, 6, 5, 0, 1, 1,
-	2, 5, 1, 0, 1, 0, 3, 4, 5, 3, 5, 5, 6, 2, 3, 5, 0, 5, 2, 5,
-	3, 0, 6, 3, 4, 1, 5, 2, 6, 4, 2, 1, 0, 3, 6, 5, 1, 4, 3, 0,
-	4, 1, 3, 6, 4, 1, 4, 5, 4, 2, 1, 4, 0, 2, 6, 0, 4, 5, 3, 2,
-	5, 2, 4, 4, 3, 6, 5, 1, 0, 2, 4, 0, 4, 1, 6, 2, 4, 5, 0, 1,
-	6, 0, 3, 0, 6, 5, 0, 1, 0, 5, 4, 5, 1, 5, 4, 5, 4, 6, 3, 6,
-	0, 5, 1, 6, 3, 0, 1, 3, 1, 6, 5, 0, 3, 4, 3, 2, 1, 0, 2, 1,
-	1, 4, 4, 6, 0, 0, 1, 4, 0, 5, 3, 3, 3, 6, 5, 1, 3, 2, 5, 2,
-	2, 0, 1, 4, 0, 5, 6, 3, 4, 5, 2, 5, 0, 2, 4, 5, 0, 2, 3, 5,
-	3, 3, 0, 3, 2, 4, 2, 3, 6, 0, 1, 1, 0, 6, 4, 1, 2, 6, 2, 3,
-	4, 5, 1, 6, 4, 0, 1, 3, 4, 3, 1, 4, 1, 6, 4, 2, 4, 2, 1, 3,
-	5, 0, 3, 5, 6, 2, 0, 6, 3, 6, 5, 5, 1, 3, 1, 3, 4, 1, 3, 0,
-	6, 5, 3, 1, 4, 2, 4, 3, 6, 3, 2, 5, 2, 1, 0, 2, 6, 3, 2, 5,
-	0, 6, 2, 5, 0, 6, 0, 5, 0, 5, 0, 6, 2, 6, 6, 4, 1, 0, 6, 0,
-	1, 2, 4, 2, 1, 6, 5, 0, 5, 1, 6, 0, 1, 1, 3, 6, 2, 4, 5, 1,
-	2, 5, 6, 2, 0, 3, 0, 5, 0, 6, 3, 2, 3, 0, 5, 4, 2, 4, 2, 4,
-	3, 2, 5, 6, 2, 0, 3, 4, 6, 1, 2, 4, 1, 4, 3, 2, 6, 2, 1, 1,
-	4, 4, 0, 2, 3, 4, 6, 0, 3, 2, 3, 4, 3, 1, 0, 0, 5, 2, 1, 6,
-	5, 2, 3, 4, 0, 2, 1, 3, 0, 1, 5, 2, 3, 6, 2, 1, 2, 6, 4, 5,
-	6, 3, 5, 0, 2, 1, 4, 0, 3, 2, 6, 5, 0, 2, 1, 4, 3, 1, 1, 3,
-	0, 2, 0, 3, 6, 4, 6, 2, 3, 5, 0, 3, 6, 1, 0, 1, 2, 3, 6, 2,
-	1, 5, 1, 4, 3, 4, 0, 4, 0, 4, 0, 2, 4, 0, 5, 3, 3, 1, 5, 6,
-	2, 0, 2, 1, 1, 0, 3, 2, 1, 0, 1, 4, 3, 0, 1, 6, 0, 6, 3, 2,
-	3, 4, 1, 5, 0, 4, 1, 4, 6, 3, 0, 2, 1, 2, 5, 6, 0, 1, 2, 6,
-	4, 6, 4, 6, 4, 5, 0, 2, 3, 0, 4, 0, 3, 0, 1, 3, 4, 3, 0, 5,
-	5, 1, 0, 1, 4, 1, 3, 4, 0, 4, 3, 0, 6, 5, 2, 3, 4, 1, 5, 3,
-	6, 1, 0, 2, 1, 4, 2, 5, 3, 4, 2, 6, 3, 1, 4, 3, 4, 5, 5, 4,
-	0, 5, 6, 1, 6, 2, 6, 6, 3, 2, 4, 6, 3, 3, 6, 3, 4, 0, 1, 6,
-	1, 3, 6, 2, 5, 4, 1, 2, 1, 6, 1, 5, 6, 3, 2, 3, 2, 0, 1, 0,
-	2, 3, 5, 0, 6, 4, 3, 2, 5, 0, 2, 4, 1, 4, 0, 1, 4, 3, 1, 6,
-	3, 6, 6, 1, 2, 3, 0, 4, 0, 1, 3, 2, 1, 0, 2, 0, 2, 5, 6, 1,
-	4, 0, 6, 0, 3, 1, 2, 5, 2, 5, 0, 1, 4, 1, 6, 0, 2, 4, 4, 2,
-	5, 3, 0, 5, 1, 2, 5, 0, 6, 5, 0, 1, 6, 2, 6, 3, 1, 0, 3, 5,
-	6, 3, 4, 2, 4, 0, 5, 5, 1, 2, 6, 2, 5, 4, 3, 4, 5, 3, 5, 0,
-	0, 3, 5, 2, 0, 3, 5, 1, 6, 3, 2, 4, 5, 2, 6, 1, 1, 6, 1, 3,
-	1, 6, 4, 5, 1, 4, 1, 0, 2, 0, 1, 4, 0, 6, 1, 5, 4, 5, 5, 4,
-	2, 6, 4, 5, 5, 3, 0, 2, 5, 0, 1, 4, 5, 0, 0, 1, 0, 2, 1, 6,
-	3, 6, 2, 4, 5, 3, 3, 2, 0, 6, 1, 4, 2, 4, 0, 4, 3, 5, 1, 3,
-	4, 5, 3, 0, 6, 4, 5, 6, 4, 4, 5, 2, 4, 2, 3, 0, 3, 6, 2, 3,
-	5, 2, 5, 0, 5, 3, 6, 5, 4, 1, 3, 0, 1, 3, 3, 6, 2, 1, 0, 2,
-	6, 3, 2, 2, 3, 0, 5, 4, 1, 2, 4, 3, 0, 2, 5, 3, 0, 2, 1, 4,
-	0, 0, 6, 4, 1, 3, 3, 0, 3, 0, 3, 6, 5, 6, 5, 1, 0, 1, 0, 2,
-	1, 0, 1, 2, 0, 4, 1, 6, 1, 3, 1, 6, 5, 4, 6, 0, 1, 3, 6, 5,
-	2, 6, 0, 3, 6, 4, 2, 5, 4, 3, 4, 6, 4, 2, 6, 3, 3, 6, 0, 1,
-	3, 5, 1, 5, 3, 4, 3, 6, 5, 2, 5, 2, 5, 2, 6, 0, 3, 6, 1, 3,
-	4, 0, 4, 1, 0, 3, 4, 5, 6, 3, 5, 6, 2, 0, 4, 0, 6, 2, 1, 2,
-	5, 2, 0, 2, 4, 0, 6, 3, 1, 2, 4, 2, 1, 1, 0, 3, 1, 3, 2, 1,
-	6, 2, 0, 5, 6, 3, 2, 3, 0, 5, 0, 5, 0, 6, 5, 2, 1, 1, 6, 2,
-	0, 3, 2, 1, 5, 2, 3, 5, 2, 1, 1, 3, 1, 6, 4, 0, 4, 2, 5, 3,
-	1, 3, 5, 4, 1, 5, 6, 0, 1, 5, 0, 6, 5, 3, 2, 1, 5, 0, 3, 5,
-	2, 5, 0, 6, 2, 6, 2, 4, 5, 3, 1, 3, 4, 6, 5, 0, 6, 2, 1, 3,
-	3, 1, 5, 3, 4, 3, 1, 5, 0, 6, 0, 3, 2, 4, 3, 5, 1, 2, 3, 4,
-	4, 4, 1, 3, 2, 0, 5, 1, 4, 5, 1, 5, 2, 5, 4, 0, 5, 2, 5, 1,
-	5, 4, 1, 6, 1, 2, 5, 5, 1, 3, 5, 0, 1, 0, 6, 0, 5, 6, 3, 2,
-	6, 2, 4, 3, 2, 4, 4, 1, 5, 4, 6, 2, 0, 2, 6, 1, 5, 4, 6, 0,
-	0, 5, 4, 0, 4, 1, 3, 5, 1, 3, 6, 1, 6, 4, 6, 2, 0, 3, 4, 5,
-	1, 0, 6, 6, 0, 6, 0, 4, 5, 1, 3, 3, 5, 2, 1, 6, 5, 1, 0, 6,
-	2, 5, 1, 2, 1, 6, 3, 5, 2, 5, 6, 2, 1, 6, 0, 1, 2, 4, 5, 3,
-	3, 2, 6, 0, 4, 0, 4, 5, 0, 2, 4, 2, 4, 5, 0, 6, 0, 2, 3, 0,
-	4, 2, 2, 0, 2, 6, 4, 0, 1, 0, 6, 4, 1, 4, 0, 3, 2, 0, 1, 5,
-	5, 1, 6, 3, 1, 5, 2, 4, 0, 6, 3, 0, 1, 0, 5, 2, 1, 6, 0, 0,
-	6, 2, 1, 2, 5, 1, 5, 4, 4, 3, 5, 1, 5, 2, 6, 4, 4, 0, 6, 5,
-	0, 1, 4, 6, 0, 6, 2, 3, 5, 6, 4, 1, 3, 0, 5, 3, 1, 6, 4, 6,
-	1, 2, 1, 1, 4, 4, 3, 2, 0, 6, 3, 0, 5, 2, 6, 3, 3, 5, 0, 5,
-	2, 0, 1, 6, 2, 0, 6, 0, 2, 0, 3, 5, 4, 6, 0, 2, 4, 6, 5, 2,
-	3, 5, 6, 2, 0, 6, 2, 4, 1, 5, 1, 1, 5, 1, 1, 0, 2, 2, 4, 1,
-	4, 2, 0, 4, 6, 0, 6, 3, 2, 6, 2, 3, 1, 3, 6, 4, 1, 2, 5, 0,
-	5, 2, 3, 6, 3, 6, 5, 1, 0, 6, 5, 1, 0, 2, 1, 4, 4, 1, 6, 2,
-	6, 3, 5, 5, 3, 6, 3, 2, 5, 6, 1, 3, 3, 6, 1, 6, 4, 5, 6, 0,
-	0, 5, 3, 4, 0, 2, 6, 5, 0, 6, 4, 2, 1, 4, 2, 0, 2, 0, 5, 1,
-	1, 3, 5, 6, 0, 3, 5, 0, 3, 5, 4, 5, 1, 2, 0, 3, 2, 3, 1, 6,
-	2, 5, 6, 1, 5, 2, 6, 4, 2, 3, 2, 1, 6, 0, 1, 5, 6, 0, 6, 1,
-	3, 0, 2, 3, 5, 4, 3, 2, 4, 0, 4, 5, 2, 0, 6, 1, 6, 5, 2, 5,
-	4, 0, 6, 4, 0, 4, 3, 2, 1, 0, 3, 5, 4, 3, 6, 0, 4, 5, 3, 0,
-	5, 6, 5, 0, 3, 5, 3, 1, 0, 6, 4, 1, 6, 4, 2, 4, 0, 0, 4, 0,
-	6, 0, 5, 2, 2, 3, 2, 6, 3, 1, 3, 6, 2, 4, 4, 6, 2, 0, 5, 1,
-	0, 3, 6, 4, 0, 2, 6, 1, 0, 5, 0, 1, 4, 6, 0, 4, 1, 2, 5, 1,
-	1, 4, 2, 6, 0, 2, 4, 6, 3, 4, 5, 0, 5, 1, 0, 4, 4, 5, 0, 3,
-	2, 0, 1, 5, 2, 0, 5, 2, 1, 2, 3, 1, 4, 2, 0, 4, 0, 5, 1, 3,
-	3, 4, 0, 1, 4, 6, 6, 1, 0, 1, 5, 6, 0, 4, 5, 2, 3, 4, 2, 3,
-	4, 3, 6, 2, 3, 2, 4, 6, 0, 3, 4, 2, 5, 1, 2, 3, 2, 0, 2, 6,
-	5, 1, 4, 3, 5, 3, 1, 5, 0, 4, 3, 0, 6, 0, 1, 2, 1, 4, 6, 2,
-	6, 1, 0, 5, 2, 6, 4, 4, 2, 1, 5, 1, 4, 2, 2, 5, 0, 2, 5, 0,
-	0, 5, 5, 1, 3, 0, 2, 4, 1, 2, 1, 6, 2, 4, 0, 6, 4, 5, 4, 5,
-	1, 6, 3, 6, 3, 4, 5, 2, 6, 2, 5, 3, 6, 1, 2, 0, 2, 3, 5, 1,
-	2, 4, 6, 3, 2, 4, 2, 2, 3, 6, 6, 3, 6, 5, 0, 4, 1, 3, 0, 5,
-	3, 5, 1, 6, 5, 5, 4, 2, 4, 0, 2, 4, 2, 1, 4, 1, 5, 2, 0, 1,
-	4, 6, 0, 5, 0, 5, 6, 0, 2, 4, 3, 4, 1, 2, 6, 5, 6, 1, 5, 6,
-	5, 3, 6, 0, 1, 6, 5, 6, 3, 5, 1, 0, 3, 3, 5, 0, 2, 0, 1, 1,
-	6, 5, 2, 1, 6, 5, 2, 5, 1, 6, 1, 6, 1, 3, 6, 5, 4, 1, 5, 1,
-	0, 3, 2, 6, 3, 3, 6, 5, 2, 5, 1, 3, 6, 3, 2, 3, 2, 2, 3, 5,
-	1, 4, 0, 6, 1, 5, 6, 1, 5, 0, 0, 4, 0, 6, 5, 3, 0, 5, 6, 3,
-	2, 1, 4, 3, 1, 2, 3, 0, 2, 1, 2, 6, 0, 1, 4, 6, 3, 0, 1, 6,
-	3, 4, 1, 4, 2, 1, 5, 3, 2, 6, 3, 2, 4, 0, 6, 5, 3, 4, 0, 4,
-	4, 1, 1, 3, 1, 5, 0, 2, 5, 4, 0, 2, 5, 0, 3, 1, 4, 6, 3, 1,
-	5, 2, 5, 1, 3, 0, 4, 4, 1, 4, 3, 4, 6, 3, 4, 5, 2, 3, 3, 0,
-	6, 5, 1, 4, 1, 2, 4, 2, 1, 6, 4, 2, 6, 3, 4, 2, 5, 3, 5, 3,
-	0, 0, 6, 3, 4, 2, 5, 1, 4, 3, 5, 6, 4, 2, 1, 3, 5, 1, 5, 3,
-	1, 6, 3, 4, 3, 4, 2, 5, 3, 1, 6, 3, 4, 0, 5, 6, 0, 5, 6, 5,
-	2, 0, 3, 4, 2, 5, 4, 5, 4, 5, 4, 0, 3, 2, 5, 5, 4, 2, 3, 1,
-	3, 6, 5, 1, 6, 2, 4, 5, 2, 4, 3, 2, 2, 3, 0, 5, 3, 2, 3, 1,
-	4, 5, 4, 3, 5, 3, 5, 1, 2, 3, 2, 2, 0, 1, 0, 3, 0, 6, 2, 5,
-	5, 2, 6, 5, 2, 4, 6, 1, 0, 0, 6, 0, 6, 5, 5, 3, 1, 0, 2, 5,
-	6, 3, 0, 1, 2, 4, 6, 2, 0, 5, 4, 5, 2, 1, 4, 6, 2, 5, 3, 6,
-	0, 2, 6, 1, 3, 5, 4, 5, 6, 1, 4, 5, 3, 0, 2, 6, 4, 0, 6, 5,
-	1, 2, 0, 2, 4, 6, 3, 0, 5, 0, 2, 4, 5, 6, 5, 3, 4, 3, 0, 1,
-	2, 5, 0, 5, 3, 2, 5, 3, 3, 2, 0, 5, 0, 5, 6, 3, 1, 3, 0, 5,
-	3, 0, 5, 4, 2, 5, 1, 5, 0, 2, 0, 5, 2, 0, 2, 2, 5, 0, 4, 5,
-	4, 6, 4, 0, 3, 4, 0, 0, 5, 3, 6, 4, 3, 5, 6, 1, 0, 3, 3, 5,
-	5, 4, 0, 4, 3, 1, 5, 4, 2, 5, 0, 2, 4, 0, 4, 0, 1, 2, 0, 1,
-	6, 5, 0, 2, 6, 3, 1, 0, 5, 1, 3, 0, 1, 2, 3, 1, 4, 1, 2, 3,
-	0, 2, 2, 1, 3, 4, 1, 4, 1, 0, 2, 6, 1, 3, 4, 6, 2, 5, 0, 1,
-	1, 2, 5, 2, 3, 5, 3, 2, 1, 0, 4, 6, 0, 6, 3, 1, 1, 1, 0, 6,
-	2, 6, 3, 1, 6, 1, 4, 1, 6, 5, 0, 1, 0, 4, 2, 4, 6, 2, 1, 3,
-	3, 6, 0, 3, 6, 4, 1, 0, 0, 1, 2, 0, 5, 4, 2, 3, 2, 6, 6, 4,
-	4, 5, 3, 2, 1, 3, 4, 5, 4, 3, 2, 0, 4, 3, 1, 2, 5, 1, 4, 6,
-	5, 3, 0, 4, 3, 5, 0, 6, 3, 6, 3, 0, 2, 5, 6, 4, 3, 4, 1, 4,
-	6, 2, 5, 1, 4, 5, 3, 5, 6, 5, 6, 6, 2, 6, 0, 1, 1, 6, 4, 3,
-	0, 3, 1, 0, 4, 1, 3, 5, 3, 2, 2, 0, 5, 0, 6, 4, 5, 5, 6, 1,
-	1, 2, 5, 3, 2, 6, 4, 1, 2, 4, 3, 4, 6, 1, 4, 1, 6, 0, 5, 3,
-	2, 4, 1, 3, 1, 3, 6, 3, 5, 0, 6, 1, 6, 4, 5, 4, 0, 2, 6, 4,
-	3, 4, 6, 0, 6, 1, 0, 5, 3, 4, 2, 1, 2, 5, 0, 2, 3, 2, 5, 0,
-	4, 3, 2, 0, 2, 0, 1, 1, 6, 0, 6, 5, 6, 1, 2, 3, 6, 2, 3, 1,
-	5, 4, 0, 3, 2, 4, 3, 1, 5, 3, 6, 2, 2, 1, 5, 3, 2, 1, 6, 4,
-	6, 1, 3, 6, 2, 6, 2, 3, 0, 5, 1, 0, 1, 2, 0, 3, 2, 1, 2, 4,
-	0, 6, 0, 1, 3, 1, 2, 1, 6, 0, 1, 2, 3, 4, 1, 3, 0, 6, 3, 1,
-	1, 0, 5, 4, 6, 2, 1, 4, 3, 0, 2, 2, 0, 6, 1, 6, 4, 3, 0, 3,
-	2, 6, 5, 4, 1, 5, 6, 1, 3, 2, 5, 6, 5, 6, 3, 5, 6, 4, 1, 4,
-	3, 4, 6, 0, 6, 1, 4, 2, 1, 5, 6, 5, 0, 3, 0, 4, 2, 4, 1, 2,
-	4, 5, 2, 3, 0, 4, 6, 2, 6, 3, 5, 4, 0, 1, 2, 1, 2, 5, 4, 3,
-	5, 2, 0, 1, 4, 1, 3, 4, 3, 3, 6, 2, 1, 2, 6, 1, 0, 3, 5, 2,
-	6, 5, 4, 0, 4, 0, 1, 6, 3, 0, 2, 2, 1, 1, 4, 3, 3, 2, 2, 6,
-	0, 5, 6, 0, 2, 5, 4, 1, 4, 5, 1, 2, 6, 5, 0, 1, 0, 6, 2, 1,
-	1, 5, 0, 6, 1, 4, 0, 5, 0, 6, 4, 6, 4, 0, 3, 0, 0, 5, 1, 2,
-	2, 2, 0, 6, 0, 6, 4, 6, 0, 2, 1, 4, 0, 4, 3, 0, 1, 1, 2, 1,
-	3, 1, 0, 2, 0, 3, 4, 0, 2, 4, 1, 1, 5, 0, 4, 3, 2, 6, 3, 1,
-	4, 6, 3, 2, 5, 2, 3, 5, 2, 0, 4, 2, 6, 4, 1, 4, 5, 2, 1, 2,
-	5, 5, 3, 3, 0, 4, 2, 1, 5, 4, 4, 5, 1, 0, 5, 1, 2, 0, 1, 5,
-	6, 5, 6, 5, 0, 1, 6, 3, 5, 6, 4, 2, 6, 1, 2, 4, 3, 6, 2, 5,
-	0, 6, 1, 5, 4, 1, 3, 4, 3, 3, 6, 5, 1, 5, 3, 3, 1, 6, 1, 3,
-	1, 4, 0, 5, 4, 0, 3, 2, 6, 1, 4, 6, 6, 0, 3, 5, 2, 6, 5, 0,
-	2, 1, 6, 0, 5, 1, 2, 4, 1, 0, 4, 5, 0, 2, 1, 3, 4, 3, 6, 0,
-	3, 1, 6, 2, 5, 2, 0, 6, 1, 6, 0, 6, 0, 5, 2, 2, 4, 5, 2, 1,
-	4, 6, 4, 2, 0, 2, 6, 1, 2, 0, 1, 4, 0, 2, 0, 6, 4, 2, 6, 3,
-	5, 3, 1, 4, 2, 4, 5, 2, 4, 6, 2, 0, 4, 1, 6, 0, 5, 0, 5, 2,
-	6, 2, 3, 0, 1, 0, 4, 1, 5, 4, 3, 6, 3, 4, 6, 5, 6, 5, 6, 1,
-	0, 6, 6, 1, 0, 4, 6, 5, 0, 2, 3, 1, 0, 2, 3, 0, 0, 5, 2, 6,
-	1, 0, 1, 2, 4, 5, 0, 3, 0, 5, 2, 1, 6, 1, 4, 3, 4, 3, 4, 6,
-	2, 6, 2, 4, 3, 2, 0, 6, 4, 2, 6, 4, 1, 4, 5, 3, 6, 0, 6, 0,
-	3, 5, 4, 3, 0, 5, 2, 6, 0, 4, 1, 2, 4, 0, 2, 6, 2, 0, 6, 5,
-	4, 6, 5, 6, 2, 6, 4, 2, 5, 1, 3, 2, 3, 6, 2, 4, 5, 1, 0, 3,
-	5, 1, 5, 4, 0, 5, 4, 6, 5, 6, 4, 0, 5, 2, 0, 1, 0, 4, 0, 3,
-	6, 6, 0, 6, 2, 0, 4, 6, 4, 0, 4, 0, 6, 3, 0, 2, 3, 0, 6, 6,
-	0, 6, 2, 4, 5, 6, 0, 2, 5, 1, 6, 3, 0, 4, 2, 4, 3, 6, 4, 2,
-	1, 6, 3, 3, 0, 2, 5, 4, 0, 3, 2, 6, 2, 3, 4, 6, 4, 2, 5, 2,
-	2, 0, 1, 3, 3, 4, 0, 2, 1, 4, 2, 4, 5, 4, 6, 2, 1, 6, 5, 0,
-	3, 5, 2, 3, 1, 4, 6, 1, 6, 2, 2, 3, 5, 0, 2, 6, 3, 1, 3, 4,
-	4, 1, 0, 4, 3, 1, 5, 4, 4, 6, 6, 5, 2, 4, 5, 4, 1, 3, 2, 3,
-	5, 6, 2, 3, 6, 0, 3, 5, 1, 6, 2, 5, 6, 4, 5, 2, 3, 1, 1, 0,
-	6, 3, 6, 2, 3, 1, 2, 5, 6, 4, 3, 4, 6, 2, 5, 0, 1, 2, 5, 6,
-	0, 2, 3, 6, 2, 3, 4, 3, 5, 0, 5, 1, 6, 1, 3, 1, 6, 5, 4, 5,
-	1, 3, 6, 3, 6, 1, 5, 1, 0, 2, 0, 6, 3, 1, 4, 1, 4, 1, 4, 2,
-	2, 0, 4, 5, 2, 1, 6, 3, 4, 1, 1, 3, 2, 6, 0, 0, 0, 5, 5, 4,
-	3, 5, 0, 6, 4, 5, 1, 5, 3, 1, 4, 0, 4, 2, 6, 3, 2, 0, 6, 1,
-	4, 3, 0, 2, 4, 3, 2, 3, 2, 3, 5, 2, 3, 2, 6, 4, 1, 2, 6, 5,
-	5, 4, 0, 6, 4, 2, 4, 2, 1, 6, 1, 0, 5, 1, 3, 1, 4, 2, 0, 6,
-	6, 5, 1, 3, 0, 0, 2, 3, 6, 5, 1, 5, 1, 4, 3, 4, 0, 6, 1, 0,
-	0, 2, 6, 3, 0, 4, 5, 3, 2, 3, 2, 0, 3, 6, 4, 3, 5, 3, 3, 1,
-	1, 3, 2, 3, 2, 0, 5, 6, 3, 0, 3, 4, 4, 2, 5, 4, 5, 1, 0, 5,
-	2, 0, 4, 1, 4, 6, 2, 3, 4, 0, 6, 0, 1, 0, 6, 5, 4, 0, 2, 1,
-	3, 6, 5, 1, 5, 0, 4, 2, 6, 1, 2, 0, 5, 4, 2, 6, 4, 3, 5, 1,
-	4, 2, 2, 1, 6, 6, 2, 3, 5, 0, 5, 4, 6, 3, 0, 2, 0, 3, 2, 5,
-	5, 0, 3, 6, 0, 2, 5, 3, 1, 2, 6, 0, 6, 1, 3, 2, 6, 0, 5, 2,
-	6, 0, 1, 4, 6, 2, 6, 4, 5, 2, 0, 4, 3, 5, 1, 6, 3, 6, 2, 4,
-	0, 1, 2, 6, 4, 5, 4, 1, 2, 5, 2, 0, 1, 5, 0, 6, 4, 1, 2, 1,
-	1, 5, 1, 5, 2, 3, 4, 1, 3, 4, 5, 3, 4, 2, 3, 0, 3, 6, 5, 3,
-	2, 0, 6, 1, 2, 4, 3, 0, 2, 0, 1, 0, 3, 1, 0, 5, 6, 3, 6, 4,
-	3, 3, 1, 5, 6, 0, 5, 1, 0, 6, 1, 2, 3, 6, 3, 2, 0, 6, 0, 2,
-	4, 6, 2, 0, 3, 2, 5, 3, 2, 0, 6, 5, 3, 6, 3, 1, 3, 5, 4, 1,
-	5, 2, 4, 3, 0, 4, 6, 0, 5, 2, 6, 5, 0, 6, 3, 2, 0, 6, 1, 0,
-	6, 2, 6, 3, 3, 1, 5, 0, 4, 2, 3, 1, 2, 3, 1, 2, 6, 4, 6, 4,
-	0, 0, 4, 1, 4, 3, 1, 2, 0, 5, 6, 0, 6, 5, 0, 3, 0, 2, 1, 6,
-	1, 4, 1, 6, 0, 1, 1, 1, 4, 2, 1, 4, 0, 4, 1, 4, 6, 3, 4, 3,
-	2, 0, 1, 4, 0, 4, 0, 5, 3, 1, 6, 1, 4, 3, 4, 2, 6, 0, 4, 0,
-	3, 0, 5, 1, 6, 1, 3, 2, 4, 2, 6, 2, 4, 3, 4, 4, 3, 3, 4, 1,
-	4, 5, 5, 0, 3, 1, 0, 3, 4, 5, 0, 5, 1, 5, 1, 2, 1, 5, 1, 4,
-	5, 3, 2, 1, 5, 4, 5, 4, 6, 2, 3, 1, 3, 2, 0, 6, 3, 4, 5, 1,
-	6, 1, 0, 3, 5, 0, 4, 2, 6, 3, 6, 2, 1, 6, 5, 3, 4, 6, 2, 5,
-	0, 6, 5, 4, 3, 4, 1, 6, 3, 0, 4, 3, 0, 2, 4, 6, 5, 0, 3, 0,
-	1, 6, 3, 1, 0, 5, 0, 1, 2, 1, 4, 1, 5, 3, 1, 6, 3, 3, 0, 5,
-	2, 0, 3, 2, 6, 3, 3, 1, 4, 2, 6, 0, 1, 5, 6, 3, 4, 6, 0, 4,
-	3, 1, 3, 4, 0, 3, 6, 3, 5, 3, 1, 0, 1, 6, 0, 0, 4, 4, 5, 0,
-	4, 1, 2, 3, 2, 6, 0, 4, 5, 4, 1, 0, 6, 5, 4, 2, 2, 3, 0, 5,
-	5, 2, 6, 1, 3, 6, 0, 6, 4, 3, 6, 5, 1, 1, 3, 0, 3, 1, 0, 2,
-	6, 5, 1, 2, 3, 6, 3, 5, 2, 6, 5, 5, 3, 1, 0, 4, 5, 6, 4, 3,
-	0, 5, 0, 2, 3, 6, 3, 0, 5, 4, 3, 1, 3, 0, 3, 5, 4, 3, 6, 3,
-	1, 5, 2, 0, 4, 1, 2, 1, 4, 2, 0, 3, 3, 1, 3, 0, 5, 3, 4, 6,
-	2, 1, 6, 2, 4, 4, 6, 2, 5, 2, 5, 1, 1, 4, 2, 6, 3, 6, 3, 2,
-	3, 3, 5, 4, 4, 1, 2, 5, 4, 0, 4, 1, 3, 3, 0, 6, 4, 3, 5, 4,
-	4, 5, 2, 3, 5, 0, 2, 3, 5, 6, 4, 5, 1, 2, 4, 2, 5, 4, 2, 4,
-	5, 4, 6, 2, 4, 2, 6, 3, 5, 1, 0, 6, 4, 6, 1, 3, 5, 4, 2, 0,
-	6, 5, 4, 0, 5, 1, 0, 2, 5, 0, 1, 6, 0, 2, 6, 1, 0, 4, 6, 0,
-	0, 4, 1, 6, 1, 6, 1, 4, 6, 4, 6, 2, 4, 0, 3, 0, 1, 5, 2, 6,
-	1, 6, 0, 5, 6, 5, 4, 5, 2, 6, 5, 4, 2, 5, 6, 5, 4, 5, 2, 1,
-	2, 5, 6, 1, 1, 6, 5, 2, 5, 4, 6, 5, 2, 6, 2, 3, 0, 5, 2, 4,
-	3, 6, 2, 4, 2, 2, 0, 5, 2, 0, 4, 6, 3, 1, 5, 4, 2, 4, 1, 1,
-	4, 1, 2, 1, 1, 4, 5, 2, 2, 4, 0, 6, 2, 3, 5, 3, 2, 3, 4, 3,
-	5, 6, 3, 3, 5, 6, 4, 0, 1, 5, 2, 4, 5, 0, 2, 3, 2, 0, 5, 3,
-	6, 1, 2, 2, 6, 3, 4, 0, 6, 5, 6, 1, 6, 6, 1, 2, 3, 0, 1, 2,
-	0, 6, 0, 4, 4, 2, 4, 3, 2, 1, 5, 5, 0, 2, 4, 1, 4, 5, 1, 2,
-	1, 4, 2, 6, 0, 5, 4, 2, 3, 0, 1, 0, 6, 1, 2, 5, 0, 1, 3, 6,
-	2, 0, 6, 1, 5, 1, 0, 4, 0, 6, 2, 4, 6, 2, 6, 4, 3, 3, 1, 0,
-	3, 3, 6, 4, 0, 4, 1, 6, 4, 2, 5, 0, 2, 4, 2, 6, 5, 1, 1, 4,
-	4, 2, 5, 1, 2, 6, 0, 6, 0, 2, 5, 1, 5, 3, 4, 3, 1, 6, 0, 4,
-	5, 1, 0, 3, 0, 6, 2, 1, 6, 5, 5, 6, 0, 3, 1, 2, 5, 0, 5, 6,
-	6, 5, 1, 6, 2, 1, 5, 0, 1, 5, 6, 3, 2, 3, 2, 3, 2, 1, 3, 5,
-	0, 1, 3, 4, 3, 4, 1, 4, 1, 3, 2, 1, 3, 6, 0, 3, 2, 1, 3, 5,
-	1, 6, 3, 5, 0, 4, 1, 5, 4, 6, 0, 5, 6, 6, 2, 5, 2, 6, 4, 6,
-	2, 5, 6, 1, 0, 5, 2, 3, 4, 1, 5, 1, 2, 6, 1, 4, 0, 1, 3, 4,
-	3, 2, 5, 6, 1, 5, 2, 4, 3, 4, 1, 5, 6, 3, 1, 3, 6, 0, 6, 5,
-	4, 6, 6, 0, 3, 5, 1, 5, 0, 4, 0, 4, 1, 3, 0, 4, 6, 4, 6, 5,
-	5, 2, 1, 0, 3, 6, 5, 0, 2, 1, 0, 3, 0, 1, 2, 0, 5, 2, 5, 3,
-	6, 0, 5, 2, 5, 0, 4, 5, 0, 3, 2, 1, 3, 6, 5, 1, 3, 2, 1, 4,
-	0, 5, 6, 2, 5, 1, 5, 1, 4, 5, 2, 0, 2, 3, 6, 5, 4, 5, 3, 6,
-	1, 4, 0, 5, 1, 5, 0, 5, 0, 6, 0, 1, 5, 1, 2, 5, 2, 0, 3, 5,
-	2, 1, 2, 6, 0, 2, 4, 2, 5, 2, 0, 5, 1, 5, 1, 3, 0, 3, 5, 3,
-	3, 2, 4, 3, 5, 3, 4, 2, 1, 3, 2, 1, 0, 5, 2, 6, 3, 0, 1, 3,
-	4, 6, 2, 0, 5, 4, 2, 6, 2, 0, 6, 0, 5, 1, 3, 5, 6, 5, 6, 5,
-	5, 6, 5, 0, 0, 5, 6, 5, 3, 0, 4, 5, 4, 1, 5, 1, 5, 3, 2, 5,
-	6, 2, 5, 1, 4, 3, 4, 2, 0, 3, 5, 4, 0, 5, 5, 6, 3, 6, 1, 4,
-	0, 1, 4, 0, 3, 4, 2, 3, 0, 0, 4, 3, 0, 5, 2, 0, 1, 5, 0, 2,
-	1, 1, 6, 2, 5, 1, 5, 1, 3, 5, 1, 5, 6, 3, 5, 3, 1, 2, 5, 4,
-	2, 1, 6, 1, 3, 2, 1, 2, 3, 5, 6, 0, 4, 5, 4, 3, 6, 1, 2, 0,
-	3, 0, 4, 5, 6, 2, 6, 5, 2, 1, 6, 0, 5, 1, 5, 6, 4, 5, 2, 6,
-	4, 3, 5, 3, 1, 2, 0, 5, 0, 2, 3, 3, 2, 1, 2, 6, 5, 6, 5, 2,
-	5, 6, 3, 0, 1, 3, 2, 0, 6, 3, 2, 3, 6, 2, 3, 1, 3, 1, 2, 1,
-	6, 0, 1, 1, 5, 1, 3, 1, 4, 2, 6, 0, 6, 1, 0, 3, 4, 2, 6, 3,
-	0, 2, 3, 3, 4, 1, 5, 2, 4, 2, 2, 5, 2, 4, 5, 4, 5, 0, 5, 4,
-	1, 0, 3, 3, 5, 1, 6, 0, 5, 6, 1, 2, 4, 1, 4, 0, 6, 3, 5, 2,
-	2, 3, 0, 3, 6, 1, 2, 4, 5, 6, 3, 6, 0, 6, 5, 4, 3, 1, 4, 4,
-	3, 2, 3, 4, 1, 2, 6, 0, 2, 5, 1, 2, 6, 1, 5, 2, 2, 0, 2, 5,
-	4, 2, 4, 6, 1, 4, 4, 5, 6, 4, 1, 0, 5, 0, 3, 6, 0, 6, 1, 5,
-	5, 4, 0, 5, 0, 4, 5, 1, 3, 4, 1, 4, 0, 5, 2, 5, 0, 1, 4, 5,
-	6, 2, 3, 2, 0, 2, 1, 1, 6, 3, 0, 3, 5, 1, 3, 1, 5, 1, 5, 1,
-	0, 5, 6, 1, 3, 2, 0, 5, 1, 0, 3, 5, 6, 1, 2, 5, 0, 5, 4, 5,
-	1, 5, 1, 6, 0, 4, 2, 6, 1, 4, 3, 0, 5, 2, 0, 4, 1, 4, 1, 2,
-	2, 1, 2, 6, 0, 6, 4, 3, 2, 1, 5, 6, 4, 2, 6, 1, 5, 4, 3, 5,
-	3, 6, 1, 6, 3, 1, 2, 1, 1, 1, 5, 5, 2, 4, 6, 0, 3, 6, 1, 3,
-	4, 2, 0, 4, 1, 5, 1, 0, 2, 6, 4, 0, 1, 3, 4, 0, 2, 0, 1, 2,
-	5, 1, 2, 3, 0, 3, 1, 4, 1, 5, 4, 4, 2, 3, 4, 6, 1, 3, 5, 0,
-	6, 6, 3, 4, 0, 5, 0, 3, 6, 5, 4, 5, 4, 1, 1, 4, 0, 2, 4, 1,
-	0, 3, 6, 3, 5, 6, 1, 0, 6, 6, 1, 3, 3, 6, 5, 1, 5, 2, 6, 2,
-	1, 2, 0, 5, 4, 6, 1, 4, 1, 4, 1, 6, 4, 3, 3, 2, 3, 4, 5, 6,
-	2, 0, 4, 2, 3, 5, 5, 4, 3, 4, 5, 2, 6, 5, 3, 2, 3, 3, 5, 0,
-	3, 5, 0, 4, 1, 6, 5, 4, 1, 4, 6, 3, 6, 5, 1, 4, 2, 3, 4, 1,
-	4, 1, 2, 5, 0, 2, 6, 5, 4, 1, 4, 2, 3, 4, 1, 5, 1, 3, 1, 5,
-	5, 3, 5, 6, 5, 4, 3, 2, 3, 5, 6, 1, 1, 5, 0, 1, 3, 3, 2, 2,
-	6, 1, 0, 4, 1, 2, 4, 3, 5, 0, 2, 1, 3, 4, 2, 1, 5, 2, 3, 2,
-	0, 1, 4, 2, 1, 3, 5, 6, 4, 6, 5, 5, 6, 2, 6, 5, 2, 0, 3, 0,
-	1, 0, 5, 4, 1, 0, 5, 4, 1, 0, 4, 2, 4, 5, 4, 2, 5, 1, 6, 4,
-	2, 6, 3, 0, 3, 2, 1, 4, 2, 1, 6, 4, 5, 0, 3, 5, 0, 6, 1, 2,
-	3, 1, 5, 3, 4, 1, 2, 1, 3, 6, 1, 4, 2, 1, 2, 1, 3, 0, 6, 3,
-	4, 2, 3, 1, 2, 5, 2, 3, 6, 0, 5, 2, 3, 0, 3, 5, 4, 2, 0, 3,
-	5, 6, 3, 1, 5, 3, 1, 0, 3, 1, 4, 5, 0, 3, 2, 0, 2, 3, 5, 2,
-	6, 2, 0, 1, 6, 4, 3, 4, 1, 3, 0, 4, 1, 5, 2, 0, 4, 3, 3, 4,
-	0, 5, 4, 5, 5, 1, 5, 4, 5, 4, 5, 3, 2, 4, 2, 0, 5, 6, 3, 3,
-	1, 1, 2, 6, 6, 1, 0, 4, 3, 4, 0, 4, 6, 6, 6, 6, 6, 0, 1, 4,
-	2, 3, 5, 6, 5, 2, 4, 6, 4, 0, 3, 2, 3, 5, 3, 5, 0, 2, 1, 0,
-	3, 3, 1, 4, 6, 4, 6, 1, 6, 5, 2, 6, 4, 5, 3, 6, 4, 3, 4, 0,
-	4, 6, 1, 6, 4, 6, 5, 2, 2, 0, 2, 3, 2, 3, 6, 5, 1, 0, 6, 3,
-	5, 3, 6, 4, 1, 6, 4, 6, 6, 4, 2, 1, 3, 4, 1, 5, 6, 2, 0, 1,
-	6, 1, 3, 1, 0, 6, 0, 1, 5, 3, 0, 1, 6, 2, 2, 1, 5, 1, 4, 6,
-	0, 4, 3, 6, 0, 1, 3, 4, 5, 0, 6, 1, 0, 4, 0, 0, 1, 5, 3, 2,
-	1, 4, 2, 4, 6, 5, 1, 6, 3, 4, 6, 1, 0, 4, 0, 3, 5, 0, 2, 3,
-	2, 6, 2, 5, 2, 5, 6, 3, 0, 3, 5, 0, 1, 2, 0, 4, 0, 1, 1, 4,
-	3, 5, 0, 5, 4, 3, 0, 1, 3, 5, 1, 6, 2, 1, 2, 0, 2, 0, 3, 3,
-	4, 1, 1, 6, 2, 6, 4, 2, 0, 6, 2, 5, 1, 5, 4, 2, 1, 5, 6, 1,
-	5, 4, 6, 4, 6, 4, 0, 1, 4, 3, 6, 5, 3, 3, 5, 3, 2, 1, 2, 5,
-	6, 4, 3, 0, 6, 4, 1, 5, 6, 2, 0, 3, 6, 0, 5, 6, 2, 4, 0, 3,
-	0, 6, 4, 2, 1, 5, 6, 4, 5, 3, 5, 0, 2, 0, 6, 3, 4, 3, 2, 5,
-	1, 3, 6, 5, 1, 5, 2, 0, 2, 0, 3, 4, 5, 4, 3, 1, 6, 4, 3, 1,
-	2, 4, 0, 5, 1, 4, 2, 4, 6, 4, 3, 1, 4, 0, 1, 1, 2, 1, 0, 6,
-	3, 6, 0, 1, 2, 6, 3, 3, 5, 0, 1, 2, 0, 5, 0, 2, 2, 4, 5, 1,
-	4, 2, 5, 3, 5, 1, 1, 4, 6, 1, 6, 5, 0, 6, 3, 1, 2, 2, 4, 0,
-	5, 6, 2, 0, 2, 0, 2, 4, 2, 0, 6, 3, 1, 5, 3, 1, 6, 3, 4, 1,
-	6, 2, 1, 4, 0, 3, 4, 3, 2, 4, 2, 0, 6, 1, 4, 1, 5, 4, 6, 2,
-	0, 1, 1, 0, 1, 3, 5, 3, 0, 4, 5, 2, 4, 3, 2, 3, 0, 3, 5, 2,
-	1, 4, 5, 0, 4, 1, 3, 1, 0, 6, 0, 1, 4, 6, 4, 2, 0, 5, 5, 5,
-	2, 3, 6, 2, 3, 4, 2, 5, 2, 1, 4, 5, 2, 5, 1, 2, 0, 3, 1, 5,
-	3, 2, 0, 6, 4, 2, 6, 2, 4, 3, 4, 4, 3, 0, 3, 0, 3, 4, 6, 1,
-	4, 6, 5, 6, 3, 4, 6, 5, 4, 0, 3, 2, 5, 1, 2, 6, 0, 5, 5, 3,
-	5, 1, 3, 5, 4, 6, 1, 5, 2, 3, 2, 4, 3, 6, 4, 1, 3, 4, 3, 3,
-	6, 4, 6, 2, 1, 5, 5, 0, 2, 0, 1, 3, 3, 4, 5, 5, 3, 2, 3, 5,
-	0, 4, 6, 2, 1, 2, 1, 6, 2, 6, 5, 0, 4, 6, 4, 5, 4, 5, 1, 2,
-	1, 4, 2, 5, 1, 5, 1, 5, 2, 6, 2, 5, 6, 1, 3, 1, 6, 5, 6, 3,
-	2, 3, 5, 4, 0, 4, 2, 4, 2, 3, 6, 4, 3, 5, 4, 6, 5, 2, 0, 3,
-	3, 4, 0, 3, 6, 6, 4, 6, 4, 3, 1, 1, 2, 3, 0, 1, 0, 4, 6, 3,
-	4, 5, 4, 1, 6, 0, 4, 2, 1, 2, 4, 3, 1, 6, 3, 4, 2, 5, 2, 3,
-	5, 1, 6, 1, 0, 5, 0, 4, 3, 1, 6, 1, 6, 0, 6, 0, 6, 1, 0, 5,
-	6, 0, 6, 2, 6, 0, 4, 2, 6, 4, 5, 1, 0, 2, 5, 4, 6, 5, 1, 5,
-	0, 4, 6, 3, 0, 1, 6, 5, 4, 2, 5, 3, 3, 6, 3, 5, 1, 5, 1, 6,
-	1, 3, 5, 4, 1, 6, 2, 3, 2, 6, 0, 1, 0, 5, 2, 4, 6, 5, 0, 6,
-	2, 4, 6, 5, 6, 5, 1, 4, 2, 3, 0, 0, 1, 0, 1, 6, 6, 3, 1, 4,
-	3, 1, 6, 4, 0, 3, 0, 1, 4, 2, 4, 5, 3, 3, 6, 1, 1, 6, 1, 3,
-	4, 5, 1, 4, 6, 0, 4, 1, 4, 3, 0, 3, 2, 2, 6, 3, 5, 5, 4, 0,
-	5, 0, 5, 3, 2, 0, 5, 4, 2, 1, 0, 6, 0, 3, 5, 4, 3, 4, 5, 3,
-	6, 2, 1, 5, 3, 4, 2, 0, 2, 4, 1, 6, 4, 1, 4, 2, 4, 3, 2, 3,
-	0, 6, 5, 6, 0, 1, 3, 5, 1, 5, 0, 4, 2, 3, 1, 2, 0, 1, 3, 4,
-	1, 6, 2, 0, 1, 1, 6, 2, 6, 3, 4, 5, 2, 3, 5, 1, 0, 4, 1, 4,
-	2, 1, 5, 3, 2, 4, 6, 4, 6, 5, 6, 4, 1, 4, 2, 0, 1, 0, 3, 6,
-	3, 1, 2, 1, 2, 5, 0, 4, 0, 4, 2, 0, 3, 4, 0, 6, 3, 4, 2, 3,
-	4, 1, 5, 3, 3, 2, 3, 1, 3, 2, 2, 1, 3, 4, 6, 2, 6, 5, 3, 2,
-	5, 3, 6, 4, 5, 0, 2, 1, 4, 2, 5, 1, 1, 4, 6, 2, 6, 5, 2, 5,
-	6, 2, 3, 2, 0, 4, 0, 6, 5, 0, 3, 4, 1, 3, 2, 5, 4, 5, 6, 5,
-	0, 4, 0, 1, 4, 1, 3, 2, 5, 0, 1, 6, 4, 0, 3, 5, 6, 4, 5, 6,
-	1, 4, 6, 5, 4, 1, 3, 4, 3, 2, 3, 6, 3, 1, 4, 5, 3, 3, 6, 3,
-	2, 5, 4, 1, 0, 6, 3, 4, 6, 3, 0, 3, 4, 3, 2, 1, 4, 2, 4, 4,
-	3, 0, 4, 2, 3, 5, 4, 2, 0, 6, 0, 5, 4, 0, 4, 0, 1, 4, 5, 4,
-	4, 6, 3, 4, 3, 1, 0, 1, 3, 2, 6, 4, 1, 2, 0, 5, 2, 1, 5, 6,
-	5, 3, 2, 0, 4, 5, 4, 4, 4, 6, 0, 4, 0, 4, 0, 3, 1, 0, 1, 3,
-	6, 3, 0, 6, 3, 1, 0, 6, 2, 6, 3, 4, 5, 1, 4, 2, 6, 2, 5, 0,
-	0, 6, 4, 2, 5, 1, 4, 2, 1, 5, 1, 0, 6, 1, 0, 2, 1, 0, 6, 3,
-	1, 2, 0, 2, 0, 6, 6, 0, 5, 1, 4, 3, 5, 3, 2, 0, 1, 2, 3, 0,
-	2, 4, 3, 2, 3, 5, 3, 0, 3, 1, 6, 2, 5, 0, 6, 4, 0, 5, 1, 4,
-	3, 6, 0, 5, 1, 0, 4, 6, 1, 2, 6, 5, 2, 3, 2, 3, 6, 1, 2, 5,
-	4, 3, 6, 6, 1, 4, 5, 2, 4, 0, 2, 3, 2, 5, 3, 6, 4, 0, 3, 4,
-	5, 5, 0, 5, 5, 1, 1, 1, 2, 1, 3, 1, 3, 0, 3, 0, 5, 1, 4, 2,
-	6, 2, 6, 2, 3, 2, 6, 1, 0, 5, 2, 0, 6, 5, 4, 3, 4, 1, 0, 2,
-	0, 6, 2, 4, 3, 2, 1, 4, 5, 6, 6, 1, 0, 4, 1, 0, 2, 5, 1, 4,
-	1, 0, 1, 0, 4, 2, 1, 4, 1, 2, 3, 2, 4, 5, 1, 4, 1, 5, 2, 4,
-	2, 5, 1, 6, 4, 1, 1, 3, 3, 6, 1, 3, 5, 1, 3, 1, 4, 5, 4, 2,
-	3, 5, 1, 3, 5, 2, 1, 3, 0, 4, 4, 2, 1, 5, 1, 4, 6, 0, 2, 4,
-	4, 3, 4, 3, 5, 2, 4, 1, 4, 2, 4, 3, 1, 0, 6, 2, 6, 5, 4, 2,
-	5, 6, 4, 6, 2, 3, 5, 0, 5, 6, 0, 5, 2, 6, 2, 0, 3, 6, 4, 5,
-	6, 5, 6, 1, 0, 6, 0, 6, 1, 4, 2, 4, 5, 0, 3, 2, 0, 6, 1, 3,
-	0, 2, 5, 2, 6, 3, 6, 5, 0, 2, 1, 1, 1, 3, 4, 1, 2, 5, 1, 5,
-	1, 3, 4, 6, 5, 0, 2, 4, 1, 0, 1, 6, 2, 3, 5, 5, 4, 4, 0, 1,
-	2, 3, 0, 3, 6, 2, 1, 0, 2, 3, 4, 2, 6, 3, 0, 6, 1, 6, 6, 2,
-	3, 5, 3, 3, 6, 3, 0, 1, 3, 2, 3, 2, 4, 6, 1, 3, 2, 0, 2, 4,
-	4, 1, 4, 2, 5, 4, 6, 0, 4, 6, 5, 0, 4, 2, 3, 1, 4, 6, 1, 3,
-	5, 2, 4, 2, 1, 5, 3, 1, 1, 0, 5, 1, 6, 2, 2, 6, 4, 6, 5, 4,
-	6, 6, 4, 0, 6, 1, 0, 1, 4, 2, 3, 3, 4, 3, 0, 3, 5, 6, 5, 3,
-	0, 2, 6, 3, 6, 0, 4, 6, 4, 6, 3, 0, 2, 0, 3, 2, 0, 6, 2, 4,
-	1, 4, 6, 3, 1, 2, 6, 1, 2, 0, 6, 5, 1, 3, 2, 1, 4, 0, 4, 2,
-	2, 5, 6, 2, 6, 1, 5, 6, 1, 6, 2, 0, 5, 2, 3, 4, 2, 4, 3, 1,
-	3, 0, 4, 2, 3, 5, 2, 0, 5, 2, 6, 4, 5, 1, 2, 1, 3, 6, 2, 1,
-	4, 0, 1, 0, 5, 0, 2, 4, 2, 4, 6, 0, 4, 3, 6, 2, 6, 5, 3, 2,
-	5, 0, 3, 1, 4, 2, 5, 0, 2, 2, 3, 5, 4, 3, 0, 2, 4, 6, 2, 5,
-	6, 4, 3, 1, 0, 5, 1, 6, 1, 3, 5, 6, 3, 3, 1, 1, 2, 5, 2, 4,
-	0, 2, 6, 1, 5, 3, 5, 0, 4, 0, 3, 1, 3, 4, 6, 2, 0, 1, 0, 4,
-	1, 3, 4, 5, 3, 1, 6, 3, 2, 1, 1, 5, 4, 5, 4, 2, 5, 0, 6, 5,
-	2, 1, 2, 2, 4, 2, 5, 5, 2, 1, 2, 0, 1, 3, 6, 2, 4, 5, 1, 0,
-	3, 5, 2, 0, 6, 2, 1, 5, 2, 5, 6, 2, 6, 2, 0, 4, 0, 6, 6, 2,
-	4, 6, 2, 1, 5, 1, 3, 2, 6, 2, 6, 0, 5, 5, 0, 5, 4, 5, 2, 5,
-	5, 2, 0, 3, 5, 3, 5, 6, 4, 1, 2, 6, 2, 3, 1, 4, 0, 6, 0, 4,
-	6, 5, 4, 0, 2, 3, 4, 1, 6, 4, 6, 3, 1, 3, 0, 3, 3, 2, 6, 2,
-	0, 2, 5, 4, 4, 0, 3, 2, 1, 2, 6, 1, 3, 4, 5, 0, 6, 0, 3, 3,
-	1, 6, 2, 4, 2, 0, 3, 0, 2, 4, 2, 1, 2, 0, 0, 2, 4, 2, 1, 2,
-	2, 6, 3, 2, 0, 5, 4, 1, 0, 4, 2, 4, 1, 5, 1, 1, 5, 0, 6, 3,
-	3, 1, 0, 1, 0, 0, 5, 0, 2, 5, 1, 6, 1, 4, 6, 0, 5, 2, 4, 6,
-	4, 3, 6, 5, 3, 2, 6, 4, 2, 6, 2, 1, 5, 1, 5, 6, 3, 1, 4, 4,
-	5, 3, 4, 0, 1, 0, 4, 5, 0, 1, 5, 4, 0, 3, 2, 3, 2, 4, 3, 1,
-	6, 5, 4, 3, 1, 6, 2, 1, 4, 1, 5, 4, 6, 4, 1, 5, 4, 2, 0, 6,
-	0, 5, 2, 0, 6, 5, 2, 3, 4, 3, 2, 6, 6, 1, 3, 5, 0, 0, 6, 5,
-	1, 1, 3, 1, 2, 3, 0, 4, 2, 1, 6, 2, 6, 3, 4, 5, 2, 1, 4, 6,
-	2, 3, 4, 2, 0, 4, 3, 2, 0, 5, 1, 5, 2, 0, 1, 0, 2, 1, 0, 1,
-	3, 0, 3, 4, 2, 0, 3, 4, 3, 1, 6, 3, 4, 6, 2, 1, 3, 4, 6, 4,
-	4, 6, 1, 3, 0, 2, 3, 2, 3, 4, 6, 5, 3, 2, 4, 2, 1, 5, 0, 5,
-	5, 6, 5, 2, 0, 6, 1, 2, 4, 0, 1, 3, 5, 6, 0, 0, 4, 0, 2, 1,
-	6, 2, 0, 3, 0, 6, 5, 1, 3, 4, 1, 4, 2, 1, 0, 3, 2, 1, 2, 4,
-	0, 3, 2, 5, 3, 1, 0, 5, 6, 3, 6, 0, 2, 1, 5, 6, 0, 4, 0, 4,
-	1, 0, 4, 1, 0, 3, 2, 0, 1, 0, 5, 3, 1, 5, 2, 0, 6, 0, 4, 6,
-	2, 4, 0, 6, 4, 3, 1, 5, 6, 4, 0, 3, 4, 1, 6, 4, 3, 6, 2, 0,
-	3, 1, 5, 5, 0, 6, 0, 6, 0, 5, 0, 0, 6, 5, 0, 6, 1, 4, 2, 6,
-	4, 1, 3, 1, 2, 1, 1, 0, 4, 5, 0, 3, 5, 6, 1, 1, 0, 5, 1, 6,
-	5, 5, 1, 6, 3, 5, 4, 3, 4, 3, 5, 2, 1, 4, 5, 2, 1, 4, 1, 2,
-	6, 5, 1, 0, 4, 0, 6, 5, 5, 6, 3, 2, 1, 4, 0, 5, 3, 0, 6, 5,
-	0, 5, 6, 2, 4, 5, 4, 5, 0, 2, 5, 1, 6, 2, 3, 6, 4, 3, 0, 6,
-	1, 3, 3, 4, 3, 6, 1, 3, 1, 2, 3, 2, 1, 3, 4, 6, 4, 5, 6, 4,
-	2, 4, 1, 1, 6, 6, 1, 5, 4, 1, 1, 2, 1, 3, 1, 6, 3, 0, 2, 3,
-	3, 5, 0, 0, 6, 5, 4, 0, 6, 6, 1, 3, 5, 4, 3, 2, 6, 5, 3, 6,
-	4, 2, 3, 0, 2, 6, 3, 2, 0, 6, 0, 5, 1, 5, 2, 1, 5, 1, 0, 2,
-	5, 1, 0, 6, 0, 3, 2, 5, 6, 4, 5, 2, 0, 1, 5, 6, 1, 0, 5, 2,
-	6, 4, 5, 3, 0, 4, 6, 3, 5, 2, 5, 1, 3, 5, 2, 0, 5, 1, 5, 0,
-	0, 0, 3, 2, 1, 6, 4, 0, 5, 3, 6, 3, 6, 5, 3, 6, 5, 6, 0, 4,
-	1, 4, 6, 1, 5, 1, 3, 2, 6, 3, 2, 4, 0, 4, 5, 0, 6, 0, 2, 4,
-	2, 4, 2, 3, 4, 2, 5, 6, 3, 2, 6, 1, 0, 0, 3, 0, 3, 6, 4, 6,
-	3, 2, 4, 1, 2, 1, 3, 1, 1, 2, 6, 5, 4, 6, 0, 3, 5, 4, 6, 3,
-	4, 0, 4, 0, 6, 4, 3, 6, 5, 3, 5, 4, 1, 6, 0, 5, 6, 2, 1, 5,
-	5, 2, 0, 6, 0, 5, 0, 5, 2, 0, 1, 0, 6, 2, 1, 6, 1, 5, 4, 0,
-	6, 4, 5, 0, 6, 1, 4, 6, 4, 5, 4, 6, 2, 6, 1, 1, 5, 4, 0, 5,
-	0, 5, 2, 0, 6, 2, 5, 0, 3, 5, 0, 3, 4, 3, 0, 6, 0, 3, 2, 4,
-	1, 0, 6, 1, 0, 3, 4, 2, 0, 2, 1, 3, 0, 1, 4, 5, 6, 0, 1, 0,
-	2, 0, 5, 4, 4, 3, 4, 2, 1, 3, 0, 2, 1, 3, 5, 0, 2, 3, 4, 3,
-	3, 6, 4, 6, 1, 5, 4, 4, 6, 1, 5, 1, 4, 5, 4, 3, 1, 1, 5, 2,
-	4, 0, 5, 1, 6, 2, 5, 6, 3, 4, 1, 1, 2, 1, 4, 1, 2, 0, 3, 5,
-	5, 4, 6, 1, 6, 0, 5, 3, 0, 5, 4, 5, 2, 4, 1, 4, 5, 6, 5, 6,
-	6, 1, 5, 1, 0, 1, 6, 4, 1, 6, 1, 4, 0, 4, 5, 1, 0, 4, 3, 5,
-	0, 6, 1, 4, 1, 5, 2, 0, 2, 3, 2, 3, 6, 1, 0, 1, 5, 3, 0, 6,
-	1, 5, 6, 6, 3, 1, 4, 6, 2, 0, 1, 4, 6, 6, 4, 6, 2, 4, 2, 0,
-	2, 1, 4, 1, 2, 2, 1, 3, 4, 3, 1, 2, 1, 4, 5, 0, 5, 0, 0, 5,
-	3, 6, 2, 4, 5, 4, 2, 0, 1, 4, 3, 1, 6, 4, 3, 0, 6, 0, 1, 4,
-	4, 5, 4, 1, 3, 1, 4, 0, 3, 0, 1, 2, 6, 1, 4, 3, 5, 2, 6, 2,
-	5, 4, 6, 1, 2, 0, 3, 1, 6, 3, 2, 5, 0, 1, 6, 0, 2, 5, 1, 4,
-	6, 0, 4, 3, 4, 2, 1, 3, 4, 1, 3, 5, 6, 0, 1, 2, 0, 3, 5, 0,
-	0, 6, 0, 6, 2, 4, 0, 3, 5, 3, 2, 2, 3, 5, 4, 3, 5, 1, 5, 2,
-	1, 3, 1, 4, 6, 3, 6, 0, 3, 2, 3, 6, 4, 6, 1, 1, 2, 0, 0, 2,
-	2, 1, 6, 4, 2, 6, 2, 4, 0, 0, 3, 4, 1, 0, 2, 0, 2, 2, 0, 3,
-	3, 2, 3, 5, 4, 6, 2, 5, 6, 1, 1, 5, 5, 0, 2, 4, 0, 6, 1, 0,
-	4, 6, 3, 6, 4, 5, 1, 4, 1, 4, 5, 4, 6, 0, 4, 2, 4, 0, 2, 3,
-	5, 0, 6, 6, 0, 5, 1, 4, 5, 3, 4, 1, 5, 1, 2, 1, 6, 2, 5, 1,
-	6, 3, 1, 0, 6, 1, 2, 0, 2, 5, 0, 3, 2, 4, 2, 0, 4, 0, 3, 5,
-	0, 6, 2, 5, 1, 5, 1, 3, 6, 2, 0, 3, 0, 2, 6, 4, 3, 1, 2, 3,
-	1, 1, 0, 2, 3, 6, 0, 0, 4, 2, 1, 4, 4, 2, 2, 5, 2, 4, 6, 3,
-	2, 0, 3, 0, 4, 5, 4, 3, 3, 2, 4, 2, 0, 4, 3, 0, 2, 5, 3, 4,
-	3, 2, 1, 4, 2, 0, 4, 2, 6, 5, 2, 3, 1, 5, 3, 0, 2, 4, 1, 4,
-	4, 6, 4, 0, 5, 0, 1, 4, 6, 4, 5, 1, 3, 5, 2, 3, 5, 3, 6, 5,
-	5, 3, 3, 4, 3, 0, 2, 1, 0, 3, 2, 4, 2, 6, 4, 2, 1, 4, 6, 5,
-	6, 4, 2, 1, 0, 6, 3, 2, 0, 4, 2, 3, 1, 3, 1, 2, 0, 6, 3, 5,
-	0, 5, 4, 6, 0, 4, 0, 3, 6, 5, 6, 4, 5, 2, 0, 2, 5, 1, 6, 0,
-	1, 6, 5, 3, 1, 1, 0, 6, 2, 6, 5, 3, 2, 3, 0, 3, 0, 5, 5, 3,
-	2, 4, 2, 6, 3, 3, 0, 6, 1, 4, 3, 2, 6, 6, 5, 2, 4, 1, 0, 2,
-	3, 0, 4, 5, 1, 5, 0, 4, 0, 2, 6, 3, 2, 3, 0, 2, 5, 0, 2, 0,
-	4, 1, 0, 2, 5, 6, 1, 6, 6, 3, 1, 1, 4, 2, 0, 2, 6, 1, 2, 3,
-	5, 4, 0, 6, 4, 1, 0, 4, 5, 1, 0, 4, 1, 3, 4, 6, 3, 5, 6, 2,
-	6, 1, 2, 5, 3, 1, 0, 4, 3, 5, 2, 1, 3, 6, 1, 4, 0, 5, 0, 3,
-	0, 5, 6, 3, 5, 6, 5, 3, 1, 0, 1, 1, 3, 0, 6, 1, 5, 1, 3, 5,
-	1, 3, 2, 1, 3, 6, 6, 5, 1, 2, 6, 2, 1, 5, 4, 0, 1, 4, 6, 1,
-	2, 1, 4, 1, 2, 3, 6, 0, 0, 4, 2, 6, 1, 6, 2, 2, 6, 0, 4, 2,
-	3, 4, 3, 1, 4, 6, 4, 6, 1, 2, 0, 4, 1, 4, 2, 1, 1, 2, 4, 5,
-	4, 2, 0, 3, 6, 5, 6, 0, 3, 5, 2, 5, 0, 5, 3, 2, 4, 3, 1, 2,
-	5, 4, 2, 4, 1, 5, 3, 3, 0, 2, 4, 3, 4, 3, 0, 6, 1, 5, 4, 2,
-	6, 4, 3, 5, 1, 5, 0, 0, 1, 3, 1, 2, 6, 3, 1, 4, 1, 4, 3, 5,
-	0, 4, 0, 2, 2, 4, 5, 0, 3, 1, 2, 5, 2, 4, 2, 2, 4, 0, 2, 0,
-	1, 0, 3, 4, 1, 3, 0, 4, 4, 0, 2, 6, 4, 1, 1, 3, 6, 4, 3, 0,
-	2, 1, 0, 3, 0, 5, 1, 0, 3, 0, 2, 3, 1, 0, 4, 2, 0, 6, 5, 2,
-	3, 6, 3, 6, 1, 2, 6, 5, 0, 4, 2, 1, 1, 2, 0, 5, 1, 0, 5, 0,
-	4, 3, 4, 3, 2, 1, 4, 3, 4, 1, 2, 4, 2, 5, 2, 5, 1, 5, 4, 0,
-	5, 3, 5, 3, 4, 6, 5, 0, 1, 0, 6, 2, 1, 6, 3, 5, 6, 1, 4, 1,
-	6, 5, 1, 5, 6, 0, 3, 5, 2, 1, 5, 2, 1, 0, 0, 3, 2, 6, 5, 2,
-	0, 5, 1, 4, 0, 3, 5, 6, 2, 4, 0, 3, 2, 5, 1, 1, 5, 1, 4, 2,
-	1, 5, 6, 4, 6, 6, 3, 0, 2, 6, 0, 4, 5, 0, 2, 1, 6, 3, 4, 5,
-	2, 1, 1, 0, 3, 6, 2, 4, 0, 2, 0, 6, 3, 3, 1, 3, 2, 5, 6, 1,
-	3, 1, 5, 5, 2, 1, 2, 4, 6, 0, 5, 0, 6, 2, 1, 6, 5, 3, 1, 6,
-	4, 5, 1, 3, 2, 1, 2, 0, 6, 4, 3, 2, 6, 5, 1, 4, 1, 0, 2, 3,
-	5, 6, 3, 4, 6, 4, 3, 6, 5, 1, 3, 4, 3, 4, 6, 5, 0, 1, 6, 0,
-	6, 2, 4, 2, 2, 6, 5, 6, 5, 1, 3, 1, 3, 6, 4, 4, 3, 4, 5, 0,
-	0, 6, 3, 0, 4, 3, 0, 3, 5, 2, 1, 6, 4, 2, 0, 2, 1, 6, 3, 5,
-	1, 0, 2, 3, 6, 2, 0, 5, 2, 0, 2, 6, 2, 4, 5, 4, 3, 4, 6, 5,
-	2, 1, 2, 5, 0, 5, 6, 5, 6, 0, 3, 2, 6, 2, 0, 6, 5, 4, 6, 4,
-	3, 2, 1, 6, 1, 6, 4, 2, 4, 4, 0, 2, 3, 6, 3, 1, 6, 1, 0, 4,
-	4, 6, 3, 2, 2, 1, 0, 6, 3, 2, 4, 6, 0, 4, 0, 0, 6, 4, 1, 4,
-	5, 4, 6, 2, 6, 1, 5, 4, 0, 3, 0, 5, 0, 0, 5, 6, 4, 0, 5, 2,
-	6, 4, 0, 6, 5, 4, 1, 2, 1, 4, 3, 0, 1, 6, 5, 3, 2, 0, 4, 0,
-	0, 4, 3, 1, 6, 0, 4, 3, 0, 4, 3, 2, 4, 5, 3, 6, 2, 6, 2, 0,
-	1, 2, 3, 4, 1, 6, 5, 4, 6, 2, 3, 5, 3, 2, 6, 0, 5, 1, 6, 0,
-	2, 6, 1, 1, 2, 1, 1, 6, 5, 2, 3, 0, 4, 0, 4, 2, 6, 1, 0, 5,
-	3, 5, 1, 0, 1, 2, 1, 6, 2, 0, 3, 2, 0, 1, 5, 6, 3, 0, 6, 3,
-	4, 6, 1, 4, 0, 2, 4, 2, 1, 0, 4, 6, 3, 2, 3, 5, 2, 1, 6, 4,
-	5, 3, 0, 3, 4, 1, 6, 3, 1, 6, 2, 0, 6, 4, 3, 6, 4, 3, 0, 4,
-	6, 3, 0, 6, 1, 4, 3, 0, 1, 0, 5, 1, 0, 3, 2, 0, 0, 1, 6, 6,
-	0, 3, 2, 5, 1, 3, 4, 1, 2, 5, 2, 1, 4, 6, 2, 4, 2, 3, 2, 2,
-	1, 5, 2, 4, 0, 6, 2, 6, 2, 4, 6, 4, 1, 1, 3, 5, 1, 1, 2, 1,
-	2, 3, 2, 0, 4, 3, 1, 2, 0, 1, 6, 5, 1, 4, 1, 1, 6, 0, 3, 0,
-	3, 4, 3, 0, 5, 3, 0, 3, 4, 6, 0, 6, 4, 6, 1, 4, 2, 0, 0, 6,
-	4, 1, 0, 5, 5, 1, 5, 3, 6, 2, 1, 3, 3, 0, 3, 4, 6, 3, 6, 2,
-	5, 1, 2, 5, 3, 4, 5, 1, 0, 5, 3, 1, 5, 1, 6, 3, 0, 1, 1, 2,
-	6, 4, 2, 1, 3, 1, 2, 0, 3, 2, 3, 4, 3, 4, 2, 1, 0, 4, 1, 2,
-	0, 0, 6, 2, 0, 3, 0, 1, 6, 1, 5, 0, 1, 5, 2, 0, 1, 0, 3, 2,
-	1, 4, 5, 1, 2, 6, 5, 3, 1, 6, 3, 4, 5, 2, 5, 3, 5, 2, 0, 2,
-	2, 4, 2, 1, 4, 2, 0, 2, 4, 3, 6, 3, 6, 5, 3, 5, 2, 0, 6, 0,
-	3, 1, 6, 5, 5, 1, 3, 3, 4, 0, 1, 3, 4, 3, 6, 2, 5, 6, 5, 6,
-	4, 6, 5, 1, 4, 3, 4, 1, 3, 2, 3, 4, 3, 2, 1, 4, 0, 2, 6, 2,
-	5, 1, 4, 0, 0, 1, 5, 6, 1, 6, 0, 5, 3, 0, 1, 5, 6, 0, 6, 5,
-	6, 0, 3, 4, 3, 0, 5, 5, 3, 3, 5, 2, 5, 6, 5, 2, 4, 2, 0, 1,
-	0, 3, 0, 1, 0, 3, 5, 2, 4, 3, 6, 1, 3, 4, 5, 6, 3, 4, 6, 6,
-	1, 6, 1, 0, 6, 5, 3, 0, 2, 1, 6, 3, 0, 6, 2, 5, 0, 4, 0, 4,
-	2, 6, 2, 5, 0, 5, 6, 5, 6, 5, 0, 6, 3, 2, 1, 3, 6, 0, 2, 4,
-	3, 5, 0, 5, 1, 6, 4, 3, 2, 5, 3, 5, 1, 4, 5, 0, 4, 2, 0, 5,
-	4, 5, 2, 4, 2, 3, 1, 3, 6, 0, 2, 1, 0, 4, 6, 2, 0, 1, 4, 0,
-	5, 3, 0, 6, 3, 4, 3, 0, 6, 4, 2, 6, 2, 4, 6, 4, 3, 6, 6, 2,
-	6, 0, 1, 6, 3, 5, 2, 3, 5, 6, 2, 4, 1, 4, 6, 2, 5, 3, 6, 4,
-	0, 1, 0, 3, 0, 1, 3, 1, 6, 3, 1, 5, 4, 6, 5, 2, 3, 4, 1, 1,
-	1, 4, 2, 1, 6, 5, 1, 2, 3, 2, 0, 2, 3, 5, 1, 4, 5, 6, 2, 3,
-	2, 3, 5, 1, 5, 4, 1, 6, 4, 5, 6, 3, 5, 4, 1, 5, 1, 4, 1, 5,
-	3, 1, 6, 4, 5, 6, 5, 6, 6, 4, 6, 0, 0, 1, 3, 2, 4, 6, 1, 3,
-	4, 0, 3, 4, 6, 1, 2, 1, 3, 6, 6, 2, 5, 0, 1, 5, 4, 1, 4, 0,
-	5, 6, 2, 1, 2, 1, 2, 4, 3, 1, 5, 4, 5, 6, 5, 2, 6, 6, 0, 1,
-	6, 0, 3, 5, 1, 6, 5, 6, 1, 3, 0, 2, 3, 1, 1, 1, 0, 1, 0, 0,
-	0, 3, 6, 0, 2, 1, 3, 2, 6, 4, 0, 2, 3, 5, 1, 5, 5, 2, 6, 3,
-	1, 5, 6, 0, 4, 2, 1, 3, 4, 1, 6, 0, 3, 2, 5, 4, 6, 1, 0, 4,
-	2, 6, 3, 1, 0, 3, 4, 3, 6, 0, 5, 6, 2, 0, 2, 3, 3, 4, 6, 0,
-	3, 6, 3, 5, 1, 2, 2, 0, 5, 3, 2, 4, 5, 3, 4, 3, 6, 4, 1, 3,
-	4, 1, 6, 3, 1, 4, 6, 0, 6, 2, 5, 4, 2, 3, 0, 2, 1, 3, 1, 2,
-	5, 3, 4, 3, 5, 3, 4, 5, 6, 1, 4, 2, 2, 4, 6, 4, 5, 1, 0, 4,
-	6, 2, 6, 1, 4, 2, 5, 1, 6, 4, 4, 2, 4, 1, 4, 0, 2, 0, 6, 3,
-	0, 5, 2, 3, 5, 2, 6, 4, 6, 5, 6, 6, 3, 0, 5, 1, 2, 6, 1, 2,
-	1, 6, 2, 0, 4, 5, 2, 0, 2, 6, 0, 6, 1, 2, 5, 6, 6, 5, 1, 2,
-	2, 5, 3, 2, 6, 1, 2, 4, 0, 5, 4, 0, 1, 4, 5, 3, 4, 4, 3, 6,
-	3, 6, 4, 0, 2, 6, 1, 5, 6, 1, 5, 1, 0, 1, 3, 1, 0, 6, 4, 3,
-	4, 5, 1, 0, 6, 4, 0, 6, 4, 6, 3, 0, 4, 3, 0, 6, 6, 5, 2, 3,
-	5, 0, 5, 1, 0, 3, 5, 2, 0, 1, 3, 4, 5, 3, 4, 5, 0, 4, 5, 3,
-	6, 0, 2, 0, 3, 0, 0, 5, 1, 2, 4, 4, 1, 1, 3, 1, 6, 5, 6, 1,
-	0, 2, 3, 6, 0, 5, 1, 3, 1, 5, 4, 3, 5, 1, 0, 1, 2, 4, 3, 0,
-	1, 4, 3, 2, 1, 6, 5, 6, 4, 1, 2, 4, 2, 0, 3, 6, 0, 3, 2, 5,
-	2, 0, 1, 3, 0, 2, 5, 3, 4, 2, 6, 3, 4, 6, 0, 0, 1, 2, 3, 5,
-	3, 1, 0, 3, 5, 0, 5, 4, 1, 2, 6, 5, 4, 5, 1, 2, 0, 4, 1, 2,
-	4, 3, 4, 5, 3, 6, 1, 2, 0, 4, 3, 5, 2, 3, 1, 2, 5, 2, 5, 4,
-	5, 4, 6, 0, 2, 1, 6, 0, 5, 4, 2, 5, 1, 3, 5, 2, 5, 1, 0, 2,
-	6, 5, 2, 0, 2, 0, 3, 2, 0, 2, 1, 2, 4, 0, 3, 3, 1, 3, 5, 3,
-	0, 4, 1, 3, 0, 5, 3, 2, 4, 1, 4, 3, 3, 5, 4, 4, 3, 0, 6, 1,
-	1, 2, 5, 1, 6, 1, 2, 3, 4, 2, 6, 5, 2, 0, 2, 0, 1, 0, 2, 1,
-	2, 0, 5, 2, 1, 0, 4, 6, 4, 0, 4, 3, 1, 4, 1, 0, 6, 4, 6, 1,
-	3, 2, 1, 3, 6, 4, 5, 0, 2, 0, 1, 3, 2, 1, 6, 2, 5, 1, 5, 0,
-	4, 6, 2, 1, 6, 3, 2, 3, 0, 4, 2, 0, 4, 1, 6, 5, 2, 3, 1, 6,
-	5, 2, 4, 6, 2, 6, 5, 0, 5, 1, 4, 1, 5, 5, 1, 0, 5, 0, 6, 1,
-	6, 5, 0, 2, 3, 1, 6, 3, 0, 5, 0, 3, 2, 0, 5, 0, 1, 3, 0, 4,
-	0, 0, 6, 4, 5, 4, 2, 0, 4, 1, 5, 1, 6, 0, 1, 0, 1, 4, 6, 0,
-	1, 0, 4, 0, 2, 0, 6, 4, 5, 1, 4, 0, 2, 3, 2, 5, 6, 0, 6, 2,
-	2, 5, 6, 4, 2, 4, 0, 0, 5, 6, 3, 0, 5, 2, 5, 6, 5, 2, 2, 3,
-	3, 5, 3, 3, 3, 2, 6, 3, 1, 3, 5, 1, 5, 0, 4, 2, 3, 6, 4, 3,
-	4, 0, 2, 4, 0, 3, 0, 2, 6, 1, 5, 1, 2, 1, 4, 1, 2, 4, 1, 5,
-	5, 4, 1, 6, 2, 5, 6, 5, 1, 6, 2, 1, 3, 6, 4, 6, 1, 4, 0, 3,
-	6, 5, 6, 6, 1, 0, 6, 2, 5, 0, 4, 5, 4, 1, 2, 4, 2, 2, 3, 1,
-	0, 4, 2, 1, 2, 2, 0, 1, 3, 4, 6, 0, 4, 3, 0, 4, 5, 3, 5, 3,
-	1, 0, 6, 2, 0, 5, 1, 4, 2, 5, 3, 1, 3, 3, 0, 4, 0, 5, 2, 3,
-	2, 0, 1, 2, 3, 6, 3, 2, 3, 1, 2, 5, 2, 2, 3, 0, 5, 2, 6, 2,
-	3, 2, 5, 2, 1, 3, 0, 1, 5, 1, 6, 4, 3, 2, 3, 2, 5, 2, 5, 6,
-	4, 3, 6, 3, 4, 2, 3, 2, 3, 5, 0, 1, 6, 4, 2, 0, 0, 3, 6, 4,
-	5, 3, 3, 2, 3, 6, 2, 5, 6, 0, 6, 4, 4, 1, 3, 6, 3, 1, 4, 2,
-	6, 4, 1, 4, 2, 1, 4, 5, 1, 3, 6, 1, 2, 1, 2, 4, 1, 3, 1, 6,
-	0, 0, 4, 0, 6, 3, 6, 4, 1, 2, 5, 0, 2, 6, 0, 0, 3, 2, 1, 3,
-	1, 2, 6, 1, 0, 5, 0, 1, 2, 4, 2, 4, 5, 4, 1, 1, 2, 6, 5, 1,
-	2, 0, 0, 4, 5, 4, 3, 4, 1, 2, 3, 4, 0, 5, 2, 3, 3, 0, 5, 4,
-	3, 1, 5, 1, 4, 6, 1, 3, 6, 5, 6, 1, 4, 0, 4, 5, 0, 6, 4, 6,
-	4, 5, 0, 1, 4, 1, 5, 6, 5, 1, 0, 1, 4, 1, 1, 4, 0, 2, 2, 3,
-	5, 4, 3, 5, 1, 5, 2, 4, 3, 1, 2, 0, 6, 0, 1, 2, 1, 3, 6, 1,
-	6, 4, 5, 1, 0, 5, 0, 3, 6, 3, 2, 5, 0, 3, 3, 6, 3, 0, 0, 3,
-	0, 2, 2, 3, 1, 6, 2, 1, 3, 6, 4, 3, 2, 0, 4, 3, 2, 0, 2, 4,
-	1, 6, 5, 3, 0, 3, 1, 6, 1, 4, 0, 6, 4, 6, 2, 4, 6, 0, 1, 3,
-	2, 0, 1, 1, 0, 6, 4, 3, 2, 4, 4, 5, 4, 2, 4, 1, 3, 1, 2, 2,
-	3, 6, 2, 6, 2, 2, 0, 6, 3, 5, 0, 1, 2, 1, 2, 5, 3, 4, 5, 1,
-	4, 5, 2, 0, 2, 4, 1, 5, 2, 1, 3, 5, 1, 2, 6, 5, 2, 0, 3, 3,
-	5, 4, 5, 1, 6, 3, 4, 0, 4, 0, 4, 2, 6, 6, 4, 1, 5, 6, 2, 1,
-	6, 3, 5, 2, 6, 3, 0, 5, 6, 2, 4, 1, 3, 1, 6, 4, 0, 4, 2, 0,
-	0, 6, 2, 0, 6, 2, 0, 6, 3, 1, 6, 2, 3, 0, 4, 5, 0, 5, 0, 6,
-	1, 3, 5, 2, 6, 4, 1, 6, 0, 4, 1, 4, 2, 4, 5, 0, 6, 0, 2, 1,
-	2, 4, 2, 6, 1, 0, 5, 3, 1, 1, 0, 2, 0, 5, 4, 5, 1, 3, 5, 6,
-	3, 2, 1, 5, 1, 4, 2, 0, 4, 1, 2, 1, 0, 3, 4, 1, 2, 4, 6, 4,
-	4, 2, 4, 6, 1, 3, 1, 4, 3, 5, 4, 0, 3, 2, 5, 1, 1, 0, 6, 4,
-	5, 4, 1, 4, 6, 5, 0, 2, 0, 3, 1, 0, 3, 0, 1, 3, 5, 1, 3, 2,
-	6, 2, 6, 5, 0, 6, 0, 6, 1, 5, 2, 4, 4, 3, 2, 6, 2, 4, 6, 4,
-	0, 2, 3, 6, 2, 4, 2, 2, 3, 6, 1, 4, 5, 0, 1, 2, 6, 3, 1, 0,
-	1, 5, 6, 3, 4, 1, 6, 2, 4, 1, 3, 1, 4, 6, 2, 0, 4, 3, 0, 2,
-	2, 3, 3, 5, 6, 3, 2, 0, 4, 2, 0, 4, 2, 2, 0, 1, 5, 3, 6, 3,
-	3, 2, 2, 6, 2, 4, 5, 1, 4, 0, 4, 6, 0, 6, 2, 6, 4, 5, 2, 0,
-	4, 3, 6, 4, 5, 4, 6, 2, 3, 3, 1, 5, 3, 0, 3, 5, 2, 3, 1, 2,
-	5, 2, 6, 0, 6, 2, 0, 4, 4, 5, 0, 4, 5, 3, 4, 3, 1, 5, 1, 2,
-	6, 0, 2, 4, 5, 6, 5, 5, 1, 6, 5, 4, 0, 4, 2, 5, 0, 3, 1, 4,
-	0, 5, 0, 3, 5, 4, 6, 1, 5, 2, 3, 6, 4, 2, 1, 3, 2, 1, 5, 1,
-	1, 5, 3, 5, 0, 6, 3, 2, 6, 4, 3, 4, 1, 1, 6, 5, 4, 3, 5, 1,
-	2, 0, 4, 0, 2, 2, 1, 3, 5, 1, 0, 4, 5, 2, 3, 4, 3, 0, 1, 2,
-	3, 3, 5, 1, 3, 6, 2, 5, 1, 2, 3, 5, 2, 3, 6, 3, 0, 1, 6, 2,
-	4, 5, 6, 3, 0, 6, 1, 4, 6, 4, 0, 4, 6, 5, 3, 5, 4, 3, 6, 1,
-	5, 1, 3, 5, 4, 2, 5, 2, 0, 2, 4, 0, 3, 0, 3, 2, 1, 5, 0, 6,
-	6, 3, 4, 3, 0, 5, 0, 0, 1, 6, 0, 3, 4, 6, 1, 3, 2, 5, 4, 1,
-	0, 6, 0, 6, 0, 6, 5, 4, 3, 4, 2, 0, 6, 1, 0, 3, 5, 0, 0, 6,
-	1, 0, 4, 5, 1, 6, 1, 4, 2, 1, 2, 6, 3, 4, 3, 1, 2, 0, 5, 1,
-	2, 1, 6, 5, 1, 3, 6, 5, 2, 1, 6, 3, 5, 6, 0, 2, 6, 0, 1, 5,
-	3, 4, 1, 4, 3, 1, 1, 0, 4, 3, 3, 1, 0, 2, 1, 3, 4, 6, 0, 1,
-	4, 1, 6, 0, 6, 5, 4, 5, 1, 0, 2, 3, 0, 2, 6, 4, 1, 2, 6, 3,
-	5, 1, 4, 0, 2, 6, 0, 6, 5, 2, 4, 4, 1, 3, 2, 4, 3, 6, 0, 1,
-	6, 0, 6, 1, 2, 0, 4, 1, 4, 5, 4, 2, 2, 1, 4, 0, 3, 0, 6, 2,
-	0, 3, 3, 6, 1, 5, 2, 1, 0, 3, 4, 0, 4, 1, 2, 3, 0, 4, 6, 0,
-	1, 6, 0, 6, 1, 0, 2, 2, 5, 6, 1, 0, 6, 5, 3, 0, 6, 5, 3, 1,
-	2, 0, 6, 3, 1, 1, 5, 6, 3, 6, 4, 2, 3, 4, 6, 5, 0, 1, 3, 3,
-	3, 0, 0, 6, 1, 2, 3, 6, 5, 6, 2, 4, 6, 2, 5, 0, 4, 6, 2, 4,
-	4, 0, 2, 0, 4, 2, 4, 6, 1, 3, 6, 0, 4, 2, 6, 3, 0, 3, 6, 2,
-	5, 0, 6, 4, 0, 2, 0, 3, 5, 0, 3, 5, 6, 4, 2, 0, 4, 3, 2, 0,
-	6, 2, 0, 3, 1, 0, 5, 1, 6, 4, 6, 3, 6, 5, 4, 2, 1, 5, 4, 1,
-	0, 4, 5, 4, 0, 1, 4, 6, 4, 0, 5, 4, 3, 0, 3, 4, 1, 1, 2, 3,
-	1, 6, 0, 2, 0, 2, 5, 6, 0, 0, 3, 1, 5, 1, 3, 6, 5, 1, 2, 1,
-	2, 6, 1, 1, 5, 3, 1, 6, 1, 3, 6, 3, 1, 2, 4, 6, 0, 0, 5, 5,
-	3, 6, 2, 3, 6, 2, 4, 1, 3, 6, 5, 6, 2, 5, 3, 2, 0, 1, 5, 1,
-	4, 1, 4, 2, 6, 4, 5, 2, 4, 3, 6, 3, 2, 3, 2, 0, 5, 0, 6, 0,
-	5, 4, 1, 2, 6, 3, 0, 4, 5, 4, 1, 0, 2, 3, 3, 0, 5, 3, 4, 5,
-	6, 4, 2, 1, 0, 1, 4, 5, 2, 2, 0, 3, 6, 3, 1, 2, 0, 1, 4, 1,
-	0, 6, 1, 0, 3, 6, 1, 6, 2, 4, 3, 2, 0, 5, 0, 2, 0, 4, 5, 2,
-	1, 6, 3, 4, 1, 0, 1, 5, 1, 4, 1, 2, 6, 1, 5, 3, 2, 6, 1, 5,
-	2, 6, 3, 6, 1, 3, 1, 4, 0, 5, 6, 2, 1, 4, 2, 4, 6, 5, 4, 3,
-	3, 3, 4, 1, 0, 6, 2, 3, 0, 1, 4, 6, 3, 2, 3, 1, 2, 3, 6, 0,
-	4, 4, 2, 0, 6, 3, 4, 0, 2, 4, 6, 2, 4, 6, 5, 4, 2, 0, 1, 4,
-	5, 1, 3, 2, 3, 2, 3, 6, 5, 0, 4, 3, 3, 2, 6, 4, 3, 6, 3, 4,
-	6, 5, 1, 5, 0, 1, 6, 4, 1, 3, 0, 4, 2, 4, 3, 5, 1, 0, 1, 5,
-	0, 2, 0, 2, 6, 2, 6, 2, 3, 1, 4, 5, 1, 1, 0, 5, 3, 6, 1, 4,
-	1, 4, 1, 1, 3, 2, 3, 4, 5, 6, 4, 0, 1, 1, 6, 2, 4, 3, 4, 6,
-	2, 2, 5, 1, 2, 4, 5, 1, 6, 5, 0, 6, 5, 4, 3, 1, 3, 0, 0, 0,
-	3, 0, 4, 2, 0, 1, 2, 4, 0, 6, 0, 3, 6, 2, 3, 2, 4, 5, 0, 2,
-	4, 5, 3, 5, 2, 3, 2, 5, 1, 3, 5, 6, 2, 5, 3, 4, 5, 2, 4, 2,
-	5, 0, 6, 0, 4, 0, 4, 1, 0, 5, 1, 0, 1, 6, 0, 5, 3, 2, 6, 5,
-	6, 5, 3, 4, 2, 4, 5, 3, 2, 0, 6, 0, 4, 6, 2, 1, 6, 4, 0, 3,
-	0, 2, 6, 2, 0, 3, 1, 5, 4, 6, 0, 3, 5, 0, 6, 1, 6, 3, 6, 1,
-	1, 1, 1, 0, 5, 0, 2, 3, 2, 4, 6, 0, 4, 6, 4, 2, 1, 4, 6, 5,
-	2, 0, 1, 4, 0, 6, 4, 1, 1, 5, 3, 3, 3, 5, 6, 0, 6, 3, 4, 1,
-	3, 1, 3, 4, 2, 4, 4, 3, 0, 4, 5, 3, 5, 4, 6, 3, 0, 6, 0, 5,
-	4, 4, 1, 2, 4, 6, 1, 4, 1, 2, 0, 2, 5, 2, 6, 3, 1, 2, 6, 0,
-	5, 2, 1, 6, 5, 0, 4, 5, 2, 5, 2, 4, 5, 1, 3, 1, 2, 1, 3, 2,
-	6, 2, 3, 0, 4, 5, 3, 6, 5, 1, 2, 6, 2, 1, 4, 3, 6, 2, 6, 3,
-	0, 4, 6, 4, 2, 6, 1, 6, 0, 5, 1, 0, 5, 6, 4, 6, 1, 4, 3, 1,
-	1, 5, 6, 2, 3, 2, 0, 5, 0, 5, 0, 5, 2, 4, 0, 5, 1, 1, 5, 1,
-	2, 0, 2, 4, 6, 5, 4, 0, 6, 2, 5, 6, 5, 0, 1, 3, 0, 2, 0, 1,
-	3, 6, 1, 2, 3, 5, 2, 3, 6, 0, 0, 5, 2, 4, 1, 0, 6, 1, 6, 4,
-	4, 0, 5, 5, 6, 5, 2, 6, 6, 2, 4, 0, 6, 1, 6, 5, 6, 5, 4, 5,
-	5, 6, 2, 4, 3, 4, 3, 1, 0, 6, 1, 3, 3, 2, 1, 4, 1, 4, 0, 3,
-	6, 4, 6, 5, 6, 5, 5, 1, 0, 1, 6, 5, 6, 0, 3, 4, 0, 4, 6, 2,
-	0, 2, 0, 2, 3, 5, 6, 1, 6, 2, 3, 2, 0, 1, 0, 4, 2, 6, 2, 0,
-	1, 3, 2, 4, 1, 6, 3, 1, 6, 0, 5, 0, 6, 5, 6, 0, 3, 0, 5, 4,
-	2, 6, 0, 1, 4, 0, 4, 5, 6, 4, 2, 0, 3, 2, 5, 4, 0, 2, 6, 2,
-	3, 0, 5, 3, 6, 1, 0, 3, 6, 3, 5, 6, 5, 0, 1, 4, 5, 6, 2, 5,
-	4, 3, 5, 1, 6, 3, 0, 5, 0, 1, 2, 4, 4, 1, 0, 3, 6, 5, 4, 6,
-	5, 3, 4, 0, 3, 1, 6, 5, 0, 5, 0, 6, 2, 1, 5, 2, 6, 4, 5, 4,
-	6, 4, 5, 1, 6, 2, 1, 5, 5, 3, 4, 1, 5, 2, 4, 5, 3, 2, 1, 4,
-	0, 6, 0, 1, 4, 5, 3, 0, 2, 1, 1, 3, 1, 6, 0, 2, 4, 5, 2, 3,
-	1, 6, 4, 0, 5, 2, 6, 1, 2, 0, 2, 4, 5, 3, 6, 0, 5, 4, 3, 1,
-	2, 6, 3, 6, 0, 4, 2, 4, 2, 2, 3, 0, 6, 1, 6, 4, 0, 3, 6, 5,
-	3, 0, 2, 3, 0, 1, 4, 6, 0, 5, 1, 4, 2, 3, 5, 6, 1, 4, 2, 6,
-	4, 0, 4, 2, 2, 6, 4, 6, 1, 1, 3, 0, 1, 3, 1, 6, 5, 3, 5, 0,
-	5, 0, 3, 1, 1, 2, 5, 0, 1, 5, 1, 3, 1, 3, 2, 6, 1, 4, 0, 3,
-	6, 5, 2, 4, 1, 5, 4, 5, 1, 0, 6, 2, 6, 3, 3, 4, 3, 1, 2, 6,
-	0, 4, 2, 0, 6, 2, 3, 2, 5, 0, 1, 3, 2, 0, 6, 3, 4, 1, 4, 2,
-	1, 6, 2, 4, 2, 4, 5, 2, 4, 5, 0, 2, 6, 4, 2, 1, 3, 1, 0, 3,
-	2, 3, 1, 4, 2, 6, 3, 1, 5, 0, 3, 0, 1, 1, 2, 4, 2, 4, 2, 0,
-	3, 2, 6, 5, 0, 5, 1, 6, 2, 1, 3, 2, 4, 2, 4, 6, 3, 2, 4, 3,
-	4, 0, 5, 1, 6, 4, 5, 3, 1, 2, 0, 5, 0, 1, 0, 2, 5, 3, 4, 5,
-	5, 0, 1, 3, 1, 6, 1, 3, 6, 5, 4, 1, 0, 1, 5, 2, 3, 0, 5, 1,
-	6, 4, 0, 4, 3, 4, 3, 1, 5, 1, 0, 6, 2, 2, 0, 2, 0, 0, 1, 0,
-	0, 2, 0, 6, 3, 5, 4, 2, 2, 3, 0, 2, 6, 5, 0, 4, 6, 6, 0, 3,
-	1, 6, 5, 6, 0, 3, 1, 5, 3, 0, 3, 1, 3, 4, 2, 3, 5, 0, 6, 2,
-	2, 3, 5, 3, 3, 4, 2, 3, 0, 5, 4, 5, 0, 1, 2, 4, 1, 3, 6, 0,
-	3, 2, 4, 1, 0, 6, 3, 2, 1, 5, 4, 6, 2, 1, 3, 0, 6, 5, 0, 4,
-	4, 1, 4, 0, 6, 1, 6, 0, 6, 2, 6, 1, 5, 5, 6, 0, 4, 1, 6, 4,
-	5, 1, 4, 6, 0, 4, 2, 6, 1, 1, 0, 3, 1, 6, 1, 4, 3, 1, 2, 3,
-	6, 4, 1, 0, 2, 1, 4, 6, 5, 4, 0, 3, 5, 5, 1, 2, 4, 5, 0, 2,
-	0, 1, 4, 0, 1, 1, 6, 2, 6, 0, 4, 6, 4, 1, 4, 6, 3, 1, 0, 2,
-	1, 3, 1, 6, 0, 5, 4, 3, 0, 3, 6, 5, 1, 5, 1, 3, 0, 4, 0, 6,
-	2, 0, 2, 0, 6, 1, 5, 2, 1, 1, 2, 3, 5, 4, 0, 4, 3, 1, 4, 6,
-	3, 3, 2, 4, 0, 3, 4, 3, 5, 2, 1, 2, 0, 3, 2, 5, 2, 0, 3, 2,
-	4, 4, 5, 3, 0, 4, 5, 0, 6, 5, 3, 2, 1, 4, 1, 5, 2, 1, 1, 2,
-	5, 4, 0, 4, 3, 3, 6, 2, 3, 0, 4, 5, 2, 0, 6, 1, 0, 5, 3, 1,
-	6, 0, 4, 3, 6, 5, 1, 2, 5, 1, 2, 2, 4, 0, 3, 4, 2, 0, 1, 2,
-	0, 5, 6, 2, 0, 2, 1, 6, 2, 5, 1, 0, 2, 1, 3, 6, 4, 5, 4, 2,
-	1, 2, 1, 6, 2, 3, 6, 4, 1, 5, 0, 4, 6, 5, 2, 1, 2, 1, 2, 1,
-	2, 1, 5, 2, 4, 1, 2, 0, 1, 1, 1, 0, 5, 2, 6, 1, 6, 2, 0, 6,
-	3, 2, 5, 2, 6, 0, 2, 0, 4, 0, 3, 4, 5, 2, 1, 4, 0, 5, 2, 1,
-	4, 0, 6, 5, 3, 1, 4, 1, 0, 3, 4, 1, 6, 4, 0, 2, 3, 5, 1, 2,
-	5, 4, 6, 5, 1, 5, 4, 5, 1, 6, 3, 5, 2, 3, 3, 4, 1, 0, 5, 3,
-	6, 0, 2, 4, 5, 6, 1, 6, 3, 4, 3, 6, 0, 1, 4, 0, 1, 4, 6, 3,
-	0, 3, 1, 4, 2, 3, 6, 4, 2, 0, 4, 3, 2, 3, 6, 4, 1, 6, 4, 2,
-	1, 5, 2, 4, 1, 0, 2, 0, 1, 0, 3, 4, 2, 0, 1, 3, 1, 6, 3, 6,
-	2, 1, 6, 4, 5, 1, 4, 1, 0, 4, 6, 1, 4, 6, 2, 2, 5, 0, 5, 0,
-	3, 6, 3, 5, 3, 1, 0, 4, 6, 1, 1, 3, 0, 1, 0, 1, 2, 5, 0, 4,
-	4, 3, 1, 5, 0, 2, 4, 1, 4, 3, 0, 3, 5, 3, 5, 0, 4, 1, 5, 6,
-	5, 4, 1, 6, 3, 6, 3, 4, 1, 4, 3, 6, 4, 2, 1, 2, 5, 2, 4, 3,
-	6, 5, 1, 1, 1, 4, 1, 2, 0, 2, 1, 4, 1, 4, 2, 6, 1, 4, 0, 1,
-	0, 5, 1, 0, 4, 6, 2, 5, 2, 5, 2, 0, 3, 2, 1, 0, 5, 2, 0, 4,
-	1, 0, 5, 2, 4, 6, 2, 5, 2, 6, 0, 2, 6, 0, 3, 0, 2, 3, 4, 0,
-	2, 3, 5, 6, 5, 0, 3, 5, 0, 2, 6, 0, 4, 0, 5, 0, 5, 1, 6, 2,
-	3, 6, 5, 6, 2, 1, 4, 2, 6, 5, 4, 3, 6, 1, 1, 2, 4, 2, 4, 2,
-	4, 5, 4, 2, 4, 3, 0, 4, 3, 4, 0, 0, 6, 5, 3, 0, 5, 6, 4, 3,
-	5, 6, 5, 2, 5, 2, 3, 5, 1, 5, 1, 6, 3, 2, 5, 6, 5, 3, 2, 4,
-	6, 2, 6, 4, 5, 4, 3, 3, 0, 1, 5, 1, 0, 4, 1, 4, 6, 3, 6, 1,
-	0, 1, 3, 5, 3, 4, 3, 2, 4, 5, 6, 5, 3, 1, 2, 0, 2, 3, 0, 5,
-	1, 2, 4, 3, 5, 1, 0, 3, 5, 2, 6, 5, 3, 5, 1, 1, 6, 0, 5, 1,
-	2, 3, 4, 3, 4, 2, 1, 0, 1, 2, 3, 6, 0, 2, 4, 3, 1, 4, 5, 0,
-	3, 0, 0, 3, 5, 1, 4, 5, 3, 3, 5, 2, 3, 5, 4, 1, 3, 2, 2, 5,
-	4, 0, 5, 0, 5, 0, 5, 1, 1, 3, 0, 4, 2, 0, 3, 0, 6, 2, 3, 4,
-	5, 0, 2, 0, 4, 2, 3, 6, 2, 1, 3, 5, 5, 2, 5, 6, 0, 6, 4, 4,
-	6, 3, 6, 1, 5, 0, 1, 1, 0, 5, 1, 3, 6, 1, 3, 2, 5, 4, 0, 6,
-	0, 0, 6, 1, 5, 3, 0, 3, 5, 6, 5, 6, 1, 6, 5, 2, 5, 3, 6, 3,
-	1, 6, 4, 4, 2, 3, 4, 6, 0, 2, 0, 5, 1, 5, 6, 1, 6, 4, 5, 4,
-	2, 0, 5, 4, 0, 2, 0, 5, 4, 3, 2, 5, 1, 0, 4, 6, 0, 5, 4, 6,
-	3, 6, 1, 4, 1, 6, 0, 5, 1, 5, 6, 4, 6, 6, 6, 0, 2, 6, 1, 2,
-	4, 0, 2, 2, 0, 4, 4, 1, 3, 6, 1, 4, 5, 3, 0, 5, 3, 1, 3, 6,
-	5, 1, 6, 5, 2, 1, 0, 2, 5, 2, 4, 1, 5, 1, 2, 6, 3, 5, 2, 3,
-	6, 3, 1, 0, 6, 1, 6, 3, 0, 1, 6, 3, 4, 2, 6, 5, 2, 1, 6, 3,
-	0, 5, 1, 0, 2, 4, 2, 6, 0, 1, 5, 2, 0, 5, 0, 5, 1, 6, 3, 4,
-	1, 4, 1, 0, 5, 1, 5, 1, 4, 3, 2, 5, 0, 2, 3, 6, 2, 5, 1, 4,
-	2, 5, 2, 5, 1, 2, 6, 4, 0, 6, 3, 2, 5, 5, 4, 5, 0, 3, 4, 2,
-	3, 1, 3, 6, 4, 0, 2, 5, 3, 4, 2, 3, 3, 1, 6, 0, 1, 5, 2, 1,
-	4, 3, 5, 0, 2, 0, 5, 3, 2, 4, 1, 3, 0, 3, 5, 4, 4, 0, 1, 2,
-	5, 6, 5, 0, 6, 6, 1, 6, 1, 1, 6, 1, 6, 2, 6, 3, 3, 2, 5, 3,
-	6, 3, 0, 1, 0, 1, 6, 6, 1, 6, 1, 5, 3, 1, 5, 3, 1, 1, 6, 1,
-	0, 5, 1, 5, 3, 6, 5, 4, 5, 3, 6, 4, 3, 6, 1, 0, 4, 3, 1, 3,
-	1, 6, 2, 0, 3, 0, 6, 4, 3, 6, 0, 4, 6, 3, 1, 5, 6, 0, 5, 4,
-	2, 5, 4, 2, 3, 1, 2, 5, 0, 6, 4, 3, 0, 1, 6, 0, 6, 6, 5, 6,
-	3, 6, 3, 6, 0, 5, 6, 4, 5, 2, 1, 3, 6, 3, 4, 3, 1, 1, 3, 2,
-	4, 3, 5, 6, 4, 3, 3, 6, 1, 5, 4, 5, 1, 4, 0, 6, 6, 1, 2, 0,
-	5, 4, 1, 6, 2, 6, 2, 4, 2, 4, 1, 4, 0, 6, 5, 4, 1, 6, 1, 0,
-	6, 2, 4, 6, 1, 0, 2, 1, 1, 6, 4, 3, 5, 5, 4, 0, 1, 0, 5, 0,
-	0, 4, 5, 4, 6, 0, 1, 3, 3, 1, 3, 5, 0, 2, 6, 2, 4, 1, 2, 3,
-	1, 4, 5, 4, 6, 1, 3, 2, 1, 6, 3, 2, 1, 4, 6, 5, 6, 5, 3, 5,
-	2, 6, 1, 1, 2, 4, 2, 6, 4, 2, 3, 1, 0, 5, 0, 0, 5, 1, 4, 3,
-	3, 1, 2, 1, 2, 5, 3, 1, 2, 1, 6, 0, 6, 2, 0, 2, 0, 6, 5, 1,
-	4, 0, 2, 1, 6, 4, 2, 2, 3, 0, 6, 0, 4, 6, 3, 1, 5, 0, 3, 1,
-	5, 4, 0, 2, 3, 4, 5, 6, 2, 1, 6, 6, 3, 6, 1, 4, 5, 2, 4, 6,
-	6, 1, 3, 2, 6, 0, 2, 1, 0, 0, 1, 0, 4, 2, 5, 5, 1, 2, 5, 3,
-	0, 3, 5, 3, 1, 2, 6, 5, 4, 2, 0, 4, 5, 1, 4, 5, 0, 3, 6, 4,
-	1, 0, 1, 0, 4, 2, 5, 6, 2, 3, 1, 0, 1, 3, 1, 4, 2, 0, 5, 6,
-	2, 0, 2, 1, 0, 3, 4, 6, 1, 5, 4, 3, 5, 1, 4, 1, 6, 1, 0, 2,
-	3, 0, 0, 4, 5, 6, 4, 5, 6, 0, 2, 4, 5, 0, 5, 6, 5, 6, 3, 0,
-	4, 1, 0, 6, 4, 3, 1, 0, 2, 1, 4, 6, 1, 4, 2, 4, 1, 2, 4, 3,
-	5, 1, 2, 0, 2, 1, 5, 1, 3, 5, 4, 4, 3, 1, 4, 0, 5, 1, 2, 1,
-	6, 1, 4, 1, 2, 1, 5, 4, 5, 1, 0, 3, 2, 0, 3, 6, 1, 0, 6, 1,
-	0, 4, 5, 3, 4, 6, 5, 4, 0, 3, 2, 5, 1, 6, 4, 5, 2, 4, 5, 2,
-	1, 4, 2, 1, 5, 1, 5, 6, 4, 0, 1, 5, 4, 0, 2, 3, 4, 2, 0, 4,
-	2, 6, 2, 6, 1, 4, 5, 2, 5, 1, 2, 5, 0, 3, 5, 2, 1, 1, 3, 2,
-	3, 2, 6, 1, 0, 4, 3, 0, 3, 5, 1, 6, 2, 3, 6, 5, 6, 3, 3, 4,
-	4, 1, 3, 5, 3, 2, 6, 5, 2, 6, 4, 6, 2, 0, 2, 5, 2, 5, 0, 0,
-	5, 1, 4, 3, 6, 0, 3, 0, 6, 5, 3, 2, 4, 0, 6, 2, 1, 0, 2, 2,
-	6, 0, 6, 2, 3, 6, 0, 2, 1, 0, 2, 6, 2, 5, 4, 5, 4, 6, 5, 2,
-	0, 5, 4, 6, 0, 3, 0, 4, 2, 4, 1, 3, 1, 3, 5, 0, 2, 6, 6, 2,
-	1, 1, 4, 1, 2, 1, 0, 1, 6, 5, 6, 2, 5, 6, 2, 0, 6, 1, 4, 2,
-	2, 0, 2, 0, 2, 0, 3, 0, 6, 5, 0, 1, 2, 1, 2, 6, 0, 1, 2, 5,
-	3, 6, 5, 6, 0, 3, 5, 0, 6, 5, 0, 4, 6, 1, 2, 3, 0, 3, 1, 5,
-	4, 3, 4, 2, 5, 1, 5, 6, 3, 0, 2, 0, 3, 2, 4, 6, 3, 2, 4, 3,
-	5, 6, 5, 2, 5, 6, 2, 0, 5, 3, 5, 3, 0, 1, 2, 6, 2, 1, 5, 3,
-	6, 0, 2, 3, 1, 2, 1, 2, 3, 3, 1, 3, 2, 3, 0, 1, 0, 4, 2, 0,
-	0, 1, 4, 2, 1, 0, 4, 2, 5, 3, 4, 5, 6, 0, 4, 2, 4, 3, 5, 5,
-	1, 0, 2, 5, 3, 5, 1, 5, 1, 2, 3, 5, 0, 3, 6, 3, 6, 1, 4, 5,
-	2, 0, 6, 5, 0, 0, 6, 5, 3, 1, 3, 6, 4, 0, 4, 0, 4, 3, 1, 1,
-	3, 0, 6, 0, 6, 3, 6, 3, 5, 2, 0, 1, 5, 1, 6, 4, 1, 6, 2, 4,
-	4, 1, 6, 1, 5, 0, 2, 1, 3, 4, 2, 4, 1, 4, 0, 6, 1, 0, 0, 4,
-	5, 3, 3, 0, 5, 0, 4, 3, 4, 6, 1, 5, 2, 4, 2, 1, 5, 0, 4, 2,
-	6, 4, 0, 5, 6, 4, 0, 5, 6, 4, 0, 5, 0, 1, 1, 6, 4, 2, 1, 2,
-	0, 2, 4, 0, 3, 5, 0, 6, 6, 3, 1, 3, 4, 0, 5, 3, 3, 5, 6, 5,
-	1, 3, 0, 3, 0, 3, 1, 6, 6, 5, 3, 0, 6, 5, 0, 3, 2, 6, 2, 3,
-	2, 1, 4, 1, 0, 2, 3, 5, 5, 4, 2, 3, 1, 0, 6, 1, 2, 4, 0, 2,
-	3, 1, 2, 1, 6, 1, 2, 6, 5, 1, 0, 6, 5, 3, 1, 5, 6, 5, 4, 2,
-	4, 2, 0, 1, 0, 4, 5, 2, 2, 6, 5, 3, 0, 6, 1, 4, 3, 5, 1, 6,
-	5, 0, 3, 2, 5, 4, 5, 2, 1, 4, 3, 5, 4, 2, 6, 0, 2, 1, 0, 0,
-	6, 3, 5, 0, 3, 5, 6, 1, 4, 2, 3, 1, 0, 6, 3, 6, 4, 6, 3, 2,
-	0, 1, 6, 5, 1, 0, 2, 1, 0, 1, 6, 1, 5, 0, 4, 1, 6, 5, 0, 1,
-	1, 0, 5, 1, 5, 2, 4, 0, 4, 6, 1, 3, 6, 4, 0, 4, 2, 4, 0, 1,
-	2, 1, 2, 1, 6, 3, 4, 0, 6, 1, 6, 5, 2, 6, 4, 3, 0, 1, 5, 0,
-	3, 5, 2, 5, 4, 4, 5, 3, 4, 3, 2, 1, 3, 5, 5, 0, 3, 1, 1, 4,
-	4, 6, 4, 0, 2, 3, 2, 4, 2, 0, 2, 1, 2, 6, 0, 6, 1, 0, 5, 2,
-	5, 3, 6, 4, 3, 0, 5, 6, 5, 6, 2, 6, 1, 0, 6, 1, 3, 2, 5, 2,
-	6, 0, 4, 3, 0, 6, 3, 2, 3, 6, 4, 5, 2, 3, 4, 1, 3, 6, 0, 5,
-	0, 6, 2, 1, 0, 2, 4, 6, 2, 3, 1, 6, 3, 4, 6, 1, 6, 5, 0, 6,
-	1, 6, 0, 5, 1, 5, 3, 4, 1, 0, 6, 2, 4, 4, 1, 0, 3, 5, 4, 6,
-	2, 3, 6, 0, 4, 0, 2, 4, 4, 3, 2, 3, 2, 0, 4, 5, 1, 1, 6, 1,
-	3, 3, 5, 3, 2, 4, 1, 6, 5, 0, 2, 0, 5, 6, 0, 6, 5, 1, 3, 1,
-	4, 2, 1, 4, 1, 6, 0, 3, 2, 0, 6, 1, 0, 4, 3, 1, 5, 6, 2, 0,
-	5, 2, 4, 2, 6, 0, 5, 2, 1, 4, 5, 0, 1, 2, 1, 2, 0, 4, 6, 2,
-	6, 5, 4, 4, 6, 4, 1, 4, 3, 0, 2, 4, 0, 4, 5, 2, 1, 0, 2, 1,
-	0, 6, 0, 2, 0, 2, 1, 4, 1, 6, 4, 6, 1, 3, 4, 5, 4, 6, 4, 5,
-	1, 2, 5, 2, 4, 4, 3, 5, 6, 1, 1, 1, 5, 5, 1, 4, 2, 6, 3, 5,
-	2, 4, 3, 4, 3, 1, 0, 4, 2, 0, 1, 3, 0, 4, 5, 6, 0, 2, 6, 4,
-	3, 1, 6, 6, 3, 4, 6, 1, 3, 3, 1, 0, 4, 6, 3, 2, 1, 0, 6, 2,
-	4, 3, 2, 0, 2, 0, 4, 1, 2, 5, 6, 1, 6, 2, 1, 2, 1, 5, 4, 2,
-	5, 2, 5, 0, 3, 2, 5, 3, 2, 4, 6, 1, 6, 5, 2, 3, 2, 5, 5, 0,
-	6, 2, 5, 6, 0, 5, 0, 1, 5, 4, 5, 6, 4, 2, 0, 0, 3, 1, 0, 6,
-	0, 4, 3, 4, 2, 1, 4, 2, 6, 4, 3, 4, 0, 3, 2, 1, 4, 3, 3, 6,
-	1, 4, 6, 1, 0, 5, 4, 1, 5, 6, 4, 6, 2, 4, 1, 5, 1, 4, 6, 6,
-	2, 3, 1, 4, 3, 2, 3, 6, 0, 4, 5, 3, 0, 1, 2, 5, 0, 3, 2, 5,
-	3, 2, 5, 4, 4, 1, 2, 1, 5, 2, 1, 2, 1, 3, 1, 2, 5, 4, 5, 6,
-	4, 3, 2, 2, 6, 3, 4, 2, 3, 4, 3, 5, 6, 3, 5, 3, 6, 6, 1, 6,
-	5, 2, 5, 4, 6, 1, 4, 3, 5, 6, 3, 4, 2, 0, 1, 6, 1, 1, 4, 0,
-	6, 1, 4, 6, 5, 4, 5, 1, 3, 5, 3, 3, 6, 2, 6, 4, 5, 6, 4, 5,
-	0, 6, 0, 5, 6, 3, 0, 2, 6, 2, 5, 0, 5, 2, 5, 1, 2, 1, 5, 6,
-	1, 3, 3, 5, 4, 1, 2, 3, 1, 6, 2, 3, 6, 0, 6, 1, 5, 2, 0, 0,
-	2, 4, 2, 1, 2, 4, 3, 0, 1, 3, 0, 0, 4, 6, 0, 4, 2, 3, 2, 0,
-	3, 4, 0, 5, 3, 2, 6, 2, 4, 3, 3, 2, 6, 2, 6, 3, 0, 1, 4, 0,
-	4, 6, 2, 1, 2, 5, 6, 3, 3, 0, 6, 4, 2, 3, 5, 6, 0, 4, 3, 6,
-	5, 4, 1, 5, 4, 5, 1, 4, 5, 4, 2, 1, 5, 3, 1, 2, 5, 1, 4, 3,
-	6, 4, 5, 4, 5, 1, 0, 2, 1, 6, 2, 5, 6, 2, 6, 4, 6, 2, 4, 5,
-	0, 4, 6, 5, 1, 3, 2, 4, 2, 5, 4, 2, 4, 1, 2, 3, 2, 4, 6, 0,
-	1, 3, 1, 0, 6, 5, 6, 5, 4, 2, 5, 0, 1, 2, 6, 1, 3, 2, 4, 6,
-	2, 6, 2, 4, 2, 0, 2, 5, 1, 4, 2, 1, 2, 4, 4, 0, 0, 3, 5, 0,
-	3, 6, 2, 3, 5, 4, 3, 5, 3, 1, 4, 0, 1, 5, 4, 2, 4, 2, 6, 5,
-	4, 6, 4, 5, 6, 3, 5, 1, 4, 2, 4, 3, 2, 0, 6, 3, 2, 4, 1, 0,
-	5, 6, 4, 6, 0, 1, 2, 1, 2, 0, 5, 4, 3, 5, 3, 4, 1, 2, 6, 3,
-	6, 1, 2, 4, 6, 2, 6, 0, 3, 5, 1, 1, 2, 4, 2, 0, 1, 6, 3, 0,
-	0, 1, 2, 2, 0, 6, 4, 2, 1, 3, 6, 1, 4, 5, 6, 2, 3, 2, 3, 5,
-	1, 0, 3, 2, 0, 5, 1, 6, 0, 3, 2, 2, 1, 5, 0, 2, 5, 0, 6, 3,
-	2, 0, 3, 4, 5, 2, 1, 5, 0, 4, 1, 3, 4, 6, 5, 1, 0, 1, 6, 1,
-	3, 0, 6, 3, 6, 0, 2, 3, 4, 5, 6, 3, 2, 3, 2, 1, 5, 5, 4, 3,
-	4, 0, 3, 6, 4, 1, 0, 6, 5, 0, 3, 0, 4, 3, 3, 1, 6, 5, 3, 5,
-	5, 4, 5, 3, 2, 1, 0, 3, 3, 1, 5, 4, 4, 3, 1, 2, 4, 5, 2, 5,
-	6, 3, 4, 3, 1, 6, 4, 0, 4, 3, 0, 1, 3, 0, 2, 5, 2, 4, 1, 6,
-	0, 1, 3, 1, 0, 6, 0, 3, 2, 1, 2, 4, 2, 0, 2, 0, 2, 6, 0, 2,
-	1, 6, 3, 1, 4, 1, 0, 2, 0, 3, 1, 5, 3, 5, 0, 5, 2, 6, 6, 4,
-	2, 3, 5, 2, 0, 5, 3, 0, 3, 6, 5, 1, 5, 3, 4, 3, 5, 6, 0, 4,
-	3, 2, 5, 4, 2, 6, 6, 1, 2, 0, 3, 6, 4, 5, 4, 0, 4, 2, 6, 6,
-	4, 0, 4, 0, 5, 6, 4, 1, 2, 6, 0, 4, 2, 4, 0, 3, 5, 1, 2, 0,
-	5, 1, 6, 3, 4, 3, 5, 0, 1, 0, 5, 2, 3, 1, 0, 4, 0, 6, 0, 5,
-	6, 3, 1, 3, 4, 0, 6, 4, 1, 5, 4, 5, 1, 4, 1, 4, 2, 3, 3, 5,
-	0, 3, 5, 1, 2, 3, 6, 2, 0, 6, 5, 2, 4, 1, 4, 6, 2, 2, 0, 4,
-	1, 4, 0, 4, 3, 1, 6, 1, 5, 2, 3, 2, 3, 3, 0, 5, 4, 2, 6, 0,
-	2, 1, 5, 6, 0, 6, 0, 4, 6, 6, 1, 0, 5, 0, 2, 6, 2, 6, 2, 4,
-	3, 1, 3, 5, 6, 0, 5, 0, 3, 1, 5, 3, 6, 5, 2, 0, 5, 6, 0, 5,
-	4, 6, 5, 4, 6, 4, 3, 6, 1, 3, 4, 4, 4, 2, 0, 5, 6, 2, 1, 5,
-	5, 4, 5, 3, 0, 4, 2, 3, 2, 6, 2, 3, 4, 5, 6, 0, 6, 3, 6, 0,
-	6, 4, 0, 5, 0, 2, 3, 3, 3, 5, 2, 6, 1, 1, 5, 6, 2, 3, 2, 3,
-	0, 4, 2, 4, 6, 3, 5, 4, 3, 5, 4, 3, 0, 5, 6, 5, 3, 0, 4, 4,
-	1, 4, 1, 3, 2, 3, 0, 0, 1, 5, 1, 4, 3, 5, 2, 4, 6, 0, 0, 5,
-	2, 5, 2, 5, 3, 0, 3, 6, 3, 4, 1, 6, 4, 3, 2, 4, 6, 2, 1, 0,
-	3, 2, 5, 6, 1, 6, 5, 2, 6, 0, 1, 4, 5, 3, 2, 0, 5, 2, 6, 1,
-	4, 6, 4, 5, 0, 3, 4, 6, 5, 1, 0, 4, 5, 1, 4, 5, 3, 4, 5, 3,
-	5, 4, 6, 4, 3, 5, 3, 5, 2, 6, 4, 3, 2, 4, 3, 5, 0, 6, 2, 0,
-	6, 4, 5, 1, 5, 1, 1, 0, 4, 1, 6, 3, 5, 6, 1, 3, 3, 3, 0, 6,
-	0, 5, 3, 2, 3, 6, 4, 5, 1, 3, 0, 0, 3, 2, 0, 2, 1, 4, 3, 2,
-	1, 5, 6, 3, 0, 3, 4, 6, 3, 1, 4, 6, 2, 1, 4, 2, 1, 4, 6, 4,
-	2, 5, 4, 3, 0, 1, 3, 0, 6, 2, 3, 6, 0, 5, 1, 3, 4, 1, 1, 5,
-	3, 3, 5, 4, 1, 1, 4, 5, 6, 0, 6, 0, 4, 1, 2, 0, 6, 1, 4, 5,
-	4, 6, 1, 0, 2, 3, 4, 6, 3, 6, 5, 0, 6, 1, 4, 5, 4, 6, 4, 6,
-	5, 1, 1, 2, 3, 5, 0, 1, 5, 4, 5, 4, 5, 1, 3, 0, 3, 1, 4, 0,
-	6, 3, 5, 1, 6, 1, 0, 1, 5, 3, 6, 2, 4, 2, 4, 0, 1, 6, 0, 6,
-	0, 5, 0, 3, 6, 1, 5, 2, 0, 1, 5, 2, 1, 0, 1, 3, 5, 0, 4, 2,
-	1, 2, 0, 4, 2, 0, 2, 1, 6, 3, 1, 5, 1, 6, 2, 5, 2, 1, 5, 0,
-	2, 6, 1, 1, 6, 4, 0, 6, 4, 6, 4, 6, 4, 0, 3, 2, 0, 6, 1, 1,
-	3, 1, 6, 0, 5, 2, 4, 5, 2, 2, 4, 5, 3, 6, 5, 0, 1, 6, 6, 1,
-	4, 2, 3, 1, 1, 4, 6, 6, 2, 1, 4, 2, 3, 1, 0, 5, 5, 2, 1, 2,
-	5, 1, 0, 6, 1, 6, 0, 5, 3, 5, 3, 6, 4, 2, 1, 5, 4, 2, 4, 5,
-	6, 4, 5, 1, 0, 4, 5, 0, 4, 4, 0, 6, 0, 4, 0, 2, 6, 3, 0, 2,
-	0, 2, 4, 2, 0, 3, 4, 1, 2, 1, 6, 5, 1, 0, 3, 4, 5, 1, 0, 2,
-	1, 4, 6, 2, 3, 0, 3, 2, 6, 2, 1, 4, 6, 2, 0, 6, 2, 0, 6, 5,
-	2, 6, 2, 5, 2, 1, 1, 4, 3, 3, 5, 4, 6, 1, 3, 2, 1, 5, 2, 5,
-	3, 5, 1, 2, 3, 0, 5, 6, 0, 6, 2, 3, 2, 5, 3, 4, 1, 3, 5, 0,
-	4, 3, 0, 2, 1, 6, 5, 1, 4, 6, 4, 0, 6, 3, 6, 1, 3, 4, 5, 3,
-	5, 6, 5, 0, 6, 4, 5, 5, 4, 0, 3, 1, 3, 2, 5, 2, 0, 6, 3, 6,
-	6, 1, 3, 0, 1, 6, 4, 0, 6, 3, 0, 5, 4, 0, 1, 6, 1, 0, 1, 6,
-	0, 6, 1, 3, 6, 3, 6, 3, 5, 3, 5, 2, 5, 6, 2, 4, 5, 3, 2, 3,
-	1, 5, 2, 6, 4, 2, 0, 2, 0, 5, 4, 5, 2, 5, 4, 5, 3, 2, 5, 4,
-	2, 0, 5, 4, 5, 1, 2, 6, 6, 1, 3, 2, 4, 2, 5, 0, 5, 0, 1, 2,
-	3, 6, 1, 3, 1, 2, 6, 2, 3, 6, 3, 2, 5, 2, 3, 4, 0, 3, 0, 6,
-	4, 2, 4, 6, 0, 5, 6, 4, 3, 3, 6, 2, 0, 3, 4, 0, 6, 3, 4, 1,
-	5, 6, 1, 0, 2, 1, 0, 3, 0, 2, 2, 6, 0, 6, 4, 6, 3, 6, 2, 0,
-	6, 3, 1, 5, 0, 3, 5, 3, 6, 0, 4, 5, 1, 4, 5, 3, 6, 5, 3, 3,
-	0, 6, 2, 0, 1, 6, 2, 5, 3, 1, 4, 2, 6, 5, 4, 2, 6, 5, 6, 4,
-	1, 3, 1, 2, 0, 3, 4, 3, 1, 2, 6, 0, 1, 6, 5, 3, 1, 4, 4, 5,
-	2, 1, 4, 5, 1, 6, 2, 1, 0, 6, 5, 1, 3, 2, 1, 6, 5, 2, 3, 6,
-	3, 0, 4, 0, 6, 1, 5, 6, 2, 0, 2, 5, 0, 0, 6, 2, 6, 2, 5, 3,
-	4, 3, 0, 2, 5, 4, 0, 1, 6, 0, 3, 2, 0, 6, 1, 2, 4, 6, 6, 3,
-	5, 5, 3, 1, 0, 3, 5, 6, 1, 0, 6, 2, 3, 4, 5, 0, 0, 3, 0, 6,
-	6, 2, 1, 0, 6, 3, 2, 5, 6, 3, 6, 5, 2, 5, 2, 3, 1, 6, 4, 5,
-	0, 6, 2, 0, 5, 1, 4, 2, 3, 0, 6, 2, 6, 0, 3, 3, 2, 4, 1, 0,
-	1, 5, 1, 4, 2, 6, 1, 3, 4, 0, 5, 2, 0, 3, 3, 0, 1, 0, 4, 1,
-	2, 1, 3, 2, 6, 3, 5, 6, 5, 2, 6, 0, 0, 6, 0, 5, 3, 5, 6, 0,
-	3, 1, 0, 0, 2, 4, 1, 4, 6, 5, 3, 1, 0, 3, 2, 6, 5, 4, 4, 6,
-	4, 5, 6, 4, 0, 5, 2, 4, 0, 4, 0, 2, 6, 4, 1, 2, 6, 5, 4, 2,
-	5, 1, 2, 5, 3, 1, 2, 0, 2, 3, 6, 2, 5, 1, 5, 2, 4, 2, 3, 5,
-	6, 0, 4, 3, 1, 5, 4, 2, 3, 4, 1, 0, 4, 6, 1, 3, 5, 1, 4, 3,
-	0, 5, 6, 1, 4, 3, 1, 3, 2, 4, 0, 2, 1, 5, 6, 1, 3, 1, 0, 5,
-	1, 0, 6, 4, 1, 0, 6, 3, 1, 4, 1, 1, 0, 2, 3, 4, 0, 6, 4, 3,
-	2, 4, 0, 1, 6, 5, 0, 5, 3, 2, 1, 5, 2, 0, 4, 2, 6, 0, 5, 2,
-	3, 1, 2, 1, 3, 0, 2, 5, 3, 4, 5, 6, 0, 3, 3, 4, 0, 1, 0, 6,
-	4, 1, 3, 5, 6, 0, 4, 1, 4, 6, 1, 2, 0, 6, 4, 4, 6, 3, 6, 2,
-	5, 2, 5, 6, 4, 5, 4, 0, 6, 0, 2, 2, 1, 6, 0, 2, 4, 4, 3, 5,
-	6, 0, 3, 0, 2, 6, 0, 1, 2, 3, 1, 4, 5, 3, 0, 2, 0, 0, 3, 4,
-	0, 6, 1, 3, 4, 2, 5, 6, 0, 2, 5, 6, 1, 4, 0, 1, 3, 6, 5, 3,
-	1, 2, 0, 6, 5, 3, 2, 4, 5, 4, 6, 1, 4, 6, 4, 1, 3, 3, 5, 3,
-	2, 1, 5, 4, 5, 0, 3, 5, 5, 3, 4, 3, 6, 3, 1, 6, 0, 5, 1, 3,
-	3, 2, 5, 4, 0, 1, 3, 5, 2, 6, 0, 1, 4, 3, 0, 6, 3, 2, 3, 5,
-	4, 2, 1, 0, 5, 6, 3, 5, 1, 5, 6, 1, 5, 3, 0, 3, 1, 4, 6, 4,
-	5, 6, 5, 6, 4, 2, 3, 2, 1, 3, 5, 1, 2, 4, 2, 4, 0, 2, 3, 0,
-	6, 1, 2, 4, 0, 5, 0, 2, 4, 2, 0, 3, 5, 6, 5, 4, 3, 6, 6, 5,
-	0, 3, 1, 4, 2, 0, 6, 2, 6, 3, 6, 1, 2, 6, 4, 2, 5, 4, 2, 4,
-	1, 4, 1, 3, 1, 6, 0, 1, 2, 3, 1, 0, 5, 2, 4, 6, 3, 1, 4, 1,
-	2, 0, 3, 6, 1, 3, 0, 3, 0, 3, 1, 2, 6, 3, 6, 2, 3, 4, 3, 1,
-	3, 4, 1, 4, 5, 6, 3, 2, 4, 2, 4, 5, 2, 1, 2, 5, 4, 3, 1, 0,
-	4, 2, 0, 4, 1, 5, 4, 0, 4, 2, 5, 6, 2, 0, 4, 5, 3, 2, 0, 6,
-	5, 2, 3, 1, 3, 5, 4, 3, 4, 3, 5, 2, 2, 3, 5, 4, 3, 0, 4, 2,
-	6, 5, 3, 6, 4, 6, 1, 5, 1, 4, 0, 3, 0, 2, 3, 4, 2, 3, 1, 5,
-	0, 6, 4, 2, 1, 2, 0, 6, 1, 0, 4, 2, 2, 5, 5, 1, 5, 0, 4, 5,
-	1, 0, 1, 4, 6, 0, 2, 5, 2, 3, 6, 3, 4, 2, 3, 1, 1, 4, 5, 4,
-	2, 6, 5, 4, 5, 0, 5, 4, 5, 4, 3, 5, 6, 1, 6, 5, 2, 3, 0, 1,
-	3, 2, 4, 1, 2, 5, 0, 2, 5, 6, 2, 0, 6, 1, 5, 0, 1, 2, 0, 2,
-	4, 5, 2, 1, 3, 1, 5, 2, 3, 5, 0, 6, 0, 5, 3, 5, 4, 6, 1, 6,
-	5, 1, 6, 0, 6, 4, 2, 0, 2, 1, 5, 3, 4, 4, 6, 4, 5, 4, 0, 6,
-	6, 3, 4, 0, 5, 6, 0, 4, 3, 1, 0, 2, 1, 5, 0, 1, 0, 2, 5, 2,
-	0, 3, 4, 6, 6, 5, 1, 1, 6, 1, 6, 4, 5, 0, 1, 4, 5, 1, 0, 4,
-	1, 3, 4, 3, 5, 2, 6, 5, 4, 2, 6, 2, 4, 3, 2, 3, 0, 3, 4, 3,
-	2, 1, 0, 1, 2, 3, 0, 3, 4, 0, 4, 5, 4, 2, 4, 3, 4, 2, 3, 6,
-	3, 2, 3, 1, 4, 2, 3, 5, 6, 5, 4, 3, 0, 3, 0, 6, 5, 1, 3, 5,
-	4, 3, 4, 2, 1, 6, 1, 3, 6, 4, 6, 1, 6, 4, 1, 5, 5, 4, 4, 3,
-	5, 1, 3, 6, 2, 0, 5, 0, 1, 5, 1, 5, 6, 3, 2, 6, 3, 5, 4, 3,
-	6, 0, 5, 2, 5, 2, 6, 5, 2, 3, 2, 6, 3, 1, 4, 6, 5, 1, 0, 4,
-	0, 1, 1, 2, 3, 2, 5, 3, 5, 1, 1, 6, 1, 4, 5, 3, 4, 6, 5, 3,
-	1, 3, 5, 2, 6, 1, 0, 3, 4, 5, 4, 1, 2, 5, 6, 5, 3, 0, 4, 1,
-	2, 6, 0, 3, 5, 3, 6, 2, 4, 6, 2, 1, 0, 6, 3, 4, 2, 0, 2, 3,
-	3, 1, 1, 0, 3, 1, 6, 0, 4, 0, 5, 3, 0, 6, 3, 2, 0, 6, 4, 6,
-	4, 6, 5, 1, 5, 2, 3, 2, 3, 2, 5, 0, 5, 0, 1, 2, 5, 2, 4, 5,
-	5, 0, 1, 5, 0, 6, 2, 6, 2, 0, 4, 6, 0, 4, 3, 5, 1, 3, 5, 3,
-	6, 3, 2, 4, 6, 0, 5, 2, 0, 4, 1, 3, 2, 1, 5, 2, 4, 5, 2, 1,
-	0, 4, 1, 6, 2, 1, 5, 2, 6, 0, 5, 1, 3, 3, 5, 1, 0, 5, 6, 1,
-	1, 6, 3, 2, 6, 5, 3, 6, 2, 5, 3, 2, 5, 1, 2, 0, 6, 1, 6, 5,
-	2, 0, 5, 2, 6, 3, 5, 3, 2, 3, 1, 4, 0, 4, 3, 3, 5, 1, 0, 4,
-	3, 6, 0, 1, 0, 3, 6, 2, 4, 4, 2, 6, 3, 6, 0, 5, 3, 0, 4, 2,
-	4, 0, 2, 4, 2, 0, 4, 3, 1, 2, 2, 0, 2, 0, 1, 4, 2, 5, 1, 6,
-	5, 0, 5, 1, 6, 4, 5, 0, 1, 1, 5, 6, 1, 0, 6, 6, 1, 0, 3, 1,
-	6, 5, 1, 3, 1, 2, 6, 2, 1, 4, 3, 0, 5, 1, 5, 0, 1, 5, 6, 1,
-	0, 1, 5, 2, 6, 4, 5, 1, 5, 4, 2, 3, 2, 4, 3, 5, 2, 6, 3, 6,
-	1, 2, 2, 5, 2, 5, 2, 0, 2, 0, 3, 2, 1, 4, 2, 3, 5, 0, 5, 2,
-	2, 3, 4, 3, 4, 2, 3, 5, 3, 6, 4, 2, 5, 5, 4, 6, 0, 4, 3, 5,
-	3, 1, 3, 6, 1, 2, 1, 1, 3, 6, 3, 1, 5, 3, 6, 2, 3, 6, 0, 6,
-	4, 1, 4, 2, 0, 0, 1, 5, 6, 5, 6, 1, 2, 6, 3, 1, 5, 2, 6, 5,
-	5, 2, 5, 1, 4, 6, 4, 0, 2, 2, 0, 3, 2, 5, 1, 5, 3, 1, 2, 3,
-	6, 3, 4, 3, 0, 3, 2, 6, 3, 5, 4, 3, 6, 3, 4, 0, 5, 1, 2, 4,
-	0, 5, 2, 2, 5, 3, 2, 5, 0, 5, 6, 4, 5, 2, 6, 3, 1, 6, 3, 0,
-	1, 3, 6, 4, 3, 1, 4, 3, 0, 4, 3, 5, 2, 0, 5, 0, 6, 4, 5, 1,
-	2, 0, 3, 5, 6, 6, 5, 0, 3, 6, 2, 1, 5, 4, 3, 0, 6, 4, 1, 5,
-	3, 0, 4, 3, 5, 6, 0, 1, 0, 4, 3, 0, 1, 3, 2, 1, 0, 4, 2, 1,
-	4, 1, 6, 0, 2, 4, 0, 5, 6, 1, 0, 5, 0, 2, 6, 3, 5, 6, 1, 5,
-	5, 0, 6, 0, 5, 3, 2, 6, 4, 3, 2, 5, 2, 0, 2, 6, 0, 1, 0, 5,
-	6, 1, 4, 3, 1, 0, 6, 0, 3, 6, 4, 6, 1, 6, 1, 4, 6, 4, 1, 1,
-	0, 5, 2, 3, 6, 4, 0, 2, 6, 0, 6, 3, 2, 1, 6, 2, 3, 0, 4, 0,
-	1, 3, 1, 4, 3, 0, 1, 3, 5, 2, 1, 5, 2, 3, 0, 2, 4, 6, 1, 6,
-	2, 5, 1, 3, 3, 0, 3, 6, 2, 4, 6, 6, 0, 4, 1, 0, 1, 2, 5, 3,
-	3, 1, 2, 3, 2, 4, 3, 1, 3, 2, 6, 2, 1, 5, 1, 0, 5, 4, 3, 2,
-	4, 1, 4, 6, 3, 4, 5, 6, 1, 4, 6, 5, 2, 4, 3, 4, 3, 0, 6, 3,
-	5, 1, 1, 2, 3, 4, 1, 2, 6, 1, 5, 6, 3, 6, 2, 2, 6, 2, 1, 2,
-	6, 2, 2, 4, 0, 5, 4, 6, 0, 2, 6, 4, 5, 6, 2, 1, 6, 5, 1, 6,
-	0, 4, 6, 0, 6, 5, 1, 2, 5, 2, 3, 6, 3, 3, 5, 0, 1, 4, 3, 2,
-	1, 6, 6, 2, 3, 2, 0, 4, 2, 5, 5, 4, 3, 4, 2, 1, 5, 6, 0, 2,
-	2, 4, 5, 2, 3, 6, 2, 5, 6, 2, 6, 3, 2, 1, 6, 5, 3, 0, 6, 5,
-	3, 4, 0, 4, 4, 1, 5, 1, 3, 1, 1, 4, 2, 5, 2, 5, 4, 2, 0, 5,
-	4, 2, 1, 2, 4, 6, 2, 0, 3, 6, 0, 3, 2, 0, 6, 4, 0, 6, 1, 3,
-	5, 3, 2, 4, 5, 4, 6, 2, 1, 5, 6, 3, 4, 1, 3, 4, 2, 6, 0, 5,
-	6, 2, 1, 1, 2, 4, 5, 2, 3, 5, 3, 5, 5, 2, 0, 5, 1, 6, 1, 5,
-	0, 2, 5, 6, 0, 4, 3, 5, 0, 5, 6, 3, 5, 3, 4, 2, 3, 6, 4, 0,
-	1, 5, 1, 4, 5, 2, 6, 2, 0, 5, 5, 2, 3, 0, 6, 5, 0, 1, 4, 2,
-	2, 0, 5, 0, 2, 0, 0, 6, 2, 6, 4, 5, 2, 3, 4, 6, 5, 0, 4, 3,
-	3, 1, 0, 4, 2, 6, 6, 3, 6, 4, 3, 6, 5, 2, 6, 6, 5, 2, 6, 0,
-	4, 2, 1, 3, 2, 1, 1, 6, 2, 3, 3, 1, 3, 0, 2, 2, 3, 4, 6, 5,
-	5, 0, 1, 5, 4, 3, 6, 2, 0, 2, 5, 2, 3, 0, 1, 3, 5, 3, 5, 3,
-	6, 5, 3, 4, 2, 5, 1, 3, 0, 1, 4, 3, 0, 3, 5, 3, 3, 6, 2, 0,
-	0, 2, 2, 0, 6, 0, 5, 5, 4, 6, 4, 5, 4, 1, 4, 0, 5, 6, 0, 2,
-	1, 0, 1, 0, 3, 5, 2, 3, 1, 6, 5, 4, 6, 4, 6, 0, 2, 6, 5, 4,
-	2, 5, 2, 3, 5, 0, 6, 3, 4, 2, 2, 6, 2, 0, 4, 5, 1, 3, 6, 4,
-	3, 6, 0, 6, 6, 5, 1, 1, 6, 1, 5, 2, 0, 1, 1, 3, 5, 1, 1, 1,
-	4, 1, 6, 2, 1, 0, 6, 5, 1, 6, 1, 5, 0, 6, 0, 6, 4, 1, 6, 2,
-	5, 4, 2, 5, 1, 6, 3, 2, 1, 4, 3, 0, 3, 4, 1, 3, 0, 4, 3, 6,
-	6, 5, 2, 5, 2, 3, 4, 2, 6, 5, 5, 6, 3, 3, 0, 6, 1, 0, 4, 3,
-	0, 6, 0, 0, 6, 5, 2, 3, 3, 4, 1, 5, 3, 4, 3, 5, 0, 3, 2, 1,
-	1, 5, 4, 2, 1, 2, 3, 5, 3, 4, 5, 4, 6, 0, 3, 4, 5, 4, 3, 2,
-	2, 6, 5, 1, 4, 6, 2, 6, 1, 3, 5, 6, 4, 1, 3, 5, 2, 5, 1, 4,
-	3, 2, 5, 6, 4, 6, 2, 6, 5, 6, 2, 6, 5, 4, 0, 5, 6, 0, 6, 2,
-	4, 0, 6, 4, 3, 5, 2, 1, 4, 0, 1, 3, 0, 2, 4, 0, 5, 2, 6, 0,
-	5, 4, 1, 0, 3, 6, 2, 3, 0, 1, 4, 5, 1, 5, 2, 0, 6, 3, 6, 6,
-	6, 2, 6, 4, 0, 1, 1, 2, 3, 0, 6, 3, 6, 1, 6, 4, 3, 0, 2, 4,
-	0, 1, 4, 3, 3, 4, 0, 3, 2, 0, 5, 4, 6, 1, 2, 4, 3, 2, 5, 1,
-	1, 2, 6, 2, 1, 3, 4, 5, 2, 6, 2, 5, 5, 0, 6, 1, 2, 4, 1, 0,
-	2, 5, 3, 1, 6, 2, 5, 5, 3, 2, 6, 4, 2, 5, 5, 1, 5, 3, 3, 2,
-	3, 4, 0, 4, 6, 0, 1, 3, 6, 2, 4, 1, 2, 0, 3, 2, 3, 4, 3, 2,
-	4, 0, 2, 5, 2, 4, 3, 2, 6, 0, 1, 4, 0, 1, 6, 3, 0, 1, 3, 5,
-	5, 1, 0, 1, 4, 0, 5, 4, 0, 1, 2, 0, 3, 1, 5, 4, 0, 4, 3, 1,
-	6, 1, 1, 4, 2, 5, 4, 6, 4, 5, 0, 1, 1, 1, 2, 1, 6, 2, 1, 2,
-	0, 6, 0, 3, 5, 1, 2, 5, 6, 4, 5, 0, 6, 5, 0, 5, 4, 4, 2, 1,
-	1, 0, 5, 0, 1, 6, 2, 6, 3, 2, 6, 2, 1, 2, 0, 5, 3, 6, 1, 0,
-	2, 5, 1, 2, 5, 4, 1, 3, 5, 6, 2, 4, 1, 2, 5, 4, 3, 0, 3, 1,
-	3, 4, 6, 2, 0, 6, 4, 2, 6, 1, 5, 0, 5, 6, 3, 0, 2, 1, 5, 2,
-	4, 0, 3, 5, 3, 4, 5, 3, 4, 2, 1, 0, 4, 2, 3, 4, 6, 1, 6, 2,
-	5, 4, 6, 5, 4, 1, 6, 0, 1, 4, 3, 5, 4, 5, 0, 2, 3, 0, 2, 1,
-	6, 5, 2, 4, 6, 2, 3, 4, 2, 1, 6, 0, 0, 2, 6, 6, 2, 6, 6, 1,
-	0, 3, 2, 0, 5, 6, 0, 1, 2, 5, 1, 4, 0, 2, 1, 3, 0, 3, 4, 6,
-	1, 2, 4, 5, 0, 1, 6, 4, 3, 4, 6, 2, 6, 6, 4, 6, 5, 2, 1, 5,
-	2, 4, 4, 1, 0, 2, 0, 1, 6, 3, 5, 3, 6, 4, 5, 1, 1, 6, 2, 1,
-	3, 0, 4, 6, 1, 3, 0, 6, 2, 0, 5, 6, 0, 5, 0, 2, 0, 6, 6, 4,
-	4, 1, 2, 5, 2, 4, 5, 3, 0, 6, 2, 1, 2, 3, 3, 4, 4, 5, 1, 0,
-	5, 1, 1, 3, 5, 2, 1, 3, 0, 5, 3, 4, 5, 3, 6, 3, 4, 6, 4, 5,
-	6, 3, 1, 6, 0, 5, 4, 3, 1, 3, 3, 5, 4, 3, 2, 4, 6, 4, 5, 4,
-	0, 1, 0, 3, 5, 4, 2, 5, 2, 5, 2, 2, 5, 0, 1, 3, 2, 2, 5, 2,
-	1, 4, 0, 2, 5, 2, 6, 1, 4, 1, 0, 6, 1, 3, 2, 6, 1, 2, 3, 5,
-	2, 6, 4, 1, 0, 3, 5, 6, 5, 2, 2, 3, 2, 4, 0, 1, 5, 2, 4, 3,
-	3, 6, 5, 4, 0, 4, 6, 4, 3, 0, 3, 5, 0, 3, 4, 3, 1, 6, 2, 1,
-	4, 0, 6, 1, 1, 4, 3, 0, 6, 1, 0, 3, 5, 3, 1, 5, 1, 3, 1, 0,
-	5, 3, 3, 4, 3, 6, 2, 1, 5, 3, 6, 0, 2, 0, 4, 6, 0, 6, 2, 4,
-	6, 1, 3, 1, 3, 4, 5, 2, 0, 2, 1, 6, 4, 5, 4, 6, 1, 4, 2, 3,
-	0, 2, 5, 5, 4, 1, 5, 5, 1, 5, 6, 4, 0, 4, 1, 1, 4, 6, 1, 4,
-	1, 3, 1, 3, 4, 3, 2, 5, 2, 3, 2, 6, 2, 5, 4, 3, 0, 2, 1, 3,
-	2, 5, 6, 3, 3, 0, 3, 1, 3, 1, 3, 2, 4, 2, 1, 4, 1, 5, 3, 5,
-	3, 4, 1, 5, 3, 6, 1, 6, 2, 1, 6, 4, 0, 2, 4, 3, 1, 4, 1, 0,
-	4, 2, 3, 4, 0, 5, 4, 3, 3, 1, 0, 5, 6, 3, 4, 6, 3, 6, 1, 6,
-	5, 2, 0, 1, 6, 1, 4, 0, 2, 1, 4, 6, 3, 5, 0, 2, 3, 6, 2, 0,
-	6, 5, 1, 4, 0, 6, 1, 3, 6, 4, 6, 2, 3, 4, 1, 4, 2, 0, 1, 4,
-	0, 4, 3, 1, 3, 0, 1, 0, 1, 2, 0, 6, 5, 6, 2, 5, 5, 1, 5, 4,
-	1, 2, 0, 6, 3, 2, 4, 3, 6, 0, 2, 1, 5, 2, 1, 3, 2, 1, 6, 2,
-	2, 4, 5, 4, 1, 4, 6, 5, 4, 2, 0, 4, 6, 0, 6, 1, 2, 1, 4, 2,
-	3, 2, 6, 1, 2, 3, 3, 1, 3, 5, 2, 5, 2, 0, 5, 6, 1, 4, 6, 0,
-	4, 1, 4, 1, 2, 6, 5, 3, 1, 5, 0, 5, 3, 6, 6, 4, 2, 5, 2, 1,
-	5, 2, 6, 3, 2, 6, 4, 5, 5, 6, 5, 4, 0, 4, 5, 4, 1, 5, 6, 3,
-	6, 4, 2, 1, 1, 2, 0, 6, 3, 5, 2, 4, 6, 5, 6, 3, 4, 0, 5, 2,
-	0, 1, 4, 2, 5, 1, 0, 4, 0, 2, 0, 1, 6, 0, 2, 0, 5, 2, 3, 5,
-	1, 1, 6, 1, 2, 4, 3, 5, 6, 4, 3, 3, 3, 2, 1, 5, 6, 0, 2, 0,
-	2, 6, 3, 1, 0, 6, 3, 5, 3, 1, 6, 1, 4, 6, 2, 6, 5, 2, 0, 3,
-	3, 4, 3, 4, 1, 5, 0, 5, 4, 2, 1, 0, 4, 5, 1, 4, 5, 6, 4, 5,
-	4, 3, 5, 0, 3, 5, 6, 4, 0, 5, 3, 0, 5, 1, 0, 5, 6, 2, 4, 2,
-	5, 2, 6, 5, 2, 1, 0, 3, 5, 0, 4, 0, 6, 2, 5, 6, 5, 6, 1, 2,
-	6, 3, 4, 6, 5, 3, 0, 5, 6, 0, 6, 5, 1, 3, 2, 0, 6, 4, 5, 0,
-	0, 5, 6, 2, 5, 3, 3, 1, 0, 1, 5, 6, 2, 0, 2, 0, 6, 2, 0, 6,
-	1, 2, 5, 2, 0, 5, 3, 4, 3, 5, 1, 6, 0, 2, 6, 0, 4, 2, 6, 4,
-	2, 6, 0, 2, 3, 1, 3, 5, 2, 0, 5, 3, 0, 2, 3, 0, 5, 0, 5, 4,
-	3, 6, 4, 2, 1, 4, 3, 1, 6, 5, 3, 3, 0, 4, 3, 6, 1, 4, 5, 3,
-	4, 5, 1, 2, 6, 2, 3, 1, 3, 1, 6, 5, 6, 2, 0, 2, 6, 4, 4, 0,
-	5, 2, 5, 0, 1, 1, 2, 2, 6, 1, 0, 4, 6, 5, 1, 3, 6, 1, 1, 5,
-	6, 1, 6, 4, 2, 0, 6, 0, 2, 6, 1, 6, 4, 6, 5, 1, 2, 5, 3, 5,
-	0, 5, 1, 4, 0, 4, 6, 1, 4, 5, 2, 1, 3, 2, 0, 1, 3, 4, 1, 4,
-	1, 6, 2, 6, 3, 4, 5, 2, 1, 0, 5, 3, 4, 1, 3, 6, 5, 0, 4, 1,
-	2, 3, 1, 4, 6, 2, 6, 4, 4, 6, 0, 4, 3, 5, 0, 4, 3, 6, 5, 1,
-	3, 6, 3, 1, 3, 6, 1, 0, 6, 2, 3, 4, 3, 5, 1, 4, 6, 2, 3, 5,
-	4, 3, 3, 5, 0, 4, 6, 3, 1, 3, 2, 3, 6, 1, 4, 1, 3, 3, 1, 4,
-	5, 2, 5, 3, 4, 6, 4, 5, 3, 1, 4, 2, 4, 0, 4, 0, 4, 2, 0, 1,
-	6, 2, 3, 6, 1, 6, 3, 5, 0, 3, 1, 3, 2, 6, 2, 0, 1, 5, 2, 4,
-	0, 6, 5, 2, 1, 5, 4, 1, 5, 3, 1, 5, 1, 2, 6, 5, 1, 2, 1, 0,
-	1, 1, 4, 2, 5, 4, 3, 3, 2, 4, 3, 2, 5, 2, 0, 1, 5, 0, 4, 5,
-	2, 5, 2, 6, 4, 0, 4, 2, 0, 2, 0, 2, 1, 4, 5, 6, 5, 4, 0, 1,
-	3, 6, 2, 5, 0, 4, 2, 2, 4, 3, 4, 1, 2, 5, 4, 0, 3, 5, 0, 1,
-	4, 1, 4, 6, 0, 6, 0, 5, 4, 2, 5, 4, 5, 4, 6, 3, 4, 2, 6, 4,
-	5, 2, 0, 5, 2, 6, 3, 0, 1, 0, 3, 2, 1, 6, 6, 5, 2, 3, 5, 2,
-	6, 5, 1, 0, 6, 1, 4, 0, 2, 1, 0, 1, 0, 2, 6, 5, 3, 1, 4, 2,
-	0, 3, 4, 0, 4, 2, 3, 2, 0, 5, 4, 5, 4, 2, 0, 3, 2, 0, 3, 2,
-	1, 2, 0, 2, 0, 6, 2, 5, 1, 6, 1, 5, 4, 3, 0, 4, 5, 3, 4, 6,
-	2, 5, 1, 0, 3, 0, 3, 3, 3, 2, 6, 4, 5, 3, 3, 6, 2, 1, 3, 4,
-	3, 1, 4, 2, 5, 6, 2, 5, 0, 5, 1, 0, 0, 6, 2, 4, 0, 4, 5, 6,
-	4, 5, 0, 2, 1, 6, 4, 1, 3, 6, 2, 3, 0, 2, 1, 3, 0, 6, 3, 0,
-	5, 6, 1, 3, 3, 1, 2, 1, 5, 2, 4, 4, 6, 0, 4, 2, 3, 2, 0, 2,
-	6, 3, 4, 5, 2, 5, 3, 2, 3, 4, 3, 0, 4, 6, 4, 1, 5, 4, 6, 0,
-	0, 2, 6, 4, 1, 0, 6, 3, 2, 1, 3, 6, 0, 6, 2, 6, 0, 5, 2, 0,
-	1, 6, 3, 5, 3, 0, 3, 6, 2, 1, 6, 4, 5, 0, 5, 0, 5, 3, 5, 3,
-	2, 5, 4, 1, 0, 5, 6, 1, 5, 6, 4, 2, 6, 5, 0, 6, 2, 6, 5, 3,
-	3, 5, 4, 3, 3, 3, 4, 2, 3, 1, 3, 0, 5, 4, 3, 2, 0, 3, 1, 0,
-	4, 0, 0, 5, 3, 1, 4, 3, 1, 4, 0, 2, 2, 5, 2, 4, 3, 4, 3, 3,
-	5, 0, 4, 0, 4, 0, 2, 5, 4, 2, 1, 1, 6, 0, 4, 0, 6, 4, 2, 0,
-	6, 2, 3, 6, 2, 0, 3, 5, 1, 0, 4, 1, 5, 1, 2, 6, 6, 3, 0, 2,
-	0, 2, 3, 4, 1, 0, 6, 5, 3, 6, 0, 2, 4, 0, 6, 1, 3, 3, 4, 5,
-	1, 2, 1, 4, 6, 2, 0, 1, 4, 6, 5, 2, 5, 2, 0, 3, 6, 5, 5, 1,
-	2, 0, 2, 6, 2, 3, 0, 4, 5, 3, 4, 1, 0, 5, 5, 2, 4, 2, 1, 4,
-	3, 4, 2, 4, 0, 0, 0, 1, 3, 2, 6, 4, 6, 2, 6, 2, 1, 3, 6, 4,
-	4, 0, 5, 6, 5, 6, 2, 1, 4, 5, 2, 6, 2, 5, 0, 1, 2, 0, 0, 5,
-	5, 4, 2, 0, 2, 1, 4, 1, 0, 3, 1, 3, 2, 4, 6, 3, 1, 6, 1, 5,
-	6, 2, 6, 1, 2, 6, 5, 3, 1, 0, 2, 5, 1, 0, 3, 1, 0, 6, 0, 5,
-	0, 3, 1, 2, 6, 0, 5, 1, 6, 1, 6, 3, 5, 3, 1, 3, 5, 3, 0, 3,
-	1, 5, 2, 6, 1, 0, 5, 3, 2, 2, 1, 5, 1, 0, 3, 6, 0, 5, 4, 1,
-	2, 1, 6, 4, 0, 5, 6, 4, 1, 3, 1, 6, 1, 4, 3, 5, 6, 6, 5, 3,
-	3, 2, 0, 1, 3, 1, 0, 4, 6, 4, 1, 2, 6, 0, 5, 2, 6, 1, 4, 2,
-	4, 3, 1, 2, 6, 3, 4, 4, 3, 1, 5, 1, 3, 6, 4, 2, 3, 3, 1, 6,
-	5, 3, 6, 3, 6, 3, 2, 3, 6, 2, 6, 1, 4, 2, 3, 2, 5, 2, 4, 5,
-	6, 3, 6, 4, 6, 3, 0, 5, 3, 3, 1, 2, 1, 5, 4, 5, 6, 3, 6, 2,
-	0, 6, 2, 1, 5, 5, 2, 0, 2, 3, 5, 2, 0, 3, 0, 1, 6, 5, 1, 3,
-	1, 0, 2, 5, 1, 3, 3, 2, 1, 2, 6, 6, 1, 3, 6, 6, 3, 0, 4, 1,
-	2, 1, 1, 3, 2, 4, 6, 4, 0, 3, 5, 4, 5, 2, 0, 2, 3, 2, 0, 3,
-	3, 4, 6, 2, 4, 4, 1, 4, 1, 6, 6, 5, 2, 4, 1, 3, 2, 4, 2, 1,
-	4, 6, 1, 0, 4, 0, 5, 2, 6, 5, 2, 1, 3, 5, 3, 2, 4, 1, 2, 0,
-	5, 4, 6, 0, 2, 0, 3, 5, 6, 1, 0, 4, 1, 2, 6, 3, 3, 6, 2, 1,
-	6, 2, 5, 3, 0, 4, 5, 0, 5, 4, 1, 3, 0, 5, 4, 2, 2, 5, 0, 6,
-	0, 1, 2, 1, 6, 6, 4, 2, 5, 1, 3, 6, 0, 2, 1, 2, 4, 3, 5, 0,
-	1, 4, 0, 2, 4, 2, 4, 2, 6, 3, 4, 3, 5, 0, 6, 2, 0, 2, 5, 4,
-	2, 4, 3, 2, 5, 0, 4, 1, 3, 2, 4, 5, 1, 4, 5, 3, 1, 1, 0, 4,
-	3, 0, 6, 5, 2, 1, 0, 1, 2, 4, 3, 2, 6, 5, 2, 1, 4, 1, 5, 3,
-	4, 3, 3, 6, 5, 3, 5, 0, 6, 5, 6, 2, 6, 5, 4, 4, 5, 2, 3, 0,
-	5, 2, 5, 1, 6, 4, 2, 3, 6, 3, 1, 3, 1, 5, 2, 1, 3, 3, 6, 5,
-	6, 1, 3, 0, 6, 2, 1, 4, 1, 0, 6, 6, 0, 1, 2, 3, 0, 3, 3, 0,
-	0, 4, 1, 3, 4, 3, 4, 5, 4, 2, 0, 2, 5, 6, 1, 4, 0, 6, 0, 5,
-	1, 0, 4, 4, 2, 4, 3, 4, 2, 3, 1, 3, 0, 6, 1, 0, 3, 0, 5, 3,
-	2, 3, 4, 5, 6, 0, 6, 0, 1, 4, 5, 6, 4, 6, 2, 0, 2, 1, 2, 1,
-	3, 3, 1, 6, 0, 5, 2, 1, 4, 6, 4, 5, 6, 5, 2, 4, 6, 0, 3, 6,
-	4, 1, 3, 5, 0, 3, 4, 1, 6, 2, 6, 2, 6, 2, 4, 0, 0, 5, 4, 1,
-	5, 2, 4, 3, 0, 6, 5, 1, 1, 6, 3, 3, 3, 2, 0, 2, 4, 4, 2, 0,
-	6, 1, 6, 2, 1, 5, 6, 2, 6, 5, 1, 3, 1, 5, 0, 1, 5, 6, 5, 0,
-	0, 1, 4, 1, 1, 3, 1, 6, 2, 4, 3, 1, 0, 6, 0, 3, 5, 6, 4, 0,
-	1, 5, 6, 5, 4, 3, 2, 5, 4, 3, 1, 5, 1, 3, 6, 3, 2, 0, 2, 1,
-	2, 6, 4, 6, 2, 3, 1, 3, 0, 6, 2, 1, 6, 5, 6, 2, 6, 2, 3, 1,
-	3, 6, 4, 6, 0, 4, 3, 4, 6, 0, 4, 5, 6, 4, 1, 1, 5, 3, 3, 0,
-	4, 4, 3, 1, 1, 6, 3, 4, 2, 0, 2, 2, 0, 5, 6, 4, 3, 6, 1, 3,
-	5, 2, 5, 4, 1, 0, 5, 4, 3, 5, 0, 4, 1, 6, 3, 6, 1, 2, 6, 2,
-	6, 1, 3, 0, 4, 6, 6, 5, 0, 2, 6, 2, 1, 4, 6, 3, 5, 1, 6, 5,
-	0, 6, 3, 6, 5, 2, 6, 2, 2, 0, 1, 1, 2, 3, 1, 5, 4, 2, 6, 3,
-	1, 2, 1, 3, 6, 0, 1, 0, 1, 0, 2, 4, 0, 5, 4, 1, 0, 3, 1, 3,
-	2, 5, 5, 1, 0, 6, 5, 1, 6, 5, 2, 5, 3, 5, 1, 4, 5, 0, 2, 1,
-	3, 6, 5, 4, 0, 5, 1, 1, 1, 0, 6, 2, 4, 2, 5, 1, 2, 5, 0, 3,
-	4, 1, 5, 5, 3, 0, 3, 5, 4, 5, 1, 3, 2, 5, 0, 1, 6, 0, 2, 0,
-	5, 2, 1, 2, 3, 5, 2, 0, 2, 2, 6, 5, 2, 1, 0, 2, 3, 6, 0, 5,
-	6, 2, 5, 6, 2, 3, 5, 6, 1, 2, 4, 5, 0, 6, 3, 5, 0, 2, 1, 5,
-	0, 5, 2, 4, 5, 3, 3, 3, 6, 4, 3, 1, 4, 1, 5, 4, 0, 6, 5, 3,
-	1, 4, 0, 5, 1, 1, 3, 6, 3, 5, 6, 4, 0, 4, 5, 4, 3, 1, 2, 3,
-	2, 3, 1, 6, 3, 4, 5, 4, 3, 5, 4, 5, 6, 4, 5, 2, 4, 5, 3, 4,
-	3, 0, 3, 3, 4, 6, 5, 3, 5, 3, 4, 5, 3, 1, 4, 1, 6, 1, 0, 5,
-	4, 6, 1, 5, 2, 0, 3, 6, 1, 6, 0, 1, 6, 4, 1, 5, 1, 0, 5, 2,
-	5, 0, 6, 5, 1, 3, 0, 4, 0, 6, 3, 4, 2, 3, 5, 3, 5, 3, 6, 0,
-	6, 2, 4, 5, 4, 6, 5, 1, 6, 2, 1, 4, 5, 6, 5, 0, 6, 5, 4, 2,
-	0, 6, 5, 6, 3, 2, 0, 4, 3, 1, 3, 2, 3, 1, 5, 3, 1, 1, 3, 4,
-	1, 0, 1, 2, 4, 3, 6, 3, 4, 1, 3, 3, 4, 1, 2, 4, 0, 2, 2, 1,
-	2, 6, 2, 6, 4, 5, 6, 5, 1, 5, 1, 6, 3, 3, 0, 3, 2, 6, 1, 3,
-	3, 2, 6, 2, 6, 1, 2, 5, 1, 4, 4, 1, 3, 6, 5, 6, 0, 2, 5, 2,
-	4, 2, 4, 3, 4, 5, 4, 1, 5, 2, 1, 0, 5, 0, 5, 2, 1, 2, 3, 2,
-	5, 4, 6, 0, 3, 1, 2, 0, 5, 6, 5, 1, 2, 5, 1, 6, 4, 2, 4, 2,
-	6, 2, 3, 2, 3, 6, 0, 1, 2, 1, 2, 5, 4, 0, 1, 4, 2, 4, 6, 2,
-	0, 4, 0, 2, 5, 4, 1, 6, 0, 6, 4, 2, 5, 4, 0, 1, 5, 6, 2, 5,
-	1, 4, 3, 0, 4, 6, 4, 1, 6, 2, 5, 4, 5, 0, 6, 1, 2, 1, 3, 0,
-	2, 5, 3, 2, 0, 4, 2, 1, 1, 5, 6, 5, 5, 1, 6, 1, 3, 4, 3, 1,
-	3, 1, 1, 3, 1, 0, 6, 1, 6, 0, 6, 5, 1, 0, 4, 3, 0, 4, 3, 0,
-	4, 2, 3, 4, 3, 5, 6, 3, 1, 1, 1, 5, 6, 3, 6, 0, 1, 1, 3, 3,
-	5, 6, 3, 1, 0, 5, 6, 1, 1, 0, 3, 0, 1, 5, 4, 5, 6, 1, 0, 1,
-	6, 1, 4, 5, 0, 2, 4, 5, 6, 1, 2, 0, 6, 1, 1, 6, 0, 1, 4, 2,
-	0, 4, 2, 0, 4, 1, 6, 3, 0, 2, 0, 3, 4, 2, 5, 0, 1, 2, 4, 2,
-	1, 3, 0, 3, 1, 2, 4, 1, 2, 5, 0, 4, 6, 2, 2, 0, 3, 1, 6, 3,
-	2, 4, 2, 4, 1, 5, 1, 3, 6, 2, 3, 4, 0, 6, 3, 0, 1, 4, 0, 5,
-	3, 5, 0, 0, 1, 2, 0, 4, 5, 4, 0, 5, 0, 6, 5, 2, 0, 3, 2, 6,
-	4, 2, 6, 4, 0, 6, 1, 0, 1, 3, 5, 3, 0, 6, 6, 2, 1, 5, 4, 3,
-	5, 3, 4, 2, 3, 4, 3, 4, 2, 1, 2, 3, 5, 6, 3, 4, 1, 2, 0, 1,
-	6, 1, 4, 3, 0, 1, 2, 0, 4, 5, 5, 6, 5, 3, 2, 0, 6, 1, 4, 1,
-	0, 3, 6, 3, 6, 4, 5, 3, 3, 2, 3, 5, 2, 3, 4, 1, 1, 5, 4, 6,
-	1, 1, 3, 6, 2, 0, 5, 0, 4, 6, 4, 0, 6, 2, 4, 2, 5, 0, 1, 6,
-	2, 1, 2, 6, 2, 0, 4, 2, 4, 6, 1, 5, 0, 4, 1, 5, 1, 4, 2, 6,
-	3, 0, 6, 5, 1, 3, 1, 2, 4, 2, 6, 3, 4, 2, 0, 2, 0, 3, 5, 4,
-	4, 1, 1, 5, 6, 0, 1, 0, 3, 2, 6, 1, 6, 1, 5, 1, 2, 0, 3, 6,
-	5, 3, 4, 1, 5, 1, 2, 0, 2, 0, 5, 4, 2, 1, 3, 6, 2, 1, 5, 6,
-	6, 3, 4, 2, 5, 4, 1, 0, 2, 4, 2, 4, 2, 5, 2, 3, 6, 4, 2, 4,
-	0, 6, 2, 6, 5, 3, 6, 3, 0, 3, 0, 1, 1, 0, 2, 5, 4, 2, 0, 5,
-	1, 3, 5, 3, 5, 3, 2, 6, 2, 2, 0, 3, 5, 2, 6, 3, 4, 6, 5, 6,
-	2, 1, 6, 1, 5, 2, 3, 2, 5, 2, 6, 2, 2, 3, 3, 0, 4, 3, 3, 1,
-	3, 0, 3, 2, 3, 1, 6, 4, 0, 2, 0, 3, 1, 2, 6, 4, 0, 2, 5, 3,
-	4, 6, 3, 6, 4, 6, 3, 2, 6, 4, 5, 4, 3, 2, 3, 4, 6, 4, 5, 6,
-	5, 1, 6, 5, 1, 0, 3, 2, 3, 5, 1, 6, 4, 0, 3, 5, 1, 4, 5, 6,
-	6, 1, 3, 1, 6, 1, 5, 6, 3, 4, 6, 2, 2, 6, 0, 5, 1, 6, 2, 5,
-	0, 0, 2, 6, 6, 6, 3, 4, 6, 3, 5, 1, 5, 4, 0, 5, 3, 1, 1, 4,
-	1, 3, 0, 3, 0, 1, 2, 6, 2, 1, 1, 5, 4, 2, 6, 1, 1, 6, 0, 6,
-	2, 1, 4, 1, 1, 1, 1, 2, 3, 0, 4, 3, 4, 3, 5, 4, 6, 0, 6, 2,
-	3, 2, 0, 2, 3, 1, 3, 1, 4, 1, 5, 1, 6, 5, 4, 5, 6, 0, 6, 2,
-	4, 6, 2, 0, 1, 5, 2, 6, 1, 0, 6, 2, 3, 5, 3, 4, 1, 4, 2, 1,
-	5, 1, 2, 0, 6, 5, 6, 4, 6, 1, 5, 3, 6, 2, 3, 5, 4, 5, 6, 3,
-	6, 4, 2, 6, 4, 5, 4, 1, 4, 1, 4, 6, 2, 5, 2, 5, 1, 5, 3, 4,
-	0, 4, 3, 1, 1, 4, 6, 4, 0, 2, 3, 6, 4, 1, 2, 0, 6, 4, 6, 5,
-	1, 1, 5, 3, 6, 3, 3, 0, 3, 1, 3, 0, 3, 6, 2, 3, 0, 5, 1, 6,
-	2, 3, 6, 4, 2, 5, 0, 1, 2, 0, 3, 4, 6, 5, 0, 1, 3, 5, 0, 3,
-	3, 2, 3, 5, 0, 4, 6, 3, 5, 1, 4, 3, 2, 1, 4, 0, 2, 6, 5, 1,
-	4, 5, 0, 5, 2, 2, 1, 0, 1, 5, 6, 1, 0, 5, 6, 0, 3, 6, 4, 2,
-	5, 3, 6, 2, 6, 5, 1, 1, 2, 0, 1, 6, 0, 1, 2, 4, 3, 4, 0, 5,
-	6, 5, 1, 6, 6, 3, 1, 6, 4, 3, 0, 5, 2, 5, 4, 2, 5, 6, 0, 6,
-	0, 2, 5, 3, 0, 1, 6, 4, 2, 4, 6, 0, 1, 1, 0, 3, 6, 2, 0, 3,
-	1, 2, 6, 4, 1, 5, 4, 2, 1, 4, 0, 5, 4, 1, 6, 4, 6, 5, 6, 0,
-	2, 3, 0, 3, 5, 0, 5, 1, 5, 4, 0, 5, 2, 6, 4, 5, 2, 6, 2, 4,
-	3, 4, 3, 1, 4, 5, 5, 4, 3, 0, 3, 2, 3, 6, 2, 0, 1, 5, 6, 2,
-	4, 3, 2, 0, 4, 1, 0, 1, 5, 0, 2, 5, 1, 3, 5, 3, 5, 2, 3, 2,
-	5, 5, 3, 0, 6, 2, 4, 3, 0, 2, 4, 3, 2, 5, 6, 5, 5, 1, 5, 1,
-	6, 2, 0, 2, 6, 3, 2, 6, 2, 5, 1, 3, 5, 1, 2, 1, 6, 1, 5, 6,
-	0, 5, 3, 2, 6, 2, 3, 1, 3, 2, 5, 0, 5, 4, 2, 0, 3, 6, 2, 0,
-	1, 3, 6, 3, 1, 2, 1, 0, 4, 1, 3, 5, 1, 3, 4, 1, 0, 6, 5, 1,
-	2, 6, 1, 5, 0, 1, 4, 6, 3, 0, 1, 4, 6, 1, 3, 4, 3, 4, 0, 2,
-	3, 2, 4, 1, 6, 5, 1, 3, 2, 0, 4, 2, 4, 5, 6, 4, 0, 2, 3, 6,
-	4, 6, 3, 6, 5, 0, 6, 0, 1, 5, 2, 6, 6, 0, 6, 1, 4, 6, 2, 4,
-	5, 1, 2, 5, 3, 5, 6, 0, 1, 5, 1, 5, 1, 0, 4, 1, 4, 0, 1, 2,
-	6, 0, 4, 6, 5, 0, 2, 6, 0, 6, 5, 1, 2, 0, 3, 5, 3, 4, 3, 6,
-	0, 3, 6, 2, 4, 2, 2, 0, 3, 6, 3, 0, 1, 5, 1, 4, 2, 0, 1, 2,
-	1, 3, 1, 0, 4, 3, 3, 0, 5, 3, 1, 3, 2, 4, 0, 2, 0, 1, 5, 5,
-	2, 4, 5, 2, 1, 1, 0, 6, 1, 4, 6, 5, 4, 5, 6, 5, 6, 5, 2, 5,
-	3, 1, 2, 4, 0, 4, 1, 1, 4, 1, 3, 0, 5, 2, 5, 3, 2, 4, 4, 2,
-	4, 2, 3, 2, 4, 3, 0, 2, 3, 3, 4, 3, 6, 5, 3, 1, 5, 2, 6, 6,
-	5, 2, 3, 3, 2, 4, 0, 4, 0, 6, 1, 5, 4, 6, 4, 3, 3, 6, 2, 5,
-	6, 5, 1, 6, 5, 3, 4, 3, 2, 3, 0, 4, 6, 3, 4, 3, 1, 6, 4, 2,
-	0, 3, 4, 5, 1, 6, 5, 1, 4, 3, 1, 5, 6, 1, 3, 2, 3, 0, 5, 0,
-	1, 2, 3, 0, 6, 0, 5, 6, 5, 6, 2, 6, 3, 6, 2, 4, 3, 4, 1, 3,
-	2, 4, 5, 0, 3, 6, 1, 0, 6, 1, 2, 5, 1, 2, 4, 5, 3, 6, 0, 5,
-	3, 6, 1, 2, 0, 3, 0, 6, 5, 3, 6, 2, 5, 1, 5, 2, 3, 6, 0, 5,
-	4, 4, 3, 0, 1, 4, 1, 3, 0, 0, 3, 4, 1, 6, 0, 4, 5, 4, 2, 0,
-	5, 2, 5, 0, 4, 5, 2, 6, 0, 6, 4, 2, 5, 1, 1, 2, 1, 0, 1, 6,
-	6, 4, 0, 5, 3, 5, 4, 0, 1, 3, 2, 4, 3, 1, 3, 0, 5, 3, 5, 4,
-	0, 6, 5, 4, 6, 4, 0, 4, 5, 1, 2, 3, 6, 0, 6, 1, 5, 0, 1, 5,
-	1, 3, 3, 2, 4, 1, 4, 2, 3, 0, 5, 4, 0, 4, 0, 5, 2, 3, 0, 3,
-	2, 6, 5, 6, 0, 2, 6, 0, 6, 4, 3, 5, 0, 5, 4, 3, 2, 3, 5, 2,
-	3, 4, 2, 5, 1, 3, 6, 2, 0, 6, 5, 2, 6, 3, 6, 2, 4, 2, 6, 2,
-	4, 5, 6, 3, 5, 1, 5, 3, 1, 2, 3, 3, 2, 4, 2, 6, 5, 4, 1, 5,
-	5, 4, 6, 1, 6, 0, 4, 5, 0, 3, 1, 5, 1, 3, 5, 3, 4, 3, 4, 3,
-	6, 0, 1, 2, 0, 3, 2, 4, 2, 4, 3, 4, 3, 1, 0, 5, 0, 2, 1, 4,
-	0, 2, 5, 1, 5, 0, 5, 0, 3, 2, 1, 0, 5, 1, 0, 6, 2, 4, 5, 0,
-	1, 6, 1, 5, 3, 5, 6, 6, 4, 6, 6, 1, 2, 5, 0, 4, 6, 4, 3, 6,
-	2, 4, 1, 4, 2, 0, 4, 5, 0, 2, 3, 2, 6, 2, 3, 4, 0, 3, 2, 1,
-	3, 1, 3, 6, 1, 5, 3, 1, 1, 6, 3, 6, 4, 6, 2, 1, 6, 2, 1, 5,
-	4, 4, 2, 0, 6, 4, 1, 2, 4, 5, 2, 4, 5, 4, 2, 6, 1, 3, 4, 0,
-	5, 6, 3, 1, 5, 0, 5, 6, 1, 4, 2, 3, 5, 4, 2, 6, 0, 5, 3, 4,
-	6, 2, 4, 5, 2, 1, 5, 6, 5, 2, 1, 5, 4, 3, 2, 3, 4, 3, 3, 1,
-	0, 4, 2, 1, 0, 5, 3, 1, 6, 1, 1, 4, 6, 1, 3, 6, 1, 3, 1, 4,
-	1, 1, 6, 4, 3, 1, 4, 3, 5, 6, 0, 6, 0, 2, 0, 6, 2, 3, 2, 4,
-	2, 1, 4, 0, 6, 0, 0, 1, 4, 2, 5, 4, 2, 1, 1, 2, 6, 3, 4, 0,
-	3, 5, 6, 2, 3, 1, 4, 1, 3, 1, 5, 1, 3, 2, 0, 4, 1, 1, 4, 0,
-	4, 2, 4, 2, 5, 1, 0, 1, 4, 2, 4, 2, 0, 1, 6, 4, 1, 6, 0, 3,
-	5, 6, 5, 3, 3, 6, 2, 4, 3, 4, 6, 1, 2, 5, 6, 4, 6, 0, 1, 5,
-	6, 2, 4, 3, 6, 5, 3, 2, 0, 5, 3, 5, 2, 4, 2, 6, 3, 6, 1, 4,
-	0, 3, 0, 4, 3, 1, 3, 5, 6, 5, 6, 1, 1, 2, 1, 6, 0, 4, 0, 2,
-	1, 0, 3, 0, 6, 2, 5, 3, 6, 1, 2, 3, 0, 5, 4, 3, 5, 0, 4, 0,
-	2, 4, 3, 1, 6, 1, 0, 1, 1, 6, 1, 0, 3, 6, 3, 5, 4, 2, 0, 6,
-	3, 6, 5, 4, 2, 4, 2, 0, 3, 4, 5, 2, 0, 1, 2, 0, 5, 6, 4, 0,
-	4, 1, 2, 1, 5, 2, 0, 0, 2, 0, 5, 4, 5, 3, 1, 3, 3, 6, 2, 0,
-	5, 1, 0, 4, 3, 2, 5, 4, 1, 5, 4, 2, 4, 2, 1, 2, 1, 6, 4, 3,
-	6, 1, 0, 5, 2, 5, 2, 3, 5, 0, 6, 3, 1, 6, 2, 6, 6, 4, 3, 2,
-	0, 4, 1, 2, 0, 0, 2, 0, 2, 1, 5, 3, 3, 5, 4, 3, 1, 3, 2, 6,
-	1, 0, 2, 4, 3, 2, 0, 5, 5, 5, 3, 0, 2, 2, 5, 1, 3, 2, 5, 4,
-	2, 0, 1, 4, 6, 2, 0, 4, 5, 4, 1, 4, 1, 4, 5, 5, 3, 1, 2, 1,
-	3, 5, 0, 4, 0, 4, 3, 5, 6, 0, 4, 2, 1, 2, 5, 0, 4, 1, 2, 4,
-	4, 5, 6, 0, 3, 6, 2, 0, 6, 3, 2, 0, 3, 3, 0, 2, 6, 0, 1, 4,
-	5, 0, 4, 4, 1, 0, 6, 2, 6, 3, 1, 3, 5, 2, 0, 1, 6, 0, 6, 2,
-	6, 2, 2, 3, 5, 3, 0, 6, 0, 6, 5, 3, 4, 0, 6, 2, 4, 6, 3, 2,
-	0, 6, 5, 0, 2, 1, 0, 6, 3, 6, 2, 4, 2, 3, 4, 0, 4, 0, 1, 3,
-	1, 6, 3, 2, 3, 1, 3, 5, 6, 2, 6, 4, 2, 5, 6, 5, 0, 1, 2, 5,
-	2, 0, 4, 2, 4, 3, 1, 4, 4, 3, 6, 2, 1, 5, 0, 4, 4, 2, 0, 1,
-	3, 3, 2, 5, 4, 0, 4, 5, 1, 5, 1, 6, 2, 6, 1, 5, 3, 0, 2, 1,
-	4, 3, 5, 6, 2, 3, 6, 5, 4, 6, 5, 4, 6, 2, 5, 0, 6, 0, 1, 6,
-	5, 2, 0, 6, 1, 4, 1, 3, 1, 4, 5, 2, 1, 0, 1, 4, 3, 4, 2, 4,
-	6, 3, 2, 1, 6, 0, 1, 3, 6, 3, 6, 2, 6, 4, 5, 1, 4, 2, 0, 1,
-	0, 4, 2, 4, 5, 3, 0, 2, 3, 1, 5, 0, 6, 3, 5, 2, 1, 1, 5, 2,
-	1, 0, 5, 2, 1, 2, 6, 1, 3, 6, 0, 3, 5, 0, 1, 6, 0, 5, 1, 6,
-	2, 1, 6, 0, 3, 0, 6, 2, 6, 1, 1, 0, 6, 2, 5, 3, 6, 0, 5, 3,
-	3, 6, 1, 6, 2, 5, 5, 2, 1, 0, 5, 4, 2, 5, 3, 4, 3, 6, 2, 3,
-	4, 5, 4, 2, 4, 1, 6, 2, 0, 5, 3, 6, 0, 6, 6, 3, 5, 6, 3, 2,
-	5, 5, 6, 2, 3, 5, 0, 4, 0, 6, 2, 0, 0, 5, 2, 1, 1, 4, 5, 3,
-	6, 0, 4, 2, 6, 2, 4, 0, 3, 4, 0, 4, 1, 5, 6, 0, 0, 1, 6, 0,
-	0, 6, 0, 1, 0, 6, 2, 2, 4, 6, 3, 4, 2, 1, 2, 4, 6, 3, 0, 4,
-	1, 0, 2, 5, 1, 2, 5, 0, 2, 0, 4, 1, 4, 6, 3, 6, 4, 1, 6, 1,
-	2, 0, 0, 6, 0, 1, 3, 1, 5, 0, 4, 0, 6, 3, 4, 0, 1, 3, 2, 0,
-	3, 1, 6, 5, 2, 3, 5, 0, 6, 2, 6, 1, 0, 5, 4, 0, 2, 0, 3, 6,
-	4, 2, 6, 4, 6, 2, 5, 3, 0, 4, 2, 0, 2, 4, 5, 0, 5, 1, 2, 4,
-	5, 1, 2, 5, 4, 2, 1, 6, 5, 0, 2, 0, 1, 5, 1, 4, 0, 2, 2, 4,
-	6, 4, 1, 1, 3, 3, 0, 1, 5, 6, 3, 1, 2, 6, 5, 3, 3, 4, 2, 5,
-	0, 5, 2, 0, 5, 1, 4, 0, 4, 0, 5, 6, 4, 6, 0, 1, 6, 3, 1, 4,
-	1, 4, 6, 4, 1, 1, 5, 1, 1, 1, 3, 6, 2, 1, 3, 1, 6, 4, 0, 1,
-	2, 6, 4, 1, 1, 4, 3, 0, 1, 1, 0, 3, 5, 3, 6, 1, 5, 4, 2, 6,
-	3, 6, 1, 6, 4, 1, 6, 1, 3, 4, 0, 4, 5, 6, 5, 6, 5, 1, 5, 2,
-	4, 1, 3, 2, 0, 1, 3, 0, 1, 4, 0, 5, 1, 6, 6, 5, 2, 3, 3, 4,
-	5, 4, 5, 0, 6, 0, 3, 5, 6, 2, 4, 1, 6, 1, 0, 1, 6, 0, 3, 6,
-	6, 4, 4, 0, 6, 5, 3, 3, 5, 2, 6, 0, 5, 1, 0, 2, 3, 4, 3, 3,
-	0, 6, 5, 0, 3, 2, 6, 5, 2, 1, 1, 0, 5, 1, 6, 0, 3, 5, 3, 5,
-	1, 3, 2, 6, 3, 0, 2, 1, 0, 6, 6, 5, 2, 5, 5, 4, 3, 4, 1, 2,
-	2, 1, 4, 5, 1, 6, 0, 3, 0, 1, 1, 4, 5, 6, 6, 0, 4, 6, 2, 0,
-	3, 2, 6, 3, 2, 3, 0, 1, 5, 1, 3, 6, 2, 3, 2, 1, 2, 1, 6, 4,
-	4, 5, 1, 1, 4, 2, 3, 5, 2, 1, 0, 5, 3, 1, 0, 3, 0, 4, 2, 5,
-	5, 4, 2, 6, 4, 3, 4, 3, 1, 2, 0, 5, 2, 0, 4, 5, 3, 5, 2, 3,
-	6, 5, 6, 1, 4, 2, 0, 1, 6, 0, 3, 5, 3, 0, 4, 6, 4, 2, 6, 2,
-	0, 2, 4, 0, 2, 5, 0, 4, 5, 5, 4, 0, 3, 0, 2, 1, 6, 4, 3, 5,
-	1, 5, 5, 4, 0, 2, 1, 6, 1, 6, 2, 3, 4, 2, 1, 0, 1, 4, 2, 0,
-	2, 6, 2, 2, 6, 0, 2, 3, 0, 6, 3, 1, 2, 5, 2, 1, 6, 2, 5, 1,
-	3, 0, 4, 1, 2, 0, 5, 3, 3, 5, 2, 1, 6, 4, 6, 5, 2, 4, 0, 1,
-	4, 6, 1, 2, 5, 2, 4, 1, 3, 4, 0, 3, 5, 1, 3, 6, 4, 3, 2, 5,
-	5, 0, 6, 2, 5, 2, 0, 4, 2, 2, 5, 4, 1, 3, 5, 1, 5, 2, 3, 2,
-	6, 4, 0, 3, 6, 1, 4, 6, 0, 6, 0, 5, 0, 2, 4, 1, 1, 4, 0, 6,
-	0, 5, 0, 4, 5, 4, 3, 2, 2, 0, 5, 1, 6, 2, 6, 0, 3, 3, 2, 4,
-	1, 6, 0, 2, 5, 6, 2, 5, 3, 1, 4, 0, 4, 6, 5, 1, 3, 4, 0, 2,
-	2, 3, 0, 5, 2, 4, 2, 3, 1, 6, 0, 0, 5, 3, 2, 6, 2, 1, 3, 5,
-	3, 4, 1, 0, 1, 3, 6, 0, 1, 0, 2, 4, 5, 1, 1, 4, 3, 6, 2, 4,
-	4, 4, 6, 6, 3, 0, 4, 0, 5, 0, 6, 4, 6, 2, 5, 6, 0, 3, 0, 2,
-	5, 2, 5, 0, 6, 0, 5, 6, 2, 1, 1, 5, 1, 2, 3, 1, 4, 3, 5, 0,
-	6, 2, 0, 1, 1, 0, 4, 2, 6, 5, 1, 4, 1, 6, 1, 0, 6, 0, 6, 6,
-	0, 4, 0, 6, 4, 6, 2, 4, 5, 0, 2, 1, 5, 0, 2, 1, 4, 5, 3, 2,
-	1, 3, 6, 2, 4, 0, 6, 2, 1, 1, 4, 1, 0, 4, 3, 2, 1, 1, 2, 5,
-	2, 3, 5, 3, 1, 3, 3, 6, 5, 6, 0, 1, 4, 3, 6, 1, 0, 4, 6, 5,
-	3, 1, 4, 1, 3, 6, 2, 5, 4, 0, 2, 1, 2, 1, 5, 5, 3, 3, 0, 5,
-	4, 1, 0, 4, 0, 2, 6, 1, 3, 1, 2, 0, 5, 4, 3, 2, 3, 4, 1, 5,
-	5, 2, 4, 2, 6, 2, 0, 3, 6, 4, 0, 5, 3, 4, 5, 6, 3, 5, 6, 4,
-	6, 4, 3, 6, 1, 3, 3, 0, 5, 0, 6, 3, 0, 6, 3, 1, 1, 5, 1, 3,
-	0, 3, 2, 4, 3, 4, 3, 2, 5, 0, 2, 4, 0, 2, 5, 4, 2, 3, 2, 3,
-	1, 6, 3, 1, 4, 3, 1, 2, 0, 4, 0, 5, 1, 4, 5, 1, 1, 4, 6, 4,
-	2, 4, 0, 3, 6, 5, 3, 1, 4, 0, 6, 0, 4, 1, 5, 3, 5, 3, 5, 1,
-	3, 2, 3, 6, 0, 5, 6, 3, 6, 3, 0, 1, 6, 0, 2, 1, 5, 1, 4, 0,
-	4, 3, 4, 2, 5, 5, 4, 2, 0, 5, 0, 3, 5, 4, 3, 3, 1, 0, 2, 1,
-	5, 2, 3, 6, 5, 6, 0, 6, 0, 4, 2, 4, 5, 1, 1, 2, 0, 2, 5, 1,
-	6, 1, 4, 5, 6, 4, 0, 4, 0, 2, 1, 2, 5, 6, 5, 6, 3, 2, 3, 6,
-	0, 0, 5, 3, 0, 2, 6, 2, 3, 1, 4, 6, 2, 1, 6, 5, 6, 2, 4, 5,
-	1, 6, 2, 4, 4, 3, 1, 6, 0, 0, 6, 2, 1, 6, 6, 4, 2, 6, 0, 3,
-	2, 4, 6, 3, 4, 5, 3, 4, 1, 2, 6, 1, 5, 2, 4, 0, 6, 3, 2, 0,
-	3, 4, 1, 6, 0, 6, 4, 6, 2, 1, 3, 5, 3, 1, 3, 0, 5, 2, 4, 2,
-	4, 3, 4, 2, 4, 3, 4, 2, 5, 5, 5, 3, 2, 5, 4, 5, 6, 3, 2, 4,
-	5, 0, 4, 5, 2, 6, 2, 5, 1, 4, 3, 5, 4, 1, 5, 3, 2, 6, 5, 0,
-	6, 0, 3, 0, 3, 1, 3, 0, 3, 1, 3, 5, 1, 4, 2, 3, 3, 1, 0, 6,
-	0, 3, 1, 2, 5, 6, 4, 3, 2, 6, 1, 5, 1, 6, 0, 6, 4, 3, 4, 3,
-	1, 1, 6, 1, 4, 1, 3, 6, 0, 1, 6, 4, 1, 6, 2, 0, 4, 2, 3, 4,
-	2, 5, 0, 5, 3, 5, 0, 4, 0, 6, 0, 6, 0, 4, 2, 4, 3, 0, 6, 1,
-	3, 1, 4, 3, 2, 3, 5, 4, 6, 0, 4, 1, 3, 2, 5, 4, 4, 3, 6, 3,
-	4, 6, 1, 3, 5, 2, 5, 1, 3, 6, 6, 3, 0, 6, 3, 3, 4, 5, 4, 5,
-	5, 1, 2, 5, 0, 5, 4, 5, 4, 6, 4, 0, 0, 4, 1, 0, 4, 5, 6, 2,
-	6, 2, 4, 3, 6, 5, 4, 6, 2, 0, 5, 6, 4, 0, 1, 0, 5, 0, 1, 5,
-	0, 3, 3, 2, 6, 2, 5, 0, 6, 5, 4, 0, 5, 4, 3, 2, 5, 5, 3, 2,
-	1, 0, 1, 0, 2, 4, 1, 0, 5, 1, 0, 5, 1, 4, 5, 5, 2, 6, 2, 3,
-	2, 0, 5, 1, 3, 6, 3, 0, 5, 2, 4, 0, 4, 3, 1, 2, 2, 4, 1, 0,
-	3, 2, 3, 6, 2, 4, 3, 6, 1, 5, 5, 2, 6, 0, 4, 6, 2, 6, 3, 3,
-	4, 3, 1, 0, 1, 0, 3, 2, 6, 3, 5, 0, 3, 0, 6, 2, 4, 2, 0, 5,
-	5, 0, 6, 0, 6, 2, 5, 2, 0, 1, 4, 5, 4, 0, 2, 0, 5, 6, 1, 2,
-	6, 3, 1, 0, 1, 6, 3, 0, 1, 4, 5, 0, 6, 4, 5, 5, 1, 0, 4, 6,
-	0, 2, 5, 2, 5, 0, 2, 6, 0, 1, 0, 2, 0, 6, 4, 2, 0, 3, 1, 0,
-	1, 1, 5, 3, 1, 3, 4, 4, 5, 0, 3, 1, 3, 6, 4, 6, 1, 4, 0, 3,
-	2, 0, 1, 2, 0, 2, 6, 1, 3, 5, 1, 2, 0, 6, 1, 1, 5, 1, 1, 6,
-	3, 5, 4, 5, 0, 3, 6, 0, 1, 5, 1, 5, 1, 3, 0, 4, 2, 5, 6, 0,
-	4, 4, 3, 1, 3, 4, 2, 3, 0, 3, 5, 4, 0, 3, 6, 5, 1, 0, 4, 1,
-	5, 1, 6, 0, 6, 4, 0, 2, 6, 4, 2, 5, 2, 5, 0, 4, 5, 2, 5, 3,
-	6, 2, 0, 4, 3, 5, 2, 5, 3, 3, 0, 2, 5, 6, 2, 3, 1, 5, 1, 4,
-	0, 6, 1, 0, 1, 4, 0, 1, 5, 4, 1, 1, 2, 4, 3, 0, 2, 5, 1, 2,
-	1, 6, 1, 4, 5, 4, 6, 5, 3, 5, 1, 1, 2, 4, 6, 3, 0, 2, 4, 2,
-	2, 5, 4, 6, 3, 5, 4, 6, 1, 5, 2, 1, 4, 3, 2, 5, 6, 4, 0, 2,
-	3, 1, 0, 4, 5, 4, 1, 5, 1, 0, 4, 1, 4, 6, 3, 4, 6, 5, 3, 5,
-	4, 1, 1, 3, 5, 0, 2, 4, 5, 0, 2, 0, 5, 1, 0, 3, 4, 2, 6, 3,
-	5, 1, 2, 3, 6, 5, 3, 4, 1, 0, 6, 2, 6, 5, 2, 1, 4, 2, 6, 1,
-	6, 3, 2, 1, 2, 0, 5, 3, 5, 4, 1, 0, 4, 5, 5, 6, 4, 6, 2, 2,
-	0, 1, 3, 0, 2, 1, 0, 5, 0, 3, 4, 4, 5, 3, 4, 1, 3, 2, 6, 1,
-	1, 1, 5, 3, 1, 0, 5, 3, 4, 3, 0, 2, 5, 2, 5, 6, 4, 4, 2, 0,
-	2, 4, 5, 4, 1, 2, 3, 4, 0, 2, 4, 0, 4, 1, 5, 3, 1, 5, 0, 1,
-	3, 2, 4, 2, 0, 2, 4, 2, 2, 2, 6, 1, 6, 4, 2, 4, 0, 1, 5, 6,
-	4, 4, 6, 0, 1, 5, 3, 6, 0, 2, 1, 2, 5, 1, 4, 2, 6, 3, 3, 6,
-	5, 2, 5, 6, 6, 1, 0, 4, 0, 6, 5, 1, 6, 3, 5, 5, 6, 0, 3, 0,
-	6, 6, 3, 6, 0, 4, 2, 1, 2, 4, 2, 1, 1, 1, 5, 3, 4, 0, 6, 6,
-	0, 1, 0, 3, 4, 6, 0, 5, 1, 6, 5, 6, 5, 4, 4, 3, 2, 6, 4, 3,
-	1, 5, 5, 2, 3, 5, 2, 6, 2, 1, 0, 4, 0, 0, 0, 1, 3, 6, 2, 3,
-	2, 5, 6, 0, 4, 2, 4, 6, 2, 1, 4, 2, 4, 6, 4, 2, 4, 3, 4, 3,
-	3, 5, 4, 6, 2, 5, 2, 0, 5, 6, 4, 3, 1, 0, 2, 2, 1, 6, 3, 5,
-	4, 1, 5, 4, 6, 3, 4, 2, 3, 2, 5, 5, 1, 4, 3, 1, 3, 4, 0, 6,
-	5, 0, 1, 4, 1, 2, 6, 2, 6, 1, 0, 6, 1, 2, 0, 6, 0, 4, 0, 5,
-	6, 0, 2, 5, 0, 1, 4, 5, 4, 6, 3, 0, 1, 2, 1, 3, 6, 5, 6, 0,
-	0, 5, 1, 4, 4, 5, 6, 5, 1, 4, 0, 6, 5, 2, 6, 4, 6, 0, 1, 2,
-	1, 6, 4, 6, 5, 0, 6, 4, 6, 2, 5, 1, 5, 4, 3, 0, 1, 6, 0, 4,
-	2, 0, 5, 1, 6, 2, 1, 3, 6, 4, 5, 1, 6, 2, 3, 4, 3, 3, 6, 2,
-	3, 3, 6, 0, 4, 2, 4, 1, 6, 0, 2, 5, 2, 1, 0, 5, 4, 3, 0, 3,
-	4, 1, 4, 4, 3, 0, 6, 2, 3, 1, 6, 2, 3, 4, 2, 5, 3, 5, 4, 5,
-	5, 0, 4, 2, 0, 5, 3, 2, 0, 3, 0, 5, 4, 6, 1, 1, 2, 0, 4, 5,
-	6, 3, 5, 4, 3, 2, 1, 6, 5, 6, 2, 0, 3, 1, 5, 6, 2, 2, 5, 3,
-	0, 1, 4, 3, 2, 0, 6, 1, 4, 2, 4, 0, 2, 3, 2, 3, 4, 0, 4, 6,
-	1, 0, 0, 4, 0, 4, 1, 2, 4, 1, 0, 5, 2, 4, 2, 3, 1, 6, 5, 1,
-	2, 4, 6, 5, 3, 6, 2, 3, 0, 3, 1, 3, 2, 6, 3, 4, 2, 6, 3, 6,
-	3, 2, 6, 0, 4, 5, 2, 5, 6, 2, 0, 1, 5, 3, 5, 2, 4, 1, 5, 6,
-	4, 2, 6, 6, 5, 4, 5, 6, 3, 2, 6, 0, 2, 5, 6, 1, 4, 1, 3, 2,
-	5, 1, 0, 2, 1, 0, 5, 2, 5, 2, 5, 2, 4, 5, 2, 1, 3, 0, 5, 6,
-	6, 4, 5, 6, 0, 4, 1, 3, 3, 4, 5, 0, 5, 0, 4, 3, 4, 0, 6, 3,
-	0, 2, 6, 3, 4, 6, 5, 0, 5, 4, 0, 2, 3, 5, 4, 2, 1, 0, 4, 0,
-	1, 5, 0, 1, 4, 4, 0, 6, 3, 6, 2, 0, 2, 5, 2, 0, 5, 1, 5, 3,
-	2, 0, 1, 1, 4, 3, 4, 3, 1, 2, 4, 3, 0, 5, 0, 6, 3, 4, 5, 3,
-	3, 1, 6, 1, 3, 0, 2, 0, 4, 1, 2, 1, 0, 0, 1, 6, 1, 6, 3, 3,
-	4, 1, 4, 0, 3, 5, 3, 5, 1, 5, 3, 4, 6, 6, 4, 2, 5, 0, 2, 3,
-	5, 4, 2, 1, 4, 1, 0, 4, 2, 1, 3, 2, 4, 6, 1, 6, 4, 5, 0, 1,
-	6, 2, 1, 5, 6, 4, 5, 1, 0, 2, 1, 6, 5, 2, 0, 3, 5, 3, 6, 5,
-	0, 1, 1, 2, 4, 2, 5, 6, 2, 1, 5, 0, 1, 2, 3, 6, 1, 5, 0, 4,
-	1, 2, 0, 6, 5, 6, 3, 1, 6, 1, 5, 6, 1, 3, 1, 3, 5, 3, 1, 4,
-	2, 0, 5, 0, 3, 5, 1, 2, 3, 4, 6, 4, 3, 3, 5, 2, 6, 4, 3, 3,
-	3, 2, 4, 6, 4, 5, 0, 6, 3, 2, 4, 0, 2, 3, 0, 6, 2, 4, 5, 2,
-	4, 2, 4, 3, 2, 6, 1, 0, 3, 5, 3, 6, 5, 6, 3, 2, 5, 3, 4, 3,
-	5, 0, 6, 1, 0, 2, 4, 5, 4, 5, 4, 4, 3, 5, 1, 4, 5, 6, 1, 6,
-	6, 0, 4, 5, 4, 5, 6, 3, 2, 4, 0, 4, 5, 3, 5, 3, 5, 2, 2, 1,
-	0, 2, 4, 5, 3, 5, 6, 2, 5, 0, 1, 1, 0, 5, 1, 3, 5, 0, 6, 2,
-	1, 4, 5, 1, 5, 4, 5, 0, 6, 1, 0, 2, 5, 1, 3, 0, 6, 4, 5, 6,
-	2, 0, 5, 0, 1, 3, 5, 0, 1, 4, 3, 6, 4, 0, 4, 0, 3, 2, 4, 2,
-	3, 0, 2, 5, 2, 3, 6, 4, 1, 0, 3, 3, 2, 4, 6, 1, 3, 2, 5, 2,
-	4, 0, 5, 4, 0, 6, 3, 2, 6, 2, 3, 4, 3, 2, 1, 1, 3, 1, 3, 4,
-	5, 1, 0, 0, 3, 5, 6, 6, 0, 1, 4, 0, 3, 0, 2, 0, 5, 2, 3, 0,
-	6, 3, 0, 1, 0, 2, 2, 3, 5, 1, 3, 2, 4, 5, 6, 1, 5, 1, 4, 5,
-	0, 2, 1, 2, 2, 1, 2, 1, 3, 4, 6, 1, 3, 6, 3, 1, 1, 6, 4, 2,
-	1, 3, 0, 1, 5, 4, 0, 6, 4, 5, 4, 0, 6, 5, 1, 5, 5, 4, 3, 2,
-	2, 1, 6, 4, 1, 5, 6, 5, 1, 2, 0, 5, 1, 2, 4, 6, 0, 3, 4, 1,
-	3, 0, 4, 6, 3, 1, 2, 3, 2, 4, 6, 1, 5, 3, 0, 4, 6, 6, 4, 1,
-	4, 6, 2, 6, 5, 0, 4, 1, 4, 1, 3, 2, 4, 2, 2, 1, 3, 4, 5, 1,
-	5, 0, 5, 0, 1, 4, 3, 1, 0, 5, 2, 1, 6, 5, 6, 0, 2, 3, 4, 1,
-	6, 3, 5, 4, 3, 6, 3, 1, 0, 3, 0, 1, 0, 1, 6, 4, 0, 6, 1, 0,
-	0, 0, 3, 4, 0, 4, 2, 3, 1, 5, 3, 3, 6, 4, 3, 6, 1, 0, 4, 0,
-	1, 5, 6, 5, 5, 4, 3, 1, 5, 6, 2, 5, 0, 2, 2, 0, 5, 4, 5, 1,
-	2, 0, 5, 6, 5, 0, 1, 4, 0, 3, 6, 3, 4, 6, 3, 0, 3, 2, 0, 4,
-	3, 5, 4, 1, 2, 1, 1, 0, 6, 2, 5, 2, 3, 5, 2, 6, 4, 5, 0, 6,
-	4, 0, 3, 0, 5, 1, 5, 2, 2, 0, 3, 4, 0, 3, 2, 6, 6, 1, 3, 6,
-	5, 6, 2, 1, 0, 6, 2, 3, 1, 2, 0, 2, 4, 3, 3, 2, 6, 0, 0, 6,
-	6, 1, 0, 6, 2, 3, 3, 4, 6, 0, 6, 6, 0, 1, 5, 6, 4, 2, 4, 2,
-	0, 0, 4, 2, 1, 4, 5, 4, 0, 4, 2, 6, 5, 6, 4, 5, 2, 3, 5, 6,
-	1, 4, 2, 5, 1, 0, 2, 5, 2, 6, 0, 1, 2, 6, 0, 1, 3, 1, 6, 1,
-	2, 5, 6, 2, 1, 4, 3, 2, 3, 0, 4, 6, 4, 2, 6, 5, 2, 4, 4, 0,
-	3, 4, 5, 2, 4, 3, 6, 2, 4, 3, 5, 2, 1, 3, 1, 4, 6, 5, 3, 1,
-	4, 5, 3, 1, 3, 0, 2, 0, 2, 1, 2, 3, 2, 4, 5, 4, 5, 6, 0, 6,
-	5, 4, 2, 0, 2, 6, 1, 3, 2, 0, 1, 6, 0, 1, 2, 5, 2, 2, 5, 2,
-	6, 6, 3, 1, 5, 2, 0, 4, 2, 4, 3, 1, 3, 1, 2, 6, 5, 6, 1, 3,
-	0, 6, 1, 1, 5, 2, 0, 5, 1, 3, 6, 2, 1, 3, 6, 1, 6, 0, 2, 0,
-	1, 2, 5, 1, 0, 2, 3, 3, 4, 3, 0, 5, 2, 1, 1, 6, 3, 2, 3, 2,
-	2, 5, 4, 5, 2, 3, 6, 2, 1, 4, 2, 3, 5, 4, 5, 2, 5, 4, 3, 3,
-	3, 4, 2, 3, 4, 4, 3, 5, 6, 1, 6, 2, 4, 2, 1, 3, 6, 4, 1, 3,
-	4, 1, 2, 1, 3, 4, 2, 1, 2, 0, 5, 6, 4, 0, 2, 1, 2, 2, 0, 6,
-	5, 2, 5, 4, 6, 4, 1, 4, 3, 2, 2, 0, 1, 6, 0, 6, 2, 1, 2, 6,
-	6, 5, 3, 6, 1, 3, 4, 6, 3, 3, 6, 2, 4, 5, 6, 3, 4, 0, 5, 1,
-	0, 5, 3, 4, 5, 0, 6, 1, 1, 6, 2, 0, 4, 0, 3, 4, 0, 5, 2, 0,
-	1, 6, 2, 6, 1, 1, 2, 6, 0, 6, 4, 1, 5, 3, 4, 3, 2, 1, 0, 3,
-	2, 0, 5, 2, 5, 2, 6, 0, 5, 3, 2, 6, 2, 4, 3, 2, 0, 2, 4, 1,
-	3, 5, 0, 1, 6, 1, 3, 2, 4, 6, 1, 4, 5, 2, 5, 3, 0, 5, 6, 4,
-	4, 1, 0, 1, 3, 6, 2, 0, 6, 2, 3, 0, 3, 1, 5, 4, 1, 2, 5, 3,
-	5, 2, 3, 6, 3, 2, 6, 0, 6, 5, 0, 2, 1, 5, 1, 4, 3, 3, 1, 6,
-	6, 2, 3, 5, 0, 4, 6, 3, 5, 4, 3, 2, 4, 0, 2, 1, 4, 1, 2, 4,
-	0, 2, 2, 0, 1, 4, 2, 3, 6, 3, 0, 3, 2, 4, 0, 6, 1, 6, 4, 2,
-	1, 5, 1, 0, 5, 6, 3, 3, 6, 1, 1, 2, 5, 2, 5, 0, 6, 2, 0, 2,
-	2, 6, 2, 5, 1, 2, 5, 6, 5, 0, 2, 4, 4, 3, 1, 3, 0, 5, 3, 2,
-	3, 1, 2, 4, 5, 6, 6, 2, 6, 3, 4, 5, 3, 5, 6, 3, 4, 2, 1, 6,
-	4, 1, 2, 4, 2, 1, 0, 4, 6, 2, 4, 0, 6, 4, 3, 0, 5, 3, 0, 0,
-	5, 0, 6, 0, 3, 2, 1, 2, 3, 0, 6, 6, 1, 4, 1, 6, 3, 5, 4, 2,
-	6, 4, 1, 4, 6, 1, 3, 0, 6, 4, 2, 3, 4, 4, 1, 3, 5, 4, 2, 6,
-	0, 3, 0, 6, 0, 6, 5, 4, 4, 0, 6, 5, 3, 4, 1, 2, 1, 6, 3, 2,
-	1, 5, 3, 0, 0, 6, 5, 3, 4, 3, 5, 4, 1, 4, 0, 2, 1, 2, 5, 2,
-	2, 0, 6, 5, 1, 4, 2, 3, 4, 6, 6, 2, 4, 3, 2, 3, 2, 0, 6, 3,
-	3, 0, 2, 6, 1, 3, 5, 4, 5, 3, 5, 2, 6, 0, 3, 0, 6, 4, 0, 2,
-	4, 2, 0, 5, 3, 4, 5, 0, 4, 6, 2, 1, 4, 6, 4, 3, 2, 0, 1, 5,
-	5, 2, 0, 5, 2, 1, 6, 2, 0, 5, 0, 6, 2, 3, 6, 1, 2, 6, 2, 5,
-	6, 2, 0, 2, 4, 5, 3, 4, 5, 1, 5, 1, 2, 0, 5, 3, 1, 4, 0, 6,
-	0, 1, 3, 4, 6, 2, 5, 3, 6, 4, 0, 2, 6, 4, 2, 1, 3, 4, 5, 6,
-	1, 4, 2, 3, 5, 1, 3, 3, 1, 6, 2, 6, 2, 1, 4, 6, 4, 5, 6, 4,
-	2, 0, 1, 5, 6, 5, 1, 0, 3, 0, 3, 2, 4, 2, 3, 5, 6, 3, 1, 0,
-	3, 5, 2, 4, 1, 5, 2, 0, 4, 3, 1, 3, 3, 4, 5, 5, 2, 5, 1, 1,
-	4, 0, 2, 0, 1, 5, 3, 6, 2, 0, 6, 3, 6, 2, 4, 0, 2, 1, 0, 5,
-	5, 1, 1, 5, 1, 6, 3, 6, 4, 6, 1, 2, 5, 5, 2, 5, 4, 1, 0, 5,
-	6, 0, 3, 0, 1, 5, 1, 4, 5, 1, 0, 6, 6, 6, 3, 0, 4, 5, 1, 6,
-	0, 1, 5, 4, 0, 5, 6, 5, 1, 3, 0, 4, 2, 6, 1, 5, 0, 2, 5, 6,
-	1, 5, 4, 5, 6, 1, 5, 0, 3, 5, 3, 2, 4, 6, 0, 6, 0, 3, 2, 6,
-	2, 0, 1, 3, 6, 4, 2, 1, 0, 2, 4, 0, 4, 3, 3, 4, 3, 1, 0, 3,
-	3, 6, 3, 1, 2, 0, 2, 4, 0, 5, 3, 2, 1, 0, 4, 1, 3, 5, 4, 0,
-	4, 1, 5, 2, 1, 2, 5, 0, 3, 5, 1, 5, 3, 4, 0, 2, 5, 5, 2, 1,
-	5, 5, 6, 1, 3, 5, 1, 2, 1, 4, 3, 4, 3, 0, 6, 4, 1, 3, 2, 0,
-	6, 1, 2, 6, 4, 5, 6, 0, 6, 1, 3, 2, 1, 2, 6, 2, 1, 3, 4, 3,
-	0, 1, 0, 3, 5, 1, 6, 5, 1, 4, 2, 4, 2, 3, 1, 4, 6, 2, 1, 0,
-	1, 6, 0, 6, 3, 3, 0, 4, 6, 2, 1, 2, 0, 1, 0, 4, 6, 5, 0, 1,
-	2, 5, 4, 0, 3, 6, 3, 0, 6, 2, 6, 2, 2, 3, 0, 4, 0, 2, 5, 6,
-	3, 6, 4, 0, 1, 3, 1, 5, 0, 2, 6, 2, 6, 1, 0, 5, 6, 4, 1, 5,
-	4, 3, 0, 6, 3, 2, 1, 2, 6, 0, 1, 4, 6, 0, 5, 3, 1, 5, 2, 4,
-	5, 1, 2, 6, 4, 4, 3, 2, 3, 3, 5, 3, 3, 1, 4, 2, 5, 0, 0, 3,
-	6, 0, 1, 2, 4, 5, 2, 0, 5, 1, 5, 6, 0, 5, 1, 6, 2, 4, 3, 0,
-	0, 5, 0, 3, 1, 4, 5, 6, 4, 3, 1, 0, 3, 4, 2, 1, 2, 0, 3, 2,
-	1, 6, 3, 1, 2, 4, 1, 6, 4, 6, 3, 1, 0, 5, 3, 2, 1, 2, 3, 0,
-	2, 5, 4, 2, 1, 3, 1, 2, 4, 3, 2, 1, 4, 1, 2, 3, 2, 4, 6, 2,
-	3, 2, 0, 4, 0, 4, 6, 5, 3, 2, 5, 3, 4, 0, 1, 6, 3, 0, 4, 2,
-	4, 3, 2, 5, 4, 5, 1, 2, 0, 3, 0, 3, 2, 3, 1, 4, 1, 6, 5, 0,
-	5, 4, 1, 5, 4, 2, 5, 4, 3, 0, 2, 0, 1, 2, 1, 4, 6, 0, 1, 0,
-	6, 5, 1, 5, 4, 0, 3, 2, 3, 1, 1, 4, 1, 5, 2, 3, 1, 6, 4, 0,
-	0, 2, 0, 2, 0, 3, 2, 5, 4, 6, 2, 3, 1, 3, 0, 1, 2, 1, 2, 4,
-	1, 3, 5, 0, 5, 3, 4, 5, 2, 3, 0, 2, 3, 6, 4, 2, 6, 3, 3, 4,
-	2, 6, 3, 2, 3, 1, 6, 4, 3, 5, 6, 4, 5, 2, 1, 3, 0, 1, 2, 4,
-	3, 5, 0, 4, 6, 1, 2, 5, 4, 1, 3, 5, 2, 0, 3, 4, 3, 6, 6, 5,
-	4, 0, 3, 3, 4, 2, 1, 5, 2, 1, 1, 6, 1, 2, 5, 0, 3, 0, 1, 4,
-	5, 4, 5, 0, 1, 2, 6, 4, 0, 6, 3, 4, 2, 6, 4, 3, 2, 4, 6, 5,
-	6, 1, 6, 2, 0, 2, 1, 4, 6, 4, 5, 2, 0, 0, 6, 4, 5, 5, 3, 0,
-	0, 6, 4, 3, 5, 2, 3, 5, 4, 2, 6, 4, 3, 1, 3, 6, 2, 5, 3, 6,
-	1, 0, 1, 2, 4, 3, 1, 4, 0, 1, 2, 5, 1, 1, 0, 3, 2, 0, 5, 0,
-	2, 3, 6, 4, 1, 6, 0, 4, 3, 4, 3, 4, 1, 0, 4, 3, 2, 0, 4, 6,
-	3, 5, 1, 6, 2, 3, 4, 1, 0, 2, 4, 2, 1, 6, 4, 4, 3, 2, 1, 3,
-	4, 6, 3, 0, 4, 5, 6, 5, 1, 0, 4, 0, 5, 0, 4, 6, 1, 0, 6, 5,
-	5, 0, 1, 4, 6, 1, 5, 3, 4, 1, 0, 1, 6, 3, 4, 3, 6, 2, 4, 6,
-	6, 4, 5, 4, 6, 4, 6, 4, 6, 0, 0, 3, 2, 5, 2, 3, 4, 6, 4, 1,
-	0, 3, 5, 4, 1, 0, 1, 0, 1, 2, 3, 5, 2, 6, 0, 6, 2, 3, 5, 2,
-	1, 5, 6, 3, 0, 3, 1, 2, 4, 5, 3, 4, 5, 3, 0, 2, 6, 3, 0, 6,
-	2, 0, 5, 4, 3, 3, 4, 2, 0, 5, 2, 5, 0, 1, 0, 3, 2, 4, 5, 3,
-	3, 2, 3, 0, 1, 5, 1, 5, 3, 2, 3, 5, 6, 4, 2, 5, 2, 0, 4, 0,
-	4, 6, 2, 4, 6, 3, 0, 3, 4, 1, 4, 0, 1, 4, 1, 5, 3, 4, 5, 1,
-	5, 1, 6, 4, 5, 1, 4, 6, 4, 0, 5, 1, 0, 4, 3, 4, 1, 6, 5, 3,
-	6, 3, 0, 5, 6, 6, 1, 0, 2, 3, 2, 6, 1, 4, 3, 1, 3, 0, 6, 1,
-	0, 4, 2, 3, 4, 6, 2, 6, 1, 4, 4, 2, 6, 1, 0, 3, 1, 0, 3, 1,
-	1, 3, 1, 2, 4, 3, 0, 2, 0, 4, 3, 4, 0, 6, 0, 1, 4, 0, 3, 5,
-	2, 0, 6, 4, 2, 1, 4, 0, 2, 5, 6, 2, 5, 1, 5, 4, 5, 0, 6, 6,
-	3, 0, 2, 5, 6, 2, 5, 3, 1, 6, 4, 5, 5, 0, 6, 4, 3, 6, 3, 1,
-	4, 2, 5, 0, 5, 0, 4, 6, 1, 5, 1, 0, 5, 4, 5, 0, 5, 2, 4, 5,
-	5, 1, 5, 6, 4, 5, 0, 1, 4, 2, 3, 1, 0, 4, 3, 5, 5, 6, 5, 2,
-	6, 0, 0, 6, 0, 6, 4, 5, 0, 2, 4, 1, 6, 4, 3, 0, 6, 1, 5, 1,
-	0, 1, 5, 2, 4, 2, 6, 4, 6, 4, 2, 5, 0, 3, 1, 0, 5, 2, 4, 1,
-	1, 6, 1, 3, 1, 6, 5, 4, 6, 1, 2, 1, 6, 5, 0, 4, 6, 0, 5, 3,
-	2, 0, 1, 2, 6, 1, 0, 4, 5, 2, 0, 2, 5, 0, 6, 3, 5, 0, 4, 6,
-	3, 3, 5, 6, 5, 0, 6, 3, 0, 6, 3, 0, 3, 4, 1, 2, 3, 1, 1, 6,
-	4, 2, 0, 1, 6, 1, 5, 3, 6, 1, 6, 4, 5, 4, 3, 1, 4, 3, 1, 3,
-	5, 6, 0, 1, 6, 2, 4, 5, 5, 1, 3, 1, 2, 5, 5, 1, 1, 6, 2, 0,
-	6, 5, 2, 1, 5, 1, 6, 0, 1, 6, 4, 2, 5, 1, 0, 2, 3, 2, 5, 1,
-	0, 2, 6, 4, 5, 0, 2, 5, 0, 1, 5, 1, 4, 6, 4, 5, 1, 5, 4, 1,
-	1, 0, 1, 6, 2, 4, 5, 0, 5, 1, 0, 2, 5, 6, 3, 1, 3, 0, 4, 2,
-	2, 1, 3, 4, 0, 6, 6, 1, 2, 4, 2, 5, 2, 5, 2, 3, 2, 5, 2, 2,
-	3, 2, 6, 5, 2, 4, 5, 3, 1, 0, 2, 6, 4, 6, 2, 6, 2, 0, 1, 0,
-	4, 3, 2, 1, 2, 6, 0, 1, 0, 3, 6, 2, 1, 6, 3, 2, 0, 4, 2, 6,
-	5, 2, 5, 1, 4, 3, 4, 0, 6, 1, 6, 5, 2, 3, 4, 1, 2, 6, 3, 6,
-	6, 0, 2, 0, 4, 1, 2, 2, 3, 6, 5, 1, 3, 5, 3, 0, 1, 1, 3, 2,
-	0, 2, 3, 5, 3, 2, 6, 1, 5, 4, 6, 4, 5, 3, 2, 1, 2, 1, 4, 6,
-	1, 2, 0, 6, 2, 4, 3, 1, 4, 5, 3, 4, 1, 6, 4, 2, 3, 4, 1, 0,
-	2, 6, 4, 2, 0, 4, 0, 6, 0, 5, 4, 5, 1, 4, 5, 1, 5, 2, 1, 6,
-	3, 1, 4, 3, 2, 1, 5, 0, 2, 5, 2, 0, 1, 3, 6, 5, 1, 3, 4, 2,
-	4, 2, 5, 4, 5, 4, 0, 4, 3, 0, 3, 4, 5, 2, 0, 1, 6, 2, 4, 3,
-	5, 4, 2, 0, 2, 5, 5, 4, 0, 4, 0, 6, 0, 1, 1, 4, 0, 4, 2, 3,
-	6, 2, 0, 6, 0, 2, 5, 2, 3, 0, 3, 2, 3, 4, 5, 4, 3, 2, 1, 0,
-	0, 5, 3, 2, 5, 1, 4, 2, 0, 2, 6, 0, 2, 0, 4, 3, 3, 1, 3, 1,
-	1, 5, 1, 5, 2, 3, 2, 0, 5, 4, 5, 4, 1, 3, 4, 5, 2, 4, 3, 0,
-	2, 0, 5, 6, 0, 3, 2, 1, 4, 1, 3, 2, 1, 5, 2, 1, 4, 3, 4, 3,
-	3, 5, 0, 6, 5, 3, 1, 4, 5, 0, 3, 0, 3, 2, 6, 0, 6, 2, 1, 2,
-	4, 2, 5, 2, 0, 6, 0, 1, 2, 4, 5, 6, 3, 4, 2, 3, 5, 5, 6, 2,
-	5, 5, 5, 3, 6, 1, 6, 3, 6, 0, 4, 0, 3, 4, 1, 0, 2, 3, 0, 5,
-	6, 2, 6, 0, 2, 6, 3, 6, 1, 0, 1, 6, 2, 4, 0, 6, 2, 1, 6, 5,
-	0, 6, 2, 4, 4, 2, 6, 1, 6, 3, 3, 2, 3, 1, 5, 3, 5, 5, 4, 5,
-	1, 1, 2, 0, 2, 1, 6, 2, 5, 4, 1, 4, 2, 1, 3, 6, 1, 6, 2, 1,
-	2, 4, 3, 6, 3, 0, 3, 4, 0, 0, 5, 6, 4, 2, 6, 0, 1, 0, 5, 3,
-	3, 6, 0, 5, 2, 5, 0, 2, 5, 3, 4, 6, 2, 6, 1, 4, 3, 5, 0, 4,
-	4, 1, 2, 1, 3, 2, 3, 2, 6, 2, 0, 5, 6, 1, 6, 5, 4, 0, 1, 0,
-	5, 6, 2, 6, 0, 2, 5, 1, 6, 4, 5, 5, 2, 3, 4, 2, 6, 2, 3, 2,
-	6, 4, 3, 4, 4, 1, 5, 1, 6, 3, 6, 5, 6, 2, 4, 2, 1, 4, 6, 2,
-	0, 1, 6, 4, 3, 4, 2, 5, 4, 1, 4, 6, 2, 0, 1, 5, 1, 6, 0, 6,
-	1, 5, 0, 2, 3, 6, 3, 5, 1, 0, 3, 6, 1, 0, 6, 5, 6, 4, 6, 3,
-	2, 6, 0, 4, 4, 1, 3, 2, 4, 1, 0, 3, 6, 4, 1, 0, 3, 6, 2, 1,
-	3, 0, 3, 2, 2, 0, 3, 0, 1, 4, 0, 6, 3, 2, 0, 4, 6, 3, 1, 1,
-	4, 3, 3, 0, 2, 1, 5, 4, 1, 0, 4, 3, 0, 5, 4, 2, 3, 6, 1, 2,
-	5, 5, 1, 0, 4, 1, 6, 4, 0, 5, 0, 6, 4, 3, 2, 4, 2, 5, 3, 6,
-	6, 1, 3, 5, 4, 6, 0, 5, 4, 0, 1, 5, 1, 2, 0, 5, 1, 5, 1, 3,
-	0, 5, 3, 1, 0, 3, 1, 5, 2, 3, 4, 5, 6, 1, 2, 4, 4, 6, 2, 1,
-	1, 2, 1, 3, 1, 1, 1, 6, 3, 1, 2, 0, 4, 2, 0, 0, 6, 2, 4, 1,
-	2, 6, 3, 2, 1, 5, 4, 5, 4, 0, 5, 1, 4, 5, 6, 1, 5, 6, 2, 6,
-	3, 6, 3, 0, 1, 3, 1, 4, 2, 1, 3, 6, 2, 5, 1, 3, 2, 4, 2, 3,
-	4, 1, 6, 0, 5, 2, 4, 2, 3, 1, 0, 4, 3, 1, 0, 3, 5, 1, 2, 1,
-	5, 4, 3, 6, 5, 1, 4, 6, 2, 4, 0, 4, 4, 6, 3, 5, 2, 3, 1, 2,
-	6, 6, 3, 5, 2, 0, 6, 1, 3, 2, 3, 4, 1, 5, 2, 3, 6, 0, 4, 5,
-	0, 4, 2, 6, 2, 0, 5, 2, 0, 0, 5, 1, 3, 5, 1, 6, 5, 0, 6, 4,
-	1, 6, 4, 1, 6, 4, 6, 4, 6, 2, 4, 1, 0, 4, 5, 1, 2, 5, 1, 5,
-	2, 4, 5, 3, 1, 3, 6, 4, 6, 3, 0, 2, 5, 4, 0, 6, 4, 0, 1, 5,
-	3, 6, 5, 1, 6, 5, 2, 4, 0, 5, 0, 1, 0, 1, 0, 4, 0, 4, 5, 0,
-	4, 6, 0, 6, 5, 0, 3, 6, 4, 0, 1, 4, 1, 6, 5, 4, 0, 3, 5, 2,
-	5, 4, 1, 2, 4, 3, 0, 4, 3, 4, 6, 2, 0, 4, 6, 1, 2, 5, 2, 1,
-	6, 4, 3, 6, 2, 3, 2, 6, 5, 6, 4, 6, 4, 5, 3, 4, 1, 6, 0, 2,
-	0, 0, 0, 6, 2, 0, 4, 1, 2, 6, 0, 3, 1, 4, 3, 1, 0, 1, 0, 6,
-	1, 2, 4, 0, 6, 6, 5, 2, 3, 0, 4, 3, 6, 3, 1, 0, 5, 6, 2, 2,
-	2, 3, 0, 2, 1, 2, 6, 5, 0, 4, 0, 6, 3, 2, 3, 2, 5, 4, 2, 2,
-	3, 2, 4, 5, 6, 2, 4, 2, 6, 4, 5, 4, 1, 1, 3, 0, 5, 4, 6, 2,
-	4, 1, 2, 5, 0, 0, 1, 2, 4, 5, 4, 0, 5, 5, 0, 6, 3, 5, 6, 4,
-	5, 2, 4, 3, 0, 1, 5, 6, 0, 4, 3, 0, 5, 1, 0, 4, 0, 2, 6, 2,
-	6, 4, 3, 0, 5, 0, 4, 6, 3, 5, 1, 4, 0, 4, 1, 0, 2, 4, 2, 3,
-	0, 5, 6, 6, 3, 6, 2, 6, 2, 6, 3, 6, 5, 3, 4, 3, 5, 2, 5, 1,
-	1, 2, 0, 1, 2, 4, 0, 5, 1, 6, 1, 2, 0, 3, 6, 1, 2, 6, 6, 2,
-	2, 1, 0, 6, 1, 6, 5, 2, 3, 4, 3, 5, 2, 4, 2, 3, 2, 5, 0, 3,
-	3, 3, 1, 4, 3, 0, 5, 1, 5, 6, 0, 3, 1, 3, 0, 3, 5, 0, 3, 4,
-	4, 3, 5, 4, 5, 2, 3, 1, 3, 5, 0, 5, 3, 1, 5, 0, 1, 2, 1, 4,
-	5, 1, 6, 3, 2, 2, 0, 6, 1, 0, 3, 2, 1, 4, 1, 0, 5, 2, 3, 5,
-	6, 0, 1, 2, 0, 5, 3, 2, 4, 0, 1, 4, 0, 4, 3, 0, 3, 3, 1, 3,
-	0, 2, 0, 5, 3, 3, 6, 2, 1, 4, 3, 2, 4, 3, 0, 5, 6, 4, 5, 4,
-	1, 3, 2, 3, 2, 3, 3, 0, 1, 4, 0, 5, 6, 4, 3, 3, 5, 2, 1, 1,
-	2, 4, 0, 4, 6, 4, 5, 1, 1, 2, 5, 1, 2, 3, 2, 2, 6, 4, 1, 0,
-	3, 3, 1, 0, 2, 3, 4, 5, 0, 4, 1, 2, 6, 5, 0, 6, 5, 1, 2, 0,
-	4, 6, 5, 6, 2, 1, 0, 1, 1, 2, 3, 4, 6, 2, 1, 6, 2, 4, 3, 5,
-	5, 4, 0, 3, 1, 3, 6, 2, 6, 3, 2, 5, 6, 0, 1, 3, 2, 6, 0, 2,
-	6, 1, 0, 3, 0, 4, 3, 3, 3, 1, 1, 4, 0, 2, 6, 2, 0, 6, 4, 0,
-	0, 2, 0, 1, 0, 3, 6, 1, 0, 1, 2, 0, 1, 6, 5, 1, 4, 3, 1, 0,
-	1, 3, 2, 3, 4, 0, 5, 3, 4, 3, 4, 6, 1, 3, 4, 4, 2, 5, 0, 5,
-	2, 1, 3, 0, 2, 4, 3, 1, 0, 6, 4, 5, 6, 2, 6, 1, 5, 3, 5, 4,
-	3, 0, 2, 1, 6, 1, 3, 0, 1, 6, 5, 0, 4, 6, 1, 0, 6, 3, 3, 2,
-	4, 4, 0, 4, 2, 5, 4, 5, 2, 5, 0, 6, 3, 2, 5, 4, 1, 2, 0, 6,
-	5, 4, 2, 6, 1, 3, 3, 0, 4, 3, 1, 5, 0, 6, 3, 6, 0, 4, 2, 1,
-	6, 4, 5, 6, 5, 1, 4, 5, 1, 6, 2, 1, 3, 5, 4, 2, 4, 3, 3, 2,
-	0, 2, 5, 0, 5, 4, 0, 4, 5, 1, 3, 4, 3, 1, 5, 3, 6, 4, 2, 3,
-	1, 4, 3, 1, 1, 0, 5, 4, 6, 2, 4, 3, 6, 3, 2, 5, 1, 6, 5, 1,
-	2, 4, 0, 6, 4, 3, 0, 5, 3, 2, 5, 2, 4, 5, 3, 2, 2, 1, 5, 4,
-	3, 5, 0, 4, 5, 3, 0, 3, 4, 0, 2, 0, 4, 2, 6, 1, 2, 4, 2, 5,
-	4, 0, 1, 2, 6, 0, 4, 2, 5, 4, 0, 6, 4, 5, 3, 6, 1, 3, 3, 3,
-	5, 3, 2, 0, 2, 3, 1, 5, 1, 5, 6, 3, 6, 5, 1, 0, 4, 0, 6, 5,
-	6, 5, 1, 0, 2, 6, 2, 3, 3, 6, 4, 2, 6, 3, 6, 4, 1, 4, 2, 4,
-	0, 3, 1, 5, 0, 3, 6, 1, 4, 2, 5, 6, 1, 1, 4, 2, 3, 2, 3, 1,
-	1, 6, 3, 1, 6, 2, 4, 1, 5, 3, 5, 3, 5, 2, 5, 6, 5, 2, 2, 1,
-	2, 4, 6, 0, 4, 0, 4, 0, 2, 1, 4, 0, 3, 5, 3, 1, 3, 3, 6, 4,
-	3, 0, 6, 4, 6, 2, 2, 4, 2, 0, 5, 0, 5, 0, 4, 6, 4, 2, 5, 1,
-	4, 2, 4, 5, 6, 3, 6, 0, 1, 1, 5, 2, 4, 3, 4, 6, 2, 6, 5, 0,
-	5, 0, 2, 6, 0, 6, 3, 0, 4, 0, 5, 0, 3, 2, 1, 1, 5, 4, 2, 4,
-	6, 0, 6, 3, 3, 6, 3, 1, 4, 0, 3, 6, 0, 5, 4, 0, 0, 5, 1, 5,
-	0, 2, 4, 5, 2, 1, 5, 5, 3, 1, 5, 0, 3, 1, 2, 4, 2, 6, 1, 1,
-	1, 0, 1, 0, 1, 4, 1, 4, 5, 4, 2, 1, 6, 0, 5, 2, 5, 4, 2, 1,
-	2, 6, 2, 0, 1, 4, 6, 0, 2, 3, 3, 1, 1, 3, 2, 6, 0, 5, 0, 3,
-	3, 4, 2, 4, 6, 2, 6, 2, 0, 1, 6, 1, 0, 6, 1, 5, 1, 5, 3, 6,
-	4, 0, 2, 0, 6, 0, 4, 6, 1, 4, 2, 0, 1, 0, 6, 3, 6, 5, 1, 2,
-	5, 0, 4, 6, 4, 0, 1, 3, 6, 5, 1, 6, 4, 6, 2, 0, 4, 5, 6, 4,
-	6, 5, 1, 5, 6, 5, 3, 5, 1, 0, 6, 0, 3, 1, 0, 2, 0, 4, 2, 1,
-	0, 5, 4, 2, 2, 0, 3, 4, 1, 2, 0, 5, 3, 2, 6, 5, 6, 4, 6, 1,
-	1, 2, 3, 4, 2, 4, 2, 1, 0, 6, 5, 2, 3, 1, 4, 3, 0, 1, 3, 0,
-	2, 6, 3, 2, 0, 4, 0, 6, 4, 1, 1, 4, 3, 3, 2, 4, 1, 4, 2, 4,
-	3, 6, 6, 5, 3, 4, 0, 1, 3, 2, 3, 2, 4, 0, 6, 5, 2, 1, 5, 0,
-	4, 0, 1, 4, 6, 2, 6, 4, 2, 5, 1, 6, 2, 4, 5, 0, 3, 1, 3, 0,
-	5, 0, 6, 2, 3, 5, 6, 1, 6, 2, 2, 4, 6, 0, 2, 6, 2, 0, 4, 1,
-	6, 2, 1, 6, 2, 3, 0, 2, 5, 0, 6, 1, 1, 1, 1, 6, 3, 2, 2, 4,
-	0, 2, 6, 0, 1, 0, 2, 1, 0, 3, 4, 4, 6, 3, 3, 3, 4, 2, 5, 5,
-	1, 3, 5, 0, 3, 4, 3, 1, 2, 0, 3, 2, 2, 1, 5, 6, 2, 6, 2, 0,
-	2, 3, 6, 1, 3, 6, 3, 4, 4, 3, 4, 5, 4, 0, 6, 3, 2, 1, 5, 0,
-	3, 6, 5, 1, 4, 0, 6, 5, 6, 4, 2, 3, 3, 2, 4, 6, 2, 1, 6, 4,
-	4, 3, 2, 0, 5, 6, 0, 5, 2, 0, 5, 4, 3, 6, 2, 5, 6, 5, 4, 3,
-	5, 4, 1, 0, 2, 4, 4, 0, 2, 5, 6, 2, 2, 4, 6, 2, 0, 6, 2, 1,
-	6, 5, 1, 3, 1, 2, 3, 1, 4, 0, 5, 5, 2, 1, 5, 3, 1, 4, 4, 4,
-	0, 2, 5, 5, 5, 2, 3, 6, 5, 0, 1, 0, 6, 3, 4, 6, 1, 3, 5, 6,
-	1, 0, 3, 1, 2, 4, 6, 0, 1, 0, 5, 6, 2, 3, 0, 6, 4, 1, 4, 3,
-	2, 3, 0, 3, 2, 3, 0, 3, 0, 1, 3, 1, 1, 2, 1, 0, 2, 6, 0, 0,
-	3, 2, 6, 3, 0, 0, 4, 1, 5, 5, 1, 6, 4, 2, 4, 2, 5, 6, 4, 0,
-	4, 2, 3, 4, 2, 0, 1, 5, 0, 4, 4, 3, 6, 0, 4, 1, 0, 2, 1, 1,
-	5, 1, 3, 4, 6, 0, 5, 4, 0, 2, 1, 5, 2, 4, 1, 2, 6, 5, 4, 2,
-	6, 5, 4, 6, 1, 0, 6, 5, 6, 3, 4, 2, 1, 3, 5, 1, 6, 5, 3, 5,
-	0, 5, 4, 6, 4, 0, 4, 0, 5, 6, 3, 4, 6, 4, 3, 2, 2, 1, 3, 6,
-	1, 3, 1, 4, 2, 4, 0, 4, 3, 5, 2, 6, 0, 4, 5, 1, 0, 6, 1, 6,
-	2, 5, 6, 3, 5, 3, 4, 6, 0, 6, 1, 6, 0, 1, 4, 6, 3, 6, 3, 2,
-	3, 4, 6, 5, 1, 3, 1, 2, 6, 5, 6, 4, 4, 0, 3, 6, 5, 1, 4, 6,
-	4, 2, 5, 2, 4, 5, 3, 5, 4, 5, 1, 6, 4, 1, 6, 4, 1, 5, 2, 4,
-	5, 6, 5, 1, 4, 6, 4, 0, 3, 1, 6, 6, 1, 0, 4, 6, 5, 0, 6, 3,
-	6, 5, 2, 1, 5, 1, 4, 0, 2, 1, 5, 4, 3, 4, 5, 4, 2, 6, 2, 6,
-	0, 1, 4, 2, 5, 6, 2, 5, 6, 3, 0, 6, 1, 3, 0, 6, 0, 6, 5, 4,
-	1, 4, 3, 5, 2, 6, 0, 1, 5, 2, 5, 1, 3, 0, 6, 2, 5, 1, 0, 6,
-	2, 4, 2, 3, 5, 4, 6, 0, 2, 4, 2, 5, 0, 3, 4, 0, 4, 0, 6, 0,
-	3, 1, 3, 2, 0, 1, 2, 0, 6, 2, 4, 2, 6, 4, 2, 3, 0, 6, 0, 1,
-	4, 0, 2, 6, 5, 4, 5, 0, 1, 1, 0, 2, 0, 2, 3, 5, 6, 6, 2, 3,
-	5, 2, 1, 0, 1, 2, 6, 2, 6, 5, 0, 3, 2, 1, 0, 1, 4, 2, 3, 6,
-	6, 1, 5, 1, 0, 4, 6, 0, 4, 1, 0, 1, 4, 1, 6, 3, 2, 5, 6, 2,
-	0, 3, 2, 5, 4, 6, 4, 6, 0, 2, 4, 3, 3, 1, 2, 1, 0, 6, 3, 0,
-	1, 6, 5, 2, 5, 6, 0, 4, 2, 5, 2, 6, 4, 6, 3, 1, 3, 4, 1, 4,
-	2, 3, 6, 1, 5, 1, 1, 3, 0, 6, 0, 3, 1, 2, 1, 5, 4, 6, 1, 0,
-	3, 6, 3, 1, 6, 1, 4, 0, 1, 5, 2, 3, 1, 3, 6, 2, 0, 6, 4, 1,
-	4, 0, 2, 1, 3, 5, 4, 0, 3, 1, 0, 3, 6, 0, 6, 3, 5, 1, 0, 3,
-	5, 6, 3, 2, 6, 5, 2, 4, 0, 5, 0, 3, 0, 3, 1, 1, 2, 1, 2, 3,
-	6, 3, 0, 6, 5, 3, 2, 0, 1, 6, 0, 0, 0, 0, 1, 3, 0, 1, 3, 1,
-	0, 3, 1, 5, 3, 5, 5, 2, 4, 3, 4, 1, 4, 5, 0, 3, 3, 0, 1, 1,
-	1, 5, 2, 4, 2, 0, 4, 6, 5, 6, 4, 6, 2, 5, 0, 6, 3, 0, 1, 5,
-	2, 1, 3, 0, 6, 0, 2, 0, 4, 1, 2, 0, 4, 6, 2, 0, 2, 0, 5, 4,
-	3, 2, 5, 4, 3, 0, 3, 2, 4, 2, 3, 4, 1, 6, 2, 4, 6, 0, 2, 0,
-	4, 6, 0, 4, 3, 4, 6, 6, 5, 4, 2, 5, 1, 3, 6, 0, 4, 5, 4, 2,
-	5, 2, 6, 1, 4, 4, 6, 0, 6, 6, 2, 0, 4, 3, 2, 3, 4, 6, 5, 3,
-	6, 4, 2, 1, 1, 0, 4, 5, 2, 5, 2, 0, 5, 3, 0, 2, 6, 2, 3, 2,
-	0, 4, 3, 0, 1, 2, 1, 2, 0, 4, 0, 4, 2, 6, 4, 6, 4, 1, 2, 0,
-	1, 4, 2, 6, 1, 1, 2, 1, 5, 4, 0, 1, 1, 1, 4, 3, 6, 5, 1, 2,
-	2, 3, 0, 1, 0, 3, 5, 2, 6, 2, 1, 2, 4, 0, 4, 2, 4, 2, 5, 1,
-	3, 4, 6, 4, 3, 6, 5, 2, 6, 3, 3, 0, 1, 5, 2, 1, 5, 2, 5, 2,
-	4, 1, 6, 1, 4, 3, 0, 1, 2, 4, 5, 0, 3, 3, 1, 0, 3, 6, 3, 4,
-	5, 6, 4, 6, 5, 1, 4, 4, 6, 1, 0, 1, 3, 1, 0, 6, 2, 6, 5, 3,
-	6, 3, 0, 1, 4, 5, 6, 2, 6, 3, 2, 6, 6, 5, 1, 0, 1, 4, 2, 4,
-	0, 5, 2, 3, 0, 2, 5, 4, 6, 1, 3, 5, 6, 0, 6, 4, 2, 0, 6, 3,
-	1, 3, 0, 3, 5, 5, 1, 3, 5, 6, 1, 4, 3, 5, 2, 4, 2, 1, 6, 5,
-	2, 0, 4, 0, 5, 2, 6, 2, 5, 1, 3, 2, 5, 6, 0, 5, 0, 2, 4, 1,
-	3, 0, 6, 5, 6, 0, 1, 5, 1, 2, 0, 6, 3, 5, 4, 6, 5, 1, 2, 0,
-	4, 1, 4, 4, 6, 0, 2, 6, 3, 6, 4, 0, 0, 6, 4, 6, 0, 2, 4, 5,
-	5, 0, 5, 0, 1, 3, 5, 3, 6, 3, 4, 1, 6, 5, 4, 3, 3, 6, 5, 0,
-	6, 1, 6, 5, 1, 6, 2, 1, 4, 0, 1, 2, 5, 6, 1, 5, 1, 3, 0, 3,
-	0, 2, 1, 5, 0, 4, 3, 2, 1, 2, 0, 4, 3, 5, 3, 2, 4, 3, 1, 6,
-	1, 4, 3, 2, 1, 6, 2, 1, 4, 3, 1, 3, 0, 1, 3, 1, 5, 0, 6, 0,
-	2, 6, 3, 2, 3, 5, 4, 0, 4, 5, 4, 5, 2, 6, 4, 4, 2, 3, 5, 2,
-	3, 1, 5, 6, 1, 5, 3, 2, 0, 3, 4, 5, 6, 1, 5, 3, 5, 3, 0, 4,
-	4, 3, 6, 4, 5, 2, 3, 4, 3, 0, 3, 3, 1, 5, 4, 0, 2, 1, 3, 6,
-	5, 1, 2, 1, 3, 5, 2, 4, 5, 1, 2, 1, 2, 3, 6, 2, 3, 5, 4, 1,
-	6, 5, 3, 1, 0, 3, 0, 1, 4, 0, 5, 4, 0, 6, 0, 4, 2, 0, 6, 2,
-	0, 3, 0, 6, 5, 2, 0, 5, 4, 0, 2, 5, 2, 5, 3, 6, 5, 6, 2, 6,
-	1, 3, 5, 2, 6, 1, 5, 2, 4, 0, 4, 1, 2, 1, 6, 6, 5, 0, 3, 6,
-	2, 1, 0, 4, 2, 1, 0, 4, 5, 2, 5, 2, 0, 2, 4, 0, 5, 0, 1, 3,
-	3, 6, 4, 6, 2, 4, 0, 5, 1, 4, 6, 3, 4, 2, 5, 3, 4, 5, 4, 2,
-	4, 2, 3, 3, 0, 2, 3, 4, 2, 4, 0, 4, 2, 4, 4, 0, 1, 4, 0, 1,
-	5, 3, 5, 0, 1, 0, 2, 6, 1, 0, 2, 6, 2, 2, 6, 0, 6, 1, 4, 3,
-	6, 5, 2, 0, 3, 2, 1, 6, 0, 6, 0, 2, 4, 3, 0, 3, 0, 1, 4, 1,
-	0, 5, 2, 0, 5, 4, 2, 6, 1, 2, 5, 4, 6, 1, 5, 6, 1, 6, 5, 2,
-	1, 2, 0, 5, 1, 6, 3, 3, 0, 3, 1, 2, 6, 1, 4, 1, 4, 3, 5, 2,
-	2, 3, 5, 0, 0, 3, 6, 2, 3, 4, 2, 5, 0, 4, 3, 3, 1, 3, 5, 4,
-	3, 3, 1, 2, 1, 6, 0, 4, 6, 3, 4, 5, 6, 0, 5, 4, 5, 2, 6, 5,
-	4, 3, 6, 4, 3, 5, 6, 4, 2, 6, 2, 3, 4, 3, 2, 4, 5, 3, 4, 0,
-	5, 4, 5, 4, 6, 2, 0, 6, 0, 5, 4, 6, 3, 4, 0, 4, 2, 4, 6, 2,
-	6, 2, 3, 2, 5, 3, 0, 3, 3, 2, 4, 2, 1, 4, 2, 1, 3, 5, 6, 1,
-	0, 6, 4, 4, 0, 2, 5, 3, 0, 5, 6, 2, 0, 5, 4, 5, 2, 1, 2, 0,
-	1, 5, 6, 5, 3, 6, 1, 2, 3, 4, 6, 3, 3, 6, 1, 5, 6, 4, 6, 2,
-	2, 3, 4, 0, 2, 1, 1, 0, 1, 6, 3, 4, 0, 1, 5, 0, 3, 6, 4, 3,
-	3, 2, 6, 1, 2, 5, 3, 1, 2, 0, 2, 4, 0, 2, 0, 2, 4, 6, 0, 3,
-	4, 0, 2, 5, 6, 1, 4, 2, 3, 1, 4, 1, 4, 0, 2, 4, 5, 4, 1, 6,
-	5, 6, 2, 2, 5, 2, 1, 5, 1, 2, 4, 0, 4, 0, 3, 1, 2, 3, 6, 0,
-	6, 4, 3, 0, 4, 5, 3, 2, 5, 1, 0, 6, 5, 0, 6, 5, 1, 4, 6, 4,
-	0, 6, 4, 0, 5, 2, 4, 2, 4, 2, 6, 6, 4, 5, 6, 3, 0, 3, 0, 6,
-	1, 5, 4, 1, 2, 6, 0, 3, 4, 0, 1, 4, 1, 0, 3, 6, 4, 3, 5, 0,
-	2, 1, 2, 1, 6, 3, 2, 5, 6, 5, 0, 1, 6, 5, 3, 6, 3, 1, 1, 3,
-	3, 2, 1, 2, 3, 6, 2, 5, 2, 0, 4, 5, 4, 5, 1, 3, 3, 2, 3, 6,
-	4, 0, 6, 1, 2, 3, 4, 3, 5, 1, 4, 2, 6, 1, 2, 0, 3, 2, 5, 3,
-	5, 4, 1, 5, 1, 0, 1, 6, 5, 1, 6, 3, 4, 3, 6, 1, 5, 0, 3, 4,
-	6, 1, 5, 6, 4, 5, 4, 5, 3, 0, 2, 6, 1, 2, 6, 1, 5, 0, 3, 5,
-	0, 1, 0, 6, 5, 3, 4, 0, 4, 0, 4, 5, 3, 2, 4, 2, 2, 0, 1, 3,
-	1, 2, 4, 6, 1, 2, 4, 1, 3, 5, 6, 4, 2, 4, 5, 0, 6, 1, 1, 0,
-	2, 0, 0, 6, 0, 4, 2, 3, 1, 1, 6, 4, 0, 5, 0, 6, 5, 3, 6, 5,
-	3, 2, 4, 2, 6, 4, 1, 6, 2, 4, 3, 6, 2, 1, 1, 2, 5, 1, 4, 2,
-	4, 6, 4, 1, 6, 2, 5, 0, 3, 1, 0, 5, 3, 5, 1, 4, 1, 3, 5, 4,
-	5, 3, 5, 1, 2, 6, 5, 3, 4, 6, 3, 6, 0, 3, 5, 2, 0, 4, 6, 5,
-	6, 1, 3, 0, 6, 2, 3, 4, 3, 5, 2, 3, 2, 6, 0, 6, 4, 2, 0, 1,
-	0, 2, 1, 2, 5, 6, 5, 3, 5, 4, 3, 0, 1, 3, 2, 1, 2, 3, 0, 1,
-	1, 0, 3, 1, 0, 3, 3, 2, 4, 3, 0, 1, 2, 1, 6, 6, 1, 0, 6, 5,
-	2, 2, 4, 2, 5, 0, 5, 3, 6, 3, 6, 2, 4, 6, 4, 0, 2, 1, 2, 6,
-	3, 6, 1, 3, 1, 3, 1, 2, 4, 2, 5, 1, 0, 2, 4, 6, 5, 1, 5, 2,
-	4, 6, 0, 2, 3, 5, 1, 6, 2, 5, 2, 0, 3, 4, 5, 5, 5, 6, 2, 4,
-	5, 3, 1, 4, 3, 1, 2, 6, 0, 3, 1, 2, 5, 0, 1, 2, 5, 1, 3, 2,
-	6, 3, 0, 2, 3, 4, 2, 5, 1, 5, 3, 6, 5, 0, 3, 6, 5, 1, 3, 1,
-	0, 3, 6, 4, 2, 5, 6, 4, 3, 0, 5, 0, 5, 0, 4, 0, 2, 6, 2, 1,
-	1, 2, 3, 5, 1, 3, 4, 0, 5, 6, 1, 2, 4, 2, 3, 0, 5, 0, 5, 4,
-	2, 5, 4, 3, 1, 2, 3, 1, 5, 2, 6, 0, 4, 5, 1, 2, 6, 5, 5, 4,
-	3, 5, 3, 6, 3, 6, 5, 2, 3, 0, 6, 1, 4, 0, 1, 0, 1, 3, 6, 0,
-	4, 2, 6, 1, 3, 4, 5, 5, 4, 6, 4, 0, 2, 6, 4, 3, 0, 0, 6, 3,
-	5, 0, 5, 2, 4, 3, 0, 3, 5, 3, 4, 1, 6, 4, 0, 5, 4, 1, 6, 1,
-	6, 4, 1, 5, 6, 6, 3, 0, 2, 6, 1, 6, 0, 5, 4, 5, 3, 5, 3, 2,
-	0, 6, 4, 0, 3, 5, 4, 0, 4, 2, 4, 6, 0, 3, 3, 2, 6, 0, 5, 4,
-	1, 0, 3, 2, 0, 2, 1, 3, 2, 0, 6, 3, 5, 1, 2, 1, 0, 5, 6, 3,
-	2, 4, 0, 4, 4, 1, 0, 1, 0, 1, 0, 3, 6, 1, 4, 2, 6, 5, 3, 4,
-	3, 1, 2, 5, 0, 5, 2, 1, 3, 4, 5, 3, 1, 6, 2, 3, 2, 6, 5, 4,
-	4, 6, 4, 4, 0, 3, 0, 3, 1, 5, 1, 2, 2, 3, 6, 4, 3, 4, 6, 0,
-	5, 4, 5, 6, 2, 6, 5, 0, 5, 1, 4, 5, 6, 3, 4, 1, 4, 4, 0, 5,
-	6, 1, 0, 2, 1, 6, 6, 3, 6, 3, 6, 5, 6, 2, 1, 0, 3, 2, 0, 2,
-	0, 2, 0, 6, 5, 4, 6, 4, 0, 2, 3, 2, 1, 4, 3, 2, 3, 5, 0, 3,
-	1, 6, 2, 6, 5, 6, 4, 3, 6, 1, 2, 2, 4, 1, 5, 1, 0, 4, 3, 6,
-	2, 5, 4, 3, 1, 0, 6, 0, 5, 6, 4, 1, 1, 2, 4, 2, 3, 6, 3, 1,
-	3, 4, 2, 0, 3, 1, 2, 6, 0, 6, 5, 3, 6, 4, 1, 6, 2, 5, 1, 3,
-	4, 3, 0, 3, 2, 6, 0, 6, 4, 2, 6, 0, 6, 3, 3, 2, 6, 1, 1, 6,
-	5, 3, 4, 4, 3, 6, 3, 1, 4, 4, 3, 4, 6, 5, 0, 3, 5, 1, 6, 3,
-	6, 0, 4, 4, 6, 4, 0, 2, 0, 5, 5, 1, 2, 0, 4, 2, 4, 0, 5, 0,
-	0, 6, 0, 2, 0, 6, 5, 6, 1, 3, 2, 3, 5, 2, 6, 3, 4, 3, 0, 6,
-	1, 4, 5, 6, 2, 4, 3, 6, 0, 3, 1, 1, 4, 1, 6, 1, 6, 3, 2, 6,
-	2, 0, 3, 2, 5, 4, 2, 3, 4, 6, 5, 1, 4, 6, 2, 6, 2, 4, 6, 3,
-	3, 2, 1, 2, 6, 4, 2, 1, 4, 3, 5, 5, 2, 0, 3, 4, 0, 2, 3, 4,
-	4, 3, 5, 6, 2, 5, 2, 5, 0, 2, 6, 5, 1, 4, 1, 3, 3, 2, 6, 5,
-	5, 6, 6, 4, 2, 0, 2, 3, 2, 0, 3, 1, 0, 1, 2, 3, 1, 3, 4, 2,
-	6, 5, 6, 5, 0, 4, 2, 6, 0, 1, 1, 5, 4, 0, 3, 5, 0, 6, 1, 1,
-	0, 1, 0, 6, 4, 1, 4, 4, 1, 3, 4, 3, 0, 5, 3, 4, 6, 3, 2, 5,
-	1, 6, 1, 5, 2, 4, 2, 3, 5, 4, 5, 2, 3, 6, 3, 4, 1, 4, 3, 0,
-	2, 5, 3, 0, 4, 6, 6, 5, 5, 1, 0, 6, 0, 5, 2, 4, 2, 0, 1, 2,
-	3, 3, 2, 6, 3, 2, 0, 4, 6, 4, 5, 0, 6, 1, 3, 1, 0, 1, 3, 0,
-	4, 5, 3, 2, 1, 0, 6, 2, 0, 3, 5, 2, 0, 4, 3, 5, 4, 6, 5, 0,
-	5, 3, 3, 1, 6, 2, 3, 1, 5, 6, 4, 5, 3, 5, 2, 3, 5, 2, 4, 2,
-	6, 3, 3, 6, 5, 2, 4, 0, 6, 0, 5, 3, 3, 5, 3, 4, 6, 4, 6, 2,
-	0, 4, 3, 2, 1, 1, 3, 1, 1, 4, 2, 0, 6, 4, 2, 0, 3, 1, 6, 0,
-	1, 2, 1, 4, 3, 0, 4, 1, 1, 1, 0, 4, 1, 3, 5, 0, 3, 2, 0, 6,
-	2, 3, 2, 1, 3, 2, 5, 6, 5, 0, 5, 3, 2, 1, 4, 5, 0, 2, 4, 3,
-	3, 0, 2, 0, 6, 1, 2, 6, 0, 4, 5, 6, 0, 1, 6, 4, 2, 3, 6, 4,
-	4, 0, 4, 6, 2, 3, 2, 0, 4, 0, 1, 5, 0, 2, 1, 6, 1, 4, 3, 5,
-	5, 1, 6, 1, 2, 6, 4, 6, 3, 2, 4, 3, 5, 6, 1, 6, 3, 5, 6, 3,
-	6, 0, 2, 5, 3, 2, 2, 3, 2, 3, 4, 2, 5, 1, 5, 4, 6, 1, 3, 3,
-	0, 6, 1, 0, 3, 2, 0, 5, 4, 5, 3, 5, 4, 3, 0, 6, 0, 5, 2, 1,
-	1, 0, 6, 0, 6, 5, 3, 5, 0, 6, 1, 5, 0, 2, 0, 6, 1, 5, 1, 2,
-	2, 5, 3, 3, 0, 2, 3, 0, 2, 3, 5, 3, 6, 4, 2, 5, 2, 5, 0, 2,
-	3, 2, 5, 1, 2, 3, 6, 2, 0, 1, 2, 4, 2, 0, 2, 5, 4, 0, 4, 0,
-	4, 1, 6, 1, 6, 0, 1, 6, 5, 1, 3, 6, 5, 4, 1, 1, 4, 6, 5, 3,
-	5, 1, 4, 2, 0, 4, 3, 4, 5, 4, 6, 3, 5, 0, 3, 1, 0, 2, 6, 5,
-	6, 2, 4, 2, 5, 6, 3, 0, 5, 2, 3, 1, 0, 3, 1, 4, 0, 2, 3, 0,
-	0, 1, 6, 2, 0, 1, 1, 4, 6, 2, 6, 2, 3, 2, 0, 6, 4, 3, 4, 3,
-	1, 0, 4, 0, 3, 0, 4, 5, 4, 2, 0, 2, 0, 1, 2, 4, 0, 2, 6, 2,
-	2, 6, 2, 6, 5, 6, 1, 0, 3, 5, 2, 5, 4, 1, 5, 4, 0, 1, 4, 3,
-	3, 6, 4, 3, 5, 2, 6, 5, 3, 6, 4, 2, 1, 6, 5, 1, 2, 4, 5, 6,
-	4, 5, 0, 6, 4, 4, 6, 1, 4, 5, 5, 1, 0, 5, 0, 5, 1, 1, 2, 4,
-	5, 4, 1, 6, 3, 1, 5, 1, 3, 1, 4, 6, 1, 0, 2, 6, 2, 4, 3, 1,
-	6, 0, 3, 4, 4, 0, 1, 4, 2, 3, 0, 1, 1, 1, 3, 0, 6, 5, 0, 5,
-	0, 1, 5, 3, 0, 2, 6, 0, 2, 1, 0, 1, 1, 1, 3, 2, 6, 0, 1, 4,
-	1, 4, 6, 5, 1, 2, 1, 4, 3, 2, 3, 0, 4, 5, 6, 5, 2, 3, 2, 3,
-	2, 6, 5, 5, 6, 3, 5, 5, 4, 6, 0, 3, 0, 2, 3, 5, 3, 0, 1, 3,
-	3, 2, 0, 6, 2, 4, 5, 4, 2, 1, 4, 3, 5, 0, 1, 1, 0, 2, 4, 3,
-	4, 2, 5, 4, 0, 6, 1, 2, 3, 4, 2, 1, 0, 4, 2, 4, 3, 1, 6, 6,
-	5, 4, 1, 6, 0, 2, 1, 2, 1, 5, 2, 4, 5, 0, 4, 3, 4, 0, 5, 4,
-	6, 3, 3, 2, 6, 1, 5, 1, 3, 2, 0, 6, 4, 0, 5, 3, 5, 0, 1, 0,
-	0, 2, 0, 5, 6, 1, 0, 6, 0, 4, 5, 6, 4, 2, 6, 4, 6, 3, 1, 5,
-	1, 4, 1, 5, 1, 0, 4, 1, 2, 1, 6, 5, 4, 1, 0, 4, 2, 6, 2, 0,
-	2, 0, 1, 4, 5, 2, 3, 4, 3, 2, 0, 2, 4, 1, 6, 0, 3, 2, 3, 5,
-	3, 4, 3, 0, 5, 0, 2, 1, 6, 2, 6, 4, 0, 2, 6, 4, 6, 4, 0, 1,
-	4, 0, 3, 6, 5, 2, 0, 3, 4, 2, 3, 0, 6, 1, 2, 4, 2, 2, 6, 4,
-	5, 3, 5, 6, 4, 5, 4, 2, 1, 4, 3, 4, 1, 3, 5, 4, 4, 2, 0, 6,
-	6, 5, 0, 5, 1, 1, 0, 3, 6, 1, 1, 3, 1, 0, 2, 0, 6, 2, 0, 2,
-	0, 2, 0, 5, 1, 3, 4, 2, 6, 3, 3, 4, 4, 1, 3, 0, 1, 5, 4, 1,
-	1, 1, 2, 1, 4, 3, 5, 5, 2, 0, 2, 0, 1, 4, 2, 6, 1, 5, 5, 3,
-	2, 4, 5, 1, 4, 2, 6, 0, 1, 5, 3, 6, 3, 6, 5, 1, 5, 4, 6, 4,
-	3, 2, 5, 1, 6, 0, 4, 1, 5, 0, 5, 2, 5, 5, 1, 2, 0, 2, 1, 2,
-	4, 6, 2, 3, 1, 2, 1, 5, 4, 2, 3, 5, 3, 0, 3, 0, 5, 1, 6, 1,
-	5, 2, 3, 1, 0, 4, 6, 3, 1, 5, 6, 3, 0, 2, 3, 3, 0, 1, 3, 6,
-	6, 3, 2, 1, 5, 5, 6, 0, 1, 6, 2, 4, 1, 1, 6, 3, 6, 3, 0, 2,
-	0, 4, 3, 6, 4, 2, 4, 3, 6, 4, 2, 1, 0, 1, 0, 4, 2, 0, 5, 2,
-	1, 5, 2, 0, 3, 4, 1, 4, 2, 4, 1, 4, 3, 0, 3, 3, 1, 5, 4, 1,
-	2, 0, 3, 5, 0, 6, 3, 0, 3, 3, 2, 6, 0, 3, 5, 1, 6, 3, 4, 2,
-	3, 6, 0, 1, 5, 4, 2, 0, 5, 4, 2, 4, 5, 3, 0, 5, 2, 6, 5, 3,
-	4, 5, 4, 6, 1, 5, 2, 3, 3, 6, 6, 1, 2, 6, 3, 3, 0, 1, 4, 4,
-	5, 6, 2, 4, 3, 1, 4, 1, 5, 2, 0, 4, 5, 4, 1, 2, 6, 2, 6, 2,
-	6, 5, 6, 1, 2, 0, 1, 1, 3, 2, 3, 5, 5, 6, 2, 4, 1, 6, 3, 4,
-	0, 4, 5, 6, 5, 2, 1, 4, 2, 0, 6, 1, 3, 6, 2, 0, 2, 2, 1, 2,
-	1, 3, 6, 0, 6, 2, 0, 4, 2, 5, 6, 4, 5, 6, 5, 1, 1, 3, 0, 2,
-	2, 4, 0, 1, 2, 3, 2, 6, 1, 6, 4, 3, 0, 1, 0, 6, 4, 0, 6, 0,
-	3, 5, 6, 1, 2, 5, 1, 5, 0, 6, 5, 1, 3, 0, 3, 5, 3, 2, 3, 3,
-	4, 0, 2, 5, 2, 5, 0, 5, 2, 0, 2, 6, 3, 0, 3, 2, 0, 5, 2, 5,
-	5, 0, 6, 0, 2, 2, 3, 6, 2, 4, 1, 0, 4, 5, 2, 6, 3, 4, 1, 5,
-	6, 1, 6, 0, 2, 4, 2, 5, 3, 4, 0, 5, 6, 0, 3, 6, 5, 0, 1, 4,
-	0, 4, 5, 0, 0, 2, 1, 6, 3, 2, 1, 3, 0, 4, 5, 3, 3, 1, 1, 1,
-	1, 4, 2, 4, 2, 0, 6, 3, 3, 0, 5, 3, 5, 3, 0, 6, 1, 4, 6, 1,
-	2, 6, 3, 4, 3, 5, 2, 3, 1, 1, 6, 3, 0, 5, 2, 6, 3, 0, 5, 4,
-	3, 2, 0, 5, 4, 1, 0, 1, 5, 1, 6, 5, 2, 2, 4, 1, 4, 0, 3, 3,
-	4, 2, 2, 0, 1, 5, 4, 2, 5, 1, 2, 2, 3, 5, 0, 4, 5, 2, 6, 3,
-	5, 3, 5, 1, 5, 3, 4, 0, 4, 2, 4, 5, 0, 5, 6, 5, 1, 1, 5, 3,
-	6, 2, 3, 5, 4, 2, 1, 2, 5, 0, 2, 4, 5, 1, 2, 3, 6, 5, 4, 2,
-	0, 6, 3, 4, 6, 5, 0, 4, 0, 5, 1, 0, 1, 5, 0, 2, 1, 6, 1, 5,
-	1, 0, 6, 0, 2, 3, 4, 1, 2, 3, 1, 4, 2, 4, 2, 4, 4, 2, 1, 0,
-	2, 0, 4, 0, 5, 3, 4, 2, 5, 4, 6, 3, 4, 3, 4, 1, 5, 3, 1, 4,
-	3, 5, 2, 0, 2, 4, 3, 4, 5, 3, 2, 6, 2, 0, 2, 6, 2, 3, 1, 0,
-	4, 0, 3, 6, 3, 4, 5, 4, 0, 5, 5, 2, 6, 5, 2, 3, 5, 1, 0, 1,
-	5, 4, 3, 5, 2, 0, 1, 5, 6, 1, 0, 0, 3, 1, 3, 4, 2, 3, 2, 5,
-	6, 2, 4, 6, 2, 3, 1, 2, 6, 5, 0, 5, 6, 2, 1, 2, 5, 2, 6, 5,
-	0, 4, 1, 1, 4, 3, 6, 4, 6, 3, 6, 5, 0, 2, 0, 4, 3, 0, 0, 6,
-	1, 6, 3, 5, 4, 2, 0, 6, 5, 3, 2, 1, 6, 1, 0, 5, 4, 0, 1, 2,
-	2, 1, 5, 4, 1, 4, 0, 4, 2, 6, 2, 0, 2, 4, 5, 0, 4, 4, 5, 3,
-	3, 3, 6, 1, 0, 0, 2, 3, 1, 5, 3, 4, 0, 2, 3, 4, 2, 1, 0, 3,
-	4, 5, 4, 5, 4, 3, 3, 5, 0, 1, 2, 0, 5, 4, 2, 1, 0, 1, 0, 1,
-	5, 3, 4, 2, 0, 3, 2, 0, 2, 5, 2, 3, 3, 6, 4, 5, 1, 2, 4, 6,
-	6, 0, 3, 4, 6, 5, 1, 6, 1, 4, 2, 4, 1, 0, 1, 4, 3, 1, 4, 5,
-	0, 1, 3, 0, 6, 5, 1, 4, 6, 2, 4, 3, 0, 2, 5, 6, 4, 6, 3, 6,
-	1, 5, 6, 3, 4, 1, 4, 1, 3, 4, 6, 5, 4, 5, 3, 6, 4, 5, 6, 0,
-	2, 3, 5, 3, 6, 2, 0, 2, 3, 2, 0, 2, 5, 0, 3, 3, 3, 4, 0, 4,
-	3, 1, 2, 4, 5, 2, 1, 2, 4, 5, 4, 1, 0, 6, 0, 2, 3, 1, 1, 1,
-	4, 5, 0, 2, 1, 5, 2, 3, 2, 0, 5, 1, 1, 6, 5, 2, 0, 5, 2, 4,
-	5, 2, 6, 4, 2, 4, 2, 1, 5, 5, 3, 1, 2, 3, 5, 2, 3, 2, 1, 0,
-	6, 6, 6, 6, 3, 4, 3, 3, 2, 1, 2, 0, 2, 1, 0, 6, 3, 2, 5, 6,
-	0, 6, 3, 1, 4, 3, 4, 6, 0, 3, 0, 4, 1, 2, 3, 2, 0, 2, 6, 1,
-	1, 1, 3, 2, 0, 2, 0, 5, 0, 2, 3, 5, 1, 3, 2, 4, 2, 4, 6, 1,
-	2, 5, 0, 5, 0, 2, 4, 0, 5, 4, 1, 0, 6, 5, 4, 6, 1, 4, 3, 5,
-	3, 0, 2, 1, 0, 6, 3, 3, 6, 3, 4, 2, 4, 1, 6, 6, 2, 1, 2, 0,
-	4, 1, 4, 2, 6, 0, 2, 4, 0, 3, 6, 3, 0, 6, 5, 4, 0, 6, 3, 4,
-	5, 4, 3, 6, 5, 1, 4, 2, 1, 2, 0, 4, 1, 4, 5, 4, 5, 1, 5, 1,
-	6, 5, 6, 4, 0, 1, 6, 3, 2, 0, 6, 4, 5, 6, 2, 4, 2, 0, 6, 1,
-	0, 1, 3, 1, 0, 5, 6, 2, 1, 0, 5, 0, 3, 5, 1, 3, 5, 2, 5, 1,
-	1, 4, 2, 0, 3, 4, 5, 4, 2, 1, 4, 3, 2, 3, 2, 3, 6, 2, 6, 1,
-	2, 5, 1, 5, 3, 3, 2, 0, 5, 3, 0, 3, 5, 3, 4, 2, 4, 2, 3, 6,
-	3, 0, 2, 1, 5, 0, 4, 0, 4, 4, 1, 2, 6, 3, 5, 6, 2, 5, 4, 2,
-	4, 1, 5, 0, 6, 1, 2, 3, 3, 1, 6, 4, 0, 1, 6, 1, 0, 1, 2, 5,
-	5, 3, 5, 6, 3, 1, 3, 3, 1, 4, 3, 0, 2, 0, 4, 6, 5, 0, 6, 2,
-	6, 1, 5, 0, 5, 3, 1, 3, 4, 6, 6, 3, 4, 0, 3, 2, 6, 0, 1, 2,
-	0, 1, 4, 0, 2, 5, 1, 2, 0, 1, 3, 2, 1, 4, 1, 6, 6, 0, 3, 1,
-	1, 6, 3, 5, 0, 5, 3, 3, 3, 3, 1, 6, 2, 6, 2, 6, 4, 6, 4, 6,
-	2, 0, 4, 3, 5, 6, 5, 4, 1, 2, 6, 1, 5, 6, 3, 1, 1, 2, 6, 0,
-	3, 4, 2, 0, 5, 1, 3, 5, 2, 4, 0, 0, 2, 1, 6, 5, 6, 2, 6, 2,
-	4, 5, 3, 6, 4, 1, 0, 2, 0, 6, 3, 1, 5, 2, 4, 2, 4, 6, 6, 5,
-	5, 2, 3, 1, 5, 4, 5, 6, 3, 6, 2, 3, 0, 4, 2, 1, 2, 0, 6, 0,
-	6, 5, 3, 0, 4, 5, 2, 0, 4, 0, 4, 3, 6, 2, 3, 0, 1, 1, 5, 3,
-	0, 5, 2, 3, 4, 5, 6, 0, 6, 2, 1, 4, 6, 1, 6, 5, 3, 0, 4, 1,
-	1, 6, 2, 4, 6, 5, 0, 3, 1, 1, 5, 6, 1, 5, 4, 1, 5, 3, 5, 1,
-	2, 5, 0, 3, 2, 6, 3, 6, 5, 2, 6, 4, 0, 4, 5, 2, 2, 6, 5, 1,
-	3, 3, 0, 1, 0, 2, 3, 1, 5, 1, 0, 5, 2, 1, 0, 0, 6, 3, 5, 3,
-	4, 2, 3, 3, 0, 3, 0, 4, 1, 1, 4, 3, 5, 3, 1, 4, 3, 1, 4, 2,
-	5, 6, 0, 6, 5, 2, 5, 2, 1, 6, 4, 1, 0, 2, 0, 3, 5, 4, 2, 3,
-	6, 1, 3, 3, 1, 3, 1, 2, 1, 6, 0, 6, 5, 4, 1, 3, 6, 2, 5, 4,
-	0, 3, 6, 2, 3, 0, 3, 6, 0, 1, 4, 6, 1, 6, 3, 1, 5, 2, 1, 0,
-	1, 6, 3, 4, 5, 6, 0, 3, 6, 1, 2, 6, 2, 3, 6, 4, 6, 0, 2, 0,
-	2, 6, 2, 6, 2, 0, 4, 5, 1, 3, 1, 3, 0, 3, 6, 2, 4, 0, 1, 4,
-	3, 5, 1, 4, 6, 4, 0, 3, 6, 3, 5, 0, 3, 2, 2, 5, 3, 5, 4, 0,
-	4, 6, 4, 2, 4, 2, 3, 2, 6, 2, 1, 4, 5, 3, 6, 5, 0, 6, 2, 0,
-	5, 1, 5, 1, 2, 4, 6, 1, 4, 3, 2, 0, 2, 5, 4, 3, 6, 3, 5, 6,
-	6, 4, 3, 1, 1, 3, 6, 4, 5, 4, 5, 0, 1, 2, 5, 0, 1, 4, 5, 6,
-	0, 3, 1, 4, 6, 3, 0, 1, 1, 3, 0, 6, 2, 3, 3, 1, 2, 6, 6, 1,
-	1, 2, 0, 3, 5, 1, 6, 5, 0, 2, 3, 0, 2, 0, 4, 3, 6, 5, 5, 0,
-	2, 0, 1, 4, 2, 4, 0, 2, 3, 0, 6, 0, 3, 2, 6, 2, 6, 3, 4, 6,
-	3, 0, 2, 1, 0, 6, 4, 1, 4, 3, 2, 4, 6, 0, 2, 6, 4, 3, 4, 5,
-	4, 1, 4, 6, 1, 0, 6, 2, 5, 6, 2, 6, 6, 4, 2, 0, 5, 6, 2, 5,
-	5, 4, 3, 1, 3, 0, 6, 3, 0, 3, 5, 4, 6, 5, 2, 4, 5, 2, 6, 0,
-	6, 0, 4, 3, 2, 6, 2, 0, 2, 0, 3, 2, 1, 5, 6, 6, 3, 5, 2, 0,
-	0, 0, 5, 4, 0, 6, 5, 2, 5, 4, 2, 4, 1, 4, 1, 2, 0, 3, 6, 2,
-	1, 4, 3, 0, 2, 2, 1, 5, 6, 3, 5, 2, 4, 2, 1, 0, 2, 4, 6, 5,
-	2, 0, 6, 1, 0, 4, 3, 6, 4, 2, 0, 2, 0, 5, 1, 2, 4, 1, 6, 0,
-	3, 1, 0, 2, 3, 0, 4, 6, 2, 0, 0, 2, 6, 0, 4, 6, 1, 3, 6, 3,
-	4, 6, 1, 2, 3, 5, 6, 4, 0, 5, 4, 6, 5, 6, 2, 6, 5, 0, 4, 2,
-	5, 6, 3, 6, 4, 5, 2, 3, 1, 5, 0, 4, 6, 1, 5, 4, 2, 2, 0, 5,
-	6, 3, 2, 0, 4, 5, 3, 4, 6, 2, 6, 2, 4, 2, 4, 5, 2, 1, 3, 2,
-	0, 4, 2, 3, 5, 1, 6, 5, 4, 0, 5, 1, 6, 5, 5, 4, 6, 4, 6, 0,
-	1, 3, 5, 0, 3, 2, 3, 2, 5, 2, 5, 4, 5, 2, 4, 6, 1, 4, 6, 4,
-	2, 5, 1, 6, 0, 1, 0, 6, 0, 3, 4, 3, 6, 3, 1, 4, 5, 1, 3, 0,
-	3, 0, 1, 6, 2, 4, 6, 5, 0, 4, 6, 2, 1, 3, 1, 4, 3, 5, 3, 1,
-	4, 6, 5, 6, 4, 4, 0, 6, 0, 3, 1, 2, 1, 6, 0, 1, 2, 5, 6, 5,
-	5, 4, 6, 5, 3, 5, 1, 6, 4, 5, 4, 6, 1, 0, 1, 6, 3, 3, 2, 6,
-	6, 3, 5, 4, 2, 6, 5, 6, 0, 2, 5, 4, 1, 4, 0, 5, 2, 6, 4, 1,
-	0, 4, 1, 0, 3, 0, 1, 5, 2, 4, 5, 0, 5, 0, 3, 1, 5, 2, 4, 1,
-	1, 1, 0, 1, 4, 0, 2, 3, 1, 1, 5, 1, 3, 1, 0, 4, 5, 1, 6, 4,
-	2, 3, 3, 4, 2, 4, 3, 2, 5, 3, 2, 6, 5, 0, 3, 2, 1, 2, 0, 6,
-	3, 4, 0, 2, 0, 2, 1, 0, 5, 3, 4, 2, 5, 2, 4, 0, 1, 1, 4, 0,
-	4, 3, 6, 4, 5, 0, 6, 3, 0, 2, 5, 4, 2, 0, 4, 1, 5, 4, 0, 1,
-	5, 0, 5, 4, 0, 3, 1, 3, 1, 4, 3, 1, 3, 1, 4, 3, 1, 6, 5, 1,
-	6, 5, 2, 0, 2, 3, 6, 1, 0, 2, 3, 2, 5, 6, 3, 5, 6, 5, 6, 0,
-	0, 5, 1, 6, 0, 1, 2, 3, 1, 4, 0, 2, 0, 5, 4, 0, 2, 6, 3, 0,
-	1, 2, 1, 0, 4, 5, 2, 6, 4, 4, 2, 6, 2, 0, 1, 5, 6, 5, 0, 5,
-	2, 0, 6, 0, 5, 0, 6, 0, 4, 2, 0, 4, 0, 2, 4, 6, 6, 4, 2, 1,
-	3, 2, 5, 2, 4, 6, 5, 0, 6, 0, 1, 0, 5, 3, 1, 4, 5, 5, 3, 0,
-	4, 6, 3, 6, 4, 1, 6, 1, 2, 6, 4, 0, 1, 0, 5, 2, 0, 4, 2, 6,
-	5, 3, 5, 2, 2, 3, 4, 2, 6, 5, 2, 0, 6, 3, 1, 0, 1, 5, 1, 3,
-	6, 0, 1, 1, 1, 2, 5, 6, 3, 2, 0, 2, 0, 5, 4, 2, 6, 2, 3, 5,
-	0, 5, 4, 0, 6, 4, 6, 5, 0, 2, 4, 2, 1, 6, 5, 0, 5, 6, 4, 1,
-	1, 4, 3, 4, 6, 2, 1, 2, 3, 2, 1, 3, 1, 4, 5, 6, 0, 3, 2, 1,
-	2, 1, 5, 6, 4, 1, 5, 4, 1, 2, 4, 2, 3, 4, 0, 2, 5, 1, 1, 5,
-	3, 6, 3, 2, 0, 5, 2, 5, 1, 3, 1, 3, 5, 1, 6, 3, 4, 5, 3, 5,
-	4, 2, 4, 5, 0, 3, 0, 3, 1, 3, 4, 5, 3, 6, 2, 6, 3, 4, 0, 5,
-	5, 3, 0, 2, 0, 4, 0, 3, 5, 2, 5, 3, 6, 0, 2, 1, 4, 1, 3, 6,
-	6, 3, 0, 4, 6, 3, 2, 0, 5, 2, 3, 4, 0, 6, 2, 5, 1, 4, 0, 2,
-	0, 2, 0, 5, 6, 5, 6, 1, 4, 1, 6, 2, 3, 5, 0, 2, 5, 2, 3, 3,
-	1, 0, 6, 0, 2, 5, 1, 4, 5, 6, 3, 3, 1, 6, 5, 3, 1, 5, 3, 1,
-	2, 1, 2, 4, 1, 5, 3, 4, 1, 2, 3, 2, 5, 6, 5, 1, 5, 4, 2, 4,
-	3, 0, 4, 4, 1, 6, 2, 2, 6, 3, 4, 0, 6, 4, 6, 4, 6, 0, 6, 4,
-	4, 3, 4, 1, 3, 1, 1, 4, 5, 3, 2, 1, 1, 2, 5, 6, 2, 4, 2, 4,
-	5, 0, 5, 3, 5, 2, 6, 4, 3, 0, 1, 5, 3, 1, 4, 0, 5, 6, 0, 5,
-	6, 0, 5, 3, 6, 4, 4, 3, 4, 0, 6, 0, 4, 6, 5, 0, 5, 4, 5, 2,
-	0, 6, 6, 5, 3, 5, 1, 2, 0, 5, 0, 6, 2, 0, 3, 2, 5, 0, 1, 3,
-	1, 2, 4, 6, 1, 6, 3, 5, 6, 1, 0, 2, 0, 3, 5, 3, 2, 6, 0, 6,
-	2, 4, 5, 2, 5, 4, 2, 0, 3, 0, 1, 1, 0, 4, 6, 4, 6, 3, 5, 1,
-	3, 6, 1, 1, 3, 1, 5, 4, 6, 3, 1, 6, 0, 6, 3, 6, 4, 0, 4, 0,
-	4, 1, 4, 5, 4, 1, 6, 2, 6, 4, 0, 5, 3, 2, 0, 0, 6, 3, 2, 1,
-	5, 3, 2, 3, 0, 6, 3, 5, 2, 1, 4, 6, 6, 1, 2, 3, 5, 6, 1, 5,
-	6, 0, 2, 4, 0, 3, 1, 4, 6, 2, 0, 6, 4, 5, 3, 2, 3, 6, 1, 0,
-	0, 1, 2, 1, 4, 2, 5, 4, 6, 2, 0, 0, 5, 1, 6, 0, 5, 4, 0, 4,
-	1, 3, 5, 6, 2, 0, 3, 1, 5, 5, 6, 4, 6, 1, 0, 2, 6, 1, 6, 0,
-	2, 1, 4, 2, 5, 2, 0, 6, 1, 4, 6, 1, 0, 4, 3, 2, 0, 4, 3, 5,
-	3, 0, 6, 5, 6, 0, 2, 4, 3, 4, 2, 1, 2, 4, 0, 4, 0, 6, 1, 6,
-	4, 2, 1, 5, 0, 5, 4, 2, 4, 4, 2, 1, 6, 5, 4, 5, 6, 6, 3, 0,
-	5, 6, 5, 4, 2, 1, 4, 5, 4, 2, 5, 3, 0, 2, 1, 6, 5, 2, 2, 1,
-	6, 2, 0, 5, 4, 5, 6, 5, 3, 1, 6, 5, 4, 5, 1, 4, 2, 3, 2, 0,
-	0, 6, 5, 1, 6, 0, 1, 4, 5, 0, 3, 2, 6, 5, 3, 4, 6, 6, 3, 6,
-	1, 3, 6, 2, 1, 5, 6, 4, 2, 1, 2, 0, 6, 2, 4, 1, 6, 4, 5, 6,
-	2, 1, 2, 3, 4, 5, 4, 2, 0, 4, 6, 3, 2, 3, 6, 2, 1, 5, 0, 2,
-	3, 4, 2, 6, 3, 6, 5, 4, 0, 3, 4, 0, 2, 0, 1, 1, 2, 0, 5, 3,
-	4, 0, 2, 4, 2, 6, 1, 4, 3, 2, 1, 5, 1, 5, 1, 3, 1, 5, 6, 3,
-	5, 4, 1, 5, 6, 0, 4, 4, 0, 2, 6, 0, 4, 5, 4, 6, 3, 4, 2, 6,
-	6, 3, 1, 2, 4, 1, 2, 5, 0, 2, 6, 4, 0, 1, 3, 0, 3, 0, 3, 4,
-	0, 6, 5, 2, 3, 4, 0, 6, 1, 6, 0, 3, 2, 5, 2, 4, 0, 1, 4, 0,
-	1, 5, 0, 4, 1, 3, 6, 0, 2, 4, 2, 1, 5, 0, 1, 0, 3, 5, 3, 6,
-	2, 6, 1, 6, 0, 1, 0, 0, 4, 1, 2, 1, 5, 6, 2, 0, 4, 1, 6, 5,
-	3, 4, 2, 3, 4, 3, 0, 4, 2, 4, 2, 5, 3, 0, 3, 2, 2, 1, 3, 2,
-	4, 5, 4, 2, 0, 6, 4, 1, 0, 3, 4, 5, 6, 6, 4, 6, 4, 5, 1, 2,
-	5, 3, 4, 4, 3, 0, 1, 0, 5, 0, 4, 2, 0, 0, 6, 2, 3, 1, 4, 3,
-	6, 4, 0, 4, 2, 0, 1, 4, 6, 0, 3, 6, 4, 5, 3, 1, 0, 4, 0, 5,
-	0, 1, 0, 4, 6, 2, 0, 6, 5, 4, 1, 1, 4, 1, 5, 2, 0, 2, 1, 6,
-	1, 5, 1, 0, 6, 0, 3, 6, 5, 4, 3, 1, 3, 2, 4, 6, 0, 1, 5, 2,
-	2, 5, 2, 6, 4, 3, 4, 1, 4, 0, 5, 0, 4, 2, 1, 5, 0, 2, 3, 6,
-	3, 4, 2, 3, 1, 3, 5, 0, 4, 6, 1, 3, 3, 2, 0, 3, 2, 5, 2, 0,
-	4, 6, 5, 1, 6, 4, 5, 3, 5, 1, 5, 1, 0, 1, 0, 6, 4, 6, 0, 4,
-	5, 1, 5, 6, 1, 4, 5, 1, 6, 1, 4, 1, 0, 6, 3, 6, 5, 2, 3, 5,
-	6, 5, 0, 2, 0, 6, 3, 6, 2, 0, 4, 2, 1, 3, 3, 6, 1, 0, 1, 4,
-	0, 2, 1, 5, 6, 5, 0, 4, 1, 5, 2, 3, 2, 6, 2, 4, 1, 2, 0, 3,
-	1, 6, 5, 0, 2, 3, 2, 1, 4, 2, 4, 3, 2, 0, 5, 3, 2, 0, 4, 6,
-	2, 4, 2, 6, 3, 4, 3, 5, 6, 1, 5, 1, 2, 5, 3, 0, 3, 5, 0, 1,
-	3, 3, 0, 6, 2, 0, 4, 6, 3, 2, 1, 4, 0, 2, 1, 4, 3, 0, 2, 0,
-	4, 2, 4, 1, 0, 1, 3, 0, 4, 6, 3, 0, 4, 3, 4, 2, 6, 3, 5, 0,
-	5, 0, 2, 6, 0, 3, 4, 5, 1, 4, 5, 0, 3, 1, 5, 4, 2, 4, 2, 0,
-	6, 2, 0, 6, 6, 5, 2, 0, 3, 0, 2, 4, 2, 1, 5, 4, 0, 1, 5, 0,
-	0, 4, 1, 3, 1, 2, 5, 4, 2, 2, 1, 0, 6, 1, 3, 6, 4, 5, 0, 2,
-	1, 4, 2, 0, 4, 2, 0, 5, 1, 4, 4, 3, 0, 0, 6, 5, 4, 6, 5, 4,
-	2, 6, 0, 6, 4, 2, 5, 1, 3, 0, 5, 0, 2, 6, 2, 6, 5, 0, 4, 3,
-	3, 6, 1, 0, 5, 0, 3, 4, 3, 0, 4, 3, 5, 4, 3, 2, 4, 3, 5, 6,
-	4, 6, 3, 1, 1, 5, 6, 5, 0, 3, 1, 6, 0, 5, 1, 0, 6, 3, 6, 2,
-	5, 1, 4, 2, 3, 1, 0, 6, 4, 5, 1, 0, 2, 3, 0, 3, 2, 5, 4, 0,
-	6, 2, 0, 1, 6, 3, 4, 5, 0, 2, 5, 3, 5, 6, 2, 5, 4, 2, 0, 6,
-	0, 3, 6, 5, 2, 5, 3, 2, 4, 5, 1, 3, 3, 5, 4, 4, 1, 3, 6, 6,
-	1, 3, 0, 2, 6, 4, 3, 6, 1, 5, 1, 2, 3, 4, 5, 1, 3, 2, 1, 0,
-	2, 0, 5, 6, 0, 3, 5, 4, 0, 3, 4, 5, 2, 4, 5, 4, 5, 2, 0, 2,
-	3, 1, 1, 6, 5, 6, 2, 6, 3, 2, 0, 3, 2, 0, 2, 3, 2, 5, 0, 4,
-	4, 0, 3, 5, 4, 3, 4, 6, 5, 6, 3, 5, 0, 4, 0, 4, 3, 2, 0, 6,
-	5, 5, 1, 2, 3, 4, 3, 2, 4, 2, 0, 5, 0, 2, 5, 4, 6, 1, 5, 2,
-	6, 3, 5, 0, 6, 0, 1, 0, 6, 2, 1, 2, 3, 6, 6, 2, 0, 1, 2, 1,
-	0, 4, 2, 3, 5, 1, 6, 5, 3, 6, 4, 5, 1, 5, 1, 3, 2, 0, 3, 4,
-	1, 3, 6, 2, 3, 0, 6, 1, 1, 2, 3, 0, 5, 1, 5, 4, 2, 3, 0, 3,
-	2, 4, 6, 5, 4, 1, 5, 1, 2, 1, 1, 6, 4, 6, 5, 4, 2, 6, 5, 1,
-	3, 6, 1, 5, 6, 5, 1, 5, 3, 6, 2, 0, 1, 3, 1, 5, 2, 1, 2, 3,
-	4, 1, 5, 4, 1, 4, 5, 1, 2, 5, 2, 3, 5, 0, 2, 0, 1, 0, 6, 4,
-	5, 0, 4, 2, 1, 3, 3, 4, 0, 2, 0, 6, 0, 1, 3, 5, 4, 2, 6, 2,
-	6, 5, 1, 0, 4, 5, 3, 2, 2, 6, 4, 6, 4, 0, 6, 4, 1, 6, 1, 6,
-	0, 2, 6, 3, 2, 1, 4, 3, 5, 0, 2, 3, 6, 0, 2, 1, 2, 6, 0, 5,
-	1, 1, 5, 0, 1, 0, 4, 2, 3, 4, 2, 1, 0, 5, 6, 2, 0, 4, 6, 5,
-	2, 6, 0, 1, 0, 4, 3, 4, 6, 5, 6, 5, 1, 6, 3, 0, 6, 3, 4, 2,
-	3, 5, 4, 6, 3, 1, 6, 3, 6, 1, 3, 0, 0, 3, 4, 1, 4, 6, 2, 1,
-	4, 6, 6, 5, 0, 2, 6, 2, 3, 0, 1, 4, 4, 2, 6, 4, 2, 6, 4, 0,
-	5, 2, 5, 0, 5, 0, 2, 1, 5, 3, 6, 5, 0, 5, 1, 3, 0, 6, 4, 6,
-	6, 5, 6, 3, 1, 2, 4, 6, 5, 6, 4, 3, 6, 4, 1, 6, 2, 6, 3, 6,
-	0, 4, 1, 4, 5, 4, 2, 6, 5, 4, 4, 6, 5, 1, 5, 6, 5, 1, 0, 1,
-	1, 2, 2, 6, 2, 0, 4, 1, 2, 3, 6, 3, 2, 5, 1, 5, 6, 3, 6, 2,
-	2, 6, 1, 6, 0, 4, 3, 0, 6, 5, 0, 4, 5, 3, 5, 3, 1, 4, 2, 6,
-	3, 4, 6, 4, 6, 3, 0, 5, 3, 5, 2, 4, 5, 1, 6, 0, 1, 3, 1, 2,
-	4, 2, 1, 4, 6, 3, 0, 1, 5, 6, 1, 0, 6, 4, 6, 3, 5, 2, 5, 4,
-	5, 2, 5, 4, 3, 5, 6, 4, 0, 6, 3, 3, 6, 4, 1, 2, 2, 1, 5, 6,
-	6, 1, 5, 0, 1, 1, 0, 1, 6, 0, 6, 0, 4, 6, 2, 5, 1, 4, 0, 2,
-	0, 2, 6, 4, 2, 0, 5, 5, 2, 6, 3, 6, 1, 6, 4, 1, 6, 1, 6, 1,
-	1, 4, 1, 3, 2, 1, 1, 0, 3, 1, 3, 0, 3, 1, 4, 0, 2, 4, 1, 5,
-	2, 3, 4, 3, 5, 6, 3, 5, 0, 6, 2, 5, 3, 5, 6, 3, 0, 6, 0, 6,
-	3, 6, 2, 3, 3, 4, 2, 4, 5, 0, 4, 0, 2, 3, 6, 5, 5, 4, 2, 3,
-	4, 0, 4, 6, 5, 6, 2, 6, 5, 3, 6, 1, 3, 5, 2, 0, 3, 6, 0, 4,
-	5, 3, 1, 3, 1, 4, 5, 4, 2, 4, 3, 4, 4, 5, 6, 4, 5, 6, 5, 1,
-	6, 3, 6, 2, 3, 6, 4, 5, 3, 1, 5, 6, 0, 5, 3, 4, 0, 3, 6, 0,
-	0, 3, 6, 2, 0, 6, 1, 2, 4, 2, 5, 3, 6, 0, 6, 5, 6, 5, 3, 1,
-	1, 6, 4, 2, 5, 5, 3, 6, 3, 0, 5, 2, 3, 6, 1, 2, 3, 1, 1, 6,
-	2, 4, 4, 2, 0, 2, 6, 0, 1, 5, 2, 6, 2, 5, 2, 0, 4, 5, 0, 6,
-	3, 0, 1, 6, 4, 5, 3, 0, 4, 0, 2, 4, 5, 4, 5, 2, 3, 6, 1, 6,
-	4, 5, 1, 4, 6, 3, 5, 4, 3, 2, 1, 4, 1, 5, 6, 4, 0, 2, 4, 5,
-	5, 0, 3, 4, 2, 1, 6, 0, 5, 2, 3, 2, 3, 0, 3, 0, 3, 4, 2, 5,
-	6, 1, 2, 1, 2, 4, 1, 3, 6, 4, 5, 5, 4, 5, 3, 1, 3, 4, 1, 5,
-	0, 6, 3, 6, 3, 2, 0, 5, 0, 2, 0, 1, 0, 6, 1, 5, 1, 3, 2, 3,
-	1, 6, 4, 3, 6, 2, 6, 3, 5, 0, 6, 4, 0, 6, 4, 3, 2, 4, 4, 6,
-	2, 1, 5, 6, 1, 4, 1, 3, 4, 2, 4, 6, 0, 4, 1, 5, 1, 2, 5, 6,
-	3, 0, 2, 2, 6, 2, 5, 2, 6, 0, 3, 6, 0, 5, 0, 1, 5, 1, 4, 2,
-	4, 0, 1, 6, 0, 0, 6, 4, 2, 5, 3, 4, 0, 1, 6, 4, 2, 5, 6, 3,
-	5, 5, 3, 4, 2, 1, 6, 0, 5, 0, 5, 1, 0, 2, 1, 2, 0, 1, 0, 2,
-	6, 5, 5, 3, 5, 3, 6, 2, 5, 6, 2, 3, 2, 5, 1, 5, 0, 3, 4, 3,
-	0, 3, 1, 4, 6, 3, 5, 4, 2, 4, 1, 1, 4, 1, 4, 2, 5, 6, 3, 5,
-	1, 4, 2, 5, 6, 4, 2, 6, 4, 6, 5, 6, 0, 3, 4, 6, 4, 2, 5, 1,
-	2, 5, 4, 5, 5, 3, 1, 2, 5, 6, 0, 5, 2, 6, 3, 6, 1, 2, 6, 6,
-	3, 4, 6, 1, 3, 6, 2, 6, 0, 1, 1, 3, 0, 2, 1, 0, 6, 4, 6, 1,
-	4, 0, 5, 6, 4, 0, 2, 0, 3, 1, 4, 6, 4, 0, 3, 2, 4, 3, 4, 3,
-	5, 0, 2, 4, 2, 1, 4, 2, 0, 6, 4, 2, 1, 3, 3, 3, 0, 4, 1, 5,
-	6, 2, 1, 5, 6, 0, 5, 4, 5, 3, 4, 2, 6, 2, 0, 5, 2, 5, 1, 5,
-	0, 0, 1, 0, 1, 5, 6, 0, 2, 0, 6, 4, 2, 3, 3, 4, 2, 5, 1, 0,
-	1, 6, 5, 4, 1, 4, 0, 6, 2, 6, 1, 5, 4, 6, 0, 5, 4, 1, 0, 4,
-	2, 4, 1, 2, 0, 4, 5, 1, 0, 2, 3, 3, 2, 0, 5, 4, 6, 3, 2, 3,
-	3, 0, 2, 4, 5, 3, 5, 1, 2, 4, 2, 5, 2, 6, 4, 5, 1, 3, 4, 6,
-	4, 5, 1, 2, 4, 1, 6, 3, 5, 6, 0, 2, 0, 6, 2, 5, 4, 3, 5, 4,
-	5, 2, 4, 3, 1, 4, 6, 5, 6, 2, 5, 2, 0, 4, 2, 5, 6, 3, 0, 5,
-	6, 4, 2, 4, 5, 6, 1, 4, 1, 0, 5, 1, 2, 3, 0, 2, 0, 6, 3, 0,
-	0, 3, 1, 0, 2, 6, 2, 1, 5, 0, 5, 6, 2, 5, 4, 1, 6, 3, 2, 6,
-	1, 4, 1, 1, 4, 3, 5, 4, 6, 5, 4, 1, 6, 2, 6, 0, 3, 0, 2, 3,
-	2, 4, 1, 0, 1, 3, 0, 5, 1, 2, 3, 0, 1, 6, 4, 5, 1, 0, 5, 6,
-	3, 2, 1, 3, 6, 4, 1, 3, 6, 4, 5, 0, 2, 4, 3, 4, 1, 3, 4, 2,
-	4, 5, 6, 4, 1, 3, 1, 4, 0, 1, 4, 5, 1, 3, 2, 1, 5, 4, 3, 1,
-	5, 6, 3, 0, 1, 6, 0, 3, 1, 5, 6, 3, 6, 1, 6, 5, 1, 1, 3, 0,
-	6, 4, 3, 0, 3, 6, 5, 4, 2, 1, 5, 0, 1, 5, 2, 5, 3, 5, 6, 4,
-	0, 6, 5, 4, 5, 3, 2, 1, 4, 2, 3, 4, 2, 6, 5, 4, 2, 5, 0, 2,
-	1, 3, 0, 1, 6, 2, 5, 4, 2, 3, 2, 4, 0, 5, 0, 4, 1, 4, 1, 2,
-	2, 3, 1, 3, 5, 6, 5, 4, 5, 4, 2, 4, 4, 5, 4, 3, 3, 5, 6, 4,
-	3, 4, 1, 6, 3, 3, 1, 2, 3, 6, 2, 4, 2, 4, 5, 6, 1, 6, 4, 1,
-	4, 3, 5, 4, 3, 0, 2, 4, 2, 6, 2, 3, 5, 4, 5, 1, 3, 0, 4, 3,
-	5, 2, 6, 5, 1, 6, 1, 2, 6, 3, 5, 4, 5, 1, 2, 6, 3, 0, 0, 6,
-	6, 2, 3, 2, 1, 0, 5, 1, 4, 5, 0, 1, 4, 5, 1, 3, 3, 5, 6, 3,
-	0, 2, 6, 6, 4, 2, 5, 4, 4, 4, 3, 2, 5, 0, 3, 2, 1, 2, 5, 4,
-	1, 0, 3, 1, 5, 4, 5, 6, 3, 4, 2, 3, 5, 0, 6, 5, 2, 1, 5, 0,
-	2, 4, 1, 5, 0, 0, 6, 5, 6, 3, 1, 5, 3, 2, 6, 0, 2, 1, 2, 3,
-	3, 1, 0, 1, 5, 6, 1, 3, 3, 2, 0, 6, 5, 0, 1, 0, 3, 5, 1, 3,
-	4, 2, 4, 4, 6, 2, 1, 3, 3, 5, 6, 4, 6, 2, 0, 2, 3, 2, 3, 4,
-	5, 4, 1, 3, 6, 4, 5, 6, 4, 6, 5, 1, 2, 1, 3, 1, 6, 5, 6, 0,
-	6, 0, 1, 5, 6, 2, 0, 2, 6, 2, 3, 0, 5, 4, 5, 0, 1, 3, 6, 1,
-	0, 1, 5, 6, 2, 0, 5, 1, 2, 3, 5, 4, 5, 2, 1, 6, 0, 6, 5, 6,
-	1, 4, 2, 0, 6, 5, 1, 5, 4, 0, 5, 2, 3, 5, 2, 0, 3, 4, 5, 4,
-	2, 6, 5, 6, 3, 6, 2, 1, 2, 3, 2, 4, 0, 3, 1, 2, 5, 0, 5, 3,
-	3, 3, 4, 5, 5, 0, 5, 4, 3, 6, 2, 6, 1, 5, 0, 5, 6, 5, 4, 5,
-	4, 0, 6, 5, 3, 1, 2, 3, 0, 6, 4, 3, 0, 4, 1, 0, 6, 2, 4, 3,
-	5, 1, 6, 4, 6, 3, 3, 2, 1, 2, 5, 2, 6, 5, 1, 6, 1, 3, 6, 5,
-	6, 6, 1, 6, 2, 4, 3, 4, 2, 6, 0, 3, 6, 2, 3, 6, 2, 3, 1, 2,
-	0, 2, 0, 2, 5, 1, 4, 3, 3, 6, 4, 3, 4, 3, 2, 0, 3, 3, 1, 4,
-	1, 0, 1, 1, 2, 5, 4, 2, 6, 1, 5, 2, 1, 5, 4, 1, 6, 5, 3, 6,
-	2, 6, 2, 0, 2, 5, 1, 3, 2, 3, 4, 2, 0, 2, 5, 6, 4, 2, 4, 6,
-	3, 4, 6, 2, 4, 0, 4, 0, 1, 5, 4, 0, 2, 0, 3, 3, 6, 0, 4, 6,
-	4, 5, 2, 1, 4, 6, 1, 4, 0, 6, 2, 1, 1, 6, 0, 5, 3, 4, 0, 6,
-	5, 5, 4, 6, 1, 4, 5, 6, 5, 1, 0, 6, 1, 5, 4, 2, 0, 6, 3, 2,
-	6, 2, 0, 4, 0, 6, 3, 6, 0, 4, 3, 0, 3, 6, 0, 1, 6, 5, 0, 1,
-	0, 6, 5, 1, 4, 0, 1, 6, 1, 3, 0, 2, 0, 2, 0, 6, 0, 6, 3, 6,
-	1, 1, 5, 1, 6, 2, 0, 5, 0, 4, 5, 1, 4, 1, 4, 0, 1, 3, 2, 1,
-	2, 6, 4, 3, 0, 5, 0, 5, 3, 4, 0, 6, 1, 6, 1, 5, 3, 5, 2, 5,
-	3, 0, 4, 0, 3, 6, 1, 5, 0, 6, 1, 5, 4, 6, 4, 1, 6, 4, 3, 5,
-	4, 0, 5, 3, 2, 3, 5, 3, 0, 4, 5, 1, 2, 0, 2, 5, 0, 6, 0, 3,
-	5, 1, 3, 0, 2, 6, 3, 1, 5, 2, 6, 5, 1, 5, 1, 3, 2, 0, 3, 3,
-	6, 1, 4, 4, 6, 4, 5, 4, 4, 2, 2, 4, 0, 6, 1, 3, 2, 0, 2, 6,
-	0, 2, 6, 1, 3, 1, 2, 1, 2, 1, 5, 0, 2, 3, 6, 0, 0, 4, 0, 3,
-	1, 0, 4, 3, 4, 5, 1, 3, 0, 3, 0, 6, 2, 6, 2, 0, 6, 4, 2, 4,
-	2, 1, 0, 4, 1, 2, 3, 1, 2, 0, 6, 3, 4, 1, 3, 5, 4, 1, 3, 6,
-	3, 2, 0, 1, 6, 3, 0, 1, 1, 5, 4, 6, 1, 2, 1, 6, 4, 4, 2, 5,
-	4, 6, 2, 1, 5, 5, 5, 1, 3, 0, 1, 5, 1, 6, 1, 0, 5, 2, 0, 4,
-	5, 6, 5, 4, 3, 4, 5, 6, 3, 6, 1, 3, 2, 0, 2, 6, 0, 2, 3, 6,
-	6, 4, 1, 6, 2, 1, 4, 1, 2, 1, 5, 0, 0, 6, 1, 0, 2, 3, 4, 2,
-	0, 6, 3, 1, 6, 6, 0, 5, 4, 0, 1, 4, 2, 0, 5, 0, 6, 4, 1, 5,
-	1, 4, 6, 3, 5, 2, 2, 6, 2, 5, 3, 4, 6, 1, 2, 5, 1, 5, 2, 0,
-	2, 3, 3, 0, 4, 4, 0, 1, 3, 6, 2, 0, 3, 4, 0, 3, 0, 5, 1, 4,
-	3, 5, 3, 0, 6, 5, 1, 4, 5, 0, 2, 2, 0, 1, 5, 0, 5, 1, 0, 2,
-	4, 4, 1, 5, 2, 4, 3, 3, 4, 2, 3, 1, 2, 4, 2, 2, 0, 6, 2, 6,
-	5, 0, 3, 1, 2, 4, 2, 4, 5, 3, 0, 2, 3, 4, 5, 1, 2, 5, 0, 1,
-	6, 3, 4, 0, 3, 6, 6, 4, 3, 5, 4, 2, 5, 1, 5, 5, 3, 2, 0, 1,
-	0, 3, 5, 4, 3, 4, 1, 5, 3, 4, 2, 6, 0, 5, 0, 6, 1, 6, 5, 0,
-	1, 0, 6, 2, 2, 1, 2, 6, 3, 5, 1, 2, 0, 3, 0, 4, 5, 5, 4, 5,
-	2, 6, 2, 6, 2, 6, 2, 5, 5, 3, 5, 2, 4, 1, 0, 3, 1, 2, 4, 0,
-	3, 5, 2, 4, 5, 2, 0, 1, 4, 6, 3, 5, 0, 5, 1, 6, 2, 0, 2, 1,
-	4, 6, 0, 6, 5, 4, 3, 0, 5, 5, 2, 0, 3, 0, 6, 2, 1, 6, 2, 6,
-	5, 6, 2, 0, 3, 6, 3, 0, 3, 5, 6, 3, 6, 1, 0, 6, 2, 3, 5, 6,
-	6, 5, 3, 5, 0, 4, 0, 5, 0, 3, 2, 0, 4, 1, 6, 1, 4, 5, 3, 1,
-	0, 1, 6, 3, 6, 6, 5, 4, 6, 1, 6, 3, 0, 6, 5, 4, 1, 0, 5, 3,
-	1, 5, 3, 5, 0, 5, 3, 4, 0, 3, 4, 0, 3, 0, 2, 1, 1, 4, 0, 2,
-	2, 3, 5, 1, 2, 4, 1, 2, 3, 5, 3, 1, 4, 5, 3, 0, 1, 4, 5, 4,
-	3, 2, 1, 2, 6, 1, 5, 1, 6, 0, 2, 0, 1, 6, 3, 2, 1, 6, 1, 3,
-	4, 5, 0, 3, 1, 4, 5, 4, 2, 0, 5, 0, 5, 2, 4, 3, 0, 2, 6, 5,
-	5, 0, 1, 3, 2, 0, 4, 5, 1, 6, 4, 2, 4, 3, 4, 0, 1, 2, 2, 0,
-	6, 0, 3, 6, 5, 1, 2, 5, 3, 3, 2, 1, 5, 1, 5, 4, 5, 3, 4, 6,
-	0, 1, 0, 5, 4, 0, 1, 5, 1, 4, 2, 0, 6, 3, 0, 4, 0, 5, 5, 3,
-	1, 2, 0, 3, 1, 6, 0, 1, 4, 6, 4, 3, 4, 1, 1, 4, 3, 1, 0, 5,
-	2, 1, 4, 2, 6, 1, 4, 0, 1, 4, 6, 3, 4, 3, 2, 1, 5, 6, 1, 4,
-	3, 2, 1, 2, 1, 4, 0, 5, 2, 6, 0, 5, 1, 1, 3, 1, 3, 5, 1, 2,
-	4, 6, 1, 1, 5, 0, 4, 3, 2, 1, 4, 5, 5, 4, 1, 5, 0, 4, 3, 2,
-	5, 6, 0, 1, 5, 6, 1, 5, 1, 3, 2, 3, 6, 3, 4, 6, 4, 5, 0, 2,
-	6, 2, 3, 0, 6, 0, 6, 5, 1, 1, 5, 6, 3, 6, 2, 1, 1, 0, 2, 1,
-	0, 5, 3, 4, 2, 0, 5, 3, 4, 6, 6, 1, 2, 6, 4, 2, 6, 1, 6, 0,
-	1, 6, 4, 6, 3, 6, 5, 5, 2, 0, 2, 0, 4, 6, 3, 4, 1, 0, 4, 5,
-	2, 6, 0, 4, 5, 6, 4, 4, 1, 1, 2, 3, 0, 1, 1, 2, 1, 3, 0, 3,
-	3, 1, 0, 1, 1, 5, 0, 3, 6, 1, 0, 6, 0, 6, 4, 6, 2, 0, 1, 5,
-	4, 3, 4, 5, 2, 4, 0, 3, 5, 6, 3, 1, 2, 6, 5, 4, 2, 0, 5, 4,
-	5, 3, 0, 4, 6, 1, 5, 2, 5, 2, 3, 5, 0, 1, 6, 3, 6, 1, 0, 6,
-	6, 1, 3, 1, 2, 5, 1, 6, 1, 6, 1, 1, 6, 3, 0, 5, 2, 0, 1, 0,
-	0, 6, 2, 1, 2, 5, 0, 4, 0, 2, 1, 3, 2, 4, 2, 0, 4, 1, 4, 2,
-	1, 6, 3, 4, 1, 0, 5, 3, 6, 4, 1, 0, 6, 1, 0, 5, 6, 3, 0, 2,
-	2, 3, 6, 1, 0, 2, 4, 2, 2, 1, 4, 0, 5, 0, 3, 0, 6, 4, 0, 5,
-	3, 0, 6, 4, 1, 6, 0, 1, 2, 5, 1, 2, 3, 5, 6, 0, 6, 1, 2, 4,
-	4, 2, 1, 2, 3, 0, 4, 2, 4, 3, 0, 6, 1, 6, 3, 6, 2, 6, 2, 5,
-	5, 5, 1, 2, 3, 1, 0, 4, 6, 0, 1, 2, 4, 3, 6, 2, 3, 4, 1, 2,
-	6, 0, 1, 5, 3, 2, 0, 4, 5, 6, 4, 2, 4, 1, 4, 2, 5, 0, 5, 6,
-	0, 1, 1, 4, 1, 6, 3, 6, 1, 3, 0, 6, 2, 3, 2, 5, 4, 6, 1, 0,
-	1, 3, 0, 5, 3, 6, 4, 5, 6, 0, 6, 5, 4, 5, 3, 1, 0, 5, 0, 1,
-	2, 5, 3, 6, 0, 6, 5, 4, 6, 6, 4, 0, 4, 6, 3, 2, 1, 5, 1, 5,
-	3, 3, 1, 3, 2, 5, 1, 3, 2, 1, 6, 1, 1, 0, 1, 4, 6, 4, 2, 3,
-	4, 6, 5, 1, 2, 1, 2, 5, 6, 3, 5, 4, 2, 0, 3, 2, 0, 1, 5, 3,
-	5, 3, 1, 3, 4, 3, 4, 1, 4, 2, 1, 2, 4, 1, 1, 3, 6, 2, 5, 0,
-	6, 3, 0, 5, 4, 5, 3, 4, 3, 6, 2, 5, 1, 2, 3, 5, 3, 1, 6, 5,
-	0, 6, 0, 4, 0, 6, 6, 5, 3, 5, 1, 4, 5, 6, 0, 5, 6, 2, 4, 3,
-	1, 2, 0, 1, 2, 5, 4, 0, 2, 4, 6, 4, 1, 5, 2, 6, 2, 5, 3, 4,
-	2, 4, 0, 2, 3, 2, 0, 5, 6, 2, 0, 3, 4, 1, 4, 5, 6, 0, 4, 2,
-	3, 0, 4, 3, 0, 6, 4, 2, 3, 6, 0, 2, 6, 0, 5, 3, 1, 5, 3, 4,
-	4, 5, 2, 4, 5, 3, 3, 6, 1, 6, 0, 3, 5, 3, 5, 0, 2, 3, 3, 1,
-	5, 4, 4, 6, 4, 5, 2, 6, 3, 4, 5, 4, 1, 0, 5, 0, 3, 0, 0, 4,
-	6, 4, 5, 1, 2, 6, 2, 3, 4, 5, 4, 2, 0, 5, 3, 1, 4, 0, 4, 1,
-	0, 0, 4, 3, 5, 2, 4, 2, 4, 3, 2, 4, 0, 5, 3, 0, 4, 5, 4, 5,
-	1, 3, 2, 0, 2, 4, 0, 5, 2, 5, 2, 1, 6, 4, 0, 2, 0, 1, 0, 1,
-	2, 4, 0, 6, 1, 0, 4, 6, 5, 0, 1, 0, 2, 6, 3, 0, 6, 2, 4, 6,
-	3, 0, 5, 6, 0, 3, 5, 1, 2, 1, 5, 1, 4, 0, 4, 3, 6, 2, 1, 5,
-	4, 3, 5, 2, 3, 3, 2, 5, 2, 6, 3, 4, 0, 5, 5, 0, 5, 5, 1, 4,
-	5, 1, 4, 5, 1, 5, 1, 6, 5, 3, 2, 4, 0, 5, 4, 0, 3, 1, 5, 0,
-	6, 2, 3, 4, 3, 6, 2, 4, 1, 6, 4, 6, 0, 5, 2, 0, 1, 0, 6, 5,
-	0, 1, 0, 6, 5, 0, 2, 3, 2, 0, 6, 4, 2, 1, 6, 1, 6, 0, 5, 6,
-	1, 0, 1, 4, 6, 2, 4, 2, 4, 1, 4, 2, 5, 4, 6, 3, 6, 3, 5, 1,
-	2, 1, 2, 0, 6, 3, 0, 3, 6, 6, 3, 4, 1, 0, 3, 1, 4, 6, 5, 0,
-	3, 6, 4, 2, 0, 1, 2, 4, 2, 3, 0, 0, 3, 4, 5, 2, 2, 5, 5, 3,
-	4, 0, 2, 5, 3, 1, 2, 1, 2, 6, 4, 6, 4, 2, 0, 5, 2, 3, 0, 6,
-	5, 1, 5, 0, 3, 0, 1, 0, 1, 1, 5, 1, 2, 0, 2, 6, 4, 2, 1, 4,
-	6, 1, 4, 5, 3, 4, 6, 1, 6, 5, 3, 4, 2, 0, 2, 4, 2, 6, 4, 2,
-	0, 2, 5, 1, 6, 4, 5, 1, 2, 1, 1, 2, 0, 2, 3, 1, 6, 5, 3, 5,
-	1, 0, 5, 3, 0, 5, 0, 3, 4, 1, 4, 6, 5, 3, 0, 1, 6, 0, 6, 3,
-	2, 4, 2, 6, 3, 4, 5, 1, 1, 5, 4, 6, 2, 0, 3, 2, 1, 4, 1, 0,
-	3, 3, 2, 5, 0, 4, 6, 1, 2, 1, 3, 5, 4, 2, 1, 3, 5, 0, 2, 1,
-	4, 3, 1, 5, 1, 5, 4, 3, 5, 2, 4, 2, 5, 3, 2, 1, 6, 1, 4, 2,
-	5, 1, 6, 3, 1, 2, 1, 1, 5, 3, 2, 3, 4, 2, 4, 2, 0, 2, 5, 3,
-	6, 3, 4, 2, 6, 4, 5, 0, 4, 6, 1, 6, 2, 6, 4, 0, 3, 4, 3, 0,
-	0, 5, 4, 1, 2, 6, 2, 0, 4, 6, 1, 6, 2, 4, 1, 2, 0, 3, 4, 2,
-	1, 4, 2, 1, 0, 6, 0, 2, 3, 2, 5, 1, 6, 5, 4, 1, 4, 3, 6, 3,
-	2, 4, 0, 6, 3, 4, 0, 5, 2, 6, 5, 2, 0, 4, 6, 5, 2, 4, 6, 3,
-	3, 6, 3, 3, 6, 2, 4, 5, 2, 2, 5, 4, 1, 3, 1, 4, 1, 2, 4, 2,
-	4, 5, 3, 2, 1, 3, 5, 3, 3, 4, 0, 4, 4, 0, 1, 2, 1, 5, 4, 5,
-	5, 0, 1, 0, 2, 1, 3, 3, 5, 1, 5, 4, 2, 4, 4, 0, 4, 6, 1, 5,
-	6, 2, 4, 0, 1, 4, 0, 3, 1, 5, 3, 2, 1, 6, 3, 6, 3, 5, 1, 4,
-	0, 6, 3, 6, 4, 5, 2, 3, 2, 0, 6, 2, 6, 2, 4, 1, 0, 1, 1, 4,
-	1, 5, 6, 5, 2, 3, 1, 6, 2, 6, 5, 2, 0, 2, 1, 3, 6, 6, 3, 2,
-	2, 5, 6, 0, 4, 6, 4, 3, 4, 5, 3, 0, 1, 2, 0, 2, 6, 1, 1, 1,
-	3, 2, 4, 6, 3, 5, 2, 0, 4, 3, 6, 3, 3, 6, 2, 0, 2, 6, 2, 0,
-	4, 6, 5, 6, 3, 4, 0, 2, 3, 1, 1, 5, 6, 3, 4, 2, 5, 4, 3, 0,
-	5, 1, 5, 3, 5, 4, 6, 6, 2, 0, 3, 4, 4, 6, 5, 3, 6, 0, 6, 1,
-	6, 2, 0, 3, 1, 4, 2, 4, 3, 0, 3, 6, 2, 6, 1, 4, 6, 0, 6, 2,
-	0, 1, 5, 4, 2, 1, 2, 1, 6, 1, 4, 3, 0, 0, 3, 0, 2, 3, 4, 2,
-	1, 0, 1, 5, 2, 4, 4, 1, 0, 1, 3, 6, 3, 1, 2, 0, 5, 4, 0, 1,
-	2, 5, 0, 5, 2, 4, 0, 3, 4, 6, 4, 2, 4, 6, 4, 6, 2, 6, 2, 6,
-	3, 5, 4, 5, 1, 0, 3, 5, 2, 6, 1, 3, 2, 4, 0, 5, 3, 3, 4, 2,
-	4, 1, 1, 4, 3, 3, 1, 6, 1, 0, 1, 5, 2, 4, 2, 5, 0, 6, 4, 1,
-	5, 6, 3, 0, 6, 2, 4, 4, 4, 3, 0, 5, 4, 2, 4, 4, 0, 4, 0, 3,
-	6, 2, 4, 2, 0, 1, 3, 4, 3, 2, 3, 5, 2, 5, 6, 3, 2, 0, 5, 1,
-	0, 4, 2, 3, 2, 0, 6, 5, 4, 6, 5, 4, 3, 5, 0, 1, 5, 3, 5, 3,
-	1, 6, 1, 6, 3, 6, 5, 2, 5, 1, 0, 0, 5, 3, 2, 3, 3, 5, 2, 1,
-	2, 3, 2, 0, 4, 6, 0, 4, 0, 3, 5, 6, 3, 2, 3, 2, 6, 0, 5, 4,
-	3, 5, 0, 6, 5, 6, 5, 4, 0, 3, 5, 0, 4, 6, 3, 5, 6, 3, 2, 1,
-	4, 6, 2, 4, 6, 1, 1, 2, 5, 1, 2, 5, 3, 6, 1, 5, 2, 0, 6, 0,
-	5, 6, 0, 6, 4, 1, 6, 1, 3, 1, 2, 3, 6, 3, 5, 3, 1, 4, 3, 1,
-	6, 1, 2, 3, 4, 6, 4, 1, 2, 3, 2, 0, 2, 1, 2, 5, 0, 3, 1, 5,
-	0, 6, 3, 5, 3, 1, 4, 0, 4, 3, 6, 2, 1, 3, 3, 2, 0, 3, 5, 4,
-	1, 3, 2, 6, 5, 6, 3, 6, 5, 4, 5, 4, 5, 3, 3, 1, 2, 4, 2, 5,
-	2, 6, 5, 4, 4, 1, 0, 4, 0, 4, 5, 0, 2, 5, 1, 5, 4, 5, 3, 3,
-	3, 6, 5, 4, 5, 1, 4, 0, 6, 2, 4, 6, 4, 6, 2, 3, 0, 3, 5, 4,
-	4, 6, 2, 5, 5, 5, 0, 3, 2, 3, 5, 0, 1, 4, 2, 6, 6, 0, 5, 4,
-	5, 6, 4, 5, 4, 2, 6, 4, 2, 6, 5, 2, 3, 2, 6, 4, 5, 6, 3, 3,
-	6, 1, 0, 3, 0, 5, 4, 6, 1, 4, 5, 2, 6, 3, 0, 3, 6, 3, 3, 2,
-	0, 2, 0, 2, 1, 0, 2, 0, 4, 1, 3, 4, 0, 5, 3, 6, 2, 0, 6, 0,
-	1, 6, 3, 5, 2, 5, 4, 5, 0, 4, 0, 5, 6, 3, 2, 0, 5, 6, 1, 3,
-	2, 2, 0, 3, 1, 6, 0, 2, 0, 1, 6, 4, 1, 4, 5, 4, 2, 5, 0, 4,
-	3, 3, 1, 4, 5, 4, 3, 1, 6, 6, 5, 3, 5, 4, 1, 0, 4, 1, 2, 1,
-	4, 0, 5, 4, 1, 6, 4, 2, 3, 0, 6, 3, 0, 2, 1, 2, 6, 5, 4, 5,
-	5, 3, 1, 4, 1, 6, 5, 1, 0, 1, 6, 1, 5, 6, 0, 2, 5, 1, 2, 1,
-	6, 2, 4, 3, 6, 4, 2, 1, 1, 6, 5, 4, 3, 4, 2, 1, 4, 3, 2, 4,
-	0, 1, 5, 4, 0, 5, 6, 4, 0, 6, 5, 6, 3, 1, 0, 1, 4, 5, 2, 5,
-	1, 0, 4, 2, 5, 0, 2, 5, 4, 5, 2, 3, 4, 3, 6, 1, 5, 4, 3, 5,
-	2, 4, 6, 3, 0, 5, 2, 6, 4, 2, 5, 1, 4, 3, 4, 5, 3, 6, 3, 1,
-	3, 4, 5, 4, 2, 3, 0, 5, 3, 5, 0, 4, 6, 3, 4, 5, 3, 4, 5, 0,
-	4, 1, 2, 6, 0, 2, 5, 6, 2, 0, 2, 3, 1, 4, 3, 0, 5, 3, 2, 5,
-	5, 3, 5, 0, 3, 4, 2, 6, 1, 2, 5, 0, 3, 6, 2, 6, 0, 6, 0, 4,
-	6, 2, 0, 5, 1, 6, 4, 6, 3, 2, 4, 3, 6, 4, 3, 5, 1, 0, 4, 5,
-	0, 3, 4, 3, 0, 3, 4, 0, 2, 0, 5, 1, 6, 5, 2, 3, 6, 3, 0, 6,
-	1, 3, 5, 2, 5, 4, 3, 2, 3, 4, 5, 3, 2, 4, 5, 3, 6, 1, 4, 1,
-	2, 1, 6, 1, 0, 3, 0, 2, 4, 6, 3, 4, 3, 6, 0, 1, 3, 1, 3, 6,
-	3, 2, 6, 5, 3, 0, 5, 2, 6, 0, 5, 4, 0, 5, 0, 1, 5, 4, 5, 3,
-	4, 2, 0, 4, 2, 0, 0, 4, 0, 6, 5, 1, 2, 3, 5, 6, 5, 4, 2, 0,
-	5, 1, 6, 0, 0, 0, 1, 0, 1, 2, 1, 1, 5, 2, 2, 1, 6, 5, 0, 2,
-	6, 4, 0, 4, 2, 6, 0, 4, 1, 4, 3, 6, 2, 4, 2, 1, 3, 5, 0, 3,
-	0, 2, 3, 2, 0, 6, 2, 3, 0, 4, 2, 5, 4, 2, 6, 4, 1, 6, 2, 1,
-	1, 4, 1, 5, 0, 6, 4, 3, 3, 1, 6, 2, 4, 6, 3, 0, 4, 2, 3, 4,
-	2, 0, 6, 1, 0, 6, 0, 3, 4, 1, 0, 2, 0, 4, 0, 2, 6, 1, 6, 2,
-	3, 1, 6, 3, 3, 1, 3, 1, 6, 2, 5, 1, 5, 5, 6, 2, 0, 5, 3, 1,
-	4, 3, 4, 0, 1, 6, 4, 0, 4, 2, 5, 1, 0, 1, 3, 1, 5, 2, 0, 1,
-	5, 3, 0, 5, 6, 1, 2, 6, 2, 1, 0, 1, 5, 0, 1, 3, 5, 1, 3, 3,
-	6, 0, 4, 6, 2, 2, 6, 1, 6, 1, 3, 1, 3, 2, 5, 3, 1, 6, 3, 6,
-	0, 4, 3, 6, 1, 0, 5, 6, 0, 2, 5, 2, 3, 0, 6, 5, 2, 6, 5, 2,
-	1, 2, 5, 3, 2, 6, 3, 5, 4, 6, 3, 1, 2, 3, 3, 2, 3, 0, 3, 1,
-	2, 5, 2, 1, 6, 5, 0, 6, 4, 1, 2, 0, 6, 4, 2, 6, 3, 4, 2, 6,
-	3, 4, 5, 3, 2, 4, 0, 5, 0, 0, 6, 2, 5, 0, 2, 6, 3, 3, 6, 3,
-	4, 6, 5, 3, 4, 1, 4, 5, 1, 6, 0, 1, 2, 3, 4, 5, 2, 0, 6, 5,
-	5, 4, 0, 6, 1, 6, 5, 6, 2, 6, 5, 4, 1, 5, 4, 3, 4, 3, 2, 5,
-	6, 5, 0, 1, 5, 6, 2, 3, 2, 4, 1, 5, 1, 4, 6, 5, 3, 5, 0, 3,
-	0, 6, 1, 0, 3, 0, 1, 5, 1, 4, 1, 1, 6, 1, 5, 1, 2, 1, 2, 1,
-	1, 3, 6, 4, 3, 5, 0, 5, 1, 2, 5, 3, 4, 5, 3, 1, 1, 3, 0, 3,
-	2, 6, 5, 6, 1, 2, 0, 1, 2, 1, 0, 4, 2, 2, 0, 4, 4, 2, 0, 5,
-	3, 0, 1, 2, 0, 5, 3, 6, 1, 2, 2, 5, 3, 4, 2, 1, 6, 4, 2, 1,
-	4, 3, 4, 5, 2, 1, 2, 6, 1, 4, 1, 4, 2, 5, 4, 2, 3, 0, 6, 4,
-	5, 4, 6, 6, 3, 1, 2, 3, 6, 2, 1, 1, 3, 1, 5, 0, 3, 5, 1, 4,
-	6, 3, 6, 5, 2, 5, 2, 0, 6, 5, 2, 1, 0, 1, 2, 1, 6, 2, 0, 6,
-	0, 6, 3, 0, 4, 2, 1, 0, 2, 1, 4, 3, 0, 2, 0, 3, 2, 6, 2, 6,
-	1, 5, 2, 4, 1, 1, 6, 3, 2, 3, 5, 3, 2, 6, 5, 0, 6, 0, 2, 1,
-	2, 6, 3, 3, 3, 1, 2, 4, 3, 1, 4, 1, 0, 1, 4, 0, 2, 0, 1, 5,
-	3, 6, 1, 3, 0, 2, 5, 0, 6, 0, 2, 6, 0, 6, 0, 6, 4, 0, 5, 4,
-	4, 2, 6, 4, 6, 1, 3, 6, 2, 2, 1, 1, 5, 3, 3, 2, 3, 5, 1, 0,
-	5, 0, 4, 2, 4, 5, 0, 1, 3, 2, 5, 6, 3, 1, 0, 4, 1, 5, 2, 0,
-	6, 5, 4, 2, 1, 5, 3, 1, 0, 5, 3, 0, 3, 0, 3, 4, 3, 4, 2, 6,
-	0, 5, 2, 4, 2, 1, 0, 5, 6, 0, 4, 2, 5, 1, 0, 1, 6, 2, 6, 2,
-	1, 3, 5, 3, 4, 5, 3, 6, 3, 6, 1, 2, 6, 2, 5, 1, 4, 3, 4, 3,
-	2, 3, 6, 4, 2, 5, 3, 4, 0, 5, 3, 5, 3, 2, 6, 1, 5, 0, 1, 3,
-	3, 4, 0, 6, 3, 1, 4, 1, 2, 4, 5, 3, 0, 5, 1, 3, 5, 6, 1, 5,
-	4, 3, 0, 6, 5, 3, 5, 0, 5, 2, 4, 3, 6, 2, 5, 4, 0, 4, 2, 0,
-	5, 3, 2, 0, 1, 0, 3, 2, 1, 0, 5, 1, 0, 4, 0, 1, 2, 0, 2, 0,
-	6, 3, 6, 3, 0, 5, 6, 0, 3, 6, 4, 6, 4, 2, 6, 0, 6, 2, 0, 1,
-	0, 3, 5, 3, 6, 1, 2, 4, 2, 3, 2, 6, 1, 4, 3, 6, 4, 5, 1, 4,
-	1, 4, 5, 0, 2, 6, 2, 1, 1, 6, 3, 6, 2, 4, 5, 3, 6, 2, 0, 6,
-	2, 1, 0, 4, 3, 0, 4, 2, 1, 0, 3, 2, 0, 6, 4, 6, 2, 4, 5, 4,
-	3, 6, 5, 6, 6, 4, 6, 5, 4, 2, 3, 4, 6, 3, 3, 1, 2, 5, 4, 6,
-	4, 1, 0, 1, 5, 0, 3, 2, 3, 4, 2, 4, 3, 6, 2, 3, 5, 0, 4, 5,
-	5, 2, 0, 1, 0, 6, 0, 5, 6, 1, 5, 0, 3, 0, 6, 2, 0, 6, 1, 6,
-	6, 3, 2, 5, 2, 3, 5, 3, 6, 1, 0, 4, 1, 5, 2, 5, 6, 1, 2, 6,
-	0, 5, 1, 2, 1, 6, 4, 3, 5, 0, 1, 4, 6, 3, 2, 3, 5, 4, 0, 2,
-	1, 5, 2, 6, 3, 1, 2, 5, 1, 0, 2, 0, 2, 4, 1, 1, 6, 0, 6, 4,
-	2, 4, 5, 2, 0, 4, 2, 5, 2, 1, 5, 2, 3, 2, 0, 6, 1, 2, 1, 3,
-	3, 6, 2, 4, 3, 2, 4, 2, 4, 1, 3, 0, 6, 2, 3, 5, 6, 2, 6, 3,
-	4, 6, 0, 1, 4, 6, 1, 5, 5, 2, 1, 3, 0, 6, 0, 2, 1, 0, 1, 4,
-	5, 4, 2, 6, 3, 0, 4, 2, 5, 5, 0, 2, 1, 5, 4, 5, 3, 1, 4, 6,
-	6, 4, 2, 5, 2, 0, 5, 3, 2, 4, 2, 6, 1, 4, 0, 1, 4, 1, 5, 3,
-	0, 5, 3, 6, 0, 5, 1, 3, 6, 4, 0, 1, 2, 5, 6, 1, 0, 5, 0, 5,
-	1, 3, 2, 1, 0, 2, 1, 6, 4, 2, 6, 3, 3, 1, 0, 2, 6, 2, 5, 2,
-	2, 6, 3, 6, 5, 4, 0, 1, 0, 6, 0, 3, 1, 0, 6, 5, 0, 4, 0, 5,
-	3, 4, 2, 0, 2, 6, 2, 3, 0, 2, 1, 0, 5, 2, 1, 4, 3, 0, 6, 4,
-	4, 1, 5, 4, 3, 2, 1, 5, 5, 1, 6, 2, 1, 0, 4, 5, 1, 4, 5, 4,
-	5, 1, 4, 3, 5, 3, 6, 2, 0, 5, 1, 0, 6, 4, 0, 2, 0, 1, 2, 4,
-	6, 2, 0, 1, 6, 4, 3, 6, 1, 0, 4, 5, 0, 5, 4, 1, 4, 0, 4, 3,
-	0, 1, 4, 2, 4, 3, 5, 0, 1, 6, 4, 3, 5, 2, 1, 6, 2, 2, 1, 0,
-	1, 1, 4, 6, 2, 0, 1, 0, 6, 0, 2, 2, 4, 2, 6, 2, 0, 2, 3, 5,
-	2, 4, 5, 4, 3, 2, 5, 3, 6, 2, 5, 6, 3, 1, 3, 1, 3, 2, 0, 2,
-	3, 0, 2, 3, 2, 4, 0, 6, 3, 0, 2, 6, 3, 4, 0, 3, 4, 5, 3, 0,
-	4, 4, 2, 1, 5, 3, 4, 3, 6, 0, 6, 0, 2, 4, 5, 0, 5, 3, 0, 1,
-	5, 4, 5, 2, 1, 3, 6, 0, 4, 5, 1, 4, 3, 4, 6, 0, 6, 6, 4, 6,
-	6, 0, 4, 0, 1, 4, 5, 4, 0, 1, 6, 2, 6, 5, 6, 0, 3, 2, 4, 2,
-	0, 0, 1, 4, 6, 5, 0, 5, 0, 1, 2, 3, 5, 4, 3, 1, 4, 1, 1, 3,
-	1, 4, 2, 2, 1, 0, 6, 0, 5, 5, 4, 0, 3, 5, 6, 0, 5, 0, 2, 0,
-	2, 6, 5, 4, 2, 5, 3, 6, 6, 0, 2, 1, 3, 4, 0, 2, 0, 2, 0, 5,
-	3, 2, 1, 6, 1, 3, 4, 0, 1, 3, 1, 0, 4, 2, 6, 5, 4, 5, 5, 0,
-	4, 3, 0, 4, 2, 1, 4, 5, 1, 1, 1, 6, 2, 3, 0, 4, 3, 5, 6, 0,
-	5, 2, 4, 2, 0, 5, 6, 1, 3, 5, 2, 3, 1, 5, 6, 0, 4, 2, 5, 0,
-	6, 5, 1, 3, 4, 1, 0, 2, 4, 1, 0, 3, 5, 3, 2, 6, 3, 0, 1, 2,
-	0, 5, 2, 1, 6, 2, 4, 2, 0, 0, 2, 6, 2, 3, 6, 4, 2, 0, 4, 6,
-	1, 4, 0, 6, 3, 4, 1, 5, 6, 3, 6, 1, 2, 6, 0, 3, 4, 5, 1, 5,
-	2, 5, 6, 2, 3, 1, 6, 5, 4, 2, 6, 4, 3, 0, 3, 0, 6, 1, 3, 4,
-	3, 1, 5, 4, 5, 6, 3, 5, 2, 5, 1, 5, 1, 4, 1, 5, 1, 6, 1, 1,
-	4, 6, 5, 0, 1, 0, 2, 3, 1, 6, 1, 2, 4, 0, 6, 3, 0, 5, 4, 1,
-	5, 0, 3, 2, 5, 3, 6, 5, 4, 0, 6, 3, 1, 6, 2, 0, 1, 4, 2, 6,
-	6, 3, 1, 6, 3, 1, 0, 4, 6, 2, 4, 6, 3, 2, 6, 2, 1, 0, 6, 3,
-	0, 4, 2, 0, 4, 1, 6, 2, 5, 2, 4, 5, 6, 0, 5, 2, 1, 6, 3, 3,
-	1, 3, 4, 0, 1, 3, 2, 3, 1, 5, 0, 5, 1, 2, 3, 5, 3, 1, 3, 4,
-	2, 5, 2, 3, 2, 4, 0, 3, 6, 3, 1, 4, 0, 2, 1, 5, 3, 2, 6, 2,
-	3, 4, 6, 3, 1, 2, 5, 1, 5, 2, 1, 3, 2, 0, 2, 4, 3, 4, 5, 3,
-	4, 5, 4, 1, 6, 4, 1, 1, 2, 3, 3, 5, 6, 1, 2, 4, 6, 4, 3, 0,
-	5, 3, 6, 5, 6, 2, 6, 2, 0, 4, 6, 3, 0, 6, 3, 2, 0, 2, 4, 2,
-	6, 1, 5, 3, 3, 4, 3, 1, 5, 1, 0, 4, 4, 0, 4, 0, 5, 6, 3, 3,
-	0, 5, 0, 0, 3, 3, 0, 0, 4, 2, 4, 4, 6, 2, 4, 6, 0, 3, 1, 0,
-	1, 5, 4, 3, 0, 1, 2, 4, 0, 2, 3, 3, 4, 5, 4, 4, 0, 5, 4, 2,
-	2, 2, 1, 0, 1, 0, 1, 3, 3, 1, 2, 1, 3, 4, 0, 2, 4, 2, 5, 4,
-	3, 5, 1, 6, 3, 2, 4, 1, 6, 2, 5, 1, 6, 2, 4, 1, 1, 0, 6, 2,
-	4, 5, 1, 4, 1, 6, 5, 1, 5, 1, 5, 3, 2, 4, 3, 5, 5, 3, 1, 2,
-	5, 5, 4, 4, 0, 6, 4, 5, 2, 6, 3, 4, 0, 6, 4, 1, 0, 3, 4, 4,
-	6, 2, 0, 1, 0, 4, 3, 6, 4, 6, 0, 4, 1, 1, 1, 0, 3, 2, 0, 3,
-	0, 1, 4, 2, 6, 4, 0, 2, 4, 6, 5, 1, 1, 3, 4, 6, 1, 6, 1, 5,
-	1, 2, 5, 4, 1, 6, 3, 2, 6, 2, 6, 4, 6, 0, 2, 1, 0, 6, 2, 1,
-	2, 5, 5, 6, 2, 6, 5, 0, 1, 3, 1, 6, 0, 4, 5, 4, 6, 6, 3, 3,
-	3, 0, 1, 2, 5, 0, 2, 3, 0, 6, 3, 1, 3, 4, 5, 3, 0, 5, 0, 3,
-	4, 2, 1, 0, 3, 2, 1, 0, 4, 3, 0, 1, 2, 0, 4, 2, 4, 0, 3, 0,
-	5, 0, 4, 6, 2, 0, 1, 3, 5, 0, 6, 5, 4, 5, 3, 5, 0, 5, 0, 6,
-	6, 5, 3, 2, 0, 2, 6, 5, 4, 0, 2, 4, 5, 3, 0, 4, 6, 4, 3, 4,
-	0, 0, 5, 2, 3, 2, 3, 1, 5, 6, 4, 6, 3, 4, 0, 3, 4, 3, 4, 0,
-	1, 4, 0, 5, 4, 1, 2, 6, 0, 1, 5, 2, 1, 0, 6, 1, 4, 4, 1, 0,
-	2, 1, 2, 6, 4, 1, 2, 3, 1, 6, 5, 3, 3, 6, 2, 1, 1, 0, 2, 6,
-	3, 4, 5, 3, 2, 5, 2, 0, 3, 3, 5, 2, 4, 3, 0, 1, 3, 1, 2, 5,
-	4, 0, 3, 1, 3, 1, 1, 5, 4, 1, 5, 0, 5, 3, 6, 2, 4, 5, 1, 3,
-	5, 6, 0, 2, 3, 0, 5, 1, 6, 0, 3, 5, 0, 2, 5, 1, 5, 3, 5, 6,
-	6, 6, 1, 1, 6, 5, 6, 4, 5, 2, 5, 3, 1, 4, 0, 3, 1, 5, 1, 5,
-	0, 5, 1, 0, 6, 0, 5, 6, 0, 5, 4, 1, 2, 5, 1, 1, 0, 5, 6, 1,
-	1, 6, 2, 5, 0, 5, 1, 2, 6, 3, 5, 5, 2, 2, 0, 4, 2, 0, 6, 4,
-	2, 3, 5, 4, 5, 4, 6, 1, 6, 5, 1, 0, 4, 0, 5, 6, 0, 6, 1, 3,
-	3, 2, 1, 6, 4, 2, 6, 3, 1, 6, 3, 5, 3, 6, 0, 4, 2, 0, 6, 3,
-	4, 5, 4, 1, 2, 4, 3, 5, 0, 1, 1, 0, 4, 6, 0, 1, 6, 2, 6, 5,
-	5, 4, 2, 0, 2, 3, 5, 6, 1, 6, 2, 0, 2, 1, 4, 6, 4, 0, 1, 5,
-	6, 4, 2, 4, 5, 1, 5, 3, 6, 1, 6, 0, 5, 3, 3, 2, 4, 3, 0, 5,
-	0, 3, 1, 4, 5, 5, 6, 2, 4, 1, 4, 0, 3, 0, 4, 6, 2, 3, 3, 4,
-	1, 3, 2, 3, 1, 0, 5, 3, 5, 0, 1, 5, 0, 5, 6, 3, 0, 6, 0, 4,
-	2, 0, 2, 1, 2, 5, 6, 3, 2, 0, 2, 0, 1, 5, 1, 4, 1, 2, 1, 5,
-	3, 3, 6, 0, 6, 4, 0, 1, 3, 5, 1, 0, 2, 4, 6, 4, 3, 2, 3, 0,
-	4, 1, 5, 3, 4, 5, 0, 3, 1, 3, 0, 6, 3, 6, 4, 2, 0, 3, 1, 5,
-	5, 4, 6, 4, 1, 2, 1, 4, 5, 4, 1, 3, 5, 1, 5, 2, 3, 5, 2, 5,
-	6, 0, 1, 2, 6, 1, 4, 1, 4, 6, 0, 3, 5, 3, 5, 3, 4, 6, 1, 2,
-	0, 3, 5, 1, 2, 2, 6, 2, 4, 5, 5, 6, 4, 6, 4, 5, 6, 1, 5, 6,
-	1, 5, 0, 4, 3, 1, 5, 3, 5, 2, 0, 5, 1, 0, 5, 3, 2, 6, 1, 0,
-	2, 5, 3, 6, 0, 4, 3, 4, 0, 1, 0, 4, 0, 3, 0, 4, 1, 1, 2, 3,
-	3, 6, 3, 5, 0, 5, 1, 4, 6, 0, 6, 2, 3, 1, 5, 6, 5, 1, 3, 0,
-	4, 5, 2, 5, 6, 4, 2, 6, 3, 5, 3, 1, 4, 0, 1, 0, 3, 2, 5, 1,
-	5, 0, 2, 0, 4, 2, 5, 2, 1, 3, 2, 1, 3, 6, 4, 0, 4, 5, 6, 4,
-	6, 3, 2, 6, 4, 6, 4, 2, 6, 2, 1, 1, 6, 4, 0, 6, 4, 2, 6, 2,
-	0, 3, 5, 1, 6, 0, 1, 0, 2, 6, 1, 6, 0, 3, 1, 6, 2, 6, 1, 6,
-	1, 0, 1, 5, 6, 4, 1, 4, 1, 3, 1, 1, 3, 1, 0, 3, 5, 6, 1, 0,
-	2, 4, 0, 2, 5, 2, 3, 1, 5, 2, 5, 1, 6, 0, 1, 2, 1, 1, 1, 0,
-	3, 4, 3, 4, 3, 0, 0, 4, 1, 6, 0, 1, 0, 4, 6, 2, 5, 4, 1, 4,
-	4, 5, 5, 4, 2, 6, 3, 0, 5, 2, 0, 1, 3, 1, 2, 5, 4, 5, 0, 3,
-	5, 1, 3, 3, 2, 1, 6, 1, 4, 6, 0, 4, 6, 1, 1, 2, 0, 3, 0, 0,
-	6, 5, 1, 6, 5, 4, 6, 2, 6, 5, 3, 4, 2, 3, 1, 6, 3, 4, 5, 3,
-	0, 1, 4, 0, 4, 5, 4, 6, 5, 0, 1, 5, 0, 5, 2, 3, 6, 6, 4, 3,
-	1, 5, 3, 3, 2, 0, 2, 3, 3, 1, 6, 4, 2, 5, 1, 3, 5, 2, 0, 1,
-	2, 0, 3, 5, 5, 6, 2, 0, 5, 4, 0, 3, 0, 1, 2, 3, 5, 3, 3, 1,
-	3, 0, 2, 0, 2, 2, 6, 1, 3, 6, 4, 6, 3, 1, 1, 2, 5, 0, 2, 0,
-	4, 1, 1, 3, 4, 0, 4, 2, 2, 0, 1, 3, 4, 2, 4, 1, 2, 3, 1, 5,
-	5, 0, 4, 3, 2, 1, 0, 3, 1, 5, 2, 1, 5, 4, 6, 0, 6, 1, 1, 2,
-	6, 6, 2, 1, 4, 0, 5, 2, 6, 3, 2, 0, 6, 4, 3, 6, 2, 0, 6, 2,
-	0, 1, 2, 4, 1, 5, 1, 4, 5, 2, 3, 1, 1, 3, 5, 4, 6, 5, 0, 6,
-	1, 0, 2, 0, 0, 2, 6, 6, 3, 0, 1, 6, 0, 1, 0, 1, 0, 2, 0, 1,
-	2, 5, 0, 4, 0, 5, 1, 6, 4, 0, 4, 1, 4, 2, 5, 3, 5, 6, 6, 5,
-	3, 2, 1, 2, 5, 2, 0, 3, 6, 0, 4, 3, 4, 4, 0, 3, 6, 0, 3, 5,
-	4, 3, 6, 2, 1, 2, 6, 1, 6, 3, 5, 3, 5, 1, 0, 4, 0, 5, 2, 4,
-	5, 4, 5, 6, 0, 3, 0, 5, 3, 4, 5, 3, 2, 5, 2, 1, 3, 6, 4, 2,
-	6, 1, 3, 5, 3, 3, 0, 2, 4, 0, 3, 1, 4, 2, 0, 5, 4, 6, 1, 5,
-	0, 5, 2, 1, 3, 4, 2, 3, 2, 6, 0, 1, 0, 3, 1, 6, 4, 1, 3, 6,
-	1, 4, 6, 2, 3, 2, 1, 5, 4, 1, 6, 3, 3, 6, 0, 6, 2, 4, 1, 2,
-	2, 3, 1, 3, 5, 3, 0, 3, 6, 3, 6, 2, 3, 1, 2, 0, 3, 0, 2, 1,
-	3, 4, 1, 1, 2, 1, 5, 1, 1, 1, 6, 4, 0, 6, 4, 6, 1, 5, 0, 1,
-	4, 0, 6, 0, 5, 6, 3, 5, 2, 3, 1, 2, 5, 6, 2, 4, 4, 3, 4, 5,
-	5, 1, 5, 1, 0, 1, 0, 5, 4, 6, 6, 0, 2, 1, 0, 3, 0, 6, 0, 4,
-	6, 5, 4, 6, 5, 3, 4, 1, 3, 1, 0, 6, 0, 2, 2, 3, 6, 2, 4, 0,
-	0, 5, 2, 1, 5, 0, 5, 4, 5, 6, 4, 4, 5, 3, 6, 3, 5, 3, 5, 3,
-	1, 4, 1, 4, 6, 0, 5, 2, 5, 0, 3, 0, 3, 1, 6, 3, 5, 1, 2, 4,
-	2, 5, 2, 5, 3, 5, 4, 0, 3, 6, 5, 2, 5, 1, 6, 1, 5, 2, 6, 0,
-	3, 1, 0, 2, 5, 6, 1, 5, 2, 0, 4, 6, 2, 1, 2, 6, 3, 6, 1, 3,
-	4, 6, 2, 6, 0, 6, 2, 3, 5, 4, 0, 6, 5, 1, 3, 2, 0, 6, 1, 3,
-	5, 2, 3, 6, 5, 3, 1, 6, 4, 0, 4, 6, 5, 1, 1, 3, 3, 5, 3, 2,
-	6, 5, 2, 5, 5, 2, 4, 2, 4, 3, 2, 1, 3, 1, 0, 1, 6, 0, 4, 5,
-	0, 2, 5, 2, 6, 2, 2, 5, 0, 3, 6, 0, 1, 6, 4, 6, 4, 5, 4, 0,
-	1, 4, 3, 5, 6, 5, 0, 3, 5, 4, 0, 5, 3, 5, 4, 5, 3, 2, 1, 3,
-	2, 5, 6, 1, 4, 6, 4, 3, 6, 0, 1, 5, 2, 5, 2, 3, 2, 6, 0, 5,
-	3, 5, 3, 3, 4, 1, 4, 6, 0, 6, 0, 4, 3, 2, 1, 3, 0, 4, 3, 4,
-	4, 5, 1, 0, 6, 0, 6, 5, 3, 4, 5, 2, 6, 5, 2, 5, 0, 2, 5, 2,
-	5, 1, 6, 4, 2, 5, 0, 1, 5, 0, 6, 4, 1, 5, 1, 4, 6, 1, 5, 5,
-	6, 5, 6, 0, 4, 1, 4, 4, 6, 3, 2, 1, 5, 4, 5, 4, 0, 1, 0, 2,
-	0, 4, 6, 4, 0, 3, 5, 0, 1, 1, 5, 2, 4, 3, 3, 4, 2, 5, 2, 3,
-	1, 4, 5, 4, 3, 6, 2, 0, 2, 1, 6, 2, 5, 3, 4, 5, 0, 3, 3, 2,
-	2, 6, 1, 6, 5, 5, 2, 3, 0, 1, 6, 5, 1, 2, 4, 5, 0, 3, 4, 5,
-	3, 6, 4, 6, 3, 2, 6, 4, 2, 3, 3, 4, 5, 3, 1, 5, 2, 3, 3, 4,
-	4, 5, 4, 5, 3, 6, 3, 6, 2, 6, 5, 0, 4, 1, 5, 3, 0, 4, 3, 6,
-	5, 2, 5, 2, 1, 6, 0, 4, 2, 4, 5, 0, 4, 1, 2, 0, 1, 6, 2, 6,
-	6, 0, 4, 0, 3, 5, 1, 4, 0, 3, 0, 0, 1, 2, 6, 0, 6, 3, 0, 6,
-	0, 6, 2, 0, 4, 6, 3, 6, 0, 3, 4, 1, 1, 3, 2, 4, 0, 3, 5, 2,
-	1, 5, 4, 1, 6, 2, 3, 0, 2, 4, 2, 2, 1, 3, 4, 6, 2, 0, 2, 3,
-	2, 1, 4, 5, 3, 5, 0, 6, 2, 4, 0, 2, 4, 2, 0, 6, 3, 1, 4, 2,
-	3, 1, 4, 2, 0, 4, 0, 4, 1, 6, 4, 3, 0, 1, 5, 1, 2, 6, 4, 3,
-	4, 0, 2, 4, 3, 1, 4, 0, 0, 4, 6, 1, 4, 1, 3, 0, 2, 0, 6, 0,
-	5, 0, 6, 2, 0, 2, 0, 3, 1, 2, 6, 5, 3, 1, 4, 5, 6, 3, 1, 2,
-	6, 1, 1, 2, 0, 4, 3, 4, 5, 2, 5, 2, 3, 2, 1, 4, 4, 1, 0, 3,
-	0, 6, 1, 6, 0, 6, 0, 2, 0, 5, 1, 5, 4, 3, 3, 4, 5, 1, 2, 6,
-	1, 0, 3, 2, 4, 1, 6, 2, 6, 4, 1, 4, 0, 6, 0, 4, 6, 5, 5, 6,
-	2, 6, 3, 4, 2, 4, 2, 6, 3, 3, 5, 6, 1, 6, 2, 0, 5, 4, 5, 3,
-	3, 5, 5, 2, 3, 4, 2, 1, 3, 0, 3, 5, 0, 4, 6, 3, 1, 4, 0, 2,
-	4, 3, 5, 1, 5, 3, 2, 4, 2, 6, 4, 5, 1, 4, 6, 4, 2, 6, 1, 5,
-	5, 3, 6, 1, 2, 0, 6, 2, 6, 4, 0, 6, 2, 5, 1, 2, 1, 5, 1, 5,
-	6, 4, 0, 0, 2, 2, 6, 3, 6, 5, 0, 6, 2, 6, 4, 0, 5, 3, 2, 3,
-	0, 6, 0, 3, 0, 5, 2, 6, 2, 0, 3, 4, 3, 1, 5, 3, 4, 1, 2, 0,
-	1, 0, 3, 1, 6, 5, 6, 3, 2, 1, 1, 0, 3, 5, 0, 2, 0, 5, 0, 3,
-	2, 0, 4, 5, 6, 5, 4, 1, 3, 2, 4, 0, 4, 5, 1, 2, 1, 6, 4, 1,
-	3, 0, 0, 1, 0, 6, 0, 2, 4, 0, 3, 0, 4, 1, 0, 4, 4, 6, 2, 6,
-	4, 1, 0, 1, 0, 3, 2, 0, 1, 6, 2, 1, 4, 2, 0, 1, 3, 2, 0, 3,
-	5, 3, 4, 2, 0, 1, 1, 1, 5, 6, 1, 4, 6, 0, 3, 5, 4, 1, 0, 5,
-	6, 2, 1, 6, 0, 2, 1, 6, 2, 3, 4, 5, 0, 2, 0, 4, 5, 4, 5, 3,
-	0, 4, 6, 5, 6, 1, 5, 0, 5, 6, 5, 1, 0, 2, 1, 5, 1, 0, 5, 1,
-	1, 5, 2, 6, 1, 5, 0, 2, 3, 4, 2, 1, 3, 6, 0, 6, 3, 1, 2, 1,
-	2, 6, 3, 3, 2, 4, 6, 3, 6, 5, 4, 0, 2, 4, 0, 2, 6, 4, 6, 1,
-	3, 2, 1, 3, 1, 5, 0, 5, 2, 3, 5, 1, 0, 4, 6, 5, 4, 2, 5, 4,
-	4, 5, 2, 6, 3, 6, 3, 5, 1, 2, 6, 0, 6, 6, 1, 4, 3, 1, 3, 2,
-	5, 4, 6, 3, 4, 0, 4, 1, 6, 2, 0, 4, 3, 2, 1, 3, 1, 6, 5, 2,
-	6, 3, 4, 6, 4, 0, 1, 6, 4, 5, 6, 0, 6, 3, 3, 1, 4, 5, 6, 0,
-	0, 1, 6, 0, 1, 6, 2, 4, 6, 1, 2, 6, 2, 3, 4, 1, 3, 0, 5, 6,
-	1, 6, 0, 2, 5, 2, 3, 5, 0, 2, 6, 6, 3, 3, 2, 5, 6, 0, 5, 3,
-	2, 6, 1, 5, 1, 6, 2, 4, 0, 3, 4, 5, 0, 0, 3, 2, 0, 4, 2, 3,
-	3, 0, 2, 3, 1, 3, 5, 0, 6, 5, 0, 4, 1, 5, 3, 1, 0, 2, 6, 3,
-	4, 5, 1, 4, 6, 6, 3, 0, 4, 0, 4, 1, 2, 3, 1, 0, 6, 4, 3, 0,
-	5, 3, 5, 6, 0, 5, 1, 3, 5, 1, 4, 0, 6, 4, 6, 6, 3, 5, 0, 2,
-	6, 2, 4, 0, 4, 5, 1, 4, 2, 4, 2, 5, 1, 3, 0, 2, 5, 1, 4, 1,
-	0, 1, 2, 3, 4, 2, 3, 5, 4, 3, 1, 6, 5, 3, 1, 4, 1, 3, 2, 2,
-	1, 4, 2, 0, 2, 5, 4, 3, 0, 6, 3, 6, 1, 6, 3, 5, 2, 3, 1, 0,
-	2, 4, 4, 3, 0, 4, 1, 5, 2, 1, 3, 0, 1, 0, 3, 3, 3, 5, 6, 2,
-	3, 1, 2, 0, 6, 1, 0, 3, 4, 1, 4, 6, 3, 2, 4, 5, 6, 4, 0, 3,
-	4, 1, 4, 5, 2, 0, 5, 3, 6, 2, 2, 4, 2, 3, 6, 2, 1, 6, 4, 5,
-	5, 0, 4, 6, 2, 6, 2, 6, 1, 4, 2, 5, 1, 1, 1, 4, 1, 2, 3, 5,
-	6, 1, 4, 3, 6, 5, 3, 0, 5, 4, 3, 4, 6, 4, 6, 2, 5, 3, 1, 3,
-	0, 2, 0, 5, 0, 5, 0, 5, 0, 1, 4, 0, 1, 1, 5, 4, 6, 3, 0, 2,
-	1, 5, 0, 5, 1, 3, 5, 2, 0, 6, 1, 1, 2, 6, 4, 6, 0, 1, 3, 5,
-	2, 5, 1, 3, 1, 5, 4, 0, 5, 6, 5, 0, 3, 5, 4, 5, 3, 4, 3, 1,
-	3, 6, 3, 6, 1, 0, 2, 5, 2, 3, 0, 6, 4, 3, 6, 1, 1, 0, 5, 3,
-	4, 6, 5, 1, 3, 6, 3, 4, 1, 0, 5, 1, 5, 5, 1, 4, 2, 3, 4, 0,
-	5, 1, 2, 1, 3, 5, 3, 6, 5, 0, 3, 4, 2, 4, 0, 6, 4, 3, 5, 6,
-	6, 2, 4, 1, 0, 5, 1, 6, 0, 6, 2, 3, 1, 4, 3, 6, 0, 5, 4, 2,
-	0, 2, 3, 3, 0, 2, 0, 4, 5, 3, 5, 6, 1, 6, 0, 6, 5, 5, 4, 2,
-	1, 4, 1, 3, 6, 3, 5, 1, 4, 3, 0, 2, 6, 2, 0, 6, 1, 6, 5, 6,
-	2, 1, 6, 2, 3, 2, 4, 1, 3, 2, 1, 4, 1, 3, 4, 1, 5, 1, 2, 0,
-	3, 1, 0, 5, 5, 2, 5, 1, 2, 0, 3, 0, 1, 4, 2, 6, 2, 1, 4, 0,
-	4, 6, 2, 0, 2, 0, 6, 2, 0, 5, 2, 2, 6, 0, 6, 0, 6, 5, 2, 1,
-	5, 0, 3, 2, 1, 1, 3, 2, 1, 1, 5, 1, 5, 2, 1, 3, 4, 0, 5, 1,
-	6, 1, 4, 6, 2, 3, 1, 1, 4, 6, 1, 6, 1, 3, 5, 0, 6, 5, 3, 6,
-	0, 6, 4, 1, 5, 6, 0, 5, 6, 2, 6, 2, 5, 5, 5, 4, 3, 1, 6, 2,
-	1, 3, 5, 6, 0, 2, 3, 5, 6, 2, 6, 2, 5, 6, 2, 3, 1, 3, 0, 1,
-	2, 5, 1, 3, 1, 0, 6, 3, 2, 3, 2, 3, 3, 4, 0, 2, 0, 4, 1, 3,
-	3, 6, 4, 3, 0, 6, 0, 6, 2, 4, 1, 3, 4, 6, 3, 2, 6, 2, 3, 6,
-	4, 4, 3, 2, 2, 5, 1, 3, 2, 3, 4, 5, 5, 4, 5, 1, 0, 1, 0, 6,
-	5, 2, 5, 4, 2, 6, 4, 0, 1, 2, 3, 2, 6, 2, 4, 0, 4, 1, 5, 3,
-	6, 5, 4, 1, 3, 2, 2, 3, 4, 0, 6, 2, 4, 2, 5, 3, 5, 1, 4, 5,
-	0, 6, 2, 6, 1, 2, 2, 4, 6, 3, 6, 1, 0, 1, 4, 0, 1, 6, 5, 0,
-	1, 1, 2, 6, 5, 1, 4, 4, 2, 1, 1, 0, 4, 0, 4, 0, 2, 0, 5, 5,
-	2, 3, 0, 2, 1, 6, 5, 3, 2, 6, 3, 4, 3, 0, 4, 3, 2, 6, 0, 2,
-	3, 0, 1, 6, 4, 3, 0, 5, 6, 5, 3, 0, 1, 1, 0, 2, 6, 4, 2, 6,
-	4, 0, 6, 5, 0, 6, 3, 5, 6, 1, 3, 4, 0, 0, 2, 2, 4, 5, 1, 4,
-	5, 0, 5, 1, 2, 4, 6, 4, 1, 2, 0, 5, 2, 3, 3, 2, 6, 4, 6, 6,
-	6, 4, 3, 6, 0, 6, 4, 5, 4, 0, 1, 3, 3, 6, 3, 4, 5, 2, 3, 0,
-	0, 6, 0, 4, 2, 6, 0, 3, 1, 5, 0, 2, 4, 2, 1, 3, 4, 6, 6, 2,
-	1, 0, 1, 1, 0, 4, 5, 2, 1, 6, 2, 6, 0, 2, 1, 3, 2, 0, 5, 4,
-	2, 0, 5, 0, 1, 4, 5, 6, 6, 0, 2, 5, 2, 0, 1, 1, 3, 6, 0, 5,
-	3, 4, 0, 4, 4, 3, 0, 4, 5, 6, 4, 6, 4, 6, 5, 6, 1, 2, 6, 2,
-	4, 1, 5, 1, 2, 4, 0, 2, 4, 6, 2, 5, 0, 4, 4, 2, 0, 5, 4, 1,
-	5, 6, 3, 5, 1, 4, 5, 3, 5, 3, 0, 4, 2, 1, 0, 1, 0, 4, 5, 1,
-	6, 5, 4, 5, 2, 4, 3, 0, 4, 5, 1, 6, 5, 2, 6, 4, 6, 1, 6, 2,
-	0, 6, 5, 4, 0, 4, 6, 4, 3, 1, 4, 5, 4, 6, 3, 5, 1, 2, 3, 0,
-	1, 4, 0, 1, 6, 4, 1, 1, 2, 3, 4, 3, 4, 2, 1, 1, 0, 2, 0, 3,
-	2, 4, 1, 3, 4, 6, 4, 0, 6, 5, 1, 4, 0, 1, 5, 0, 1, 6, 4, 3,
-	3, 4, 2, 1, 0, 1, 6, 4, 3, 2, 1, 0, 3, 5, 6, 4, 3, 2, 0, 6,
-	4, 1, 5, 1, 5, 3, 5, 0, 3, 0, 4, 3, 0, 1, 3, 2, 5, 3, 2, 3,
-	5, 2, 6, 4, 5, 3, 4, 2, 6, 0, 2, 5, 1, 2, 0, 4, 5, 0, 3, 5,
-	6, 4, 5, 2, 4, 3, 0, 3, 4, 3, 5, 3, 1, 6, 1, 2, 0, 1, 6, 3,
-	0, 4, 2, 0, 1, 3, 1, 0, 2, 3, 5, 6, 1, 3, 1, 3, 1, 0, 5, 0,
-	1, 0, 3, 1, 0, 6, 4, 3, 6, 3, 2, 4, 5, 6, 0, 3, 2, 1, 2, 1,
-	2, 5, 3, 0, 6, 5, 1, 6, 0, 2, 0, 1, 2, 3, 1, 4, 3, 5, 6, 0,
-	3, 2, 5, 0, 6, 4, 5, 2, 3, 0, 4, 2, 3, 0, 3, 6, 2, 5, 0, 6,
-	4, 3, 1, 3, 0, 2, 5, 1, 0, 4, 6, 2, 4, 5, 2, 5, 5, 0, 5, 0,
-	5, 6, 1, 4, 3, 5, 1, 5, 3, 6, 2, 6, 1, 2, 3, 0, 3, 0, 1, 3,
-	6, 4, 0, 2, 6, 5, 6, 5, 6, 2, 6, 2, 5, 2, 2, 3, 5, 3, 5, 0,
-	0, 2, 4, 2, 2, 1, 0, 5, 1, 0, 2, 6, 5, 2, 3, 4, 1, 5, 2, 4,
-	1, 2, 1, 3, 5, 3, 5, 2, 1, 5, 3, 5, 3, 2, 0, 0, 1, 3, 1, 3,
-	2, 5, 3, 4, 0, 1, 1, 5, 1, 6, 4, 3, 0, 2, 3, 2, 1, 3, 0, 4,
-	3, 6, 4, 3, 5, 6, 4, 0, 2, 3, 0, 4, 5, 6, 1, 0, 3, 1, 2, 3,
-	4, 6, 0, 3, 1, 3, 5, 6, 4, 2, 5, 1, 6, 3, 0, 2, 1, 1, 0, 6,
-	5, 2, 6, 5, 1, 6, 4, 1, 2, 4, 3, 2, 5, 3, 4, 1, 0, 5, 4, 6,
-	6, 3, 2, 3, 5, 1, 4, 0, 4, 6, 1, 6, 2, 3, 2, 6, 0, 4, 0, 1,
-	0, 1, 3, 5, 6, 0, 2, 5, 1, 4, 6, 2, 0, 4, 5, 3, 5, 2, 1, 4,
-	1, 0, 5, 4, 2, 1, 6, 0, 6, 2, 6, 0, 5, 6, 5, 1, 3, 4, 5, 5,
-	2, 6, 4, 6, 1, 1, 2, 0, 2, 4, 0, 2, 4, 6, 2, 4, 5, 4, 1, 6,
-	3, 2, 4, 2, 5, 4, 1, 6, 1, 4, 6, 5, 6, 2, 6, 4, 1, 3, 5, 2,
-	4, 1, 4, 0, 4, 0, 5, 4, 0, 3, 5, 2, 4, 0, 1, 6, 0, 3, 4, 5,
-	5, 6, 1, 6, 4, 0, 3, 4, 1, 6, 6, 4, 3, 5, 6, 4, 1, 3, 1, 6,
-	6, 2, 5, 2, 4, 2, 4, 3, 2, 1, 0, 6, 5, 1, 5, 3, 0, 3, 4, 0,
-	0, 3, 2, 0, 2, 5, 0, 1, 0, 6, 0, 6, 2, 4, 3, 4, 0, 6, 0, 1,
-	1, 0, 1, 2, 3, 0, 2, 4, 2, 6, 5, 1, 4, 6, 0, 5, 0, 2, 3, 5,
-	2, 4, 5, 5, 6, 4, 1, 0, 1, 1, 5, 6, 2, 4, 6, 1, 5, 2, 4, 2,
-	3, 4, 0, 4, 3, 1, 3, 6, 2, 3, 0, 5, 6, 3, 3, 0, 2, 5, 6, 5,
-	4, 2, 6, 4, 2, 5, 0, 1, 5, 1, 2, 5, 1, 0, 3, 0, 2, 6, 2, 3,
-	5, 0, 6, 2, 5, 2, 5, 2, 0, 4, 1, 4, 1, 4, 0, 1, 6, 1, 5, 2,
-	6, 5, 2, 0, 3, 3, 1, 0, 2, 4, 2, 0, 0, 2, 1, 6, 2, 3, 0, 3,
-	0, 4, 6, 1, 6, 4, 3, 1, 2, 6, 5, 1, 4, 1, 4, 6, 2, 6, 0, 1,
-	1, 6, 2, 5, 3, 0, 6, 4, 5, 6, 4, 3, 4, 6, 2, 5, 3, 6, 2, 3,
-	2, 5, 4, 2, 1, 1, 6, 0, 2, 5, 3, 4, 6, 1, 3, 6, 2, 0, 2, 0,
-	3, 6, 5, 4, 1, 3, 5, 3, 1, 3, 4, 5, 4, 4, 3, 5, 4, 6, 5, 1,
-	4, 0, 5, 0, 1, 3, 0, 2, 0, 3, 3, 6, 6, 1, 4, 6, 2, 1, 2, 5,
-	5, 0, 5, 6, 4, 3, 6, 0, 2, 6, 2, 5, 1, 4, 0, 2, 0, 4, 0, 3,
-	6, 2, 0, 1, 2, 1, 3, 0, 3, 2, 5, 6, 3, 5, 4, 6, 0, 1, 3, 4,
-	0, 5, 4, 5, 4, 6, 5, 4, 3, 3, 1, 5, 3, 6, 5, 1, 1, 0, 2, 4,
-	1, 2, 5, 1, 0, 5, 3, 0, 5, 1, 0, 2, 0, 5, 6, 4, 1, 2, 4, 6,
-	2, 5, 3, 1, 5, 6, 1, 6, 2, 0, 6, 1, 4, 5, 0, 6, 4, 1, 2, 1,
-	3, 3, 4, 1, 2, 1, 6, 4, 2, 5, 4, 3, 1, 6, 6, 0, 1, 2, 3, 4,
-	4, 6, 1, 0, 6, 0, 1, 6, 0, 4, 4, 2, 5, 4, 0, 1, 4, 6, 3, 1,
-	5, 5, 1, 5, 2, 4, 6, 4, 1, 6, 5, 1, 0, 6, 2, 0, 3, 0, 2, 6,
-	6, 4, 5, 3, 2, 3, 0, 1, 0, 6, 0, 6, 3, 0, 1, 2, 1, 0, 2, 6,
-	0, 6, 3, 6, 5, 1, 4, 6, 0, 6, 1, 5, 2, 5, 3, 2, 3, 0, 6, 0,
-	1, 4, 0, 3, 1, 2, 3, 1, 2, 3, 3, 5, 4, 1, 5, 1, 5, 0, 3, 6,
-	2, 4, 2, 6, 0, 6, 3, 0, 1, 4, 5, 4, 1, 4, 2, 3, 3, 6, 5, 6,
-	3, 2, 5, 6, 5, 1, 1, 2, 1, 4, 6, 1, 2, 6, 6, 3, 2, 6, 3, 6,
-	4, 5, 3, 4, 3, 2, 6, 0, 3, 5, 2, 6, 0, 5, 6, 4, 5, 0, 5, 0,
-	5, 4, 4, 0, 3, 0, 1, 3, 6, 0, 6, 0, 2, 5, 6, 4, 3, 2, 5, 4,
-	6, 4, 2, 5, 3, 6, 5, 4, 5, 2, 6, 0, 5, 2, 4, 5, 1, 6, 2, 3,
-	0, 5, 0, 4, 0, 4, 1, 0, 4, 1, 0, 1, 2, 5, 1, 6, 5, 3, 3, 2,
-	1, 6, 1, 5, 2, 3, 5, 1, 4, 1, 3, 6, 5, 0, 2, 3, 6, 0, 0, 6,
-	2, 4, 6, 2, 1, 6, 0, 6, 2, 4, 6, 4, 3, 0, 5, 6, 5, 0, 1, 4,
-	3, 0, 4, 0, 4, 5, 6, 1, 6, 0, 1, 0, 1, 6, 2, 3, 0, 2, 5, 6,
-	4, 2, 0, 3, 2, 6, 5, 4, 2, 1, 0, 6, 4, 5, 0, 4, 6, 4, 5, 1,
-	5, 2, 1, 4, 6, 0, 1, 4, 5, 1, 5, 6, 2, 5, 1, 6, 4, 3, 4, 5,
-	6, 2, 3, 1, 4, 5, 2, 2, 5, 1, 4, 1, 5, 0, 2, 0, 6, 4, 5, 6,
-	0, 2, 4, 2, 2, 1, 0, 3, 0, 6, 2, 5, 6, 4, 0, 5, 1, 4, 6, 3,
-	1, 0, 3, 0, 4, 1, 0, 4, 1, 2, 0, 6, 3, 1, 5, 0, 4, 0, 4, 0,
-	2, 1, 0, 6, 5, 0, 6, 2, 5, 6, 4, 6, 2, 2, 1, 2, 4, 2, 1, 3,
-	3, 4, 5, 3, 1, 1, 4, 1, 0, 2, 0, 5, 4, 6, 5, 1, 2, 5, 4, 3,
-	4, 6, 4, 2, 6, 1, 2, 6, 6, 1, 6, 4, 5, 6, 3, 0, 2, 0, 2, 1,
-	5, 4, 2, 0, 3, 1, 3, 1, 4, 1, 2, 6, 5, 6, 3, 1, 5, 6, 5, 1,
-	6, 2, 0, 3, 2, 0, 4, 3, 6, 0, 6, 2, 4, 2, 1, 5, 1, 0, 2, 5,
-	0, 3, 0, 4, 0, 1, 3, 3, 2, 0, 3, 3, 0, 1, 0, 1, 5, 6, 2, 0,
-	1, 4, 1, 5, 2, 4, 3, 2, 2, 0, 2, 0, 6, 5, 6, 4, 4, 5, 1, 1,
-	2, 6, 5, 1, 4, 6, 2, 4, 2, 1, 6, 3, 1, 0, 5, 6, 2, 5, 1, 4,
-	3, 0, 2, 4, 5, 3, 6, 4, 3, 1, 0, 6, 0, 3, 6, 1, 2, 0, 4, 1,
-	4, 1, 3, 5, 1, 0, 4, 2, 0, 6, 1, 0, 2, 6, 3, 1, 6, 5, 5, 3,
-	5, 6, 0, 5, 2, 3, 4, 5, 2, 1, 2, 0, 3, 6, 2, 2, 4, 6, 2, 0,
-	6, 3, 4, 3, 2, 4, 0, 6, 2, 5, 1, 6, 3, 0, 4, 5, 6, 0, 1, 2,
-	0, 2, 5, 4, 3, 6, 5, 0, 2, 3, 0, 1, 0, 6, 0, 1, 0, 4, 6, 0,
-	1, 4, 3, 0, 1, 4, 5, 3, 4, 2, 0, 4, 6, 4, 3, 0, 2, 1, 0, 6,
-	2, 3, 5, 0, 3, 5, 2, 0, 0, 1, 0, 6, 3, 2, 2, 1, 0, 4, 2, 0,
-	3, 0, 4, 4, 5, 3, 0, 2, 4, 2, 4, 5, 3, 2, 6, 1, 4, 2, 4, 2,
-	4, 3, 1, 4, 1, 4, 0, 4, 6, 2, 5, 3, 2, 5, 3, 0, 6, 3, 5, 0,
-	5, 5, 1, 2, 1, 6, 1, 2, 3, 1, 4, 2, 0, 4, 6, 3, 2, 4, 2, 0,
-	6, 1, 3, 5, 4, 5, 2, 4, 2, 3, 6, 3, 4, 6, 2, 3, 0, 4, 1, 4,
-	0, 4, 0, 1, 0, 6, 2, 5, 1, 0, 4, 0, 3, 1, 4, 6, 1, 2, 3, 5,
-	1, 0, 1, 4, 1, 5, 1, 0, 6, 3, 4, 1, 1, 3, 0, 1, 5, 1, 4, 0,
-	2, 0, 5, 0, 4, 1, 6, 5, 0, 3, 6, 6, 3, 0, 2, 4, 0, 2, 1, 2,
-	3, 5, 0, 5, 6, 0, 2, 1, 1, 3, 1, 2, 5, 0, 1, 5, 5, 4, 5, 0,
-	4, 0, 2, 3, 2, 4, 6, 1, 2, 6, 1, 5, 3, 6, 2, 0, 1, 3, 6, 1,
-	5, 5, 2, 0, 2, 0, 2, 1, 3, 4, 5, 1, 6, 3, 2, 4, 1, 1, 5, 1,
-	6, 1, 1, 2, 1, 2, 1, 4, 2, 0, 4, 1, 5, 1, 4, 5, 1, 6, 5, 3,
-	0, 6, 5, 6, 3, 2, 1, 5, 1, 2, 0, 1, 5, 6, 3, 0, 1, 5, 6, 4,
-	1, 0, 4, 0, 2, 6, 3, 4, 3, 5, 1, 3, 2, 4, 6, 3, 2, 5, 1, 5,
-	2, 5, 1, 4, 1, 4, 1, 5, 6, 0, 5, 4, 5, 4, 2, 4, 3, 1, 3, 5,
-	3, 0, 5, 1, 0, 1, 4, 3, 0, 2, 4, 2, 0, 6, 3, 0, 6, 3, 0, 4,
-	4, 1, 1, 2, 1, 2, 6, 4, 1, 1, 1, 0, 5, 1, 2, 4, 6, 0, 1, 3,
-	5, 3, 0, 6, 2, 0, 5, 2, 5, 4, 5, 3, 2, 0, 3, 3, 2, 3, 6, 5,
-	6, 3, 3, 0, 3, 0, 2, 3, 4, 4, 2, 0, 6, 5, 4, 1, 2, 0, 4, 6,
-	0, 1, 3, 0, 5, 4, 3, 4, 3, 6, 2, 1, 5, 0, 6, 0, 2, 1, 6, 1,
-	1, 2, 6, 1, 3, 0, 1, 2, 3, 0, 6, 2, 3, 6, 5, 0, 1, 3, 6, 1,
-	2, 2, 3, 0, 2, 3, 1, 5, 2, 3, 5, 6, 4, 4, 1, 4, 1, 5, 6, 0,
-	3, 4, 2, 1, 6, 3, 4, 5, 1, 5, 3, 1, 1, 4, 1, 2, 6, 4, 0, 6,
-	4, 6, 5, 2, 3, 1, 3, 5, 6, 2, 5, 0, 2, 2, 3, 5, 1, 0, 4, 2,
-	5, 4, 0, 1, 2, 0, 4, 5, 2, 4, 3, 4, 6, 2, 0, 6, 0, 5, 3, 6,
-	6, 2, 4, 2, 1, 3, 0, 3, 0, 1, 6, 1, 3, 0, 2, 1, 6, 1, 2, 2,
-	0, 1, 4, 3, 1, 0, 5, 1, 1, 4, 3, 0, 5, 4, 1, 2, 4, 2, 1, 5,
-	1, 6, 5, 4, 3, 6, 3, 3, 4, 1, 0, 0, 2, 6, 2, 1, 6, 2, 6, 5,
-	2, 3, 6, 5, 1, 3, 3, 0, 1, 6, 2, 5, 1, 4, 1, 3, 0, 6, 1, 1,
-	3, 2, 0, 5, 0, 1, 4, 1, 6, 5, 6, 2, 0, 5, 4, 6, 4, 0, 0, 6,
-	4, 6, 0, 3, 2, 0, 6, 1, 4, 2, 5, 6, 5, 0, 6, 2, 4, 2, 3, 5,
-	5, 4, 0, 3, 6, 1, 3, 1, 6, 1, 2, 3, 6, 4, 6, 0, 6, 2, 1, 3,
-	6, 4, 4, 0, 2, 5, 1, 5, 0, 5, 3, 6, 5, 4, 2, 5, 1, 6, 0, 3,
-	0, 6, 0, 6, 3, 2, 5, 3, 3, 2, 5, 6, 0, 2, 3, 0, 2, 5, 1, 2,
-	1, 2, 1, 3, 6, 2, 1, 5, 1, 4, 5, 0, 1, 5, 1, 1, 4, 5, 1, 0,
-	2, 1, 6, 1, 3, 0, 2, 1, 1, 5, 4, 3, 5, 5, 0, 6, 0, 5, 2, 3,
-	3, 6, 5, 0, 4, 1, 4, 2, 3, 0, 5, 6, 2, 0, 3, 4, 3, 4, 0, 1,
-	4, 2, 0, 6, 2, 4, 3, 5, 6, 3, 0, 6, 4, 1, 0, 6, 5, 2, 0, 3,
-	5, 4, 5, 2, 3, 2, 0, 2, 5, 6, 5, 1, 6, 4, 0, 2, 5, 1, 3, 1,
-	6, 1, 0, 1, 0, 1, 3, 1, 0, 3, 2, 1, 4, 6, 4, 1, 4, 2, 4, 2,
-	0, 5, 2, 1, 3, 5, 2, 5, 3, 4, 2, 4, 3, 2, 3, 4, 3, 2, 3, 2,
-	1, 5, 6, 1, 0, 5, 6, 3, 6, 3, 6, 2, 1, 2, 0, 3, 6, 2, 0, 1,
-	2, 0, 1, 6, 5, 6, 3, 1, 6, 3, 4, 6, 2, 1, 5, 3, 6, 3, 5, 1,
-	3, 4, 0, 2, 0, 4, 5, 6, 3, 6, 4, 5, 3, 5, 3, 6, 2, 5, 4, 5,
-	4, 6, 0, 4, 3, 5, 1, 6, 4, 0, 1, 0, 3, 5, 1, 4, 2, 0, 5, 4,
-	5, 1, 3, 4, 4, 3, 1, 4, 1, 0, 6, 4, 1, 4, 0, 3, 5, 2, 0, 3,
-	6, 5, 6, 4, 3, 5, 4, 1, 3, 3, 5, 6, 4, 1, 5, 1, 5, 3, 0, 3,
-	0, 2, 6, 0, 6, 0, 6, 6, 2, 3, 6, 4, 5, 2, 1, 4, 2, 4, 5, 6,
-	1, 4, 0, 3, 2, 4, 0, 6, 1, 5, 4, 3, 6, 2, 5, 6, 2, 3, 2, 0,
-	2, 1, 3, 0, 1, 5, 1, 4, 0, 3, 5, 0, 0, 1, 6, 0, 0, 4, 3, 6,
-	3, 3, 3, 1, 5, 1, 5, 0, 3, 5, 3, 5, 1, 5, 2, 3, 3, 2, 0, 5,
-	4, 5, 6, 4, 4, 0, 6, 0, 0, 6, 6, 5, 0, 6, 1, 1, 5, 6, 5, 4,
-	5, 0, 6, 4, 5, 0, 2, 0, 5, 0, 3, 6, 2, 6, 2, 4, 5, 0, 2, 3,
-	6, 2, 6, 5, 0, 3, 3, 0, 5, 2, 4, 3, 6, 2, 4, 3, 6, 6, 2, 0,
-	0, 2, 1, 4, 5, 1, 0, 6, 6, 0, 1, 0, 3, 0, 5, 3, 5, 3, 0, 3,
-	1, 2, 3, 4, 2, 6, 1, 4, 5, 3, 2, 5, 0, 1, 2, 6, 5, 1, 5, 3,
-	2, 2, 1, 3, 4, 5, 2, 5, 5, 2, 3, 1, 3, 6, 2, 1, 3, 4, 6, 1,
-	3, 6, 0, 6, 4, 2, 5, 4, 6, 1, 5, 3, 6, 2, 0, 1, 2, 1, 6, 0,
-	4, 5, 6, 4, 0, 1, 3, 3, 5, 2, 6, 2, 5, 1, 6, 6, 6, 5, 0, 1,
-	5, 3, 1, 2, 0, 2, 2, 3, 5, 6, 1, 0, 6, 2, 6, 2, 4, 5, 3, 0,
-	6, 2, 1, 4, 2, 6, 5, 6, 0, 5, 3, 5, 1, 2, 5, 0, 6, 4, 6, 5,
-	0, 1, 6, 2, 0, 2, 6, 1, 2, 1, 4, 3, 1, 0, 4, 2, 0, 5, 1, 5,
-	1, 6, 2, 5, 4, 3, 1, 4, 2, 4, 3, 1, 3, 2, 4, 2, 3, 2, 1, 2,
-	2, 5, 3, 4, 3, 0, 3, 5, 4, 0, 3, 0, 6, 2, 1, 0, 3, 1, 4, 6,
-	3, 4, 0, 0, 3, 1, 2, 3, 1, 2, 1, 3, 0, 4, 6, 4, 5, 0, 4, 3,
-	4, 0, 5, 2, 1, 5, 3, 5, 4, 0, 5, 6, 3, 0, 2, 5, 6, 0, 1, 6,
-	5, 1, 4, 1, 6, 3, 0, 5, 4, 1, 6, 5, 1, 2, 4, 2, 4, 2, 1, 5,
-	6, 0, 5, 0, 6, 5, 3, 6, 0, 2, 3, 4, 2, 1, 2, 3, 2, 5, 4, 0,
-	0, 3, 5, 4, 5, 3, 0, 5, 4, 5, 0, 3, 0, 5, 1, 0, 3, 2, 1, 6,
-	1, 3, 3, 6, 4, 0, 5, 0, 2, 1, 0, 4, 3, 4, 3, 2, 3, 5, 0, 3,
-	2, 6, 3, 0, 6, 5, 1, 5, 2, 4, 3, 5, 6, 5, 1, 6, 0, 5, 4, 3,
-	3, 6, 5, 3, 3, 2, 6, 5, 4, 6, 3, 5, 2, 1, 2, 2, 5, 2, 6, 5,
-	4, 3, 6, 4, 3, 0, 6, 2, 0, 3, 5, 6, 5, 3, 3, 2, 0, 3, 4, 1,
-	5, 2, 6, 0, 2, 1, 5, 6, 3, 1, 6, 1, 2, 5, 3, 3, 5, 6, 1, 4,
-	6, 2, 5, 5, 6, 0, 3, 5, 4, 6, 5, 3, 5, 2, 0, 1, 0, 3, 6, 4,
-	0, 2, 4, 0, 5, 3, 4, 5, 3, 4, 6, 1, 6, 5, 4, 2, 0, 6, 6, 1,
-	1, 6, 1, 1, 4, 3, 4, 0, 1, 6, 5, 3, 0, 4, 1, 5, 0, 6, 5, 3,
-	2, 3, 2, 4, 2, 5, 6, 4, 6, 3, 0, 3, 3, 0, 0, 4, 2, 5, 3, 6,
-	3, 6, 1, 1, 2, 1, 0, 3, 6, 0, 4, 0, 1, 5, 0, 4, 5, 2, 0, 6,
-	4, 0, 2, 3, 2, 5, 4, 5, 3, 3, 6, 1, 2, 5, 3, 4, 3, 2, 1, 6,
-	5, 4, 0, 2, 0, 2, 4, 6, 3, 4, 2, 2, 6, 1, 3, 1, 3, 6, 0, 4,
-	6, 5, 4, 2, 5, 3, 4, 6, 1, 2, 0, 1, 6, 3, 1, 0, 5, 4, 3, 6,
-	0, 4, 6, 3, 4, 0, 1, 5, 4, 1, 2, 0, 6, 2, 6, 1, 2, 3, 4, 6,
-	1, 2, 0, 3, 0, 5, 2, 4, 5, 2, 1, 6, 1, 2, 3, 0, 1, 4, 3, 2,
-	2, 3, 5, 2, 0, 5, 5, 5, 3, 1, 3, 2, 1, 0, 4, 0, 1, 1, 2, 5,
-	3, 4, 5, 6, 2, 1, 6, 4, 3, 5, 0, 6, 4, 3, 0, 6, 3, 4, 3, 5,
-	4, 5, 6, 1, 4, 1, 2, 0, 6, 0, 1, 6, 1, 4, 6, 2, 0, 4, 5, 0,
-	5, 1, 4, 0, 4, 6, 1, 6, 0, 1, 3, 5, 1, 3, 2, 6, 5, 2, 4, 1,
-	6, 1, 2, 1, 6, 1, 4, 0, 6, 4, 2, 3, 4, 2, 4, 6, 1, 2, 5, 4,
-	0, 2, 3, 1, 6, 3, 2, 5, 0, 5, 6, 3, 3, 5, 6, 6, 5, 6, 2, 3,
-	1, 6, 1, 0, 1, 0, 3, 1, 2, 2, 1, 0, 3, 0, 6, 0, 2, 4, 5, 1,
-	2, 4, 3, 6, 2, 0, 5, 1, 3, 5, 1, 4, 1, 4, 2, 0, 5, 3, 6, 5,
-	3, 6, 3, 6, 4, 2, 1, 0, 3, 5, 6, 0, 4, 0, 0, 2, 3, 6, 0, 5,
-	4, 6, 4, 1, 3, 1, 4, 1, 3, 5, 2, 6, 6, 4, 1, 2, 3, 4, 6, 5,
-	5, 3, 1, 6, 4, 5, 3, 0, 3, 1, 6, 2, 4, 5, 0, 2, 4, 3, 4, 0,
-	6, 1, 3, 2, 3, 1, 2, 3, 2, 6, 3, 5, 1, 1, 1, 0, 5, 4, 2, 4,
-	0, 6, 1, 6, 5, 3, 4, 6, 4, 5, 0, 4, 1, 1, 4, 3, 5, 4, 6, 2,
-	1, 3, 4, 6, 0, 5, 1, 6, 3, 0, 5, 3, 3, 4, 2, 0, 3, 5, 4, 3,
-	2, 4, 3, 4, 2, 3, 4, 6, 3, 6, 0, 6, 1, 4, 2, 6, 3, 5, 1, 2,
-	3, 4, 6, 0, 3, 4, 2, 6, 1, 6, 0, 2, 0, 4, 6, 3, 2, 5, 3, 2,
-	4, 5, 0, 4, 5, 0, 1, 6, 2, 0, 5, 1, 2, 0, 1, 2, 3, 5, 6, 5,
-	5, 2, 0, 1, 4, 5, 5, 1, 5, 4, 3, 0, 4, 5, 1, 6, 5, 4, 6, 5,
-	6, 2, 0, 2, 4, 2, 5, 2, 0, 5, 6, 2, 6, 2, 3, 4, 4, 0, 6, 2,
-	0, 6, 3, 2, 3, 1, 5, 2, 4, 3, 0, 4, 0, 6, 2, 3, 0, 2, 5, 3,
-	1, 4, 6, 3, 5, 2, 1, 0, 5, 3, 3, 6, 0, 2, 5, 1, 0, 6, 5, 6,
-	2, 6, 3, 1, 0, 2, 1, 4, 1, 4, 6, 5, 2, 6, 3, 6, 0, 2, 3, 6,
-	3, 1, 4, 5, 2, 4, 2, 1, 4, 3, 6, 0, 2, 3, 3, 6, 4, 5, 1, 3,
-	4, 6, 0, 2, 5, 0, 1, 6, 6, 1, 3, 4, 0, 1, 5, 3, 2, 5, 2, 3,
-	5, 4, 4, 3, 6, 4, 0, 2, 3, 1, 3, 0, 2, 1, 2, 0, 4, 5, 3, 0,
-	6, 2, 3, 2, 6, 3, 6, 3, 5, 4, 5, 2, 5, 4, 1, 0, 4, 0, 4, 1,
-	0, 2, 4, 5, 4, 2, 4, 5, 2, 5, 1, 5, 5, 3, 6, 1, 5, 2, 6, 0,
-	1, 3, 1, 4, 6, 2, 1, 0, 6, 2, 1, 0, 6, 3, 2, 3, 5, 6, 0, 1,
-	2, 6, 1, 4, 6, 4, 0, 4, 1, 0, 6, 5, 2, 4, 3, 2, 3, 2, 3, 0,
-	3, 0, 3, 2, 5, 5, 6, 6, 1, 6, 0, 1, 6, 5, 1, 0, 1, 5, 2, 4,
-	4, 0, 5, 1, 3, 1, 5, 0, 6, 4, 0, 6, 1, 3, 2, 4, 5, 3, 0, 2,
-	5, 6, 5, 4, 0, 6, 3, 2, 6, 2, 2, 3, 4, 6, 1, 0, 4, 0, 3, 5,
-	6, 2, 5, 6, 2, 6, 2, 1, 6, 3, 5, 3, 6, 2, 0, 2, 5, 0, 5, 6,
-	0, 1, 6, 4, 6, 2, 0, 3, 0, 2, 5, 4, 0, 6, 0, 2, 4, 3, 6, 4,
-	1, 0, 6, 1, 6, 3, 5, 6, 2, 5, 3, 2, 1, 0, 2, 3, 0, 2, 1, 4,
-	2, 1, 2, 0, 2, 0, 4, 6, 0, 6, 2, 3, 1, 4, 1, 6, 0, 6, 4, 0,
-	3, 3, 2, 6, 2, 3, 4, 1, 4, 0, 6, 4, 0, 5, 4, 2, 6, 1, 4, 2,
-	4, 2, 0, 3, 1, 2, 5, 2, 3, 2, 4, 0, 2, 5, 3, 1, 2, 3, 6, 0,
-	5, 0, 3, 2, 1, 2, 1, 5, 0, 6, 1, 2, 6, 5, 1, 3, 4, 5, 3, 4,
-	6, 3, 2, 4, 2, 6, 1, 4, 2, 3, 3, 1, 6, 1, 5, 1, 2, 4, 2, 3,
-	0, 5, 2, 6, 4, 0, 1, 4, 2, 5, 6, 0, 3, 1, 4, 3, 0, 3, 2, 5,
-	1, 6, 2, 0, 3, 4, 2, 6, 5, 4, 2, 6, 0, 4, 1, 6, 4, 2, 1, 0,
-	2, 1, 3, 4, 3, 2, 5, 2, 6, 0, 1, 3, 6, 6, 3, 2, 4, 6, 3, 1,
-	3, 6, 1, 6, 0, 6, 1, 6, 5, 5, 0, 5, 1, 1, 6, 2, 6, 3, 1, 6,
-	4, 5, 2, 0, 1, 0, 4, 5, 0, 2, 0, 3, 0, 1, 0, 1, 2, 3, 0, 4,
-	5, 4, 2, 1, 5, 4, 6, 5, 2, 1, 5, 6, 2, 0, 4, 5, 4, 1, 4, 2,
-	6, 4, 1, 0, 3, 4, 2, 0, 5, 6, 6, 2, 3, 0, 1, 1, 3, 5, 6, 3,
-	0, 1, 5, 1, 6, 5, 2, 0, 2, 0, 6, 3, 6, 0, 3, 5, 1, 5, 3, 4,
-	1, 2, 1, 3, 6, 1, 3, 2, 3, 5, 3, 0, 2, 1, 6, 2, 3, 2, 1, 2,
-	2, 5, 0, 5, 1, 0, 5, 1, 4, 3, 0, 1, 4, 5, 3, 5, 6, 1, 4, 6,
-	3, 4, 6, 2, 5, 2, 6, 3, 4, 6, 4, 6, 4, 5, 6, 5, 1, 0, 3, 6,
-	4, 3, 0, 6, 5, 3, 0, 6, 2, 1, 6, 5, 3, 6, 2, 0, 3, 4, 6, 2,
-	5, 0, 5, 6, 2, 0, 4, 6, 1, 5, 2, 4, 2, 6, 1, 6, 5, 1, 3, 0,
-	6, 2, 6, 1, 0, 2, 3, 4, 2, 6, 4, 5, 2, 5, 1, 6, 3, 3, 4, 5,
-	0, 4, 0, 1, 2, 0, 2, 5, 3, 4, 2, 3, 4, 6, 1, 0, 5, 0, 6, 2,
-	1, 3, 0, 3, 4, 2, 2, 3, 4, 3, 5, 3, 5, 2, 5, 4, 3, 0, 6, 2,
-	2, 0, 5, 3, 4, 2, 0, 2, 6, 0, 1, 0, 4, 5, 6, 0, 2, 5, 4, 3,
-	3, 0, 6, 0, 2, 5, 0, 6, 5, 6, 1, 4, 6, 1, 2, 0, 2, 4, 4, 0,
-	4, 2, 1, 6, 3, 0, 5, 4, 5, 2, 5, 0, 1, 6, 0, 5, 3, 5, 0, 5,
-	5, 2, 0, 2, 3, 1, 4, 6, 4, 2, 4, 6, 5, 3, 0, 1, 3, 6, 4, 5,
-	6, 4, 2, 5, 0, 6, 5, 4, 5, 6, 2, 5, 4, 1, 6, 0, 5, 4, 5, 2,
-	0, 2, 0, 2, 4, 1, 4, 5, 6, 0, 1, 5, 0, 5, 6, 6, 2, 0, 1, 0,
-	1, 4, 6, 2, 4, 4, 0, 6, 0, 2, 1, 3, 6, 2, 1, 4, 6, 3, 5, 0,
-	2, 1, 6, 2, 5, 5, 0, 2, 1, 0, 6, 0, 5, 1, 2, 5, 1, 6, 2, 4,
-	3, 1, 5, 2, 0, 3, 5, 6, 2, 2, 1, 1, 6, 5, 1, 0, 3, 6, 3, 0,
-	4, 5, 0, 3, 4, 0, 2, 5, 2, 6, 1, 1, 3, 2, 4, 2, 4, 6, 5, 2,
-	5, 6, 1, 5, 1, 0, 4, 2, 0, 5, 0, 2, 5, 1, 2, 1, 5, 1, 2, 4,
-	6, 6, 2, 3, 2, 6, 1, 5, 0, 2, 1, 5, 0, 1, 6, 1, 3, 6, 2, 6,
-	0, 2, 1, 0, 1, 2, 1, 4, 0, 5, 3, 4, 0, 6, 5, 5, 1, 2, 6, 2,
-	1, 4, 6, 0, 5, 2, 3, 1, 2, 6, 2, 1, 0, 1, 0, 0, 2, 4, 6, 3,
-	2, 5, 0, 6, 2, 5, 6, 4, 1, 5, 2, 6, 3, 3, 1, 0, 2, 1, 0, 2,
-	3, 4, 5, 2, 1, 0, 6, 2, 0, 2, 5, 3, 1, 5, 0, 5, 2, 0, 5, 6,
-	4, 0, 4, 0, 5, 0, 1, 3, 0, 6, 5, 4, 3, 6, 5, 0, 1, 2, 6, 1,
-	5, 2, 5, 6, 0, 1, 2, 4, 1, 6, 0, 0, 5, 3, 1, 3, 6, 2, 1, 6,
-	6, 0, 1, 2, 4, 1, 4, 2, 5, 2, 3, 5, 4, 6, 4, 2, 3, 6, 4, 6,
-	0, 5, 3, 4, 0, 5, 6, 0, 3, 6, 2, 6, 4, 5, 4, 1, 3, 5, 1, 5,
-	1, 4, 1, 3, 2, 4, 0, 6, 1, 0, 4, 6, 1, 5, 2, 3, 6, 2, 5, 0,
-	2, 0, 6, 6, 0, 1, 5, 4, 3, 0, 5, 6, 3, 2, 4, 0, 3, 1, 6, 5,
-	3, 1, 4, 2, 1, 6, 5, 6, 3, 0, 4, 5, 6, 5, 0, 5, 5, 1, 4, 6,
-	4, 6, 0, 4, 1, 3, 6, 4, 0, 3, 3, 4, 6, 0, 5, 3, 0, 1, 6, 3,
-	5, 4, 4, 2, 4, 3, 0, 1, 2, 0, 3, 3, 6, 3, 0, 4, 6, 4, 3, 2,
-	6, 4, 6, 4, 0, 1, 4, 3, 0, 2, 5, 6, 1, 0, 4, 3, 5, 3, 3, 2,
-	0, 6, 1, 2, 1, 1, 1, 5, 4, 2, 5, 0, 6, 0, 3, 5, 5, 6, 2, 3,
-	1, 5, 1, 6, 0, 2, 4, 0, 1, 6, 2, 4, 2, 6, 4, 6, 5, 6, 4, 6,
-	2, 5, 1, 5, 0, 4, 2, 1, 2, 6, 3, 2, 1, 3, 4, 5, 6, 4, 3, 6,
-	3, 6, 2, 6, 1, 0, 5, 0, 5, 0, 4, 1, 5, 6, 4, 1, 6, 2, 4, 3,
-	4, 1, 5, 3, 2, 0, 0, 6, 2, 0, 6, 3, 4, 6, 5, 1, 5, 2, 4, 0,
-	5, 2, 0, 4, 6, 0, 4, 1, 4, 1, 4, 1, 1, 1, 6, 3, 5, 0, 1, 4,
-	6, 4, 0, 1, 4, 0, 4, 1, 0, 6, 1, 4, 3, 2, 5, 4, 5, 1, 3, 6,
-	0, 2, 0, 2, 4, 3, 1, 5, 4, 5, 2, 6, 1, 3, 0, 2, 6, 1, 2, 0,
-	1, 2, 3, 3, 4, 3, 2, 1, 0, 3, 5, 1, 5, 3, 2, 6, 6, 0, 2, 4,
-	2, 3, 6, 4, 2, 6, 0, 2, 4, 5, 2, 2, 4, 1, 1, 0, 3, 2, 4, 6,
-	3, 5, 3, 6, 1, 4, 2, 0, 2, 0, 2, 5, 1, 3, 5, 2, 1, 3, 0, 3,
-	4, 0, 5, 1, 0, 4, 4, 2, 2, 0, 3, 6, 4, 5, 6, 4, 1, 4, 6, 6,
-	5, 6, 5, 0, 2, 1, 5, 2, 4, 3, 6, 0, 4, 1, 2, 0, 4, 6, 3, 4,
-	6, 5, 1, 0, 6, 6, 4, 2, 0, 3, 4, 2, 1, 0, 1, 4, 0, 3, 2, 5,
-	0, 1, 0, 1, 6, 1, 0, 5, 2, 0, 5, 3, 6, 5, 1, 0, 2, 1, 3, 5,
-	1, 3, 2, 4, 1, 4, 6, 0, 4, 3, 6, 2, 3, 4, 3, 3, 2, 0, 2, 5,
-	2, 0, 6, 1, 5, 4, 6, 2, 5, 1, 4, 2, 0, 5, 6, 2, 1, 2, 0, 1,
-	3, 3, 0, 2, 0, 3, 6, 2, 1, 1, 4, 0, 5, 3, 6, 0, 1, 4, 3, 5,
-	4, 3, 2, 3, 1, 3, 5, 0, 0, 2, 3, 6, 0, 6, 0, 6, 5, 4, 0, 3,
-	5, 3, 6, 5, 1, 5, 4, 6, 4, 0, 2, 0, 1, 3, 4, 6, 5, 5, 3, 1,
-	6, 1, 1, 6, 5, 1, 0, 3, 2, 6, 5, 2, 4, 4, 3, 1, 1, 4, 6, 0,
-	0, 5, 0, 3, 5, 1, 5, 1, 3, 1, 5, 6, 2, 4, 3, 6, 1, 5, 0, 1,
-	1, 4, 6, 4, 3, 5, 4, 2, 6, 1, 6, 2, 5, 1, 3, 4, 3, 4, 1, 0,
-	2, 0, 1, 1, 4, 0, 3, 6, 1, 6, 1, 2, 3, 2, 5, 1, 1, 3, 5, 3,
-	3, 1, 2, 1, 6, 4, 5, 2, 4, 1, 6, 2, 1, 6, 4, 2, 6, 4, 4, 2,
-	4, 2, 6, 2, 1, 0, 5, 2, 1, 0, 6, 5, 3, 3, 2, 6, 4, 2, 6, 3,
-	5, 3, 0, 3, 6, 2, 6, 2, 0, 3, 0, 3, 1, 3, 5, 4, 5, 6, 4, 2,
-	6, 2, 4, 1, 5, 4, 3, 2, 6, 3, 1, 0, 5, 3, 4, 2, 2, 4, 1, 3,
-	0, 4, 2, 6, 2, 6, 5, 0, 3, 2, 1, 4, 0, 5, 0, 2, 1, 2, 0, 3,
-	1, 3, 4, 6, 1, 2, 5, 3, 4, 1, 2, 3, 0, 2, 1, 4, 0, 5, 3, 4,
-	2, 0, 6, 1, 4, 5, 6, 6, 2, 3, 4, 0, 2, 5, 1, 5, 4, 0, 5, 1,
-	3, 0, 1, 5, 4, 4, 3, 2, 4, 2, 0, 6, 0, 5, 4, 0, 3, 6, 5, 0,
-	4, 1, 2, 5, 0, 4, 3, 3, 4, 0, 2, 6, 6, 2, 4, 0, 6, 4, 1, 5,
-	5, 0, 4, 5, 2, 6, 0, 4, 3, 0, 1, 5, 6, 2, 6, 3, 1, 0, 4, 2,
-	6, 5, 4, 2, 1, 2, 0, 2, 3, 4, 2, 3, 5, 3, 5, 4, 2, 6, 5, 4,
-	0, 2, 1, 4, 3, 0, 1, 3, 0, 3, 0, 3, 5, 2, 6, 4, 2, 1, 1, 2,
-	1, 4, 5, 6, 0, 4, 2, 3, 0, 3, 4, 5, 3, 0, 1, 4, 4, 6, 1, 5,
-	2, 3, 0, 4, 0, 5, 1, 3, 3, 1, 0, 4, 2, 5, 5, 6, 5, 4, 1, 3,
-	3, 1, 5, 0, 6, 1, 3, 1, 6, 0, 2, 5, 3, 4, 1, 2, 4, 5, 3, 2,
-	4, 5, 0, 6, 3, 6, 4, 0, 1, 1, 0, 0, 2, 4, 0, 2, 1, 4, 0, 1,
-	5, 2, 1, 5, 3, 5, 3, 2, 3, 1, 5, 0, 3, 4, 2, 3, 0, 5, 5, 1,
-	6, 5, 4, 2, 5, 1, 2, 4, 6, 1, 5, 0, 1, 5, 4, 3, 0, 2, 6, 1,
-	0, 2, 4, 1, 2, 6, 3, 5, 1, 2, 3, 2, 6, 3, 6, 2, 5, 2, 1, 5,
-	1, 4, 2, 4, 6, 1, 5, 6, 5, 1, 2, 6, 3, 2, 4, 4, 6, 1, 0, 4,
-	2, 6, 2, 6, 4, 1, 0, 6, 1, 3, 5, 0, 3, 4, 2, 5, 0, 6, 1, 6,
-	3, 1, 3, 6, 2, 4, 0, 5, 3, 5, 0, 4, 1, 2, 1, 5, 1, 6, 3, 0,
-	4, 1, 2, 1, 5, 6, 1, 2, 3, 3, 0, 5, 6, 4, 3, 4, 0, 2, 3, 1,
-	5, 2, 0, 3, 4, 6, 0, 3, 6, 4, 5, 1, 2, 6, 0, 6, 0, 6, 0, 4,
-	6, 5, 2, 5, 4, 3, 5, 3, 0, 5, 2, 3, 6, 0, 6, 2, 5, 1, 0, 3,
-	0, 1, 3, 6, 5, 2, 3, 4, 2, 6, 3, 1, 3, 2, 5, 2, 5, 2, 4, 2,
-	1, 0, 3, 0, 2, 0, 2, 2, 4, 3, 3, 6, 1, 2, 5, 6, 3, 0, 0, 0,
-	2, 5, 1, 5, 3, 0, 2, 5, 0, 6, 4, 6, 5, 3, 1, 5, 1, 2, 2, 1,
-	3, 0, 2, 4, 4, 2, 4, 3, 0, 6, 2, 4, 1, 5, 6, 6, 2, 4, 0, 1,
-	4, 3, 4, 3, 6, 5, 6, 5, 0, 3, 2, 0, 2, 1, 2, 3, 1, 0, 5, 3,
-	5, 4, 0, 3, 6, 2, 1, 1, 6, 0, 1, 6, 1, 0, 1, 5, 1, 3, 2, 0,
-	6, 0, 4, 2, 6, 4, 1, 1, 6, 3, 4, 3, 6, 2, 4, 0, 5, 2, 0, 1,
-	0, 4, 0, 1, 4, 2, 2, 0, 6, 5, 4, 2, 6, 0, 5, 0, 3, 4, 1, 5,
-	1, 5, 3, 2, 1, 3, 5, 1, 6, 1, 5, 3, 1, 1, 3, 4, 2, 0, 1, 2,
-	2, 4, 0, 2, 6, 2, 0, 3, 5, 2, 1, 5, 2, 0, 1, 5, 2, 3, 1, 5,
-	3, 0, 2, 5, 4, 2, 1, 5, 0, 4, 6, 4, 2, 1, 6, 1, 2, 4, 2, 5,
-	4, 3, 6, 0, 2, 6, 4, 6, 1, 0, 2, 1, 6, 2, 0, 4, 5, 6, 3, 6,
-	5, 1, 6, 2, 3, 4, 2, 0, 3, 3, 5, 2, 1, 4, 0, 1, 6, 2, 3, 1,
-	6, 4, 5, 1, 0, 3, 2, 5, 1, 5, 1, 6, 5, 2, 3, 0, 5, 1, 0, 1,
-	0, 3, 2, 6, 0, 3, 6, 2, 1, 5, 3, 2, 5, 1, 6, 0, 5, 0, 3, 4,
-	1, 0, 1, 2, 6, 0, 5, 1, 0, 1, 6, 1, 5, 1, 6, 5, 1, 5, 0, 6,
-	2, 6, 5, 4, 2, 1, 5, 3, 6, 1, 4, 6, 1, 4, 1, 5, 2, 1, 4, 1,
-	3, 2, 6, 1, 6, 5, 6, 4, 1, 2, 3, 4, 2, 5, 6, 1, 2, 0, 3, 2,
-	4, 6, 4, 5, 4, 4, 6, 0, 5, 4, 5, 6, 2, 5, 3, 1, 6, 3, 0, 1,
-	5, 3, 3, 4, 2, 0, 3, 3, 2, 4, 6, 3, 2, 3, 6, 6, 4, 6, 2, 1,
-	6, 5, 2, 5, 4, 1, 6, 1, 1, 4, 2, 6, 6, 0, 6, 3, 2, 5, 1, 3,
-	0, 2, 1, 0, 2, 3, 1, 0, 2, 0, 6, 1, 4, 0, 3, 3, 2, 4, 1, 5,
-	1, 1, 3, 4, 2, 3, 4, 0, 2, 6, 1, 5, 1, 6, 1, 3, 1, 6, 1, 2,
-	2, 3, 5, 0, 6, 2, 6, 0, 3, 1, 1, 0, 6, 2, 6, 1, 6, 5, 3, 0,
-	3, 1, 5, 1, 6, 0, 3, 6, 0, 3, 0, 0, 1, 2, 0, 5, 2, 3, 0, 3,
-	4, 6, 5, 6, 2, 0, 5, 4, 6, 4, 5, 1, 2, 0, 3, 1, 2, 1, 5, 4,
-	5, 4, 6, 0, 1, 6, 0, 3, 4, 1, 0, 6, 4, 3, 4, 2, 6, 0, 4, 1,
-	6, 4, 0, 1, 6, 5, 5, 0, 3, 6, 1, 5, 1, 6, 0, 4, 6, 3, 1, 4,
-	0, 4, 2, 0, 5, 2, 3, 5, 2, 4, 2, 5, 2, 1, 1, 3, 0, 6, 4, 6,
-	1, 4, 5, 3, 5, 5, 4, 2, 0, 6, 5, 6, 0, 4, 1, 6, 3, 1, 3, 0,
-	2, 0, 1, 4, 2, 3, 2, 1, 0, 4, 6, 2, 3, 6, 5, 2, 4, 5, 6, 3,
-	3, 6, 0, 5, 6, 2, 3, 2, 3, 4, 2, 0, 2, 4, 0, 3, 5, 3, 6, 4,
-	4, 6, 3, 1, 0, 5, 2, 4, 0, 6, 5, 4, 3, 6, 0, 1, 0, 3, 5, 2,
-	5, 6, 3, 5, 1, 5, 3, 4, 6, 0, 5, 4, 5, 5, 2, 3, 4, 4, 3, 1,
-	6, 0, 5, 1, 0, 3, 5, 4, 0, 1, 3, 6, 3, 3, 5, 6, 5, 4, 5, 6,
-	0, 2, 0, 2, 4, 1, 5, 1, 4, 1, 0, 3, 3, 0, 5, 4, 2, 4, 1, 4,
-	1, 0, 6, 0, 4, 6, 0, 2, 5, 6, 1, 2, 3, 5, 2, 0, 2, 0, 1, 5,
-	2, 1, 4, 2, 5, 2, 6, 1, 6, 1, 5, 0, 0, 5, 4, 3, 0, 3, 2, 1,
-	3, 6, 2, 0, 5, 1, 6, 0, 6, 2, 3, 6, 2, 4, 6, 3, 4, 6, 5, 1,
-	4, 3, 6, 1, 3, 0, 2, 5, 2, 0, 5, 3, 6, 5, 1, 2, 6, 4, 2, 5,
-	5, 1, 4, 1, 2, 5, 4, 3, 6, 2, 6, 1, 4, 2, 1, 4, 3, 0, 1, 0,
-	6, 5, 4, 1, 0, 6, 6, 2, 3, 5, 0, 2, 4, 0, 2, 4, 0, 5, 1, 4,
-	0, 3, 1, 3, 4, 3, 3, 5, 0, 4, 0, 6, 4, 1, 0, 5, 0, 6, 1, 2,
-	1, 5, 5, 2, 0, 3, 1, 3, 0, 6, 2, 5, 2, 5, 1, 4, 6, 4, 0, 6,
-	2, 0, 6, 6, 2, 5, 3, 6, 5, 4, 3, 2, 2, 6, 1, 6, 4, 6, 2, 4,
-	3, 0, 6, 0, 5, 2, 6, 5, 3, 5, 2, 6, 1, 4, 2, 1, 0, 5, 0, 4,
-	4, 4, 3, 4, 4, 2, 0, 6, 1, 4, 0, 3, 2, 1, 5, 4, 5, 3, 0, 5,
-	5, 4, 3, 5, 3, 6, 5, 4, 5, 2, 6, 3, 2, 3, 5, 0, 4, 0, 3, 0,
-	6, 2, 3, 4, 5, 1, 6, 2, 1, 3, 1, 6, 2, 3, 4, 2, 1, 6, 3, 2,
-	0, 2, 0, 6, 1, 3, 1, 0, 2, 6, 0, 1, 6, 3, 5, 0, 2, 5, 6, 5,
-	1, 0, 4, 3, 5, 3, 4, 1, 0, 1, 4, 3, 1, 3, 5, 6, 5, 4, 4, 5,
-	2, 6, 2, 3, 1, 0, 2, 3, 6, 1, 6, 3, 1, 6, 5, 2, 6, 2, 0, 0,
-	3, 1, 5, 6, 4, 5, 1, 0, 1, 2, 3, 4, 6, 6, 4, 5, 3, 0, 6, 0,
-	4, 5, 3, 4, 6, 2, 4, 1, 3, 4, 1, 2, 6, 3, 6, 5, 1, 5, 6, 0,
-	5, 3, 5, 0, 3, 4, 5, 1, 6, 2, 0, 1, 3, 5, 6, 2, 1, 4, 6, 2,
-	6, 3, 5, 4, 1, 0, 2, 5, 2, 0, 0, 6, 1, 0, 1, 6, 4, 6, 3, 5,
-	0, 4, 0, 5, 1, 6, 0, 3, 1, 2, 0, 1, 6, 4, 0, 6, 1, 2, 6, 2,
-	1, 2, 1, 0, 3, 4, 2, 0, 2, 5, 2, 5, 6, 5, 1, 1, 2, 5, 6, 3,
-	2, 0, 1, 1, 0, 4, 6, 1, 4, 5, 6, 2, 1, 4, 3, 0, 3, 2, 1, 4,
-	3, 4, 5, 4, 2, 5, 0, 5, 0, 5, 2, 1, 2, 6, 1, 0, 3, 6, 2, 6,
-	4, 1, 0, 5, 2, 1, 1, 5, 6, 2, 3, 2, 3, 0, 6, 0, 3, 3, 1, 6,
-	5, 0, 6, 1, 5, 2, 2, 0, 3, 5, 1, 2, 1, 6, 1, 4, 2, 5, 1, 6,
-	6, 5, 0, 3, 2, 4, 0, 3, 6, 1, 6, 1, 0, 6, 2, 1, 4, 2, 1, 0,
-	0, 4, 5, 5, 2, 4, 6, 4, 1, 6, 2, 5, 4, 6, 0, 5, 3, 5, 5, 1,
-	1, 0, 1, 1, 0, 5, 4, 0, 2, 3, 0, 5, 0, 2, 0, 4, 5, 3, 0, 2,
-	2, 0, 3, 5, 3, 0, 2, 0, 6, 6, 3, 2, 4, 6, 4, 0, 4, 0, 1, 6,
-	3, 6, 0, 6, 4, 6, 4, 6, 1, 2, 0, 4, 1, 3, 6, 2, 3, 2, 0, 2,
-	4, 5, 0, 4, 1, 0, 2, 1, 2, 3, 3, 3, 4, 3, 2, 6, 1, 2, 6, 4,
-	5, 2, 5, 4, 1, 6, 3, 5, 0, 1, 6, 6, 5, 6, 5, 1, 4, 5, 2, 0,
-	6, 0, 3, 2, 5, 0, 5, 4, 1, 6, 4, 6, 1, 2, 5, 3, 0, 4, 0, 2,
-	0, 5, 6, 0, 1, 0, 1, 0, 6, 2, 4, 6, 5, 3, 4, 6, 5, 0, 5, 6,
-	1, 0, 2, 1, 6, 2, 5, 4, 2, 2, 5, 2, 2, 1, 6, 0, 2, 4, 0, 4,
-	2, 1, 4, 1, 6, 1, 4, 2, 5, 1, 6, 1, 3, 3, 3, 2, 2, 6, 5, 3,
-	3, 1, 1, 1, 0, 1, 1, 2, 4, 2, 4, 3, 5, 2, 1, 4, 0, 6, 5, 3,
-	4, 5, 2, 4, 1, 2, 1, 5, 1, 0, 1, 4, 2, 1, 5, 6, 1, 6, 0, 1,
-	5, 3, 0, 2, 5, 4, 5, 6, 0, 2, 6, 2, 1, 0, 6, 1, 5, 3, 2, 2,
-	6, 3, 2, 5, 6, 0, 6, 1, 4, 0, 3, 3, 5, 4, 0, 4, 2, 4, 5, 4,
-	0, 0, 5, 6, 0, 3, 1, 5, 1, 6, 5, 0, 2, 3, 0, 3, 2, 0, 3, 4,
-	1, 5, 4, 3, 0, 3, 0, 1, 1, 0, 2, 3, 5, 2, 6, 2, 3, 3, 0, 0,
-	2, 3, 6, 6, 0, 4, 6, 1, 4, 3, 3, 5, 4, 0, 2, 1, 5, 0, 2, 5,
-	3, 3, 5, 4, 2, 4, 6, 2, 4, 3, 2, 1, 0, 5, 1, 2, 0, 1, 0, 2,
-	4, 6, 4, 3, 6, 4, 5, 1, 3, 4, 2, 6, 2, 6, 2, 4, 3, 6, 4, 5,
-	5, 6, 0, 4, 5, 0, 1, 0, 1, 2, 5, 0, 3, 0, 5, 2, 1, 3, 5, 1,
-	6, 2, 0, 0, 2, 0, 1, 6, 0, 4, 0, 4, 6, 5, 6, 0, 3, 4, 5, 3,
-	0, 3, 4, 0, 6, 1, 1, 2, 3, 6, 2, 1, 0, 3, 3, 5, 4, 0, 5, 0,
-	1, 0, 4, 0, 4, 2, 6, 5, 4, 6, 1, 3, 2, 5, 1, 2, 2, 3, 0, 6,
-	2, 1, 6, 0, 2, 4, 5, 6, 4, 0, 0, 6, 2, 0, 3, 3, 4, 3, 3, 2,
-	3, 6, 5, 0, 4, 1, 4, 3, 3, 6, 4, 2, 5, 0, 4, 6, 2, 2, 1, 0,
-	4, 0, 5, 2, 5, 0, 6, 4, 6, 1, 6, 1, 0, 4, 3, 1, 6, 1, 2, 1,
-	5, 0, 4, 1, 5, 1, 4, 2, 3, 5, 6, 5, 6, 0, 4, 1, 6, 2, 5, 4,
-	6, 1, 6, 0, 1, 0, 4, 3, 1, 2, 0, 1, 2, 1, 5, 2, 5, 6, 4, 2,
-	0, 2, 6, 2, 4, 2, 1, 5, 1, 3, 2, 0, 4, 2, 5, 3, 0, 2, 6, 3,
-	1, 0, 5, 4, 5, 4, 6, 0, 1, 5, 3, 4, 2, 0, 2, 5, 4, 2, 0, 5,
-	2, 1, 6, 2, 1, 6, 5, 1, 6, 1, 3, 2, 4, 6, 3, 4, 2, 6, 4, 0,
-	3, 2, 6, 2, 2, 2, 6, 6, 0, 2, 5, 3, 3, 2, 0, 4, 1, 5, 6, 2,
-	4, 1, 5, 4, 2, 5, 4, 5, 1, 6, 4, 5, 4, 3, 2, 5, 1, 0, 4, 5,
-	5, 4, 0, 5, 1, 0, 2, 1, 3, 4, 2, 1, 3, 1, 1, 2, 6, 5, 0, 6,
-	6, 2, 4, 6, 3, 0, 6, 2, 2, 4, 0, 2, 4, 2, 5, 0, 1, 6, 2, 3,
-	0, 0, 6, 0, 6, 5, 6, 2, 6, 1, 5, 2, 4, 1, 2, 4, 4, 6, 0, 6,
-	1, 4, 3, 6, 3, 5, 1, 2, 1, 5, 5, 6, 1, 5, 2, 5, 4, 1, 6, 1,
-	2, 0, 6, 1, 0, 3, 0, 1, 4, 2, 0, 6, 1, 1, 3, 1, 6, 5, 6, 4,
-	3, 3, 4, 3, 5, 4, 0, 3, 2, 0, 3, 0, 3, 4, 3, 0, 1, 2, 6, 0,
-	4, 4, 5, 3, 1, 2, 3, 0, 5, 0, 3, 2, 6, 4, 1, 6, 0, 2, 1, 1,
-	5, 0, 5, 6, 6, 0, 6, 5, 3, 4, 6, 3, 6, 0, 4, 5, 4, 6, 5, 4,
-	6, 4, 2, 3, 6, 0, 6, 0, 4, 3, 4, 2, 1, 3, 1, 4, 1, 5, 1, 4,
-	0, 6, 1, 3, 5, 0, 0, 4, 6, 2, 5, 3, 5, 6, 2, 5, 1, 3, 1, 4,
-	1, 0, 5, 1, 0, 3, 0, 2, 6, 4, 4, 2, 2, 1, 0, 1, 3, 4, 3, 5,
-	2, 4, 4, 6, 0, 2, 0, 4, 6, 1, 5, 0, 2, 5, 5, 1, 1, 3, 1, 6,
-	3, 4, 0, 5, 5, 1, 2, 0, 4, 6, 2, 6, 3, 4, 3, 2, 6, 2, 3, 1,
-	4, 3, 4, 3, 6, 2, 4, 1, 4, 0, 2, 4, 4, 6, 4, 2, 6, 2, 0, 5,
-	5, 2, 1, 4, 3, 2, 6, 0, 3, 2, 6, 2, 3, 3, 5, 0, 4, 6, 3, 0,
-	6, 0, 6, 0, 2, 5, 2, 3, 5, 2, 5, 1, 5, 2, 1, 2, 1, 5, 6, 0,
-	0, 2, 4, 1, 1, 2, 2, 4, 1, 0, 6, 0, 2, 3, 1, 5, 3, 0, 4, 6,
-	1, 3, 1, 1, 5, 2, 6, 2, 3, 5, 6, 3, 2, 0, 2, 5, 2, 4, 0, 5,
-	2, 0, 4, 2, 5, 4, 2, 3, 6, 2, 3, 1, 3, 4, 5, 1, 0, 5, 0, 6,
-	3, 2, 6, 1, 0, 6, 5, 0, 6, 5, 1, 3, 4, 3, 1, 2, 1, 3, 0, 6,
-	4, 0, 5, 4, 1, 1, 1, 0, 1, 2, 1, 2, 1, 5, 3, 4, 5, 0, 1, 1,
-	5, 4, 2, 6, 2, 3, 0, 6, 1, 1, 3, 2, 4, 0, 2, 6, 1, 2, 6, 4,
-	6, 4, 3, 0, 5, 0, 4, 2, 0, 0, 3, 5, 4, 5, 4, 5, 1, 1, 5, 6,
-	0, 2, 0, 4, 2, 6, 4, 6, 3, 0, 1, 2, 2, 5, 0, 6, 2, 3, 3, 0,
-	1, 3, 1, 3, 3, 4, 6, 2, 1, 1, 0, 6, 5, 3, 2, 4, 6, 1, 4, 3,
-	2, 4, 3, 5, 2, 3, 0, 1, 0, 6, 3, 4, 6, 5, 0, 3, 2, 0, 6, 0,
-	3, 6, 2, 0, 6, 2, 2, 4, 2, 6, 4, 2, 0, 3, 1, 4, 1, 4, 6, 5,
-	4, 2, 4, 2, 1, 2, 5, 4, 3, 5, 6, 2, 4, 3, 1, 4, 6, 2, 4, 4,
-	5, 1, 6, 2, 0, 3, 0, 3, 6, 0, 5, 1, 5, 0, 5, 1, 3, 6, 5, 6,
-	6, 4, 2, 4, 2, 4, 3, 2, 1, 2, 5, 4, 0, 4, 1, 6, 2, 4, 2, 6,
-	0, 4, 6, 1, 6, 2, 6, 5, 0, 1, 2, 1, 5, 6, 1, 0, 5, 1, 0, 1,
-	1, 0, 2, 0, 6, 2, 5, 1, 4, 6, 0, 2, 0, 1, 3, 4, 2, 6, 2, 6,
-	2, 5, 1, 0, 3, 6, 4, 3, 5, 3, 3, 5, 0, 3, 5, 3, 2, 6, 5, 6,
-	3, 2, 1, 3, 4, 1, 6, 2, 0, 3, 6, 1, 0, 1, 2, 1, 0, 1, 1, 4,
-	4, 0, 6, 2, 5, 1, 3, 1, 3, 0, 2, 3, 6, 4, 3, 0, 4, 4, 3, 6,
-	5, 4, 1, 5, 0, 6, 4, 5, 3, 0, 6, 1, 1, 6, 2, 1, 2, 0, 4, 6,
-	6, 0, 6, 3, 2, 5, 3, 0, 4, 6, 4, 5, 5, 4, 1, 6, 5, 0, 6, 5,
-	0, 5, 3, 2, 6, 0, 6, 5, 3, 4, 3, 0, 3, 1, 6, 6, 3, 4, 5, 1,
-	1, 2, 0, 6, 0, 5, 3, 2, 1, 3, 0, 1, 6, 5, 1, 3, 1, 5, 1, 4,
-	2, 5, 6, 2, 1, 3, 6, 5, 6, 2, 0, 3, 2, 0, 1, 5, 3, 6, 2, 1,
-	3, 6, 2, 6, 1, 2, 5, 6, 5, 4, 0, 1, 5, 1, 0, 4, 1, 5, 1, 0,
-	4, 3, 5, 0, 3, 1, 1, 5, 6, 1, 6, 0, 1, 6, 4, 3, 6, 2, 0, 2,
-	5, 3, 6, 2, 0, 3, 5, 2, 6, 2, 5, 0, 6, 4, 0, 2, 2, 3, 6, 0,
-	6, 1, 4, 5, 0, 4, 1, 4, 2, 0, 1, 3, 1, 2, 5, 2, 3, 5, 2, 6,
-	0, 6, 5, 4, 1, 4, 3, 0, 3, 0, 4, 1, 6, 2, 3, 6, 0, 3, 5, 1,
-	1, 6, 4, 5, 3, 6, 5, 3, 6, 0, 0, 6, 6, 2, 1, 4, 6, 5, 1, 5,
-	2, 6, 0, 5, 2, 4, 1, 0, 5, 4, 2, 0, 5, 0, 5, 1, 3, 4, 0, 3,
-	3, 1, 6, 1, 4, 3, 1, 4, 0, 4, 3, 2, 1, 2, 5, 4, 2, 1, 6, 1,
-	4, 3, 1, 0, 2, 5, 4, 6, 4, 6, 4, 6, 2, 4, 2, 1, 0, 5, 4, 1,
-	5, 3, 4, 2, 3, 2, 3, 1, 2, 6, 4, 5, 3, 5, 3, 0, 6, 4, 3, 2,
-	6, 3, 4, 0, 1, 0, 5, 1, 5, 0, 3, 0, 6, 3, 4, 0, 6, 3, 3, 0,
-	0, 5, 0, 4, 6, 5, 2, 4, 2, 1, 5, 3, 1, 2, 2, 0, 5, 1, 4, 0,
-	1, 5, 2, 5, 1, 6, 5, 6, 4, 3, 6, 5, 6, 1, 6, 1, 5, 5, 4, 2,
-	2, 0, 6, 4, 0, 4, 0, 1, 2, 1, 3, 4, 1, 5, 0, 2, 1, 6, 4, 1,
-	3, 6, 2, 0, 1, 5, 4, 4, 4, 2, 1, 4, 3, 6, 3, 2, 0, 4, 2, 1,
-	4, 0, 6, 5, 0, 1, 4, 1, 4, 5, 6, 4, 1, 6, 0, 1, 3, 4, 2, 4,
-	5, 4, 1, 2, 6, 4, 0, 6, 3, 6, 5, 2, 4, 6, 1, 0, 3, 2, 5, 0,
-	6, 1, 3, 6, 4, 3, 5, 1, 5, 3, 3, 1, 2, 3, 1, 3, 1, 2, 4, 1,
-	0, 0, 1, 2, 0, 2, 3, 5, 5, 3, 1, 6, 3, 6, 3, 0, 0, 2, 1, 6,
-	1, 5, 0, 6, 5, 3, 1, 4, 2, 4, 4, 3, 0, 1, 5, 3, 4, 5, 1, 6,
-	2, 0, 3, 0, 6, 4, 4, 3, 0, 1, 6, 3, 4, 4, 4, 5, 4, 1, 6, 4,
-	3, 5, 6, 4, 2, 3, 3, 6, 4, 1, 6, 5, 1, 6, 4, 2, 5, 4, 0, 5,
-	4, 2, 5, 0, 5, 4, 6, 0, 6, 1, 2, 4, 5, 3, 2, 5, 4, 2, 1, 3,
-	5, 6, 4, 1, 6, 4, 4, 0, 1, 2, 1, 5, 4, 1, 4, 3, 4, 6, 2, 0,
-	6, 2, 1, 4, 6, 2, 2, 3, 6, 1, 3, 2, 5, 4, 5, 2, 0, 5, 0, 6,
-	0, 6, 4, 2, 4, 0, 0, 3, 2, 1, 3, 4, 3, 0, 5, 3, 4, 1, 0, 1,
-	1, 4, 2, 5, 1, 2, 4, 1, 2, 5, 2, 1, 3, 6, 5, 1, 5, 2, 3, 6,
-	2, 5, 2, 6, 1, 5, 0, 5, 1, 2, 1, 4, 1, 4, 2, 3, 1, 3, 5, 6,
-	3, 4, 1, 2, 4, 1, 2, 3, 4, 3, 2, 1, 3, 1, 2, 3, 0, 1, 0, 6,
-	4, 0, 4, 3, 0, 3, 1, 1, 4, 0, 6, 4, 5, 2, 5, 1, 2, 1, 0, 1,
-	5, 1, 2, 5, 6, 2, 1, 5, 1, 2, 1, 6, 1, 3, 1, 3, 1, 0, 3, 4,
-	6, 2, 4, 0, 5, 1, 6, 4, 1, 3, 3, 6, 3, 0, 4, 3, 3, 0, 3, 6,
-	0, 3, 4, 6, 2, 6, 2, 5, 6, 2, 5, 1, 6, 0, 2, 0, 1, 4, 0, 4,
-	1, 5, 1, 2, 5, 5, 1, 5, 3, 5, 3, 5, 1, 5, 0, 6, 2, 3, 4, 5,
-	2, 5, 2, 4, 3, 6, 0, 6, 1, 0, 5, 0, 3, 4, 3, 5, 6, 2, 1, 0,
-	3, 4, 5, 2, 3, 3, 2, 6, 4, 3, 4, 1, 1, 2, 6, 1, 5, 2, 4, 0,
-	4, 6, 5, 0, 2, 5, 6, 1, 5, 1, 2, 6, 2, 6, 4, 3, 2, 2, 4, 5,
-	5, 2, 3, 6, 0, 6, 3, 6, 3, 1, 2, 4, 1, 2, 5, 0, 5, 3, 6, 1,
-	6, 0, 3, 2, 6, 4, 3, 6, 5, 1, 5, 1, 3, 6, 2, 3, 0, 5, 1, 3,
-	0, 4, 2, 1, 0, 1, 6, 5, 4, 0, 5, 3, 1, 5, 0, 5, 0, 3, 1, 5,
-	1, 0, 1, 5, 1, 5, 0, 2, 0, 4, 4, 6, 4, 2, 0, 6, 0, 4, 3, 0,
-	2, 3, 5, 6, 0, 4, 2, 6, 1, 1, 4, 1, 0, 3, 6, 6, 3, 5, 0, 1,
-	3, 2, 1, 4, 1, 0, 2, 5, 4, 1, 3, 3, 1, 0, 4, 1, 3, 6, 2, 0,
-	4, 5, 1, 1, 6, 0, 1, 2, 1, 4, 2, 3, 3, 4, 5, 6, 1, 6, 0, 2,
-	5, 4, 6, 5, 1, 4, 4, 5, 0, 4, 1, 3, 2, 4, 3, 1, 1, 6, 4, 3,
-	6, 1, 6, 4, 1, 2, 1, 5, 0, 3, 5, 1, 6, 0, 5, 6, 1, 5, 4, 2,
-	0, 5, 4, 2, 0, 2, 6, 6, 5, 2, 0, 4, 5, 0, 1, 4, 2, 5, 4, 6,
-	1, 4, 3, 2, 4, 5, 1, 6, 2, 0, 3, 2, 1, 6, 2, 0, 2, 3, 1, 5,
-	2, 6, 0, 5, 3, 5, 3, 4, 5, 3, 0, 2, 1, 2, 3, 4, 0, 2, 1, 4,
-	3, 1, 0, 6, 4, 4, 3, 5, 1, 5, 0, 1, 2, 0, 2, 0, 3, 2, 4, 5,
-	4, 6, 0, 5, 1, 3, 3, 5, 2, 4, 2, 0, 2, 3, 6, 2, 3, 4, 0, 2,
-	5, 2, 0, 4, 6, 5, 1, 6, 2, 5, 6, 4, 3, 0, 6, 1, 6, 1, 5, 1,
-	6, 6, 4, 2, 3, 3, 5, 0, 6, 4, 2, 1, 4, 1, 3, 5, 2, 3, 0, 6,
-	0, 2, 6, 1, 4, 1, 2, 5, 3, 6, 0, 2, 3, 2, 5, 3, 1, 0, 3, 4,
-	1, 4, 6, 2, 3, 1, 4, 5, 4, 0, 3, 5, 3, 1, 5, 6, 2, 3, 2, 3,
-	2, 0, 5, 1, 2, 4, 1, 1, 3, 3, 4, 3, 1, 5, 0, 0, 3, 6, 3, 5,
-	3, 2, 0, 3, 4, 3, 0, 6, 4, 2, 0, 6, 4, 0, 5, 2, 0, 4, 3, 2,
-	4, 1, 5, 0, 1, 5, 6, 2, 3, 6, 0, 6, 2, 2, 5, 0, 6, 0, 3, 6,
-	5, 2, 1, 6, 0, 5, 4, 2, 3, 0, 1, 3, 0, 6, 1, 4, 2, 1, 5, 1,
-	6, 2, 1, 2, 6, 0, 5, 1, 6, 2, 4, 0, 6, 1, 3, 6, 1, 1, 2, 6,
-	0, 6, 6, 0, 2, 6, 2, 6, 5, 1, 4, 3, 3, 1, 4, 3, 6, 5, 1, 2,
-	1, 5, 4, 4, 0, 3, 2, 0, 6, 1, 2, 3, 1, 0, 2, 1, 3, 3, 2, 0,
-	2, 1, 6, 1, 3, 0, 5, 1, 6, 2, 6, 3, 2, 1, 6, 4, 3, 4, 1, 1,
-	3, 0, 5, 3, 6, 1, 4, 6, 4, 0, 2, 5, 2, 0, 2, 1, 0, 1, 6, 0,
-	4, 2, 1, 0, 3, 5, 0, 0, 2, 3, 4, 0, 2, 2, 0, 0, 3, 0, 1, 2,
-	5, 4, 5, 0, 4, 0, 5, 1, 0, 5, 6, 2, 4, 5, 3, 4, 5, 1, 3, 6,
-	6, 0, 6, 2, 6, 5, 4, 5, 1, 4, 0, 6, 3, 4, 0, 5, 2, 0, 2, 4,
-	0, 6, 2, 1, 0, 4, 3, 5, 4, 0, 1, 0, 3, 2, 3, 0, 4, 2, 5, 3,
-	1, 3, 2, 2, 6, 1, 5, 1, 6, 0, 4, 0, 5, 6, 4, 3, 1, 0, 3, 0,
-	2, 3, 1, 3, 6, 6, 2, 1, 5, 0, 5, 1, 5, 0, 3, 6, 3, 6, 2, 5,
-	3, 4, 3, 5, 3, 5, 6, 3, 1, 2, 4, 0, 5, 6, 1, 2, 6, 5, 2, 0,
-	4, 4, 3, 2, 1, 2, 6, 0, 5, 1, 0, 4, 3, 2, 5, 2, 6, 0, 3, 4,
-	5, 3, 5, 5, 5, 1, 6, 5, 0, 2, 0, 5, 1, 0, 1, 5, 1, 0, 1, 3,
-	6, 5, 3, 5, 6, 4, 0, 6, 5, 1, 3, 5, 1, 4, 6, 1, 6, 3, 5, 5,
-	0, 4, 0, 5, 4, 2, 5, 3, 1, 5, 0, 2, 1, 0, 2, 0, 2, 5, 1, 2,
-	1, 0, 4, 1, 2, 3, 1, 1, 0, 6, 1, 4, 0, 4, 0, 1, 0, 5, 2, 6,
-	2, 1, 4, 5, 4, 0, 2, 5, 2, 6, 5, 0, 4, 1, 3, 6, 2, 2, 3, 6,
-	3, 1, 2, 2, 6, 2, 5, 2, 6, 1, 3, 2, 0, 3, 2, 6, 4, 4, 6, 2,
-	4, 1, 4, 3, 2, 6, 1, 6, 3, 6, 1, 5, 0, 1, 3, 4, 0, 1, 4, 3,
-	5, 2, 6, 3, 1, 4, 2, 3, 5, 0, 2, 6, 0, 6, 3, 1, 4, 0, 4, 5,
-	6, 2, 1, 0, 2, 1, 3, 4, 1, 2, 0, 5, 6, 1, 3, 6, 1, 3, 0, 6,
-	0, 6, 2, 4, 6, 4, 6, 1, 6, 5, 2, 0, 4, 3, 6, 2, 4, 1, 2, 0,
-	1, 6, 3, 6, 0, 1, 4, 2, 6, 4, 0, 4, 2, 5, 4, 3, 5, 2, 0, 5,
-	2, 3, 0, 3, 2, 0, 3, 6, 1, 1, 6, 0, 6, 0, 3, 2, 4, 3, 5, 1,
-	3, 6, 0, 4, 6, 5, 6, 0, 2, 4, 5, 6, 4, 2, 6, 0, 5, 3, 6, 4,
-	4, 2, 0, 6, 2, 0, 6, 1, 2, 6, 3, 2, 0, 6, 3, 6, 3, 6, 3, 2,
-	5, 1, 5, 1, 5, 1, 5, 6, 2, 0, 3, 4, 0, 2, 5, 0, 2, 1, 2, 2,
-	6, 3, 5, 5, 2, 1, 3, 5, 0, 4, 5, 1, 4, 1, 2, 6, 3, 5, 1, 4,
-	0, 5, 6, 2, 6, 2, 5, 4, 0, 3, 2, 5, 2, 4, 1, 3, 1, 3, 4, 6,
-	1, 5, 1, 0, 0, 5, 3, 6, 3, 5, 4, 1, 4, 0, 4, 4, 0, 4, 6, 1,
-	2, 1, 5, 4, 1, 2, 5, 1, 3, 6, 0, 1, 6, 1, 3, 1, 3, 0, 3, 5,
-	3, 0, 4, 5, 3, 1, 0, 3, 6, 3, 0, 1, 2, 1, 6, 4, 5, 1, 5, 6,
-	4, 0, 0, 1, 4, 0, 2, 1, 1, 5, 6, 0, 1, 0, 2, 4, 3, 0, 4, 1,
-	5, 0, 3, 5, 1, 5, 2, 0, 3, 0, 6, 3, 0, 6, 6, 1, 0, 3, 0, 3,
-	6, 1, 4, 5, 4, 3, 5, 0, 1, 2, 1, 6, 1, 4, 1, 4, 1, 2, 4, 3,
-	0, 6, 6, 5, 0, 3, 6, 5, 4, 3, 2, 3, 2, 6, 5, 2, 4, 1, 3, 6,
-	1, 1, 5, 1, 4, 2, 6, 1, 3, 5, 2, 3, 0, 5, 1, 5, 3, 1, 6, 3,
-	2, 6, 3, 4, 2, 4, 1, 2, 0, 5, 3, 6, 3, 2, 0, 1, 4, 6, 1, 6,
-	3, 3, 6, 1, 4, 6, 3, 6, 3, 1, 3, 5, 0, 1, 3, 2, 6, 1, 6, 1,
-	4, 6, 2, 0, 6, 5, 0, 0, 3, 0, 3, 6, 5, 1, 5, 2, 3, 4, 6, 5,
-	5, 3, 5, 2, 4, 3, 0, 6, 0, 4, 5, 2, 6, 3, 5, 1, 0, 6, 4, 6,
-	6, 3, 4, 3, 6, 5, 0, 6, 3, 6, 1, 4, 3, 6, 4, 1, 1, 4, 3, 1,
-	0, 4, 3, 4, 3, 0, 1, 2, 4, 1, 1, 0, 1, 5, 1, 0, 5, 2, 4, 6,
-	1, 6, 2, 1, 4, 6, 2, 5, 3, 1, 0, 5, 0, 5, 2, 4, 6, 4, 3, 4,
-	2, 1, 5, 5, 0, 2, 4, 2, 6, 2, 4, 3, 4, 6, 4, 0, 5, 1, 2, 4,
-	3, 2, 5, 4, 6, 5, 0, 1, 2, 1, 4, 0, 5, 4, 3, 6, 2, 1, 3, 2,
-	4, 6, 0, 3, 4, 0, 6, 5, 2, 3, 2, 3, 2, 4, 3, 4, 6, 4, 5, 0,
-	5, 6, 3, 1, 0, 2, 5, 1, 4, 5, 6, 5, 6, 0, 2, 0, 1, 2, 4, 2,
-	6, 5, 0, 6, 6, 4, 3, 2, 3, 5, 0, 2, 1, 4, 0, 6, 3, 4, 2, 3,
-	0, 5, 6, 4, 2, 3, 4, 6, 0, 3, 2, 3, 0, 1, 0, 2, 5, 1, 0, 2,
-	1, 5, 3, 1, 0, 2, 0, 4, 2, 1, 3, 2, 6, 0, 6, 1, 4, 5, 6, 2,
-	2, 0, 5, 1, 4, 0, 3, 3, 0, 6, 3, 6, 5, 0, 6, 1, 3, 3, 4, 2,
-	3, 4, 2, 5, 3, 5, 1, 5, 2, 3, 0, 3, 0, 6, 2, 6, 4, 0, 5, 2,
-	4, 2, 6, 0, 5, 5, 3, 1, 5, 6, 1, 2, 3, 4, 4, 6, 0, 2, 0, 2,
-	5, 0, 3, 6, 6, 5, 4, 5, 6, 5, 3, 0, 4, 2, 6, 1, 6, 1, 5, 3,
-	6, 4, 2, 3, 3, 4, 5, 2, 0, 2, 6, 1, 0, 2, 0, 6, 3, 2, 6, 3,
-	0, 1, 2, 0, 6, 0, 1, 0, 5, 0, 2, 1, 5, 0, 3, 5, 3, 6, 1, 3,
-	1, 0, 5, 4, 0, 1, 6, 2, 6, 4, 0, 6, 1, 2, 0, 1, 2, 0, 5, 1,
-	2, 1, 5, 3, 1, 0, 2, 1, 6, 3, 4, 6, 2, 6, 5, 6, 4, 0, 3, 6,
-	3, 5, 6, 3, 0, 3, 1, 2, 5, 1, 3, 4, 2, 0, 5, 3, 0, 1, 0, 1,
-	4, 5, 3, 3, 4, 3, 1, 3, 5, 4, 4, 2, 0, 6, 1, 2, 1, 4, 5, 6,
-	5, 3, 0, 1, 3, 0, 4, 2, 0, 4, 3, 6, 2, 3, 3, 4, 3, 4, 0, 2,
-	6, 1, 5, 1, 6, 0, 3, 6, 2, 0, 3, 0, 5, 1, 3, 0, 4, 1, 4, 1,
-};
+// The canonical playout sequences: 1000 sequences of 20 pieces for each previous piece, in the packed format of piece_sequences.cpp
+// (3 bits per piece), base64 encoded. A string literal is much cheaper to compile than the equivalent int array.
+const char CANONICAL_SEQUENCES_BASE64[] =
+  "UFNRMegDAAAUAAAAYFMWScHWcJmpERdFKliWshByUKhVU7ewMWSm4DK4rDNMNIaCBlN4LORVmCYUjpcIwaxgYofJHaJRXAMaqVMhdMVMaSCmVjrLrBUiQ4zB"
+  "owkvpsvBnGWCqwpjpYd0E1zWi22UFAwXVl0sCB3QS5kaERxGsZYK1KolKk2Jq9DIrLUuXgiqhGURjJy4QUcIk1cK1ohFKVehRlgxFNNNcYzGLEZjoAKjUROx"
+  "UzSBsKqY8UgUJcLM8zJOk2ZCmUMxhNelWuIIjayOFcEqjOk6DjSN8MLMGBcvC+NZ8BCHLsdVsNR50owahmENRrXAGVivrAmlFL2ma0qBYFCP2NRUK7GmBmZa"
+  "ndiB1QqmM4U0FOOV0cQRDQPG0ySiQ7XKKcdaM0y6qxxREEHLgidonpUgnRyznldodeeptBpjRjeAWIo0ExE1oxzLSFUXplGmgo0JA0lUBrFimjhmiRkEbJTF"
+  "VCeWK10tNYsIZkpajjxMRspFo4UgCEIoTMyV4Zw0M9RYcCOAVhBzsMNMw6DAggc2xMAWWddQ21hVXakUVdU40+isbkRQTS3WGFS7iEYKohtzrGVmXIcicpGm"
+  "EFWYtTJLWE2Ug6q5rIMwYeh5AlfOqxkHVCl0lmFRFEXEiIhQGNvF6TLUKRQoWh135ijO4hxhE+OQcwyZMugM8MpszEaEXp3CRcygCOQQFeSUguqo4wI5CLxG"
+  "UaehyJS6qWE2GmGVGjcYFaiiYrdx7iovKuqGHAp3KTjN4NBg9bRyVtlQhkwIaFBMWwDTFCuqFoQGQRxxGio0ECqWoYx5Aad1gzHBI0dVzMSEmCHKqWLPjSc4"
+  "CgoNhWxqCMZksqtyUGNBHo0wchsVibdmRosxiusF3VxBqjk1CJh5AeWGjGFwhbIZjVDVEOZwUZY5dmI3qzxXHIK4Vi3G65C5QTpmGWO6KiEjqooSnTEOE8Kk"
+  "QTGKXsdgqJmYhAGYFcyGQ72UxuiOqmZFQdlBWBazUYUNLJnYWa3SiznCCrEKXKYRXjCaaKNOXajR3LI6VrOkTFdwUESzoYgVTgTCsFI6TAGpotmV4wIVcTOs"
+  "9GIUhCO4CqcVE4Uys8PKGesSZUWlw8CGVtaIBV0wLlxvcORFk8XS8hpHiJvSc9Wp7hoYdWPSHeqYwlh64SgEkTfRtcuZE2qxhAmqUDAwpdhoMDUaFVnKjmVB"
+  "0AQOwQgaXsa1LuMtAcskBTHKWSNYjYJCTdVREwzLZqrCXExOXDUUAo1yXRgMiUyYm2GsKGoJIUKuoIdaiFIxgxbMjWNQkQkPSoQUHhVlEbgShZdVHBgNXMqy"
+  "GCYxZtaZqhHR4uwkFrIuSAxoLIp00wLWQUqPMV2EKZvNnCyq0epYkFLTK6XAgjVV60BRTFCvEZZqpShM7GrVpWVztQhxw6hp0AJR6YoI1ZxtjjePmRrUCtIw"
+  "dFGUazQ4dCBqbMZ0VIVqYqOK8FRHRtAJzsKFjiA0FBaOhgo1UzGlYjyDkZe4aEiz7iSscRQ0iOrCE2gumNDNm0E3W+jKHJix1TyTiEwPXOdFRgaRVgRxUDCI"
+  "YdeYMB3UdCerGdyJMmYwoYVSkTU0S0XRFCqaXIihAjeZNVcwRibPS+KgDrIpItxhMYW4czhvozITYUDVdOOO8ihaaDumolakg4KUywRqrkh1YEarpoqydQyh"
+  "yzSHGWqZoYwZ81RTGCNYMYRRDZSFg6zVLDd5KmPWMlPH5TLFawpFsWHN1KTU4zphUd2JsxalEJ1iXkdUYWSqwYphmcNZs6ZGabQM6mAmXCOM5ozIdNEU45h6"
+  "bqigGMo4KEZqs5rV9TDXshi6DOpAZSyEokeoqLrMscaFK5XUa7QasOCuQqwwk0ZjsrBCjOLAVSkPXOOAirawplcPaeKphjBCniw2ksNJS4pNARMK8QpXIes0"
+  "CjVPVqkiopgZK+ZpE4aRQq1uTsFSLGtkJNYVZVJZY62yAmHWQWYGNTIJUMaA0mxx2hpiXK10MJVB6oyiLAVPFjupqtB1GQp1XK0qjesoNdbMC5dqXYUEBp3F"
+  "BKPYUAIvEFEFDRozUWBV81AzBiU3WjMLtBEFU22OE6pFUcOZqDkWW+khDQSHkSYo5mS5o7pimZIKGOYYHCN3jRco5YwahTklokVzWFJ5STjTnAWqhaiKFFIM"
+  "HgqjYVyFRGc5yxyjBpUuoChCRQtZEWawnNKgWbzRJRtVnqW4xUpnmptOC5qESmOFEkujquDVQ6kZjdhYIVwxLmqwVhp5yFKjCCpXGrIsUxEqKyYr6Gptmh1E"
+  "dMWY0LS4BGGBjVWshJWVoFWgaNiZ9bLAcUd4ZrCqol2XQQSmUQOvNJUSgRArWIPECiKoxazB0+AGozx2Yd0qikBhVDDUdRSEnWc5JhjDiuqqiMoqReA1mKmt"
+  "zEpXcREoimkNc9RYgkFmniwEAr1BlSCUHjciFIyFhZipQ100gjvLZawUxjDHhBZ5zABhYpfaYbKqKRQ0jYksBiUwlTmKsswxA1O1HF2bcci1aOpGhaBYlWvN"
+  "YUUF9Gy6KNJp8EqNKC3MU114YRRmigpYnlkq0rQ4cE0l6zQQGtWF4gY6NBHNCWO6GlMDcyGISteOdkSFmcfOVAQCbjxXMFbKWWA2VBBQnSMIHTlnTQUFAwt3"
+  "tKyxnsYIdDOZZQoOJaBUgsONxWyE4OJSDpVBsFirNJUUMx1oijWqlGE5ilSOmLBaMTY03YI1ZjwLLBlHYIqxYVdrVlOGjZExDjIFQ4aV8QhpXWQ1jQitUSOr"
+  "aYamdqV4FtRYE0J1m4yFq0tZc8SgiyKiYJUQXSgmXViwDGDCnNagWRaBaBw4lAsHFBFzRGiuhoi5Ag2tNVO2hjyHW1hNHRu4FC2YTeeFwlB3hcogVkaoZtGx"
+  "EBivQ4E55WDVXZPCYVfT6Ea6CauMogWaKpoNc2eqLueutMiKHRp4Gcs5FUTVjaumg+kszTjIHYiK8DSYEUfVhhOskBEKa8pGgjh6ROAiTjV3ETsQAiFjdETM"
+  "IWgx2lDRVGPR8QRrVhp09EBpgoeSSrBChCdEoetiKCG6hCGYHSKsAtG08zZWEYTRHU1NE0ojKzHE9WCpnj0tCOzOGW2zK+IQIEg6IrSZbhCYjlVz2bgxQg1k"
+  "I2aoKjSFZgXZajp7jAtWnTPSi1cznFax8sSCVlDaSwNxDQw1dAR5lb2iURWlXsBkyiTExFDQxYhlM2dqmWuDqMeoDhaFpULT7eBo4szGm2cYrDmKLtzKoKCq"
+  "EFKUIhrVGhqsMmhZYrmaqAjRMraKReUSBGOChIh4dDgX9NiIHWUuKwalphaDHUM1XgZBE9U5YCxIoapZrKpMRaohcuR5qDNWU8VNpryhiEQocqh0dYbO9VoF"
+  "pjisrOwhJmo6gVCaMNisiiBxshZrMOGgROYOQomIQrEQYTx14mrWYFDKNFGvrjUoqlPFiTOMoEBVJiwQAyMoHIkiXNkQCoO4oVaUs9CxWKeC0MIhAjJaq11M"
+  "C2POXc3G4pKkU8CZzVRCjQd1KOdgosZFLGOiqNlFQgcq1hCUmavOCImFcgqHoEKVsTp1SDksLo2CBMLJkeU1VtDUyxbQ6aimjjoLJWppgoMGXTQu0Riq0eii"
+  "8VKFTiGrYWg0jFRYmzs2VCAqNMlhmrmkshJolbGO1jqKCujS7Jo04DgvKGy1lqMSAxNxzeZmQQdRsqhxVB2BKT0roklDnbNVlGmNYQi6tFoGpYgqq6ctHk1t"
+  "jsVAcwqtMY0OLhWC4RhBmLUsHqbRqtME7DI4W0WHiGPVMkVTjNggpABC9bQoYDmBBmtVRYRUQ4PJkEBYRuGggxp3XEUIhNOByhAaUcEIabDB4tbA9QILRDxi"
+  "oaohg9YYleuCKMcGVrdYFuWKKw1rVSqXQMYJmaBODrqGmCJ67GRoYrlAE6dGqRDMHMtwMWsQqNdQHbGwABIzLGqhFBgZ8xhVyNzIlThvwRxX3caGSiioQiii"
+  "sJCJ87KwTgmiwjqjDByYcAzBotPUhEChgRaHXgYGjoo1pgyxnCiOAZTCISpSrMZEyKCKawijTmKFE8cQquYNCcpGROQooDZUnYsYFivQrOsINTFZEAVMCGKV"
+  "Qy1sVRpm0wpYXThNQoWAoYdVYLSGyGpQQ7c6bJSqbNfEEVuKFExnwUQxDkQxHIZlFAjDzFxVdSk2sSZoCU3TsKNoFBcSkzU1a7dULp1h4cKahOmwYpOFXcNO"
+  "q0BoxeywmuFQiJc6mNJloTBoKhZHtYvR1NyZskqzc1YTjLMM4uRanaItXFMF6xxzjFGVrmfDnNBV7jDXMiNOKAtj5RBoHkIQoRkXhhmq1ihz0Vy6oKsxSzm4"
+  "sbBCoUrQDs1RU5mgzSI0EEIazGSwLJdGKBGrKLuGVhpijReY42a5QrumqpByhJwOVj2obqauhrIMrJ148ShTS1ihqtM5lLsG1gRnHh1ExAyOIxYFXQ0P8RoT"
+  "6ujEUCdHxeY1AmFoa1wtHLoU4sBOdLOmqzyRDWLMAqsoG2eCYl2HTTCuEARhMl0GgpeVYeZAIFU2gkdt8iZXATVOoQIVBIJljCGC6pJalddGy9YJxLTUHlVX"
+  "FFmqHgKaxmBVcQLLSQ0FTLU4hiWYmFe4pOGBU8Ai7NQwjkGhTgmqbpilDaaM69SMRemyWhtQY7oQqMs2jgtjhZM4DAQaFlTLojMK6zhQnrWgC4RGcGBxjEkl"
+  "UzmxxFoMZhR6xtIBXgRXc0RUCgqWjZsZceRh6cIRGVpmISxGgDMBcwPGG4UJTS2sisu40QqxCyshtVKHyiDO4ejRAJfZjFYOSJFJYhfJhRlroAYuLJzSmiAC"
+  "6xKPSTZwoFhOhmuDXNeFnrURUd01RCmDMAzNRg25YgxRbgbLmVE2i8VuEeFwcE25WKkgxcZ1FsmMC4V6VsNBKUp0Wp1upRA6lbVUVOeyDOJOpRwRpbUwkF25"
+  "q0LU9ZyJ8gZl02itwozac+AVWTETYYyuRGrVLEZDAVSLoVkMAisozrR4TrTYSyM3XoKiYh1ZQVULIQp3XYfMVKmGYorK42TBo7exiDPEQ0czXaEN3iCOnQMN"
+  "nFuGgWsMDZGh1LAImGVOk+kJnRuOclIMNdWAoiAsLBtyDrw5FmEVi+mqLF1i7IqW0NRVXSw4hkh3FrPOAgeVVQAYi8U0o1VnkbMydcMg8qDK4bTMqcqkK1RQ"
+  "aDx2MUyAi8tYiCLYZbEyI0TTqmVwHtyuVDrCECsqykKDYRHaIxarTNUFcjk2hAmCxrhC8iqnsFaqdIRVTUdaWVo0K9LGsojSzjBY3BKtIYKB45qxTtDJoTuZ"
+  "4CrKjSIRjWbB8wYGK0xlHpO6IEhrddeEGcdGJaRlpYg4ZOtYYUU0ZVQ5MAUGprJFERN2VCjIFY2gMgZ1Whs0KrrQNQPC6YogNIoQKcqKZtMOxDAPtdxU7jio"
+  "YWmNcITAgcYIqcVyIYIJmWnMEyFQTtHJKWisgwUqiaNqXEWtARqzg1lCbbSaSVk0Y+bW1USlzqZaQNySqWjPghF6TN00jRUqMkEZroHFJjKN01xQqIeudEPH"
+  "pVGDZVAxBDsOVgBUbgsXgStQhId2NBUsDAcxcWYVZixocCVjNoJ1WTywK7XOcgZrM0grpZt1ZVpXVaON4hgEKusIMbhgLgvBsGIIplKtoZpZoAyELuEMihY4"
+  "lobOFjNZUNmMGQUWBDUW1ig3cliUa+BOjbGJnpwVEVhOEQgLNIjBmZs5oagyDYsJHCQgLD01Mq3No6CMntGMJkxhQSxmRhdPJc2shgzJ6GiKlB00kEMnsKZS"
+  "ERLXcBPKDRF1wUarYqFynYgGo7eIbNcIhsLVHEQMVAp7XlyzS0fI4mCOVlYiCqeGCgPBwtg4LkQzcbSCFqKgcCBRFmEYmR2Pq2KrCqxNU8XQkaQZlBU2nTOM"
+  "tYbBsOrGMKdZhGks0GCFG+wGlpaChmjIDmIGWjMU0dwQDbjQKQPNqGiZjGfBQlDVQ1J5Tep6CwMiZrkq6hRSnIOkqMFhjQpiCao2I5KwqCM0YwTCaRquExcL"
+  "sQgl88hMzFCwtOqCNdLQ8Jo1sGxhzuiRgdVFKBVF5roQ45TCU9EFxlAImqeOquXI4LKYjSIKMjqrdKZiGppOcdPQQl0tnALGbt0FFdg5QwR7Fh1W1BoKYSax"
+  "QxmxcyM2Q+GGRYMyE9aaiYVxVUKkoKZ61WLGBYuiAEvFGmKxKUsXXiESSFFUDVcWRhYNlIcYNBVxojw6rSzCtTZiykIZFDLXVGIakhFDoVS5gdJQZmUwzqI4"
+  "RCqzKYpxnuNGtKA0KRvGUI3V6ipGxAKGcgUGE+XUYYktCMigGuN0Aw2rhWNFSBuzLGOWUQ2xsKIpkKlBprBNWxysMUcEbjpEWko3wsKkGDxuKKgg6FytrLiy"
+  "DOtS8NBUleFUkFETHuQF7rQsI4R6ljXEVOg2WUBrUASvlil29JxGi2HW09pOpkaXjccgQhWnYznCdWdMMGEQZuGmjSi6YbbCYKzK9RCFpZtmVGpkZZCBWlVn"
+  "miCGc7a6aBpm5hDGZBuhSpGKg9hl4opZgwWqLpa6tOBNbgwHXg0zgqxaodZ0YrVmNadiMeWCymhak8EFTCVODsusXkoz7mBYhccQ8oCgkWsC0RqWlWF6aBTZ"
+  "EQahcRd0okBnJVxaojlqTpeuWjjJU7kQTsCOZFOPkBXWstpBdOPGs+oMzgyHQmQ0NgZR1DLMpUULUVbPMIUwaiaYojixIDQrs7VC4FivwsCmUBnJtkwPJdIF"
+  "FrbMNW1oNBoVrllGaAq56YQBRRRzgqtY4RiI4kSSiufINDpMlUykUgsLNDUztWKFFVvRYrqqFsEJzlzHyQwwdQ0rcDSwU2COgSpWJQar4ihOnEiVFcVZ07YR"
+  "dRONBM3Q2qTAoFSBxYLApTMrYOWOVdiJsgiNoEwIQhxCzZjGdJhyoQk5olJqDkHFCjfPGINowspxXFYW1QoPMVRGcS1nsYxiDkrOEZUSBANbHd2tjkWZGTKV"
+  "7BzMQyFaTbHA6Yx6mymqYEqUqc2udK1ZVFEZzYxSKiYaUWx4VAeD1pJq6GjRpZwZ9ZrJ0cLEShzLMqwVCM0m0LKEzRyBSRgKhON1MGcGDl2to+qkhpFMDpJR"
+  "8KRmpomggEqwNCd4WYsapguXMSYbQzzGHJWaU0xjUsYwVkXOqTqKwSyiBb0IEcKygWNxZuiIXNVZoCi4TjUVjhPWKCPSCTTMAgqP1TQZVbfKCp0GpqkUxBiX"
+  "VUUlkFcGXOHODDFFnkIp2CKiqguPWFSBsAAVkVdoiMaykaWxZldMyGQ6C1RG07bQjsV4nhh2MTZOVUBTtEaLGWKDnevCYTt0cCBaDrRCaZSq8mp4qionakwo"
+  "9FIzjLpw5jxWpUzIBOeGItiG1tiIqaJhpmixTrMslYcYcAMjgqMYYb2oMWRw6mJGxiKkLNRA4yBjmysE9LBMcUxoYbCUJiiqpcyUhDiWImGGQzFqcFSyyAKv"
+  "aJIICBs7S1DCzIRqsmIMVRe5LDbDyhS6EqpQFLh5YcAYrtEF1qBSjYMsRjGom+F6DQw1lNMoouY0KWwGMrpQG6pRnlCnSzNxK5tUgxgGBEElNBeT0eKmtVyr"
+  "EbWuzuw6UyFoqTt4YNUJ1eAOdRXCGVFnQRpa4mrBEbJx5TqYhONAmAmzNDSXoIeBYNpYI6yUNTgoHsdiURV4VYWwnhguXboGUUGb7gqsGamgQTpGqJBYkwfH"
+  "mrnKqkYINTwrVBlVRURvLMIiM+JhZmdQYRRw0DB2xGoqRBHPCrOxdBrUiketrGVEqDeWESeDUGMqjOJwjQuhG1OgDrgqXFahhtZgYVk1lgwNcxRlxTSTYTUu"
+  "IzTB3KRQ2DooawhZM93MjCNLg0WPbqZY0WRD9cQZc0NhFuaydpjBDGjRqOVZtVxqdJgJ4qDUBCuEwuplat3BiDAThtfFUEXEFOehW1azk1mN6ByIoFNCFhYs"
+  "CAMFmYHA2mpWJdTAgZBNURm4jiDTHQunA+F0WxAUU4hB3ERZdqTVaSZznWDFAd0xrmGWGmp6EdSZoBYjE2cuRBcMhYrKYLiOQjytgrrJ6TBmrFVikguFVDON"
+  "nZFQ4dgwkOGVQjQRrgQPLk1DGQQWhaeOySCVgdG6CxdlYqdyVsNB4RwsS2S5Yul5M0ybYDqs8FxBtajGKU3DA2XU0ZzRq6YFAKEpHQWrqRVlmhxVTuXBGhYH"
+  "bMB5sjqhqKlqAx3GdGekRugQ7Nq54ioscjmBRsGgQ03JZQVaKcUOGghqwQQjRaGGbiIL6GQ4hUAvA8EScFgkYsDMcBXX44Q1pYxF4KjAQmB0BlV6gsC46IIq"
+  "MExXEJoxqGcNKbc4iml5CmKP4rgOHZtJBdGoDFFE62gHDtyARIZOncetBmSGtVAHFopCBUfGqkMwMbDAGRZQqKCCgryMcNy1s+i19KbAYcqu8mCkwwLKpRMz"
+  "FQMqqWcwMFNQVRTCCO3WqwZx5ZbFkSfCHi2MQj2VytzMorZJmT0KguBUlIlGXCfIqNU0AhdriCx6TlSGrmhFQ4SiFYK5GRqEccrVDEbOGCKnGVStqyzTm9c1"
+  "mGbAVMZY82jGFTggVVWmEueFBOEKbmB6iNWxmNNoMGWBKRzDaGKBMGJMCpNBk0VZKLESc8XIIoyKhOeZViAG0VplVmE4aYpSHtdgQlbNSAAslVVP0xBEGZSJ"
+  "I6rIaKguHA1Rgbxqm5EaYDINgkRJDjxQ9JrGZYeyDLPFtGxYc7Rpy6YJqMGalgUPiRyvTjPTJaauMkTSGOfJiLERpDcncLJGVGB5RFPQY9fA8VgM7FixnkeN"
+  "ZjK4UwyHZizKqpmBGdfUmDWroqtNRUd38OTVqyOQwzJIkEVtUDMoiCiXLRuvo2JZ82Q3pWBFzTiZEL1gYWkxEJIKHE2EsFhWUuggClNQEzaQCAxR5jpsjAN5"
+  "4boyWdHCYhstFNFpLhsxBQchXQFWlbGgoylKIbwoQ1SugSmYc2bKIOjKy6bC4qhSJkLNlLnE6bgQTRwLVC2LFmpxMrMamstZ8GRQmRIORRIXlLGhnqvRAtd1"
+  "k9ehRrrInaeVplZotMKt4OB6oFOvCwTGiMug3qo1MI01nAyVVbAuGiKEoWqG4jpPZazAWkWPcWSF00qrqBWMHslRrBCO6LRGVaoiFJjKFGZocyoLRbbJqDNw"
+  "xEbHjJPFhUFErkvVGhc049A1prewcU3N6rgOjCdMlumsHlgJ4zjVKjMpZpGZZTwHHYCIs4LRZWbNqeK4hMZpcCKTJWK4tSgKm9nWyiJa4My4KjV3HlFF9VIF"
+  "xDgqguoFGZwJpatxiMo6DmRatBqXoBlRHo1xymBhZYTCizKHLjcQpjZ0lDPIsFwvoVKmIScUW4iMFgRXUeDFRY1mntaxGMKJoZs5qjE0ValScAOnKIWGc1V6"
+  "7ILRgsqaESi4SQ2ZhQk1K5EQtegAVByo42bXWKooZRl1SZdgRcOsYlFR6rKE04SxJDgPZVRhGLs2LJ2CFSej1Fx5XbNOjMZ2zlJ3iswlEATRiztT4bAaoaNh"
+  "Yw2jWS0wjjK5pIc6SzUHa0BWpkGQECJrnhuYpZqahWrOc2d1rNJVWFjKiJtq5FTGo5qKBseuYWMYygo1ojGmwTiqQpoxjMWBFATNcFjWWdMwSkysC8Gpjqml"
+  "QIQymQVOrAt5FCgImRgipRxNE6s4taiC0SCHM8Wialw4w0AtVbpAK5cuDRYa48zSJWs0zGQsFEuQqJWxItdZ7pppVuo1YGExsuBl6dxldDCmmhHOmKmyTK2g"
+  "DtQgw9IwHuogFqekHjpksmLFcwyTC2VYMGc2qRi5baJZFSWvWbVyiDQhS5U6VkYLs8BQi2t5EN3MVSaAWJlaoeoMgSbOnBGCqDPP4hpNiRnMHQfDY+cmsrzA"
+  "7DDQDrTAqFwqsFiX3BrNVVAxwtLQoMc4rrMZziKwFgsVxoSpU4hNDQy40WSKSj0YXaRJyzLA9Bg582qCDUexxkaMs6zGS+nJ9TIWo6GJi+Y54IqIjaCFsDaE"
+  "acq4aRizglkEgS03YhtPDkVkFDKBimcMgtXBHJSpaeqIKFwimLWI0LCCXtYUwRKVlosYU6jRgdCooag6gpvGUCYiYGG74zRLYwYlKmE2EkJljsalFubRXR3Q"
+  "gkYtBO1sddEkNOK5yGANwhSXsxDIoFdBJWSSCjsPdYJIm7g6JoMVg8XUzMBN9DhqGNiFkhGFhli4BuEoHEUtawgLDEIJTGlAYReDGBsIcaiqlOlqZYM004RR"
+  "4LLGa0nXYmqzUVzaDeSsSenSamqEpsNAilKgAGtYmGxEDBxjHEhPkDXQghzVNaw4VDGZUAmWmdghTIbMGOIObNaFWgqM4lx0boYFq0OnQgHRyrh2VGHREQUN"
+  "I8o6ZikqM5VGFTJCq8ewHFUwIkQ6AolaYbURDZ2gizo5RmAxXVgtNJyloNylFULQax1mqUhZTl2mgjqYIcZQaLYmngcaseB5DBRnqZXBQt10XQiqMceqjggT"
+  "KiuWTYmgMSWs61SsiQxiZrBMjabRUMuQRDLMC5o6s1JlYE0XCkVLoCBWhdGUBadZy2avjssUdeYVMAtFgSyXzhiIyoAYmMOxUh01caqy4jgjgpc5SirOHFMT"
+  "WjNtSNMILDROThcVnhGYdK0mlYF0WGTBKqdF4UpEGEHDyiKuNCxzFGfMa1xFg8Vg4EZ4BFZxWWmkFepaKOM1BOMpTVe63giPGDhNETJx3ppVkVOogZuZQtY5"
+  "AKHRozoVRIaUkKkgFGCY9jhUDlVOS7wyolKXFi0XgSsWiwdrYGtOiMWsAT2zYKOOQqd49TQXllU5K5jJWh2TRUYIw1YhMugIRejJ6Ops2WSxRIc1RWbUKCjQ"
+  "AhsaXROlKbHM8UggYp2FnNMIcD2uWWwQmjGmnMAYmTdPYVt1gmCaUTxwnmExQjA5W4KoCGN4iFLUgTFiAeulYCCyg6ZpnAU56+AOpRsPhEOkdKqUWKk65ZrI"
+  "VMjBQWcMJuKGqOSlKD2zq0JQwZBZVpexUBxkgqyi89ZocLNCsCx0ZsW4BIuuGIIwqFGzAw1PjgbLnigjIYsgXQEiWKh1jpqKcdrBMQIitChUZtapXseMW01l"
+  "TamKccIoghURbuS6DRaONEdNsODFmoe5jihvKGbBNFNrhZEOrGeldS2aCiKko1UiNbXUgQrLjDhBVFfHFeSh9FI6pRl1Fj3RrgjNQzWHFQdrQwOVJUzJaZFS"
+  "QUBFQyFQAbhaLpgZ08CJXWBomUh16RCHYZWFtTUWily4Ruw2yIbK6cAi6MoM7BAQERWtLCLOhTmZgtKI60zXwbomszhP9ZRyXEEYGhJYRVnD5MqpEMOyJjJk"
+  "pSOum4OhMiRTYVjLAROKjaOO5SpjKUcPVJTMg7PCFNhBVEOJ6iywcgPCDWHBKlPDouhRINjEsVyCGCtXLjWXgRAWASPTzTorakBu8ZTGJTKCW2gsQlAaTJfC"
+  "dQU2tVazoGWZS72ZTpgYFDqnKQxTptItykzAyRSlHDELjKZgQsO5KGsKE8V6G8RlakZvhSlnCDMFHapGYwEhjWm4abhU6Ixo6Fa6rDhTgxt1mCAOihjTYhWF"
+  "tZIKXTEMoWKvCJwgHDUH9FY3Rt1oGqqmyJSprkdl7LLCMAODnWhl2swZWZwxBCOUAyEKZqCGsAIGU1YNWVowSMMw3jxBMRqaRVjDzVxi7Wo5MeyZHmXCMOpF"
+  "ZUMjzZxGK6hlTWJootiGgrCYcLgiGAZBVA3TNORqquXVC1ETNOdxbIwFVjAsi+xkHIyxVCvEQlPGcYiAEbcymiCsc2SkVoSqK5sqlIoZMsuB8sDJpYkhFVvN"
+  "1UynyOTBME0QNT3CSKeKpVvSiRWFqot1ShgwijsaK8diEbFGQVm5RD0inOc41UrOwlKqnCGCiMFW1lwpwiASmQxScGI0WGYiWSw0NTTTNCU3rhi6RrPKI8zY"
+  "7CCMpkkjq2ihKje4BZ0SxojCtWwEASMGhCrIUCd3jOXFJJQhglhRHTSUGoUsM0GPEzQuQ0VsWVVWlKxBtTUzIFKapYxUG1xCHpzJ6sCa8AATteLaM1YFsbiq"
+  "NDgaCScYGTq4dUSVk9PJQmtmgUjEQiwvlqMsnePB1SCagmGJTRci5WCFWGlQTAN21hIGZROjq4Ym4uS6Ko1OYDOnLE0PGSrMjBFzcFCKsNZQk1PRpRAIZldD"
+  "iAVV6AKLWghDLKixcYdigSoiTi1QIELXQZWlkxOGCb24KENTjSPWg6najTmLU4wWdWGtXDMKZrC4MFszMBQUbpbGMChPsKpOqiwLDhUTTDksIkFvmCkuRJSZ"
+  "SrXQ2lxOQZByFpyM1uQh08yiiAgtmhFPkTt4YQmDqquRiyXIg2epgeFkq1BCMAdBzUI1sxhO9QTDjYYqMWpKruB6EEaiNDWzYFjYCFDGZBxQ1gLAMbpGSqyh"
+  "5pAOHry61AjPotZxhNnBAoVZHVUqtKoKNNnSXjFT8UAxDYOAIVGv60DECVUTkVVrGKUsoxx4ZgRti5pUGE0hlsTFZj2CnecO3eiqqWgRHmvUo1XVY0cvIBjP"
+  "8TIjMRoEUWd5jAnLwtws5qzUoTbLM6aw3JhZhGA1LhEX8dBUFhfK9QqFLkyYMOG6TIdwoCrHKlUQabyAmiBGAaGl5lxnnRYJc82KYiFHLkSb8hLXoLoYNUbL"
+  "xEJ1Wm05o1EwIixQQKlVs+yODhRZQ0w4FOessmBkLEcocDcFRV05ixUljNCMgzxD1tQqK6aKmBvIbiBojkNDVQi5qobCrIxY6Vg6lhWPw6q4ljA1E90sK7Jw"
+  "KRTCjUPNCUqPWxXOJao6YCMzRmTFSxeDELyoCEakXBYFapwOyJZFm4s1ogZzclwBHbeYGxsGQ7nBBLMJrCimlFV4mRCsQQmnRiyw5lBpooYM5liVCIIFUeO4"
+  "Kpg506xBlBkQ7NAIc4MK4wjCqcysa62kckpixcZmxhbX8+BMC6dBtJguUIl4zTpMoRB0ygqKcsGl4jiAAgZrITxnHEYKszxabCzUnMIt81CZaIZZo5FyVkpo"
+  "AphFhgfG87Q4WGrV8cBpVN2IaiyoMxCuXLgs66yqYRCui8tasFBaEOsUReB0TgRvEON4MthZlakuwDiDYhquFhQTrkpN9IzI4rKqHjOFKL2qIIJSScV03DQP"
+  "HGghVlSZxlCLWbiYjoppYMGoZgYL3NhxBatQgWEhlDUaciowCptlQ6lkEyEX8aiMiENjrLzGYOFAnau4mGtN5eSsMFxWzkSxaEpEgRUwNhZ3EcCNzUpoGtxM"
+  "XGqaWTQF7ISwESHPXMJqkMtuMFUMCriJrSsrdjxlhKsqXYh11lAxDOQFGUzLA41mTCRGZjXOZaVhE4lAipAVTsc6VcGFWpoxzQJZ7KAwGuymRFAPiqhkqFAa"
+  "HJqZVhcqRSi6MbbMimHVQkHB4jKZjaZYmQM3jDrAlSqkaVJDLFvXUWgEhrmMc5dGSQUiEsox7EysoYWwhohAhiJ0nqwYBdVZo2A01lYNRMeaoluwls06XdtZ"
+  "sTlVtWAsqqAiGZd4YKoOy+LQCpoFhJy6QSYQchl2oDCkrTKYAqFATDhyFIqiyRihRtYYhmkZKw2W5gRHGZShGILUnaIOsVx4Ea1MM8wsU6DKSjCk6uIiYzOx"
+  "HKiFicQqY5pRgVzPVRpYEMTB4mJ4qKxQ7oaNYCCmU1EwiROC8DwwIkrBKgKPThXFdbAmVJo5VAwRbMyWFB2n61g3HtN0FKqgZjkjVkPXNIxoTFGK2Dg6QWWx"
+  "HiO4RCl3FIRmbKKVcxRj5hBGKME6lWlmyBwxjRorI+JY2GxBFZZt0ZiGMJvSgjtabhw2s1awwlwvMmFMDVETDbtBNAyjqaBiVMJpsYkYm9KBqkxnQKQqDhXY"
+  "WgXGEwcxVhA3pQ3CSV3QotY0niJz3jha4ViUE6AhTVPRHMtNQ+CUkBV5xYQqAsdZhWEjqMGqoTM0CEWzksvSixOooAK5TKEo2ko2luFQBTx4nlNYjSivrMB6"
+  "1liMhlUF1ChjjVGqpjF3tZrSKYUkmbgscme2aZfSUIygDCMrSlFiHiqjU4lxFpNy5UzAsMZBYN0oTSdaWbMUFGpocRk2xgq2sMK6KFhDhBCGyNyxrlVMCoRN"
+  "tKhoiDyNKCYKzWokVAcPJlJ5RtVgQZZYtjh0ZkGBjUVQFYqMrjOkXuXRYTQIq2qKDaK6FNxKTSQuoxkLNUwF8kqtkMuV6qqAHcYqmOBlrOHEhcqBpgNmCFQ5"
+  "Moc04pSF7kIUsQiLShQwM2QY2rhaXrham2i69EoscJNahNulIYepoEUZplyqRtcFMYpao0qiNLB6KUornlMvhinKy6hGiDtMAxQ2GBVwjMMZWrWlrh2BNQXP"
+  "TmFxMmVBMhShnblEyDwrkjE3HpVVhNlQlBFWsmokFSewobBMKmgWLgXCrDIxHmI0rdiI8CAuHCd5nkPNgVGHo4co6iLSVMFaKRKnFMuKiilkJcpGTBaPc1lG"
+  "MDLZs8NGViQsBlEqtSLMHdEIdmxGnQ24U2CBGCs4KCDHFRRTTCZHpAqCKjYXtVBRiTNTEbGUtUbLDLSJDo1aRlVQ1Tyi4ThMFiJXQTibjghX8QyZtUbQ6UIj"
+  "Y6ggNqfQEVwq8yRaY6MxNjo3q0UMpeLC4TIGVSoPopaBQ2YoxmbBURxwKNV5Bg0jgxGFYAxVdWS5orOsYchaCTdNpmqG0zQRVAbQoboVQVihDBSIYJxYriln"
+  "mZ2Wa4DCdWouM1OFYeFKWMdhoibMXBfLiyMRcxxqGbooMMsVI+tUXpqyFZKFg8HUI+LKXMd4lBesWAOXCEZZ0ZyqGCizMVOLSmPBGVWa4zwLhgjHQ6SsRBzX"
+  "FIMIxFBMxow1CeaiXhrY0MCatQYKNa0VHRaUmcyqXmlPFizUGhLDgiawE0d4Za10okpliYk6xNLRjUfLqLZUFuGVMguBnsupkKGF4AouExnF6JigIAzE2qKI"
+  "EgUPMbepWtRV9cKNVMxQmUFEVFc6wuoaRYdaRgm6zhi4cYJomGEmjUKHUT0kVIRYFSpBRmXMlV0TIzGVmCoT1sq4DtORox0KBamRo5EIY2lMxmgXKotxMOVa"
+  "CARuDZwUmyGMlQNCmjU57syMQjbMIMZV8FbUtChodbzOdNNw2kKIjWeobgpYDi0qMAqOmlzLbgSNUUNQMIx54aIsgoiiWRCjs2JNoTsha8DA20ZULhSkpWnG"
+  "6ogKy2I5rFcjFEJh6FgLKkqwQxQPChhlxAQ3Ko0gcxzCqjhkwpLIWlMU7LSZiFWCs9hBjTONbkbTLstRtIrUUYfBGxRzsDx3caymcg00dSB6icbA9WCFqzC0"
+  "wRQ5QUcNRAmu7jyLzegO6Ep1zmxZNUqEcuSFiIyobATTFBF3UDll4rAEmmd6siqCMraOnVWDEwtOXDBrVZCihFmLNegurAhNFlalhidqqYitmsGgGdF14WqV"
+  "VDA4Xq2kMCI45eoOS+Vq1JKFKkyUHsMgHiQ2JWJ5aJCmS20oHMUuBaFgmAdBtGxNrBpxhVU1k5lqoscmmJt5sTaUEbswoRo3bCgjKlV6WlYkwwJshcq5XruI"
+  "RkTNqgBWBjtCXEOM0SyXqMYqa6ghqjOaTZyac1wlVMUwLEioWjyXHkePherNCoU6AWNiBuRNFlaiaDBqGsIZHplqpScGqUBPslBWXFWjmLKyhIou1aKJBMNB"
+  "lSdBqFUUzgqZ0VJN5lzRmmFuooONDZaFhQgFkeMRHaPOLCFwjQims+YZCxTKC0YTaUIU9bDBZTpzVa3KZtwOq+DGFDeKkcpa0FYLbOiAGxOnIFQF8xKWcoYV"
+  "Vo1Fc7IoKQJQlVVr1BTBqTmYUFgJXQGlchQXHsUI6wo6BYGugmA4plG4MWvZWEoLRSCYQSEMXVAwY0ehNL3OoEZTZqzRg4WGFUZTFgqLGuKG5uJCZZSOaJgG"
+  "rt0ocBCHij0jsaKaCmI5Vs3Uxjo1GEHQGrJkXBaNQ9AhtdKxaWZKiJoVngFrShFu7IRwlGvBMWJVgZl4GFSqzCKmLDQaLpppo2WFXbQ6VEeEppoKwRCFjVWN"
+  "pVWXceEYlDzEVS2OGDoG6uBlExJ3GBJiHBeaQkN0NeFGE7rI1Kw0M0MNnNWsjpwxK1wURcM4bApOntZQ6VQ0rAUi4EyPqGGuwVAxFZQa6yQH41LCogItY7Uo"
+  "K+ZY4cSsS0134ioXFVa79YCqQ+ApEQwKamaq8LwADLGiVhXLYTnOFC2YSj0QVssIprKMpDwNY8qwbOCyAhdY5Vp5ogcqi1MF1jAMQQWKdYe5sVgZwhIWMewF"
+  "Y1BNlKG48rAYZhgHIwYhdEShEEq5sRyloldZTaU5olKn8Gh1ThkLaVVZIAsrM1XISJdpDg0XocOmimKCcpuFyzQmqJfSkzMqdDaBoiKQktcgoyWozOoErmpo"
+  "EqjUmAMTmaWgUD1nUVamyhB2dCoslMGZouFUiydjGhSZE8hZbrZQbDo09SKimOnNk+oNjoh6TDNoYIV0qDpWaxUQXQoyTmmZypSqCr1sDrUiYzQrmTVENA0v"
+  "5RRL6dB18QowZgBYXkx54RzBWgAPdW3GjStnEUsOCk2HGCjCkFUrWWQGo+HJ1DjXJshaq2vBG1UMjVJhGZEhM2GwHAgUMSfOcGFQRjFbDp06rjHQUA1XogAD"
+  "qmU2DrJ0FrZx0JwiRFJB6AZGLl1VHTRaHBUEDquqTMUJmoZqzuAU1ZTFoVyhoUIjq63A44KCZsUxA2gOLkyFpUgQFlREnjArnQMqnEHEEmdmchllYAM6IIwa"
+  "WYQ1mJoJNWzBkRHUasqMYTct8zKVYj14NDiOrDKYhjXDiNyN2aChMlw3ptbMzWp2c4ohqBrPpTyAMSYrHcJiCKLVQgl66ioWg4hpUjxOzEqjgKtAFsyxnRfO"
+  "ggwzVOtSWC2B4ky4iMEAlReFKhRk7kTMcAin2uDSRRWIC7UgkDlD0RTWdDV2GLtZBtewlketSwO6hrgVxqqIngnTc2bWk6YOqYB1mcBG0KBRXKy4hAnDC9RQ"
+  "SKYyFEOwGAVbpmHGzWhBwTRRrGAaWhyIiRGBcOoK5mqIC50CDIKImIrM4tBBqqkQ6jgIaeOV7Rx1zDwo84LAWldQ8Oh6BCJGhgYPBDrOtIwgjTVDK0OBESG4"
+  "gkzLsaJU82InZCOo4zRBWbAsjMoM6URlYzcqVZqoBIMuXuchs2EVqeVxQN0wpkVXdBdWs0JxYqlVamU1YqfVoDHGcyaKyyiLjBWg6kYZJVjTQwoT9FpxpswW"
+  "Bot4DQZwmSIsco2a2VCbKNKhKCJkKMN6c+EM4zwPZiPGI0dTYK2MHZFyTVVMdGaoIGah8IisU5HBCBxkqlDWDJJaQVwVQlM34pBiDlUzmzGVMRFnNjNhVBgh"
+  "M8oxrlKIDsZwHSsjFkrLqLm4TorVUKeZKyJFKS0atZzKZSMWjRtUXM1hq0rRnMOgDcOs3kA0oxVY1aCJBlMNLGhUqFArGA0zKJ0F7iSsCRYikLsMtghi8hYT"
+  "HCyPqToTUhaCSr1KHMUGFOLEFd3SiC0MhgetXlWxcjQrtAIHgxahAZCmaUbPgctSEywLMFMjpYyCG6uoqNPMWMK4CyUPXhGPXRo0mN3FleWgYWCagqM0iDwx"
+  "o4IwgxUis8MoVkFh4oRRTWKlXLGOQWCMURzHnGdmKkFvAVFUKuYiJseZdjUuVSCwhoDQzOytsxAsWRmCU0KnGiFHRDMGUzpoE2dCGc0pakbQCywaGweBldGJ"
+  "gipCNe1NnipiLqJ4KK0upVbV8JKIyZxREocRMhbPiZxZRLBIFOh0g7dSTAzTRYYKhVOW8BTOo+taZoMi4lQGXAtVQx1xQVRr4TiK4AqBjaG5SukoaogZEzsT"
+  "HAeOSsuhI5iVghEijUpmWcOlSOtMA425CKamyAKyaSiFgxBbtITUmZCpQgyzIzzBa7hlcSoTQ6AMBDMvViNQQFrFYVVwoEvVFmanjqoajgan9IpWdS1jMQ0F"
+  "Q5VqCqeGYIXRziCjg8c0HczRGkTPDcalxDDDhajUcL2uVuhlYkyMMLpEMGqYooV5Ahd4jCt4EwuNqhg2xQaHQrbGQuNiXeFpXEp0qZCwo1YGRJiCZspRjjmr"
+  "nGGmC4KNRWDXYx2PoSITa2pYDCaCZYNacJppYzpzjENnqsN5iEsRTodBzSRxYbqqbGQFUtgsqgenCORhjFIjmJKJqGC4WdiFglUV9IQCCTykkEelg0dHFBgF"
+  "7jwLUdQxM4gsKpsShoyiK0uZdoulGZNqzZA1qWAQc9DFmiqJ8sJ0YkyL48BUZQS6Q8nQsEyZUweVrSe4hNQxwGotdIJ6sBo5qNWIQsxZmZ2YY0yYo8KpWpU1"
+  "GQmuErWGWpmljIUwLEY1FFMGFdJ1rhnEQh2HVuQgYzVXIA0vYrMiFENF4QyHKyEXGiZoKFEMshpMk606KbgSis0ORK1uVGYhXSmK86xi4uiyjrEhHpdQMK1h"
+  "EdHJBBXOCUdnmRx1qsMRchClRjA3TOAKdegURGcVFY1CEFSCgNMJLgoyhoZS8DymcQwtVpmBYsoG4YhxaDNTFSa4NMERaeBGgzC5YDHP4UrGk2tZUDlKZQbO"
+  "1cZkWmwiBuGmMjLRqEyz4LB0mhHVAx3D8QSNmleicqM6ZjTTZoembDqxxARP3jCMalDBZFSHXWCsrkZrgcqCEoNRLLESogIFadCGssy55SgoywiHJkXE0xBm"
+  "8LyCosyaJgaCJsoKNaaanGCh4moRFWOU6DARiKCyGoKGYJV5mhIOM1SnitmwSeF6xDQx41jPTDl0rDDSa9qgCNgYBTHOWFExdqM1KBaLmgerMWsWcRouUTWi"
+  "4aplKSuXXeEoMGfYoyAWKsGZaMoJy5qmxJzFDRyGnVaVoeYFnBu55mgKcEDV0yau6RqYGTgMixFNglLPa0pFbLpVtIKOGSqoTMeI6xa6alCpcqhQzRrPLrQq"
+  "wlh4Fox6lFeHcISowRAVcga07CAPAhNrCa2AK2V0cpgOxUrOiGspy6o0hVc2sEqOQ+gZWgOPYjRMiBx5YF1DFReMBoVypjjTissuSAPUhboO5WAhEkPXDFUX"
+  "CiI5HttYJSJ2NaGaXmM5K013swwvViesMjLOoTWWkOJOXCiumDoqFjh4Kxx5QmFacUAnNbealotonUU1lSuGmGow8KoyctNg4ASWU5CmjhLDYarC9GBmcghQ"
+  "daCgIbIsXbFGU4ZNHIuxwtyV7lS4EZgq0Ah6hiBWjakOc42SFKhSRiwnIbSSZgO6GipvlOlgcVAPSzManGFxSkmLcQW5UEYM1TpaTudCYGSMrbLQQTi3aFS5"
+  "xNAUNRtZqwNr1qKJSk1hZd2snjXE6YTIU6txBFM4TeWmtFyx6UTP8LgoHiOLoOMx7IpgRUWBI+aJmSciVpEUhKqkWBkiZEBhA60VrQzOzEREYbK6ckytpRHN"
+  "VTwExWw0LNUoKzON8MxxFDrEbBbLNQJHbuhtGhtl0USJmDAxZsVUhEEHhOk5QoOmy1IFi7ugU9w4FhzGS5fVCwHDouiYEBwOGdSUy+jAoaesDotOtTYtW0TV"
+  "k9s4FUUPhCli2FxTVTkvXDVDoGfQEVJa8LqimAguo6EqspYqmphVnUXaCoZZI0gT9TQideYpWF3VTAmImBsYblTXbEYnEhqYLgo2jVGuMgxsxLRAbBZxWS00"
+  "RVFBWSwYczWxsTCuizUVRZl6FsdppRaOazSx9SCwkYJFWehlSaYgqNhVkNd1qhAryxyVi9PUZZBGSqPUaLAmZTJDXMdCBTMotJxaYSGjqltYtmDUhAJ6Ho2h"
+  "RKpYKwZX7BROMxI0ESeIs2SkiCtMG4VgE7F4gzOa0cbOI0pB4IqmqUWstVAPVijIoGOBdSKzbJTBYKlYrBKWohFKoIegoSwMiicLK1YIajZnE2EMmiI0XKgi"
+  "s4Y6DVZVpYpxnlZ25lAHXTOFIIZ5iQdNTYpGWcB4NuTVbSBnoTiXFbjOW7woy1AqachldJSgDKzIDSXXcljXFGKRoMNxdJe4KBgSrGYGAxUmitHUsJxo4jhR"
+  "jMJxKDLVIRojNOF0tKYQJpbMoFDGNBMGqldi7jgQJjwSioDJkuPIdaktCWkslFmNniaGRmPEMgcvkx3XZDMULcIKDTjR8lom9bwYQmpSoOWyHFPWghkwmFCq"
+  "3oooUJJShYcFltWlGiFrZcbQsjANY9NGMAw3tAqZ1lxzcNhV5VJadmgVhsZZK2eISgWPMApDVA3TKSh2WpBynqCpdETXM7OuC1hCE1isCEx5EU3Bo9119QKq"
+  "WTjVsms0QjxQ6Dh1MFVEwAaHbhoOrtOxmBZZ4horYodYXLpIgaCpogMpjOmgadahAlt5Vr0gnZPGJjILihdURQA38pxlsFJpETpYTDVYqyGWQ7NVUKU4CxTO"
+  "c+GBAs0SbExQGcOpTUAFRRWBAGdqKZtVrByKYLTAY6xNmZyxQeIOjYiECkoEYkYx0DRRgYspENa5DEI3jBUK1FLVHajAjViqxiKOFjuD8IYxdKlxFuqxKQOH"
+  "gbmgyaQwUFS4cuLGEwevGscSC00ZFqPFmQPChRd2Yamps2mh4mLCEYpisGe4ienSUJymqFjD87gZMkO5i7hmcjHBLojIqDLG7FQjRWXEsdJw4LKOhpVCJqhl"
+  "XTQs5AxDHNqIK9WlSWQsopVwoKDOQ2QNQ7Yaq4hQFpTOIMIOXYNaWYPG1ZCtaRaEWubCGmZ71eIIWMU04+QsTJ05zQIiWkBh4uAGWiB4QTxFNdhAXjB4FDy6"
+  "GGHNMdSBpQqBiTg1VlRZrAbHhYVmNVI1rhZPmVIkSFRyqCzABjgk67SJU93IWrvAiMUZTsAqHUKLbSZWI4imWexoEeN4XEUFyMAJdEZEGBdLVhFHaJrAWj0K"
+  "o0CCDbMoXrAOKNKRrChojSqtQdoMLtZ65ghVlsclilgWZQCvjFu4cGS5QZVipeWaBqsuKGJEWFBEq6xgQVpBKMTGobyqSxVoXRx0TENHoWUq4hx4HZsKSOPV"
+  "yVBlhBBGUOqusKIyosBRGQXOtbkMDdzU7LCsRBeZWB0hbFZPdCuEc1WxjrCuyzCEZQarqYoUqmooISOsqQlWiCUMqqfCaVYU01SooSFOVkKowmxlSkWEjaCx"
+  "iZcUbmxQ1goxElJWcNGkMid1y5BuGts1iCwuChxAQRFaSDfB9ajVNCGmjJmB8OBiUVPBoQYJGtYIBlm6WZq6jIApVF0IjjE00RxQdbpCDic4iqqsK5Uli+BR"
+  "EZUpjsQaGiFCBGVRBTuUkClnpuHCoeYijguqYErJikNUEJSC4qi4LuYIirjAZakgBr1oQigEpUosrCPLICik1NTUoWg68YyGLkrHK1zDSYGmqmjCcTXKoUfM"
+  "i9BRGSkWITIM9OxMCw2PQ4x4icDVMjVi6VyChViB5UDIWGDE9AJiXjTOqCCH9agWrJy5GyJG1DzPghcvlWshIzbKSBUnVbSCVDHBcFlGsFyXVofAiThRZlGX"
+  "atek6ACDo1KKQVFrMYIlglmqw6iAlKmAJjLUwxBEkKmqYMi4otxEUO1CLcPUmgVihmprCBtHcSEPqBXLg0wU1RQKXiNjLTx1Cr0GM9wQqzqroTJRAbgiVMUh"
+  "hDgLRlw5Jkp0UVLSBqdS6+o5DYU6g2NxSA1ZWQkKIhywhqFlg2UVcBEvM9YwWYtiEUiNRrAGS5mK3ZpZcMekWOfKmzoKS5cOkDUPcTCNYhfRG7Q4jGBwQlU4"
+  "q0rCI7c0Zqa5rAOxBIuqHlasKdSx0YTRqlm6LmyxIzQ4gwCOQuZYDj02oaYqBK0OJipGrAOjiMXQi2msqRy1WUEUw4RRKxEqDV2zE+EZIWyBnZMGI9ZUiOqN"
+  "maIuxhKFExpz8QhvolPE5aI1jrFoqInINKeM1AhPzdYIAddgQYiMHUfMVjiFA9GZGodyLVUB6zAzMQNGLtjB8CIT8mJ4Lr1oQyfBWmOo4UoVRF1FS0AQHdbY"
+  "c1A6LG1NK6OFmZhxmOcQoxDDmhJVjcAs2AoFKuEhlSGLwzSRCMGIo02AjAiP3IxCBV16g2uFGpeFLuGucZBZ9ASZqckujZYYETM0Y4ppcqIVNuWVFsa0K1Av"
+  "YuMZNMNUmTyFQuXKRThOyQxjEWzNwSzGKzdz4LASWVk66ZCIFlVLRDRWCoVQMrKaDLTOKuc0jAvHRKnAQuViMV0oa6OMJThvnsyMslIK1ARH2OQglmW6yYxq"
+  "0RhQYSWX1jAPoGZGQyMLcQ0tXkatmWrW3uxoDWpNFceFM+oMZbioiFXFcNClqzOGXh1uASNBgscOSlaLcFCCTjwX8xAsDg0jRBFSKacQTdHGUSlbmoNSZt0w"
+  "HaMFcoyKMcopYaNoAVELBeRCDCbHXMZAMFOnq2uNSBvECcklUwpzQbhOHWQ0xRjSimGhYY2YVtgVCCvPi6EwbBgIqqKGCFVBqrYi1uBpFThVcz0FYgmuFOiU"
+  "MeCYDVLQEcouoUk4BjtUjlKU8gi5UUMVUxAJCSEKCzJRRiWXA9M18CjaMwevGcRQ68gqa13NDdiMRRHVgtGpVuNqBMoYXYkVWMxkqMKC5pQ5aww5oChgojVR"
+  "nN1ZkzmnAVVREWZobGTGTamwyFpxQWh0XKAtJtIxKGV41ASqbgkXwRKGiWfRjOtFqyDOY+ERS+iIgxqMGUWnFExQzsaskRuPncOGVmYKQ+EpgxE4QjXVcJEu"
+  "piBsqhlX1MBUaIbGsokUarlM6Lx6CC2mxDIs3NBqXalA8djMhUo55VTMpjIoqhxQYQIRFgJ3iDCNIdOwkTXCQqGYg0WPUDiPM8YhxKwGwsBNCeeailFqVagM"
+  "GcaAgeV1ccMIowKAkDWF9dIpahqA2Tq45qqyohZjhLN0YzlOUdXV2CpE9NhqbDk5CF1MwUoXtYwGLqJYi1lMYQfT0TRitdgRWWHNgbvMnKwOUoqii1NEo7hN"
+  "dFRYRcjFizDXDZQy5Up51kKwaOBmG00lEpdtiIVgFQQnUxorFjxxDQOVorOimhPQNTXMyqgYwuwI7EBZqTMa2lTDY+S4i5ogZtwMoqzKVIahBquylqZ4AcRB"
+  "9eQQQaO6dpxlmEcF86aZjsUVpscgg1bT47wCtZhBHBmYI2S4gTDGrLlBkJeBSxNZkxmFWRdNWhOBKiJZCWXQwrIGVsulzMqKFIN44LSODNcyQrylMcp1ngdY"
+  "MSKibowZiyjCmFZE6cy40+JZQ6UZhLViMoxQc5QJqUM5LsXRMilH0OpxHa2l4hKiAmPNsEozCNYU0AJXdZeGoBEinDkrYsY1slwr2FxWgbKA9WJ6WI0J5DhZ"
+  "E8xGsFbPMMVyKpbObsx5HISYbgzDs4lUaOcI8TS5zFSRa6J2gBcUCoM16ygKFdVxg8BC5px4RVlaXV0OTUVQAeEarmWYlbvIcKhFdee4RhHWNGVSRIzJWjyI"
+  "oNA5ojGHhMCm6mBQlOARQYUoZdbCjOkaIjwFhoVYXWVwXQwipDBBLGs1GYjB7ChqtCBrSKyqUyB3C6cSq2MYRslF5rSF4wSzZYVkBrGprmhZXSczgkuooKkU"
+  "9dIoBhsRncNZcWLNCtwY5owqwjqGkaegoaLANNY0CtGaqVGGjBvMYiCEprXS8rQwiImJsozCCtwhGeOK1RzLrCAliIuKqbBSi5wZiUqriEI3wWAqC1xDdSqo"
+  "CgW6Ym15GahtKUqLaFrCVroKHBrWUK0m3KwOKsg101grGLGqRDjOBR2wFJtGFNyUKFqMwsKOU1kVhsoQQjxPGYWZKxsj42bCwZhKBQemqqkMI+rJEabFg9EQ"
+  "jhuaaExVMQRN0xJxpQgrasYW0eyCoigAnQpj4OB5srJhqZw5M5uhY7epgmwGhQIhDbvGGWo2YGCZtEzTKhqQKd3QiDgOtRNrhhaiKU3GaASKmeuwYi2gIepG"
+  "JeipZiFi9lQoHcEyg2Nx1bSUC0nLMeVm0kyR5YBwGtSVQWNOYTdbE4YMUDUKCiaMQxMWKyhqBDkrouCqrkOLDrV0kSVk4KgpXFhRGCzQKteUmOCVQppFHlaR"
+  "swpNFoJS4GpMpjXJKTtaswyWqCJog9DJJg25sxBxYQODMsCilEHQExSzDbGAa8BBbOxytMiVESdq8MItYRRzAhGhWgevHMWmSuqVskKLoDMRtrysYWCCXGiB"
+  "8arGCFyLdTCH2QaT3tBpQUdNoIpaAbPIgCaIEVzPmGbNS6fSHEUVKAOnq+BJXdQY7kIkCkdlWC0HzaoMnAgWQmml9BR33WZHqKxMFRo2UBeknENBcFk2GlZT"
+  "rJp45jY4M2uKDAI2rEeNWA1HDlJiqc2ZDUJtTrOGAgXFXYxowZRN0LQOYdC4HoKBMCR6DARjFqZFAxuNHToEa0hZVIaC8GANpcskjiJIqGsFpTwKE6GCmOpA"
+  "Q51yNZHIXWaoGGM2WpKNKpCyojmDU4yOjkZRlIumaqCVqVbZWqFmarBGbjyVzdzBsAIuMxiEqFFXYQgi0GDQ7SB0qjFhWuCB08oQqyoYNcwoQiiHDhYKTYnI"
+  "9KI5XWiBwyw2DSPUoFbCITbNpZzJIRrXAzJYmlDPWOnGATgGWjMaczoTpAZ3pliUXtqhGbuhBiEPZsPB6zyUTYGamumVoRvHMT1zXLkaVSZDjsuMXBxPK1qh"
+  "RGEuM0aM08IgQmrMzUSDQzFkgWFP0VIoWkdjcIcaIpQmEJyxbkrVcRlNYpwqTlNhjrFm5iCuoRZUrFZwKRuwMFWBzFLIqlXU1jAvE9wQioEVS5mEKWEFWROB"
+  "CjJkrKNSRIDOmdYMMyOKaRB61sDBcVzUUSHDZRF2ZeBgSmuNjSKLWOrMiLFigpFmapAGo4qUK4UxGowQwgxOXTQ1cDUtGsMMdLCArsywBVVOETm5rutERuoy"
+  "lDsMi4NlSj3HaQ3PiUp3WuU6s6JxJooVM+VoM2vBokc1okUnFFGXE4uiRS1HDitWhGd52RCMpbqJaCq47DBBLhg3SDN3bGYCgghhK0EhGrTCywJx2qRgrCx0"
+  "qdJlFF1HrmanTJ2JphWo41bJzgKBkNh0ppolMUGDqgwO4arMY9MMgQGqk0iaixgU2UwXdRdTmWfSpSguYZNGDeUaBBGSc2XKIORu2qh1i5mOVlirGQsvgkWo"
+  "EZyl0LhUiVMqFKgu7ODQo2KUZVRHYEcEndCYpjwZ0WRMLIg0Wjh5LAbPGdcQGwwHVKx6EYZ4iBRYmxgNXGVBxEjXk7GomesRFWfBYIQoTePFgUPR5jDXqIYt"
+  "tjJzaJVRiBZagekNajCZGSFqCj3DHFpZDQuPnD25iDpNU1GhcMsMljEoniK60bAaG4ciw6hWqmoNcVgj9JDOQiloMcJoU4rZo5vQ5Ko6o0WZcMc0dDZZXREZ"
+  "U4J0juMSGVOVU0F1sDJb7oLBzRjBFQwZbCrXopBhhjk3lTsh5SqWmWPOdJOZNAjFo1iJDTjVcpxVnjUsTNE4GIzNU6h1tRiNccNZ5RSwGiosbKjIhktxU+iJ"
+  "coa6AcWqKbSiLFE1pUEQEkc0nevKSxjKRT1ZSCkqg7yOhplCTlJVlJlQcmGCXmEVIDhrYT2msbYITCjPtdA4WlDKK1zXicrSBsEpRLYg1YhUrkbIlCNocV2E"
+  "XqapEaM1jD0um1gRo7FqDiqKVUYoCNhw4JYqTUdhI2iYXWctXIJQSEejKMOFUeZo9BbH8iA6KIxZ6ixiZVmXLrjSwOpRcZmkRIiOXIpNmdfQqrsuDCfEzpQa"
+  "tmpqiAZmSZ0ODYx5WZiGykqkKioqS4OIKVzRc0QjUbcqtUyDQqdFXCnLVRVP08BmVOHRQhl3oZESWDwZC9iAypyho5AprMCyisuIQjjBijlnpWmrTAWvFOug"
+  "8YSKWtoENWuWyERMHgnVrkCbQwQmBVekiGeKWcGwsTxGE6gqcyE2ghZ1s+qEqDJELESYi+x4JUww9RKWc4Q5mOtwhWMK1apBUAVxGDcUThNTqFZGjTpVKq1B"
+  "DlMKJbZGgKAu7CauXECvk7WU8NhpDcyxKmWPHsGg82phgQnKkygWQ+dmqRhnmsVyxijXWKFSoEeto1oPXtPNoEKZQ+ZwhJqFDTeODaxKVOdacTMYocaEaJJF"
+  "HNhEFRE3lsLAdFg42hrOnbXGITuEKFUirVzUHAyODSxoDtEYHFMsYuESVmFZa+hRaQbKGCeKWUDUaWDQrOCqUqWqaSB0oIpAgwiDJTpA8EIPiVpQa9xA3cSE"
+  "S8wodWgVqiDLbMUOWFOrEYRtBRTOoiloFR2LMqZWRZ0RNDFBKYqKZg1hRDNjmWCNS1aBmumCINjAdrC5QqYQRoGB8DqT0DDIaZY6srhyEKwIrOlSLVxNKxis"
+  "o5CpE8ylRgwGXLyupUDBNVYuCmY0GMopjaMs6JAasIpsgpAGMuxYzYhYKtMxhsJKUDFiqkLRKcClRGk1rriBglZL09jMYIq6ZioLHQMVGobBoWiFswI3ERTC"
+  "GWpYCCgQpREXzWDK60qHRWOtskQRERpikemGZcd5RpoGKutiEAw2NOhCULylgRFyUBMaYeplhEIE8qhYcVxSZjWVmSyi4GJOdFVBmmGzo1nXolBBRelM1uAG"
+  "ZRHIXImxghB2szCHGaWCbjTTbCpHlmutaDquS7x6GMOVQkVYRsOkHJVapaKRC7qkGGy6XgVsRNM4oBhnG2Q4nBUsqB0D0kITcqgIM61lMbRMgamxCEKYrFWx"
+  "GUarGVdQKWd4hTBoVgUV6RBjYgNBljEg8EyXkeLKUwZZJailC5xUoFxWm9UVmUVlXcoaFuAx0ciCjYXJjLpMgWE6WMPAHa3GWAk68WBZnhtHHAYTM2LHooZq"
+  "q+dFK7EUTpYto4oabMYMHiJYg1xoFE1RRopVLqNMQGhqc4eZ5upQoTM6cenFTBSxaaZ4YjkQCygq82pkqibXYUelGgJP8UxldYUQbmR2hWqIVtYFE+gscF03"
+  "a0Zwgpx6GalkVhrGIqagNbOAIzWXXiO2FIexFDVxCSjCa1QqQ9QIKwPUnhtO0CzOLYGphMuCa+QssSohxNgsgKrMKzJZSBfGGxybixenw0CrbIzOKkrHFWca"
+  "Yx1MFOWA6VRrVYywkDFbVIySaJgGYt0ITU1xomWYE6Z0XLUiYQ0sspY1FARrTBVF5VK6adYsIOM6piganCaYMQcUgarCE1fTGQt3WWZwrCWqpmAYjiIoM6gs"
+  "GgZObErQTb04tSizBR1m3QITZuhAzRSFhkYsmEPITGNqdBivMNEJ8VAQ4iDOk8WJkzvBhGXVMuYyDM00XuoRnt0h5cyiKDyhxqpyptEocA2zFIXQWQ3SsVDW"
+  "WRAlZSczdSOqWIm665CGjFSCSs0o1GTGHEIBhRE0VoSJUGpFA71yaJShWBwhAlxkqhgizQbLFYcxYtwgpqaOkbuYbUREUTFB5CwRG4RardIMZWAmY6CqVkoq"
+  "iAp4YwMzGzgVtEIs4QKVBdvAcapRBBVWFWjQa8x46DSKjcAITtaUHVZLFYSyLDMBhWO5o8sVlDUXiCCuDi0WyhZ3IgtTsDxMAoHWFDS6nrrFxjpRFoVmDAxb"
+  "cKfIYVMzqEoKjVYr5qgGRaZiqgoVhAYvM5uCGVUjpqAQNisXXhfUxaxGQyJWQ+zBc0qXkFeonmWkxbICDduUhmgopgRPEeqAsLwgcEkwJpbVNN1l8OKMWsMF"
+  "CZRMXLnFGRtqWlIXNLlOnbRkHdxgoDhr9DTBlkUHjFJ3RQQ69SIH4+CwGZoMAjfDaCSGGoyVQhQNC1K6yzqiNkcwsMKITWeXBVUuCqzAiOUE8hiIAQNDSBoW"
+  "TE2kURBqHqlYDTxngsLQmUajdD15FIfJtQZ5DFhRw4iKLF1XhJbNLLM6LpvJsKbChIyxs7i4bqR5qcpYZTCDQiAHzgI16BojS1fTwqxhDcaZzWBGIVgYjUDB"
+  "SDxmQWoGRVGPDo2FCCwqtljRChOOa7wWHBZjyhh6G1aErjB0ChIwq8Ra7IwxE6tEdVFGkBkKFOHW7tTIItIp9Axr2uLYHSqTkaNxWbqJSyVXnQm2HGPOIwbC"
+  "EOPGaspUCRWPWawpBbgKhFhQmGGz81hUHqoxqGEVkztxGhpQWKxwCZfSogUanmBRSDyG4DLLoqtUpAeaihYs0dgsLLRa1ZDCThATyurG0QRvoKxQY0tMERtL"
+  "ENS5DiS7RiNCjhGXWybEXApGyUAZpkA4Y7HGNawQWYXCM2jZc6xMq8ywsEYxglc0lhnD4JpO4ByH8uKyY7Emzbwg47yycmN5rNc0Qt1gwlTUnExxhAutVmUN"
+  "k6PIGQSrdNCkc01lMQhZbIdpqik2IEuBoxAO62jMoUOIUEPEBTHHWMpgnVZzalbBgmiYlpEK8tA5EOIJIxi3YBjQikaBFoUMmhfVpoRBsDQXHsHGodfUTBXX"
+  "oMrC5FoVVNMZrJJOrkJMjGGBTok5lDkLlmEiSbeiqtaYQqguizUlE1MGkyjHgWGEgcs65oiumkVXpSxDkUdklmki0DBZWaMBmFxqrIxF6BLVWlhaWM3ISqGw"
+  "SJcyTrMEBGd4dS1Y7BTTAVG5gtNFAWQR5WYMrhorAlPVBQun6jK4s6AOcQcnXkdBLihUhha5FgLVc4mMGFQOzsrBhhUKyVBjlRtUS7NSnex6FOQkdWF1gIcG"
+  "hiBOIRJ3Na01kOdyshhZbCwKrjh4nKioagJMVEwrU1FT9VLINWtRKSgPHrimgIowFoUtQ8gG0FJMUSyXDAWThiqYElxFyNYtY4XUQl0VpMg6iuCirDJ0lYrR"
+  "XugMjWNZjbLIqJzFmJopllEpBha64ZiNUSzXitcIUhwUjLjR2jSzLheP7BCMmSqEEdLFbih4ZdkoLpUV7CpBBAfT1sqy9CKjMYNZc4iO46jNqoOlmCmhY4iF"
+  "MoVFNUqRi0BL02AwDeeiIJciJW0WnskITJ3SoDDCETqGLZJyBAPOGJBFMgRVtCyOqjZOqWEqJWqiXBovGBVnHNNwDSxMsOqlbmbKHIgYQoMYiohiwCh2qTiL"
+  "6iI3cqCtMmvKpTVaSxEjNC06lkdj8TADi2Qu5biMVVCM0OCyog25NTPDSIMlQgNBHhUNnVxqM+pqMjKwSiM38jqzauah8Fhr3OStMeMtNd2B9VSBy6gRXj0E"
+  "YAlzGowRbSo4E1TLYUWFtVJolKcKjqEhy0xEg8NAnaKpsUxF6KCFUaQ1pWqPojWm62pWDJRWpsaycIx1jhbBrBGkcmCZm4ZxCtwhiMphDrZCYAiPxRZFDIlh"
+  "Nc1gjNwJs+pAsSI3jmqjXIa4jA2qCouaU9RmcSkmpkJsnS23mJNSg7BiK7VZhbUEiUZGJZyCMlW4TdWwjBcxDunV2QwhHFQ1qLgEBj268hiEMj0wzCxHwkBU"
+  "MAoRNTUGNdZ1wWh4tDpa8OAlBdewczTLcKhuDqk1VsaooIU4JRpHoAoqqbIaaQrCqygU4gqHgTBUCxXW7rKEckIjjcAG4OTS9UrTcQFPs2CMoitQEVh0gGkY"
+  "Vqki2RqB8bgKFBu5MuXAS801DbaoBAfFnUBrRBQzFbzIy9zVceYGDTSmxsSwaU0PTgEOwwIvcAVBoctsDZZqqaIgbTh7bKaQg+t5aCx6lEUMJWRQoTzCVTtr"
+  "4FLE8mol3ODES6iwcD2x6GDHDJcGdaxhojphmlAWsSBwUDFBHSHLUzTVbFKkXLisrtGpm6iIjlHRXqUIFFcGi4HE7KgFLWRhaRBzhKx5aSw6HIaxgVWNW73S"
+  "nQhvhk1jIKhoDuLVlT0zXVI64mCL1igqSiGumMBAlUHT9BAZ1uByWsQVgsBZ3lRxYr0qRFjIjWwFFIq6C0SYRVkoa5SuGAQqHqtYISya6IoGzsxxsQGzGZZi"
+  "AjFnqCAqKNaqRkd5g1PUM8a6SMnAFSGIxtQw9YbSRLeBm+hapSoKMgvKkNmIrpFanRGnmuUkdToEqgeoU8BhZbFkDOQVQkOMdCbTlClEI9awIUfPcF2uXjMY"
+  "Vbks4oiBk9MhdBZH6eohFTIKiqA4dI0ViOjAQ7gwLBp2cEprzdwgoqsWNR01RRyLwmS6U+dlntwEcEcEoKdqWRogM7UsHCWvKqYqhSK7KLVOU6lxg5XKlOml"
+  "hhvLhNs1GgN2tSJGjoUYQ1xHSokqhTAaRRCsGVcWFlUuhKe5WdjGECJnk5E0YRpWbUBBLgwvk6k1zdx1aGQU3GgwTU3BAaFsaBgwpdgI5BBaLukyTeaVIoVB"
+  "HLzWmLZO9bgQ3kwBRCmSDYyUi9hohDEGMdS4hsGKXBEwA4FFLMB4VZZOQSVNmcZOCKAim4LKjeJBWzAXaMCqrkJTU8eMYmmwNQwTtSIwhWBOBdUYlaNlMGfa"
+  "DYyAYpEGMVLKQ8NyKuaB4DIkizcwxJJ0TcSthAKCoek0nFsPjVFNEDqPDmeCdYXKwoqtGIeVtOo4geJSMBvTVKcJQ6HMCGGwowIjmCZopcVNmU1ZRQw6ZcYw"
+  "YLUQmWssc6jCijFYcOMIDgSlMhd2NePVKdxBwhpTpjrBYb2qsZoSrsPAdNdRqdB5WFGnmBqw6ZSCpmGRDa15nAzPoRAUrCq2AZNpJdrMpSuWImTMpuEIcxoR"
+  "CMYStUZzci1YXQSvtRgjwCQKjOfZgyeK8ho3sOp0KVl0FBKjlicETSc2GsEZ6uiOEDMqw4zATSlMNMVEoaCSA1VVVGcFQxULVoVCDmgijgc5DiJH8dAh2QI2"
+  "Hqsg8ywLaWQVqmw6E50YrRlGi0oFpqAOBLF2FeZhnEVQXGkQYilQy6pUGJE5syJUWJ0ZtTzGC5AGcqBUhAOtQj1YQdaoERSMBLW0NJrBw1yPK62mZAOZbjha"
+  "HkZYkAUjskpMU7PUUZjVxowZRSFqNViKbhR5K2s5mWqqi0CJYBArSMR1pdgSY2dYBOWOZLA6lAt3WB0OZSF0gpliRhjDs8BGIkzLDJF1CDNziOGOjWrIDA0Z"
+  "3rIEldVUNAynCNoQnooxkFVBVgmBA4VpNUw0mbSgQmMIdCmKUC1TxGiB00wDMsM1rso6WVVXnkdDndbF2FStoeUCHpyCJqaMEBSqXgqEkxuiKEzBDAXRmkOI"
+  "puRMGDLUTApjoxzPTME0FM1pDFWChKxZHhqFbjaUETbXgoKZqVjYNMFwsRh5zAAsHaq6CBQ1Y5NOc4WucyV2ckJjqCWjKCvGFbJgbMBZKePA7DgGjgoTcCzO"
+  "EwsPjhWvtNBlKQov4phCZbN2FbFoNLNooEMLhCCXMAMuiFPOExHMKdLCXqHQaiynyYiZYrXAcERgYWXMnLwMhiBrqRAqNFWo80o76ILIQsXNwkBKNCE0rZhm"
+  "KWRaa2I0cUcF88JQcIfBgbN44JwELqR66dTCyhjE8ZpQtDBt8uzAdEpVDCZa8LRUU1Wt0tyhCJsabmyuDRbCs4w5o0d3tUoZaeHMKSdG4iaaoNaBFjNMq+DY"
+  "U0FTI0QL9DDTGeoETZm5gOsOKeuKMkythIrVmOXRqFcKEhInEr10GaN66rQqMkcrsjALI4YqVMqIRFOndOCim1jBNJQFExEmJrowRbNpIAwynje5maxNUTFL"
+  "IUcwXqfKzbpwCutwW1UM6uQKXcFydGMxiGdZpZBSKAYztGLCaxTLw4SFoJqCYBxRaJghNDo06MKhakc5YuXMUTOXlqi6tYwIjBorFGhRLFhTDQQi6rrMTmII"
+  "jKnQkQMKRuRmxWZaqdW5qqzUMKdFqdbA6mZUE8OFEQiq8MQYy2I3Zsq6lRAzTUUI02gMUdfVGMMRMIvSC4gVnpIRIjBjjbq4MtJYNcQZc7dgyiiqoZmxFByH"
+  "WLOow1hLxVSBVuQi9uI0DcM6CQM1DocOoUEzgTCKpsZQMylzhEEvtuhRowPK4WAOI8YsnFA6shZYRYp1pag4KGHFtFaPQlF4qFev4ViHsJwapqd6ZVbNwrSU"
+  "Wy3WCzIWq1EUilAohFeDGthABFOnK2V5IYRaLhVOLIxQAYU0C+RVJVI0cUxUiEZM6aZgDsSUEZqYs6KYCQhYRcg2HkpFKB1unaaYZgbCSOMoMEuBYpjOEOaC"
+  "HubZ8ppA8dgoGDcngqZCMDRF0TRZcxg7dVFaRCDPEaPODFA0YLxCs2qNbspCFTEKK4RqKANqDAdDoeB1SFYXcq0io1zCaiYKS5DBjIx6XUV14ODFYBgZhbCI"
+  "a4HGzWDBocWhU1Ck8DyPm+AVcZU6NDgYXQ1n8giWsRrGqrqOq7ppBAsmXDZl9Kwo61o48ForUhREBp1aUzXWDQx68IQuKDgVGUF0atCI9SAwMLI0bgROC02O"
+  "TRUjlMtVJTJRY6pQdelILudMG+2oY1FlFlUwKBoNsax5HRsLVTnKFoWsSj1A6OAMXby6o+GZMW3VlGMIDYSMMdqybg2mC1EHRpghAjGEVAG3oQPWBRWZUc3M"
+  "atiYpaoSMl2ZWWnWK8aNERY6a8g0S9M5IJNRldw4i9OJoeVoVYXFDMxBoKhAXqdMkxPXjZrFllMFgilkYh1XWLZWEQutXgeMVIPQ4zqsGVgWoTyiplAmhjjV"
+  "neqNkQPFYEah2IRMEd1MXgaaQia36VK6tMGWE4RgqcWmUEUMdiHDqpxBtTgHJFA1ymaNK1gzVcyaUF0LFDtQTRA4ZKh4TD2qQrwUscKIrjdORVU0o4dZXGSL"
+  "aqBpndCpqcNFETuwZqYhsKgaiw1R0UJFFVdwiYVQIpZSGChEqGFi4EwYM+i5BIJAsMpkGdc4sCwXxeIwhCwzCe14jVPDcWUKiOvA4jRaMBmzKERNdEl1gkI1"
+  "mUuM0bCUWRnRBJsWTBdw8rzVi9eVmGcqIGS5XkHDhCGIYAwXmVAPck0vYaiYHViDFqVB9JqkKSoQo0cVdAVHUUoly+ApNURlXZpqHGYtVG0hRMO4Uak4UCF0"
+  "FEHNshjVNFbFGGo1ohEQG4eGWzdOnBYEbmYEHIRQMEq0G1WWAS3DTAdHBgFqXulZsYtOgEY5hoTMETsvHNV44yg0VN0xThMwc0PQSiE2IMwNrWgsUBerJapC"
+  "rekVaeRohkFo8cqiiLR50oxEoxkQAWEu8yCKcou4Mi24oTuFia11QRdqNGVBpVPPMFZD5so5BgOjBitnqLgiroq5YCmvqQxmGUUMDtRgFqRQaOQ0SqesE0uP"
+  "tcw01EzTIKwFDYipRcNmHCyjS+M0ETZic10VKD0tBIsUJZJgUwwRrkOZMibQnF10xLhh7BCnEcURjDqL8FjGQFUZmypthoAxnti4QxthpoKljFIxjuuwcURU"
+  "i9VwNia0YdMgDbFxUxTAVMRplMmmHk0ojhWrXWEOE4eZYO0yYDWtnEyCQFKDkMMg5BAsKwgFDNmBClV3jlVZhTOBgScEGsRO1GgEVlFDXVVxhWtwVaPJ7sSg"
+  "M5oiKgxZCChDAdVlcUd5qbwhmKPMEB0HUwqaM8oKUodwEU0LGRdsKkcXzcxa3jgQVOHGkeAtZhoLEGkqMIjMohTUZa0GHAQqApchFjQNmjXMCNTQDVltVOZl"
+  "bRYRpVitZhoqkRfFVoqhYiFQM4gNQzB0tRhQaQwllUVQ0CoI0Qqm7gwvg1mrJjSBCsxibeikKkaxdRzAIeTKcuBSYBgLgtGNqINxDRWKKZQqGKWMMLGSQlTC"
+  "cJS5NjUaTtPBAhvWxBqOTK00NFJ6NcchiweLhraygkKvmAUqNkJHdqhaISuCHYTIiKPMMaExSyrOQ+syGpvNDchsmJZOq0vNZYhkRBx2FupCxRxNmcJooLAw"
+  "hSPEIxguqqNh2azFmsGq0xqZrjNYtFKlDuG6VCoOdJnCDFuB44al6LouTpeFYAPFmIIY6wwm41gLgZ1FRA0HHqsg2SKL7kxQY9WKMEZO7UQxxagGIcZ1XRGH"
+  "iwmhhOGFmtCxVgp1KNRU3DjFYxWsqbJYqOCawkwFnDGNILgSc2nIKWZYnKmGU1EqStnI4SCny4pghqBuKmGuVAp3QxQu2ugtcTNkVs0aVaIGTimAzLqCYziG"
+  "s0dNK8o4KCdCKJoYpcah7OQGzOTCEw0ZSzkziMY01UxlsBZlyzIExuhCigVzCifTSresDmqEMK2ghKJSrFzONdyBZhNbrANXnuGQlMJpGgGtS7VQ41ZxAaq4"
+  "QeSmyypuzYwIsxuiowp3K1hqaEp0g1DFlMFBlRepQl2sSGUxNBWCSGoZKBq6Cj1PIRijSGmmVrPCImaVg+FiqLxaVjmaEwZ1rEMVCUOhFlSDqSlxyeJmRoNZ"
+  "hiGKYAeraQzKotAhabpFaCBDaaa5FOV4INAFAxsVbiJsjUd0gmdCA6ONFYzUYRiutOphYlbVEQwK0GgxpiorYpfKncJwilNBipUFhpcJJTovDKimVmVZnGut"
+  "oYkwGlgaFdPUlRtGDmLImWu5MIWghdfAMEN4ESkW66Z0GSZmJudG4GSWM9ZMVjoi4kihjsFilpmutSKhKqAoQuw4Q1xCUywboMQ0RFHUSxMojqChWFEGUiew"
+  "iLXAW7ZqwWRUxUpT1BoPohY2SF1XNOQ6aibaFkRUtTk5IgaN1pwOqOeBIYyFXrLCwiLPE5YVRDM3Y9fMTRFBEcjJE1UFmSwYldlQbSZBTuBlqba4qjnIYAoh"
+  "MGEkspgmjLESFIeoMtPUHkMOjjOsWS1MildgjOnZYMWljlfUghHTMqg5zoiZYAmnYQ1nQyozrAuPsai68UKqgaIYcdYOiegOC11aVVGUDs1CtdZBxFYaJbSC"
+  "SioszmihKTtMXtcUWA1io9gsA5OJKqISBmNSSlar82ZEyzwPDAKGSBETHAQsSNnCWtFQlJcFbNdxLpYulopsMwpagCPKgpgqwVqNdNdalKNQMMum65QVc9aw"
+  "WIHUBEoFjUBroSiIpWE1nZRycmAUIVRYWGqCiAtQQ1OLGh04wSw2oow6wmRQBAunwbI6zjQuVKaE1ARB4ZrGGV0xDMrMUZcRXlh1bmbQc4EuDkI17AShmbCA"
+  "WFiRBSFz2ShymdWFU2ShioplTsHVWZzNlRF2XQkxgOiURmlhlaFBTcYiEDwzIyyLnRsUBLrKWhwZ2tCIgZ1m4TSuK82JmqCqjE2IzSKOMVt3cWJEHkjLrliZ"
+  "KKMMLIN4srKImFAnwZqJo8zAoiXGBUM3YzePs+BObqYEqEAoTA2na7qQHZgpCpYUoWpmqQx1JTyS6KjRawxnoZYUNTh0EV1sKqw181I0pTNwWAW4cQgzxFyx"
+  "MTwLMljWXOF0y2SYzlCvSK1ZGQItizxQKQxGqYWI6JLKiquVdGLLhSYLmyavYQlGikqsoZ2KoqoGpbCqyYJEXWxk0eQslhFBwMbAFRGYcZQqs+OyjlVq4kxo"
+  "icrAKzYkRRSUBgcNDM2ogVa4UlprxBSaBeWAHpSBmcbIogynrFM048w4cbCCQAMucqLB8eByAgNzMwY2Q6Zl8coYcUwlGmRlzeZGU1VnamAhpeXJGVwkKChW"
+  "nCc0DJ0NEaGsoTiXgqwuqiOz1DLDM6s0oZqtFA1XhGJ5tdWlDKGAdlU1jgs1AkUzYwoVlOesg6gsKRZwhFBDaSmmg7OOMBZXk7pUlRkFHMPZrkVQCJfBtTyq"
+  "QgR7cWFoTIOq6lINkDlThAxazZzVDFWa81gjKlJTLgV6yLysiZolglmGRM2ZxhhaY1w4QuQqNOfW1rq6lBvKToy6VufOpYsWYa0OrgHCzCDWWgSOVblNA01P"
+  "jYKKpkhjQFVCRTIExQpBHFVwwuxYMybGQrptaKCBhaAutBpP1EbPLKtmcik2RZraHDQW0zy3kTlBhCBjgS1wYlCJnuwGJTqjLqs1BSsr2oyFWhSWSTOXgbEQ"
+  "DVSYcySSthevURp0g6d44GZw3khD4WTIXYbMDeWGzmBWWWAwdJ0FgrAmMFZmaCosoxBMI+qJqWJFQqMMgYkZRLdgtggWHDNxLOsx5rwkyFoVU8hwHouIFsTK"
+  "UuGaVQFa1ojYCNbEMackYE0rcygwYFOxI2StoyOEAuFFoEWGTamJCuuFVaGAiitaUONQcL0aYdlByDizXkW5xphaHBwjmIYFYjmOCoQSHjhQAtcQg+gIrEPF"
+  "GhRDnNotq0GiKTisnugGFFQRDIVlYBSLIkyrUawtcL0YNSIKQdcmqKAVq+qym+WOikcYNCKu6qA4FYqVnqnBpegRDNlUEZsyIEQpzBBEnhpC8CgxqI2VokeX"
+  "jkyXEz0MQIYpGFxOLLO4s5lqsdZxFUORghzPxrLICaOFnQZTpSY3cBgLKVMHo2gmQiFjLMzIcGF1y8aBYmNWcUhPhacYnKbVnZGgqLMajepY09wwoJBpMMGg"
+  "gJehdJVVBKJYDSjEmqwxNJ2JMjaWDayV0ToaRIqpmWtwGlFFMMY0Xc1BDrIoNRwTRokyFT2sagLCYSgGaJmqGSGLZQ1ntUihKzGEM1E3Y8NCidh5sUoTdZyu"
+  "gTZUxWBMs0KNqMsacEqty+QwXBfH80DBCpwiCuEajbemMTOqqkuzMupgtBgqHM2KgtmZ49IxrEgtdqnKxOANWoVSCI3NGJQkgSBq6ECwIqRJA5gm3oQqsybI"
+  "tAJ5CkGZQ0jVSz0xjTJDHharaGYQBDlZhUEvGOMI5uAVqxZXEaYuoD1B8jwNXUiVMjpIa0IhgdCgnCtnQaItK1FQXCNYFThZ5tJBnTCYMIbMq8UiUFkkCbei"
+  "QWdzFaOqGjCwBiGFGwwwrizMEURsVbMuGwMwjYl5pTrBGeysXAnPJajI2FCKlCOIUxQ2lcOxaWqZCht2NGuMkzNWnTQHopSOFDiPQtcZDNQ1muZq6MAortBE"
+  "hNEgcAqmsxBYlBmVgQXHHVMqC6mKzZLVwTrGg6rI4zgLhMW0godwYscRVcBqnEW40GxVo2aBHcSVsEIhMlMloB2vo+WUEasiGrPJoUYxozKUSyhsU2HDhMIg"
+  "ooaMpVusGdRRyDiWXsQpKJGVggYiVSwGiYNIkSwwFpWVQip35kJ5mFJlS0MPhBUzSEONgOAkY4TClRhimzsE2GbR4bQac6KZYFUvMoZkcBDXyOIZNUUHmsCK"
+  "6YKOAbtACJpqjCcz9ALKikjLTVnWzVyihktkVjeiGxQzlYE1EAZBnrmVgScDrCMnjahyct2xMAmuw4AQmj0LWsR0DDVVFiqhRerKUToKA+NoIaIYzagicJGx"
+  "jgcVLpmqEUUXDbsE6gDD8wBm5jpazTp6buB5TCwKCAJ6QVfVEQKKxGoGluByxmTJoYrRWUe686zSoUIjg8bR8aJlcRnRoiYwUyN4qRyHqEJT80As45gyZehm"
+  "IwQrsOAsGCgsxtw4KCJ0nJfSJRh4GgwoAQdzQghiIZgpnbUGSilq6FAY9KJ6i9NprduYRago8ATHVhhFnimkYIAtRBjPjKI1YRF4IirIwirWyKBKwWSUU80m"
+  "MpOpzkLLmYsoihVPdcUwEEqzKmUEpujQ6iwoGAdj8jShS5qijNbIiqqCshcJkAeJWjqiGGQwcBXXhCAznEo0olGyXCALWeshjqFxXWNhighXsAkmo5iq8WQR"
+  "rOdZ8yRh7hpunVW6Yxq5IBQMlkCnsaxsYFTVhTyWm6I1NWKOrmBOMJGFYEM4Ll2FkxXXY2M6dWpNouCxqQyqVDyYYI11bDyMhOJ48EAOjFA3K5syEJepVoXB"
+  "dLOqWoiplGE0XjTGwUSVotl0giMKHMqUoQPVawFHFGEWFsTGlatVFCdYVYRMiQtTbmpwQifDC1l3QGhQFVQOXZgswIoRXNXQooq0iDjRpjxRGBDIoYiwVNio"
+  "TiwOk1OwFEZBoVZwJiyzLlDMQwIItcpiTmWG6dAMI5xVLaxEWac5lqcYg0iFQ+B1WUUpUyjIghahVVSMiLjSomm6FBiIGd2EEFeZi8VEaBS6mgeaYwgioqtS"
+  "ayA4WzMV4bKYigYjzDSL4phOA1ux6gBFdTkXrtNg1GgZtYiigRc1cjqsKYmsFDS2Q6h4rGaugjiuy6LVo7qO60YIW1lr07xUDQJjHazEquug1oSS4+CyiEFZ"
+  "kMWGWJByjEsIGh26yiqYWBwMiTWhmcVxoQwGdIRhKeF6aFwKcsdh4AoqDhfUWV0W8orKBqst6tzFEVZGUQnNg6OZNbswiEYtM1KvRlPWFUoYFcC5g7Omjcam"
+  "kTtTKW1ohVWxYGOE8JRpnOVq6BQKQeemrKDEIkGG81imZbMAmavOGgo37CrBWsMtjVIqraOaE93RjoVVESFDVozGU6p0EBJBmVzVFWOMcCnBlVkHCZrAkxkQ"
+  "M7paC8E20RQu1rglTWQmUzeyDm02MFAwM2gLqFDFGVU4C5gOsujZRAwOagYKrGbNabzGi4xStGiKhCErQo12Itd0UJx1xjhVjhUXNKzIlQNTgRg4iKh0WZCu"
+  "kxmioClzRSl3EVYHs2uvmCizmkh49RSYHJEVRRgTDRVlTmUOMqcsGrdZoFUPTiGEGhdrGaoMLqZ2CrFUIZRA9rqlHlVAiMbSnNcgGNWpnNlOiOA5psVaJqpU"
+  "4RYRqgcpaTrCFRqZmWrR1OBlnCo4TUHDkZtg4zoa9WCWRUNpUJWITc0ghWpqLhIrxGhVRF2xpObFCGGFJog5XRWIKtKRWpmSWgUL8MKmlDlWsclIseKV5Ihq"
+  "UyWi2lzNDS0UmZuQBtUYXYoG8wg10Gg24lQRaVdQECMMjaC5a1ascRawiweMBcXaRcUwGjPVgaiupeZNcRBPVWfQKUZTEB14sLpGBh1FMB1MZQMuHK1qCs1S"
+  "tMI4FLeYy7SCEWoEdGbWczxNcFojnaUK1MpiFuWmYldmcAPLmtCVppUiQbAu3pwK5ijTQoWx4zrZYy2WjkVVEEHDQa1mIuYgDd0WDAibK+IpnjdwEYq4WOAw"
+  "UzmMhRiSnWA0bAYVChRWHqJGXrcJHg3GDMoKFEKDExe5iFgvHFzTK8fJJhrF7JSVywKaMJGiKVw46TyRiqcssKaBZkmXWk2YE5ZVQabNjMBJQQ1GVZQMpcJQ"
+  "aQyhyGTN5RTWK2FlMBo4HrQZRZ0ZC6qGmhfHaipz1RCLkrfRgUwUCjshpKu0U+qiGNE0s0qkRK14xiwqpjLT6IqpMih2I9a5Qa01q4ciRi0TWUmFMsVZU7vI"
+  "nkYMnsHQhNJY3VREncPUbKw5kmdGq9K4RA2zaLDB80o0KpoO0uhAbDQnClGkXDQ3ZjVmYiAuYyx4tBilE4hVBldzijwEQggwhtnAXWQGWgVVQxjIgxVXobKu"
+  "CupQQ6msMccJcRgi01TDjBuWVEC48Gh326bCDVYuxFyQFWdBoZYgEQ1VsAiHcAeuKZYR3gzCjdYlqomGiukwHjgOo2VQkRZPFAKLrIW6htAxg7XBRTGXljHA"
+  "LGPLqIcUa4q2Mox6WRF4XAgO6axolheBbLypC8tqnMspqEO0mWyKoYsVbUJTdMXSIehSRIRkYo2gMAJZibisHhatUKAZa0p4grwQtOdGgjN6IUvBdAePxJCJ"
+  "HcHBEVWMMDE0JcW2XlUTapx5cIAt5pAFJcZo4coZTqkIhiGC4xjLa8JM06g5AZ1R6MLSULBmHtQhheg0M0UxlmNsYVPLk8ViqDiLJoR0GR1wBl1rGFWrWlCL"
+  "tcWpKLEKjZDCqUYL9AjGmNBUdtcIMcxU2VA6zqJSCEyCRo0JkrHCihDQGWeZ0eRggKusaqSQWNyAszxuVbE588zAjUrL3ghv1SwvaehsVmhOSBWqYw1hcOS6"
+  "pglHkBbUpEEUlcZaMhqCikgV7LDA3YKhUcMtDOiImUZTIlqqlMNiLuIsLgo6KkVXo4hCjlCHogerUbUsGGYZ5SKnLGShqeBQY6EUlTEQUUfG6lBmSUdanaoM"
+  "1jTQGuOgsAOrXD2XIEzJBaFWsJCG8jyzKYcKmoZqE5Ra7LoyCNJZUVwtNJwpGpuEodat1KySQFcIrqm6ZkNRcwdPacTG9VJEgcXB9ahiRSfCK2NFzUxiQzfK"
+  "aBRzDsqA6zKllgeVXcdyQlE1mOPBXMaUapBO6NZKcNx0EZFBKQhGbhgMQh1WTqMG9DS6TIV5KgN6jCbCSlC7UdAFE1PDw+ZBhjJvQgxhWA2DSjHMxKwgWWGI"
+  "qlGX1ahSaIAFSspFY6ZOmdwJc8ggGGFpHosQBSyqS9awAudG1KyMRRRYMIeNKKwSAZHBQkxpbITUamdFGbR4WjKCCmtWZrGa7MDRM9YUUdeMiBN6K4LJLuN1"
+  "bIRi7ARtQgDBI+rIKQia8tiYYCKLgjt4LGhUQ9awVmNo4MwMqdDJ04KA9VrUMDqwE+EpKAR36FDNGBaaFmIG5hbIA2MVs2KZomBUKNWhKDJ2biqIaqmCXClX"
+  "oSCkC1pCRuPUdIo1Fgu5xDBxggkrVgoMpScw6TgrDbIIKy0E5rREEIdmS9OlQum1lMWAkcGlRlLFLejGIgqmLOVRoCEYhishGOLNGQfNTBMagdWYguIwotME"
+  "wyKvVLcYXSqASyPXnEqawwyWWd0gCdLByhjB9qg5KstQMgXHdbaGctMVmSl6VK2kwqQa5kasKdqBq8JtZREuzEiD0MqKdSs6LRY3RixnRGqU2aCO87wKgFGL"
+  "TZMGNZxiIpw1lkcz0qLZk8UMqbEQhhEvbAIaDMFM8BZwRlKHFkN5ruQOrjnHoj0VZYMw8sZZcTGVQTfHVbPORaIGwdi11oqqg8dUpoK54cDMDEuFkMFOFTk3"
+  "EMFYLGIMLoKyKUvPaDxkcTFOgRLSQIhuczNVQoh6rAqx0LphomYkMCNrbExkXBhTVFasFjy3WcYM7kJxnqpAngqrMIrCshkYERUXjZHMYqNaGApPQymKUy2M"
+  "jhhOVkJCozGNC1DF1QhlSDUrMusVCjG5ULhkEGZaK+YgmpWGIwhCRLfUghJMQTjE8DSmYOhBUY3INM1CAzFkHNogzAgOrsZ0DhSqo7xwbIk6lj3Rm0fEmVVG"
+  "ceppQqAV5lSIIcLFs6OByBQIqkMYi6oijCFSHRoVLmJ5wepRRBtZ5dgVWIU1nlg5cRazYSCEcMqWMttBRVggUDyL3QSHIrhm7GDWZEUNs1YVncsM2axAnjSU"
+  "EQd1UAiY2TDMdYNAQQTGWVwamStjpsrRlDcjazrOVVUZc0YwGOvVAmFFFUR4EZVgmWKhnoaicJVYmFKtShYTVJeVqZHCnVKsKiyLXUYXVrZ0XApj4hqNZCY0"
+  "bKoSVVPGUZsVgVFPFicypQU5pYESzJo5poWxgQ2DzVbFDaxG8apaMSJ2k0GwEMXC0EAJMhGYISakjZeK8BBUMWBFTck1lUm4CA1rNTN0MR0l5AQPlbeiQiwY"
+  "wkpDdLVasJgmTSAxFGh4spaZUVHNcwM3UMhYXjtPdTbHrIGOkAtToSA0WY0VKxthWqw6lakpRmo4g1ZOBCs4rkqY4BSsnMEOdbEuMGOKAGFUmrzMIi00mAk5"
+  "KEKDURPKED0WDchiQipU0UKBaDYitIPUYDVqnDXRGNVogtxwXQoORhRaDiqTSkOpUIE2gxjFIsyy8TxWVucIWiN6ojR7Lpiha9xShKgwFUKjqCGOkevUnRHX"
+  "a7AVQuIqrhrHmcs0mLy5auZp0hrCqVOAcId6ChcNiozQQzyGSidPhDuCTJZCJVQs9FI1AxmOHqsNbhhRMeVRXQd4VMPVVNZ08Tiqi0fUqCuMKssSU0stc2Ox"
+  "4qSh08JyXaNJCAarlSs6gOF2geohooWyCq3OkLOyDjvIhBtB9FCIdcchKjp1E4p6GTqUagqhglSwNDECnbk62FqCS6lCBBEhLuQFzRAtjAYpYxjIGa0iUbVO"
+  "AQ0vCSwvDuMioGhlM2YGiFBqsslOGcsJXNTQHbjC86CaY2g17OraMhJzWMCsk1CYrRN1MiOODmN0YpZ5hWOWkDkaDjoqKjQVnCAkhuto1lJi4tJZSqeYzixr"
+  "aBBhiggji2JEYwYvQWmFgwTHHCaXqTPV9WqGo+FQqYuBYsRqoOWViKJyFcKMmxU5WOUSRDxICTfJqKEybOQisJLCIQrTxIBGEgzTUAgOibJAGCEmBScv9FSt"
+  "AmWGVdRuoFKyQSOkrot4NeWIswqnzLi56RZnIUpMDm2scqEYjRiwUMYZi1XBMYxKrEJTkCOEEEx5XShWtMAYRWUNAVPOo+s6sAO60AINqBxELIYqDsfRsjjB"
+  "lBl2hrFyqAxGhCy4dC1TzTSLDdaUKF0TFQJiNizQBOFBgw2LNdR4oDhT8QaVmKzRVCVkIxSKpRUXqxY6llbIy8iAS0m7YplptWassWpWS+BZi2qOVhHV0Kxx"
+  "ReMsLpt5TgPBC8NQAqt4TCYDaLnCbLoQlCc4HMRpWjWZkVvCFBUHzULBbgZobhqOcAB5YKcJM9ctmSbUw0iVDSowtEYYgUsoc1NQjlDKXEMptlaUHoSpxQx1"
+  "keFMRmWEllmBazyLiMwyqpDCjJKmGjN21DB3giMOQrCgnrmlRgNH8wRDtDB1gjsvK1NxoFG58AQHlrcU1KJFpgkwXIQaLgbFYYwkVAiGHieEILo4HGUQQ+NM"
+  "lMWRG8MWC8aiaZSGnVKW1jLBY+NgBeVZcUercDnGAwfRxRAvKKIwXbyhwuQtlJF6NLiMmNcFMUAWjCaDZeBSGlo5M8y5ybBAbjSvcruANYdC81Auw8p5qcAo"
+  "FLYMHa1YpFU1oTxPW8moBLPBXMlqhVazEVWKpUV5DUxnpeASDVTEkAMaYByHpkUMqRyjLiuXqssqqhNXpStrqDiLEirQSykmjBJWIqx1GldvNZGKhSZ0juQR"
+  "rmNHQwSDFKe0EMNGoYxSQ+CoyCw4DQiLlrkFmwnGVCHKTUg1Mgw1HReDDQYrbo1FRe3GSpF6mqasyDiGmTJjyhqvYEqjtirTqoNqTCOHyDjVqTimXma4tLGm"
+  "IJiBplsFc6FgiFB1RlWwmDI3U4haTcMKmsvOIZqiMNKowqrIEFWhaYZ1E9dRmYLKQ0YLpSwYzeq6dYG6A8s0nWo1HIWVaD2HCDFqAIcKKZRYTbOmXheVijNF"
+  "q8FyjjCwlqsYTc3KXBeh0KbIdVUPmeBp1rIoRtIslOFglAdtTEWpYlmUwdYYdcQQXqVhjljPcLmQ0xgZauRUgkrRIWsGxQynJQo2Y4iqCGtNUOJhzdI0qDOh"
+  "weqoKJvGoBwOFRhGigxzSk055TrHi5K0ojFnFJgGMpERQtRoWJiSGp0V9ohiLsuEEIN5dWBnc1NZEUqHYcxNYy1QazlW7rQVKxiXoeeGGsOokMtQY5qlXV1O"
+  "q5Mim+SAEVcoo1JNCJXVdGu5whCUQRlQLNWY8jCFilmscLR0jDKHijJ41KJqRjWsFFYvXbCwmKBVFmKOGZgK3IiyTVl2olBvieyAI2jbRqjVFU1M6woFW2g6"
+  "rszOHEHHdCVomht4nRnTpjKmFuIsMNIhltLQ4IyMhQMC6RSKbjw6IFZosqp6WBGBSLiiHLLGiiBsTCxTsJpSqVOaJsK5W6eo5mCmFmbUIgZTqdkVgsepmZsK"
+  "wlgu5iKioWguRKLAMyJvRYRCYkN1Tei48CIRtSCIgpcuHmOFGCcKDlNaSJB1YMVpWBUWzAIjNIW2mjWqCqtGWDrBlMWRwzA6dD26xNTIaNesdKqJMzNuppUW"
+  "Qja20wpaUSwXNMtGoZqmsuosrqeVoKiZK11hI2bTXKIhoMcyBhVx8ahqjYOCi2MYDmpYBmU2UOmmoIe4VDevaZyVsSYjqOjCouuGGhDEXriYGEKxmxNnbGgw"
+  "HCZ5LVF0QqnAWDl2VjoKYsxQnAbXyJqCWoSMsZBYHqs1YKh0oumaoRDMi6KCoDDCo8Z00zIpo+VOnVkoVBNarmpNIFyMmcq6IMJMRUysZh26zDjNC7t5KgOP"
+  "HsYpFDlQKwWjBBGW9LggkxmhSt0JLEmDIBZkHrzA8thQVgFTDZUGDhR4EQQbDdcJ0SBO67BYhYmGMxrQkatpjsrZYUVo6kyMLdokyjIMDWVZk4MKLsdAsDiF"
+  "tQMGahgEVBhNbJiKasxkc9YsLLVmVQZSaWiIHFcxFBdYLlXTWlGjsjCzrgPDoVhMcAZVngslGaOmGV2IQay1JKJhVqBRHhxb6+Yh00RngshQpUEX1EJnFZUu"
+  "QWPJdGkTDkJtHFZ3kGfQ9CBMsBh6kSO4mUJQquXUsVCN4jJQq1CZjTIrRFCIosFZ7lQsVCGtHESr5oLGWb0lqgg5XUEso4WAGbt4SspShatIVKsImcUGq2Cl"
+  "qmWBsEUrzWQZLcqqFdbVjKyFMOgSGmN6GTZZUElMkTMWxhaLwiAqAkRF8oQyoJgmhbcgQKHGoVHRnDuZstLUC9kRAYuUmCYuLhcrTGmmFIwKrsbJzgq4yaKB"
+  "iuWxCq1R4ISmQqAgwyiMi0cro0ln0DS6E5WidQVHRFYDhGJhcDOGCqaImLqgnqHUIBgwmBB0qWDQIsylJsaYs7C0MIwCLhzKzKIELFYnaNzGK8dVYRVGbkC4"
+  "9RSig4taLAs11szB2Thn0ZTRrCkmdspEWTxoK+ASdlZO7kwN8gSjqdJADYypZoXUQWV2oFc1q9AUwBQTnefONRg6zeSJYGGIokbVkwMMMz0xyhK5NFZ6BGHO"
+  "XRmjVlrBKCoEVpwSZuHQLC0nJYoKVrFiHIyJgYNRUIawRiCUHJVBWaFxM52STsNySUU0Vj0mCiOspWN0KCuGde00iBmHYAOucJgKmuYgHZzaCy2ENi0KCiNl"
+  "XBQWBTqLpRAu5mCELLMQQ+RwlVU6wuKpiKGGBkdlzGpEWAHDItZJK9dUWegZ00wnAqSYsgiMgSBh00qrTlqIcEDPbBiWBkVohY2GHdMoVuMFjqBiokCssJpm"
+  "FgaZi5ZAM0CFlCp6wsByEwUO6jiFAuVq6SCGNFGEZrNqnduNg4KJMhW6pgJPoJZF8IrSIOaaFdQYcZfAcqdhaCfKGxxOdsVAA5uCkKdBhcBAdewlFORoJcyA"
+  "DZjRq+WoC7gqc4hiqFd3QTI4zZopsxtZKRE6CqMZoBxLBjUuNB2BoRKxFOYaq4pOXFSK6QZxHJxS5poCWeSF4QpCYrGookQIwZiBhMxk5qBgaDBoAQVX8xy5"
+  "oBKhQcFxCseIqpoSXUcXgRWvDuOmxqpUASZXaIjVIqYmDZWa9iCDheKxSjCLELxlqrO0imgUVtzFbKYI5uSGgVaP5tyMo4sYFiXXzTKTYwEPHFbFFBSvgWah"
+  "giyWo6uoqGtMFlyaUxxTJDQvDkhPCjzRIGCGpeWUGArURGXCZRQOcScQ4GJw4MTOshCNcWmtk9EYcqLE1UBQDroGUSxMSD14dAhRAT2titlhjBcL5syBHhwO"
+  "QYMJiI2pGaMqtKhJqQjLopmsiaIJXIS4YWIM49BhNEyHAsygTWdlw+hZjTo26NJ4SGQqizCNowJGgIUhTpEKwRQ2chePVVdBokJBnOeugrG4zUZknFXXdMMx"
+  "0ziFkNUQSB2jQ2q4xji0W1VXFIIhWMU5Yz3aceAOigerICirqOvCU2aIKxpz6hoWFMqKWmYooIUQHTwOpiyas2XEq1aLodWZCIYsXkpXYxIqbjRBa1hrWlPG"
+  "rFemYbqYdW0ayERnxOgos1WkDFEririUdWUjxhrXGbQkCIAZymRCa1p5qUFljDGVDigvGGfUgjYa8xoJndhxZsZ4oWGVGpRFHdexDiWaDWg5VGNSDCF4qFaZ"
+  "rj00chQLrCDDUe1G6uSIKBF25DwTcuo0yAJzbGDC9MDBrlY0WIWMHQt2hjCgEZksrgPNaJZyDSIO4RTXjCjMmCpkUEd5NBCtC1aUkctGYMSxcwSuWlSVpaEY"
+  "pZpVDeQKwgRFxJZ1YIZODLeSgxM1jka5ghAoQhXQBBcGpjNlZiFkitUUtOJpoMC4WlzRctEwbVA4LrR4KCYUGQiYpcA0RhAaASGYDaGphqWaIlAPVV1p6zZ5"
+  "WVNQM0eIGOQ0CiOmZay6sTLTIebagVWwjCgtoCIho8GBXRdYaKguG4hqQjRPiyoNlTVVGdKY01TVnEdNK2IKmNlNs2qYzLxQZqiwmaOIWQwQnhkVMjBlkYMi"
+  "olgmciOA5RiNqDaUS0NnrkOwMM0iTN0gTAhp5ZqKi2BEmWM2KOap2DxgkBYrMydwghh3WBzCtGhkQgJzIksxizTLErwiijo2rCCmyhq5wlY2HkFQNlMrXuWh"
+  "FrOYoAALFrxYA4vCWWXGYCgWhiLKQZdAKJvVUxoKjIIxoknRWbgSUxOYZehCWDBkzWS5MJyKnCya0CxKc1hEXpB6jMUstMBB2uoJFCghnTfJYkPQsMwKnFla"
+  "WzqsWlQZFsiCHZdGhli3cQmqWIhipVPNVKY06QpP5pi4XCMQUtaA1ThEWzOr0ap5iMV6cGiC7so5zUpVEDFMKexxKBBjdKYyMAyXo+BgBRywcajI4yI0ipu5"
+  "ildDRjqGS8AtUEYjjOGygQaZkdcQMlyRmTgjhiMwLKUQg4XNqYIRjAYaMRxIdeAO7iJ4ST1To4tsAxzNtWgVtEgIFJ0ZlIdZhQlhxWoKnGBhQWN6LpUyYInQ"
+  "RDmMiRZDUA0szdwoctLFmRfRQDtrFjPX6oQ0DGVWnKcJhVFGHlgG2tCxpoKwEuZFCAMHcyxOKARW8RikYeR0cirPWYhaoehyGwNrCD0tmkEKHiFadCmEzTTN"
+  "BTeZ8+imiJmB4hqkEGRZC5ugcxgm01gTicXRUiM2LlwuAzBQiAhj1sRC7KqpWa2OFVUYBIMGMTq57ih2gkErJgZZWEpjheM5SVBookFToSuEMJNuq+Exyyhy"
+  "YFd6MEpGdBhBlRcZVVywqtgsymQN7NzICmd5oCnHaFDT4ZJaE4qiIpo0gugSVl1kEDJHq2agYuCYROvKFuG4LluL4wJnUxhipus2iGuMoAVBq2NNCCgLmRgv"
+  "RuEaQykjBGsKUwlZQ+dgXl2Etco1HoqIDObSHbG4KKxUZmk2VtoxFTuFMMIOShZDrBYTlSOInVEu8gyK0uCYmDtoCI2GWh3KBCXTyZDFXVEsUZFmmRxirpiy"
+  "geWNiwwK1lRkgsdQsShWLGQqC6aF8lIMiSgKk4vGykTRE0c0ZhehCNSxRRZnLoNUQ2OC49LAEgQEELxSGuSCNhbXWDoso1ZYWjdqKIuImTEx8JTSyuCCDOEY"
+  "ltMajNnQoJxgcbhoZqDQJdZGLIQQiWXQDL1AWYxymJtmICwITpVoJbjQm4hxVYSpwkR2YOFOYapEJbhZAys46GJwbtRIxChEqAXFaqDMLBXFmpmCrqIoSsUI"
+  "SVA5FjxVhkCMVYgqhLswGGNCa1S6KRuv2hh0hljH44wQoYeFmilwmhlTqRgIwShk8ayYDQM6tFQU87qAToYgKsilEMNhXcHUZTyP4UxFFecmYQSFoRwiaECr"
+  "qjAFFRhUtCpDxqARWl2skEEUjTXXCuVyTkRRLMWBI+AONVdX1ZrGU92JllluSAOGnoOs48S6i6ChEddglbsmRqNxVBDNEBcWA9awW7Uyk0oURZOBwmCNhUDN"
+  "ylrVMOk5RYJmzlTCgNNhdR1XnReTGg2hqWOWQgmhnBrQKD2HMZqatiFHhAQyc9ihy9y4ClQxjbxqXuB4iEe5iocGooxUKBqPYdA0nArNaqiqkQlPLYtRy0yo"
+  "o7YYqcIVQidmWElEdWHHiWN5U+chiB2nS5c4aDqXnTkHXBYLgzmDXmqUKrWoMIcYdj3PqFllHpdMXM3NKRvCjlDGsiiGcBkHFh0oMdcSQQGWRraskMVoYelM"
+  "8RS67ionokwtKNBwi6IuimFBcEMopjQY9FIsJTTWij2HFe1MhgIEVBt1WBe5FNiwmBkEVK0FWSjUgoLRKdcwDjSANWuIRV0PDMwFCh2KEdcISrOSC9EoDqOU"
+  "DSbMgQN2dImpMStWodLUREpoFCjLYdWoWJVMkwMOa6y53siskyvTgqoCDWcM7kRYgWRYMxTIKktXKI2BYpYVspUwCuJateBQgiAMLqLIiDrXWOGCjoalHNXU"
+  "gzDRE1dXtdB1iKx0hhZFW6YhoIBQAdWxBsW1gbqm0Yp5Diu4gLvMBMElg+F5FdKYscg4hTKKIRyA3VBwdCoqBWWiJmqiSExFELHCXkZ0q5thWOwOLiZrCgOt"
+  "pRY4IrQojtzAXepSFAJWcgeHa1xMZRWulKEAXrE61ALP9IS4gYI4BeMiQVMRdGaCIqIoHuG4MocUq0p2nLIWS0gTmigoMhxUnTnUtRw4U2Vw8DSzGjOjsALR"
+  "Wjw6Lhyj6RhYZLDSmkGInCawibN1YlwINdwsVBhjggMutVBRRhUWUQRaLmmGgwhWgQJDUBjTGUuzUUWuTtKG8iqOCyhkYA2Ziz06W0BPgcUJAqM6VpRSVTF1"
+  "ouNqamHVKFLWFLDA4KhQ5ogp3Bw6KFPTYhraWjjNYIeomDqVjFJFWVTWnORR4+p1dlyVDlePQpwQDl0262aZNQujHmQVVaPU2cposWY4FSAq4pABNKgJIzpZ"
+  "3GR5CEErqjeYWg3OZcqGpdJFDWeWDRSrlmmxoJuJKsVoopEFrksVkTPRsiiooSISWDFr5boQKUW5NOs1FCd4YlDTiCKU6xh5jmgZayIK8YBIMJU5rDWtwYTG"
+  "mJRChSeMVQpmdIM4g2dorKcpLUfMDFwM3OKuZadgS8lFrOpxMcEhgyrGyAJjiigIMhQvDISlKyqbWoUOc9NxNTiVsiPMLEHZBFEzMihijdB4XBFUCwijXkaY"
+  "KRuG2oo1mgVXDC2BIbg41bShlKHUMGgHhSyLy2oUS+cKNUqX5pyRFGqlZQdqssYanmGi0LbKSa1poOiVK4e6AxlmGpCGq2igqjrMY8yJVjDVcWWEnVA5NIvR"
+  "DdiwY1ea6ypz4goLZtMEjFdnG4xOM5sBExROqYfRC61QoalyyGDNaMakW5mwhsEIDksHGj0XDkvTTbQiZdkMC+E1DtJZFBHDKOZUSBVkBRWBguKlsaoUcmLC"
+  "NE1McLIYFSuxcxE71BLaCrWgVdTAMbrOVEqxZgMWJAxCHgRRGKO4wdhAoTVMVmjBgiurSriVzpSqazTUsKaOWcFBcUMTnjN2dWG2xDJV8OwMMeGhRBzEcOZ5"
+  "XVWLnZbKFISyKjuVQtnIzkQVRTRnkTVP1YjBFI2am4URHlMHCgbJMD0LXop1Bht27gYLsbpQLuWaWYRxkRF3IauwsQI3U1zNA+HUggpYVsdBJWJMcER77YLV"
+  "gTUWGGwFnuq5qhazsNBQg2VsYpCGckZU2BAwyuTVlQGjq7EAYugumFzSrImKIGRGLtWoi6BZTUWtBpdSY0BnDYc6XCZCqbOggRl4YQKNMCciLjqlAmVUizKo"
+  "Y42NCMysBkNHMOlZVc0ShhRD5GoMMqKFHQSMcEbVUB0icxfBnVg6NLN1SlmsHefFaDaVyCojHDytVFCvqdNhoVnX1JQ1oggNjohCFFaXs4uFguU5MlWKYRYj"
+  "WlDRCyPMGYZFnjUuY1hPFKuoXECBKUHVAjvB1bJyXKWVA+XOdBpi0KilMBXBAaU2BRuEhqp51BKWclmU5eq4GjIxKlQLThFBrLJUK4yudNwYpqB0pFnCHlGD"
+  "C5QiUIXRbuKYRdiAGVe5lMVpGKcgGkawFEfN00KtLofBzcpRcWY6ZlpyzSwUaerJK2dUlavJC92ASDR1TRx2dJdVDsYyqjswMtZZtAKPgrYEi0F08ATTdFNN"
+  "U1FEFVuksCzQ4Jp1nmhUYKZUrALGSmU0W4M68eTO6tQIjitUXqeF4NaAM4JZpDyjA0WIAhcJQqjGRWMWSR3YweJmkRUOTZE6SGU2pSau8hypqiBMoVZUGket"
+  "M9XS4LrMUTIvnTXDDAWkriMvlVs1NCFharpoHofJK+cRjYhKnYqalRcPmblw4CoUZiOsdjEr5WCmA1cj4JApoMIYIuqgkFenhdHJnCrICOpwgTHTcWgmqGZC"
+  "hqdYA5GFQ1alGkTHajbMog0GUbdo4jJZaVBODD3WoSuOg9dEY+TUs2RFlojSkFkrbgwablTNWxFOsTWBajkqNSRWs2p5iju4I8g0S6iqFEpFtDBjgglnnVha"
+  "qceMMmolYrWuFRqnUA2uqNdRM5GGlYVWg4tQQiHAMqvRBbeAsmfOlV0ZVKbE2jJIo1uknAVVQ9Z17qhmCId1swAJRkuzDFFDQbBqcWkacqlqhUfJApuZM+wm"
+  "ToVkTcJYgRunMMxYpRpP4TBm4OyqGuXWGxxwMOBqYzqumJJS0TqWxlhOckPLWc2sajjVtFzLJWpYhLkqRAYRlVEGs4awqeDZlolEg+eYg4hwIyaUjjg1kZWx"
+  "slo4YqAuVjuZatNNI2hkFiNM40So4mSEiIesDUKUiLCU4OKEKs0iiWJFMNaoZuGipBIUsTxZEToHalRmtRiVwzJaMOUU9aBUxDp2VECNjlW6jBGuLDQormiN"
+  "igHZsoMJNaKGUIbREYuYo2XTVSoyEOJ1ZhMrA53BQo1CsMmoYgcr2sgGTVZl6Nh5NOvFKJetnGiWCFaqqlRkUhVClcPAmRytMoPVlSYiFTeXoDmsGBcrhBMO"
+  "DtalWdCNs9IZAg2LzjJWUMzSoQa1TJuaYEKHWcapmqxyUKZ6w7JMVJiuYzrHiglxYUCNKLegHj3HFeIQCr1Cs+CGcGZaYyiE4DIEEVyrTRnBE2coVaZYYhm6"
+  "FGg4CjU52rKqQh0aDCN3KTqbqlJ5MluXYJl6phLBq+h6RIVQDQghhlCtiSOu5jalhiAv8Lo4tFxh45iiVMCGNcsVq4kODWpRlatgBWHVdeTRHWq4mWAWqNUt"
+  "SC0IFhxV6LjGkEGZMrSsQgcNRTlT4eJu4Bx2bGQti2tBJlEVieSAbuakjikYckw36oqGoMMqEzKGsTxWQcfMBaOFlkmDKzg38zIH1riG1sqtoJdpDrOFVUez"
+  "C0UQFGLN8YplspCKcJUyXRq5UZBQ5SZOFVKwqkxQEBTWJTKroMQxKrEiDA2jVFl6lFmh8hBMsatVbuAQCgK5C4UR1ISyFCZMEQSrccqBHa0GwzaZ3ayMC1Wr"
+  "aACLYM1CMTNrUAYPdbYoFWlQE+Sx6jQONFMakBl4ygzLqBCvw6yYRdF1KoM6NeXCcrdyG7UM5YQFBLpwIaSK41YQhEolBmEK1iysAdPIHgSNgTtDhLOxUWgh"
+  "dFVhbiPIGtgxaEWFowggk2lZmUnUtcLKKiKgpaAwWCZ6cWo5cheowQKjWGQ0jtdlHZbKQSelwYwyiomaWRyudjchC2hGRuVQXOSRSzNTW9x5nmY51FSxnumh"
+  "W5SyngUrraBVGOJmgZpNkZ3ZA6NkoomVFTRho0WGsStmokIHROUq68QIpSGsDhh5s2J1YFFmKKXCiGJTzQxFXBFCFOVxhQWV4lQwExt2CTi4CiJOrsJ03NwV"
+  "ruWS1VA1puZlqbK5zmCFgY1o2ABmHEtBdQijASmOWgYHQ6exhhHWtKAoW4wqNOuKxsysGGNZFoEyFQc38TZBpOBYqeVmKVIXCJPF4gJjNZG6nMqlmScoMq1l"
+  "sOJa1jLT4GiwZtIN5BKPgoSac1aVQbmC8RxZzkC7kBV6jQvPlSUkWkp5UWYEgYgyWKY2cOOqa1goc4kmgUU1Ksa0w8pmKmIIVbQKkqtAM2rVWh2x8AqlqNht"
+  "5sKUcBeiybyaYLloWjyWK2tW7DhsdNexC+OgdCrMMWKmQVW4GQiPWtcZFks3VlgXLgXXE7hMS5eMQcR5zMaIkCLLrJvGGyZnk+WoITPXUEVxLFMFRRVNpbEI"
+  "daPGFGVNM6KoRChaIFTGMFUitRoONGOVhaMM6gQqqds447JkgWO4AQcO1Lh6SeoZyVYvqBMMKesgDguxjuDECAUKjAdhVBFRGRYxKmgJiyeKaWaN8BCiKxCB"
+  "JQpXmEyZcJB1sJVyHTWOilaPEeJwiMDWneAwmGd206oxKZ3MQkETFlXEiixQdAqmoTy4WUR5FISVTGoEk+M0wtwxjSCUyqzUHlUGoqhqpgjLnYchgUqhWdfJ"
+  "ElZ5dK041VRZ2sAtw7SYEBaZUEfP9GSW02jWjRtMa0ysYe0sTj1aMhqrgGyPXlOiS5hhiKyklBPDCpNEA8eVhjVBy8I0LmtYtJDKgbWOodIIrul01sp6pswy"
+  "DK2q6QguoQnNjGC6SecNyzBraKyZKiKMLrJi0wp6DacQcsOiUpA6qDFTneUmQoyII+rGXsyhKlXDUIeYopFgFhaZKRWijOkaGlY0JSqzsjgubDlMs5BanMAg"
+  "hZp11dQOFgdxqts0FuTJatYoTo1O1jIVpTALmRcFzJoxcCOnCD2EzjhCE+NmAsWa0EzPhZHKhkOLjboaaRowRGTQhQw3wjrOmEUJ85CGQpQF3NBlIoS0YpXA"
+  "ocu6rrqIYMIMVSdS1MRBG+culV1tIginNDerbtxxGuhxMYWxccOlzjQU0WDUtTyLYyYWc+CoETujc4TBndVUM0oOYQaMMVgKVcHKMNVEQWyiK5GJy9CVcGmC"
+  "jWY4RZpNDDWUIKphcg0Z5opyWjWqmQVXnkVZrNd00SbKZVo6BoulWcdxRoSJ4rigUAg1RTEFDSwWcbratKOC5iyGAgtN1ogpy5wu8UwrVkoKZsSKpZwR9VLU"
+  "oVbK6GixSl2lnMYtoIIuTujMWZiYC1fDEKyJCmEgVKlEHrFaC7M0E5gQFNUgFIWYMVZ3szg6qmmkFudO6CrKc4iBy+o6UQxCwWB1joZyBSEuDhIH80rBcykK"
+  "Y4UINcEoFSCUXTYLDTiVKUVFMeegqlZ4sWxOYAQISrdymRyIE9oOUjOVQmiBZRi2i7KC4GpQUcGIrDELnrBBRliQgeVlFWJYltbBcEdY9AQXCjyLGkFk8bSs"
+  "lqm6iCpQXMhZKUghm0qwaSyng8LVmkuXVmHEFRxmYRWEo+gpRuZZZkMhoNhBS+FVSRVUkTNjRYzGijFYTmB1RjfHahWU6jhrLMVY6Ax79dRaKwgLqBJ2BmUR"
+  "I5gaiAEjsESPiuiBgRoVAkPPjCPAyFIQHpEJi6sVloMSwkyZVgcKYtGIjUrFhZCGkGgmG1IvcjeqqNAQRE0jXhiaSZPMymIiMhMOCdY5pTzHjDOCdd1UzIQM"
+  "IRq72lgWxmoxDmLMJuFuldFA4wYXk6sEjbGumTwosKuWY6SwMYaEtUELk6chzawpiskm1KqgCwaqpcxxESqwq+Y6FGKsA01ZEKGCLTEo5pqWUBxrVBAKsmRo"
+  "8KIqVjMwQrcqpisidFQxI9bMnFpYFSiVWVNNJubQMAoxIYyC5SQ0lrGJMVSrC0E3I6ShohYDnaysY5AZgdiEs0jaA1GYVo1BVWHUShotXGEhAeWGcWDYIEyL"
+  "hVIo7JRZhJUw4JSoWpfNNcI5oLsws0ooSruhDAg5i1BOY1pRFmaiY72a5pwNhQcvaYaJ41SIUKlp8cJFIBo2oSli7kIYTNc104x6HmIoDcFRLYVi5RYo1VzD"
+  "oNhEUOOwJghFdT3NQAdZC624FhuLXAxYsSljoseOkVMRnjDGMK2sy1BRHMVRbaeynliwshquTCcXxrAMyxpqC4xFNSenMcxxicPMiBkL1KiiKwjDoDg4C6eV"
+  "BjOVnEdnVTN78MayjYqyNAEGrGVxLi3URFCk2GQVLlFO7RQEYtCgYStrQjMPFcFFYjDN4pxWBi1vXBBMXjFYFFoYVoWwhFBHXhAPYWG2AQ1VhYxAMIUFSZeR"
+  "xTLTISZEkLNGcNLEK4sZaZqBqkEuo4aVmBswjWFCpqqCVWeBq7pBtZaGcBAiZSIOahSHpbsmogdRKr3SqcKpJrSAZRow9OiuTFaIhdBglNdo7hhYrkI5niJ0"
+  "ZcDWtIQMCoqRHTM5SRd0HFTVpCCW0QgRTJciEwVRkmOKSE0a6QxFDeXNVe2AcOO1xmDPoCIqSUfYCEajcV1yMpdWq6yAADJrqkHRCkVTHLfSqlBzgRSvTOlR"
+  "UxsuI1yEkeXAEQyihoqw9BBlroGGrBvClWlEMV2YVlMOMSg0VmY21rhZm0ExhqqgHMaQg7VYo7qyBYVOGEonAuuVU1wLSy11CCc4FKFpBB2AYMSgohY3ojtr"
+  "WCaP8jwZrGohXcXUlF3Wk6E6zNRAQVVVrDLUZg1mY1FwhAd5dFFCKxUQKULCs6AKTSckHBdxKDx2izMIjALE8cYQ65qONlVopcKAykTHLGKlZgPFFda5SETV"
+  "ShHNKRjB9eLUWdaFQrFGo7lV5jbRLDwRGixWFCcH61xPHVc4EMuSa1jHBst6Ith1lQKxq1UkaFZYYVMWDtQMZi0UWRHOBDFRg6qZwSY6U0WU8GSNU7KMDbDa"
+  "CDEI1eAhkNZMrNOwUKQoozMvMZUhJcwSblpOipm6ERrRGDPQiyY6HWgztFwwzEQpY1MU4YIqrqExXjkvGIKYcACMoJZu5hwQqVsutQoJZSPURYh59DCBK6ME"
+  "VrXKLEwMTSWMmOzMtQJrEcRNBuzA2mjYSE1RABWWoFyzWh2qgSojMrI4qhVOA025IjFWnMVVWegu7DIIiiaWNVwKcibEiCpV9lKB4rLIdQYnFZpZmWMIUQNt"
+  "HKrE06SymhVqZVVuo0aujkVlZsYooyLUhCLBVWmGkxDDiuzOGb1ZrEc06Fg4sUCMqBDLiQwzHadgQlUZnSxOELMizkSHVYeaDDIL1rCUUVfNk+FCabjF1gp6"
+  "5UQojAgJoeZhIhxTaVBvTlQVFiSrUV2IXIZOi1hbHrt6VMyICmgR5tABhTFFgx3GK2WGzmBqZFbKGAyXhDtG8ZQOcMeVIRRVghtqtMVpgjfIWdlVxmBCFDoW"
+  "tEJzQlqhioXCmiOrFsSOTSN0IYyMVmdCpjLWodZssazQrCmkbjBM1OoFq5gKXDa2akII6Sx4FqGgTRrPdNSqDGoMadjA9sDGSIm6GSinUJ2yTrFONIzJQmYq"
+  "EMGNCzYvgohOAbMSTBUVazpCrdI6axSOg5kJjswazhRZGYdgjRuKWmgFMbyBVoSALqIS82BZGgjVM5GlkOWgZsrBU2SERpeKjUxOW7dQBWZErNDUaCwOKBbW"
+  "XDAqwhQvYkwv6BQNKpVFnMJoojWBoDt1RDxQnMpGGKaFcVGmVDkIUWgEbkpMS5hqMQFBmEprGaKIWdGxGjRT3ihPi7maVYaIK+iozCqMs0tsVKrEUTGEZRGZ"
+  "8ChzoutYUGhWgNkOMFetlLnM6hxEXIioCSYUmhmD4xhwAr3GGgNRMTll9MC6AVHQgVuETscgHmfRZmmaBqZqNIOVQRCtMqxVqYdF7NhBHiyUG4WqCCZ205Cm"
+  "02qqAkGLHsYQYTo2jdnQRAOOceehdqDJ4TI4oEbLIeVgwZJFHASOMEKsgqkQqtWUhT2oVhezhTkvVFHQaVAWFdvULEIt4FpXBgyzEGMOToNUlGmqWFAxcRaX"
+  "juKCRidEDlhBhVfQW1148DBGS0whTueY5cJlNWKxzaI2seAqjRFTDTQ1kFmoSEOzKRPEYtFA9TJQygg7oqpqqjS5YhfItCwEnCIjmBVPoFw1HOG4GiPPhsBI"
+  "c7MOyQStk1OanaLQESwu7BhTYyBTIIyyYVPFC6cUqpC5GUWVJTiMFWJxpaCWIIyEoGbBUDVMYzkF6NRQkCFwy5KmmlCWGSsOQo0pzJQqHLfCXVgMk2FFVAUj"
+  "Yj1qrdV2jmcQY6ChliHPQSzCiguLlONNS9eyiaBYZajMsSLOwwjUlBF0M6pCHS2HK8go02ShjksEtQw1ZqtR1mSOTOO5FhVaiDmqDC2kMZxC8xrMgWt6MshM"
+  "DGYGszJMwhDCE+gl3KCUAYdSc9QGjInCnKjOzkqjRBqhaYYuWKqxjkgrUZbEi0ABFiNPKUs0rFPL85CFyqxmosYYFbWAC9Yo5dzQIkivWmSvgjONqWawoCxU"
+  "QLPGhRkzpmkxYKOmYpeZHlTCRDo3rogiCAgWNFzMRBiXWFVGHDhaoKMq5qzJNc2OMQTAAiNj4YLAEWFXA+cFtaRBkQvC01RKE2tRZpkMpcWoQMQSLbyaFYfU"
+  "4NCAkGUOBb2GYCBqqD3L8txxVRMhIhpHmCNbChxX4ypqKraFQ1NjGVaMXFktK7oUUdh4EhxMYVCtRoRORAgOWwahmxVOHGqWmaYNIWpuVSKCZhM1mmQGW6Cx"
+  "YOTCjUDXChKNViyuJZZZnmpkMuRg4LaEkAUTEII5iBA3XJBpRMfRGamiyiAuMGs5XTkozhAXdOBNJKiyKjyVEVzK2cCl8AwqZt2wsbJS3AQVJdiMS2dq4RKU"
+  "FuepcSPCHDpV7KSUK9hhhEA5okpEBlXC7JxtnaClqecGhOsGsjZTnhmKWIo5VJ1Q0xIvFtN1VV0pokEQCrEumzmYligUBU01FOsZScXRclHI8EAUU1KKhjcv"
+  "xIwSaAqxSrsUiygnQRCGpWJUpSILoaEtmYxio2hZiAOn6UwIBh0KgedGBU1kbkwLrOmm7hoYCwQqKCWMETq5phONogJXC4cM8gTCTLiJoTi7IzJNhKsURGiZ"
+  "aiwWy1BYq2OJhiwwVqxBhZPEkwgZgYKR3ka1WTEuwqTUsqA588ixhKcUc0O4pjbRiskJNSqUs+pyZSASqiVasOJm0UK0SheSUFvNReDRWR0sohHUGsxwGqZh"
+  "yBIFMjB5ANPGFFUT1CikIGcwUNKMRgmlYuRSLh24HpU17orSBFGP5qTMWSiCqww2cKx6HQ3HCD1Po5tFrknMDU1V7MrGjJmKdUMTix3QhecqDaGUYynLCFWr"
+  "HpzBcBmuMlI1g9XAolYaoooRhLFMiGBRpgYjhFwWCQSttlYFkeViCkLNTgMaDMJ4qoWpNA1xiwIPcVWDqkwvY6g5TQZjUUoH8+IQqZZZMEMoK7Fghtdg9eSK"
+  "KIYliubBnRADQIYsWLpWHMNiQ5KKAl3TKjykymAIjEALQjmVw0SNsWgINDjapZoZLFU5pGELnEZ3phKwqtBB1gQOUQSCMs0IoZwoJZJwbqQhWGVFBEU1ozlX"
+  "3pAqVcU4HCIWWzCPNd2QDrLAcuchrOXJbhCKqAaVzmqYgpdhbVaHq6i4AlFZzVSjEDO4RhrBK90IDGnIMwHTEFsUWecxLjcXjhsrRFSnGQal4BSB68TF4RQr"
+  "XIYshSFPK8GyMqlVS51OGOt0HciZ1ThsKaHMjbKKjaJZK+MuGEKUMChYGFyhhKrOtZxVTkUwil3MCqiAVQURRTbTIhp6VMdS1AaNIigSIdIVgRzIkuFwrjDF"
+  "MMRhCIMKpRyVTh1XERpvWOQwXKUVmDWq4JaVWxSDHmuUlcuZqylrnNgRZWnBKD2ComVNHTZRobI6MAl1qIWyipC6czR6c2paGqEE8YgUMzc56iKIEERjhOpQ"
+  "C0OIZVxLVRoRxKIZ5sBODVy4oQkTFUXZrIfBKSNjRBjMXKEonuoi7rxkUzSrAstm00w4GtdQjjB1ZRrEjcc5xejULDvIkVOsCNwRBDtRQhbREbOaYuEEAgxq"
+  "iYnCnTtRZizOStRQNGMVC7qGWdk1ckfPWAW6zmCNqybDFAJFdVcOmaIhwYJNHKLYgStRRedZNKHIc5ZFVAPRTUVDa6wKY1uLXbjIWFREzeRBo5rOxdwsmKma"
+  "Q1EQshKtGVFH1FCUKhctlcFGbrnOczU4RJAZlDO2NCFzgFdUHNYxJso4ZmoPcoyy6wQTK0HR2GSUwQRlgtcoqCeCDIJgDuWOi4oqYxdrckmTGJZGmjkaZS0X"
+  "DesxJOpAsee5VjBBEFya0BROKxbLNedITAPOKhcYNRNR8zIKiwx3ZqxmHCbDlOFNTtyR80KOLtZ4BmlCaCNQRAFDcJ1plcfBYS3OWMI4nixMpUY3tCx6U2Qq"
+  "XCuM0MjVqgq5YTa5tSlowoJoGeW6oIykxAonCMyQGYeOnhqnolZW8xgO6kC7DYyKQrTJE2gWzoIM7BRYWAWudNEt1lKzq1ZR3lwRRreOpgVOyRIKprAYUTgw"
+  "CZgVE6wpU110Cgtxg+DIYI2YmknQmkCkUByujSPTE1fHq2eok6ZRTelscDCh7MrBqBIY7gqnEJxG6gYNWmeqKjQ1moWIgkoQjGPEzVwmdNdQ4Fh6xQK5FlUP"
+  "1YKF0IBYSGhZE8xxATGwFISIkCXLdbCqTIlwM1e5MxU3Ys3CpMM2KJqIZbw0Cx3I4mKMRKghyeCiSAcZCpJMRhi6UTgNrKtpcuu1NAatQzbBYqlwRQJxVAlH"
+  "owKKi13GUJSKBUeU3uQ0E0x0RQChDgzWlOmlYRowisuAsiCE1ThBjDGt41AolgmZJkLMFUYNjiiZXc1S4ZiVFOyiCeZkgWBBEJpR3sgMKZMoXCsIoZx2YkMZ"
+  "6Tw3pTk1BlNUbQRFtBal1DoMjVMtoJd60IbMntIasZh4HgTOFGcqCChUqTCGYjhsKSOs8LDJWONRM1IKpdihcsfSqTY78oaQtbgwFVhGluU6QjKttRiPYF2F"
+  "gjMLUpQZFqiadZNBIqLJMYfAhLE6ago3wzpthKqigjxMqFoY0iwGrDymjiGqI2rMRQgWUDxlYLckoSh4Q9fBoSOPq5Z4qDyUE8ogjSsxxEYJKdVIK1h5XdMR"
+  "FIu6SWetVFSIjeZS8OiCaJBCcRoYGqOFokgFAtFRpccxXbgK4tjJgqwFxDyWaOVqDVKuQuoAy6ipFq1FLmpFlQsmnOm5EDjA8UrBneKgRKSUISgLYkF2mwNo"
+  "6QiNCsay3IoIpYIgHYUJqjazEW2MbhyKQbiwyOCGFgfV9Jx6DDO67MwaWmdBE1RsI7iIVcQyMLQkLJRqQhNXqFiZotIuWjUFtj1uiqDAUw0vHI2B0QQ5yQSh"
+  "0JqJoqOiEFEGLh2ugwJvHsXYisBQhoh5cAmP5dxQERiWTeOaiCeYtSg4yIJaQbFmVRMKY6lwmmY5aroJHdZR1DwoBUFGXq1STOFoi4k4iNrVyxYOAl1YTtFl"
+  "tEdMRoQQaoRMYWws8YpuWyzLNC1wdRk59RIZo9CsIqC4lsXODAQvFUW71VLWswYqguEOrEBw1pB0qMYaVui4AxOLLpbUKdM1KibPlQlWcrMh0NKgCuB11IaB"
+  "CdeFC1XDVRUzEFZqzpZFMVxmVolZw4zQ8VIF8VhjjqyZhiDLAptlmEWEa2hiXjGpK0FT1GSFnQsLTSM6nKByXm0umVkWURHWWOghGawtshNhjQsNAucWQihC"
+  "gzFZHj0oMMOJhsyxDB1YtWwKtVoug4eVrlgZBicLwpTaqwCUcFWKYYRZ4SClXkUFois44ExBaMQYCzTQAmTQmUdHq4nStVxQ9cxqKeiUEuoJ7GhZFKtMoNa4"
+  "ROOWppEV01SVFR2aaozAGOeFzTDEogtaWbgudE3CWBQjqlu6a8zSQbzJXinXUBmiMgMGQyoWxVIxCUJoSbOAjamN4tTJxRTBIwQFHVURCcGZhQeVAlMiRYll"
+  "4bJwceMKmgNN9eoaaIxoIYQS8hAFrEzKQuqiglEYFAjRpjJVdGEEXdgO9Mw4MhFUoNxVGuUKXpBmRhLVE4RS1ooSpgtRcVEz4WhFUxbWmKLUTBlRI9Sk84Sq"
+  "WdZ47EqxGJaxszyiHQRiVWcozOyBnlCNsBpCEOo6jLVC1RYYalhvcZcuipiO0VQ3pTiQseQRpmmYHLOEnRLVolh0lTmkC1GjRmdyhEEXZQW7a4TCwlRkER2v"
+  "DoR1MixWpTAkoOk1c7KUXgzPBMGwjGWiE+ApnQavCu1odWqIWGjB7DQHiEKVFtAYJZjVwtKaDuQYClXBoQNO4Dq4hjgqIgjHVIpSpOKy9lCXCkt1UFwpFsq6"
+  "i8uGmgA3RlhM7mjPmZWaimAxZq1oLAV6mpVCozyXGCEkQkeIcjilaZZ6ZWqQkMHSo+xFjAqZyDCMcDXCMaaKCJGCmSEqRbDOcowAjFILjDtqHCiqw6RMLAUz"
+  "GGvTbNSRQ1BQgLVwJiiExswuIIqAFlwmTAXFaWDM5TLRSKXKHEMUVArNo5YVdDZhqkA3Ztc0CEyDTR02DgPP1epC8CxQ2RyEUOqCqSaLERYXmkJxQifQojyu"
+  "TqMOK7LBAj2FUDgIFIMM9MBRXlHIGBsWSykKFuwKg6iUSAFmUSkFzsxCoUChIQe4dCnDVDMUslxwc1CMA1dOXE0vqYvFaOBZDbXAbKBhKmEhHgt1tUrBmKtO"
+  "bLaSmZ1B5pxGYzMFQo2VGCuWFbTEtTxhgqaCxMrR9QqCE9xG40ShUOlUXmEEVjRbiAJqjTuzaSaMmTU40dCUGia6TKPEdCk3c+qms5ClisaUYaNqhRCYBZWN"
+  "EIyslOUG7CTThBnHkKdwhWYoMpoUATUqqAW6MgKOrhsPHrXSi+cMGEMrtAtZQ0iZMlEVhdK5aAbTrhfRNWfG8gyGpVzSTd0gkSwwmqemniXH4OCCXRfKo+mh"
+  "q9gYWUSFHlIHpleVVbma8GZGSu0UCWIYtBpCkCm08hwzjhNmSrAMCyGmGlevsLp6MDxro1gQmltqBF3LnbMKM9hlYSmOrFk3njWzS42OmIFZcER1husuMdXO"
+  "QzVHSyxSkJHKqsDCQ8wOhFhWc8yGXjmFqQmxxagY1TQMo+ooYma27DKm8DyhEAKnmRZzlleYMCfSSh1mFA2mUT1IVmXMKNJQRAyY6oiYqteOilE0UIRAbtdZ"
+  "taamGIeFXikmDFWvoWrKdI3RVKOyXVSj8hzZozPLSAYFpkPUhLDQxMRxhahQMJVtYGqlRtlRFqqmQJAagqmNahCXISynNMqAYgQ20CaUnjaIXSOqMpvRbMR4"
+  "NQSrXFlxoWtVoOqhpliHQaNB8IAFslLUKuPJYcKVLmMZgyYGGRoNMRvUU2ZmZiGOGcWaWYiwmVIu9RBjqee4yWAOc6kUqbqacNkp1CiXKpQhVqmJKBhGWlaX"
+  "pchyqznGWzSLYh0zXDmIslY2A1e5ceSVjTzA1hQ0LMJmqwfZVElOxRSVwVLWo1a4SiGmgOulk6FoC1JnE1wEa0aRVraaFjSNZWbWdKMsrmGkFmQNZZE5SC00"
+  "WlnFcB0KbkpUqzCWcj0rmohFRbexRTnLKeqyhLtoMAcGFteY3hRVbpy5diyOMmbNWgRBDTdznLCFQaJSTpUy7iwLaqZRUE3Ro0UQKSFsBs0qdAgrMTrCLR3W"
+  "DZxS8GSB8AwOM+IicEPEGQTB8Jw0Fgo2DJEpMoeiIxynqzoQcwqnNGOuRKd1YCOoMNYM8lK5aSZsDmmWlAhnggw5i6IUmgFiAcdmGCwLpqiA0SJ4zMrME+Ih"
+  "KR3FpEorbTOkcVCBdTnWcybI0GzGCqMUcKBR8GKjRCgUZhp6layOjpoK2kAiszBiaLgOblhISNFAZCpu1CJKsFwsothBY6MiHjGbK9W0E4KVYzrKKBwXgaXI"
+  "a4SBLSvLstpVDBYRq1gh9IrGgkLD5dAKgxXLtTAPq+fAWu2uIIoJjMMuiGeXjgeXQZeu6IgRgxJCWiNG68IOYTlFTmMI8RRnLBaWQlFxkFtkAhtTHBEJxtyo"
+  "m9KUHY2gRBoKHoh2ERYjNMeEC6pQDhF6nFKHUxSiMposa0QnBaewZQpONVKnmebRLGQNhpvUsxIo6Ch0tCNTjhHTcysI9BiwMliTiYZEGbYgKebAMC2kHCti"
+  "9SKXQtmBTlWtiOfAzqLGceKhQgArKghlosBQ8Rh0ZuCgHqQ5EKUQxWCigxkjarQajkhFA8XB8SyrbbSARsRZY2SkE1hTDFXUSBjPGaypdJChM2u47IIi6gyX"
+  "NkFPabplaqY4QWhqdKOoXilMSNdlHENFTGYVHsqOsxqtiwuDsLuGNWpxEaISopnK6ihCE2phDGtQAwdTM2R06ciK3RxjXaEtJc3KYxkUA2g2ssZS6EIwAFdR"
+  "nIgOLJsJIqoqJoQgIhzQRSAPFj3UWKM0BGelXLWp8ogWbdiwadyJKLEU1jiLMY0KgYvAhSaYimPUQWhRDFV6XqMIHmaPwUIXM4WIGjBWakeoiyLTFKrBTTEE"
+  "SSPIVOiwo+OOgihTUGM2SgQt7hp0KMbQHWJ4ojw2KS1MYbCpoKOsVFYoXJpyFdUpDtV4UdJpFAV1HmUWdCwT44AyskDHYoRRoQJDU+MynCfCIypXoCt682ax"
+  "UpmFEcVOWTeCRJSyRaBsTSkSdGoRIZZO8byG8MxqgmUxSJi6WixXUGZPqkFz7BBBTjLRq8B5syALdD1CS+pR5dB0pS2MdGc4FhaKwyyHhoWUiuJwwKBRQSoy"
+  "yLwIJaKiIkZTNC3LKxusciaiG8WEWxykogoz9WCRHEqRIGZRyDitqic0oCa4dLkiXRfHc9UAnbYqmkCDWD1NRrnCdYkV9OoptOhEjTqnglHDjLNoXhcujkYz"
+  "mqCoWAqvC8FZ2YSVmVzPZdktoiqXDAgWaspuc9kQFk1rWEmrLaYVoWyUNUuZcjWZ9eZgKB1WHuZNEBQIzIjOghGvKguinlBnEhZDiBmWKriF5WJ3ZcAoRBlT"
+  "gwdFLtuFcYM4NdQoFmcqcTkqnIiUqAnXC8KqAVWorMY55Sp6qEw1HDsvY6mhK+ixY8HIUC1o4dCpXTHKUTHLMGihMT1x5hqwGIcRQuNqHpxV5TR2YucwioNB"
+  "9Dgjyzy5Q2WUKFJ2FCiAcKPVpdAYQBAlleJCJiiD4SwqKwZNsAaqlBkrYQpzi0UP1Cg4MMZAIORYi7csVtNa6MIRMUE1yFIhHerIClJkzWbQkuMsUxfP4BzU"
+  "UDW4chV18kov2jQsquLCjGDKozx2IgpYhbx5dMewMaKxglvCcS2XKcepLlJrYhq6KwYHQxomTqMombmiUccuGSbXEaKAEkihQ4TOkToqpsKxihyGKjWYpb1o"
+  "VrIUa+i5quAqiGLB8EAFCgdhspyKiad1cmEo8raIC4MQQjpnUGHIMEyUlOnMUtJNa1BQLDLVC5gKLpUu6DCMo4yKCmpQDWJZWcfOc2Q1HKeZ6oiuk1NkI7ww"
+  "YodmdcrBXVFxVgkKnRBMQQMiguB5qDHTlGEhWOeImhzObBgWshLPYmfBCjhQwQTTYjnXpkuN3qLSDFJMozhrBVshMOoUgwXHnqp1DpiqjoxGMVeEnlZCqbyo"
+  "gSAmhilWoKpUExxlszhRzGCtlkcjdFplMBSEpTxQLZSyC22qQifKIcJ06IxmJqI6KJopUEx5C2RV8lwiMBa4IDoKsgYFVTiYTDmljRWwYdlwnYUGJoSIFmLO"
+  "AYsyBIdQXBFzVSwFCS0EhkRZ0CqWU2fVyzJBgybCgzxi7EAqHWcYYtEhZZUZbDgaNm0QYYlYrjFRQOiiiFYuTBZKgdESq1EIcqnOhjJCEDrFGZEFlMsWHKiw"
+  "SayBq1FRqLNqqUEVbsZADNbJQ4QqFgXIminQITymniNjbKpai0uZw+CMS1mvahqmcUIXgRZHhIcyxdS5hBcLoezFC2jRkxV4oMBYFWtU8ZYRmZai0bqMqiZi"
+  "XgilkzV6UVNlgjh2LGMm2uqI5tC5lgV68ARRTjcuDUgQ9YYCG0CRFo0FKYeI0MaSKCUFQbYoI0SVazwxVmMxgcWGcdN04tpFLQmz8ggzGGkh4EyDSTBhCGVC"
+  "dJPRcRqV8WSZhgIrai0XWQyW9jZEhQYvY4diVDAFHCJQxFDQQla47IrC7gS5hNiB5ghU01LTI8YRIcrISBU4ZKDIjBZ3sxLIY6cKW8Uhi0osS8oUncVmNTQ0"
+  "xgo1XW0nrll1IZamaGDUKKMmqBOraOS1EiiYWlk6bkDUcDbFlBevMyh4LCOuSEAjllsKWh0LCk2kpth0jtFNHIqFrcUQA62NmRZ0RYp6MCgoqicIaRilm2Ei"
+  "ayCa08B0LJbBM4WlpRmFZdZUq2pEDkNjXUdHWCNZbE2zTp2CS1ehQScH6gyOCIiBiTavaGhYS90MrGrK60IEU1MIVJUpM8GankxTVmLClIU1RiDHWCzHQWqG"
+  "WbJgdSBC1VI1RpQE4ziAMQJaZciW8lAhi8pizaY4NOhEGODGpeWOWjx2CMHSRYpqNpdugraYalYhwloLJYZo3TIIkjPTS1QITEZQQkYxWlpwCpYqpeFEtkJU"
+  "nmDOgoWIaVgtWenCgQDZQ4wgEKKCaEwwVFe7U1RhBkdixspZkeN1DYiKZY2hY6cqM+WsG0QsFEqnqDJqMoLFzBxaU8p4MyxGWtZhnrUIgzImSpOYMJ0ihFGv"
+  "WlSLHNs0CEobCgaDLt0xCwxpFoEqRVmTndd1YWhUxbB4jaiqKzFXjVMZC1SnAq3Ic0bLsFbCzQRn1dzFBN1k6+SqFcUpC2KwUGWpmBHTLBGuLlaiKztlqkNz"
+  "RqpqMrpuDA2DUwaObGC4Y+WqUNWYKlKYaei0rsGQnlKWCASaWJFU3KhqYTkLitWx2CTHrYa4EYuxMz2Z2til2siy8ywXTAfOVRWDYsEIsWwQa4gBkeHBsEDP"
+  "GJOJWJUy1iBKGS1oCrvCIkTBC7VQIBhzSCNzhLgQoMMMglFYEBa5C+tFTgSOVTWFDAbHMISm3NjIwcRYZgiDbi2PorzVsVB2azUqwwp6IcQ1nSizoSmnnSNY"
+  "JqxGaWoCkufCMtFpMIbKwrh0jBAsrqcEK4RiAusyE8FGMTMgMEQMDEjLDIIJsUIhE9ZRSFKHxsqgVgzFGguBZQe6TlE3UBo0qZxCozLDiyJvoucSImQ6U5ai"
+  "WgO6VMnK8xoZdrhMpUcwFjhlceXRRMwa3sIaiBGLjqwxQx1D1QrZm2p0chqLGAtMoDZoWeGC6QJ5bGgPBKMF5tDVaNYQpr1CFsGGoppBDYNo1MrFXZhJoaBy"
+  "8ByvWiByYKoMwbZai+BgDD2xJsawQmeJmhWzBS3LoZqE0epw7lCOptVlEIqiCJGUHpSiWQUnMo2sapYSdbGy4zLPgarBnBN0dDOPQdOGGtEo61yMIszVFoPG"
+  "sBbOKAVtENjVMdxSYeY1HGTBca1YEzOFGdMIC1o1whDKCkELgoVKhuEqxZRMSVNlROPQWkLHWeHOMFOjltWWi5XV0GpZtZYhahZ4mjZCYDZzMCxm9GTN5KRm"
+  "Gls2CFyVMhFNFsF0LjNphEV1DQvLkeg5CBEXidyQSkAQQqtBcSePAydDQ8yh7pBApky48OqMgMSGRSOaEapNpm3OMEtk81gNMChjKURltBUkYBXLUCaUQhHW"
+  "hiokMzqCHFjTdB1ZTCNCtApSKFOvYdeBCgI2LisObFyZjgWXoLmw9BoNIWImGkclECZmNOGGSBFzo4KYU7CaE8w0XTFwyNRpldlRhhqBxWpWHMZ1cYR4oJAF"
+  "Wp1lQREsMOeJNaYo6uDGEKKFqzEVZjVQw6zCXAY1oMWqRVGHazrL0TBkJuS6llVpXQFRChrI1ZiKUdZV6ToBWaaOSBpz0JSBM1cTGlgHi0ZjWU01HpTAlRsz"
+  "4tQxKO1pDUHHmgwiyGqooQV2VRiUimEZdTO2Mp0IIkSLZTxRZRy6lplVDEGUWEXEGFvHxBibq5nFVkVxCtx0GIEJKgLD4ggjQTSIckOj0Cq2ZpDUolNRI7jM"
+  "GuoNqkuZKtKowSBrhVVVYBgiTuUKWyAKUKxhoGMucsPQMhKrg1lztDprKpUY6ujMgjCXWZex5Eo3RJFB2OzQilrUnCGrIQRiFqIMU73SyIiydLmlcxOIUYMO"
+  "DYSaEa0udSw4LMwoG6OYKhcb0UgHRgxSJUIvbSqacQMLg2x2GgLDQxTI8NzQcKpOgxFi0aKtTFPMogwPYRlqcz3VTRQ6sifP7DgZq4yaRVESQ2YYqjmVpjqX"
+  "lVGxsYaCYMAgatxNcao1zFxoBixaMSyaQ12EA8E6RhBrUE1hcqnALGg2VWiETa3GHGstrNQwhWDWEKVgsGqioRcMDBjBS0EQClxYNS1FVDZ2CQOhdKNyNOXI"
+  "jlkPglIKy8LI9VI3FiZwhkWlgYqByCZsCFILYSpOguCabCI3tKh4Qa2Gg9iZC4w5AsOsAQUH8uJ2NaqxijBLtOBxIqzGA2tEUDkXGgIjoBEOYUeB5qDAWrEK"
+  "CDwpoDCQHUSxk0NRXBiCVqcOXtFGcbRQoCcKzsqKmkdrYAgisBoQCx2tQZgGHpMhDSEUjIvZgwhFK2ooWVSkZUFooiOns5A5rSAoY+OJSeNEUSgwDRt3cD2l"
+  "EVIPqRkQ8rhmoqemahimRlmKyzo0CAdR8OCBTBSZSdCIRtbBQlV2wqa53jBopOAyAo0M5TgrhaE4kTNEgzUXmSMNWqrVZJgao+Kx6RJGJkxXy2oV0hpQJSKw"
+  "4mjB6GxRGYY4g+JICBc04VBGVBqX88YAsmK5mpsNsRpmcDKhCONaKE3ANCY4VF1Y1FpizuJopmFlJqGm6FyqMQbDUzfV0KBGUWalYZEmbKA4g5JyLYxqc8FQ"
+  "Qy2MI0LB4urBDFxhZTVBdWNCzeIgyIIpNENRqLKqoziN05Q6qOdZEWYhQlwvHq10XjNCYD2z66yyNLjGRLCGQtmMXBiYIVZhrrkyW800HQYZhq2ZVSjWISbC"
+  "KWfVmqAMaYgViAHO29IU65pqE8qahAG7cFKXhVkIxSyLhWa52FBxFmcLUNjARjB0HRaNctipiNx0Usaq1TIrozPDVOl0FqIYrIlsldXYLtJFkFYHlsUOVijX"
+  "6BoVpotYkKNwAYWmscqF4jJRU6SOw0oMVrDQI7BoUQaaBUdU6UrUg2rEDeOhjBtRVGoU7gyNiqYSWNmhLIYGU5zNRKGA47Ri8uCm4urGKDd3k0uvilS5nDlY"
+  "WN1NGFMZSr046laHVmusdFchmAkRHTs6LgU7ccIRcQemcKeJqulhA6jOc6JgBpGCFUxoKrs56jjFJQTRo+QsM+hSHR0hXlDOoEekjGA5Gh1hqFjF0RBOWoW2"
+  "yxQQiTrWirnCHDyurMMIRhxaYNEQdIysmVwxjuIQpkbRUQktnop6q11rcRAsUjAYYiPOQrOGodC580wFq0FAM0ozC7PKZjS6XcwOi8VCHOFMiyavSVCKcNzR"
+  "LJhwpZXRaDx0o7By4qjRMxzKazQaoxxDoKdOLFjEQiNEq1shbFMObFy6FkRVqGWNhAVPS8WBsAZ1oVcF3Qw1cC0vUBi68gzNCysqnKHNbEZDReyMSKdqJWdC"
+  "y6AI7GBNnldWZUAwEEuxato5lZGFVmAFnlYjcmiCgStO0zBMrR0jbpCKRLMUJpyJHVSX8GRpdECsVi0rXmdBRY2YFgaVMMSZgePV6hRoUKgIAg1rYQwTm6wx"
+  "hIlSDkVhUTUR6qIZxRSlcORm7OiJcqgtTiNqqEyEqrFwmBoLo1zKYEwFyjhVRmZP9DLHcNyiieXFrBCwEIYgGlgqpavUAstQZjAKtTUkq4c0riB4xpqOUeZM"
+  "66BYU6SiQcMh7OrQo1V5NM26wczBHay4szBaRS3QqSjHzWA50CizaryxICKoo0YHhZVhlMZ1VTlYQkdBRsAaKjcYKlyHjiASVDyUVRGjK1pBC03RHTKzpgqX"
+  "tcoYZQVBDGukqC0EoUXCUGaFXqFYLRQYjRqLS4XVUuIG88BihConE0VXdRpQKNQojWhrcgqliDPLUBCF6Ai3kRUa1SIrCCB6KqyaqbwFCjRWgQV1KSrUBFFk"
+  "cDkXkVPViBgDXWbFRsRQ1UpTM42OqDHLLLOmYSbCAZ1qViHYSDnUE7G4CxXXA+uiDU2DmYmNRod4JcUhwuaB5mSaCAfVAddNcJSkVGGstZbGEBGLMl3Tagoq"
+  "8pSx5jzLQVEwNWNxTCfAgkc3FVGBBsMwiVeEJkIwcDiVzQxBXMrKGeQI0cYpWNPJhqiZMsRKTDDR6xwKgppVGUY0ICXMrBnadaFUnMEI9OgGNoVRQYipCOKg"
+  "QucGypqJocFZ4yaoglNaDYVaEbJBmJUQnRGunJYV0AzDJda5KU0IGd0uTtxgckUuoYFiTbPU4pwioblSjtWMYyAkxBxHU5N1i2JWjBVTJkVZQRW4m0x5HWZZ"
+  "GJaVNWUx5eQFHSVmoCwXU4hCEZbRUcdoUIiOgsPaGqGmRDOk5ETBKDEXjApuhGwRZlqwMjiklhdQLhVBo9aVcgmFQ4ZhlalEYQ1qGDuEdKqBaLaAal1mS+Es"
+  "hjpG7MTCM5EAIhQiVbpOSzFqaONSjegUKQc5ECOv0eRZVRqKTt3IE+mAsszAWTGqcLzMIrqCURoPjFJHG2qO0FJhNGY2MgyDrsp1qGZYDYbM1SgvU1VRwSBI"
+  "3BzVA6CmgwrTXRopg0hxsJjaIsJxrosJihZ0JWYlRhykmWBQZuJxFlEhIEIJLmUUY5pOWeN0yShEImRhVSqkWjqoVAqaiiOqnCHTgWKB9dxYo7BVIWItZoOp"
+  "aVwNDYLJmJVOjVGMQWQ0iNO4KSyXSufQYaowk+Oa0ag6wkSzpFHW6uIh3ShsoqfZtOKqjBPKhqdmUKAFgkNsYpqMGiGncRZHWmEZS2A57rA0xowBEaphdC2U"
+  "ZiMsSlkaMcbAHGUwJuIWcxqDXggK1SqqSgbTYddScA3GyyCEmgJac8V6M2pNoyBinUkvqAiXM4JV9ZqORtlq5GI0WInMW13WEMQ0DDaUYhgYNFRHqyCkClU5"
+  "ToFymDILjWHNokc3nDOoQudGptowKmc5VDgELgNbK0SIaIhl3ArCDApHaYVlsKqGJizY6lxOckyLg1G5qxwqKEiOFBxiStmh5TqXlacVxGCNjZXFGhVPEJwF"
+  "MuIVqhtwHYNwWV2yshZojhdXFrDUbBCNNjsY7GgxY+S5qdEVY2MhqxVaXhmoAhzE9AqiMRYhJhxZUTAKquomqickoMNa4TCFY6miqCIHs8ygSmpNg7HFhVMJ"
+  "axSHauxiIuY4sEIFYCuasUqjaxMkKKGhENhBwjoI9kQTRDzDNB2BmTVBLBgo2sbJkVmV8YrYdcMKxlSUMR11IIQaQWDRHV3UgWKVUqUYIqgwDtU42yR3S4JE"
+  "FFeFcMeKURqESh0jHVTWkBU4neSphkNsJSiWQI2lcaFhwphyGBJolbUBmg063EoohbqVosUpaIRANGc2oyyLM1uDRRAVQ5U1FiDEIOgaY4cRTjQr2EoUAUG5"
+  "dKZGGqwYYk3AwsZNc8FwM1XQUkBUhek44OIoBdNQq2swVukYARchSlVTkEWlmUB1kBeUpZGOgkqhihU3zkSPMjFZkg11E5haTKmyMcupAVuigTIqS+TCFj1Y"
+  "IkQVsQYYruVUjEjD4bxGaZ2qjCM4GELByeKaG1diwjAOkUF20VBMZgwlRW24o2ewdGlqhsFRWZiGcFaAVlerWRg0GGRSCjKuIg2BTqE2WTyijUDL42QtHGcx"
+  "hEhTFlqFkzFZW0EPhqFqVVNFqQExkRgYWjrQWVJZqyeoIipQpWYtY4PCkwMXbsZFGUyUSRBF6VgkpazByUTIkWkOBQWsLJvUECjTQ6TC2pBlo5XAnehw4qoh"
+  "8OhigjELlihTWBi6FBWVq8WFFtlYGGY0RTPXpihOUQnGogw6losoddAggWA1NISMsqwGM9etWCfXU8ZYmIMoSEhYzTJo5kDOZQqzgxMrAm146kCzZVy46GS4"
+  "47DYYxPB6JQhbpaGqpW5FiakszLLUV0iDZgGXLGkjhFzFtRZWGUVJqQZDguGQhZVqwyX4TAw1ow1MTt3BmyFbiqjYlAKRTNii8OF4BSVisMFKk3TooIyHTUt"
+  "MrsO5uQRQVMMHuENKOiKShcJDZGqcc25jtNSggkiyphCMTMLKUmF8wQqhIswrBkjo1hGJjxXdDAVzsw13aJlEQNE0NrF8wDFKdyFIod0bCwMJod4JMuYq6nN"
+  "jBtTJUoVpeGInUplNWMSUcpwtGCFluZMZYXCMEVgyjh0DBKqEaMqc1PNqpyiURhqWT1GjMYpi4bABIclhFk1CtKoVhrFWRaMFtGY2Txww4zRsmo1hhCCadSm"
+  "65rCGquKMxwU42oFY7XJHBM5FUEXqtPIMiex1QzPixgVnWNM5tw0s4ZmoIK4RJeiWBqkKQTSFAwOWg3KCYPZKzKFgcpsATMLbGJEoTbWMVS6IQtm4hJzjhml"
+  "WGPUKYVSkF2BRajS4cTGwhQLWiqj69hB0QiFC0yuKSIIE0uj2SoKmjVCFejGqjk4TmNTW2EqzKrBkMOoMzR1wRhaC0usS61pQiMmG5cC8zphHEzBRAVOTJFa"
+  "MywVxlzFKDVkcKg0VmQ0FuHMiQwbstxwC+dGKYkJjhYom6A4Q2N5ijkmQ+fQhCooiEEFK6AREjBEZUE0qMWOzWxYLhvCIyqIsAKuRDANVJdJTmMQNRcMWmYr"
+  "RVPMszquqxcRdeQK5BQZDThVxti1jQuhQRpk7mrCzRo6XguiVJdCgaBGAaMlcAgiqKywhCoXzCzNi2RVzoTJpMVwcjynyIhwlRdqhQwvBGsFyhihzpzBsGg6"
+  "rsBZjBDPCGWCKlehGibMiWFMXDODriHWlNGZFCw48gTP89Q0TS2MUKFIXqusYMPIa4haVompYpbRaYDOK0OQoKOUUTMjzjKsA7tgHqKYTU0ghJIagTgwxZoK"
+  "gwc7GOawXBHFYRhxsIu5nCZXzJw0lLNqaLp48ihG6DwhdLw59LysyOQ4tOACw9xUo9tVHAxWXgPTHufCczgz4QKOQ8QEaVDRsUKrC4qK5qi0EGVxNNGIU+ki"
+  "ClHOykRjhKtp4mgW9QI1rGsIEeXC5rRCITxqqKnRmIZADZQuEKhMhsNaQkNs8Fw4GzWqa6phsExUlNEudTTSEFTMLusOlON0pjZWkAPBk4cIRlAoxTpnQYlY"
+  "JhwhQqN0geLRck3Mq4dFzSh0CMJuXFZScBTWHTJQ4KyNI+Q0xiwMzcAw";
 
 #endif
@@ -2,9 +2,8 @@
 #define TETROMINOES
 
 #include "../src/types.hpp"
-#include <list>
 
-const Piece PIECE_I{ 'I', 0, {
+inline constexpr Piece PIECE_I{ 'I', 0, {
                  {0, 0, 960, 0}, // e.g. 960 = 1111000000
                  {128, 128, 128, 128},
                  {-1, -1, -1, -1}, // -1s indicate that there are no more rotations of this piece
@@ -20,9 +19,9 @@ const Piece PIECE_I{ 'I', 0, {
                  {-1, -1, -1, -1},
                  {-1, -1, -1, -1},
                },{ 17, 16, -1, -1},
-               -2 };
+               -2, 2 };
 
-const Piece PIECE_O{ 'O', 1, {
+inline constexpr Piece PIECE_O{ 'O', 1, {
                  {0, 384, 384, 0},
                  {-1, -1, -1, -1},
                  {-1, -1, -1, -1},
@@ -38,9 +37,9 @@ const Piece PIECE_O{ 'O', 1, {
                  {-1, -1, -1, -1},
                  {-1, -1, -1, -1},
                },{17, -1, -1, -1},
-               -1 };
+               -1, 1 };
 
-const Piece PIECE_L{ 'L', 2, {
+inline constexpr Piece PIECE_L{ 'L', 2, {
                  {0, 448, 256, 0},
                  {384, 128, 128, 0},
                  {64, 448, 0, 0},
@@ -56,9 +55,9 @@ const Piece PIECE_L{ 'L', 2, {
                  {-1, 2, 2, 2},
                  {-1, -1, 3, 3},
                },{17, 17, 18, 17},
-               -1 };
+               -1, 4 };
 
-const Piece PIECE_J{ 'J', 3, {
+inline constexpr Piece PIECE_J{ 'J', 3, {
                  {0, 448, 64, 0},
                  {128, 128, 384, 0},
                  {256, 448, 0, 0},
@@ -74,9 +73,9 @@ const Piece PIECE_J{ 'J', 3, {
                  {-1, 2, 2, 2},
                  {-1, -1, 3, 1},
                },{17, 17, 18, 17},
-               -1 };
+               -1, 4 };
 
-const Piece PIECE_T{ 'T', 4, {
+inline constexpr Piece PIECE_T{ 'T', 4, {
                  {0, 448, 128, 0},
                  {128, 384, 128, 0},
                  {128, 448, 0, 0},
@@ -92,9 +91,9 @@ const Piece PIECE_T{ 'T', 4, {
                  {-1, 2, 2, 2},
                  {-1, -1, 3, 2},
                },{ 17, 17, 18, 17},
-               -1 };
+               -1, 4 };
 
-const Piece PIECE_S{ 'S', 5, {
+inline constexpr Piece PIECE_S{ 'S', 5, {
                  {0, 192, 384, 0},
                  {128, 192, 64, 0},
                  {-1, -1, -1, -1},
@@ -110,9 +109,9 @@ const Piece PIECE_S{ 'S', 5, {
                  {-1, -1, -1, -1},
                  {-1, -1, -1, -1},
                },{ 17, 17, -1, -1},
-               -1 };
+               -1, 2 };
 
-const Piece PIECE_Z{ 'Z', 6, {
+inline constexpr Piece PIECE_Z{ 'Z', 6, {
                  {0, 384, 192, 0},
                  {64, 192, 128, 0},
                  {-1, -1, -1, -1},
@@ -128,9 +127,9 @@ const Piece PIECE_Z{ 'Z', 6, {
                  {-1, -1, -1, -1},
                  {-1, -1, -1, -1},
                },{ 17, 17, -1, -1},
-               -1 };
+               -1, 2 };
 
-const Piece PIECE_LIST[7] = {PIECE_I, PIECE_O, PIECE_L, PIECE_J, PIECE_T, PIECE_S, PIECE_Z};
+inline constexpr Piece PIECE_LIST[7] = {PIECE_I, PIECE_O, PIECE_L, PIECE_J, PIECE_T, PIECE_S, PIECE_Z};
 
 /* A set of very particular data about each piece, used for finding tucks/spins in move search.
 
@@ -144,73 +143,76 @@ struct TuckOriginSpot {
   int y;
 };
 
-std::list<TuckOriginSpot> TUCK_SPOTS_I {
-  {0, 0, 2},
-  {0, 3, 2},
-  {1, 2, 0}
-};
-
-std::list<TuckOriginSpot> TUCK_SPOTS_O {
-  {0, 1, 1},
-  {0, 2, 1}
-};
-
-std::list<TuckOriginSpot> TUCK_SPOTS_L {
-  {0, 1, 1},
-  {0, 3, 1},
-  {1, 1, 0},
-  {1, 2, 0},
-  {2, 1, 1},
-  {2, 3, 0},
-  {3, 2, 0},
-  {3, 3, 2}
-};
+#define MAX_TUCK_SPOTS 8
 
-std::list<TuckOriginSpot> TUCK_SPOTS_J {
-  {0, 1, 1},
-  {0, 3, 1},
-  {1, 1, 2},
-  {1, 2, 0},
-  {2, 1, 0},
-  {2, 3, 1},
-  {3, 2, 0},
-  {3, 3, 0}
+/** The tuck origin spots of one piece, in the order that move search tries them. */
+struct TuckSpotList {
+  int numSpots;
+  TuckOriginSpot spots[MAX_TUCK_SPOTS];
 };
 
-std::list<TuckOriginSpot> TUCK_SPOTS_T {
-  {0, 1, 1},
-  {0, 3, 1},
-  {1, 1, 1},
-  {1, 2, 0},
-  {2, 1, 1},
-  {2, 3, 1},
-  {3, 2, 0},
-  {3, 3, 1},
+/** Indexed by piece index. */
+inline constexpr TuckSpotList TUCK_SPOTS_LIST[7] = {
+  {3, { // I
+    {0, 0, 2},
+    {0, 3, 2},
+    {1, 2, 0}
+  }},
+  {2, { // O
+    {0, 1, 1},
+    {0, 2, 1}
+  }},
+  {8, { // L
+    {0, 1, 1},
+    {0, 3, 1},
+    {1, 1, 0},
+    {1, 2, 0},
+    {2, 1, 1},
+    {2, 3, 0},
+    {3, 2, 0},
+    {3, 3, 2}
+  }},
+  {8, { // J
+    {0, 1, 1},
+    {0, 3, 1},
+    {1, 1, 2},
+    {1, 2, 0},
+    {2, 1, 0},
+    {2, 3, 1},
+    {3, 2, 0},
+    {3, 3, 0}
+  }},
+  {8, { // T
+    {0, 1, 1},
+    {0, 3, 1},
+    {1, 1, 1},
+    {1, 2, 0},
+    {2, 1, 1},
+    {2, 3, 1},
+    {3, 2, 0},
+    {3, 3, 1}
+  }},
+  {4, { // S
+    {0, 1, 2},
+    {0, 3, 1},
+    {1, 2, 0},
+    {1, 3, 1}
+  }},
+  {4, { // Z
+    {0, 1, 1},
+    {0, 3, 2},
+    {1, 3, 0},
+    {1, 2, 1}
+  }}
 };
 
-std::list<TuckOriginSpot> TUCK_SPOTS_S {
-  {0, 1, 2},
-  {0, 3, 1},
-  {1, 2, 0},
-  {1, 3, 1}
-};
-
-std::list<TuckOriginSpot> TUCK_SPOTS_Z {
-  {0, 1, 1},
-  {0, 3, 2},
-  {1, 3, 0},
-  {1, 2, 1}
-};
-
-std::list<TuckOriginSpot> TUCK_SPOTS_LIST[7] = {TUCK_SPOTS_I, TUCK_SPOTS_O, TUCK_SPOTS_L, TUCK_SPOTS_J, TUCK_SPOTS_T, TUCK_SPOTS_S, TUCK_SPOTS_Z};
-
 struct TuckInput {
   char notation;
   int xChange;
   int rotationChange;
 };
 
-std::list<TuckInput> TUCK_INPUTS {
+inline constexpr TuckInput TUCK_INPUTS[8] = {
   {'L', -1, 0},
   {'R', 1, 0},
   {'A', 0, 1},
@@ -13,11 +13,13 @@
 #define DEPTH_2_PRUNING_BREADTH 12
 #define LOCK_POSITION_REPEAT_CAP 3
 #define TUCK_SETUP_HOLE_PROPORTION 0.81f
-#define SEQUENCE_LENGTH 20
+#define SEQUENCE_LENGTH 20 // The length of the canonical sequences, and of generated ones by default
 
 #define NUM_PLAYOUTS_LONG 0
 #define PLAYOUT_LENGTH_LONG 6
 #define NUM_PLAYOUTS_SHORT 100
 #define PLAYOUT_LENGTH_SHORT 5
 
+#define VALUE_PLAYOUT_TOP_N 3
+
 #endif
@@ -3,14 +3,60 @@
 #include "utils.hpp"
 #include "../data/ranks_output.hpp"
 #include <math.h>
+#include <array>
 #include <vector>
 using namespace std;
 
+typedef array<double, NUM_SURFACE_HEIGHTS> heightTable;
+
+/** Precomputes |diff| ^ 1.5 for every possible difference in height between adjacent columns. */
+heightTable getFlatnessPenaltyTable() {
+  heightTable table = {};
+  for (int absDiff = 0; absDiff < NUM_SURFACE_HEIGHTS; absDiff++) {
+    table[absDiff] = absDiff == 0 ? 0 : pow(absDiff, 1.5);
+  }
+  return table;
+}
+
+/** Precomputes the likely burns for every number of cells that col 9 is below where it should be. */
+heightTable getLikelyBurnsTable() {
+  heightTable table = {};
+  for (int diff = 0; diff < NUM_SURFACE_HEIGHTS; diff++) {
+    // Need a burn for every 2 cells below that.
+    // E.g. 1 diff => 3 below col8 = 1 burn,
+    //      2 diff => 4 below col8 = 1 burn
+    //      3 diff => 5 below col8 = 2 burns
+    table[diff] = (float) (ceil(diff / 2.0f) * 0.6);
+  }
+  return table;
+}
+
+/** Precomputes the inaccessible left/right penalty for every number of cells that the stack is above the accessible surface. */
+heightTable getInaccessibleFactorTable() {
+  heightTable table = {};
+  for (int highestAbove = 1; highestAbove < NUM_SURFACE_HEIGHTS; highestAbove++) {
+    table[highestAbove] = 1.0 + 0.2 * highestAbove * highestAbove;
+  }
+  return table;
+}
+
+const heightTable FLATNESS_PENALTY_TABLE = getFlatnessPenaltyTable();
+const heightTable LIKELY_BURNS_TABLE = getLikelyBurnsTable();
+const heightTable INACCESSIBLE_FACTOR_TABLE = getInaccessibleFactorTable();
+
+/**
+ * Gets the inaccessible left/right penalty for a stack that's highestAbove cells above the accessible surface.
+ * With slow tapping, the accessible surface can be below the floor, so the stack can be further above it than any height.
+ */
+double getInaccessiblePenalty(int highestAbove) {
+  return highestAbove < NUM_SURFACE_HEIGHTS ? INACCESSIBLE_FACTOR_TABLE[highestAbove] : 1.0 + 0.2 * highestAbove * highestAbove;
+}
+
 /**
  * A crude way to evaluate a surface for when I'm debugging and don't want to load the surfaces every time I
  * run.
  */
-float calculateFlatness(int surfaceArray[10], int wellColumn) {
+float calculateFlatness(const int8_t surfaceArray[10], int wellColumn) {
   float score = 30;
   for (int i = 0; i < 9; i++) {
     if (i == wellColumn || i+1 == wellColumn) {
@@ -22,9 +68,7 @@ float calculateFlatness(int surfaceArray[10], int wellColumn) {
       diff = -2;
     }
     // Punish based on the absolute value of the column differences
-    if (diff != 0) {
-      score -= pow(abs(diff), 1.5);
-    }
+    score -= FLATNESS_PENALTY_TABLE[abs(diff)];
     // Line dependency
     if (diff >= 3 && (i == 0 || surfaceArray[i-1] + surfaceArray[i] >= 3)) {
       score -= 25;
@@ -34,7 +78,7 @@ float calculateFlatness(int surfaceArray[10], int wellColumn) {
 }
 
 /** Gets the value of a surface. */
-float rateSurface(int surfaceArray[10], const EvalContext *evalContext) {
+float rateSurface(const int8_t surfaceArray[10], const EvalContext *evalContext) {
   int wellColumn = evalContext->wellColumn;
   if (USE_RANKS) {
     // Convert the surface array into the custom base-9 encoding
@@ -61,7 +105,7 @@ float rateSurface(int surfaceArray[10], const EvalContext *evalContext) {
   return calculateFlatness(surfaceArray, wellColumn);
 }
 
-float getAverageHeight(int surfaceArray[10], int wellColumn) {
+float getAverageHeight(const int8_t surfaceArray[10], int wellColumn) {
   float avgHeight = 0;
   float weight = wellColumn >= 0 ? 0.1 : 0.111111;
   for (int i = 0; i < 10; i++) {
@@ -73,12 +117,16 @@ float getAverageHeight(int surfaceArray[10], int wellColumn) {
   return avgHeight;
 }
 
+float getAdjustedNumHoles(GameState gameState) {
+  return gameState.numHoles + gameState.numTuckSetups * TUCK_SETUP_HOLE_PROPORTION;
+}
+
 float getAverageHeightFactor(int avgHeight, float scareHeight) {
   float diff = max(0.0f, avgHeight - scareHeight);
   return diff * diff;
 }
 
-float getBuiltOutLeftFactor(int surfaceArray[10], int board[20], float avgHeight, float scareHeight) {
+float getBuiltOutLeftFactor(const int8_t surfaceArray[10], const uint32_t columns[10], float avgHeight, float scareHeight) {
   float heightRatio = avgHeight / max(3.0f, scareHeight);
   float heightDiff = 0.5 * (surfaceArray[0] - avgHeight) + 0.5 * (surfaceArray[0] - surfaceArray[1]);
   
@@ -88,20 +136,17 @@ float getBuiltOutLeftFactor(int surfaceArray[10], int board[20], float avgHeight
     return -0.5 * heightDiff * heightDiff * softenedHeightRatio; // Approximate (heightDiff ^ 1.5) as (heightDiff * heightDiff * 0.5)
   }
   // Check for holes (don't reward building out the left over holes)
-  int r = 21 - surfaceArray[0];
-  while (r < 20) {
-    if (!(board[r] & (1 << 9))) {
-      return 0;
-    }
-    r++;
+  uint32_t belowSurfaceMask = (1u << max(0, surfaceArray[0] - 1)) - 1;
+  if (~columns[0] & belowSurfaceMask) {
+    return 0;
   }
   // Reward built out left
   return heightRatio * heightDiff;
 }
 
-float getLeftSurfaceFactor(int board[20], int surfaceArray[10], int max5TapHeight){
+float getLeftSurfaceFactor(const int board[20], const int8_t surfaceArray[10], int max5TapHeight){
   max5TapHeight = max(0, max5TapHeight);
-  for (int r = 20 - surfaceArray[0]; r < 20; r++) {
+  for (int r = max(0, 20 - surfaceArray[0]); r < 20; r++) { // A piece that locks partly above the board makes the column taller than it
     if (board[r] & HOLE_BIT(0)) {
       return -3;
     }
@@ -120,22 +165,18 @@ float getCol9Factor(int col9Height, float maxSafeCol9Height){
   return diff * diff;
 }
 
-float getCoveredWellFactor(int board[20], int wellColumn, float scareHeight) {
-  if (wellColumn == -1) {
+float getCoveredWellFactor(const int board[20], const uint32_t columns[10], int wellColumn, float scareHeight) {
+  if (wellColumn == -1 || columns[wellColumn] == 0) {
     return 0;
   }
-  int mask = (1 << (9 - wellColumn));
-  for (int r = 0; r < 20; r++) {
-    if (board[r] & mask) {
-      int difficultyMultiplier = (board[r] & (ALL_HOLE_BITS | ALL_TUCK_SETUP_BITS)) > 0 ? 10 : 1;
-      float heightRatio = (20.0f - r) / max(3.0f, scareHeight);
-      return heightRatio * heightRatio * heightRatio * difficultyMultiplier;
-    }
-  }
-  return 0;
+  // Find the highest cell in the well
+  int r = 20 - COLUMN_HEIGHT(columns[wellColumn]);
+  int difficultyMultiplier = (board[r] & (ALL_HOLE_BITS | ALL_TUCK_SETUP_BITS)) > 0 ? 10 : 1;
+  float heightRatio = (20.0f - r) / max(3.0f, scareHeight);
+  return heightRatio * heightRatio * heightRatio * difficultyMultiplier;
 }
 
-float getGuaranteedBurnsFactor(int board[20], int wellColumn) {
+float getGuaranteedBurnsFactor(const int board[20], int wellColumn) {
   // Neither of these measures make sense in lineout mode, so don't calculate this factor
   if (wellColumn == -1) {
     return 0;
@@ -150,7 +191,7 @@ float getGuaranteedBurnsFactor(int board[20], int wellColumn) {
   return guaranteedBurns;
 }
 
-float getLikelyBurnsFactor(int surfaceArray[10], int wellColumn, int maxSafeCol9) {
+float getLikelyBurnsFactor(const int8_t surfaceArray[10], int wellColumn, int maxSafeCol9) {
   if (wellColumn != 9) {
     return 0;
   }
@@ -160,19 +201,14 @@ float getLikelyBurnsFactor(int surfaceArray[10], int wellColumn, int maxSafeCol9
   if (col9 >= lowestGoodColumn9) {
     return 0;
   }
-  // Need a burn for every 2 cells below that.
-  // E.g. 1 diff => 3 below col8 = 1 burn,
-  //      2 diff => 4 below col8 = 1 burn
-  //      3 diff => 5 below col8 = 2 burns
-  int diff = lowestGoodColumn9 - col9;
-  return ceil(diff / 2.0f) * 0.6;
+  return LIKELY_BURNS_TABLE[lowestGoodColumn9 - col9];
 }
 
 /**
  * Assesses whether the surface allows for 5 taps.
  * @returns the multiple of the accessible left penalty that should be applied. That is, 0 if 5 taps are possible, or a float around 1.0 or higher (depending on how many lines would need to clear for the left to be accessible).
  */
-float getInaccessibleLeftFactor(int surfaceArray[10], int const maxAccessibleLeftSurface[10], int wellColumn){
+float getInaccessibleLeftFactor(const int8_t surfaceArray[10], int const maxAccessibleLeftSurface[10], int wellColumn){
   float severity = 1.0f;
   // Check if the agent even needs to get a piece left first.
   // If the left is built out higher than the max 5 tap height and also higher than col 9, then it's chilling.
@@ -187,10 +223,10 @@ float getInaccessibleLeftFactor(int surfaceArray[10], int const maxAccessibleLef
       highestAbove = std::max(highestAbove, surfaceArray[i] - maxAccessibleLeftSurface[i]);
     }
   }
-  return highestAbove == 0 ? 0 : (1.0 + 0.2 * highestAbove * highestAbove) * severity;
+  return getInaccessiblePenalty(highestAbove) * severity;
 }
 
-float getInaccessibleRightFactor(int surfaceArray[10], int const maxAccessibleRightSurface[10]){
+float getInaccessibleRightFactor(const int8_t surfaceArray[10], int const maxAccessibleRightSurface[10]){
   // Check if the agent even needs to get a piece left first.
   // If the left is built out higher than the max 5 tap height and also higher than col 9, then it's chilling.
   int needsRightTap = surfaceArray[9] < surfaceArray[8];
@@ -204,7 +240,7 @@ float getInaccessibleRightFactor(int surfaceArray[10], int const maxAccessibleRi
       highestAbove = std::max(highestAbove, surfaceArray[i] - maxAccessibleRightSurface[i]);
     }
   }
-  return highestAbove == 0 ? 0 : 1.0 + 0.2 * highestAbove * highestAbove;
+  return getInaccessiblePenalty(highestAbove);
 }
 
 float getLineClearFactor(int numLinesCleared, FastEvalWeights weights, int shouldRewardLineClears){
@@ -214,15 +250,14 @@ float getLineClearFactor(int numLinesCleared, FastEvalWeights weights, int shoul
 }
 
 /** Calculate how hard it will be to fill in the middle of the board enough to burn. */
-float getUnableToBurnFactor(int board[20], int surfaceArray[10], float scareHeight){
+float getUnableToBurnFactor(const int board[20], const int8_t surfaceArray[10], const uint32_t columns[10], float scareHeight){
   float totalPenalty = 0;
   int col9Height = surfaceArray[8];
 
   // If col 10 is also filled, having col 9 filled isn't bad
+  // (so drop to the highest col 10 gap at or below col 9's top)
   if (col9Height <= surfaceArray[9]) {
-    while (board[20 - col9Height] & 1) {
-      col9Height--;
-    }
+    col9Height = COLUMN_HEIGHT(~columns[9] & ((1u << col9Height) - 1));
   }
   if (col9Height <= 0){
     return 0;
@@ -266,7 +301,7 @@ float getUnableToBurnFactor(int board[20], int surfaceArray[10], float scareHeig
   return totalPenalty * heightMultiplier;
 }
 
-int isTetrisReady(int board[20], int col10Height){
+int isTetrisReady(const int board[20], int col10Height){
   if (col10Height > 16) {
     return 0;
   }
@@ -279,42 +314,89 @@ int isTetrisReady(int board[20], int col10Height){
   return true;
 }
 
-float fastEval(GameState gameState,
-               GameState newState,
-               LockPlacement lockPlacement,
-               const EvalContext *evalContext) {
+const EvalFactorName EVAL_FACTOR_NAMES[NUM_EVAL_FACTORS] = {
+  {"surface", &EvalFactors::surface},
+  {"surfaceLeft", &EvalFactors::surfaceLeft},
+  {"avgHeight", &EvalFactors::avgHeight},
+  {"lineClear", &EvalFactors::lineClear},
+  {"hole", &EvalFactors::hole},
+  {"guaranteedBurns", &EvalFactors::guaranteedBurns},
+  {"likelyBurns", &EvalFactors::likelyBurns},
+  {"inaccessibleLeft", &EvalFactors::inaccessibleLeft},
+  {"inaccessibleRight", &EvalFactors::inaccessibleRight},
+  {"coveredWell", &EvalFactors::coveredWell},
+  {"highCol9", &EvalFactors::highCol9},
+  {"tetrisReady", &EvalFactors::tetrisReady},
+  {"builtOutLeft", &EvalFactors::builtOutLeft},
+  {"unableToBurn", &EvalFactors::unableToBurn},
+};
+
+/** Computes the cheap factors: the ones that only take a lookup or a short loop over the surface. */
+void getCheapEvalFactors(const GameState *gameState, const GameState *newState, const EvalContext *evalContext, float avgHeight, OUT EvalFactors *factors) {
   FastEvalWeights weights = evalContext->weights;
-  // Preliminary helper work
-  float avgHeight = getAverageHeight(newState.surfaceArray, evalContext->wellColumn);
-  int isKillscreenLineout = gameState.level >= 29 && evalContext->aiMode == LINEOUT;
-  // Calculate all the factors
-  float avgHeightFactor = weights.avgHeightCoef * getAverageHeightFactor(avgHeight, evalContext->scareHeight);
-  float builtOutLeftFactor = weights.builtOutLeftCoef * getBuiltOutLeftFactor(newState.surfaceArray, newState.board, avgHeight, evalContext->scareHeight);
-  float coveredWellFactor = weights.coveredWellCoef * getCoveredWellFactor(newState.board, evalContext->wellColumn, evalContext->scareHeight);
-  float guaranteedBurnsFactor = weights.burnCoef * getGuaranteedBurnsFactor(newState.board, evalContext->wellColumn);
-  float likelyBurnsFactor = weights.burnCoef * getLikelyBurnsFactor(newState.surfaceArray, evalContext->wellColumn, evalContext->maxSafeCol9);
-  float highCol9Factor = weights.col9Coef * getCol9Factor(newState.surfaceArray[8], evalContext->maxSafeCol9);
-  float holeFactor = weights.holeCoef * newState.adjustedNumHoles;
-  float inaccessibleLeftFactor = isKillscreenLineout
+  int isKillscreenLineout = gameState->level >= 29 && evalContext->aiMode == LINEOUT;
+  factors->avgHeight = weights.avgHeightCoef * getAverageHeightFactor(avgHeight, evalContext->scareHeight);
+  factors->likelyBurns = weights.burnCoef * getLikelyBurnsFactor(newState->surfaceArray, evalContext->wellColumn, evalContext->maxSafeCol9);
+  factors->highCol9 = weights.col9Coef * evalContext->col9FactorByHeight[newState->surfaceArray[8]];
+  factors->hole = weights.holeCoef * getAdjustedNumHoles(*newState);
+  factors->inaccessibleLeft = isKillscreenLineout
               ? 0
-              : (weights.inaccessibleLeftCoef * getInaccessibleLeftFactor(newState.surfaceArray, evalContext->pieceRangeContext.maxAccessibleLeft5Surface, evalContext->wellColumn));
-  float inaccessibleRightFactor = isKillscreenLineout
+              : (weights.inaccessibleLeftCoef * getInaccessibleLeftFactor(newState->surfaceArray, evalContext->pieceRangeContext.maxAccessibleLeft5Surface, evalContext->wellColumn));
+  factors->inaccessibleRight = isKillscreenLineout
               ? 0
-              : (weights.inaccessibleRightCoef * getInaccessibleRightFactor(newState.surfaceArray, evalContext->pieceRangeContext.maxAccessibleRightSurface));
-  float lineClearFactor = getLineClearFactor(newState.lines - gameState.lines, weights, evalContext->shouldRewardLineClears);
-  float surfaceFactor = weights.surfaceCoef * rateSurface(newState.surfaceArray, evalContext);
-  float surfaceLeftFactor =
+              : (weights.inaccessibleRightCoef * getInaccessibleRightFactor(newState->surfaceArray, evalContext->pieceRangeContext.maxAccessibleRightSurface));
+  factors->lineClear = getLineClearFactor(newState->lines - gameState->lines, weights, evalContext->shouldRewardLineClears);
+  factors->surfaceLeft =
     (isKillscreenLineout)
-      ? weights.surfaceLeftCoef * getLeftSurfaceFactor(newState.board, newState.surfaceArray, evalContext->pieceRangeContext.max5TapHeight)
+      ? weights.surfaceLeftCoef * getLeftSurfaceFactor(newState->board, newState->surfaceArray, evalContext->pieceRangeContext.max5TapHeight)
       : 0;
-  float tetrisReadyFactor =
-    (evalContext->wellColumn >= 0 && isTetrisReady(newState.board, newState.surfaceArray[evalContext->wellColumn]))
+  factors->tetrisReady =
+    (evalContext->wellColumn >= 0 && isTetrisReady(newState->board, newState->surfaceArray[evalContext->wellColumn]))
       ? weights.tetrisReadyCoef
       : 0;
-  float unableToBurnFactor = weights.unableToBurnCoef * getUnableToBurnFactor(newState.board, newState.surfaceArray, evalContext->scareHeight);
+}
 
-  float total = surfaceFactor + surfaceLeftFactor + avgHeightFactor + lineClearFactor + holeFactor + guaranteedBurnsFactor + likelyBurnsFactor + inaccessibleLeftFactor + inaccessibleRightFactor + coveredWellFactor + highCol9Factor + tetrisReadyFactor + builtOutLeftFactor + unableToBurnFactor;
-  total = max(weights.deathCoef, total); // Can't be worse than death
+/** Computes the costly factors: the ones that scan the board or do a lot of float math. */
+void getCostlyEvalFactors(const GameState *newState, const EvalContext *evalContext, float avgHeight, OUT EvalFactors *factors) {
+  FastEvalWeights weights = evalContext->weights;
+  // The light eval skips two of the costlier factors that rarely change which placement is best
+  // (getUnableToBurnFactor is costly too, but dropping it changes playout decisions far more often).
+  factors->builtOutLeft = evalContext->isLightEval ? 0 : weights.builtOutLeftCoef * getBuiltOutLeftFactor(newState->surfaceArray, newState->columns, avgHeight, evalContext->scareHeight);
+  factors->coveredWell = evalContext->isLightEval ? 0 : weights.coveredWellCoef * getCoveredWellFactor(newState->board, newState->columns, evalContext->wellColumn, evalContext->scareHeight);
+  factors->guaranteedBurns = weights.burnCoef * getGuaranteedBurnsFactor(newState->board, evalContext->wellColumn);
+  factors->unableToBurn = weights.unableToBurnCoef * getUnableToBurnFactor(newState->board, newState->surfaceArray, newState->columns, evalContext->scareHeight);
+}
+
+/** Adds up the weighted factors, in a fixed order so that every caller gets the same float total. */
+float sumEvalFactors(EvalFactors const *factors, FastEvalWeights weights) {
+  float total = factors->surface + factors->surfaceLeft + factors->avgHeight + factors->lineClear + factors->hole + factors->guaranteedBurns + factors->likelyBurns + factors->inaccessibleLeft + factors->inaccessibleRight + factors->coveredWell + factors->highCol9 + factors->tetrisReady + factors->builtOutLeft + factors->unableToBurn;
+  return max(weights.deathCoef, total); // Can't be worse than death
+}
+
+float getEvalFactors(GameState gameState,
+                     GameState newState,
+                     const EvalContext *evalContext,
+                     OUT EvalFactors *factors) {
+  float avgHeight = getAverageHeight(newState.surfaceArray, evalContext->wellColumn);
+  getCheapEvalFactors(&gameState, &newState, evalContext, avgHeight, factors);
+  factors->surface = evalContext->weights.surfaceCoef * rateSurface(newState.surfaceArray, evalContext);
+  getCostlyEvalFactors(&newState, evalContext, avgHeight, factors);
+  return sumEvalFactors(factors, evalContext->weights);
+}
+
+/** Converts the factors and total of an eval to the score that fastEval returns, logging them if enabled. */
+float getEvalScore(const GameState *newState, LockPlacement lockPlacement, const EvalContext *evalContext, EvalFactors const &factors, float total) {
+  // In fixed-point mode, round each factor and sum them as integers. The result is an integer well within the range that
+  // a float represents exactly, so later sums of these scores are exact too.
+  // Boards that are already at the death floor stay there, since individual factors can be far outside the int range.
+  if (evalContext->useFixedPoint) {
+    long long fixedTotal = 0;
+    for (EvalFactorName const &factorName : EVAL_FACTOR_NAMES) {
+      fixedTotal += llrintf(factors.*factorName.field * FIXED_POINT_SCALE);
+    }
+    long long fixedDeath = toFixedPoint(evalContext->weights.deathCoef);
+    total = (float) (total > evalContext->weights.deathCoef ? max(fixedDeath, fixedTotal) : fixedDeath);
+  }
 
   // Logging
   if (LOGGING_ENABLED) {
@@ -322,42 +404,336 @@ float fastEval(GameState gameState,
                lockPlacement.rotationIndex,
                lockPlacement.x - SPAWN_X,
                lockPlacement.y);
-    printBoard(newState.board);
-    printSurface(newState.surfaceArray);
+    printBoard(newState->board);
+    printSurface(newState->surfaceArray);
     maybePrint("Tuck setups:\n");
     for (int i = 0; i < 19; i++) {
-      maybePrint("%d ", (newState.board[i] & ALL_TUCK_SETUP_BITS) >> 20);
+      maybePrint("%d ", (newState->board[i] & ALL_TUCK_SETUP_BITS) >> 20);
     }
-    maybePrint("%d\n", (newState.board[19] & ALL_TUCK_SETUP_BITS) >> 20);
+    maybePrint("%d\n", (newState->board[19] & ALL_TUCK_SETUP_BITS) >> 20);
     maybePrint("Holes:\n");
     for (int i = 0; i < 19; i++) {
-      maybePrint("%d ", (newState.board[i] & ALL_HOLE_BITS) >> 10);
+      maybePrint("%d ", (newState->board[i] & ALL_HOLE_BITS) >> 10);
     }
-    maybePrint("%d\n", (newState.board[19] & ALL_HOLE_BITS) >> 10);
+    maybePrint("%d\n", (newState->board[19] & ALL_HOLE_BITS) >> 10);
     maybePrint("Hole weights:\n");
     for (int i = 0; i < 19; i++) {
-      maybePrint("%d ", (newState.board[i] & HOLE_WEIGHT_BIT) > 0);
+      maybePrint("%d ", (newState->board[i] & HOLE_WEIGHT_BIT) > 0);
     }
-    maybePrint("%d\n", (newState.board[19] & HOLE_WEIGHT_BIT) > 0);
-
-    printf("Numholes %f\n", newState.adjustedNumHoles);
-    maybePrint(
-      "Surface %01f, LeftSurface %01f, AvgHeight %01f, LineClear %01f, Hole %01f, GuaranteedBurns %01f, LikelyBurns %01f, InaccLeft %01f, CoveredWell %01f, HighCol9 %01f, TetrisReady %01f, BuiltLeft %01f, UnableToBrn %01f,\t Total: %01f\n",
-      surfaceFactor,
-      surfaceLeftFactor,
-      avgHeightFactor,
-      lineClearFactor,
-      holeFactor,
-      guaranteedBurnsFactor,
-      likelyBurnsFactor,
-      inaccessibleLeftFactor,
-      coveredWellFactor,
-      highCol9Factor,
-      tetrisReadyFactor,
-      builtOutLeftFactor,
-      unableToBurnFactor,
-      total);
+    maybePrint("%d\n", (newState->board[19] & HOLE_WEIGHT_BIT) > 0);
+
+    printf("Numholes %d, tuck setups %d\n", newState->numHoles, newState->numTuckSetups);
+    for (EvalFactorName const &factorName : EVAL_FACTOR_NAMES) {
+      maybePrint("%s %01f, ", factorName.name, factors.*factorName.field);
+    }
+    maybePrint("\t Total: %01f\n", total);
   }
 
   return total;
 }
+
+float fastEval(GameState gameState,
+               GameState newState,
+               LockPlacement lockPlacement,
+               const EvalContext *evalContext) {
+  EvalFactors factors;
+  float total = getEvalFactors(gameState, newState, evalContext, &factors);
+  return getEvalScore(&newState, lockPlacement, evalContext, factors, total);
+}
+
+/**
+ * Whether a bounded eval can stop after a stage, because the factors so far plus an upper bound on the rest can't beat the threshold.
+ * The margin covers the float rounding in the bound and in callers' thresholds (relative to the size of the numbers involved),
+ * and in fixed-point mode, the rounding of each factor.
+ */
+int cannotBeatThreshold(float partialTotal, float partialMagnitude, float remainingBound, float threshold, const EvalContext *evalContext) {
+  float bound = max(evalContext->weights.deathCoef, partialTotal + remainingBound);
+  bound += EVAL_BOUND_RELATIVE_MARGIN * (partialMagnitude + fabsf(remainingBound) + fabsf(bound)) + EVAL_BOUND_ABSOLUTE_MARGIN;
+  if (evalContext->useFixedPoint) {
+    return bound * FIXED_POINT_SCALE + NUM_EVAL_FACTORS <= threshold;
+  }
+  return bound <= threshold;
+}
+
+float boundedFastEval(const GameState *gameState,
+                      const GameState *newState,
+                      LockPlacement lockPlacement,
+                      const EvalContext *evalContext,
+                      float threshold,
+                      OUT EvalStageStats *stageStats) {
+  if (threshold == -INFINITY) {
+    return fastEval(*gameState, *newState, lockPlacement, evalContext);
+  }
+  if (stageStats != nullptr) {
+    stageStats->numEvals++;
+  }
+  EvalFactors factors;
+  float avgHeight = getAverageHeight(newState->surfaceArray, evalContext->wellColumn);
+
+  // Stage 1: the cheap factors
+  getCheapEvalFactors(gameState, newState, evalContext, avgHeight, &factors);
+  float partialTotal = factors.avgHeight + factors.likelyBurns + factors.highCol9 + factors.hole + factors.inaccessibleLeft + factors.inaccessibleRight + factors.lineClear + factors.surfaceLeft + factors.tetrisReady;
+  float partialMagnitude = fabsf(factors.avgHeight) + fabsf(factors.likelyBurns) + fabsf(factors.highCol9) + fabsf(factors.hole) + fabsf(factors.inaccessibleLeft) + fabsf(factors.inaccessibleRight) + fabsf(factors.lineClear) + fabsf(factors.surfaceLeft) + fabsf(factors.tetrisReady);
+  if (cannotBeatThreshold(partialTotal, partialMagnitude, evalContext->surfaceUpperBound + evalContext->costlyFactorsUpperBound, threshold, evalContext)) {
+    if (stageStats != nullptr) {
+      stageStats->numCutAfterCheap++;
+    }
+    return -INFINITY;
+  }
+
+  // Stage 2: the surface
+  factors.surface = evalContext->weights.surfaceCoef * rateSurface(newState->surfaceArray, evalContext);
+  if (cannotBeatThreshold(partialTotal + factors.surface, partialMagnitude + fabsf(factors.surface), evalContext->costlyFactorsUpperBound, threshold, evalContext)) {
+    if (stageStats != nullptr) {
+      stageStats->numCutAfterSurface++;
+    }
+    return -INFINITY;
+  }
+
+  // Stage 3: the costly factors, and then the same total as fastEval
+  getCostlyEvalFactors(newState, evalContext, avgHeight, &factors);
+  return getEvalScore(newState, lockPlacement, evalContext, factors, sumEvalFactors(&factors, evalContext->weights));
+}
+
+
+/** The largest value that a weighted factor can take, given the range of the unweighted factor. */
+float getWeightedFactorUpperBound(float coef, float minFactor, float maxFactor){
+  if (coef == 0) {
+    return 0;
+  }
+  return coef > 0 ? coef * maxFactor : coef * minFactor;
+}
+
+void getEvalFactorUpperBounds(const EvalContext *evalContext, OUT EvalFactors *bounds){
+  FastEvalWeights weights = evalContext->weights;
+  float maxHeight = NUM_SURFACE_HEIGHTS - 1;
+  float maxHeightRatio = maxHeight / max(3.0f, evalContext->scareHeight);
+  float maxAvgHeightDiff = max(0.0f, maxHeight - evalContext->scareHeight);
+  float maxLineClear = weights.deathCoef;
+  for (int numLinesCleared = 0; numLinesCleared <= 4; numLinesCleared++) {
+    maxLineClear = max(maxLineClear, getLineClearFactor(numLinesCleared, weights, evalContext->shouldRewardLineClears));
+  }
+  float maxCol9 = evalContext->col9FactorByHeight[0];
+  float minCol9 = evalContext->col9FactorByHeight[0];
+  for (int height = 0; height < NUM_SURFACE_HEIGHTS; height++) {
+    maxCol9 = max(maxCol9, evalContext->col9FactorByHeight[height]);
+    minCol9 = min(minCol9, evalContext->col9FactorByHeight[height]);
+  }
+  // The stack can be as far above the accessible surface as the tallest column is above its lowest point
+  int minAccessibleSurface = 0;
+  for (int i = 0; i < 10; i++) {
+    minAccessibleSurface = min(minAccessibleSurface, evalContext->pieceRangeContext.maxAccessibleLeft5Surface[i]);
+    minAccessibleSurface = min(minAccessibleSurface, evalContext->pieceRangeContext.maxAccessibleRightSurface[i]);
+  }
+  float minInaccessible = 0, maxInaccessible = 0;
+  for (int highestAbove = 0; highestAbove <= maxHeight - minAccessibleSurface; highestAbove++) {
+    minInaccessible = min(minInaccessible, (float) getInaccessiblePenalty(highestAbove));
+    maxInaccessible = max(maxInaccessible, (float) getInaccessiblePenalty(highestAbove));
+  }
+  float minLikelyBurns = 0, maxLikelyBurns = 0;
+  for (int i = 0; i < NUM_SURFACE_HEIGHTS; i++) {
+    minLikelyBurns = min(minLikelyBurns, (float) LIKELY_BURNS_TABLE[i]);
+    maxLikelyBurns = max(maxLikelyBurns, (float) LIKELY_BURNS_TABLE[i]);
+  }
+  float maxCoveredWell = evalContext->isLightEval ? 0 : 10 * (20 / 3.0f) * (20 / 3.0f) * (20 / 3.0f);
+  float maxUnableToBurn = INFINITY; // Scales with a power of 1 / scareHeight (and the light eval still computes it)
+
+  // Bound each weighted factor using the range of its unweighted value
+  bounds->avgHeight = getWeightedFactorUpperBound(weights.avgHeightCoef, 0, maxAvgHeightDiff * maxAvgHeightDiff);
+  // The height diff is at most s0 - avgHeight / 2, and the avg height is part of the height ratio, so the product peaks when the whole board is full
+  bounds->builtOutLeft = evalContext->isLightEval ? 0 : getWeightedFactorUpperBound(weights.builtOutLeftCoef, -0.5f * maxHeight * maxHeight * 0.5f * (maxHeightRatio + 1), maxHeightRatio * maxHeight / 2);
+  bounds->coveredWell = getWeightedFactorUpperBound(weights.coveredWellCoef, 0, maxCoveredWell);
+  bounds->guaranteedBurns = getWeightedFactorUpperBound(weights.burnCoef, 0, 20);
+  bounds->likelyBurns = getWeightedFactorUpperBound(weights.burnCoef, minLikelyBurns, maxLikelyBurns);
+  bounds->highCol9 = getWeightedFactorUpperBound(weights.col9Coef, minCol9, maxCol9);
+  bounds->hole = getWeightedFactorUpperBound(weights.holeCoef, MIN_ADJUSTED_NUM_HOLES, 200);
+  bounds->inaccessibleLeft = getWeightedFactorUpperBound(weights.inaccessibleLeftCoef, minInaccessible, maxInaccessible);
+  bounds->inaccessibleRight = getWeightedFactorUpperBound(weights.inaccessibleRightCoef, minInaccessible, maxInaccessible);
+  bounds->lineClear = maxLineClear;
+  // calculateFlatness only subtracts from 30, but the surface ranks aren't bounded here
+  bounds->surface = USE_RANKS ? getWeightedFactorUpperBound(weights.surfaceCoef, -INFINITY, INFINITY) : getWeightedFactorUpperBound(weights.surfaceCoef, -INFINITY, 30);
+  bounds->surfaceLeft = getWeightedFactorUpperBound(weights.surfaceLeftCoef, -maxHeight, 0);
+  bounds->tetrisReady = max(0.0f, weights.tetrisReadyCoef);
+  bounds->unableToBurn = getWeightedFactorUpperBound(weights.unableToBurnCoef, 0, maxUnableToBurn);
+}
+
+float getEvalUpperBound(const EvalContext *evalContext){
+  if (USE_RANKS) {
+    return INFINITY; // The surface ranks aren't bounded here
+  }
+  EvalFactors bounds;
+  getEvalFactorUpperBounds(evalContext, &bounds);
+  float bound = 0;
+  bound += bounds.avgHeight;
+  bound += bounds.builtOutLeft;
+  bound += bounds.coveredWell;
+  bound += bounds.guaranteedBurns;
+  bound += bounds.likelyBurns;
+  bound += bounds.highCol9;
+  bound += bounds.hole;
+  bound += bounds.inaccessibleLeft;
+  bound += bounds.inaccessibleRight;
+  bound += bounds.lineClear;
+  bound += bounds.surface;
+  bound += bounds.surfaceLeft;
+  bound += bounds.tetrisReady;
+  bound += bounds.unableToBurn;
+  return max(evalContext->weights.deathCoef, bound);
+}
+
+void setEvalStageUpperBounds(OUT EvalContext *evalContext){
+  EvalFactors bounds;
+  getEvalFactorUpperBounds(evalContext, &bounds);
+  evalContext->surfaceUpperBound = bounds.surface;
+  evalContext->costlyFactorsUpperBound = bounds.builtOutLeft + bounds.coveredWell + bounds.guaranteedBurns + bounds.unableToBurn;
+}
+
+int toFixedPoint(float points){
+  return (int) lrintf(points * FIXED_POINT_SCALE);
+}
+
+float toScoreUnits(float points, const EvalContext *evalContext){
+  return evalContext->useFixedPoint ? toFixedPoint(points) : points;
+}
+
+float fromScoreUnits(float scoreUnits, const EvalContext *evalContext){
+  return evalContext->useFixedPoint ? scoreUnits / FIXED_POINT_SCALE : scoreUnits;
+}
+
+/** Encodes the weighted factors as a JSON array, in the same order as EVAL_FACTOR_NAMES, followed by the total. */
+std::string encodeEvalFactors(EvalFactors const *factors, float total){
+  std::string encoded = "[";
+  char buf[32];
+  for (EvalFactorName const &factorName : EVAL_FACTOR_NAMES) {
+    snprintf(buf, sizeof(buf), "%.3f,", factors->*factorName.field);
+    encoded.append(buf);
+  }
+  snprintf(buf, sizeof(buf), "%.3f]", total);
+  encoded.append(buf);
+  return encoded;
+}
+
+/* ----------- TESTS ----------- */
+
+/** Checks the table-driven surface factors against their original closed-form definitions, for every combination of heights up to the tallest (NUM_SURFACE_HEIGHTS - 1). */
+int testEvalTables() {
+  int numMismatches = 0;
+  PieceRangeContext pieceRangeContexts[2] = {getPieceRangeContext("X...", 3), getPieceRangeContext("X.........", 1)};
+
+  // Flatness: every triple of adjacent heights (the line dependency penalty looks at the column before each pair), in every set of columns
+  for (int prev = 0; prev < NUM_SURFACE_HEIGHTS; prev++) {
+    for (int a = 0; a < NUM_SURFACE_HEIGHTS; a++) {
+      for (int b = 0; b < NUM_SURFACE_HEIGHTS; b++) {
+        for (int i = 0; i < 9; i++) {
+          if (i == 0 && prev > 0) {
+            continue; // There's no column before the first pair
+          }
+          int8_t surface[10] = {};
+          if (i > 0) {
+            surface[i - 1] = prev;
+          }
+          surface[i] = a;
+          surface[i + 1] = b;
+          float expected = 30;
+          for (int j = 0; j < 9; j++) {
+            if (j + 1 == 9) {
+              continue;
+            }
+            int diff = surface[j + 1] - surface[j];
+            if (j == 7 && diff < -2) {
+              diff = -2;
+            }
+            if (diff != 0) {
+              expected -= pow(abs(diff), 1.5);
+            }
+            if (diff >= 3 && (j == 0 || surface[j - 1] + surface[j] >= 3)) {
+              expected -= 25;
+            }
+          }
+          if (calculateFlatness(surface, 9) != expected) {
+            printf("Flatness mismatch: col %d = %d, col %d = %d, col %d = %d\n", i - 1, prev, i, a, i + 1, b);
+            numMismatches++;
+          }
+        }
+      }
+    }
+  }
+
+  for (int a = 0; a < NUM_SURFACE_HEIGHTS; a++) {
+    for (int b = 0; b < NUM_SURFACE_HEIGHTS; b++) {
+      // Likely burns: every (col 8, col 9) pair, for every safe col 9 height
+      for (int maxSafeCol9 = -1; maxSafeCol9 < NUM_SURFACE_HEIGHTS; maxSafeCol9++) {
+        int8_t surface[10] = {};
+        surface[7] = a;
+        surface[8] = b;
+        int lowestGoodColumn9 = min(maxSafeCol9, a - 2);
+        float expected = b >= lowestGoodColumn9 ? 0 : ceil((lowestGoodColumn9 - b) / 2.0f) * 0.6;
+        if (getLikelyBurnsFactor(surface, 9, maxSafeCol9) != expected) {
+          printf("Likely burns mismatch: col8 = %d, col9 = %d, maxSafeCol9 = %d\n", a, b, maxSafeCol9);
+          numMismatches++;
+        }
+      }
+
+      // Inaccessible left/right: every height in every column, on top of every flat stack height. The slow tapping speed
+      // puts the accessible surface below the floor, so the stack can be further above it than the table covers.
+      for (PieceRangeContext const &pieceRangeContext : pieceRangeContexts) {
+        for (int col = 0; col < 10; col++) {
+          int8_t surface[10];
+          for (int i = 0; i < 10; i++) {
+            surface[i] = b;
+          }
+          surface[col] = a;
+          int highestAboveLeft = 0;
+          int highestAboveRight = 0;
+          for (int i = 0; i < 10; i++) {
+            int excessLeft = surface[i] - pieceRangeContext.maxAccessibleLeft5Surface[i];
+            int excessRight = surface[i] - pieceRangeContext.maxAccessibleRightSurface[i];
+            if (i < 7 && excessLeft > highestAboveLeft) {
+              highestAboveLeft = excessLeft;
+            }
+            if (i >= 5 && excessRight > highestAboveRight) {
+              highestAboveRight = excessRight;
+            }
+          }
+          int needs5Tap = surface[0] < surface[8];
+          float severity = (surface[0] > pieceRangeContext.maxAccessibleLeft5Surface[0] && !needs5Tap) ? 0.2f : 1.0f;
+          float expectedLeft = highestAboveLeft == 0 ? 0 : (1.0 + 0.2 * highestAboveLeft * highestAboveLeft) * severity;
+          int needsRightTap = surface[9] < surface[8];
+          float expectedRight = (surface[0] > pieceRangeContext.maxAccessibleRightSurface[0] && !needsRightTap) || highestAboveRight == 0
+            ? 0
+            : 1.0 + 0.2 * highestAboveRight * highestAboveRight;
+          if (getInaccessibleLeftFactor(surface, pieceRangeContext.maxAccessibleLeft5Surface, 9) != expectedLeft ||
+              getInaccessibleRightFactor(surface, pieceRangeContext.maxAccessibleRightSurface) != expectedRight) {
+            printf("Inaccessible factor mismatch: col %d = %d, others = %d\n", col, a, b);
+            numMismatches++;
+          }
+        }
+      }
+    }
+
+    // Left surface: a left column of every height, including the ones that stick out above the board
+    int emptyBoard[20] = {};
+    int8_t leftSurface[10] = {};
+    leftSurface[0] = a;
+    if (getLeftSurfaceFactor(emptyBoard, leftSurface, 0) != 0) {
+      printf("Left surface mismatch: col 0 = %d\n", a);
+      numMismatches++;
+    }
+
+    // Col 9: every height, for the contexts of every gravity and mode
+    for (int gravity = 1; gravity <= 3; gravity++) {
+      PieceRangeContext lookup[3] = {getPieceRangeContext("X...", 1), getPieceRangeContext("X...", 2), getPieceRangeContext("X...", 3)};
+      SearchConfig searchConfig = getDefaultSearchConfig();
+      GameState gameState = {{}, {}, 0, 0, 0, (uint8_t) (gravity == 1 ? 29 : gravity == 2 ? 19 : 18), {}};
+      EvalContext context = getEvalContext(gameState, lookup, &searchConfig);
+      float expected = a <= context.maxSafeCol9 ? 0 : (a - context.maxSafeCol9) * (a - context.maxSafeCol9);
+      if (context.col9FactorByHeight[a] != expected) {
+        printf("Col 9 mismatch: height = %d, gravity = %d\n", a, gravity);
+        numMismatches++;
+      }
+    }
+  }
+
+  printf("Eval table test complete. Mismatches: %d\n", numMismatches);
+  return numMismatches;
+}
@@ -1,11 +1,82 @@
 #ifndef EVAL
 #define EVAL
 
+#include <string>
 #include <vector>
 #include "types.hpp"
+#include "utils.hpp"
 
 float getLineClearFactor(int numLinesCleared, FastEvalWeights weights, int shouldRewardLineClears);
 
+float getCol9Factor(int col9Height, float maxSafeCol9Height);
+
+#define NUM_EVAL_FACTORS 14
+#define FIXED_POINT_SCALE 1000 // Fixed-point scores are in thousandths of a point
+
+#define MIN_ADJUSTED_NUM_HOLES 0 // Filling tuck setups only removes what they added to the hole counts
+
+/** Gets the hole count that scoring uses, where a tuck setup counts as TUCK_SETUP_HOLE_PROPORTION of a hole. */
+float getAdjustedNumHoles(GameState gameState);
+
+#define EVAL_BOUND_RELATIVE_MARGIN 0.0001 // How much a bounded eval pads its bound by, relative to the size of the factors
+#define EVAL_BOUND_ABSOLUTE_MARGIN 0.01   // ...and in points
+
+/** Counts how many bounded evals (see boundedFastEval) there were, and how many stopped after each stage. */
+struct EvalStageStats {
+  long long numEvals;
+  long long numCutAfterCheap;
+  long long numCutAfterSurface;
+};
+
+/** Gets an upper bound on each weighted factor under a given context, in points. It's INFINITY for the unbounded ones. */
+void getEvalFactorUpperBounds(const EvalContext *evalContext, OUT EvalFactors *bounds);
+
+/**
+ * Gets an upper bound on the fastEval score of any board under a given context, in points, using the range of each factor.
+ * Returns INFINITY if a factor with a positive weight is unbounded.
+ */
+float getEvalUpperBound(const EvalContext *evalContext);
+
+/** Precomputes the bounds on the later stages of a bounded eval for a context (which needs its weights and flags set already). */
+void setEvalStageUpperBounds(OUT EvalContext *evalContext);
+
+/** Rounds a value in points to integer milli-points. */
+int toFixedPoint(float points);
+
+/** Converts a value in points to the units that fastEval returns for a given context (integer milli-points in fixed-point mode). */
+float toScoreUnits(float points, const EvalContext *evalContext);
+
+/** Converts a value in the units that fastEval returns for a given context back to points. */
+float fromScoreUnits(float scoreUnits, const EvalContext *evalContext);
+
+struct EvalFactorName {
+  char const *name;
+  float EvalFactors::*field;
+};
+
+extern const EvalFactorName EVAL_FACTOR_NAMES[NUM_EVAL_FACTORS];
+
+/**
+ * Computes each weighted eval factor for a board, without any logging.
+ * @returns the same total as fastEval
+ */
+float getEvalFactors(GameState gameState, GameState newState, const EvalContext *evalContext, OUT EvalFactors *factors);
+
+/**
+ * Evaluates the board after a placement.
+ * @returns the total of the eval factors, in score units (see toScoreUnits)
+ */
 float fastEval(GameState gameState, GameState newState, LockPlacement lockPlacement, const EvalContext *evalContext);
 
+/**
+ * Evaluates the board after a placement for a caller that only needs the score if it beats a threshold, such as the best so far.
+ * The cheap factors go first, then the surface, then the costly factors. After each of the first two stages, the eval stops if
+ * the factors so far plus an upper bound on the rest (see getEvalFactorUpperBounds) can't beat the threshold.
+ * A threshold of -INFINITY is the same as calling fastEval. The stats can be null.
+ * @returns the same score as fastEval, or -INFINITY if it stopped early (and so the score was at most the threshold)
+ */
+float boundedFastEval(const GameState *gameState, const GameState *newState, LockPlacement lockPlacement, const EvalContext *evalContext, float threshold, OUT EvalStageStats *stageStats);
+
+std::string encodeEvalFactors(EvalFactors const *factors, float total);
+
 #endif
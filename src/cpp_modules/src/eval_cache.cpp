@@ -0,0 +1,99 @@
+#include "eval_cache.hpp"
+#include "eval.hpp"
+#include <chrono>
+#include <string.h>
+
+void initEvalCache(OUT EvalCache *evalCache, int isEnabled){
+  evalCache->isEnabled = isEnabled;
+  if (isEnabled) {
+    evalCache->entries.assign((size_t) 1 << EVAL_CACHE_SIZE_LOG2, {0, 0});
+  } else {
+    evalCache->entries.clear();
+  }
+  evalCache->mask = ((uint64_t) 1 << EVAL_CACHE_SIZE_LOG2) - 1;
+  evalCache->numLookups = 0;
+  evalCache->numHits = 0;
+  evalCache->numTimedMisses = 0;
+  evalCache->timedMissNanos = 0;
+  evalCache->stageStats = {};
+}
+
+inline uint64_t mixHash(uint64_t hash, uint64_t value){
+  hash ^= value;
+  hash *= 0x9E3779B97F4A7C15ULL;
+  return hash ^ (hash >> 29);
+}
+
+/** Hashes everything that fastEval depends on, other than the (fixed per request) weights and tapping speed. */
+uint64_t getEvalCacheKey(const GameState *gameState, const GameState *newState, const EvalContext *evalContext){
+  uint64_t hash = (uint64_t) evalContext->contextId;
+  for (int r = 0; r < 20; r += 2) {
+    hash = mixHash(hash, ((uint64_t) (uint32_t) newState->board[r] << 32) | (uint32_t) newState->board[r + 1]);
+  }
+  for (int c = 0; c < 10; c += 2) {
+    hash = mixHash(hash, ((uint64_t) (uint32_t) newState->surfaceArray[c] << 32) | (uint32_t) newState->surfaceArray[c + 1]);
+  }
+  uint32_t holeCounts = ((uint32_t) (uint16_t) newState->numHoles << 16) | (uint16_t) newState->numTuckSetups;
+  hash = mixHash(hash, ((uint64_t) holeCounts << 32) | (uint32_t) (newState->lines - gameState->lines));
+  return hash == 0 ? 1 : hash;
+}
+
+float cachedFastEval(GameState gameState, GameState newState, LockPlacement lockPlacement, const EvalContext *evalContext, EvalCache *evalCache){
+  return cachedBoundedFastEval(&gameState, &newState, lockPlacement, evalContext, -INFINITY, evalCache);
+}
+
+float cachedBoundedFastEval(const GameState *gameState, const GameState *newState, LockPlacement lockPlacement, const EvalContext *evalContext, float threshold, EvalCache *evalCache){
+  if (evalCache == nullptr) {
+    return boundedFastEval(gameState, newState, lockPlacement, evalContext, threshold, nullptr);
+  }
+  if (!evalCache->isEnabled) {
+    return boundedFastEval(gameState, newState, lockPlacement, evalContext, threshold, &evalCache->stageStats);
+  }
+  evalCache->numLookups++;
+  uint64_t key = getEvalCacheKey(gameState, newState, evalContext);
+  uint64_t homeIndex = key & evalCache->mask;
+  EvalCacheEntry *insertSlot = &evalCache->entries[homeIndex]; // Replace the home slot if the probe window is full
+  for (int i = 0; i < EVAL_CACHE_MAX_PROBES; i++) {
+    EvalCacheEntry *entry = &evalCache->entries[(homeIndex + i) & evalCache->mask];
+    if (entry->key == key) {
+      evalCache->numHits++;
+      return entry->score;
+    }
+    if (entry->key == 0) {
+      insertSlot = entry;
+      break;
+    }
+  }
+
+  // Miss: evaluate, timing a sample of the evals to estimate what the hits saved
+  float score;
+  long long numMisses = evalCache->numLookups - evalCache->numHits;
+  if (numMisses % EVAL_CACHE_TIMING_INTERVAL == 0) {
+    auto startTime = std::chrono::steady_clock::now();
+    score = boundedFastEval(gameState, newState, lockPlacement, evalContext, threshold, &evalCache->stageStats);
+    if (score != -INFINITY) { // A hit saves a whole eval, so only time the ones that finish
+      evalCache->timedMissNanos += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+      evalCache->numTimedMisses++;
+    }
+  } else {
+    score = boundedFastEval(gameState, newState, lockPlacement, evalContext, threshold, &evalCache->stageStats);
+  }
+  if (score == -INFINITY) {
+    return score; // Stopped early, so there's no score to cache
+  }
+  insertSlot->key = key;
+  insertSlot->score = score;
+  return score;
+}
+
+std::string encodeEvalCacheStats(const EvalCache *evalCache){
+  double hitRate = evalCache->numLookups == 0 ? 0 : (double) evalCache->numHits / evalCache->numLookups;
+  double nanosPerEval = evalCache->numTimedMisses == 0 ? 0 : evalCache->timedMissNanos / evalCache->numTimedMisses;
+  const EvalStageStats *stageStats = &evalCache->stageStats;
+  char buf[300];
+  snprintf(buf, sizeof(buf), "\"evalCacheLookups\":%lld,\"evalCacheHitRate\":%f,\"evalCacheMsSaved\":%f,"
+           "\"boundedEvals\":%lld,\"evalCutAfterCheap\":%lld,\"evalCutAfterSurface\":%lld",
+           evalCache->numLookups, hitRate, evalCache->numHits * nanosPerEval / 1e6,
+           stageStats->numEvals, stageStats->numCutAfterCheap, stageStats->numCutAfterSurface);
+  return std::string(buf);
+}
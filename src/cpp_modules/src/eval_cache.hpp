@@ -0,0 +1,53 @@
+#ifndef EVAL_CACHE
+#define EVAL_CACHE
+
+#include "types.hpp"
+#include "utils.hpp"
+#include "eval.hpp"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#define EVAL_CACHE_SIZE_LOG2 16      // 64K entries (1MB), allocated once per request
+#define EVAL_CACHE_MAX_PROBES 4      // How far a lookup walks from its home slot before giving up
+#define EVAL_CACHE_TIMING_INTERVAL 16 // Time one in every N misses, to estimate the time saved by hits
+
+struct EvalCacheEntry {
+  uint64_t key; // 0 marks an empty slot
+  float score;
+};
+
+/**
+ * A bounded, open-addressing memo of fastEval scores, keyed on a hash of the resulting board, surface, hole count,
+ * lines cleared and eval context. Lives for the duration of one request.
+ */
+struct EvalCache {
+  int isEnabled; // If not, there are no entries, and evals go straight to boundedFastEval (but still count towards the stage stats)
+  std::vector<EvalCacheEntry> entries;
+  uint64_t mask;
+  long long numLookups;
+  long long numHits;
+  long long numTimedMisses;
+  double timedMissNanos;
+  EvalStageStats stageStats; // For the bounded evals of the whole request, including the ones that don't go through the cache
+};
+
+void initEvalCache(OUT EvalCache *evalCache, int isEnabled);
+
+/**
+ * Gets the fastEval score of a placement, using the cache if possible.
+ * A null or disabled cache falls back to calling fastEval directly.
+ */
+float cachedFastEval(GameState gameState, GameState newState, LockPlacement lockPlacement, const EvalContext *evalContext, EvalCache *evalCache);
+
+/**
+ * Gets the score of a placement if it beats a threshold (see boundedFastEval), using the cache if possible.
+ * Only evals that finish are cached. A null or disabled cache falls back to calling boundedFastEval directly.
+ * @returns the score, or -INFINITY if it stopped early
+ */
+float cachedBoundedFastEval(const GameState *gameState, const GameState *newState, LockPlacement lockPlacement, const EvalContext *evalContext, float threshold, EvalCache *evalCache);
+
+/** Encodes the hit rate, estimated time saved and bounded eval stage exits as comma-separated JSON fields (without the surrounding braces). */
+std::string encodeEvalCacheStats(const EvalCache *evalCache);
+
+#endif
@@ -1,7 +1,9 @@
 #include "eval_context.hpp"
+#include "eval.hpp"
 #include <math.h>
 
 const EvalContext DEBUG_CONTEXT = {
+  /* contextId= */ 0,
   /* aiMode= */ STANDARD,
   /* fastEvalWeights= */ MAIN_WEIGHTS,
   /* pieceRangeContext= */ {},
@@ -11,6 +13,11 @@ const EvalContext DEBUG_CONTEXT = {
   /* scareHeight= */ 5,
   /* shouldRewardLineClears= */ false,
   /* wellColumn= */ 9,
+  /* col9FactorByHeight= */ {},
+  /* isLightEval= */ false,
+  /* useFixedPoint= */ false,
+  /* surfaceUpperBound= */ 0,
+  /* costlyFactorsUpperBound= */ 0,
 };
 
 int hasHoleBlockingTetrisReady(int board[20], int col10Height){
@@ -26,13 +33,6 @@ int hasHoleBlockingTetrisReady(int board[20], int col10Height){
   return false;
 }
 
-/** Gets the number of holes that are holes and not tuck setups*/
-int getNumTrueHoles(float adjustedNumHoles){
-  while (std::abs(adjustedNumHoles - round(adjustedNumHoles)) > FLOAT_EPSILON) {
-    adjustedNumHoles -= TUCK_SETUP_HOLE_PROPORTION;
-  }
-  return (int) adjustedNumHoles;
-}
 
 AiMode getAiMode(GameState gameState, int currentMax5TapHeight, int max5TapHeight29) {
   if (currentMax5TapHeight < 4) {
@@ -44,7 +44,7 @@ AiMode getAiMode(GameState gameState, int currentMax5TapHeight, int max5TapHeigh
     }
     return NEAR_KILLSCREEN;
   }
-  if (getNumTrueHoles(gameState.adjustedNumHoles) >= 1) {
+  if (gameState.numHoles >= 1) {
     return DIG;
   }
   // Optionally play very safe on killscreen
@@ -54,23 +54,24 @@ AiMode getAiMode(GameState gameState, int currentMax5TapHeight, int max5TapHeigh
   return STANDARD;
 }
 
-const EvalContext getEvalContext(GameState gameState, const PieceRangeContext pieceRangeContextLookup[]){
+/** Builds the eval context for a given gravity and mode. Nothing else about the game state affects the context. */
+const EvalContext buildEvalContext(int gravity, AiMode aiMode, const PieceRangeContext pieceRangeContextLookup[], const SearchConfig *searchConfig){
   EvalContext context = {};
 
   // Copy the piece range context from the global lookup
-  context.pieceRangeContext = pieceRangeContextLookup[getGravity(gameState.level) - 1];
+  context.pieceRangeContext = pieceRangeContextLookup[gravity - 1];
 
   // Set the mode
-  AiMode aiMode = getAiMode(gameState, context.pieceRangeContext.max5TapHeight, pieceRangeContextLookup[0].max5TapHeight);
   context.aiMode = aiMode;
-  context.weights = getWeights(context.aiMode);
+  context.contextId = (gravity - 1) * 6 + aiMode;
+  context.weights = searchConfig->weightsByMode[context.aiMode];
 
   // Set the scare heights
   if (aiMode == LINEOUT) {
     context.scareHeight = 0;
     context.maxSafeCol9 = -1;
   } else {
-    int lowerScareHeight = (PLAY_SAFE_PRE_KILLSCREEN && gameState.level < 29);
+    int lowerScareHeight = (PLAY_SAFE_PRE_KILLSCREEN && gravity > 1); // i.e. before level 29
     context.scareHeight = context.pieceRangeContext.max5TapHeight - (lowerScareHeight ? 4.5 : 3);
     context.maxSafeCol9 = context.pieceRangeContext.max4TapHeight - (lowerScareHeight ? 7 : 5);
 
@@ -90,7 +91,79 @@ const EvalContext getEvalContext(GameState gameState, const PieceRangeContext pi
   // context.countWellHoles = context.aiMode == DIG;
   context.countWellHoles = false;
   context.shouldRewardLineClears = (aiMode == LINEOUT || aiMode == DIRTY_NEAR_KILLSCREEN);
+  context.useFixedPoint = searchConfig->useFixedPoint;
+
+  // Precompute the factors that only depend on the context and a single column height
+  for (int height = 0; height < NUM_SURFACE_HEIGHTS; height++) {
+    context.col9FactorByHeight[height] = getCol9Factor(height, context.maxSafeCol9);
+  }
+  setEvalStageUpperBounds(&context);
 
   return context;
 }
 
+
+const EvalContext getEvalContext(GameState gameState, const PieceRangeContext pieceRangeContextLookup[], const SearchConfig *searchConfig){
+  int gravity = getGravity(gameState.level);
+  AiMode aiMode = getAiMode(gameState, pieceRangeContextLookup[gravity - 1].max5TapHeight, pieceRangeContextLookup[0].max5TapHeight);
+  return buildEvalContext(gravity, aiMode, pieceRangeContextLookup, searchConfig);
+}
+
+void initEvalContextTable(const PieceRangeContext pieceRangeContextLookup[], const SearchConfig *searchConfig, OUT EvalContextTable *table){
+  for (int gravity = 1; gravity <= 3; gravity++) {
+    for (int mode = 0; mode < 6; mode++) {
+      EvalContext context = buildEvalContext(gravity, (AiMode) mode, pieceRangeContextLookup, searchConfig);
+      table->contexts[context.contextId] = context;
+      table->maxEvalScoreByContext[context.contextId] = getEvalUpperBound(&context); // Playouts only ever score with the full contexts
+      context.isLightEval = true;
+      setEvalStageUpperBounds(&context);
+      table->lightContexts[context.contextId] = context;
+      table->lightContexts[context.contextId].contextId += NUM_EVAL_CONTEXTS;
+    }
+  }
+}
+
+/** Whether getAiMode() can return a mode at some point within the given range of levels and lines. */
+int canReachAiMode(AiMode aiMode, int gravity, int minLevel, int maxLines, const EvalContextTable *table){
+  int isLineout = table->contexts[(gravity - 1) * 6].pieceRangeContext.max5TapHeight < 4;
+  if (aiMode == LINEOUT || isLineout) {
+    return aiMode == LINEOUT && isLineout;
+  }
+  if (aiMode == NEAR_KILLSCREEN || aiMode == DIRTY_NEAR_KILLSCREEN) {
+    return table->contexts[0].pieceRangeContext.max5TapHeight < 2 && maxLines > 220 && minLevel < 29;
+  }
+  return true; // The rest depend on the board
+}
+
+void getPlayoutContextBounds(GameState gameState, int numPieces, const EvalContextTable *table, const SearchConfig *searchConfig, OUT float *maxEvalScore, OUT float *maxLineClearReward){
+  // Clearing a tetris every piece reaches the most lines, and so the highest level
+  int maxLevel = gameState.level;
+  int maxLines = gameState.lines;
+  for (int i = 0; i < numPieces; i++) {
+    maxLevel = getLevelAfterLineClears(maxLevel, maxLines, 4);
+    maxLines += 4;
+  }
+
+  *maxEvalScore = -INFINITY;
+  *maxLineClearReward = -INFINITY;
+  for (int gravity = getGravity(maxLevel); gravity <= getGravity(gameState.level); gravity++) {
+    for (int mode = 0; mode < 6; mode++) {
+      if (!canReachAiMode((AiMode) mode, gravity, gameState.level, maxLines, table)) {
+        continue;
+      }
+      const EvalContext *context = &table->contexts[(gravity - 1) * 6 + mode];
+      *maxEvalScore = max(*maxEvalScore, table->maxEvalScoreByContext[context->contextId]);
+      for (int numLinesCleared = 0; numLinesCleared <= 4; numLinesCleared++) {
+        // Playouts reward line clears in DIG mode at standard weights (see playSequencesSharingPrefixes)
+        FastEvalWeights rewardWeights = mode == DIG ? searchConfig->weightsByMode[STANDARD] : context->weights;
+        *maxLineClearReward = max(*maxLineClearReward, getLineClearFactor(numLinesCleared, rewardWeights, context->shouldRewardLineClears));
+      }
+    }
+  }
+}
+
+const EvalContext *lookupEvalContext(GameState gameState, const EvalContextTable *table){
+  int gravity = getGravity(gameState.level);
+  AiMode aiMode = getAiMode(gameState, table->contexts[(gravity - 1) * 6].pieceRangeContext.max5TapHeight, table->contexts[0].pieceRangeContext.max5TapHeight);
+  return &table->contexts[(gravity - 1) * 6 + aiMode];
+}
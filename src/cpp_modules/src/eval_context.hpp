@@ -1,3 +1,18 @@
 #include "types.hpp"
+#include "utils.hpp"
 
-const EvalContext getEvalContext(GameState gameState, const PieceRangeContext pieceRangeContextLookup[]);
+const EvalContext getEvalContext(GameState gameState, const PieceRangeContext pieceRangeContextLookup[], const SearchConfig *searchConfig);
+
+/** Prebuilds every eval context that a request can use (one per gravity and mode), so that playouts don't rebuild them each step. */
+void initEvalContextTable(const PieceRangeContext pieceRangeContextLookup[], const SearchConfig *searchConfig, OUT EvalContextTable *table);
+
+/** Gets the eval context for a game state from the prebuilt table. Equivalent to getEvalContext(). */
+const EvalContext *lookupEvalContext(GameState gameState, const EvalContextTable *table);
+
+/**
+ * Bounds what a playout of the given number of pieces from this state can score, over every context it could reach along the way
+ * (the level only goes up, and only by so much, and some modes only happen at certain levels).
+ * @param maxEvalScore - receives the best fastEval score of a reachable context, in points
+ * @param maxLineClearReward - receives the best reward for one line clear in a reachable context, in points
+ */
+void getPlayoutContextBounds(GameState gameState, int numPieces, const EvalContextTable *table, const SearchConfig *searchConfig, OUT float *maxEvalScore, OUT float *maxLineClearReward);
@@ -8,16 +8,19 @@ const int SCORE_REWARDS[] = {
   1200
 };
 
-int simulateGame(char const *inputFrameTimeline, int startingLevel, int maxLines){
+int simulateGame(char const *inputFrameTimeline, int startingLevel, int maxLines, const SearchConfig *searchConfig){
   // Init empty data structures
   GameState gameState = {
     /* board= */ {},
     /* surfaceArray= */ {},
-    /* adjustedNumHole= */ 0,
+    /* numHoles= */ 0,
+    /* numTuckSetups= */ 0,
     /* lines= */ 0,
-    /* level= */ startingLevel
+    /* level= */ startingLevel,
+    /* columns= */ {}
   };
-  getSurfaceArray(gameState.board, gameState.surfaceArray);
+  getColumns(gameState.board, gameState.columns);
+  getSurfaceArray(gameState.columns, gameState.surfaceArray);
   Piece curPiece;
   Piece nextPiece = PIECE_LIST[qualityRandom(0,7)];
 
@@ -27,6 +30,8 @@ int simulateGame(char const *inputFrameTimeline, int startingLevel, int maxLines
     getPieceRangeContext(inputFrameTimeline, 2),
     getPieceRangeContext(inputFrameTimeline, 3),
   };
+  EvalContextTable evalContextTable;
+  initEvalContextTable(pieceRangeContextLookup, searchConfig, &evalContextTable);
   int score = 0;
 
   while (true) {
@@ -35,20 +40,18 @@ int simulateGame(char const *inputFrameTimeline, int startingLevel, int maxLines
     nextPiece = getRandomPiece(curPiece);
     
     // Figure out modes and eval context
-    const EvalContext evalContextRaw = getEvalContext(gameState, pieceRangeContextLookup);
-    const EvalContext *evalContext = &evalContextRaw;
-    FastEvalWeights weights = getWeights(evalContext->aiMode);
+    const EvalContext *evalContext = lookupEvalContext(gameState, &evalContextTable);
 
     // Get the lock placements
     std::vector<LockPlacement> lockPlacements;
-    moveSearch(gameState, &curPiece, evalContext->pieceRangeContext.inputFrameTimeline, lockPlacements);
+    moveSearch(gameState, &curPiece, evalContext->pieceRangeContext.inputFrameTimeline, searchConfig->canTuck, lockPlacements);
 
     if (lockPlacements.size() == 0) {
       break;
     }
 
     // Pick the best placement
-    LockPlacement bestMove = pickLockPlacement(gameState, evalContext, lockPlacements);
+    LockPlacement bestMove = pickLockPlacement(gameState, evalContext, /* evalCache= */ nullptr, /* topK= */ 0, lockPlacements);
 
     // Otherwise, update the state to keep playing
     int oldLines = gameState.lines;
@@ -68,8 +71,8 @@ int simulateGame(char const *inputFrameTimeline, int startingLevel, int maxLines
   return score;
 }
 
-void simulateGames(int numGames, char const *inputFrameTimeline, int startingLevel, int maxLines, int reactionTime, OUT std::vector<int> scores){
+void simulateGames(int numGames, char const *inputFrameTimeline, int startingLevel, int maxLines, int reactionTime, const SearchConfig *searchConfig, OUT std::vector<int> scores){
   for (int i = 0; i < numGames; i++){
-    scores.push_back(simulateGame(inputFrameTimeline, startingLevel, maxLines));
+    scores.push_back(simulateGame(inputFrameTimeline, startingLevel, maxLines, searchConfig));
   }
 }
@@ -1,2 +1,2 @@
 
-void simulateGames(int numGames, int startingLevel, char const *inputFrameTimeline, int reactionTime);
+void simulateGames(int numGames, char const *inputFrameTimeline, int startingLevel, int maxLines, int reactionTime, const SearchConfig *searchConfig, OUT std::vector<int> scores);
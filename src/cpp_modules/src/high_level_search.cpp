@@ -2,44 +2,267 @@
 #include <string>
 #include <unordered_map>
 #include "params.hpp"
+#include "value_function.hpp"
+#include <chrono>
 using namespace std;
 
 #define UNEXPLORED_PENALTY -500   // A penalty for placements that weren't explored with playouts (could be worse than the eval indicates)
 #define MAP_OFFSET 20000          // An offset to make any placement better than the default 0 in the map
 
+Depth2Search DEPTH2_SEARCH = {}; // Kept between requests, so that its buffers are reused
+
 /** Concatenates the position of a piece into a single string. */
-std::string encodeLockPosition(LockLocation lockLocation){
-  char buffer[10];
-  sprintf(buffer, "%d|%d|%d", lockLocation.rotationIndex, lockLocation.x, lockLocation.y);
+std::string encodeLockPosition(LockPlacement lockPlacement){
+  char buffer[32];
+  sprintf(buffer, "%d|%d|%d", lockPlacement.rotationIndex, lockPlacement.x, lockPlacement.y);
   return string(buffer);
 }
 
+/**
+ * Breaks down the eval of the board after each of the top N lock positions into its weighted factors.
+ * @returns a JSON object of the form {"factors": [...names], "placements": {"rot|x|y": [...values, total]}}
+ */
+std::string encodeExplanations(GameState gameState, const Piece *firstPiece, const EvalContext *evalContext, Depth2Search const &search, unordered_map<string, float> const &lockValueMap, int explainTopN){
+  // Find the top N lock positions by overall value
+  vector<pair<float, string>> sortedLockValues;
+  for (const auto& n : lockValueMap) {
+    sortedLockValues.push_back({n.second, n.first});
+  }
+  int numToExplain = min(explainTopN, (int) sortedLockValues.size());
+  partial_sort(sortedLockValues.begin(), sortedLockValues.begin() + numToExplain, sortedLockValues.end(), greater<pair<float, string>>());
+  unordered_map<string, int> remainingToExplain;
+  for (int i = 0; i < numToExplain; i++) {
+    remainingToExplain[sortedLockValues[i].second] = 1;
+  }
+
+  std::string encoded = "{\"factors\":[";
+  for (EvalFactorName const &factorName : EVAL_FACTOR_NAMES) {
+    encoded.append("\"" + string(factorName.name) + "\",");
+  }
+  encoded.append("\"total\"],\"placements\":{");
+  for (int index : search.order) {
+    LockPlacement firstPlacement = search.firstPlacements[search.possibilities[index].firstPlacementIndex];
+    string lockPosEncoded = encodeLockPosition(firstPlacement);
+    if (!remainingToExplain[lockPosEncoded]) {
+      continue;
+    }
+    remainingToExplain[lockPosEncoded] = 0;
+    LockPlacement lockPlacement = {firstPlacement.x, firstPlacement.y, firstPlacement.rotationIndex, -1, '.', firstPiece};
+    GameState newState = advanceGameState(gameState, lockPlacement, evalContext);
+    EvalFactors factors;
+    float total = getEvalFactors(gameState, newState, evalContext, &factors);
+    encoded.append("\"" + lockPosEncoded + "\":" + encodeEvalFactors(&factors, total) + ",");
+  }
+  if (encoded.back() == ',') {
+    encoded.pop_back();
+  }
+  encoded.append("}}");
+  return encoded;
+}
+
+/**
+ * Encodes the playout statistics of each played-out lock position, along with a control-variate-adjusted value.
+ * The depth 2 eval is known exactly for every candidate and correlates with the playout value, so the playout values are regressed
+ * on it across candidates. Each candidate's adjusted value then blends its own playout value with the regression's prediction,
+ * weighted by their precisions (the playout's squared standard error vs. the spread of candidates around the regression line).
+ * Candidates with noisy playouts lean more on the prediction.
+ * @returns a JSON object of the form {"regression": {...}, "placements": {"rot|x|y": {...}}}
+ */
+std::string encodePlayoutStats(unordered_map<string, CandidatePlayoutStats> const &candidateStatsMap){
+  // Fit value ~ intercept + slope * evalValue across the candidates
+  int n = (int) candidateStatsMap.size();
+  double meanX = 0, meanY = 0, meanSquaredError = 0;
+  for (const auto& entry : candidateStatsMap) {
+    meanX += entry.second.evalValue / n;
+    meanY += entry.second.value / n;
+    meanSquaredError += entry.second.playoutStats.meanVariance / n;
+  }
+  double sxx = 0, sxy = 0;
+  for (const auto& entry : candidateStatsMap) {
+    sxx += (entry.second.evalValue - meanX) * (entry.second.evalValue - meanX);
+    sxy += (entry.second.evalValue - meanX) * (entry.second.value - meanY);
+  }
+  int canRegress = n >= 3 && sxx > 0;
+  double slope = canRegress ? sxy / sxx : 0;
+  double intercept = meanY - slope * meanX;
+  double residualVariance = 0;
+  for (const auto& entry : candidateStatsMap) {
+    double residual = entry.second.value - (intercept + slope * entry.second.evalValue);
+    residualVariance += canRegress ? residual * residual / (n - 2) : 0;
+  }
+  // The spread of the true values around the line, i.e. the residual variance minus the part due to playout noise.
+  // Floored, so that the noise estimate alone can't discard the playouts entirely.
+  double trueVariance = max(residualVariance - meanSquaredError, residualVariance * 0.1);
+
+  char buf[300];
+  snprintf(buf, sizeof(buf), "{\"regression\":{\"intercept\":%f,\"slope\":%f,\"residualVariance\":%f},\"placements\":{", intercept, slope, residualVariance);
+  std::string encoded = buf;
+  for (const auto& entry : candidateStatsMap) {
+    CandidatePlayoutStats const &stats = entry.second;
+    double squaredError = stats.playoutStats.meanVariance;
+    double prediction = intercept + slope * stats.evalValue;
+    double adjustedValue = (!canRegress || squaredError <= 0 || trueVariance <= 0)
+      ? stats.value
+      : (stats.value / squaredError + prediction / trueVariance) / (1 / squaredError + 1 / trueVariance);
+    snprintf(buf, sizeof(buf), "\"%s\":{\"n\":%d,\"mean\":%f,\"variance\":%f,\"stdErr\":%f,\"evalValue\":%f,\"adjusted\":%f},",
+             entry.first.c_str(), stats.playoutStats.numPlayouts, stats.value, stats.playoutStats.playoutVariance, sqrt(squaredError), stats.evalValue, adjustedValue);
+    encoded.append(buf);
+  }
+  if (encoded.back() == ',') {
+    encoded.pop_back();
+  }
+  encoded.append("}}");
+  return encoded;
+}
+
+/** Gets the value that a lock position has to beat to make the top N so far, or -INFINITY if fewer than N lock positions have values. */
+float getNthBestLockValue(unordered_map<string, float> const &lockValueMap, int n){
+  if ((int) lockValueMap.size() < n) {
+    return -INFINITY;
+  }
+  vector<float> values;
+  for (auto const &entry : lockValueMap) {
+    values.push_back(entry.second);
+  }
+  nth_element(values.begin(), values.begin() + (n - 1), values.end(), greater<float>());
+  return values[n - 1];
+}
+
 /** Calculates the valuation of every possible terminal position for a given piece on a given board, and stores it in a map. */
-std::string getLockValueLookupEncoded(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, const PieceRangeContext pieceRangeContextLookup[3]){
+std::string getLockValueLookupEncoded(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig){
   unordered_map<string, float> lockValueMap;
   unordered_map<string, int> lockValueRepeatMap;
+  unordered_map<string, CandidatePlayoutStats> candidateStatsMap; // For the lock positions whose best value came from playouts
+  if (searchConfig->targetLatencyMs > 0) {
+    getPlayoutStepCostMs(); // Make sure calibration (done by the first such request) isn't counted against this request
+  }
+  auto startTime = std::chrono::steady_clock::now();
   int numSorted = keepTopN * 2;
+  EvalCache evalCache;
+  initEvalCache(&evalCache, searchConfig->useEvalCache);
+
+  // Get the evaluated possibilities
+  Depth2Search &search = DEPTH2_SEARCH;
+  int numPossibilities = searchDepth2(gameState, firstPiece, secondPiece, numSorted, evalContext, searchConfig, &search, &evalCache.stageStats);
 
-  // Get the list of evaluated possibilities
-  list<Depth2Possibility> possibilityList;
-  searchDepth2(gameState, firstPiece, secondPiece, numSorted, evalContext, possibilityList);
+  // With a value function, only the first few candidates get real playouts, and the rest of the playout breadth gets estimates
+  const ValueFunction *valueFunction = getValueFunction(searchConfig);
+  int numRealPlayouts = valueFunction != nullptr ? min(keepTopN, searchConfig->valuePlayoutTopN) : keepTopN;
+  FILE *valueSampleFile = searchConfig->valueSampleFile[0] != '\0' ? fopen(searchConfig->valueSampleFile, "a") : nullptr;
+
+  // If there's a target latency, fit the playouts into the time that's left
+  SearchConfig playoutConfig = *searchConfig;
+  PlayoutBudget playoutBudget = {};
+  if (searchConfig->targetLatencyMs > 0) {
+    double msBeforePlayouts = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    playoutBudget = getPlayoutBudget(searchConfig, msBeforePlayouts, min(numRealPlayouts, numPossibilities));
+    numRealPlayouts = playoutBudget.numCandidates;
+    if (valueFunction == nullptr) {
+      keepTopN = numRealPlayouts;
+    }
+    playoutConfig.numPlayoutsShort = playoutBudget.numPlayoutsShort;
+    playoutConfig.playoutLengthShort = playoutBudget.playoutLengthShort;
+    playoutConfig.numPlayoutsLong = playoutBudget.numPlayoutsLong;
+    playoutConfig.playoutLengthLong = playoutBudget.playoutLengthLong;
+  }
 
   // Perform playouts on the promising possibilities
   int i = 0;
   int numPlayedOut = 0;
-  for (Depth2Possibility const& possibility : possibilityList) {
-    string lockPosEncoded = encodeLockPosition(possibility.firstPlacement);
+  int numCandidatesCutOff = 0;
+  int numCandidatesEligible = 0;
+  int numPlayoutsCutOff = 0;
+  int numValueEstimates = 0;
+  double valueEstimateMs = 0;
+  double valueResidualTotal = 0; // How much the real playouts beat the value function's estimates by, to correct the rest for this board
+  int numValueResiduals = 0;
+  // Where each lock position last comes up among the possibilities that can be played out, for the playout cutoffs
+  unordered_map<string, int> lastPlayoutChanceByLockPos;
+  if (searchConfig->playoutCutoffRank > 0) {
+    for (int j = 0; j < min(numSorted, (int) search.order.size()); j++) {
+      lastPlayoutChanceByLockPos[encodeLockPosition(search.firstPlacements[search.possibilities[search.order[j]].firstPlacementIndex])] = j;
+    }
+  }
+  for (int index : search.order) {
+    Depth2Possibility const &possibility = search.possibilities[index];
+    string lockPosEncoded = encodeLockPosition(search.firstPlacements[possibility.firstPlacementIndex]);
     // Cap the number of times a lock position can be repeated (despite differing second placements)
     int shouldPlayout = i < numSorted && numPlayedOut < keepTopN && lockValueRepeatMap[lockPosEncoded] < 3;
+    int isEstimated = shouldPlayout && numPlayedOut >= numRealPlayouts;
+    if (shouldPlayout && !isEstimated && searchConfig->targetLatencyMs > 0 && numPlayedOut > 0) {
+      // Playouts on this board may cost more than calibrated, so stop early if the next one is projected to overrun
+      double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+      double msPerCandidate = (elapsedMs - playoutBudget.msBeforePlayouts) / numPlayedOut;
+      if (elapsedMs + msPerCandidate > searchConfig->targetLatencyMs) {
+        // Fall back on the value function's estimates if there is one, or else on the eval
+        numRealPlayouts = numPlayedOut;
+        isEstimated = valueFunction != nullptr;
+        if (valueFunction == nullptr) {
+          shouldPlayout = false;
+          keepTopN = numPlayedOut;
+        }
+      }
+    }
+    // A candidate's playouts can stop early once they provably can't matter:
+    //  - If they can't beat the value its lock position already has, the map doesn't change at all.
+    //  - Otherwise, if they can't reach the Nth best lock value, the lock position stays out of the top N (with its bound as its value,
+    //    rather than its full score). That's only safe when the lock position doesn't come up for playouts again, since the value it
+    //    ends up with decides whether later candidates there count towards its repeat cap, and so which candidates get played out.
+    PlayoutCutoff cutoff = {};
+    int canCutOff = shouldPlayout && !isEstimated && searchConfig->playoutCutoffRank > 0;
+    if (canCutOff) {
+      auto existingValue = lockValueMap.find(lockPosEncoded);
+      float threshold = existingValue != lockValueMap.end() ? existingValue->second : -INFINITY;
+      if (lastPlayoutChanceByLockPos[lockPosEncoded] == i) {
+        threshold = max(threshold, getNthBestLockValue(lockValueMap, searchConfig->playoutCutoffRank));
+      }
+      canCutOff = threshold > -INFINITY;
+      cutoff.threshold = threshold - MAP_OFFSET - possibility.immediateReward;
+      numCandidatesEligible += canCutOff;
+    }
+    // Only the candidates that get played out or estimated need their resulting state
+    GameState resultingState = shouldPlayout ? getResultingState(&search, &possibility, evalContext) : gameState;
+    PlayoutStats playoutStats = {};
+    float playoutScore = 0;
+    if (isEstimated) {
+      auto estimateStartTime = std::chrono::steady_clock::now();
+      float features[VALUE_FEATURE_STRIDE];
+      getValueFeatures(resultingState, evalContextTable, features);
+      playoutScore = estimateValue(valueFunction, features) + (numValueResiduals > 0 ? valueResidualTotal / numValueResiduals : 0);
+      valueEstimateMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - estimateStartTime).count();
+      numValueEstimates++;
+    } else if (shouldPlayout) {
+      playoutScore = getPlayoutScore(resultingState, evalContextTable, &playoutConfig, &evalCache, secondPiece->index, &playoutStats, canCutOff ? &cutoff : nullptr);
+    }
     float overallScore = MAP_OFFSET + (shouldPlayout
-      ? possibility.immediateReward + getPlayoutScore(possibility.resultingState, pieceRangeContextLookup, secondPiece->index)
+      ? possibility.immediateReward + playoutScore
       : possibility.immediateReward + possibility.evalScore + UNEXPLORED_PENALTY);
+    if (cutoff.isCutOff) {
+      numCandidatesCutOff++;
+      numPlayoutsCutOff += cutoff.numPlayoutsCutOff;
+    } else if (shouldPlayout && !isEstimated && (valueFunction != nullptr || valueSampleFile != nullptr)) {
+      float features[VALUE_FEATURE_STRIDE];
+      getValueFeatures(resultingState, evalContextTable, features);
+      if (valueFunction != nullptr) {
+        valueResidualTotal += playoutScore - estimateValue(valueFunction, features);
+        numValueResiduals++;
+      }
+      if (valueSampleFile != nullptr) {
+        appendValueSample(valueSampleFile, features, playoutScore);
+      }
+    }
     if (overallScore > lockValueMap[lockPosEncoded]) {
       if (PLAYOUT_LOGGING_ENABLED) {
         printf("Adding to map: %s %f (%f + %f)\n", lockPosEncoded.c_str(), overallScore - MAP_OFFSET, possibility.immediateReward, overallScore - possibility.immediateReward - MAP_OFFSET);
       }
       lockValueMap[lockPosEncoded] = overallScore;
       lockValueRepeatMap[lockPosEncoded] += 1;
+      // Only real, finished playouts have stats, so estimates and cut candidates stay out of the regression
+      if (shouldPlayout && !isEstimated && !cutoff.isCutOff) {
+        candidateStatsMap[lockPosEncoded] = {playoutStats, overallScore - MAP_OFFSET, possibility.immediateReward + possibility.evalScore};
+      } else {
+        candidateStatsMap.erase(lockPosEncoded);
+      }
     }
     i++;
     if (shouldPlayout) {
@@ -47,14 +270,50 @@ std::string getLockValueLookupEncoded(GameState gameState, const Piece *firstPie
     }
   }
 
+  if (valueSampleFile != nullptr) {
+    fclose(valueSampleFile);
+  }
+
   // Encode lookup to JSON
   std::string mapEncoded = std::string("{");
   for( const auto& n : lockValueMap ) {
-    char buf[20];
+    char buf[64];
     sprintf(buf, "\"%s\":%f,", n.first.c_str(), n.second - MAP_OFFSET);
     mapEncoded.append(buf);
   }
-  if (lockValueMap.size() > 0) {
+  if (searchConfig->explainTopN > 0) {
+    mapEncoded.append("\"_explain\":" + encodeExplanations(gameState, firstPiece, evalContext, search, lockValueMap, searchConfig->explainTopN) + ",");
+  }
+  if (searchConfig->targetLatencyMs > 0) {
+    double actualMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    playoutBudget.numCandidates = min(numPlayedOut, numRealPlayouts);
+    mapEncoded.append("\"_budget\":" + encodePlayoutBudget(&playoutBudget, actualMs) + ",");
+  }
+  if (searchConfig->outputStats) {
+    std::string stats = encodeEvalCacheStats(&evalCache);
+    if (searchConfig->playoutCutoffRank > 0) {
+      char buf[80];
+      snprintf(buf, sizeof(buf), ",\"candidatesEligible\":%d,\"candidatesCutOff\":%d,\"playoutsCutOff\":%d", numCandidatesEligible, numCandidatesCutOff, numPlayoutsCutOff);
+      stats.append(buf);
+    }
+    if (searchConfig->valueFunctionFile[0] != '\0') {
+      stats.append(std::string(",\"valueFunctionLoaded\":") + (valueFunction != nullptr ? "1" : "0"));
+    }
+    if (valueFunction != nullptr) {
+      char buf[80];
+      snprintf(buf, sizeof(buf), ",\"valueEstimates\":%d,\"valueEstimateMs\":%f", numValueEstimates, valueEstimateMs);
+      stats.append(buf);
+    }
+    if (searchConfig->sequenceFile[0] != '\0') {
+      stats.append(std::string(",\"sequenceFileLoaded\":") + (isPieceSequenceFileLoaded(searchConfig) ? "1" : "0"));
+    }
+    mapEncoded.append("\"_stats\":{" + stats + "},");
+    mapEncoded.append("\"_playouts\":" + encodePlayoutStats(candidateStatsMap) + ",");
+  }
+  if (PLAYOUT_LOGGING_ENABLED) {
+    printf("Eval cache stats: %s\n", encodeEvalCacheStats(&evalCache).c_str());
+  }
+  if (mapEncoded.size() > 1) {
     mapEncoded.pop_back(); // Remove the last comma
   }
   mapEncoded.append("}");
@@ -63,77 +322,115 @@ std::string getLockValueLookupEncoded(GameState gameState, const Piece *firstPie
 
 
 
-/** Searches 2-ply from a starting state, and performs a fast eval on each of the resulting states. Maintains a sorted list of the top N possibilities, and adds all the rest onto the end in no specified order. */
-int searchDepth2(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, OUT list<Depth2Possibility> &possibilityList){
-  auto cutoffPossibility = possibilityList.begin(); // The node on the "cutoff" between being in the top N placements and not
-  int size = 0; // Tracking manually is cheaper than doing the O(n) operation each iteration
+/**
+ * Searches 2-ply from a starting state, and performs a fast eval on each of the resulting states. Sorts the possibilities that were ever
+ * in the top N by eval score (ties in the order they were found), and puts all the rest after them in the order they were found.
+ * The rest only ever count towards the best unexplored value of their lock position, so once the top N is full, a possibility that
+ * can't make it and can't beat an earlier one of the rest from the same first placement is left out, and its eval stops early.
+ */
+int searchDepth2(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, const SearchConfig *searchConfig, OUT Depth2Search *search, OUT EvalStageStats *stageStats){
+  search->firstPlacements.clear();
+  search->afterFirstMoves.clear();
+  search->secondPlacements.clear();
+  search->possibilities.clear();
+  search->order.clear();
+  search->unsortedIndices.clear();
 
-  // Get the placements of the first piece
-  vector<LockPlacement> firstLockPlacements;
-  moveSearch(gameState, firstPiece, evalContext->pieceRangeContext.inputFrameTimeline, firstLockPlacements);
-  for (auto it = begin(firstLockPlacements); it != end(firstLockPlacements); ++it) {
-    LockPlacement firstPlacement = *it;
-    GameState afterFirstMove = advanceGameState(gameState, firstPlacement, evalContext);
+  // Get the placements of the first piece, and the states after them
+  moveSearch(gameState, firstPiece, evalContext->pieceRangeContext.inputFrameTimeline, searchConfig->canTuck, search->firstPlacements);
+  int numFirstPlacements = (int) search->firstPlacements.size();
+  search->afterFirstMoves.resize(numFirstPlacements);
+  expandGameState(&gameState, search->firstPlacements.data(), numFirstPlacements, evalContext, search->afterFirstMoves.data());
+  for (int f = 0; f < numFirstPlacements; f++) {
+    GameState const &afterFirstMove = search->afterFirstMoves[f];
     for (int i = 0; i < 19; i++) {
       maybePrint("%d ", afterFirstMove.board[i] & ALL_TUCK_SETUP_BITS);
     }
     maybePrint("%d end of post first move\n", afterFirstMove.board[19] & ALL_TUCK_SETUP_BITS);
     float firstMoveReward = getLineClearFactor(afterFirstMove.lines - gameState.lines, evalContext->weights, evalContext->shouldRewardLineClears);
 
-    // Get the placements of the second piece
-    vector<LockPlacement> secondLockPlacements;
-    moveSearch(afterFirstMove, secondPiece, evalContext->pieceRangeContext.inputFrameTimeline, secondLockPlacements);
+    // Get the placements of the second piece, after those of the earlier first placements
+    int secondStart = (int) search->secondPlacements.size();
+    moveSearch(afterFirstMove, secondPiece, evalContext->pieceRangeContext.inputFrameTimeline, searchConfig->canTuck, search->secondPlacements);
+    int secondEnd = (int) search->secondPlacements.size();
+    search->resultingStates.resize(secondEnd - secondStart);
+    expandGameState(&afterFirstMove, &search->secondPlacements[secondStart], secondEnd - secondStart, evalContext, search->resultingStates.data());
 
-    for (auto secondPlacement : secondLockPlacements) {
-      GameState resultingState = advanceGameState(afterFirstMove, secondPlacement, evalContext);
-      float evalScore = firstMoveReward + fastEval(afterFirstMove, resultingState, secondPlacement, evalContext);
+    float bestUnsortedValue = -INFINITY; // The best immediate reward + eval score of this first placement's possibilities outside the top N
+    for (int s = secondStart; s < secondEnd; s++) {
+      LockPlacement secondPlacement = search->secondPlacements[s];
+      GameState const &resultingState = search->resultingStates[s - secondStart];
       float secondMoveReward = getLineClearFactor(resultingState.lines - afterFirstMove.lines, evalContext->weights, evalContext->shouldRewardLineClears);
+      float immediateReward = firstMoveReward + secondMoveReward;
 
-      Depth2Possibility newPossibility = {
-        { firstPlacement.x, firstPlacement.y, firstPlacement.rotationIndex },
-        { secondPlacement.x, secondPlacement.y, secondPlacement.rotationIndex },
-        resultingState,
-        evalScore,
-        firstMoveReward + secondMoveReward
-      };
-
-      if (size < keepTopN || evalScore > cutoffPossibility->evalScore) {
-        // Insert into the list in its correct sorted place
-        for (auto it = possibilityList.begin(); true; it++) {
-          if (it == possibilityList.end()) {
-            possibilityList.push_back(newPossibility);
-            size++;
-            break;
-          }
-          if (evalScore > it->evalScore) {
-            possibilityList.insert(it, newPossibility);
-            size++;
-            break;
-          }
-        }
+      // Once the top N is full, the eval score has to beat the Nth best or the best of the rest so far to matter
+      vector<int> &sortedIndices = search->order;
+      float threshold = -INFINITY;
+      if ((int) sortedIndices.size() >= keepTopN && bestUnsortedValue != -INFINITY) {
+        float nthBestScore = keepTopN > 0 ? search->possibilities[sortedIndices[keepTopN - 1]].evalScore : INFINITY;
+        threshold = toScoreUnits(min(nthBestScore, bestUnsortedValue - immediateReward) - firstMoveReward, evalContext);
+      }
+      float fastEvalScore = boundedFastEval(&afterFirstMove, &resultingState, secondPlacement, evalContext, threshold, stageStats);
+      if (fastEvalScore == -INFINITY) {
+        continue;
+      }
+      float evalScore = fromScoreUnits(toScoreUnits(firstMoveReward, evalContext) + fastEvalScore, evalContext);
 
-        // Update the cutoff node
-        if (size == keepTopN) {
-          // Get the Nth elt
-          auto ptr = possibilityList.begin();
-          advance(ptr, keepTopN - 1);
-          cutoffPossibility = ptr;
-        }
-        if (size > keepTopN) {
-          // Use the predecessor of the one that just got pushed out
-          cutoffPossibility = prev(cutoffPossibility);
-        }
+      int index = (int) search->possibilities.size();
+      search->possibilities.push_back({f, s, evalScore, immediateReward});
 
+      // Sort it in if it beats the current Nth best, after any with the same score. Otherwise it goes at the end (sorting not important).
+      int isInTopN = (int) sortedIndices.size() < keepTopN || (keepTopN > 0 && evalScore > search->possibilities[sortedIndices[keepTopN - 1]].evalScore);
+      if (isInTopN) {
+        auto insertAt = upper_bound(sortedIndices.begin(), sortedIndices.end(), evalScore,
+                                    [search](float score, int other) { return score > search->possibilities[other].evalScore; });
+        sortedIndices.insert(insertAt, index);
       } else {
-        // Add it at the end of the list (sorting not important)
-        possibilityList.push_back(newPossibility);
+        search->unsortedIndices.push_back(index);
+        bestUnsortedValue = max(bestUnsortedValue, immediateReward + evalScore);
       }
     }
   }
-  return (int) possibilityList.size();
+  search->order.insert(search->order.end(), search->unsortedIndices.begin(), search->unsortedIndices.end());
+  return (int) search->possibilities.size();
+}
+
+GameState getResultingState(const Depth2Search *search, const Depth2Possibility *possibility, const EvalContext *evalContext){
+  return advanceGameState(search->afterFirstMoves[possibility->firstPlacementIndex], search->secondPlacements[possibility->secondPlacementIndex], evalContext);
 }
 
 
+/* ----------- TESTS ----------- */
+
+/**
+ * Checks whether the eval cache pays for itself on one search: runs the same search with and without it, checks that the results
+ * match, and compares the fastest of a few timed runs of each.
+ * @returns how many times faster the search is with the cache (above 1 means it pays for itself)
+ */
+double testEvalCacheSpeedup(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, const EvalContext *evalContext, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig, int numTrials){
+  double fastestMs[2] = {-1, -1};
+  std::string results[2];
+  for (int trial = 0; trial < numTrials; trial++) {
+    for (int useEvalCache = 0; useEvalCache <= 1; useEvalCache++) {
+      SearchConfig config = *searchConfig;
+      config.useEvalCache = useEvalCache;
+      config.outputStats = false; // The stats differ, and everything else should match
+      auto startTime = std::chrono::steady_clock::now();
+      results[useEvalCache] = getLockValueLookupEncoded(gameState, firstPiece, secondPiece, config.depth2PruningBreadth, evalContext, evalContextTable, &config);
+      double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+      if (fastestMs[useEvalCache] < 0 || elapsedMs < fastestMs[useEvalCache]) {
+        fastestMs[useEvalCache] = elapsedMs;
+      }
+    }
+  }
+  if (results[0] != results[1]) {
+    printf("Eval cache changed the result:\n%s\n%s\n", results[0].c_str(), results[1].c_str());
+  }
+  double speedup = fastestMs[1] > 0 ? fastestMs[0] / fastestMs[1] : 1;
+  printf("Eval cache: %f ms without, %f ms with, speedup %f\n", fastestMs[0], fastestMs[1], speedup);
+  return speedup;
+}
+
 // void evaluatePossibilitiesWithPlayouts(int timeoutMs){
 //   auto millisec_since_epoch = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 //
@@ -3,11 +3,39 @@
 
 #include "types.hpp"
 #include "utils.hpp"
-#include <list>
+#include "eval_cache.hpp"
+#include "eval.hpp"
+#include "playout_budget.hpp"
 #include <algorithm>
+#include <vector>
 
-int searchDepth2(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, OUT list<Depth2Possibility> &possibilityList);
+/** The playouts behind a played-out lock position's value, along with its depth 2 eval (used as a control variate). */
+struct CandidatePlayoutStats {
+  PlayoutStats playoutStats;
+  float value;     // Immediate reward + playout score
+  float evalValue; // Immediate reward + depth 2 eval score
+};
 
-std::string getLockValueLookupEncoded(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, const PieceRangeContext pieceRangeContextLookup[3]);
+/**
+ * The placements and possibilities of a depth 2 search, stored flat so that the number of allocations doesn't grow with the number
+ * of possibilities (and none are needed once the buffers are big enough). Only the states after the first placement are kept;
+ * a possibility's resulting state is replayed from them when it's needed (see getResultingState).
+ */
+struct Depth2Search {
+  vector<LockPlacement> firstPlacements;
+  vector<GameState> afterFirstMoves;    // The state after each first placement
+  vector<LockPlacement> secondPlacements; // The second placements after every first placement, back to back
+  vector<Depth2Possibility> possibilities;
+  vector<int> order;                    // Possibility indices: the top N (and any others that were briefly in it) sorted by eval score, then the rest
+  vector<int> unsortedIndices;          // The rest, while the search is running
+  vector<GameState> resultingStates;    // The states after the second placements of one first placement, while they're evaluated
+};
+
+int searchDepth2(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, const SearchConfig *searchConfig, OUT Depth2Search *search, OUT EvalStageStats *stageStats);
+
+/** Replays a possibility's second placement, to get the same state that the search evaluated. */
+GameState getResultingState(const Depth2Search *search, const Depth2Possibility *possibility, const EvalContext *evalContext);
+
+std::string getLockValueLookupEncoded(GameState gameState, const Piece *firstPiece, const Piece *secondPiece, int keepTopN, const EvalContext *evalContext, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig);
 
 #endif
@@ -9,6 +9,8 @@
 #include "../data/tetrominoes.hpp"
 #include "params.hpp"
 #include "eval_context.hpp"
+#include "search_config.hpp"
+#include "request.hpp"
 // I have to include the C++ files here due to a complication of node-gyp. Consider this the equivalent
 // of listing all the C++ sources in the makefile (Node-gyp seems to only work with 1 source rn).
 #include "eval.cpp"
@@ -19,58 +21,38 @@
 #include "playout.cpp"
 #include "high_level_search.cpp"
 #include "piece_rng.cpp"
+#include "piece_sequences.cpp"
+#include "search_config.cpp"
+#include "eval_cache.cpp"
+#include "playout_budget.cpp"
+#include "value_function.cpp"
+#include "request.cpp"
 // #include "../data/ranks_output.cpp"
 
 std::string mainProcess(char const *inputStr, int isDebug) {
   maybePrint("Input string %s\n", inputStr);
 
-  // Init empty data structures
-  GameState startingGameState = {
-    /* board= */ {},
-    /* surfaceArray= */ {},
-    /* adjustedNumHole= */ 0,
-    /* lines= */ 0,
-    /* level= */ 0
-  };
-  Piece curPiece;
-  Piece nextPiece;
-  std::string inputFrameTimeline;
-
-  // Loop through the other args
-  std::string s = std::string(inputStr + 201); // 201 = the length of the board string + 1 for the delimiter
-  std::string delim = "|";
-  auto start = 0U;
-  auto end = s.find(delim);
-  for (int i = 0; end != std::string::npos; i++) {
-    std::string arg = s.substr(start, end - start);
-    int argAsInt = atoi(arg.c_str());
-    maybePrint("ARG %d: %d\n", i, argAsInt);
-    switch (i) {
-    case 0:
-      startingGameState.level = argAsInt;
-    case 1:
-      startingGameState.lines = argAsInt;
-      break;
-    case 2:
-      curPiece = PIECE_LIST[argAsInt];
-      break;
-    case 3:
-      nextPiece = PIECE_LIST[argAsInt];
-      break;
-    case 4:
-      inputFrameTimeline = arg;
-    default:
-      break;
-    }
-
-    start = (int) end + (int) delim.length();
-    end = s.find(delim, start);
+  // Parse the board and the other args, and reject anything malformed
+  Request request;
+  RequestError error;
+  if (!parseRequest(inputStr, &request, &error)) {
+    maybePrint("Invalid request (%s): %s\n", error.field, error.message);
+    return encodeRequestError(&error);
   }
+  GameState startingGameState = request.gameState;
+  const Piece *curPiece = request.curPiece;
+  const Piece *nextPiece = request.nextPiece;
+  std::string inputFrameTimeline = request.inputFrameTimeline;
+  SearchConfig searchConfig = getDefaultSearchConfig();
+  // Optional runtime overrides of the weights and search params
+  std::vector<std::string> rejectedOverrides;
+  applySearchConfigOverrides(request.searchConfigOverrides.c_str(), &searchConfig, &rejectedOverrides);
+
   int wellColumn = 9;
   // Fill in the data structures
-  encodeBoard(inputStr, startingGameState.board);
-  getSurfaceArray(startingGameState.board, startingGameState.surfaceArray);
-  startingGameState.adjustedNumHoles = updateSurfaceAndHoles(startingGameState.surfaceArray, startingGameState.board, wellColumn);
+  getColumns(startingGameState.board, startingGameState.columns);
+  getSurfaceArray(startingGameState.columns, startingGameState.surfaceArray);
+  updateSurfaceAndHoles(&startingGameState, wellColumn);
 
   // Calculate global context for the 3 possible gravity values
   const PieceRangeContext pieceRangeContextLookup[3] = {
@@ -78,10 +60,12 @@ std::string mainProcess(char const *inputStr, int isDebug) {
     getPieceRangeContext(inputFrameTimeline.c_str(), 2),
     getPieceRangeContext(inputFrameTimeline.c_str(), 3),
   };
-  const EvalContext context = getEvalContext(startingGameState, pieceRangeContextLookup);
+  EvalContextTable evalContextTable;
+  initEvalContextTable(pieceRangeContextLookup, &searchConfig, &evalContextTable);
+  const EvalContext context = *lookupEvalContext(startingGameState, &evalContextTable);
 
   // Recalculate holes once we have the eval context
-  startingGameState.adjustedNumHoles = updateSurfaceAndHoles(startingGameState.surfaceArray, startingGameState.board, context.countWellHoles ? -1 : context.wellColumn);
+  updateSurfaceAndHoles(&startingGameState, context.countWellHoles ? -1 : context.wellColumn);
 
   if (LOGGING_ENABLED) {
     printBoard(startingGameState.board);
@@ -89,11 +73,19 @@ std::string mainProcess(char const *inputStr, int isDebug) {
   }
 
   if (isDebug) {
-    int debugSequence[SEQUENCE_LENGTH] = {curPiece.index};
-    playSequence(startingGameState, pieceRangeContextLookup, debugSequence, /* playoutLength= */ 1);
+    int debugSequence[SEQUENCE_LENGTH] = {curPiece->index};
+    playSequence(startingGameState, &evalContextTable, &searchConfig, /* evalCache= */ nullptr, debugSequence, /* playoutLength= */ 1);
     return "Debug playout complete.";
   }
-  std::string lookupMapEncoded = getLockValueLookupEncoded(startingGameState, &curPiece, &nextPiece, DEPTH_2_PRUNING_BREADTH, &context, pieceRangeContextLookup);
+  std::string lookupMapEncoded = getLockValueLookupEncoded(startingGameState, curPiece, nextPiece, searchConfig.depth2PruningBreadth, &context, &evalContextTable, &searchConfig);
+  // Report any overrides that were skipped, so the caller can tell a typo from a no-op
+  if (!rejectedOverrides.empty()) {
+    lookupMapEncoded.pop_back(); // Remove the closing brace
+    if (lookupMapEncoded.size() > 1) {
+      lookupMapEncoded.append(",");
+    }
+    lookupMapEncoded.append("\"_rejectedConfig\":" + encodeRejectedOverrides(rejectedOverrides) + "}");
+  }
   return lookupMapEncoded;
 }
 
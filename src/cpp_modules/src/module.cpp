@@ -17,9 +17,48 @@ NAN_METHOD(Precompute) {
   info.GetReturnValue().Set(Nan::New<String>(result.c_str()).ToLocalChecked());
 }
 
+NAN_METHOD(TrainValueFunction) {
+  // Parse the paths of the training samples and of the weights file to write
+  Nan::Utf8String samplesPath(info[0]);
+  Nan::Utf8String weightsPath(info[1]);
+  if (*samplesPath == nullptr || *weightsPath == nullptr) {
+    Nan::ThrowError("Expected the samples path and the weights path");
+    return;
+  }
+
+  std::string report = trainValueFunction(*samplesPath, *weightsPath);
+
+  info.GetReturnValue().Set(Nan::New<String>(report.c_str()).ToLocalChecked());
+}
+
+NAN_METHOD(WritePieceSequences) {
+  // Parse the path to write and the search config overrides that pick the set (e.g. "sequenceSeed=7,numSequences=5000")
+  Nan::Utf8String path(info[0]);
+  Nan::Utf8String overrides(info[1]);
+  if (*path == nullptr || *overrides == nullptr) {
+    Nan::ThrowError("Expected the sequence file path and the search config overrides");
+    return;
+  }
+  SearchConfig searchConfig = getDefaultSearchConfig();
+  std::vector<std::string> rejectedOverrides;
+  applySearchConfigOverrides(*overrides, &searchConfig, &rejectedOverrides);
+  if (!rejectedOverrides.empty()) {
+    Nan::ThrowError(("Invalid search config overrides: " + encodeRejectedOverrides(rejectedOverrides)).c_str());
+    return;
+  }
+
+  std::string report = savePieceSequences(*path, &searchConfig);
+
+  info.GetReturnValue().Set(Nan::New<String>(report.c_str()).ToLocalChecked());
+}
+
 NAN_MODULE_INIT(Init) {
   Nan::Set(target, Nan::New("precompute").ToLocalChecked(),
            Nan::GetFunction(Nan::New<FunctionTemplate>(Precompute)).ToLocalChecked());
+  Nan::Set(target, Nan::New("trainValueFunction").ToLocalChecked(),
+           Nan::GetFunction(Nan::New<FunctionTemplate>(TrainValueFunction)).ToLocalChecked());
+  Nan::Set(target, Nan::New("writePieceSequences").ToLocalChecked(),
+           Nan::GetFunction(Nan::New<FunctionTemplate>(WritePieceSequences)).ToLocalChecked());
 }
 
 NODE_MODULE(myaddon, Init)
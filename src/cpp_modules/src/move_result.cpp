@@ -1,34 +1,45 @@
 #include "move_result.hpp"
+#include "piece_ranges.hpp"
 #include <stdexcept>
 
 /**
- * Rates a hole from 0 to 1 based on how bad it is.
+ * Finds the empty cells of a row that would be tuck setups if covered, i.e. that have 2 cells of open space beside them
+ * on the left or the right.
+ */
+int getTuckSetupCells(int row){
+  int emptyCells = ~row & FULL_ROW;
+  int leftSideTucks = (emptyCells >> 1) & (emptyCells >> 2);  // The 2 cells to the left are open
+  int rightSideTucks = (emptyCells << 1) & (emptyCells << 2); // The 2 cells to the right are open
+  return emptyCells & (leftSideTucks | rightSideTucks);
+}
+
+/**
+ * Sorts a newly covered cell into a hole or a tuck setup.
  * --Side effect-- marks the hole or tuck setup in the board data structure
+ * @returns whether it's a tuck setup
  */
-float analyzeHole(int board[20], int r, int c){
+int analyzeHole(int board[20], int r, int c){
   // Check if it's a tuck setup
-  if (
-    (c >= 2 && ((board[r] >> (9-c)) & 7) == 0) ||   // left side tuck (2 cells of open space)
-    (c <= 7 && ((board[r] >> (7-c)) & 7) == 0)      // right side tuck (2 cells of open space)
-    ) {
+  if (getTuckSetupCells(board[r]) & (1 << (9 - c))) {
     // printf("MARKING TUCK SETUP %d %d, %d\n", c, r, board[r] >> 20);
     board[r] |= TUCK_SETUP_BIT(c); // Mark this cell as an overhang cell
     // printf("After mark: %d\n", board[r] >> 20);
-    return TUCK_SETUP_HOLE_PROPORTION;
+    return true;
   }
   // Otherwise it's a hole
   // printf("MARKING HOLE %d %d\n", c, r);
   board[r] |= HOLE_BIT(c);
-  return 1;
+  return false;
 }
 
 
-float getNewSurfaceAndNumNewHoles(int surfaceArray[10],
-                                  int board[20],
-                                  LockPlacement lockPlacement,
-                                  const EvalContext *evalContext,
-                                  int isTuck,
-                                  OUT int newSurface[10]) {
+void getNewSurfaceAndHoles(const int8_t surfaceArray[10],
+                           LockPlacement lockPlacement,
+                           const EvalContext *evalContext,
+                           int isTuck,
+                           OUT GameState *newState) {
+  int *board = newState->board;
+  int8_t *newSurface = newState->surfaceArray;
   for (int i = 0; i < 10; i++) {
     newSurface[i] = surfaceArray[i];
   }
@@ -49,7 +60,6 @@ float getNewSurfaceAndNumNewHoles(int surfaceArray[10],
   }
 
   // Check for new holes by comparing the bottom surface of the piece to the surface of the stack
-  float numNewHoles = 0;
   int const *bottomSurface = lockPlacement.piece->bottomSurfaceByRotation[lockPlacement.rotationIndex];
   for (int i = 0; i < 4; i++) {
     if (bottomSurface[i] == -1) {
@@ -61,120 +71,128 @@ float getNewSurfaceAndNumNewHoles(int surfaceArray[10],
     }
 
     // Loop through the cells between the bottom of the piece and the ground
+    // (a piece that locks partly above the board only covers the cells on it)
     int c = lockPlacement.x + i;
     const int highestCellInCol = 20 - surfaceArray[c];
     int holeWeightStartRow = -1; // Indicates that all rows above this row are weight on a hole
-    for (int r = (lockPlacement.y + bottomSurface[i]); r < highestCellInCol; r++) {
-      float rating = analyzeHole(board, r, c);
-      if (std::abs(rating - TUCK_SETUP_HOLE_PROPORTION) < FLOAT_EPSILON) {
+    for (int r = max(0, lockPlacement.y + bottomSurface[i]); r < highestCellInCol; r++) {
+      if (analyzeHole(board, r, c)) {
         holeWeightStartRow = r - 1;
+        newState->numTuckSetups++;
+      } else {
+        newState->numHoles++;
       }
-      numNewHoles += rating;
     }
     // If placing a piece on top of a row that's already weighing on a hole, then the new piece is adding weight to that
-    if (board[highestCellInCol] & HOLE_WEIGHT_BIT) {
+    if (highestCellInCol >= 0 && highestCellInCol < 20 && (board[highestCellInCol] & HOLE_WEIGHT_BIT)) {
       holeWeightStartRow = highestCellInCol - 1;
     }
     // Mark rows as needing to be cleared
     maybePrint("marking needToClear (column %d): start row = %d, surface = %d\n", c, holeWeightStartRow, 20 - newSurface[c]);
-    for (int r = holeWeightStartRow; r >= 20 - newSurface[c]; r--) {
+    for (int r = holeWeightStartRow; r >= max(0, 20 - newSurface[c]); r--) {
       if (!(board[r] & HOLE_BIT(c))) {
         board[r] |= HOLE_WEIGHT_BIT;
       }
     }
   }
-
-  return numNewHoles;
 }
 
 /**
- * Manually finds the surface heights and holes after lines have been cleared (since usual prediction tricks
+ * Manually finds the surface heights, holes and tuck setups after lines have been cleared (since usual prediction tricks
  * don't apply).
  * @param excludeHolesColumn - a prespecified column to ignore holes in (usually the well). A value of -1 disables this behavior.
- * @returns the new hole count
  */
-float updateSurfaceAndHoles(int surfaceArray[10], int board[20], int excludeHolesColumn) {
+void updateSurfaceAndHoles(GameState *gameState, int excludeHolesColumn) {
+  int *board = gameState->board;
+  const uint32_t *columns = gameState->columns;
   // Reset hole and tuck setup bits
   for (int i = 0; i < 20; i++) {
     board[i] &= ~ALL_AUXILIARY_BITS;
   }
-  float numHoles = 0;
+  int numHoles = 0;
+  int numTuckSetups = 0;
   for (int c = 0; c < 10; c++) {
-    int mask = 1 << (9 - c);
-    int r = 20 - surfaceArray[c];
-    while (r < 20 && !(board[r] & mask)) {
-      r++;
-    }
     // Update the new surface array
-    surfaceArray[c] = 20 - r;
-
-    int lowestHoleInCol = -1;
-    while (r < 20) {
-      // Add new holes to the overall count, unless they're in the well
-      if (!(board[r] & mask) && c != excludeHolesColumn) {
-        float rating = analyzeHole(board, r, c);
-        // Check that it's a hole (1.0) and not a tuck setup (eg. 0.9)
-        if (rating > TUCK_SETUP_HOLE_PROPORTION + FLOAT_EPSILON) {
-          lowestHoleInCol = r;
-        }
-        numHoles += rating;
-      }
-      r++;
+    int height = COLUMN_HEIGHT(columns[c]);
+    gameState->surfaceArray[c] = height;
+    // Don't add holes in the well to the overall count
+    uint32_t emptyCoveredCells = ~columns[c] & ((1u << height) - 1);
+    if (c == excludeHolesColumn || !emptyCoveredCells) {
+      continue;
     }
-    // Mark rows as needing to be cleared
-    for (int r = lowestHoleInCol - 1; r >= 20 - surfaceArray[c]; r--) {
-      board[r] |= HOLE_WEIGHT_BIT;
+
+    // Sort the empty cells below the surface into tuck setups and holes, for the whole column at once
+    uint32_t tuckSetupRows = (c >= 2 ? ~(columns[c - 1] | columns[c - 2]) : 0)  // left side tuck (2 cells of open space)
+                             | (c <= 7 ? ~(columns[c + 1] | columns[c + 2]) : 0); // right side tuck (2 cells of open space)
+    uint32_t tuckSetups = emptyCoveredCells & tuckSetupRows;
+    uint32_t holes = emptyCoveredCells & ~tuckSetupRows;
+    numTuckSetups += __builtin_popcount(tuckSetups);
+    numHoles += __builtin_popcount(holes);
+    for (; tuckSetups; tuckSetups &= tuckSetups - 1) {
+      board[19 - __builtin_ctz(tuckSetups)] |= TUCK_SETUP_BIT(c);
     }
+    if (!holes) {
+      continue;
+    }
+    for (uint32_t cells = holes; cells; cells &= cells - 1) {
+      board[19 - __builtin_ctz(cells)] |= HOLE_BIT(c);
+    }
+    // Mark rows as needing to be cleared, from above the lowest hole up to the surface
+    uint32_t lowestHole = holes & -holes;
+    for (uint32_t rows = ((1u << height) - 1) & ~((lowestHole << 1) - 1); rows; rows &= rows - 1) {
+      board[19 - __builtin_ctz(rows)] |= HOLE_WEIGHT_BIT;
+    }
+  }
+  gameState->numHoles = numHoles;
+  gameState->numTuckSetups = numTuckSetups;
+}
+
+/** Adds one row of a piece's cells to both views of a board, clearing any tuck setups that it fills. */
+void addPieceCells(OUT int board[20], OUT uint32_t columns[10], int r, int pieceCells) {
+  board[r] = (board[r] | pieceCells) // Add the piece to the board
+             & ~(pieceCells << 20);  // Clear out those cells from tuck setups
+  for (int cells = pieceCells & FULL_ROW; cells; cells &= cells - 1) {
+    columns[9 - __builtin_ctz(cells)] |= ROW_BIT(r);
   }
-  return numHoles;
 }
 
 /**
- * Calculates the resulting board after placing a piece in a specified spot.
+ * Calculates the resulting board after placing a piece in a specified spot, keeping its column words in step.
  * @returns the number of lines cleared
  */
-int getNewBoardAndLinesCleared(int board[20], LockPlacement lockPlacement, OUT int newBoard[20]) {
-  int numLinesCleared = 0;
-  // The rows below the piece are always the same
-  for (int r = lockPlacement.y + 4; r < 20; r++) {
-    newBoard[r] = board[r];
-  }
-  // Check the piece rows, bottom to top
-  int const *pieceRows = lockPlacement.piece->rowsByRotation[lockPlacement.rotationIndex];
-  for (int i = 3; i >= 0; i--) {
+int getNewBoardAndLinesCleared(int board[20],
+                               const uint32_t columns[10],
+                               LockPlacement lockPlacement,
+                               OUT int newBoard[20],
+                               OUT uint32_t newColumns[10]) {
+  memcpy(newBoard, board, 20 * sizeof(int));
+  memcpy(newColumns, columns, 10 * sizeof(uint32_t));
+  // Add the piece to both views, noting which of its rows are full
+  uint32_t clearedRows = 0;
+  int const *pieceRows = getShiftedPiece(lockPlacement.piece, lockPlacement.rotationIndex, lockPlacement.x)->rows;
+  for (int i = 0; i < 4; i++) {
+    int r = lockPlacement.y + i;
     // Don't add any minos off the board
-    if (lockPlacement.y + i < 0) {
+    if (r < 0 || pieceRows[i] == 0) {
       continue;
     }
-
-    if (pieceRows[i] == 0) {
-      newBoard[lockPlacement.y + i + numLinesCleared] = board[lockPlacement.y + i];
-      continue;
-    }
-    int newRow = (board[lockPlacement.y + i]
-                  | SHIFTBY(pieceRows[i], lockPlacement.x))      // Add the piece to the board
-                 & ~(SHIFTBY(pieceRows[i], lockPlacement.x - 20)); // Clear out those cells from tuck setups
-    if ((newRow & FULL_ROW) == FULL_ROW) {
-      numLinesCleared++;
-      continue;
-    }
-    newBoard[lockPlacement.y + i + numLinesCleared] = newRow;
+    addPieceCells(newBoard, newColumns, r, pieceRows[i]);
+    clearedRows |= (newBoard[r] & FULL_ROW) == FULL_ROW ? ROW_BIT(r) : 0;
   }
-  // Copy the rest of the rows
-  for (int r = 0; r < lockPlacement.y; r++) {
-    newBoard[r + numLinesCleared] = board[r];
-  }
-  // Add empty lines at the top of the board if needed
-  for (int i = 0; i < numLinesCleared; i++) {
-    newBoard[i] = 0;
+
+  // Compact both views over the cleared rows
+  if (clearedRows) {
+    removeRowsFromBoard(newBoard, clearedRows);
+    removeRowsFromColumns(newColumns, clearedRows);
   }
-  return numLinesCleared;
+  return __builtin_popcount(clearedRows);
 }
 
 
-float adjustHoleCountAndBoardAfterTuck(int board[20], LockPlacement lockPlacement){
+/** Counts the tuck setups that a tucked piece fills. */
+int getNumTuckSetupsFilled(int board[20], LockPlacement lockPlacement){
   int tuckCellsFilled = 0;
-  int const *pieceRows = lockPlacement.piece->rowsByRotation[lockPlacement.rotationIndex];
+  int const *pieceRows = getShiftedPiece(lockPlacement.piece, lockPlacement.rotationIndex, lockPlacement.x)->rows;
   for (int i = 3; i >= 0; i--) {
     // Don't add any minos that are off the board
     if (lockPlacement.y + i < 0) {
@@ -185,37 +203,27 @@ float adjustHoleCountAndBoardAfterTuck(int board[20], LockPlacement lockPlacemen
       continue;
     }
     // Count the number of tuck cells filled in this row of the piece
-    int intersection = board[lockPlacement.y + i] & SHIFTBY(pieceRows[i], lockPlacement.x - 20);
-    while ((intersection & ALL_TUCK_SETUP_BITS) > 0) {
-      if (intersection & (1 << 20)) {
-        tuckCellsFilled++;
-      }
-      intersection = intersection >> 1;
-    }
+    int intersection = board[lockPlacement.y + i] & (pieceRows[i] << 20);
+    tuckCellsFilled += __builtin_popcount(intersection & ALL_TUCK_SETUP_BITS);
   }
-  return -1 * TUCK_SETUP_HOLE_PROPORTION * tuckCellsFilled;
+  return tuckCellsFilled;
 }
 
 
 /** Gets the game state after completing a given move */
 GameState advanceGameState(GameState gameState, LockPlacement lockPlacement, const EvalContext *evalContext) {
-  GameState newState = {{}, {}, gameState.adjustedNumHoles, gameState.lines, gameState.level};
-  float numNewHoles = 0;
+  GameState newState = {{}, {}, gameState.numHoles, gameState.numTuckSetups, gameState.lines, gameState.level, {}};
   int isTuck = lockPlacement.tuckFrame == -1;
-  // Post-process after tucks
-  // This has to happen before getNewBoardAndLinesCleared, which updates the tuck cell bits
-  if (isTuck) {
-    numNewHoles += adjustHoleCountAndBoardAfterTuck(gameState.board, lockPlacement);
-  }
-  int numLinesCleared = getNewBoardAndLinesCleared(gameState.board, lockPlacement, newState.board);
-  numNewHoles +=
-    getNewSurfaceAndNumNewHoles(gameState.surfaceArray, newState.board, lockPlacement, evalContext, isTuck, OUT newState.surfaceArray);
-  // Post-process after line clears
+  int numLinesCleared = getNewBoardAndLinesCleared(gameState.board, gameState.columns, lockPlacement, newState.board, newState.columns);
+  // After line clears, the surface and holes are found from scratch (which resets any hole markings), so there's no need to predict them
   if (numLinesCleared > 0) {
-    newState.adjustedNumHoles =
-      updateSurfaceAndHoles(newState.surfaceArray, newState.board, evalContext->countWellHoles ? -1 : evalContext->wellColumn);
+    updateSurfaceAndHoles(&newState, evalContext->countWellHoles ? -1 : evalContext->wellColumn);
   } else {
-    newState.adjustedNumHoles += numNewHoles;
+    // Post-process after tucks (from the tuck cell bits of the old board)
+    if (isTuck) {
+      newState.numTuckSetups -= getNumTuckSetupsFilled(gameState.board, lockPlacement);
+    }
+    getNewSurfaceAndHoles(gameState.surfaceArray, lockPlacement, evalContext, isTuck, OUT &newState);
   }
 
   newState.lines += numLinesCleared;
@@ -223,3 +231,40 @@ GameState advanceGameState(GameState gameState, LockPlacement lockPlacement, con
 
   return newState;
 }
+
+void expandGameState(const GameState *gameState,
+                     const LockPlacement *lockPlacements,
+                     int numPlacements,
+                     const EvalContext *evalContext,
+                     OUT GameState *children) {
+  for (int i = 0; i < numPlacements; i++) {
+    LockPlacement lockPlacement = lockPlacements[i];
+    int const *pieceRows = getShiftedPiece(lockPlacement.piece, lockPlacement.rotationIndex, lockPlacement.x)->rows;
+    int clearsLines = false;
+    for (int j = 0; j < 4; j++) {
+      int r = lockPlacement.y + j;
+      clearsLines |= r >= 0 && pieceRows[j] != 0 && ((gameState->board[r] | pieceRows[j]) & FULL_ROW) == FULL_ROW;
+    }
+    if (clearsLines || lockPlacement.tuckInput != NO_TUCK_NOTATION) {
+      children[i] = advanceGameState(*gameState, lockPlacement, evalContext);
+      continue;
+    }
+
+    // A piece that drops straight down lands on top of every column it covers, and tuck setups are always below the
+    // top of their column, so it can't fill any
+    GameState *child = &children[i];
+    memcpy(child->board, gameState->board, sizeof(child->board));
+    memcpy(child->columns, gameState->columns, sizeof(child->columns));
+    child->numHoles = gameState->numHoles;
+    child->numTuckSetups = gameState->numTuckSetups;
+    child->lines = gameState->lines;
+    child->level = gameState->level;
+    for (int j = 0; j < 4; j++) {
+      int r = lockPlacement.y + j;
+      if (r >= 0 && pieceRows[j] != 0) {
+        addPieceCells(child->board, child->columns, r, pieceRows[j]);
+      }
+    }
+    getNewSurfaceAndHoles(gameState->surfaceArray, lockPlacement, evalContext, lockPlacement.tuckFrame == -1, child);
+  }
+}
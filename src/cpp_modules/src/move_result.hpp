@@ -4,25 +4,42 @@
 #include "types.hpp"
 #include "utils.hpp"
 
-float getNewSurfaceAndNumNewHoles(int surfaceArray[10],
-                                  int board[20],
-                                  LockPlacement lockPlacement,
-                                  const EvalContext *evalContext,
-                                  int isTuck,
-                                  OUT int newSurface[10]);
+/**
+ * Finds the surface and the new holes and tuck setups after placing a piece without clearing lines,
+ * by comparing the bottom of the piece to the previous surface.
+ */
+void getNewSurfaceAndHoles(const int8_t surfaceArray[10],
+                           LockPlacement lockPlacement,
+                           const EvalContext *evalContext,
+                           int isTuck,
+                           OUT GameState *newState);
 
 /**
- * Manually finds the surface heights and holes after lines have been cleared (since usual prediction tricks don't apply).
- * @returns the new hole count
+ * Manually finds the surface heights, holes and tuck setups after lines have been cleared (since usual prediction tricks don't apply).
  */
-float updateSurfaceAndHoles(int surfaceArray[10], int board[20], int excludeHolesColumn);
+void updateSurfaceAndHoles(GameState *gameState, int excludeHolesColumn);
 
 /**
- * Calculates the resulting board after placing a piece in a specified spot.
+ * Calculates the resulting board after placing a piece in a specified spot, keeping its column words in step.
  * @returns the number of lines cleared
  */
-int getNewBoardAndLinesCleared(int board[20], LockPlacement lockPlacement, OUT int newBoard[20]);
+int getNewBoardAndLinesCleared(int board[20],
+                               const uint32_t columns[10],
+                               LockPlacement lockPlacement,
+                               OUT int newBoard[20],
+                               OUT uint32_t newColumns[10]);
 
 GameState advanceGameState(GameState gameState, LockPlacement lockPlacement, const EvalContext *evalContext);
 
+/**
+ * Gets the state after each of a piece's lock placements, the same as advanceGameState would, in one pass over the parent state.
+ * Most placements drop straight down without clearing lines, and only need the piece added to a copy of the parent board
+ * and the surface and holes predicted from the parent's. Tucks and line clears go through advanceGameState.
+ */
+void expandGameState(const GameState *gameState,
+                     const LockPlacement *lockPlacements,
+                     int numPlacements,
+                     const EvalContext *evalContext,
+                     OUT GameState *children);
+
 #endif
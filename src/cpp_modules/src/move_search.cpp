@@ -10,7 +10,6 @@
 using namespace std;
 
 #define INITIAL_X 3
-#define NO_TUCK_NOTATION '.'
 
 /**
  * Checks for collisions with the board and the edges of the screen
@@ -19,7 +18,8 @@ int collision(int board[20], const Piece *piece, int x, int y, int rotIndex) {
   if (y > piece->maxYByRotation[rotIndex]) {
     return 1;
   }
-  if (X_BOUNDS_COLLISION_TABLE[piece->index][rotIndex][x + X_BOUNDS_COLLISION_TABLE_OFFSET]) {
+  const ShiftedPiece *shiftedPiece = getShiftedPiece(piece, rotIndex, x);
+  if (shiftedPiece->isOutOfBounds) {
     return 1;
   }
   for (int r = 0; r < 4; r++) {
@@ -27,12 +27,12 @@ int collision(int board[20], const Piece *piece, int x, int y, int rotIndex) {
     if (y + r < 0) {
       continue;
     }
-    int pieceRow = piece->rowsByRotation[rotIndex][r];
+    int pieceRow = shiftedPiece->rows[r];
     if (pieceRow == 0) {
       continue;
     }
     // Board collisions
-    if (SHIFTBY(pieceRow, x) & board[y + r]) {
+    if (pieceRow & board[y + r]) {
       return 1;
     }
   }
@@ -178,7 +178,7 @@ void explorePlacementsNearSpawn(int board[20],
  */
 void getLockPlacementsFast(vector<SimState> &legalPlacements,
                            int board[20],
-                           int surfaceArray[10],
+                           int8_t surfaceArray[10],
                            OUT int availableTuckCols[40],
                            OUT vector<LockPlacement> &lockPlacements) {
   for (auto simState : legalPlacements) {
@@ -208,9 +208,7 @@ char findTuckInput(int board[20],
                    int availableTuckCols[40],
                    int minTuckYValsByNumPrevInputs[7]) {
   // Do rotations mod 4 or mod 2, depending on the piece (rotation logic skipped for O)
-  int numOrientations = afterTuckState.piece->id == 'O'                    ? 1
-                        : afterTuckState.piece->rowsByRotation[3][0] == -1 ? 2
-                                                                          : 4;
+  int numOrientations = afterTuckState.piece->numRotations;
   int rotationModulusMask = numOrientations == 4 ? 3 : 1;
   for (TuckInput tuckInput : TUCK_INPUTS) {
     maybePrint("Trying %c:\n", tuckInput.notation);
@@ -280,7 +278,9 @@ void findTucks(int board[20],
       if ((board[overhangY] & TUCK_SETUP_BIT(overhangX)) > 0) {
         // Found an overhang cell! Look for tucks here
         maybePrint("Looking for tucks at %d %d\n", overhangX, overhangY);
-        for (TuckOriginSpot spot : TUCK_SPOTS_LIST[piece->index]) {
+        TuckSpotList const &tuckSpots = TUCK_SPOTS_LIST[piece->index];
+        for (int s = 0; s < tuckSpots.numSpots; s++) {
+          TuckOriginSpot spot = tuckSpots.spots[s];
           int pieceX = overhangX - spot.x;
           int postTuckPieceY = overhangY - spot.y;
           int lockPieceY = postTuckPieceY; // Can differ from postTuckPieceY if the piece falls after the tuck
@@ -319,6 +319,7 @@ int moveSearchInternal(GameState gameState,
                        SimState spawnState,
                        const Piece *piece,
                        char const *inputFrameTimeline,
+                       int canTuck,
                        OUT std::vector<LockPlacement> &lockPlacements) {
   vector<SimState> legalMidairPlacements;
   int gravity = getGravity(gameState.level);
@@ -328,11 +329,7 @@ int moveSearchInternal(GameState gameState,
   int minTuckYValsByNumPrevInputs[7] = {};
   computeYValueOfEachShift(inputFrameTimeline, gravity, piece->initialY, minTuckYValsByNumPrevInputs);
 
-  for (int goalRotIndex = 0; goalRotIndex < 4; goalRotIndex++) {
-    if (piece->rowsByRotation[goalRotIndex][0] == -1) {
-      // Rotation doesn't exist on this piece
-      continue;
-    }
+  for (int goalRotIndex = 0; goalRotIndex < piece->numRotations; goalRotIndex++) {
 
     // Check for immediate collision on spawn
     if (goalRotIndex == 0) {
@@ -377,7 +374,7 @@ int moveSearchInternal(GameState gameState,
     legalMidairPlacements, gameState.board, gameState.surfaceArray, availableTuckCols, lockPlacements);
 
   // Search for tucks
-  if (CAN_TUCK) {
+  if (canTuck) {
     findTucks(gameState.board, piece, availableTuckCols, minTuckYValsByNumPrevInputs, lockPlacements);
   }
 
@@ -387,9 +384,10 @@ int moveSearchInternal(GameState gameState,
 int moveSearch(GameState gameState,
                const Piece *piece,
                char const *inputFrameTimeline,
+               int canTuck,
                OUT std::vector<LockPlacement> &lockPlacements) {
   SimState spawnState = {INITIAL_X, piece->initialY, /* rotationIndex= */ 0, /* frameIndex= */ 0, /* arrIndex= */ 0, piece};
-  return moveSearchInternal(gameState, spawnState, piece, inputFrameTimeline, lockPlacements);
+  return moveSearchInternal(gameState, spawnState, piece, inputFrameTimeline, canTuck, lockPlacements);
 }
 
 int adjustmentSearch(GameState gameState,
@@ -400,9 +398,10 @@ int adjustmentSearch(GameState gameState,
                      int existingRotation,
                      int framesAlreadyElapsed,
                      int arrWasReset,
+                     int canTuck,
                      OUT std::vector<LockPlacement> &lockPlacements){
   SimState startState = {INITIAL_X + existingXOffset, piece->initialY + existingYOffset, /* rotationIndex= */ 0, /* frameIndex= */ 0, /* arrIndex= */ arrWasReset ? 0 : framesAlreadyElapsed, piece};
-  return moveSearchInternal(gameState, startState, piece, inputFrameTimeline, lockPlacements);
+  return moveSearchInternal(gameState, startState, piece, inputFrameTimeline, canTuck, lockPlacements);
 }
 
 /* ----------- TUCKS AND SPINS ----------- */
@@ -413,7 +412,9 @@ void testTuckSpots() {
   int overhangCellY = 17;
   printBoard(testBoard);
 
-  for (TuckOriginSpot spot : TUCK_SPOTS_J) {
+  TuckSpotList const &tuckSpots = TUCK_SPOTS_LIST[PIECE_J.index];
+  for (int s = 0; s < tuckSpots.numSpots; s++) {
+    TuckOriginSpot spot = tuckSpots.spots[s];
     int newBoard[20];
     for (int i = 0; i < 20; i++) {
       newBoard[i] = testBoard[i];
@@ -435,17 +436,20 @@ void testAdjustmentSearch(){
   GameState gameState = {
     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1016, 1016, 1020, 1022},
     /* surfaceArray= */ {},
-    /* adjustedNumHoles= */ 0,
+    /* numHoles= */ 0,
+    /* numTuckSetups= */ 0,
     /* lines= */ 0,
-    /* level= */ 18
+    /* level= */ 18,
+    /* columns= */ {}
   };
-  getSurfaceArray(gameState.board, gameState.surfaceArray);
+  getColumns(gameState.board, gameState.columns);
+  getSurfaceArray(gameState.columns, gameState.surfaceArray);
   printBoard(gameState.board);
 
   std::vector<LockPlacement> lockPlacements;
   printf("size %d\n", (int) lockPlacements.size());
   // int count = moveSearch(gameState, PIECE_O, "X...", lockPlacements);
-  int adjCount = adjustmentSearch(gameState, &PIECE_T, "X...", /* xoffset=*/ 3, /* yOffset=*/ 10, /* rotation= */ 0, /* framesElapsed= */ 20, /* arrReset=*/ true, lockPlacements);
+  int adjCount = adjustmentSearch(gameState, &PIECE_T, "X...", /* xoffset=*/ 3, /* yOffset=*/ 10, /* rotation= */ 0, /* framesElapsed= */ 20, /* arrReset=*/ true, CAN_TUCK, lockPlacements);
   for (auto state : lockPlacements) {
     printf("Found %d %d %d\n", state.x, state.y, state.rotationIndex);
     printBoardWithPiece(gameState.board, PIECE_T, state.x, state.y, state.rotationIndex);
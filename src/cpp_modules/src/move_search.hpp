@@ -5,6 +5,6 @@
 #include "utils.hpp"
 #include <vector>
 
-int moveSearch(GameState gameState, const Piece *piece, char const *inputFrameTimeline, OUT std::vector<LockPlacement> &lockPlacements, OUT int availableTuckCols[40]);
+int moveSearch(GameState gameState, const Piece *piece, char const *inputFrameTimeline, int canTuck, OUT std::vector<LockPlacement> &lockPlacements);
 
 #endif
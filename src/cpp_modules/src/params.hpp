@@ -19,115 +19,47 @@ const FastEvalWeights MAIN_WEIGHTS = {
   /* unableToBurnCoef= */ -0.5
 };
 
-const FastEvalWeights SAFE_WEIGHTS = {
-  MAIN_WEIGHTS.avgHeightCoef,
-  MAIN_WEIGHTS.builtOutLeftCoef,
-  /* burnCoef= */ -5,
-  MAIN_WEIGHTS.coveredWellCoef,
-  MAIN_WEIGHTS.col9Coef,
-  MAIN_WEIGHTS.deathCoef,
-  MAIN_WEIGHTS.extremeGapCoef,
-  MAIN_WEIGHTS.holeCoef,
-  MAIN_WEIGHTS.inaccessibleLeftCoef,
-  MAIN_WEIGHTS.inaccessibleRightCoef,
-  MAIN_WEIGHTS.tetrisCoef,
-  MAIN_WEIGHTS.tetrisReadyCoef,
-  MAIN_WEIGHTS.surfaceCoef,
-  MAIN_WEIGHTS.surfaceLeftCoef,
-  MAIN_WEIGHTS.unableToBurnCoef
-};
-
-const FastEvalWeights DIG_WEIGHTS = {
-  MAIN_WEIGHTS.avgHeightCoef,
-  MAIN_WEIGHTS.builtOutLeftCoef,
-  /* burnCoef= */ -1,
-  /* coveredWellCoef= */ -2.5,
-  /* col9Coef= */ -1,
-  MAIN_WEIGHTS.deathCoef,
-  MAIN_WEIGHTS.extremeGapCoef,
-  /* holeCoef= */ -60,
-  MAIN_WEIGHTS.inaccessibleLeftCoef,
-  MAIN_WEIGHTS.inaccessibleRightCoef,
-  MAIN_WEIGHTS.tetrisCoef,
-  MAIN_WEIGHTS.tetrisReadyCoef,
-  MAIN_WEIGHTS.surfaceCoef,
-  MAIN_WEIGHTS.surfaceLeftCoef,
-  MAIN_WEIGHTS.unableToBurnCoef
-};
-
-const FastEvalWeights NEAR_KILLSCREEN_WEIGHTS = {
-  MAIN_WEIGHTS.avgHeightCoef,
-  MAIN_WEIGHTS.builtOutLeftCoef,
-  MAIN_WEIGHTS.burnCoef,
-  MAIN_WEIGHTS.coveredWellCoef,
-  MAIN_WEIGHTS.col9Coef,
-  MAIN_WEIGHTS.deathCoef,
-  MAIN_WEIGHTS.extremeGapCoef,
-  MAIN_WEIGHTS.holeCoef,
-  MAIN_WEIGHTS.inaccessibleLeftCoef,
-  MAIN_WEIGHTS.inaccessibleRightCoef,
-  /* tetrisCoef= */ 500,
-  MAIN_WEIGHTS.tetrisReadyCoef,
-  MAIN_WEIGHTS.surfaceCoef,
-  MAIN_WEIGHTS.surfaceLeftCoef,
-  MAIN_WEIGHTS.unableToBurnCoef
-};
-
-const FastEvalWeights DIRTY_NEAR_KILLSCREEN_WEIGHTS = {
-  MAIN_WEIGHTS.avgHeightCoef,
-  MAIN_WEIGHTS.builtOutLeftCoef,
-  MAIN_WEIGHTS.burnCoef,
-  MAIN_WEIGHTS.coveredWellCoef,
-  MAIN_WEIGHTS.col9Coef,
-  MAIN_WEIGHTS.deathCoef,
-  MAIN_WEIGHTS.extremeGapCoef,
-  MAIN_WEIGHTS.holeCoef,
-  /* inaccessibleLeftCoef= */ 0,
-  /* inaccessibleRightCoef= */ 0,
-  /* tetrisCoef= */ 500,
-  MAIN_WEIGHTS.tetrisReadyCoef,
-  MAIN_WEIGHTS.surfaceCoef,
-  MAIN_WEIGHTS.surfaceLeftCoef,
-  MAIN_WEIGHTS.unableToBurnCoef
-};
-
-const FastEvalWeights LINEOUT_WEIGHTS = {
-  MAIN_WEIGHTS.avgHeightCoef,
-  /* builtOutLeftCoef= */ 15,
-  MAIN_WEIGHTS.burnCoef,
-  /* coveredWellCoef= */ 0,
-  /* col9Coef= */ 0,
-  MAIN_WEIGHTS.deathCoef,
-  MAIN_WEIGHTS.extremeGapCoef,
-  MAIN_WEIGHTS.holeCoef,
-  MAIN_WEIGHTS.inaccessibleLeftCoef,
-  MAIN_WEIGHTS.inaccessibleRightCoef,
-  MAIN_WEIGHTS.tetrisCoef,
-  MAIN_WEIGHTS.tetrisReadyCoef,
-  MAIN_WEIGHTS.surfaceCoef,
-  /* surfaceLeft= */ 40,
-  MAIN_WEIGHTS.unableToBurnCoef
-};
-
-FastEvalWeights getWeights(AiMode mode){
+/**
+ * Gets the weights for a given AI mode, derived from a set of main weights.
+ * Each mode only overrides the handful of coefficients that differ from the main weights, so that a runtime
+ * override of the main weights (see search_config.cpp) carries over to every mode.
+ */
+FastEvalWeights getWeightsForMode(AiMode mode, FastEvalWeights mainWeights){
+  FastEvalWeights weights = mainWeights;
   switch (mode) {
     case DIG:
-      return DIG_WEIGHTS;
+      weights.burnCoef = -1;
+      weights.coveredWellCoef = -2.5;
+      weights.col9Coef = -1;
+      weights.holeCoef = -60;
+      return weights;
     case NEAR_KILLSCREEN:
-      return NEAR_KILLSCREEN_WEIGHTS;
+      weights.tetrisCoef = 500;
+      return weights;
     case DIRTY_NEAR_KILLSCREEN:
-      return DIRTY_NEAR_KILLSCREEN_WEIGHTS;
+      weights.inaccessibleLeftCoef = 0;
+      weights.inaccessibleRightCoef = 0;
+      weights.tetrisCoef = 500;
+      return weights;
     case LINEOUT:
-      return LINEOUT_WEIGHTS;
+      weights.builtOutLeftCoef = 15;
+      weights.coveredWellCoef = 0;
+      weights.col9Coef = 0;
+      weights.surfaceLeftCoef = 40;
+      return weights;
     case SAFE:
-      return SAFE_WEIGHTS;
+      weights.burnCoef = -5;
+      return weights;
     case STANDARD:
-      return MAIN_WEIGHTS;
+      return weights;
     default:
       printf("Unknown AI Mode");
       return {};
   }
 }
 
+FastEvalWeights getWeights(AiMode mode){
+  return getWeightsForMode(mode, MAIN_WEIGHTS);
+}
 
 #endif
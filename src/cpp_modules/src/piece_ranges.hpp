@@ -3,30 +3,34 @@
 
 #include "../data/tetrominoes.hpp"
 #include "utils.hpp"
-#include <array>
 
 using namespace std;
 
-#define X_BOUNDS_COLLISION_TABLE_OFFSET 3
+#define SHIFTED_PIECE_TABLE_OFFSET 3 // Lowest possible x is -2, highest possible is 7. Then one extra on either side.
+#define SHIFTED_PIECE_TABLE_WIDTH 12
 
-typedef array<array<array<int, 12>, 4>, 7> xtable;
+/** A piece's rows shifted to one x (see SHIFTBY), and whether that x puts any of it past a wall. */
+struct ShiftedPiece {
+  int rows[4];
+  int isOutOfBounds;
+};
 
-xtable getRangeXTable() {
-  xtable table = {};
+struct ShiftedPieceTable {
+  ShiftedPiece entries[7][4][SHIFTED_PIECE_TABLE_WIDTH]; // Indexed by piece, rotation, then x + SHIFTED_PIECE_TABLE_OFFSET
+};
+
+constexpr ShiftedPieceTable getShiftedPieceTable() {
+  ShiftedPieceTable table = {};
   for (int p = 0; p < 7; p++) {
-    for (int rot = 0; rot < 4; rot++) {
-      for (int x = -3; x <= 8;
-           x++) { // Lowest possible x is -2, highest possible is 7. Then one extra on either side.
-        int tableX = x + X_BOUNDS_COLLISION_TABLE_OFFSET;
-        table[p][rot][tableX] = 0; // No collision by default
+    for (int rot = 0; rot < PIECE_LIST[p].numRotations; rot++) {
+      for (int x = -SHIFTED_PIECE_TABLE_OFFSET; x < SHIFTED_PIECE_TABLE_WIDTH - SHIFTED_PIECE_TABLE_OFFSET; x++) {
+        ShiftedPiece &entry = table.entries[p][rot][x + SHIFTED_PIECE_TABLE_OFFSET];
         for (int row = 0; row < 4; row++) {
-          if (SHIFTBY(PIECE_LIST[p].rowsByRotation[rot][row], x) >= 1024) {
-            table[p][rot][tableX] = 1; // Mark the collision
-            break;
-          }
-          if (SHIFTBY(PIECE_LIST[p].rowsByRotation[rot][row], x - 1) & 1) {
-            table[p][rot][tableX] = 1; // Mark the collision
-            break;
+          int pieceRow = PIECE_LIST[p].rowsByRotation[rot][row];
+          entry.rows[row] = SHIFTBY(pieceRow, x);
+          // Mark the collision if a cell goes past the left wall, or off the right one
+          if (SHIFTBY(pieceRow, x) >= 1024 || (SHIFTBY(pieceRow, x - 1) & 1)) {
+            entry.isOutOfBounds = 1;
           }
         }
       }
@@ -35,7 +39,13 @@ xtable getRangeXTable() {
   return table;
 }
 
-const xtable X_BOUNDS_COLLISION_TABLE = getRangeXTable();
+/** Generated at compile time, so there's nothing to build on startup. */
+inline constexpr ShiftedPieceTable SHIFTED_PIECE_TABLE = getShiftedPieceTable();
+
+/** Gets a piece shifted to x, for any x from -SHIFTED_PIECE_TABLE_OFFSET up to the table's width. */
+inline const ShiftedPiece *getShiftedPiece(const Piece *piece, int rotationIndex, int x) {
+  return &SHIFTED_PIECE_TABLE.entries[piece->index][rotationIndex][x + SHIFTED_PIECE_TABLE_OFFSET];
+}
 
 /**
  * Calculates a lookup table for the Y value you'd be at while doing shift number N.
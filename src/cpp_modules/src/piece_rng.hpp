@@ -1,3 +1,5 @@
 #include "types.hpp"
 
+extern int transitionProbability[7][7]; // Chance out of 64 of each piece, given the previous piece
+
 Piece getRandomPiece(Piece previousPiece);
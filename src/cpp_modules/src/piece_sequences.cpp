@@ -0,0 +1,255 @@
+#include "piece_sequences.hpp"
+#include "piece_rng.hpp"
+#include "../data/canonical_sequences.hpp"
+#include <array>
+#include <fcntl.h>
+#include <string.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/** The set for the last config that asked for one, along with what it was built from. */
+struct LoadedPieceSequences {
+  int isLoaded;
+  int seed;
+  int numSequences;
+  int sequenceLength;
+  std::string filePath;
+  int isFromFile; // Whether the set came from filePath, rather than the canonical set it falls back to
+  PieceSequenceSet sequenceSet;
+};
+
+PieceSequenceSet CANONICAL_PIECE_SEQUENCES = {}; // Unpacked on first use
+LoadedPieceSequences LOADED_PIECE_SEQUENCES = {};
+
+array<int, 256> getBase64DecodeTable(){
+  array<int, 256> table;
+  table.fill(-1);
+  const char *alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  for (int i = 0; i < 64; i++) {
+    table[(unsigned char) alphabet[i]] = i;
+  }
+  return table;
+}
+
+array<int, 256> base64DecodeTable = getBase64DecodeTable();
+
+std::vector<uint8_t> decodeBase64(const char *str){
+  std::vector<uint8_t> bytes;
+  int buffer = 0;
+  int numBits = 0;
+  for (const char *c = str; *c != '\0' && *c != '='; c++) {
+    buffer = (buffer << 6) | base64DecodeTable[(unsigned char) *c];
+    numBits += 6;
+    if (numBits >= 8) {
+      numBits -= 8;
+      bytes.push_back((uint8_t) (buffer >> numBits));
+      buffer &= (1 << numBits) - 1;
+    }
+  }
+  return bytes;
+}
+
+uint32_t readUint32(const uint8_t *data){
+  return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+void writeUint32(uint32_t value, OUT uint8_t *data){
+  for (int i = 0; i < 4; i++) {
+    data[i] = (value >> (8 * i)) & 0xFF;
+  }
+}
+
+const int *getPieceSequence(const PieceSequenceSet *sequenceSet, int previousPieceIndex, int i){
+  int index = previousPieceIndex * sequenceSet->numPerBatch + i % sequenceSet->numPerBatch;
+  return &sequenceSet->pieces[(size_t) index * sequenceSet->length];
+}
+
+int unpackPieceSequences(const uint8_t *data, size_t size, OUT PieceSequenceSet *sequenceSet){
+  if (size < PACKED_SEQUENCES_HEADER_SIZE || memcmp(data, PACKED_SEQUENCES_MAGIC, 4) != 0) {
+    return false;
+  }
+  uint32_t numPerBatch = readUint32(data + 4);
+  uint32_t length = readUint32(data + 8);
+  if (numPerBatch < 1 || numPerBatch > MAX_SEQUENCES_PER_BATCH || length < 1 || length > MAX_SEQUENCE_LENGTH) {
+    return false;
+  }
+  size_t numPieces = (size_t) 7 * numPerBatch * length;
+  if (size < PACKED_SEQUENCES_HEADER_SIZE + (numPieces * 3 + 7) / 8) {
+    return false;
+  }
+
+  const uint8_t *packed = data + PACKED_SEQUENCES_HEADER_SIZE;
+  sequenceSet->numPerBatch = numPerBatch;
+  sequenceSet->length = length;
+  sequenceSet->pieces.resize(numPieces);
+  for (size_t i = 0; i < numPieces; i++) {
+    size_t bit = i * 3;
+    int twoBytes = packed[bit / 8] | (bit / 8 + 1 < (numPieces * 3 + 7) / 8 ? packed[bit / 8 + 1] << 8 : 0);
+    int piece = (twoBytes >> (bit % 8)) & 7;
+    if (piece == 7) {
+      return false;
+    }
+    sequenceSet->pieces[i] = piece;
+  }
+  return true;
+}
+
+int loadPieceSequenceFile(char const *path, OUT PieceSequenceSet *sequenceSet){
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  void *mapped = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+  int isValid = unpackPieceSequences((const uint8_t *) mapped, fileStat.st_size, sequenceSet);
+  munmap(mapped, fileStat.st_size);
+  return isValid;
+}
+
+int writePieceSequenceFile(char const *path, const PieceSequenceSet *sequenceSet){
+  size_t numPieces = sequenceSet->pieces.size();
+  std::vector<uint8_t> data(PACKED_SEQUENCES_HEADER_SIZE + (numPieces * 3 + 7) / 8, 0);
+  memcpy(data.data(), PACKED_SEQUENCES_MAGIC, 4);
+  writeUint32(sequenceSet->numPerBatch, &data[4]);
+  writeUint32(sequenceSet->length, &data[8]);
+  uint8_t *packed = &data[PACKED_SEQUENCES_HEADER_SIZE];
+  for (size_t i = 0; i < numPieces; i++) {
+    size_t bit = i * 3;
+    int shifted = sequenceSet->pieces[i] << (bit % 8);
+    packed[bit / 8] |= shifted & 0xFF;
+    if (shifted >> 8) {
+      packed[bit / 8 + 1] |= shifted >> 8;
+    }
+  }
+
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  int isWritten = fwrite(data.data(), 1, data.size(), file) == data.size();
+  return fclose(file) == 0 && isWritten;
+}
+
+void generatePieceSequences(int seed, int numPerBatch, int length, OUT PieceSequenceSet *sequenceSet){
+  sequenceSet->numPerBatch = numPerBatch;
+  sequenceSet->length = length;
+  sequenceSet->pieces.resize((size_t) 7 * numPerBatch * length);
+  for (int previousPieceIndex = 0; previousPieceIndex < 7; previousPieceIndex++) {
+    // Seed each batch separately, so that asking for more sequences only appends to the batch
+    std::seed_seq seedSequence{seed, previousPieceIndex};
+    std::mt19937 generator(seedSequence);
+    for (int i = 0; i < numPerBatch; i++) {
+      int *sequence = &sequenceSet->pieces[((size_t) previousPieceIndex * numPerBatch + i) * length];
+      int previous = previousPieceIndex;
+      for (int j = 0; j < length; j++) {
+        int rand = generator() % 64; // Unbiased, since 64 divides 2^32
+        int piece = 0;
+        while (rand >= transitionProbability[previous][piece]) {
+          rand -= transitionProbability[previous][piece];
+          piece++;
+        }
+        sequence[j] = piece;
+        previous = piece;
+      }
+    }
+  }
+}
+
+/** Copies the first numPerBatch sequences of each batch, cut to the given length. */
+void truncatePieceSequences(const PieceSequenceSet *source, int numPerBatch, int length, OUT PieceSequenceSet *sequenceSet){
+  sequenceSet->numPerBatch = numPerBatch;
+  sequenceSet->length = length;
+  sequenceSet->pieces.clear();
+  for (int previousPieceIndex = 0; previousPieceIndex < 7; previousPieceIndex++) {
+    for (int i = 0; i < numPerBatch; i++) {
+      const int *sequence = getPieceSequence(source, previousPieceIndex, i);
+      sequenceSet->pieces.insert(sequenceSet->pieces.end(), sequence, sequence + length);
+    }
+  }
+}
+
+const PieceSequenceSet *getCanonicalPieceSequences(){
+  if (CANONICAL_PIECE_SEQUENCES.pieces.empty()) {
+    std::vector<uint8_t> packed = decodeBase64(CANONICAL_SEQUENCES_BASE64);
+    unpackPieceSequences(packed.data(), packed.size(), &CANONICAL_PIECE_SEQUENCES);
+  }
+  return &CANONICAL_PIECE_SEQUENCES;
+}
+
+/**
+ * Builds the set for a config that doesn't use the whole canonical set.
+ * @returns whether the set came from the config's sequence file
+ */
+int buildPieceSequenceSet(const SearchConfig *searchConfig, OUT PieceSequenceSet *sequenceSet){
+  if (searchConfig->sequenceFile[0] == '\0' && searchConfig->sequenceSeed != 0) {
+    generatePieceSequences(searchConfig->sequenceSeed,
+                           searchConfig->numSequences > 0 ? searchConfig->numSequences : CANONICAL_SEQUENCES_PER_BATCH,
+                           searchConfig->sequenceLength > 0 ? searchConfig->sequenceLength : SEQUENCE_LENGTH,
+                           sequenceSet);
+    return false;
+  }
+
+  const PieceSequenceSet *source = getCanonicalPieceSequences();
+  PieceSequenceSet loaded;
+  if (searchConfig->sequenceFile[0] != '\0') {
+    if (loadPieceSequenceFile(searchConfig->sequenceFile, &loaded)) {
+      source = &loaded;
+    } else {
+      maybePrint("Unable to load piece sequence file: %s\n", searchConfig->sequenceFile);
+    }
+  }
+  int numPerBatch = searchConfig->numSequences > 0 ? min(searchConfig->numSequences, source->numPerBatch) : source->numPerBatch;
+  int length = searchConfig->sequenceLength > 0 ? min(searchConfig->sequenceLength, source->length) : source->length;
+  if (source == &loaded && numPerBatch == loaded.numPerBatch && length == loaded.length) {
+    *sequenceSet = std::move(loaded);
+  } else {
+    truncatePieceSequences(source, numPerBatch, length, sequenceSet);
+  }
+  return source == &loaded;
+}
+
+const PieceSequenceSet *getPieceSequenceSet(const SearchConfig *searchConfig){
+  int usesCanonicalSet = searchConfig->sequenceFile[0] == '\0' && searchConfig->sequenceSeed == 0 &&
+                         searchConfig->numSequences == 0 && searchConfig->sequenceLength == 0;
+  if (usesCanonicalSet) {
+    return getCanonicalPieceSequences();
+  }
+
+  LoadedPieceSequences *loaded = &LOADED_PIECE_SEQUENCES;
+  int isSameConfig = loaded->isLoaded && loaded->seed == searchConfig->sequenceSeed && loaded->numSequences == searchConfig->numSequences &&
+                     loaded->sequenceLength == searchConfig->sequenceLength && loaded->filePath == searchConfig->sequenceFile;
+  if (!isSameConfig) {
+    loaded->isFromFile = buildPieceSequenceSet(searchConfig, &loaded->sequenceSet);
+    loaded->isLoaded = true;
+    loaded->seed = searchConfig->sequenceSeed;
+    loaded->numSequences = searchConfig->numSequences;
+    loaded->sequenceLength = searchConfig->sequenceLength;
+    loaded->filePath = searchConfig->sequenceFile;
+  }
+  return &loaded->sequenceSet;
+}
+
+int isPieceSequenceFileLoaded(const SearchConfig *searchConfig){
+  const LoadedPieceSequences *loaded = &LOADED_PIECE_SEQUENCES;
+  return loaded->isLoaded && loaded->isFromFile && loaded->filePath == searchConfig->sequenceFile;
+}
+
+std::string savePieceSequences(char const *path, const SearchConfig *searchConfig){
+  const PieceSequenceSet *sequenceSet = getPieceSequenceSet(searchConfig);
+  if (!writePieceSequenceFile(path, sequenceSet)) {
+    return "{\"error\":\"Unable to write the piece sequence file\"}";
+  }
+  char buf[80];
+  snprintf(buf, sizeof(buf), "{\"numSequences\":%d,\"sequenceLength\":%d}", sequenceSet->numPerBatch, sequenceSet->length);
+  return std::string(buf);
+}
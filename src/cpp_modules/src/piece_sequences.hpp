@@ -0,0 +1,64 @@
+#ifndef PIECE_SEQUENCES
+#define PIECE_SEQUENCES
+
+#include "types.hpp"
+#include "utils.hpp"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#define CANONICAL_SEQUENCES_PER_BATCH 1000 // The size of the built-in set (see data/canonical_sequences.hpp)
+#define MAX_SEQUENCES_PER_BATCH 100000
+#define MAX_SEQUENCE_LENGTH 64
+#define PACKED_SEQUENCES_MAGIC "PSQ1"
+#define PACKED_SEQUENCES_HEADER_SIZE 12 // The magic, then the sequences per batch and the sequence length as little-endian uint32s
+
+/**
+ * The piece sequences that playouts follow, in one batch per previous piece (indexed by that piece),
+ * so that a playout can continue the RNG from the last piece the search knows about.
+ */
+struct PieceSequenceSet {
+  int numPerBatch;
+  int length;
+  std::vector<int> pieces; // 7 * numPerBatch * length pieces
+};
+
+/** Gets the i-th sequence of the batch that follows the given piece (wrapping around the batch). */
+const int *getPieceSequence(const PieceSequenceSet *sequenceSet, int previousPieceIndex, int i);
+
+/**
+ * Gets the sequence set for a request's config: the file in sequenceFile if set, otherwise sequences generated from sequenceSeed if
+ * that's set, otherwise the canonical set. numSequences and sequenceLength, if set, truncate the file and canonical sets, and size generated ones.
+ * The last set built is kept for later requests. Falls back to the canonical set if the file can't be loaded.
+ */
+const PieceSequenceSet *getPieceSequenceSet(const SearchConfig *searchConfig);
+
+/** Whether the set last built for this config's sequence file came from the file, rather than falling back to the canonical set. */
+int isPieceSequenceFileLoaded(const SearchConfig *searchConfig);
+
+/**
+ * Samples sequences from transitionProbability, using a generator whose output doesn't depend on the standard library,
+ * so that a seed gives the same sequences on every platform.
+ */
+void generatePieceSequences(int seed, int numPerBatch, int length, OUT PieceSequenceSet *sequenceSet);
+
+/**
+ * Unpacks a set from its packed form (the header, then every piece as 3 bits, least significant first).
+ * @returns whether the data was a valid set
+ */
+int unpackPieceSequences(const uint8_t *data, size_t size, OUT PieceSequenceSet *sequenceSet);
+
+/** Reads a packed set from a file by mapping it into memory. @returns whether the file was a valid set */
+int loadPieceSequenceFile(char const *path, OUT PieceSequenceSet *sequenceSet);
+
+/** Writes a set in the packed form, e.g. to save a large generated set for offline analysis. @returns whether the write succeeded */
+int writePieceSequenceFile(char const *path, const PieceSequenceSet *sequenceSet);
+
+/**
+ * Writes the set that a request with this config would play out (see getPieceSequenceSet) to a packed file,
+ * so that it can be loaded back later through sequenceFile.
+ * @returns a JSON report of the size of the set written
+ */
+std::string savePieceSequences(char const *path, const SearchConfig *searchConfig);
+
+#endif
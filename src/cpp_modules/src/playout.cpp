@@ -2,22 +2,72 @@
 #include "eval.hpp"
 #include "utils.hpp"
 #include "params.hpp"
-#include "../data/canonical_sequences.hpp"
+#include "search_config.hpp"
+#include "eval_cache.hpp"
+#include "piece_rng.hpp"
+#include "piece_sequences.hpp"
 
 using namespace std;
 
-/** Selects the highest value lock placement using the fast eval function. */
+#define EXPAND_BATCH_SIZE 16 // How many child states the placement policy expands at a time (see expandGameState)
+
+/**
+ * Narrows the lock placements down to the K with the best surface (plus holes and line clears), without running the full eval.
+ * The remaining placements keep their original order.
+ */
+void prefilterLockPlacements(GameState gameState, const EvalContext *evalContext, int topK, OUT vector<LockPlacement> &lockPlacements){
+  FastEvalWeights weights = evalContext->weights;
+  vector<pair<float, int>> scoredIndices;
+  GameState children[EXPAND_BATCH_SIZE];
+  for (int start = 0; start < (int) lockPlacements.size(); start += EXPAND_BATCH_SIZE) {
+    int batchSize = min(EXPAND_BATCH_SIZE, (int) lockPlacements.size() - start);
+    expandGameState(&gameState, &lockPlacements[start], batchSize, evalContext, children);
+    for (int j = 0; j < batchSize; j++) {
+      GameState &newState = children[j];
+      float score = weights.surfaceCoef * rateSurface(newState.surfaceArray, evalContext)
+                  + weights.holeCoef * getAdjustedNumHoles(newState)
+                  + getLineClearFactor(newState.lines - gameState.lines, weights, evalContext->shouldRewardLineClears);
+      scoredIndices.push_back({-score, start + j}); // Negated so that the best sort first, with ties going to the earlier placement
+    }
+  }
+  nth_element(scoredIndices.begin(), scoredIndices.begin() + topK, scoredIndices.end());
+  vector<int> keptIndices;
+  for (int i = 0; i < topK; i++) {
+    keptIndices.push_back(scoredIndices[i].second);
+  }
+  sort(keptIndices.begin(), keptIndices.end());
+  vector<LockPlacement> keptPlacements;
+  for (int index : keptIndices) {
+    keptPlacements.push_back(lockPlacements[index]);
+  }
+  lockPlacements = keptPlacements;
+}
+
+/**
+ * Selects the highest value lock placement using the fast eval function.
+ * @param topK - if positive, only the K placements with the best surface are fully evaluated (see prefilterLockPlacements)
+ */
 LockPlacement pickLockPlacement(GameState gameState,
                            const EvalContext *evalContext,
+                           EvalCache *evalCache,
+                           int topK,
                            OUT vector<LockPlacement> &lockPlacements) {
-  float bestSoFar = evalContext->weights.deathCoef - 1;
+  if (topK > 0 && (int) lockPlacements.size() > topK) {
+    prefilterLockPlacements(gameState, evalContext, topK, lockPlacements);
+  }
+  float bestSoFar = toScoreUnits(evalContext->weights.deathCoef, evalContext) - 1;
   LockPlacement bestPlacement = {};
-  for (auto lockPlacement : lockPlacements) {
-    GameState newState = advanceGameState(gameState, lockPlacement, evalContext);
-    float evalScore = fastEval(gameState, newState, lockPlacement, evalContext);
-    if (evalScore > bestSoFar) {
-      bestSoFar = evalScore;
-      bestPlacement = lockPlacement;
+  GameState children[EXPAND_BATCH_SIZE];
+  for (int start = 0; start < (int) lockPlacements.size(); start += EXPAND_BATCH_SIZE) {
+    int batchSize = min(EXPAND_BATCH_SIZE, (int) lockPlacements.size() - start);
+    expandGameState(&gameState, &lockPlacements[start], batchSize, evalContext, children);
+    for (int j = 0; j < batchSize; j++) {
+      // Only the argmax matters here, so the eval can stop as soon as a placement can't beat the best so far
+      float evalScore = cachedBoundedFastEval(&gameState, &children[j], lockPlacements[start + j], evalContext, bestSoFar, evalCache);
+      if (evalScore > bestSoFar) {
+        bestSoFar = evalScore;
+        bestPlacement = lockPlacements[start + j];
+      }
     }
   }
   maybePrint("\nBest placement: %d %d\n", bestPlacement.rotationIndex, bestPlacement.x - SPAWN_X);
@@ -25,34 +75,44 @@ LockPlacement pickLockPlacement(GameState gameState,
 }
 
 
+/** Gets the context that the playout policy picks placements with: the full eval, or the light one if configured. */
+const EvalContext *getPlayoutPolicyContext(const EvalContext *evalContext, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig){
+  return searchConfig->lightPlayoutPolicy ? &evalContextTable->lightContexts[evalContext->contextId] : evalContext;
+}
+
+/** The light playout policy only considers placements that are reachable without tucks. */
+int getPlayoutCanTuck(const SearchConfig *searchConfig){
+  return searchConfig->lightPlayoutPolicy ? false : searchConfig->canTuck;
+}
+
 /**
  * Plays out a starting state 10 moves into the future.
- * @returns the total value of the playout (intermediate rewards + eval of the final board)
+ * @returns the total value of the playout (intermediate rewards + eval of the final board), in score units (see toScoreUnits)
  */
-float playSequence(GameState gameState, const PieceRangeContext pieceRangeContextLookup[3], const int pieceSequence[SEQUENCE_LENGTH], int playoutLength) {
+float playSequence(GameState gameState, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig, EvalCache *evalCache, const int pieceSequence[SEQUENCE_LENGTH], int playoutLength) {
   float totalReward = 0;
   for (int i = 0; i < playoutLength; i++) {
     // Figure out modes and eval context
-    const EvalContext evalContextRaw = getEvalContext(gameState, pieceRangeContextLookup);
-    const EvalContext *evalContext = &evalContextRaw;
-    FastEvalWeights weights = getWeights(evalContext->aiMode);
+    const EvalContext *evalContext = lookupEvalContext(gameState, evalContextTable);
+    const EvalContext *policyContext = getPlayoutPolicyContext(evalContext, evalContextTable, searchConfig);
+    FastEvalWeights weights = evalContext->weights;
 
     // Get the lock placements
     std::vector<LockPlacement> lockPlacements;
     Piece piece = PIECE_LIST[pieceSequence[i]];
-    moveSearch(gameState, &piece, evalContext->pieceRangeContext.inputFrameTimeline, lockPlacements);
+    moveSearch(gameState, &piece, evalContext->pieceRangeContext.inputFrameTimeline, getPlayoutCanTuck(searchConfig), lockPlacements);
 
     if (lockPlacements.size() == 0) {
-      return weights.deathCoef;
+      return toScoreUnits(weights.deathCoef, evalContext);
     }
 
     // Pick the best placement
-    LockPlacement bestMove = pickLockPlacement(gameState, evalContext, lockPlacements);
+    LockPlacement bestMove = pickLockPlacement(gameState, policyContext, evalCache, searchConfig->playoutTopK, lockPlacements);
 
     // On the last move, do a final evaluation
     if (i == playoutLength - 1) {
       GameState nextState = advanceGameState(gameState, bestMove, evalContext);
-      float evalScore = fastEval(gameState, nextState, bestMove, evalContext);
+      float evalScore = cachedFastEval(gameState, nextState, bestMove, evalContext, evalCache);
       if (PLAYOUT_LOGGING_ENABLED) {
         gameState = nextState;
         printBoard(gameState.board);
@@ -66,8 +126,8 @@ float playSequence(GameState gameState, const PieceRangeContext pieceRangeContex
     // Otherwise, update the state to keep playing
     int oldLines = gameState.lines;
     gameState = advanceGameState(gameState, bestMove, evalContext);
-    FastEvalWeights rewardWeights = evalContext->aiMode == DIG ? getWeights(STANDARD) : weights; // When the AI is digging, still deduct from the overall value of the sequence at standard levels
-    totalReward += getLineClearFactor(gameState.lines - oldLines, rewardWeights, evalContext->shouldRewardLineClears);
+    FastEvalWeights rewardWeights = evalContext->aiMode == DIG ? searchConfig->weightsByMode[STANDARD] : weights; // When the AI is digging, still deduct from the overall value of the sequence at standard levels
+    totalReward += toScoreUnits(getLineClearFactor(gameState.lines - oldLines, rewardWeights, evalContext->shouldRewardLineClears), evalContext);
     if (PLAYOUT_LOGGING_ENABLED) {
       printBoard(gameState.board);
       printf("Best placement: %c %d, %d\n\n", bestMove.piece->id, bestMove.rotationIndex, bestMove.x - SPAWN_X);
@@ -77,34 +137,424 @@ float playSequence(GameState gameState, const PieceRangeContext pieceRangeContex
 }
 
 
-float getPlayoutScore(GameState gameState, const PieceRangeContext pieceRangeContextLookup[3], int offsetIndex){
-  if (LOGGING_ENABLED) {
-    return 0;
+/** Gets the best total that a playout could still reach, given its reward so far (in points) and how many more rewards it gets. */
+float getRemainingPlayoutBound(const PlayoutCutoff *cutoff, float rewardSoFar, int numRewardsLeft){
+  return max(cutoff->maxDeathScore, rewardSoFar + numRewardsLeft * cutoff->maxLineClearReward + cutoff->maxEvalScore);
+}
+
+/** Lowers one playout's bound (in points), and cuts off the batch if the candidate can no longer reach the threshold. */
+void tightenPlayoutBound(PlayoutRequest *request, float upperBound, PlayoutCutoff *cutoff){
+  cutoff->upperBound += request->weight * (upperBound - request->upperBound);
+  request->upperBound = upperBound;
+  if (cutoff->upperBound + PLAYOUT_CUTOFF_MARGIN < cutoff->threshold) {
+    cutoff->isCutOff = true;
+  }
+}
+
+/** Writes a playout's total, and tightens the cutoff bound now that this playout's total is known. */
+void finishPlayout(PlayoutRequest request, float total, const EvalContext *evalContext, PlayoutCutoff *cutoff){
+  *request.result = total;
+  if (cutoff != nullptr) {
+    tightenPlayoutBound(&request, fromScoreUnits(total, evalContext), cutoff);
+  }
+}
+
+/**
+ * Plays out a starting state along every requested piece sequence at once, treating the sequences as a trie.
+ * Since the playout policy is deterministic, all the sequences that share a prefix reach the same state after that prefix,
+ * so each distinct prefix is searched and advanced only once, and then the group is split on the next piece.
+ * Each playout's total is the same as playSequence() would give, and is written to its request's result.
+ * With a cutoff, each playout's bound tightens as its rewards become known, and once the cutoff triggers,
+ * the playouts that haven't finished yet are abandoned and their results are left untouched.
+ */
+void playSequencesSharingPrefixes(GameState gameState,
+                                  float totalReward,
+                                  int depth,
+                                  const EvalContextTable *evalContextTable,
+                                  const SearchConfig *searchConfig,
+                                  EvalCache *evalCache,
+                                  vector<PlayoutRequest> const &requests,
+                                  PlayoutCutoff *cutoff) {
+  // Figure out modes and eval context (shared by all the sequences in this subtree)
+  const EvalContext *evalContext = lookupEvalContext(gameState, evalContextTable);
+  const EvalContext *policyContext = getPlayoutPolicyContext(evalContext, evalContextTable, searchConfig);
+  FastEvalWeights weights = evalContext->weights;
+
+  // Group the sequences by their next piece
+  vector<PlayoutRequest> requestsByPiece[7];
+  for (PlayoutRequest const &request : requests) {
+    requestsByPiece[request.pieceSequence[depth]].push_back(request);
+  }
+
+  for (int pieceIndex = 0; pieceIndex < 7; pieceIndex++) {
+    vector<PlayoutRequest> const &pieceRequests = requestsByPiece[pieceIndex];
+    if (pieceRequests.empty()) {
+      continue;
+    }
+    if (cutoff != nullptr && cutoff->isCutOff) {
+      return;
+    }
+
+    // Get the lock placements
+    std::vector<LockPlacement> lockPlacements;
+    Piece piece = PIECE_LIST[pieceIndex];
+    moveSearch(gameState, &piece, evalContext->pieceRangeContext.inputFrameTimeline, getPlayoutCanTuck(searchConfig), lockPlacements);
+
+    if (lockPlacements.size() == 0) {
+      for (PlayoutRequest const &request : pieceRequests) {
+        finishPlayout(request, toScoreUnits(weights.deathCoef, evalContext), evalContext, cutoff);
+      }
+      continue;
+    }
+
+    // Pick the best placement
+    LockPlacement bestMove = pickLockPlacement(gameState, policyContext, evalCache, searchConfig->playoutTopK, lockPlacements);
+    GameState nextState = advanceGameState(gameState, bestMove, evalContext);
+
+    // Sequences that end here get a final evaluation, and the rest keep playing
+    FastEvalWeights rewardWeights = evalContext->aiMode == DIG ? searchConfig->weightsByMode[STANDARD] : weights; // When the AI is digging, still deduct from the overall value of the sequence at standard levels
+    float nextTotalReward = totalReward + toScoreUnits(getLineClearFactor(nextState.lines - gameState.lines, rewardWeights, evalContext->shouldRewardLineClears), evalContext);
+    vector<PlayoutRequest> continuingRequests;
+    float evalScore = 0;
+    int hasEvaluated = false;
+    for (PlayoutRequest const &request : pieceRequests) {
+      if (request.playoutLength - 1 > depth) {
+        continuingRequests.push_back(request);
+        if (cutoff != nullptr) {
+          int numRewardsLeft = request.playoutLength - 2 - depth;
+          tightenPlayoutBound(&continuingRequests.back(), getRemainingPlayoutBound(cutoff, fromScoreUnits(nextTotalReward, evalContext), numRewardsLeft), cutoff);
+        }
+        continue;
+      }
+      if (!hasEvaluated) {
+        evalScore = cachedFastEval(gameState, nextState, bestMove, evalContext, evalCache);
+        hasEvaluated = true;
+      }
+      finishPlayout(request, totalReward + evalScore, evalContext, cutoff);
+    }
+
+    if (!continuingRequests.empty()) {
+      playSequencesSharingPrefixes(nextState, nextTotalReward, depth + 1, evalContextTable, searchConfig, evalCache, continuingRequests, cutoff);
+    }
+  }
+}
+
+
+/** Adds one set of equally weighted playouts (e.g. the short playouts) to the stats. */
+void addPlayoutSetStats(vector<float> const &scores, int useFixedPoint, OUT PlayoutStats *playoutStats){
+  int n = (int) scores.size();
+  if (n == 0) {
+    return;
+  }
+  double scale = useFixedPoint ? FIXED_POINT_SCALE : 1;
+  double sum = 0;
+  double sumOfSquares = 0;
+  for (float score : scores) {
+    sum += score / scale;
+    sumOfSquares += (score / scale) * (score / scale);
+  }
+  double variance = n < 2 ? 0 : max(0.0, (sumOfSquares - sum * sum / n) / (n - 1));
+  playoutStats->playoutVariance = (playoutStats->playoutVariance * playoutStats->numPlayouts + variance * n) / (playoutStats->numPlayouts + n);
+  playoutStats->numPlayouts += n;
+  playoutStats->meanVariance += variance / n;
+}
+
+/**
+ * Starts the cutoff bound at the best possible playout score, or returns null if the bound isn't finite (so cutoffs can't apply).
+ */
+PlayoutCutoff *initPlayoutCutoff(GameState gameState, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig, OUT vector<PlayoutRequest> &requests, PlayoutCutoff *cutoff){
+  if (cutoff == nullptr) {
+    return nullptr;
+  }
+  int maxPlayoutLength = max(searchConfig->playoutLengthShort, searchConfig->playoutLengthLong);
+  getPlayoutContextBounds(gameState, maxPlayoutLength, evalContextTable, searchConfig, &cutoff->maxEvalScore, &cutoff->maxLineClearReward);
+  if (!isfinite(cutoff->maxEvalScore)) {
+    return nullptr;
+  }
+  cutoff->maxDeathScore = -INFINITY;
+  for (int mode = 0; mode < 6; mode++) {
+    cutoff->maxDeathScore = max(cutoff->maxDeathScore, searchConfig->weightsByMode[mode].deathCoef);
+  }
+  cutoff->upperBound = 0;
+  for (PlayoutRequest &request : requests) {
+    request.upperBound = getRemainingPlayoutBound(cutoff, 0, request.playoutLength - 1);
+    cutoff->upperBound += request.weight * request.upperBound;
   }
+  cutoff->isCutOff = cutoff->upperBound + PLAYOUT_CUTOFF_MARGIN < cutoff->threshold;
+  return cutoff;
+}
+
+/** Counts the playouts that were abandoned after a cutoff (whose results are still NAN). */
+int countUnfinishedPlayouts(vector<float> const &scores){
+  int count = 0;
+  for (float score : scores) {
+    if (isnan(score)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void buildStratifiedSequences(const PieceSequenceSet *sequenceSet, int previousPieceIndex, int stratifyDepth, int numPlayouts, OUT StratifiedSequences *sequences){
+  int numStrata = 1;
+  for (int d = 0; d < stratifyDepth; d++) {
+    numStrata *= 7;
+  }
+  sequences->stratifyDepth = stratifyDepth;
+  sequences->sequenceLength = sequenceSet->length;
+  sequences->stratumWeights.assign(numStrata, 1);
+  sequences->stratumCounts.assign(numStrata, 0);
+  sequences->pieces.clear();
+  sequences->stratumIndices.clear();
+
+  for (int stratum = 0; stratum < numStrata; stratum++) {
+    // Decode the prefix (base 7 digits, first piece most significant) and its probability
+    int prefix[2];
+    int previous = previousPieceIndex;
+    for (int d = 0, remaining = stratum, divisor = numStrata / 7; d < stratifyDepth; d++, divisor /= 7) {
+      prefix[d] = remaining / divisor;
+      remaining %= divisor;
+      sequences->stratumWeights[stratum] *= transitionProbability[previous][prefix[d]] / 64.0;
+      previous = prefix[d];
+    }
+
+    // Proportional allocation, but every stratum needs at least one playout for the estimate to be unbiased
+    int count = max(1, (int) lround(numPlayouts * sequences->stratumWeights[stratum]));
+    sequences->stratumCounts[stratum] = count;
+
+    // Sample the rest of each sequence from the batch that follows the last prefix piece.
+    // Strata that share a last piece start at different points in the batch, so that they don't reuse the same samples.
+    int batchStart = (stratum * (sequenceSet->numPerBatch / numStrata)) % sequenceSet->numPerBatch;
+    for (int i = 0; i < count; i++) {
+      const int *sampled = getPieceSequence(sequenceSet, previous, batchStart + i);
+      for (int j = 0; j < sequenceSet->length; j++) {
+        sequences->pieces.push_back(j < stratifyDepth ? prefix[j] : sampled[j - stratifyDepth]);
+      }
+      sequences->stratumIndices.push_back(stratum);
+    }
+  }
+}
+
+/**
+ * Combines per-sequence playout scores into the probability-weighted mean over the strata.
+ * If playoutStats is not null, also adds the variance of the combined estimate (the weighted within-stratum variances) to it.
+ * @returns the estimate in points (converting from milli-points in fixed-point mode)
+ */
+float combineStratifiedScores(const StratifiedSequences *sequences, vector<float> const &scores, int useFixedPoint, OUT PlayoutStats *playoutStats){
+  int numStrata = (int) sequences->stratumWeights.size();
+  double scale = useFixedPoint ? FIXED_POINT_SCALE : 1;
+  vector<float> stratumTotals(numStrata, 0);
+  vector<long long> stratumTotalsFixed(numStrata, 0);
+  vector<double> stratumSquares(numStrata, 0);
+  for (size_t i = 0; i < scores.size(); i++) {
+    stratumTotals[sequences->stratumIndices[i]] += scores[i];
+    stratumTotalsFixed[sequences->stratumIndices[i]] += (long long) scores[i];
+    stratumSquares[sequences->stratumIndices[i]] += (scores[i] / scale) * (scores[i] / scale);
+  }
+  double estimate = 0;
+  double meanVariance = 0;
+  double playoutVariance = 0;
+  for (int stratum = 0; stratum < numStrata; stratum++) {
+    double total = useFixedPoint ? (double) stratumTotalsFixed[stratum] / FIXED_POINT_SCALE : stratumTotals[stratum];
+    int n = sequences->stratumCounts[stratum];
+    double weight = sequences->stratumWeights[stratum];
+    estimate += weight * total / n;
+    double variance = n < 2 ? 0 : max(0.0, (stratumSquares[stratum] - total * total / n) / (n - 1));
+    meanVariance += weight * weight * variance / n;
+    playoutVariance += weight * variance;
+  }
+  if (playoutStats != nullptr) {
+    playoutStats->playoutVariance = (playoutStats->playoutVariance * playoutStats->numPlayouts + playoutVariance * scores.size()) / (playoutStats->numPlayouts + scores.size());
+    playoutStats->numPlayouts += (int) scores.size();
+    playoutStats->meanVariance += meanVariance;
+  }
+  return (float) estimate;
+}
+
+/** Picks the sequences for the configured playouts: the first ones in the batch for the previous piece, or stratified ones. */
+void initPlayoutSequences(const SearchConfig *searchConfig, int offsetIndex, OUT PlayoutSequences *sequences){
+  sequences->isStratified = searchConfig->playoutStratifyDepth > 0;
+  sequences->sequenceSet = getPieceSequenceSet(searchConfig);
+  sequences->previousPieceIndex = offsetIndex;
+  sequences->numShort = min(searchConfig->numPlayoutsShort, sequences->sequenceSet->numPerBatch);
+  sequences->numLong = min(searchConfig->numPlayoutsLong, sequences->sequenceSet->numPerBatch);
+  if (sequences->isStratified) {
+    buildStratifiedSequences(sequences->sequenceSet, /* previousPieceIndex= */ offsetIndex, searchConfig->playoutStratifyDepth, searchConfig->numPlayoutsLong, &sequences->longSequences);
+    buildStratifiedSequences(sequences->sequenceSet, /* previousPieceIndex= */ offsetIndex, searchConfig->playoutStratifyDepth, searchConfig->numPlayoutsShort, &sequences->shortSequences);
+    sequences->numLong = searchConfig->numPlayoutsLong == 0 ? 0 : (int) sequences->longSequences.stratumIndices.size();
+    sequences->numShort = searchConfig->numPlayoutsShort == 0 ? 0 : (int) sequences->shortSequences.stratumIndices.size();
+  }
+}
+
+/** Adds a request for each sequence, with the results going into the given score arrays (which are resized to fit, and start out NAN). */
+void addPlayoutRequests(const PlayoutSequences *sequences, const SearchConfig *searchConfig, OUT vector<float> &shortPlayoutScores, OUT vector<float> &longPlayoutScores, OUT vector<PlayoutRequest> &requests){
+  shortPlayoutScores.assign(sequences->numShort, NAN);
+  longPlayoutScores.assign(sequences->numLong, NAN);
+  int playoutLengthShort = min(searchConfig->playoutLengthShort, sequences->sequenceSet->length);
+  int playoutLengthLong = min(searchConfig->playoutLengthLong, sequences->sequenceSet->length);
+  // Run the long and short playouts together, since the short sequences are prefixes of the long ones
+  for (int i = 0; i < sequences->numLong; i++) {
+    if (sequences->isStratified) {
+      StratifiedSequences const &strata = sequences->longSequences;
+      int stratum = strata.stratumIndices[i];
+      requests.push_back({&strata.pieces[i * strata.sequenceLength], playoutLengthLong, &longPlayoutScores[i],
+                          (float) (strata.stratumWeights[stratum] / strata.stratumCounts[stratum]), /* upperBound= */ 0});
+    } else {
+      const int *pieceSequence = getPieceSequence(sequences->sequenceSet, sequences->previousPieceIndex, i);
+      requests.push_back({pieceSequence, playoutLengthLong, &longPlayoutScores[i], 1.0f / sequences->numLong, /* upperBound= */ 0});
+    }
+  }
+  for (int i = 0; i < sequences->numShort; i++) {
+    if (sequences->isStratified) {
+      StratifiedSequences const &strata = sequences->shortSequences;
+      int stratum = strata.stratumIndices[i];
+      requests.push_back({&strata.pieces[i * strata.sequenceLength], playoutLengthShort, &shortPlayoutScores[i],
+                          (float) (strata.stratumWeights[stratum] / strata.stratumCounts[stratum]), /* upperBound= */ 0});
+    } else {
+      const int *pieceSequence = getPieceSequence(sequences->sequenceSet, sequences->previousPieceIndex, i);
+      requests.push_back({pieceSequence, playoutLengthShort, &shortPlayoutScores[i], 1.0f / sequences->numShort, /* upperBound= */ 0});
+    }
+  }
+}
 
-  int offset = offsetIndex * 1000; // Index into the sequences in batches, with batch size equal to the total number of playouts
+/** Combines the finished playouts into the playout score, in points. */
+float combinePlayoutScores(const PlayoutSequences *sequences, const SearchConfig *searchConfig, vector<float> const &shortPlayoutScores, vector<float> const &longPlayoutScores, OUT PlayoutStats *playoutStats){
+  if (playoutStats != nullptr) {
+    *playoutStats = {};
+  }
+  if (sequences->isStratified) {
+    return (sequences->numShort == 0 ? 0 : combineStratifiedScores(&sequences->shortSequences, shortPlayoutScores, searchConfig->useFixedPoint, playoutStats)) +
+           (sequences->numLong == 0 ? 0 : combineStratifiedScores(&sequences->longSequences, longPlayoutScores, searchConfig->useFixedPoint, playoutStats));
+  }
 
+  // Sum in sequence order, so that the totals match playing each sequence separately.
+  // In fixed-point mode, each playout score is an integer number of milli-points, so sum them exactly
   float longPlayoutScore = 0;
-  for (int i = 0; i < NUM_PLAYOUTS_LONG; i++) {
-    // Do one playout
-    const int *pieceSequence = canonicalPieceSequences + (offset + i) * SEQUENCE_LENGTH; // Index into the mega array of piece sequences;
-    float playoutScore = playSequence(gameState, pieceRangeContextLookup, pieceSequence, PLAYOUT_LENGTH_LONG);
+  long long longPlayoutScoreFixed = 0;
+  for (float playoutScore : longPlayoutScores) {
     longPlayoutScore += playoutScore;
+    longPlayoutScoreFixed += (long long) playoutScore;
   }
   // printf("(A) longPlayoutScore %f \n", longPlayoutScore);
 
   float shortPlayoutScore = 0;
-  for (int i = 0; i < NUM_PLAYOUTS_SHORT; i++) {
-    // Do one playout
-    const int *pieceSequence = canonicalPieceSequences + (offset + i) * SEQUENCE_LENGTH; // Index into the mega array of piece sequences;
-    float playoutScore = playSequence(gameState, pieceRangeContextLookup, pieceSequence, PLAYOUT_LENGTH_SHORT);
+  long long shortPlayoutScoreFixed = 0;
+  for (float playoutScore : shortPlayoutScores) {
     shortPlayoutScore += playoutScore;
+    shortPlayoutScoreFixed += (long long) playoutScore;
   }
   // printf("    shortPlayoutScore %f \n", shortPlayoutScore);
 
+  if (playoutStats != nullptr) {
+    addPlayoutSetStats(shortPlayoutScores, searchConfig->useFixedPoint, playoutStats);
+    addPlayoutSetStats(longPlayoutScores, searchConfig->useFixedPoint, playoutStats);
+  }
+
+  if (searchConfig->useFixedPoint) {
+    return (sequences->numShort == 0 ? 0 : (float) ((double) shortPlayoutScoreFixed / sequences->numShort / FIXED_POINT_SCALE)) +
+           (sequences->numLong == 0 ? 0 : (float) ((double) longPlayoutScoreFixed / sequences->numLong / FIXED_POINT_SCALE));
+  }
+
+  return (sequences->numShort == 0 ? 0 : (shortPlayoutScore / sequences->numShort)) +
+         (sequences->numLong == 0 ? 0 : (longPlayoutScore / sequences->numLong));
+}
+
+float getPlayoutScore(GameState gameState, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig, EvalCache *evalCache, int offsetIndex, OUT PlayoutStats *playoutStats, PlayoutCutoff *cutoff){
+  if (LOGGING_ENABLED) {
+    return 0;
+  }
+  PlayoutSequences sequences;
+  initPlayoutSequences(searchConfig, offsetIndex, &sequences);
+  vector<float> shortPlayoutScores;
+  vector<float> longPlayoutScores;
+  vector<PlayoutRequest> requests;
+  addPlayoutRequests(&sequences, searchConfig, shortPlayoutScores, longPlayoutScores, requests);
+
+  cutoff = initPlayoutCutoff(gameState, evalContextTable, searchConfig, requests, cutoff);
+  if (!requests.empty()) {
+    playSequencesSharingPrefixes(gameState, 0, 0, evalContextTable, searchConfig, evalCache, requests, cutoff);
+  }
+  if (cutoff != nullptr && cutoff->isCutOff) {
+    cutoff->numPlayoutsCutOff = countUnfinishedPlayouts(shortPlayoutScores) + countUnfinishedPlayouts(longPlayoutScores);
+    if (playoutStats != nullptr) {
+      *playoutStats = {};
+    }
+    return (float) cutoff->upperBound;
+  }
+  return combinePlayoutScores(&sequences, searchConfig, shortPlayoutScores, longPlayoutScores, playoutStats);
+}
+/* ----------- TESTS ----------- */
 
-  return (NUM_PLAYOUTS_SHORT == 0 ? 0 : (shortPlayoutScore / NUM_PLAYOUTS_SHORT)) +
-         (NUM_PLAYOUTS_LONG == 0 ? 0 : (longPlayoutScore / NUM_PLAYOUTS_LONG));
+/**
+ * Estimates how much stratifying the first pieces reduces the variance of the short playout score, for one starting state.
+ * Runs many playouts per stratum, then compares the variance of a plain Monte Carlo mean (the total variance of one playout)
+ * against that of a proportionally allocated stratified mean (the average within-stratum variance), at the same number of playouts.
+ * @returns the ratio of plain to stratified variance (higher is better)
+ */
+double testStratifiedPlayoutVariance(GameState gameState, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig, int previousPieceIndex, int stratifyDepth){
+  const PieceSequenceSet *sequenceSet = getPieceSequenceSet(searchConfig);
+  StratifiedSequences sequences;
+  buildStratifiedSequences(sequenceSet, previousPieceIndex, stratifyDepth, sequenceSet->numPerBatch, &sequences);
+  int numSequences = (int) sequences.stratumIndices.size();
+  vector<float> scores(numSequences);
+  vector<PlayoutRequest> requests;
+  for (int i = 0; i < numSequences; i++) {
+    int stratum = sequences.stratumIndices[i];
+    requests.push_back({&sequences.pieces[i * sequences.sequenceLength], min(searchConfig->playoutLengthShort, sequences.sequenceLength), &scores[i],
+                        (float) (sequences.stratumWeights[stratum] / sequences.stratumCounts[stratum]), /* upperBound= */ 0});
+  }
+  playSequencesSharingPrefixes(gameState, 0, 0, evalContextTable, searchConfig, /* evalCache= */ nullptr, requests, /* cutoff= */ nullptr);
+
+  int numStrata = (int) sequences.stratumWeights.size();
+  vector<double> means(numStrata, 0);
+  vector<double> squares(numStrata, 0);
+  for (int i = 0; i < numSequences; i++) {
+    means[sequences.stratumIndices[i]] += scores[i];
+    squares[sequences.stratumIndices[i]] += (double) scores[i] * scores[i];
+  }
+  double overallMean = 0;
+  double withinVariance = 0;
+  for (int stratum = 0; stratum < numStrata; stratum++) {
+    means[stratum] /= sequences.stratumCounts[stratum];
+    overallMean += sequences.stratumWeights[stratum] * means[stratum];
+    withinVariance += sequences.stratumWeights[stratum] * (squares[stratum] / sequences.stratumCounts[stratum] - means[stratum] * means[stratum]);
+  }
+  double totalVariance = withinVariance;
+  for (int stratum = 0; stratum < numStrata; stratum++) {
+    totalVariance += sequences.stratumWeights[stratum] * (means[stratum] - overallMean) * (means[stratum] - overallMean);
+  }
+  double ratio = withinVariance <= 0 ? 1 : totalVariance / withinVariance;
+  printf("Stratify depth %d: mean %f, plain variance %f, stratified variance %f, ratio %f\n", stratifyDepth, overallMean, totalVariance, withinVariance, ratio);
+  return ratio;
+}
+
+/**
+ * Checks that the playout policy's bounded evals never discard the best placement: for each piece from one starting state,
+ * compares the placement that pickLockPlacement picks against the best score from evaluating every placement in full.
+ * Worth running with overridden weights (e.g. positive coefs, or the light policy), since the defaults leave a lot of slack in the bounds.
+ * @returns the number of pieces for which the policy picked a worse placement
+ */
+int testBoundedPlayoutPolicy(GameState gameState, const EvalContext *evalContext, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig){
+  const EvalContext *policyContext = getPlayoutPolicyContext(evalContext, evalContextTable, searchConfig);
+  int numMismatches = 0;
+  for (int pieceIndex = 0; pieceIndex < 7; pieceIndex++) {
+    vector<LockPlacement> lockPlacements;
+    moveSearch(gameState, &PIECE_LIST[pieceIndex], policyContext->pieceRangeContext.inputFrameTimeline, getPlayoutCanTuck(searchConfig), lockPlacements);
+    if (lockPlacements.empty()) {
+      continue;
+    }
+    float bestScore = -INFINITY;
+    for (LockPlacement const &lockPlacement : lockPlacements) {
+      bestScore = max(bestScore, fastEval(gameState, advanceGameState(gameState, lockPlacement, policyContext), lockPlacement, policyContext));
+    }
+    LockPlacement picked = pickLockPlacement(gameState, policyContext, /* evalCache= */ nullptr, /* topK= */ 0, lockPlacements);
+    float pickedScore = fastEval(gameState, advanceGameState(gameState, picked, policyContext), picked, policyContext);
+    if (pickedScore != bestScore) {
+      printf("Bounded eval discarded the best placement: piece %d, picked %f, best %f\n", pieceIndex, pickedScore, bestScore);
+      numMismatches++;
+    }
+  }
+  return numMismatches;
 }
 
 
@@ -121,7 +571,7 @@ int numPlayoutsShort = 0;
 high_resolution_clock::time_point t1 = high_resolution_clock::now();
 for (int i = 0; i < 1000; i++) {
   // Do one playout
-  const int *pieceSequence = canonicalPieceSequences + (offset + i) * SEQUENCE_LENGTH;  // Index into the mega array of piece sequences;
+  const int *pieceSequence = getPieceSequence(sequenceSet, offsetIndex, i);
   float playoutScore = playSequence(gameState, pieceRangeContextLookup, pieceSequence, PLAYOUT_LENGTH_SHORT);
   shortPlayoutScore += playoutScore;
   numPlayoutsShort += 1;
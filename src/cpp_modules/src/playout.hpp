@@ -3,13 +3,84 @@
 
 #include "types.hpp"
 #include "utils.hpp"
+#include "eval_cache.hpp"
+#include "piece_sequences.hpp"
 #include <vector>
 #include <list>
 
 LockPlacement pickLockPlacement(GameState gameState,
                            const EvalContext *evalContext,
+                           EvalCache *evalCache,
+                           int topK,
                            OUT std::vector<LockPlacement> &lockPlacements);
 
-float getPlayoutScore(GameState gameState, const PieceRangeContext pieceRangeContextLookup[3], int offsetIndex);
+/** One playout within a batch that shares prefixes: the sequence to follow, how many pieces to play, and where to write its total. */
+struct PlayoutRequest {
+  const int *pieceSequence;
+  int playoutLength;
+  float *result;
+  float weight;     // The playout's share of the playout score (only used for cutoffs)
+  float upperBound; // The best total the playout can still reach, in points (only used for cutoffs)
+};
+
+#define PLAYOUT_CUTOFF_MARGIN 0.01 // Leeway for float rounding, in points, so that a cutoff never changes which candidates rank higher
+
+/**
+ * Tracks whether a candidate's playouts can still reach a threshold score.
+ * The bound starts out assuming every playout gets the best possible total, and tightens as each playout finishes.
+ */
+struct PlayoutCutoff {
+  float threshold;       // The playout score the candidate needs to possibly matter, in points
+  double upperBound;     // The best playout score still possible, in points
+  int isCutOff;          // Whether the bound fell below the threshold (so the remaining playouts were skipped)
+  int numPlayoutsCutOff; // How many playouts were skipped
+  float maxEvalScore;       // See getPlayoutContextBounds
+  float maxLineClearReward;
+  float maxDeathScore;      // A playout that tops out scores this, regardless of its rewards so far
+};
+
+void playSequencesSharingPrefixes(GameState gameState, float totalReward, int depth, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig, EvalCache *evalCache, std::vector<PlayoutRequest> const &requests, PlayoutCutoff *cutoff);
+
+/** Summary statistics of the playouts behind one playout score, in points. */
+struct PlayoutStats {
+  int numPlayouts;
+  double playoutVariance; // Sample variance of a single playout's score (pooled across the short and long playouts)
+  double meanVariance;    // Estimated variance of the playout score itself, i.e. the squared standard error
+};
+
+/** A set of playout sequences whose first pieces are enumerated (one stratum per possible prefix) and whose later pieces are sampled. */
+struct StratifiedSequences {
+  int stratifyDepth;
+  int sequenceLength;
+  std::vector<int> pieces;            // sequenceLength pieces per sequence
+  std::vector<int> stratumIndices;    // The stratum of each sequence
+  std::vector<double> stratumWeights; // The probability of each stratum's prefix, given the previous piece
+  std::vector<int> stratumCounts;     // The number of sequences in each stratum
+};
+
+/**
+ * Builds roughly numPlayouts sequences that cover every possible prefix of the given depth, allocated in proportion to the prefix's
+ * probability under transitionProbability (with at least one sequence per prefix).
+ */
+void buildStratifiedSequences(const PieceSequenceSet *sequenceSet, int previousPieceIndex, int stratifyDepth, int numPlayouts, OUT StratifiedSequences *sequences);
+
+/** The piece sequences behind one playout score. They only depend on the config and the previous piece, so every candidate in a request can share them. */
+struct PlayoutSequences {
+  int isStratified;
+  const PieceSequenceSet *sequenceSet; // What the sequences are sampled from (see getPieceSequenceSet)
+  int previousPieceIndex;
+  int numShort;
+  int numLong;
+  StratifiedSequences shortSequences;
+  StratifiedSequences longSequences;
+};
+
+/**
+ * Estimates the value of a state by averaging playouts from it.
+ * @param playoutStats - if not null, receives the spread of the playouts behind the estimate
+ * @param cutoff - if not null, the playouts stop once the score provably can't reach cutoff->threshold.
+ *                 In that case, the bound is returned instead (which is still below the threshold) and the stats are left empty.
+ */
+float getPlayoutScore(GameState gameState, const EvalContextTable *evalContextTable, const SearchConfig *searchConfig, EvalCache *evalCache, int offsetIndex, OUT PlayoutStats *playoutStats, PlayoutCutoff *cutoff);
 
 #endif
@@ -0,0 +1,114 @@
+#include "playout_budget.hpp"
+#include "playout.hpp"
+#include "eval_context.hpp"
+#include "search_config.hpp"
+#include "piece_ranges.hpp"
+#include "piece_sequences.hpp"
+#include <chrono>
+using namespace std;
+
+double PLAYOUT_STEP_COST_MS = 0; // 0 until calibrated
+
+/** A mid-game position at level 18, with a few rows stacked and a well on the right. */
+GameState getCalibrationGameState(){
+  std::string boardStr;
+  for (int r = 0; r < 20; r++) {
+    boardStr += r < 16 ? "0000000000" : (r < 18 ? "1111111110" : "1111011110");
+  }
+  GameState gameState = {{}, {}, 0, 0, /* lines= */ 0, /* level= */ 18, /* columns= */ {}};
+  encodeBoard(boardStr.c_str(), gameState.board);
+  getColumns(gameState.board, gameState.columns);
+  getSurfaceArray(gameState.columns, gameState.surfaceArray);
+  updateSurfaceAndHoles(&gameState, /* excludeHolesColumn= */ 9);
+  return gameState;
+}
+
+double calibratePlayoutCost(){
+  const PieceRangeContext pieceRangeContextLookup[3] = {
+    getPieceRangeContext(CALIBRATION_TIMELINE, 1),
+    getPieceRangeContext(CALIBRATION_TIMELINE, 2),
+    getPieceRangeContext(CALIBRATION_TIMELINE, 3),
+  };
+  SearchConfig searchConfig = getDefaultSearchConfig();
+  EvalContextTable evalContextTable;
+  initEvalContextTable(pieceRangeContextLookup, &searchConfig, &evalContextTable);
+  GameState gameState = getCalibrationGameState();
+  int numSteps = searchConfig.numPlayoutsShort * searchConfig.playoutLengthShort + searchConfig.numPlayoutsLong * searchConfig.playoutLengthLong;
+
+  double fastestMs = -1;
+  for (int trial = 0; trial < CALIBRATION_NUM_TRIALS; trial++) {
+    // Use a fresh cache each time, like a real request would
+    EvalCache evalCache;
+    initEvalCache(&evalCache, searchConfig.useEvalCache);
+    auto startTime = std::chrono::steady_clock::now();
+    getPlayoutScore(gameState, &evalContextTable, &searchConfig, &evalCache, /* offsetIndex= */ trial % 7, /* playoutStats= */ nullptr, /* cutoff= */ nullptr);
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    if (fastestMs < 0 || elapsedMs < fastestMs) {
+      fastestMs = elapsedMs;
+    }
+  }
+  PLAYOUT_STEP_COST_MS = max(fastestMs, 1e-6) / max(numSteps, 1);
+  return PLAYOUT_STEP_COST_MS;
+}
+
+double getPlayoutStepCostMs(){
+  if (PLAYOUT_STEP_COST_MS <= 0) {
+    calibratePlayoutCost();
+  }
+  return PLAYOUT_STEP_COST_MS;
+}
+
+PlayoutBudget getPlayoutBudget(const SearchConfig *searchConfig, double msBeforePlayouts, int numAvailableCandidates){
+  PlayoutBudget budget = {};
+  budget.targetMs = searchConfig->targetLatencyMs;
+  budget.msPerPlayoutStep = getPlayoutStepCostMs();
+  budget.msBeforePlayouts = msBeforePlayouts;
+  budget.numCandidates = min(searchConfig->depth2PruningBreadth, numAvailableCandidates);
+  budget.numPlayoutsShort = searchConfig->numPlayoutsShort;
+  budget.playoutLengthShort = searchConfig->playoutLengthShort;
+  budget.numPlayoutsLong = searchConfig->numPlayoutsLong;
+  budget.playoutLengthLong = searchConfig->playoutLengthLong;
+  int configuredSteps = budget.numPlayoutsShort * budget.playoutLengthShort + budget.numPlayoutsLong * budget.playoutLengthLong;
+  if (budget.numCandidates <= 0 || configuredSteps <= 0) {
+    return budget;
+  }
+
+  // How many playout steps each candidate can afford
+  double affordableSteps = max(0.0, budget.targetMs - msBeforePlayouts) / budget.msPerPlayoutStep;
+  double stepsPerCandidate = affordableSteps / budget.numCandidates;
+  double scale = stepsPerCandidate / configuredSteps;
+
+  // Scale the number of playouts, keeping at least a minimum number
+  int minPlayoutsShort = min(budget.numPlayoutsShort, MIN_BUDGETED_PLAYOUTS);
+  int minPlayoutsLong = min(budget.numPlayoutsLong, MIN_BUDGETED_PLAYOUTS);
+  int maxPlayouts = getPieceSequenceSet(searchConfig)->numPerBatch;
+  budget.numPlayoutsShort = min(maxPlayouts, max(minPlayoutsShort, (int) (budget.numPlayoutsShort * scale)));
+  budget.numPlayoutsLong = min(maxPlayouts, max(minPlayoutsLong, (int) (budget.numPlayoutsLong * scale)));
+  if (scale >= 1) {
+    return budget;
+  }
+
+  // Then shorten the playouts
+  while (budget.numPlayoutsShort * budget.playoutLengthShort + budget.numPlayoutsLong * budget.playoutLengthLong > stepsPerCandidate) {
+    if (budget.playoutLengthLong > 1 && budget.playoutLengthLong >= budget.playoutLengthShort) {
+      budget.playoutLengthLong--;
+    } else if (budget.playoutLengthShort > 1) {
+      budget.playoutLengthShort--;
+    } else {
+      break;
+    }
+  }
+
+  // Then play out fewer candidates
+  int stepsPerCandidateUsed = budget.numPlayoutsShort * budget.playoutLengthShort + budget.numPlayoutsLong * budget.playoutLengthLong;
+  budget.numCandidates = max(1, min(budget.numCandidates, (int) (affordableSteps / stepsPerCandidateUsed)));
+  return budget;
+}
+
+std::string encodePlayoutBudget(const PlayoutBudget *budget, double actualMs){
+  char buf[300];
+  snprintf(buf, sizeof(buf), "{\"targetMs\":%f,\"actualMs\":%f,\"msBeforePlayouts\":%f,\"msPerPlayoutStep\":%f,\"numCandidates\":%d,\"numPlayoutsShort\":%d,\"playoutLengthShort\":%d,\"numPlayoutsLong\":%d,\"playoutLengthLong\":%d}",
+           budget->targetMs, actualMs, budget->msBeforePlayouts, budget->msPerPlayoutStep, budget->numCandidates,
+           budget->numPlayoutsShort, budget->playoutLengthShort, budget->numPlayoutsLong, budget->playoutLengthLong);
+  return std::string(buf);
+}
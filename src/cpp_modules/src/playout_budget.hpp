@@ -0,0 +1,44 @@
+#ifndef PLAYOUT_BUDGET
+#define PLAYOUT_BUDGET
+
+#include "types.hpp"
+#include "utils.hpp"
+#include <string>
+
+#define MIN_BUDGETED_PLAYOUTS 10     // Shorten playouts rather than run fewer than this many per candidate
+#define CALIBRATION_NUM_TRIALS 3     // Calibration keeps the fastest of this many timed runs
+#define CALIBRATION_TIMELINE "X....." // The tapping speed of the reference position (playout cost barely depends on it)
+
+/** The playout work chosen for one request, along with the latency it was chosen for. */
+struct PlayoutBudget {
+  double targetMs;
+  double msPerPlayoutStep;
+  double msBeforePlayouts; // Time already spent (mostly in the depth 2 search) when the budget was chosen
+  int numCandidates;       // How many depth 2 possibilities get played out
+  int numPlayoutsShort;
+  int playoutLengthShort;
+  int numPlayoutsLong;
+  int playoutLengthLong;
+};
+
+/**
+ * Measures this machine's cost per playout step (one piece placed in one playout) by timing playouts from a reference position.
+ * The result is stored for all later requests. Called lazily by the first request that sets a target latency.
+ * @returns the cost in milliseconds
+ */
+double calibratePlayoutCost();
+
+/** Gets the calibrated cost per playout step, calibrating first if necessary. */
+double getPlayoutStepCostMs();
+
+/**
+ * Picks the playout counts, lengths and breadth that fit in the remaining time of a request, starting from the configured ones.
+ * Spare time goes to more playouts per candidate. A tight budget first reduces the number of playouts (down to MIN_BUDGETED_PLAYOUTS),
+ * then the playout length, then the number of candidates.
+ */
+PlayoutBudget getPlayoutBudget(const SearchConfig *searchConfig, double msBeforePlayouts, int numAvailableCandidates);
+
+/** Encodes the chosen budget and the measured latency as a JSON object. */
+std::string encodePlayoutBudget(const PlayoutBudget *budget, double actualMs);
+
+#endif
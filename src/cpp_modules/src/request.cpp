@@ -0,0 +1,93 @@
+#include "request.hpp"
+#include "../data/tetrominoes.hpp"
+using namespace std;
+
+/**
+ * Reads a whole number from the cursor up to the next '|', and moves the cursor past the '|'.
+ * @returns whether it was a number from 0 to max
+ */
+int parseNumberField(char const **cursor, int max, OUT int *value){
+  char const *c = *cursor;
+  if (*c == '|') {
+    return false;
+  }
+  int number = 0;
+  for (; *c >= '0' && *c <= '9'; c++) {
+    number = number * 10 + (*c - '0');
+    if (number > max) {
+      return false;
+    }
+  }
+  if (*c != '|') {
+    return false;
+  }
+  *value = number;
+  *cursor = c + 1;
+  return true;
+}
+
+/**
+ * Reads the characters from the cursor up to the next '|', and moves the cursor past the '|'.
+ * @returns whether there was a '|' before the end of the string
+ */
+int parseStringField(char const **cursor, OUT std::string *value){
+  char const *end = strchr(*cursor, '|');
+  if (end == nullptr) {
+    return false;
+  }
+  value->assign(*cursor, end - *cursor);
+  *cursor = end + 1;
+  return true;
+}
+
+int parseRequest(char const *inputStr, OUT Request *request, OUT RequestError *error){
+  *request = {};
+  // The board, which has to be read in full before the vectorized parse can look at it
+  if (strnlen(inputStr, BOARD_STRING_LENGTH + 1) <= BOARD_STRING_LENGTH || inputStr[BOARD_STRING_LENGTH] != '|' ||
+      !encodeBoard(inputStr, request->gameState.board)) {
+    *error = {"board", "Expected 200 cells of '0' or '1', then '|'"};
+    return false;
+  }
+  char const *cursor = inputStr + BOARD_STRING_LENGTH + 1;
+
+  int level, lines, curPieceIndex, nextPieceIndex;
+  if (!parseNumberField(&cursor, MAX_LEVEL, &level)) {
+    *error = {"level", "Expected a whole number from 0 to 255, then '|'"};
+    return false;
+  }
+  if (!parseNumberField(&cursor, MAX_LINES, &lines)) {
+    *error = {"lines", "Expected a whole number from 0 to 65535, then '|'"};
+    return false;
+  }
+  if (!parseNumberField(&cursor, 6, &curPieceIndex)) {
+    *error = {"curPiece", "Expected a piece index from 0 to 6, then '|'"};
+    return false;
+  }
+  if (!parseNumberField(&cursor, 6, &nextPieceIndex)) {
+    *error = {"nextPiece", "Expected a piece index from 0 to 6, then '|'"};
+    return false;
+  }
+  if (!parseStringField(&cursor, &request->inputFrameTimeline) || request->inputFrameTimeline.empty() ||
+      request->inputFrameTimeline.find_first_not_of("X.") != std::string::npos) {
+    *error = {"inputFrameTimeline", "Expected a sequence of 'X' (input frames) and '.' (other frames), then '|'"};
+    return false;
+  }
+  if (*cursor != '\0' && !parseStringField(&cursor, &request->searchConfigOverrides)) {
+    *error = {"searchConfigOverrides", "Expected the search config overrides to end with '|'"};
+    return false;
+  }
+  if (*cursor != '\0') {
+    *error = {"request", "Unexpected fields after the search config overrides"};
+    return false;
+  }
+
+  request->gameState.level = level;
+  request->gameState.lines = lines;
+  request->curPiece = &PIECE_LIST[curPieceIndex];
+  request->nextPiece = &PIECE_LIST[nextPieceIndex];
+  return true;
+}
+
+std::string encodeRequestError(const RequestError *error){
+  return std::string("{\"error\":\"") + error->message + "\",\"field\":\"" + error->field + "\"}";
+}
@@ -0,0 +1,39 @@
+#ifndef REQUEST
+#define REQUEST
+
+#include "types.hpp"
+#include "utils.hpp"
+#include <string>
+
+#define BOARD_STRING_LENGTH 200
+#define MAX_LEVEL 255   // The level counter is a single byte
+#define MAX_LINES 65535 // See GameState::lines
+
+/**
+ * The fields of a request string, which has the form "board|level|lines|curPiece|nextPiece|inputFrameTimeline|" followed by an
+ * optional "searchConfigOverrides|" (see applySearchConfigOverrides).
+ */
+struct Request {
+  GameState gameState; // Only the board, level and lines are filled in
+  const Piece *curPiece;
+  const Piece *nextPiece;
+  std::string inputFrameTimeline;
+  std::string searchConfigOverrides;
+};
+
+/** Why a request was rejected: the field that was wrong, and how. */
+struct RequestError {
+  char const *field;
+  char const *message;
+};
+
+/**
+ * Parses and validates a request string in a single pass.
+ * @returns whether the request was valid (if not, the error says why)
+ */
+int parseRequest(char const *inputStr, OUT Request *request, OUT RequestError *error);
+
+/** @returns a JSON object of the form {"error": message, "field": field} */
+std::string encodeRequestError(const RequestError *error);
+
+#endif
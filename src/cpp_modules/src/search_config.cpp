@@ -0,0 +1,229 @@
+#include "search_config.hpp"
+#include "params.hpp"
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+struct WeightName {
+  char const *name;
+  float FastEvalWeights::*field;
+};
+
+const WeightName WEIGHT_NAMES[] = {
+  {"avgHeightCoef", &FastEvalWeights::avgHeightCoef},
+  {"builtOutLeftCoef", &FastEvalWeights::builtOutLeftCoef},
+  {"burnCoef", &FastEvalWeights::burnCoef},
+  {"coveredWellCoef", &FastEvalWeights::coveredWellCoef},
+  {"col9Coef", &FastEvalWeights::col9Coef},
+  {"deathCoef", &FastEvalWeights::deathCoef},
+  {"extremeGapCoef", &FastEvalWeights::extremeGapCoef},
+  {"holeCoef", &FastEvalWeights::holeCoef},
+  {"inaccessibleLeftCoef", &FastEvalWeights::inaccessibleLeftCoef},
+  {"inaccessibleRightCoef", &FastEvalWeights::inaccessibleRightCoef},
+  {"tetrisCoef", &FastEvalWeights::tetrisCoef},
+  {"tetrisReadyCoef", &FastEvalWeights::tetrisReadyCoef},
+  {"surfaceCoef", &FastEvalWeights::surfaceCoef},
+  {"surfaceLeftCoef", &FastEvalWeights::surfaceLeftCoef},
+  {"unableToBurnCoef", &FastEvalWeights::unableToBurnCoef},
+};
+
+struct ConfigName {
+  char const *name;
+  int SearchConfig::*field;
+  int minValue;
+  int maxValue;
+};
+
+const ConfigName CONFIG_NAMES[] = {
+  {"depth2PruningBreadth", &SearchConfig::depth2PruningBreadth, 0, 1000},
+  {"numPlayoutsShort", &SearchConfig::numPlayoutsShort, 0, MAX_SEQUENCES_PER_BATCH},
+  {"playoutLengthShort", &SearchConfig::playoutLengthShort, 1, MAX_SEQUENCE_LENGTH},
+  {"numPlayoutsLong", &SearchConfig::numPlayoutsLong, 0, MAX_SEQUENCES_PER_BATCH},
+  {"playoutLengthLong", &SearchConfig::playoutLengthLong, 1, MAX_SEQUENCE_LENGTH},
+  {"canTuck", &SearchConfig::canTuck, 0, 1},
+  {"outputStats", &SearchConfig::outputStats, 0, 1},
+  {"explainTopN", &SearchConfig::explainTopN, 0, 100},
+  {"useFixedPoint", &SearchConfig::useFixedPoint, 0, 1},
+  {"lightPlayoutPolicy", &SearchConfig::lightPlayoutPolicy, 0, 1},
+  {"playoutTopK", &SearchConfig::playoutTopK, 0, 100},
+  {"playoutStratifyDepth", &SearchConfig::playoutStratifyDepth, 0, 2},
+  {"targetLatencyMs", &SearchConfig::targetLatencyMs, 0, 60000},
+  {"playoutCutoffRank", &SearchConfig::playoutCutoffRank, 0, 100},
+  {"useEvalCache", &SearchConfig::useEvalCache, 0, 1},
+  {"sequenceSeed", &SearchConfig::sequenceSeed, 0, INT_MAX},
+  {"numSequences", &SearchConfig::numSequences, 0, MAX_SEQUENCES_PER_BATCH},
+  {"sequenceLength", &SearchConfig::sequenceLength, 0, MAX_SEQUENCE_LENGTH},
+  {"valuePlayoutTopN", &SearchConfig::valuePlayoutTopN, 0, 1000},
+};
+
+struct ConfigPathName {
+  char const *name;
+  char (SearchConfig::*field)[MAX_CONFIG_PATH];
+};
+
+const ConfigPathName CONFIG_PATH_NAMES[] = {
+  {"sequenceFile", &SearchConfig::sequenceFile},
+  {"valueFunctionFile", &SearchConfig::valueFunctionFile},
+  {"valueSampleFile", &SearchConfig::valueSampleFile},
+};
+
+// Same order as the AiMode enum
+char const *AI_MODE_NAMES[6] = {"STANDARD", "SAFE", "DIG", "LINEOUT", "NEAR_KILLSCREEN", "DIRTY_NEAR_KILLSCREEN"};
+
+const SearchConfig getDefaultSearchConfig(){
+  SearchConfig config = {};
+  for (int mode = 0; mode < 6; mode++) {
+    config.weightsByMode[mode] = getWeights((AiMode) mode);
+  }
+  config.depth2PruningBreadth = DEPTH_2_PRUNING_BREADTH;
+  config.numPlayoutsShort = NUM_PLAYOUTS_SHORT;
+  config.playoutLengthShort = PLAYOUT_LENGTH_SHORT;
+  config.numPlayoutsLong = NUM_PLAYOUTS_LONG;
+  config.playoutLengthLong = PLAYOUT_LENGTH_LONG;
+  config.canTuck = CAN_TUCK;
+  config.outputStats = false;
+  config.explainTopN = 0;
+  config.useFixedPoint = false;
+  config.lightPlayoutPolicy = false;
+  config.playoutTopK = 0;
+  config.playoutStratifyDepth = 0;
+  config.targetLatencyMs = 0;
+  config.playoutCutoffRank = 0;
+  config.useEvalCache = false;
+  config.sequenceSeed = 0;
+  config.numSequences = 0;
+  config.sequenceLength = 0;
+  config.sequenceFile[0] = '\0';
+  config.valueFunctionFile[0] = '\0';
+  config.valuePlayoutTopN = VALUE_PLAYOUT_TOP_N;
+  config.valueSampleFile[0] = '\0';
+  return config;
+}
+
+/** Looks up a weight by name, returning null if there's no such weight. */
+float FastEvalWeights::* getWeightField(std::string const &name){
+  for (WeightName const &weightName : WEIGHT_NAMES) {
+    if (name == weightName.name) {
+      return weightName.field;
+    }
+  }
+  return nullptr;
+}
+
+/** Looks up an AI mode by name, returning -1 if there's no such mode. */
+int getAiModeIndex(std::string const &name){
+  for (int mode = 0; mode < 6; mode++) {
+    if (name == AI_MODE_NAMES[mode]) {
+      return mode;
+    }
+  }
+  return -1;
+}
+
+/**
+ * Applies one override to the config.
+ * @param modePass - whether mode-specific weights should be applied (true) or the main weights and integer params (false)
+ * @returns 1 if the override was applied, 0 otherwise (unknown keys are added to rejectedEntries)
+ */
+int applyOverride(std::string const &key, char const *valueStr, int modePass, OUT SearchConfig *config, OUT FastEvalWeights *mainWeights, OUT std::vector<std::string> *rejectedEntries){
+  size_t dotIndex = key.find('.');
+  if (dotIndex != std::string::npos) {
+    if (!modePass) {
+      return 0;
+    }
+    int mode = getAiModeIndex(key.substr(0, dotIndex));
+    float FastEvalWeights::*field = getWeightField(key.substr(dotIndex + 1));
+    if (mode == -1 || field == nullptr) {
+      maybePrint("Unknown search config key: %s\n", key.c_str());
+      rejectedEntries->push_back(key);
+      return 0;
+    }
+    config->weightsByMode[mode].*field = (float) atof(valueStr);
+    return 1;
+  }
+  if (modePass) {
+    return 0;
+  }
+
+  for (ConfigPathName const &pathName : CONFIG_PATH_NAMES) {
+    if (key == pathName.name) {
+      snprintf(config->*pathName.field, MAX_CONFIG_PATH, "%s", valueStr);
+      return 1;
+    }
+  }
+  float FastEvalWeights::*field = getWeightField(key);
+  if (field != nullptr) {
+    mainWeights->*field = (float) atof(valueStr);
+    return 1;
+  }
+  for (ConfigName const &configName : CONFIG_NAMES) {
+    if (key == configName.name) {
+      int value = atoi(valueStr);
+      config->*configName.field = std::max(configName.minValue, std::min(configName.maxValue, value));
+      return 1;
+    }
+  }
+  maybePrint("Unknown search config key: %s\n", key.c_str());
+  rejectedEntries->push_back(key);
+  return 0;
+}
+
+int applySearchConfigOverrides(char const *overridesStr, OUT SearchConfig *config, OUT std::vector<std::string> *rejectedEntries){
+  std::string s = std::string(overridesStr);
+  if (s.empty()) {
+    return 0;
+  }
+  FastEvalWeights mainWeights = config->weightsByMode[STANDARD];
+  int numApplied = 0;
+
+  // Two passes, so that mode-specific weights always take precedence over the main weights they're derived from
+  for (int modePass = 0; modePass <= 1; modePass++) {
+    size_t start = 0;
+    while (start < s.length()) {
+      size_t end = s.find(',', start);
+      if (end == std::string::npos) {
+        end = s.length();
+      }
+      std::string pair = s.substr(start, end - start);
+      size_t equalsIndex = pair.find('=');
+      if (equalsIndex != std::string::npos) {
+        numApplied += applyOverride(pair.substr(0, equalsIndex), pair.c_str() + equalsIndex + 1, modePass, config, &mainWeights, rejectedEntries);
+      } else if (!modePass) {
+        maybePrint("Malformed search config entry: %s\n", pair.c_str());
+        rejectedEntries->push_back(pair);
+      }
+      start = end + 1;
+    }
+
+    // Re-derive the mode weights from the (possibly overridden) main weights
+    if (!modePass) {
+      for (int mode = 0; mode < 6; mode++) {
+        config->weightsByMode[mode] = getWeightsForMode((AiMode) mode, mainWeights);
+      }
+    }
+  }
+  return numApplied;
+}
+
+std::string encodeRejectedOverrides(std::vector<std::string> const &rejectedEntries){
+  std::string encoded = "[";
+  for (std::string const &entry : rejectedEntries) {
+    if (encoded.size() > 1) {
+      encoded.append(",");
+    }
+    encoded.append("\"");
+    for (char c : entry) {
+      if (c == '"' || c == '\\') {
+        encoded.push_back('\\');
+      }
+      if ((unsigned char) c >= 0x20) {
+        encoded.push_back(c);
+      }
+    }
+    encoded.append("\"");
+  }
+  encoded.append("]");
+  return encoded;
+}
@@ -0,0 +1,25 @@
+#ifndef SEARCH_CONFIG
+#define SEARCH_CONFIG
+
+#include "types.hpp"
+#include "utils.hpp"
+#include "piece_sequences.hpp"
+#include <string>
+#include <vector>
+
+const SearchConfig getDefaultSearchConfig();
+
+/**
+ * Applies a set of runtime overrides on top of a search config.
+ * The format is a comma-separated list of key=value pairs, e.g. "numPlayoutsShort=50,holeCoef=-30,DIG.holeCoef=-45".
+ * Unprefixed weight names override the main weights (and therefore every mode that doesn't override that weight itself),
+ * whereas weight names prefixed with a mode name only apply to that mode. Keys ending in "File" take a path rather than a number.
+ * Unknown keys and entries without an '=' are skipped and added to rejectedEntries.
+ * @returns the number of overrides that were applied
+ */
+int applySearchConfigOverrides(char const *overridesStr, OUT SearchConfig *config, OUT std::vector<std::string> *rejectedEntries);
+
+/** Encodes the rejected override entries as a JSON array of strings. */
+std::string encodeRejectedOverrides(std::vector<std::string> const &rejectedEntries);
+
+#endif
@@ -1,7 +1,10 @@
 #ifndef TYPES
 #define TYPES
 
+#include <stdint.h>
+
 #define FLOAT_EPSILON 0.000001
+#define NUM_SURFACE_HEIGHTS 23 // Surface heights range from 0 to 22 (when a piece locks partially above the board)
 #undef max
 #undef min
 
@@ -13,17 +16,21 @@ struct Piece {
   int bottomSurfaceByRotation[4][4];
   int maxYByRotation[4];
   int initialY;
+  int numRotations; // Only the first numRotations entries of the arrays above are filled in (the rest are -1)
 };
 
 /**
  * A representation of the overall state of the game, like a freeze frame before each piece spawns.
+ * It's copied by value throughout the search, so everything outside the board uses the narrowest type that fits.
  */
 struct GameState {
   int board[20];  // See board encoding details below
-  int surfaceArray[10];
-  float adjustedNumHoles; // A count of how many holes there are, with adjustments for the height of holes.
-  int lines;
-  int level;
+  int8_t surfaceArray[10]; // 0 to 22 (see NUM_SURFACE_HEIGHTS)
+  int16_t numHoles;       // Empty cells below the surface that can't be filled by a tuck (excluding the well, unless the context counts it)
+  int16_t numTuckSetups;  // Empty cells below the surface that can be (see getAdjustedNumHoles for how they're scored)
+  uint16_t lines;
+  uint8_t level; // The NES level counter is a single byte too
+  uint32_t columns[10]; // The cells of the board again, one word per column (see column encoding below)
 };
 
 /* Board encoding:
@@ -35,6 +42,10 @@ struct GameState {
    h = whether each cell is a hole
    t = whether each cell is a tuck setup
    c = whether the row is guaranteed to be burned
+
+   Column encoding:
+   Each column is a 32-bit integer, with bit (19 - r) set if the cell in row r is filled, so the bottom row is bit 0.
+   It mirrors the b bits of the rows, so that a column's height is its bit length and its holes are its unset bits below that.
  */
 
 /**
@@ -97,6 +108,26 @@ struct FastEvalWeights {
   float unableToBurnCoef;
 };
 
+/**
+ * The weighted value of each eval factor for one board, i.e. the terms that fastEval sums.
+ */
+struct EvalFactors {
+  float surface;
+  float surfaceLeft;
+  float avgHeight;
+  float lineClear;
+  float hole;
+  float guaranteedBurns;
+  float likelyBurns;
+  float inaccessibleLeft;
+  float inaccessibleRight;
+  float coveredWell;
+  float highCol9;
+  float tetrisReady;
+  float builtOutLeft;
+  float unableToBurn;
+};
+
 /**
  * Precomputed meta-information related to tapping speed and piece reachability.
  * Considered "global" because the tapping speed does not change within the lifetime of one query to the C++ module
@@ -116,6 +147,7 @@ struct PieceRangeContext {
  * Notably excludes any context that depends primarily on the tapping speed and level (which would be included in the global context)
  */
 struct EvalContext {
+  int contextId; // Unique per (gravity, mode) pair within one request
   AiMode aiMode;
   FastEvalWeights weights;
   PieceRangeContext pieceRangeContext;
@@ -125,12 +157,62 @@ struct EvalContext {
   float scareHeight;
   int shouldRewardLineClears;
   int wellColumn; // Equals -1 if lining out
+  float col9FactorByHeight[NUM_SURFACE_HEIGHTS]; // Precomputed getCol9Factor() for each height of col 9
+  int isLightEval; // Whether fastEval skips the most expensive factors (for the light playout policy)
+  int useFixedPoint; // Whether eval scores are integer milli-points (see toScoreUnits in eval.cpp)
+  float surfaceUpperBound; // The best weighted surface factor, in points (see boundedFastEval)
+  float costlyFactorsUpperBound; // The best total of the weighted factors that boundedFastEval computes last, in points
+};
+
+#define NUM_EVAL_CONTEXTS 18 // 3 gravities * 6 modes
+
+/**
+ * All of the eval contexts for one request, indexed by contextId.
+ * A context only depends on the gravity and the AI mode (which also decides the well column), given the request's tapping speed and config.
+ */
+struct EvalContextTable {
+  EvalContext contexts[NUM_EVAL_CONTEXTS];
+  EvalContext lightContexts[NUM_EVAL_CONTEXTS]; // The same contexts with isLightEval set (and their own contextIds, so they're cached separately)
+  float maxEvalScoreByContext[NUM_EVAL_CONTEXTS]; // The best fastEval score each full context can give, in points (see getEvalUpperBound)
+};
+
+#define MAX_CONFIG_PATH 256
+
+/**
+ * The tunable parameters of one query to the C++ module.
+ * Defaults come from config.hpp and params.hpp, but every field can be overridden at runtime per request (see search_config.cpp),
+ * so that weight sweeps don't need to recompile the addon.
+ */
+struct SearchConfig {
+  FastEvalWeights weightsByMode[6]; // Indexed by AiMode
+  int depth2PruningBreadth;
+  int numPlayoutsShort;
+  int playoutLengthShort;
+  int numPlayoutsLong;
+  int playoutLengthLong;
+  int canTuck;
+  int outputStats; // Whether to append a "_stats" entry to the encoded result
+  int explainTopN; // How many of the best lock positions to append an "_explain" factor breakdown for
+  int useFixedPoint; // Whether to sum eval factors and playouts as integers, so that scores don't depend on summation order
+  int lightPlayoutPolicy; // Whether playouts pick placements without tucks and with a reduced eval (the final eval is still full)
+  int playoutTopK; // If positive, playouts only fully evaluate the K placements with the best surface
+  int playoutStratifyDepth; // How many of the first playout pieces are enumerated and weighted by probability, rather than sampled (0 = off)
+  int targetLatencyMs; // If set, the playout counts, lengths and breadth are picked to fit this latency (see playout_budget.cpp)
+  int playoutCutoffRank; // If positive, a candidate's playouts stop once it provably can't make the top N lock positions, which then report that bound instead of their full value (0 = off)
+  int useEvalCache; // Whether playouts memoize their evals across candidates (see eval_cache.hpp). Off by default, since shared prefixes leave few repeats
+  int sequenceSeed; // If nonzero, playouts follow sequences generated from this seed instead of the canonical ones (see piece_sequences.cpp)
+  int numSequences; // How many sequences to keep or generate per previous piece (0 = all of the file or canonical set, or 1000 if generated)
+  int sequenceLength; // How many pieces to keep or generate per sequence (0 = the full length, or SEQUENCE_LENGTH if generated)
+  char sequenceFile[MAX_CONFIG_PATH]; // If set, a packed sequence file to play out instead of the canonical sequences
+  char valueFunctionFile[MAX_CONFIG_PATH]; // If set, a value function that estimates the playout score of candidates beyond the top few (see value_function.cpp)
+  int valuePlayoutTopN; // With a value function, how many candidates still get real playouts (the rest of the playout breadth gets estimates)
+  char valueSampleFile[MAX_CONFIG_PATH]; // If set, a CSV file to append each played-out candidate's features and playout score to, for training
 };
 
+/** A state two placements on from a search's starting state, by its placements' indices in the search (see Depth2Search). */
 struct Depth2Possibility {
-  LockLocation firstPlacement;
-  LockLocation secondPlacement;
-  GameState resultingState;
+  int firstPlacementIndex;
+  int secondPlacementIndex;
   float evalScore;
   float immediateReward;
 };
@@ -2,8 +2,16 @@
 #define UTILS
 
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <random>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "./config.hpp"
 
 // No-op used to mark output parameters
@@ -25,9 +33,15 @@
 #define ALL_HOLE_BITS (1023 << 10)
 #define ALL_AUXILIARY_BITS (~1023) // The union of hole bits and tuck bits
 
+// Useful bit-columns (see the column encoding in types.h)
+#define ROW_BIT(r) (1u << (19 - (r))) // The bit for row r in a column
+#define FULL_COLUMN 0xFFFFFu
+#define COLUMN_HEIGHT(column) ((column) ? 32 - __builtin_clz(column) : 0) // The height of the highest filled cell, or 0 if empty
+
 // Other encodings
 #define TUCK_COL_ENCODED(r, x) ((r) * 10 + (x) + 2) // Encoding of a rotation/column pair, as a number 0-39
 #define UNREACHED 99
+#define NO_TUCK_NOTATION '.' // The tuck input of a placement that's reached without a tuck
 
 // Converts a SimState to a LockPlacement (assuming no tuck)
 #define TO_LOCK_PLACEMENT(s) ({(s).x, (s).y, (s).rotationIndex, -1, '.'})
@@ -44,7 +58,7 @@ void maybePrint(const char *format, ...) {
   va_end(args);
 }
 
-void printBoard(int board[20]) {
+void printBoard(const int board[20]) {
   printf("----- Board start -----\n");
   for (int i = 0; i < 20; i++) {
     char line[] = "..........";
@@ -73,7 +87,7 @@ void printBoardWithPiece(int board[20], Piece piece, int x, int y, int rot){
   }
 }
 
-void printSurface(int surfaceArray[10]) {
+void printSurface(const int8_t surfaceArray[10]) {
   for (int i = 0; i < 9; i++) {
     printf("%d ", surfaceArray[i]);
   }
@@ -111,7 +125,51 @@ void printBoardBits(int board[20]){
 
 /* --------- BOARD ENCODINGS -------- */
 
-void encodeBoard(char const *boardStr, int outBoard[20]) {
+/** The cells of a row in string order (leftmost first), turned into a row (leftmost in bit 9). */
+struct ReversedRowTable {
+  uint16_t rows[1024];
+};
+
+constexpr ReversedRowTable getReversedRowTable() {
+  ReversedRowTable table = {};
+  for (int cells = 0; cells < 1024; cells++) {
+    for (int j = 0; j < 10; j++) {
+      if (cells & (1 << j)) {
+        table.rows[cells] |= 1 << (9 - j);
+      }
+    }
+  }
+  return table;
+}
+
+inline constexpr ReversedRowTable REVERSED_ROW_TABLE = getReversedRowTable();
+
+/**
+ * Parses the 200 characters of a board string ('1' for a filled cell and '0' for an empty one, row by row from the top).
+ * @returns whether every character was a '0' or a '1' (other characters are read as empty cells)
+ */
+int encodeBoard(char const *boardStr, OUT int outBoard[20]) {
+#ifdef __SSE2__
+  // Compare 16 characters at a time, giving a bit per cell in string order (the last load only has 8)
+  uint16_t cellBits[13];
+  int isValid = 1;
+  for (int chunk = 0; chunk < 13; chunk++) {
+    __m128i chars = chunk < 12 ? _mm_loadu_si128((const __m128i *) (boardStr + 16 * chunk))
+                               : _mm_loadl_epi64((const __m128i *) (boardStr + 16 * chunk));
+    int ones = _mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('1')));
+    int zeros = _mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('0')));
+    int inBoard = chunk < 12 ? 0xFFFF : 0xFF;
+    isValid &= ((ones | zeros) & inBoard) == inBoard;
+    cellBits[chunk] = (uint16_t) (ones & inBoard);
+  }
+  for (int i = 0; i < 20; i++) {
+    int word = i * 10 / 16;
+    uint32_t cells = (cellBits[word] | (uint32_t) cellBits[word + 1] << 16) >> (i * 10 % 16);
+    outBoard[i] = REVERSED_ROW_TABLE.rows[cells & FULL_ROW];
+  }
+  return isValid;
+#else
+  int isValid = 1;
   for (int i = 0; i < 20; i++) {
     int acc = 0;
     for (int j = 0; j < 10; j++) {
@@ -119,20 +177,69 @@ void encodeBoard(char const *boardStr, int outBoard[20]) {
       acc *= 2;
       if (c == '1') {
         acc += 1;
+      } else if (c != '0') {
+        isValid = 0;
       }
     }
     outBoard[i] = acc;
   }
+  return isValid;
+#endif
 }
 
-void getSurfaceArray(int board[20], int outSurface[10]) {
+/** Transposes the cells of a board into column words. */
+void getColumns(int board[20], OUT uint32_t outColumns[10]) {
   for (int col = 0; col < 10; col++) {
-    int colMask = 1 << (9 - col);
-    int row = 0;
-    while (!(board[row] & colMask) && row < 20) {
-      row++;
+    outColumns[col] = 0;
+  }
+  for (int r = 0; r < 20; r++) {
+    for (int col = 0; col < 10; col++) {
+      if (board[r] & (1 << (9 - col))) {
+        outColumns[col] |= ROW_BIT(r);
+      }
     }
-    outSurface[col] = 20 - row;
+  }
+}
+
+void getSurfaceArray(const uint32_t columns[10], OUT int8_t outSurface[10]) {
+  for (int col = 0; col < 10; col++) {
+    outSurface[col] = COLUMN_HEIGHT(columns[col]);
+  }
+}
+
+/**
+ * Removes cleared rows from the column words, moving the cells above each one down a row.
+ * @param clearedRows - the ROW_BIT of each cleared row, OR'd together
+ */
+void removeRowsFromColumns(OUT uint32_t columns[10], uint32_t clearedRows) {
+#ifdef __BMI2__
+  // Gather the bits of the surviving rows down towards the bottom, in one instruction per column
+  for (int col = 0; col < 10; col++) {
+    columns[col] = _pext_u32(columns[col], ~clearedRows);
+  }
+#else
+  // Remove the highest row first, so that the lower rows' bits don't move
+  while (clearedRows) {
+    uint32_t belowMask = (1u << (31 - __builtin_clz(clearedRows))) - 1;
+    for (int col = 0; col < 10; col++) {
+      columns[col] = (columns[col] & belowMask) | ((columns[col] >> 1) & ~belowMask);
+    }
+    clearedRows &= belowMask;
+  }
+#endif
+}
+
+/**
+ * Removes cleared rows from a board, moving the rows above each one down and adding empty rows at the top.
+ * @param clearedRows - the ROW_BIT of each cleared row, OR'd together
+ */
+void removeRowsFromBoard(OUT int board[20], uint32_t clearedRows) {
+  // Remove the highest row first, so that the lower rows don't move
+  while (clearedRows) {
+    int highestBit = 31 - __builtin_clz(clearedRows);
+    memmove(&board[1], &board[0], (19 - highestBit) * sizeof(int));
+    board[0] = 0;
+    clearedRows &= ~(1u << highestBit);
   }
 }
 
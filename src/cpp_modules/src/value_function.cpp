@@ -0,0 +1,315 @@
+#include "value_function.hpp"
+#include "eval.hpp"
+#include "eval_context.hpp"
+#include "playout_budget.hpp"
+#include "search_config.hpp"
+#include <chrono>
+#include <math.h>
+#include <string.h>
+
+char const *VALUE_FEATURE_NAMES[NUM_VALUE_FEATURES] = {
+  "bias",
+  "surface", "surfaceLeft", "avgHeight", "lineClear", "hole", "guaranteedBurns", "likelyBurns", // Same order as EVAL_FACTOR_NAMES
+  "inaccessibleLeft", "inaccessibleRight", "coveredWell", "highCol9", "tetrisReady", "builtOutLeft", "unableToBurn",
+  "evalTotal",
+  "maxColumnHeight", "meanColumnHeight", "bumpiness", "wellHeight", "numHoles",
+  "mode.STANDARD", "mode.SAFE", "mode.DIG", "mode.LINEOUT", "mode.NEAR_KILLSCREEN", "mode.DIRTY_NEAR_KILLSCREEN",
+};
+
+ValueFunction LOADED_VALUE_FUNCTION = {};
+std::string LOADED_VALUE_FUNCTION_PATH; // Empty if nothing is loaded
+
+void getValueFeatures(GameState gameState, const EvalContextTable *evalContextTable, OUT float features[VALUE_FEATURE_STRIDE]){
+  const EvalContext *evalContext = lookupEvalContext(gameState, evalContextTable);
+  EvalFactors factors;
+  float total = getEvalFactors(gameState, gameState, evalContext, &factors);
+
+  int f = 0;
+  features[f++] = 1;
+  for (EvalFactorName const &factorName : EVAL_FACTOR_NAMES) {
+    features[f++] = max(evalContext->weights.deathCoef, factors.*factorName.field); // Some factors are -INFINITY on hopeless boards
+  }
+  features[f++] = total;
+
+  int maxHeight = 0;
+  int totalHeight = 0;
+  int bumpiness = 0;
+  for (int c = 0; c < 9; c++) {
+    maxHeight = max(maxHeight, (int) gameState.surfaceArray[c]);
+    totalHeight += gameState.surfaceArray[c];
+    bumpiness += c < 8 ? abs(gameState.surfaceArray[c] - gameState.surfaceArray[c + 1]) : 0;
+  }
+  features[f++] = maxHeight;
+  features[f++] = totalHeight / 9.0f;
+  features[f++] = bumpiness;
+  features[f++] = gameState.surfaceArray[9];
+  features[f++] = getAdjustedNumHoles(gameState);
+
+  for (int mode = 0; mode < 6; mode++) {
+    features[f++] = evalContext->aiMode == mode;
+  }
+  for (; f < VALUE_FEATURE_STRIDE; f++) {
+    features[f] = 0;
+  }
+}
+
+float estimateValue(const ValueFunction *valueFunction, const float features[VALUE_FEATURE_STRIDE]){
+  // Independent partial sums, so that the compiler can keep them in one vector register
+  float lanes[VALUE_LANES] = {};
+  for (int i = 0; i < VALUE_FEATURE_STRIDE; i += VALUE_LANES) {
+    for (int j = 0; j < VALUE_LANES; j++) {
+      lanes[j] += valueFunction->weights[i + j] * features[i + j];
+    }
+  }
+  float total = 0;
+  for (int j = 0; j < VALUE_LANES; j++) {
+    total += lanes[j];
+  }
+  return total;
+}
+
+int loadValueFunction(char const *path, OUT ValueFunction *valueFunction){
+  FILE *file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  *valueFunction = {};
+  char line[256];
+  int isValid = true;
+  while (isValid && fgets(line, sizeof(line), file) != nullptr) {
+    char name[128];
+    float weight;
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    if (sscanf(line, "%127s %f", name, &weight) != 2) {
+      isValid = false;
+      break;
+    }
+    isValid = false;
+    for (int f = 0; f < NUM_VALUE_FEATURES; f++) {
+      if (strcmp(name, VALUE_FEATURE_NAMES[f]) == 0) {
+        valueFunction->weights[f] = weight;
+        isValid = true;
+      }
+    }
+  }
+  fclose(file);
+  return isValid;
+}
+
+int writeValueFunction(char const *path, const ValueFunction *valueFunction, int numSamples){
+  FILE *file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file, "# Value function weights, trained on %d playout scores\n", numSamples);
+  for (int f = 0; f < NUM_VALUE_FEATURES; f++) {
+    fprintf(file, "%s %.9g\n", VALUE_FEATURE_NAMES[f], valueFunction->weights[f]);
+  }
+  return fclose(file) == 0;
+}
+
+const ValueFunction *getValueFunction(const SearchConfig *searchConfig){
+  if (searchConfig->valueFunctionFile[0] == '\0') {
+    return nullptr;
+  }
+  if (LOADED_VALUE_FUNCTION_PATH != searchConfig->valueFunctionFile) {
+    if (!loadValueFunction(searchConfig->valueFunctionFile, &LOADED_VALUE_FUNCTION)) {
+      maybePrint("Unable to load value function: %s\n", searchConfig->valueFunctionFile);
+      LOADED_VALUE_FUNCTION_PATH.clear();
+      return nullptr;
+    }
+    LOADED_VALUE_FUNCTION_PATH = searchConfig->valueFunctionFile;
+  }
+  return &LOADED_VALUE_FUNCTION;
+}
+
+void appendValueSample(FILE *file, const float features[VALUE_FEATURE_STRIDE], float playoutScore){
+  if (ftell(file) == 0) {
+    for (int f = 0; f < NUM_VALUE_FEATURES; f++) {
+      fprintf(file, "%s,", VALUE_FEATURE_NAMES[f]);
+    }
+    fprintf(file, "playoutScore\n");
+  }
+  for (int f = 0; f < NUM_VALUE_FEATURES; f++) {
+    fprintf(file, "%g,", features[f]);
+  }
+  fprintf(file, "%g\n", playoutScore);
+}
+
+/** Reads the samples from a CSV file written by appendValueSample. @returns whether the file was valid */
+int readValueSamples(char const *path, OUT std::vector<float> &features, OUT std::vector<float> &targets){
+  FILE *file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  char line[2048];
+  std::string expectedHeader;
+  for (int f = 0; f < NUM_VALUE_FEATURES; f++) {
+    expectedHeader += std::string(VALUE_FEATURE_NAMES[f]) + ",";
+  }
+  expectedHeader += "playoutScore";
+  int isValid = fgets(line, sizeof(line), file) != nullptr && strncmp(line, expectedHeader.c_str(), expectedHeader.size()) == 0;
+  while (isValid && fgets(line, sizeof(line), file) != nullptr) {
+    if (line[0] == '\n') {
+      continue;
+    }
+    char *cursor = line;
+    float row[VALUE_FEATURE_STRIDE] = {};
+    for (int f = 0; f <= NUM_VALUE_FEATURES; f++) {
+      char *end;
+      float value = strtof(cursor, &end);
+      if (end == cursor) {
+        isValid = false;
+        break;
+      }
+      if (f < NUM_VALUE_FEATURES) {
+        row[f] = value;
+      } else {
+        targets.push_back(value);
+      }
+      cursor = *end == ',' ? end + 1 : end;
+    }
+    if (isValid) {
+      features.insert(features.end(), row, row + VALUE_FEATURE_STRIDE);
+    }
+  }
+  fclose(file);
+  return isValid;
+}
+
+/** Solves A x = b in place by Gaussian elimination with partial pivoting, leaving x in b. A is n x n, row-major. */
+void solveLinearSystem(std::vector<double> &a, std::vector<double> &b, int n){
+  for (int col = 0; col < n; col++) {
+    int pivot = col;
+    for (int row = col + 1; row < n; row++) {
+      if (fabs(a[row * n + col]) > fabs(a[pivot * n + col])) {
+        pivot = row;
+      }
+    }
+    for (int k = 0; k < n; k++) {
+      std::swap(a[col * n + k], a[pivot * n + k]);
+    }
+    std::swap(b[col], b[pivot]);
+    for (int row = col + 1; row < n; row++) {
+      double factor = a[row * n + col] / a[col * n + col];
+      for (int k = col; k < n; k++) {
+        a[row * n + k] -= factor * a[col * n + k];
+      }
+      b[row] -= factor * b[col];
+    }
+  }
+  for (int col = n - 1; col >= 0; col--) {
+    for (int k = col + 1; k < n; k++) {
+      b[col] -= a[col * n + k] * b[k];
+    }
+    b[col] /= a[col * n + col];
+  }
+}
+
+/**
+ * Fits the weights by ridge regression on standardized features, so that the penalty treats every feature alike,
+ * then converts them back to weights on the raw features (with the bias absorbing the means).
+ */
+void fitValueFunction(std::vector<float> const &features, std::vector<float> const &targets, std::vector<int> const &sampleIndices, OUT ValueFunction *valueFunction){
+  const int n = NUM_VALUE_FEATURES;
+  int numSamples = (int) sampleIndices.size();
+  std::vector<double> means(n, 0), deviations(n, 0);
+  double meanTarget = 0;
+  for (int s : sampleIndices) {
+    for (int f = 1; f < n; f++) {
+      means[f] += features[s * VALUE_FEATURE_STRIDE + f] / numSamples;
+    }
+    meanTarget += targets[s] / numSamples;
+  }
+  for (int s : sampleIndices) {
+    for (int f = 1; f < n; f++) {
+      double diff = features[s * VALUE_FEATURE_STRIDE + f] - means[f];
+      deviations[f] += diff * diff / numSamples;
+    }
+  }
+  for (int f = 1; f < n; f++) {
+    deviations[f] = sqrt(deviations[f]);
+  }
+
+  // The normal equations over the non-constant features (the bias is implied by centering)
+  std::vector<double> gram((n - 1) * (n - 1), 0);
+  std::vector<double> moments(n - 1, 0);
+  for (int s : sampleIndices) {
+    double z[NUM_VALUE_FEATURES];
+    for (int f = 1; f < n; f++) {
+      z[f] = deviations[f] > 0 ? (features[s * VALUE_FEATURE_STRIDE + f] - means[f]) / deviations[f] : 0;
+    }
+    for (int i = 1; i < n; i++) {
+      moments[i - 1] += z[i] * (targets[s] - meanTarget);
+      for (int j = 1; j < n; j++) {
+        gram[(i - 1) * (n - 1) + (j - 1)] += z[i] * z[j];
+      }
+    }
+  }
+  for (int i = 0; i < n - 1; i++) {
+    gram[i * (n - 1) + i] += VALUE_RIDGE_PENALTY * numSamples;
+  }
+  solveLinearSystem(gram, moments, n - 1);
+
+  *valueFunction = {};
+  double bias = meanTarget;
+  for (int f = 1; f < n; f++) {
+    double weight = deviations[f] > 0 ? moments[f - 1] / deviations[f] : 0;
+    valueFunction->weights[f] = (float) weight;
+    bias -= weight * means[f];
+  }
+  valueFunction->weights[0] = (float) bias;
+}
+
+std::string trainValueFunction(char const *samplesPath, char const *weightsPath){
+  std::vector<float> features;
+  std::vector<float> targets;
+  if (!readValueSamples(samplesPath, features, targets) || targets.size() < VALUE_HOLDOUT_INTERVAL * 2) {
+    return "{\"error\":\"Unable to read enough samples\"}";
+  }
+  std::vector<int> trainIndices, holdoutIndices;
+  for (int s = 0; s < (int) targets.size(); s++) {
+    (s % VALUE_HOLDOUT_INTERVAL == VALUE_HOLDOUT_INTERVAL - 1 ? holdoutIndices : trainIndices).push_back(s);
+  }
+  ValueFunction valueFunction;
+  fitValueFunction(features, targets, trainIndices, &valueFunction);
+  if (!writeValueFunction(weightsPath, &valueFunction, (int) trainIndices.size())) {
+    return "{\"error\":\"Unable to write the weights file\"}";
+  }
+
+  // Accuracy, as the root mean squared error and the fraction of the variance explained
+  double rmse[2], r2[2];
+  std::vector<int> const *indexSets[2] = {&trainIndices, &holdoutIndices};
+  for (int set = 0; set < 2; set++) {
+    double meanTarget = 0, squaredError = 0, variance = 0;
+    for (int s : *indexSets[set]) {
+      meanTarget += targets[s] / indexSets[set]->size();
+    }
+    for (int s : *indexSets[set]) {
+      double error = estimateValue(&valueFunction, &features[s * VALUE_FEATURE_STRIDE]) - targets[s];
+      squaredError += error * error;
+      variance += (targets[s] - meanTarget) * (targets[s] - meanTarget);
+    }
+    rmse[set] = sqrt(squaredError / indexSets[set]->size());
+    r2[set] = variance > 0 ? 1 - squaredError / variance : 0;
+  }
+
+  // Speed, compared to the configured playouts on this machine
+  volatile float sink = 0;
+  auto startTime = std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < VALUE_TIMING_REPEATS; repeat++) {
+    for (int s : holdoutIndices) {
+      sink = sink + estimateValue(&valueFunction, &features[s * VALUE_FEATURE_STRIDE]);
+    }
+  }
+  double nsPerEstimate = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count() / (VALUE_TIMING_REPEATS * holdoutIndices.size());
+  SearchConfig defaultConfig = getDefaultSearchConfig();
+  double msPerPlayoutScore = getPlayoutStepCostMs() * (defaultConfig.numPlayoutsShort * defaultConfig.playoutLengthShort + defaultConfig.numPlayoutsLong * defaultConfig.playoutLengthLong);
+
+  char buf[400];
+  snprintf(buf, sizeof(buf), "{\"numTrain\":%d,\"numHoldout\":%d,\"trainRmse\":%f,\"trainR2\":%f,\"holdoutRmse\":%f,\"holdoutR2\":%f,\"nsPerEstimate\":%f,\"msPerPlayoutScore\":%f}",
+           (int) trainIndices.size(), (int) holdoutIndices.size(), rmse[0], r2[0], rmse[1], r2[1], nsPerEstimate, msPerPlayoutScore);
+  return std::string(buf);
+}
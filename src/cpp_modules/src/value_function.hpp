@@ -0,0 +1,64 @@
+#ifndef VALUE_FUNCTION
+#define VALUE_FUNCTION
+
+#include "types.hpp"
+#include "utils.hpp"
+#include <string>
+#include <vector>
+
+#define NUM_VALUE_FEATURES 27
+#define VALUE_FEATURE_STRIDE 32     // Features are padded with zeros to a multiple of the vector width
+#define VALUE_LANES 8               // How many partial sums the estimate keeps, so that the dot product vectorizes
+#define VALUE_RIDGE_PENALTY 0.001   // Ridge penalty on the standardized weights, relative to the number of samples
+#define VALUE_HOLDOUT_INTERVAL 5    // Every Nth sample is held out of training, to measure accuracy on
+#define VALUE_TIMING_REPEATS 200    // How many times the report re-estimates each held-out sample when timing
+
+/**
+ * A linear estimate of a candidate's playout score from features of its resulting state, trained offline on the playout scores
+ * that this engine produces (see trainValueFunction). Lets a search play out only the most promising few candidates.
+ */
+struct ValueFunction {
+  float weights[VALUE_FEATURE_STRIDE];
+};
+
+/** The name of each feature, as used in the training data and the weights file. */
+extern char const *VALUE_FEATURE_NAMES[NUM_VALUE_FEATURES];
+
+/**
+ * Gets the features of a state, under the eval context that a playout from that state would start in:
+ * a constant, the weighted eval factors and their total, some surface statistics, and the AI mode (one-hot).
+ */
+void getValueFeatures(GameState gameState, const EvalContextTable *evalContextTable, OUT float features[VALUE_FEATURE_STRIDE]);
+
+/** Estimates the playout score of a state from its features, in points. */
+float estimateValue(const ValueFunction *valueFunction, const float features[VALUE_FEATURE_STRIDE]);
+
+/**
+ * Gets the value function for a request's config (from the file in valueFunctionFile), or null if there isn't one
+ * or it can't be loaded, in which case every candidate is played out. The last file loaded is kept for later requests.
+ */
+const ValueFunction *getValueFunction(const SearchConfig *searchConfig);
+
+/**
+ * Reads a weights file, which has one "featureName weight" line per feature. Lines starting with '#' are comments,
+ * and missing features have a weight of 0.
+ * @returns whether the file was valid
+ */
+int loadValueFunction(char const *path, OUT ValueFunction *valueFunction);
+
+int writeValueFunction(char const *path, const ValueFunction *valueFunction, int numSamples);
+
+/**
+ * Appends one training sample (the features of a played-out state, then its playout score) to a CSV file,
+ * writing a header first if the file is new.
+ */
+void appendValueSample(FILE *file, const float features[VALUE_FEATURE_STRIDE], float playoutScore);
+
+/**
+ * Fits a value function to the samples in a CSV file by ridge regression, holding out every VALUE_HOLDOUT_INTERVAL-th sample,
+ * and writes it to a weights file.
+ * @returns a JSON report of the training and held-out accuracy, and of the speed of an estimate compared to a playout score
+ */
+std::string trainValueFunction(char const *samplesPath, char const *weightsPath);
+
+#endif